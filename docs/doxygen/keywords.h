@@ -339,6 +339,20 @@ double diffusivity_extrapolated;
 */
 double time_step_factor;
 
+/*!
+  \var time_step_interval
+  Sub-cycling interval for the resolution of a transported scalar.\n
+  With an interval \c n > 1, the evolution equation for the scalar is
+  only solved every \c n time steps, using the time accumulated since
+  its previous solve (i.e. \c n times the global time step, further
+  multiplied by \ref time_step_factor) and the latest mass flux. This is
+  useful for slowly-evolving scalars (such as pollutant concentrations)
+  which tolerate a much larger time step than the flow; the associated
+  variance of a sub-cycled scalar should be given the same interval.
+  Only used for model and user-defined scalars.
+*/
+int time_step_interval;
+
 /*!@}*/
 
 /*----------------------------------------------------------------------------*/
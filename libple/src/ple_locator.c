@@ -110,6 +110,42 @@ typedef struct {
 
 } _rank_intersects_t;
 
+/*----------------------------------------------------------------------------
+ * Structure tracking a non-blocking variable exchange.
+ *
+ * Buffers and requests are kept between exchanges, so repeated exchanges
+ * on a same locator do not lead to repeated allocation.
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  int                active;        /* Is an exchange in progress ? */
+
+  int                n_vars;        /* Number of aggregated variables */
+  int                reverse;       /* 1 if exchange is reversed */
+  size_t             type_size;     /* Size of exchanged value type */
+  size_t             t_stride;      /* Sum of variable strides */
+
+  size_t            *stride;        /* Stride of each variable */
+  void             **distant_var;   /* Per-variable distant values */
+  void             **local_var;     /* Per-variable local values */
+  const ple_lnum_t  *local_list;    /* Optional indirection for local values */
+
+  size_t             send_buf_size; /* Allocated send buffer size (bytes) */
+  size_t             recv_buf_size; /* Allocated receive buffer size (bytes) */
+  unsigned char     *send_buf;      /* Aggregated send buffer */
+  unsigned char     *recv_buf;      /* Aggregated receive buffer */
+
+#if defined(PLE_HAVE_MPI)
+  int                n_requests;    /* Number of posted MPI requests */
+  MPI_Request       *request;       /* Posted MPI requests */
+#endif
+
+  double             w_start;       /* Wall-clock time at exchange start */
+  double             cpu_start;     /* CPU time at exchange start */
+
+} _async_exchange_t;
+
 /*----------------------------------------------------------------------------
  * Structure defining a locator
  *----------------------------------------------------------------------------*/
@@ -126,6 +162,10 @@ struct _ple_locator_t {
   int       exchange_algorithm;  /* Exchange algorithm id */
   int       async_threshold;     /* Threshold for asynchronous exchange */
 
+  int       relocation_mode;     /* Behavior when the mesh is set again
+                                    (0: full search; 1: incremental, keeping
+                                    previous matches as a starting point) */
+
 #if defined(PLE_HAVE_MPI)
   MPI_Comm  comm;                /* Associated MPI communicator */
 #endif
@@ -161,6 +201,9 @@ struct _ple_locator_t {
   ple_lnum_t    n_exterior;         /* Number of local points not located */
   ple_lnum_t   *exterior_list;      /* List of points not located */
 
+  _async_exchange_t  *async_exchange;  /* Non-blocking exchange state,
+                                          or NULL */
+
   /* Timing information (2 fields/time; 0: total; 1: communication) */
 
   double  location_wtime[2];       /* Location Wall-clock time */
@@ -273,6 +316,11 @@ static int _ple_locator_location_algorithm = _LOCATE_BB_SENDRECV_ORDERED;
 
 static int _ple_locator_async_threshold = 128;
 
+/* Default relocation mode when the mesh is set again
+   (0: full search; 1: incremental) */
+
+static int _ple_locator_relocation_mode = 0;
+
 #if defined(PLE_HAVE_MPI)
 
 /* global logging function */
@@ -306,7 +354,8 @@ static void
 _parse_locator_option(const char   *key,
                       const char   *value,
                       int          *location_algorithm,
-                      int          *async_threshold)
+                      int          *async_threshold,
+                      int          *relocation_mode)
 {
   if (key == NULL || value == NULL)
     return;
@@ -323,6 +372,13 @@ _parse_locator_option(const char   *key,
     if (sscanf(value, "%d", &i_value) == 1)
       *async_threshold = i_value;
   }
+
+  else if (strncmp(key, "relocation", 64) == 0) {
+    if (strncmp(value, "full", 64) == 0)
+      *relocation_mode = 0;
+    else if (strncmp(value, "incremental", 64) == 0)
+      *relocation_mode = 1;
+  }
 }
 
 #if defined(PLE_HAVE_MPI)
@@ -1099,6 +1155,223 @@ _transfer_location_distant(ple_locator_t  *this_locator,
   PLE_FREE(this_locator->exterior_list);
 }
 
+/*----------------------------------------------------------------------------
+ * Re-check previously located points on the rank of their prior match.
+ *
+ * When coupled meshes move, most points remain in the same element or
+ * move to one of its immediate neighbors, so each point's new coordinates
+ * are sent only to the rank on which it was previously located, which
+ * re-runs its local point location. Points found again on that rank have
+ * their location updated; the others are marked as unlocated, so that the
+ * standard search handles them as a fallback.
+ *
+ * parameters:
+ *   this_locator        <-> pointer to locator structure
+ *   mesh                <-- pointer to mesh representation structure
+ *   tolerance_base      <-- associated fixed tolerance
+ *   tolerance_fraction  <-- associated fraction of element bounding
+ *                           boxes added to tolerance
+ *   n_points            <-- number of points to locate
+ *   point_list          <-- optional indirection array to point_coords
+ *   point_tag           <-- optional point tag (size: n_points)
+ *   point_coords        <-- point coordinates
+ *   location            <-> prior element assignment in, updated out
+ *   location_rank_id    <-> prior rank assignment in, updated out
+ *   distance            --> optional distance to matching element
+ *   n_prev_intersects   <-- number of previously intersecting ranks
+ *   prev_intersect_rank <-- previously intersecting ranks, in prior
+ *                           communication order
+ *   mesh_locate_f       <-- function locating points in or on elements
+ *----------------------------------------------------------------------------*/
+
+static void
+_relocate_distant(ple_locator_t               *this_locator,
+                  const void                  *mesh,
+                  float                        tolerance_base,
+                  float                        tolerance_fraction,
+                  ple_lnum_t                   n_points,
+                  const ple_lnum_t             point_list[],
+                  const int                    point_tag[],
+                  const ple_coord_t            point_coords[],
+                  ple_lnum_t                   location[],
+                  ple_lnum_t                   location_rank_id[],
+                  float                        distance[],
+                  int                          n_prev_intersects,
+                  const int                    prev_intersect_rank[],
+                  ple_mesh_elements_locate_t  *mesh_locate_f)
+{
+  ple_lnum_t j;
+  int k;
+  MPI_Status status;
+
+  double comm_timing[4] = {0., 0., 0., 0.};
+
+  ple_lnum_t *send_id;
+  ple_coord_t *send_coords;
+  int *send_tag = NULL;
+
+  const int dim = this_locator->dim;
+  const int have_tags = this_locator->have_tags;
+  const ple_lnum_t idb = this_locator->point_id_base;
+
+  PLE_MALLOC(send_id, n_points, ple_lnum_t);
+  PLE_MALLOC(send_coords, n_points*dim, ple_coord_t);
+
+  if (have_tags)
+    PLE_MALLOC(send_tag, n_points, int);
+
+  /* Loop on previously intersecting ranks, in the same (symmetric)
+     order as that used to build the prior location information */
+
+  for (int i = 0; i < n_prev_intersects; i++) {
+
+    int dist_rank = prev_intersect_rank[i];
+
+    ple_lnum_t n_coords_loc = 0, n_coords_dist = 0;
+    ple_lnum_t *location_loc, *location_dist;
+    ple_coord_t *coords_dist;
+    int *tag_dist;
+    float *distance_loc, *distance_dist;
+
+    /* Build buffer of points previously located on this rank */
+
+    for (j = 0; j < n_points; j++) {
+
+      if (location_rank_id[j] == dist_rank) {
+
+        ple_lnum_t coord_idx;
+        if (point_list != NULL)
+          coord_idx = point_list[j] - idb;
+        else
+          coord_idx = j;
+
+        send_id[n_coords_loc] = j;
+
+        for (k = 0; k < dim; k++)
+          send_coords[n_coords_loc*dim + k] = point_coords[dim*coord_idx + k];
+
+        if (have_tags)
+          send_tag[n_coords_loc] = point_tag[j];
+
+        n_coords_loc += 1;
+
+      }
+
+    }
+
+    /* Exchange new coordinates with distant rank */
+
+    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+    MPI_Sendrecv(&n_coords_loc, 1, PLE_MPI_LNUM, dist_rank, PLE_MPI_TAG,
+                 &n_coords_dist, 1, PLE_MPI_LNUM, dist_rank,
+                 PLE_MPI_TAG, this_locator->comm, &status);
+
+    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+    PLE_MALLOC(coords_dist, n_coords_dist*dim, ple_coord_t);
+    if (have_tags)
+      PLE_MALLOC(tag_dist, n_coords_dist, int);
+    else
+      tag_dist = NULL;
+
+    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+    MPI_Sendrecv(send_coords, (int)(n_coords_loc*dim),
+                 PLE_MPI_COORD, dist_rank, PLE_MPI_TAG,
+                 coords_dist, (int)(n_coords_dist*dim),
+                 PLE_MPI_COORD, dist_rank, PLE_MPI_TAG,
+                 this_locator->comm, &status);
+
+    if (have_tags)
+      MPI_Sendrecv(send_tag, (int)(n_coords_loc),
+                   MPI_INT, dist_rank, PLE_MPI_TAG,
+                   tag_dist, (int)(n_coords_dist),
+                   MPI_INT, dist_rank, PLE_MPI_TAG,
+                   this_locator->comm, &status);
+
+    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+    /* Re-locate received coords on local rank */
+
+    PLE_MALLOC(location_dist, n_coords_dist, ple_lnum_t);
+    PLE_MALLOC(distance_dist, n_coords_dist, float);
+
+    for (j = 0; j < n_coords_dist; j++) {
+      location_dist[j] = -1;
+      distance_dist[j] = -1.0;
+    }
+
+    mesh_locate_f(mesh,
+                  tolerance_base,
+                  tolerance_fraction,
+                  n_coords_dist,
+                  coords_dist,
+                  tag_dist,
+                  location_dist,
+                  distance_dist);
+
+    PLE_FREE(tag_dist);
+    PLE_FREE(coords_dist);
+
+    /* Exchange location return information with distant rank */
+
+    PLE_MALLOC(location_loc, n_coords_loc, ple_lnum_t);
+    PLE_MALLOC(distance_loc, n_coords_loc, float);
+
+    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+    MPI_Sendrecv(location_dist, (int)n_coords_dist,
+                 PLE_MPI_LNUM, dist_rank, PLE_MPI_TAG,
+                 location_loc, (int)n_coords_loc,
+                 PLE_MPI_LNUM, dist_rank, PLE_MPI_TAG,
+                 this_locator->comm, &status);
+
+    MPI_Sendrecv(distance_dist, (int)n_coords_dist,
+                 MPI_FLOAT, dist_rank, PLE_MPI_TAG,
+                 distance_loc, (int)n_coords_loc,
+                 MPI_FLOAT, dist_rank, PLE_MPI_TAG,
+                 this_locator->comm, &status);
+
+    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+    PLE_FREE(location_dist);
+    PLE_FREE(distance_dist);
+
+    /* Points located again keep their rank assignment (possibly with a
+       new element); the others fall back to the standard search */
+
+    for (j = 0; j < n_coords_loc; j++) {
+
+      ple_lnum_t l = send_id[j];
+
+      if (distance_loc[j] > -0.1) {
+        location[l] = location_loc[j];
+        if (distance != NULL)
+          distance[l] = distance_loc[j];
+      }
+      else {
+        location[l] = -1;
+        location_rank_id[l] = -1;
+      }
+
+    }
+
+    PLE_FREE(location_loc);
+    PLE_FREE(distance_loc);
+
+  } /* End of loop on previously intersecting ranks */
+
+  PLE_FREE(send_id);
+  PLE_FREE(send_tag);
+  PLE_FREE(send_coords);
+
+  /* Finalize timing */
+
+  this_locator->location_wtime[1] += comm_timing[0];
+  this_locator->location_cpu_time[1] += comm_timing[1];
+}
+
 /*----------------------------------------------------------------------------
  * Location of points not yet located on the closest elements.
  *
@@ -1752,6 +2025,127 @@ _transfer_location_local(ple_locator_t  *this_locator,
   PLE_FREE(this_locator->exterior_list);
 }
 
+/*----------------------------------------------------------------------------
+ * Re-check previously located points, in serial mode.
+ *
+ * Points found again have their location updated; the others are marked
+ * as unlocated, so that the standard search handles them as a fallback.
+ *
+ * parameters:
+ *   this_locator       <-- pointer to locator structure
+ *   mesh               <-- pointer to mesh representation structure
+ *   tolerance_base     <-- associated fixed tolerance
+ *   tolerance_fraction <-- associated fraction of element bounding
+ *                          boxes added to tolerance
+ *   n_points           <-- number of points to locate
+ *   point_list         <-- optional indirection array to point_coords
+ *   point_tag          <-- optional point tag (size: n_points)
+ *   point_coords       <-- point coordinates
+ *   location           <-> prior element assignment in, updated out
+ *   distance           --> optional distance to matching element
+ *   mesh_locate_f      <-- function locating points in or on elements
+ *----------------------------------------------------------------------------*/
+
+static void
+_relocate_local(ple_locator_t               *this_locator,
+                const void                  *mesh,
+                float                        tolerance_base,
+                float                        tolerance_fraction,
+                ple_lnum_t                   n_points,
+                const ple_lnum_t             point_list[],
+                const int                    point_tag[],
+                const ple_coord_t            point_coords[],
+                ple_lnum_t                   location[],
+                float                        distance[],
+                ple_mesh_elements_locate_t  *mesh_locate_f)
+{
+  ple_lnum_t j;
+  int k;
+
+  ple_lnum_t n_coords_loc = 0;
+  ple_lnum_t *id_loc, *location_loc;
+  ple_coord_t *coords_loc;
+  int *tag_loc = NULL;
+  float *distance_loc;
+
+  const int dim = this_locator->dim;
+  const ple_lnum_t idb = this_locator->point_id_base;
+
+  for (j = 0; j < n_points; j++) {
+    if (location[j] > -1)
+      n_coords_loc++;
+  }
+
+  if (n_coords_loc == 0)
+    return;
+
+  PLE_MALLOC(id_loc, n_coords_loc, ple_lnum_t);
+  PLE_MALLOC(coords_loc, n_coords_loc*dim, ple_coord_t);
+  PLE_MALLOC(location_loc, n_coords_loc, ple_lnum_t);
+  PLE_MALLOC(distance_loc, n_coords_loc, float);
+
+  if (point_tag != NULL)
+    PLE_MALLOC(tag_loc, n_coords_loc, int);
+
+  n_coords_loc = 0;
+
+  for (j = 0; j < n_points; j++) {
+
+    if (location[j] > -1) {
+
+      ple_lnum_t coord_idx;
+      if (point_list != NULL)
+        coord_idx = point_list[j] - idb;
+      else
+        coord_idx = j;
+
+      id_loc[n_coords_loc] = j;
+
+      for (k = 0; k < dim; k++)
+        coords_loc[n_coords_loc*dim + k] = point_coords[dim*coord_idx + k];
+
+      if (tag_loc != NULL)
+        tag_loc[n_coords_loc] = point_tag[j];
+
+      location_loc[n_coords_loc] = -1;
+      distance_loc[n_coords_loc] = -1.0;
+
+      n_coords_loc += 1;
+
+    }
+
+  }
+
+  mesh_locate_f(mesh,
+                tolerance_base,
+                tolerance_fraction,
+                n_coords_loc,
+                coords_loc,
+                tag_loc,
+                location_loc,
+                distance_loc);
+
+  for (j = 0; j < n_coords_loc; j++) {
+
+    ple_lnum_t l = id_loc[j];
+
+    if (distance_loc[j] > -0.1) {
+      location[l] = location_loc[j];
+      if (distance != NULL)
+        distance[l] = distance_loc[j];
+    }
+    else
+      location[l] = -1;
+
+  }
+
+  PLE_FREE(id_loc);
+  PLE_FREE(tag_loc);
+  PLE_FREE(coords_loc);
+  PLE_FREE(location_loc);
+  PLE_FREE(distance_loc);
+}
+
 /*----------------------------------------------------------------------------
  * Determine or update possibly intersecting ranks for unlocated elements,
  * in parallel.
@@ -3039,11 +3433,203 @@ _exchange_point_var(ple_locator_t     *this_locator,
 }
 
 /*----------------------------------------------------------------------------
- * Return timing information.
+ * Return (creating if necessary) the non-blocking exchange state
+ * associated with a locator.
  *
- * When location on closest elements to force location of all points is
- * active, location times include a total value, followed by the value
- * associated with the location of closest elements stage.
+ * parameters:
+ *   this_locator <-> pointer to locator structure
+ *
+ * returns:
+ *   pointer to non-blocking exchange state
+ *----------------------------------------------------------------------------*/
+
+static _async_exchange_t *
+_async_exchange_get(ple_locator_t  *this_locator)
+{
+  _async_exchange_t *ae = this_locator->async_exchange;
+
+  if (ae == NULL) {
+
+    PLE_MALLOC(ae, 1, _async_exchange_t);
+
+    ae->active = 0;
+
+    ae->n_vars = 0;
+    ae->reverse = 0;
+    ae->type_size = 0;
+    ae->t_stride = 0;
+
+    ae->stride = NULL;
+    ae->distant_var = NULL;
+    ae->local_var = NULL;
+    ae->local_list = NULL;
+
+    ae->send_buf_size = 0;
+    ae->recv_buf_size = 0;
+    ae->send_buf = NULL;
+    ae->recv_buf = NULL;
+
+#if defined(PLE_HAVE_MPI)
+    ae->n_requests = 0;
+    ae->request = NULL;
+#endif
+
+    ae->w_start = 0.;
+    ae->cpu_start = 0.;
+
+    this_locator->async_exchange = ae;
+  }
+
+  return ae;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy the non-blocking exchange state associated with a locator.
+ *
+ * parameters:
+ *   this_locator <-> pointer to locator structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_exchange_destroy(ple_locator_t  *this_locator)
+{
+  _async_exchange_t *ae = this_locator->async_exchange;
+
+  if (ae != NULL) {
+    PLE_FREE(ae->stride);
+    PLE_FREE(ae->distant_var);
+    PLE_FREE(ae->local_var);
+    PLE_FREE(ae->send_buf);
+    PLE_FREE(ae->recv_buf);
+#if defined(PLE_HAVE_MPI)
+    PLE_FREE(ae->request);
+#endif
+    PLE_FREE(ae);
+    this_locator->async_exchange = NULL;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Copy values for local points matched with a given distant rank between
+ * a dense per-rank buffer and the local variable, applying the optional
+ * indirections.
+ *
+ * parameters:
+ *   this_locator <-- pointer to locator structure
+ *   i            <-- intersecting rank index
+ *   to_local     <-- if nonzero, copy buffer to variable, else variable
+ *                    to buffer
+ *   buf          <-> dense per-rank buffer
+ *   local_var    <-> variable defined on local points
+ *   local_list   <-- optional indirection list for local_var
+ *   nbytes       <-- number of bytes per point
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_copy_local_var(const ple_locator_t  *this_locator,
+                      int                   i,
+                      int                   to_local,
+                      unsigned char        *buf,
+                      void                 *local_var,
+                      const ple_lnum_t     *local_list,
+                      size_t                nbytes)
+{
+  const ple_lnum_t *_local_point_ids
+    = this_locator->local_point_ids + this_locator->local_points_idx[i];
+
+  const ple_lnum_t n_points_loc =   this_locator->local_points_idx[i+1]
+                                  - this_locator->local_points_idx[i];
+
+  const ple_lnum_t idb = this_locator->point_id_base;
+
+  for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+    ple_lnum_t pt_id = _local_point_ids[k];
+    if (local_list != NULL)
+      pt_id = local_list[pt_id] - idb;
+    char *local_v_p = (char *)local_var + pt_id*nbytes;
+    char *buf_p = (char *)buf + k*nbytes;
+    if (to_local) {
+      for (size_t l = 0; l < nbytes; l++)
+        local_v_p[l] = buf_p[l];
+    }
+    else {
+      for (size_t l = 0; l < nbytes; l++)
+        buf_p[l] = local_v_p[l];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Finish a non-blocking exchange: unpack received data to the matching
+ * variables.
+ *
+ * parameters:
+ *   this_locator <-> pointer to locator structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_exchange_unpack(ple_locator_t  *this_locator)
+{
+  _async_exchange_t *ae = this_locator->async_exchange;
+
+  const size_t ts = ae->type_size;
+  unsigned char *recv_ptr = ae->recv_buf;
+
+  for (int i = 0; i < this_locator->n_intersects; i++) {
+
+    const ple_lnum_t n_points_loc =   this_locator->local_points_idx[i+1]
+                                    - this_locator->local_points_idx[i];
+
+    const ple_lnum_t n_points_dist =   this_locator->distant_points_idx[i+1]
+                                     - this_locator->distant_points_idx[i];
+
+    if (ae->reverse == 0) {
+
+      /* Standard mode: received data maps to local points */
+
+      if (ae->local_var == NULL)
+        continue;
+
+      for (int v = 0; v < ae->n_vars; v++) {
+        const size_t nbytes = ae->stride[v]*ts;
+        _async_copy_local_var(this_locator,
+                              i,
+                              1, /* to_local */
+                              recv_ptr,
+                              ae->local_var[v],
+                              ae->local_list,
+                              nbytes);
+        recv_ptr += n_points_loc*nbytes;
+      }
+
+    }
+    else {
+
+      /* Reverse mode: received data maps to (contiguous) distant points */
+
+      if (ae->distant_var == NULL)
+        continue;
+
+      for (int v = 0; v < ae->n_vars; v++) {
+        const size_t nbytes = ae->stride[v]*ts;
+        size_t dist_v_idx = this_locator->distant_points_idx[i]*nbytes;
+        memcpy((unsigned char *)(ae->distant_var[v]) + dist_v_idx,
+               recv_ptr,
+               n_points_dist*nbytes);
+        recv_ptr += n_points_dist*nbytes;
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Return timing information.
+ *
+ * When location on closest elements to force location of all points is
+ * active, location times include a total value, followed by the value
+ * associated with the location of closest elements stage.
  *
  * parameters:
  *   this_locator      <-- pointer to locator structure
@@ -3146,6 +3732,7 @@ ple_locator_create(void)
   this_locator->locate_algorithm = _ple_locator_location_algorithm;
   this_locator->exchange_algorithm = _EXCHANGE_SENDRECV;
   this_locator->async_threshold = _ple_locator_async_threshold;
+  this_locator->relocation_mode = _ple_locator_relocation_mode;
 
   this_locator->point_id_base = 0;
 
@@ -3167,6 +3754,8 @@ ple_locator_create(void)
   this_locator->n_exterior = 0;
   this_locator->exterior_list = NULL;
 
+  this_locator->async_exchange = NULL;
+
   for (i = 0; i < 2; i++) {
     this_locator->location_wtime[i] = 0.;
     this_locator->location_cpu_time[i] = 0.;
@@ -3210,6 +3799,8 @@ ple_locator_destroy(ple_locator_t  *this_locator)
     PLE_FREE(this_locator->interior_list);
     PLE_FREE(this_locator->exterior_list);
 
+    _async_exchange_destroy(this_locator);
+
     PLE_FREE(this_locator);
   }
 
@@ -3220,6 +3811,17 @@ ple_locator_destroy(ple_locator_t  *this_locator)
 /*!
  * \brief Prepare locator for use with a given mesh representation.
  *
+ * By default, the full location algorithm is run, ignoring any previous
+ * location information. If the "relocation" option is set to
+ * "incremental" (see \ref ple_locator_set_options) and this function was
+ * already called for this locator, previous point to element matches are
+ * used as a starting point: each point is first re-checked on the rank of
+ * its previous match, and only points not found again there (a small
+ * fraction when mesh or point displacements are small compared to element
+ * sizes) go through the full search. The result is identical to that of a
+ * full search for points found again on their prior rank, which are not
+ * compared to possibly closer elements on other ranks.
+ *
  * \param[in, out] this_locator        pointer to locator structure
  * \param[in]      mesh                pointer to mesh representation structure
  * \param[in]      options             options array (size
@@ -3281,9 +3883,13 @@ ple_locator_set_mesh(ple_locator_t               *this_locator,
       distance[i] = -1;
   }
 
-  /* Release information if previously present */
+  /* Release information if previously present, except in incremental
+     relocation mode, where prior matches are kept as a starting point
+     and re-checked before any further search */
 
-  _clear_location_info(this_locator);
+  if (   this_locator->relocation_mode == 0
+      || this_locator->n_intersects == 0)
+    _clear_location_info(this_locator);
 
   ple_locator_extend_search(this_locator,
                             mesh,
@@ -3469,6 +4075,24 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
 
     /* Free temporary memory */
 
+    /* In incremental relocation mode, save the prior intersecting rank
+       list (in communication order) before it is released, so that prior
+       matches may be re-checked on their rank */
+
+    int n_prev_intersects = 0;
+    int *prev_intersect_rank = NULL;
+
+    if (   this_locator->relocation_mode != 0
+        && this_locator->n_intersects > 0) {
+      n_prev_intersects = this_locator->n_intersects;
+      PLE_MALLOC(prev_intersect_rank, n_prev_intersects, int);
+      for (i = 0; i < n_prev_intersects; i++) {
+        int li = (this_locator->comm_order != NULL) ?
+          this_locator->comm_order[i] : i;
+        prev_intersect_rank[i] = this_locator->intersect_rank[li];
+      }
+    }
+
     PLE_MALLOC(location, n_points, ple_lnum_t);
     PLE_MALLOC(location_rank_id, n_points, ple_lnum_t);
 
@@ -3477,6 +4101,24 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
                                location,
                                location_rank_id);
 
+    if (n_prev_intersects > 0) {
+      _relocate_distant(this_locator,
+                        mesh,
+                        tolerance_base,
+                        tolerance_fraction,
+                        n_points,
+                        point_list,
+                        point_tag,
+                        point_coords,
+                        location,
+                        location_rank_id,
+                        distance,
+                        n_prev_intersects,
+                        prev_intersect_rank,
+                        mesh_locate_f);
+      PLE_FREE(prev_intersect_rank);
+    }
+
     _locate_all_distant(this_locator,
                         mesh,
                         tolerance_base,
@@ -3513,6 +4155,19 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
                              n_points,
                              location);
 
+    if (this_locator->relocation_mode != 0)
+      _relocate_local(this_locator,
+                      mesh,
+                      tolerance_base,
+                      tolerance_fraction,
+                      n_points,
+                      point_list,
+                      point_tag,
+                      point_coords,
+                      location,
+                      distance,
+                      mesh_locate_f);
+
     _locate_all_local(this_locator,
                       mesh,
                       tolerance_base,
@@ -3886,6 +4541,350 @@ ple_locator_exchange_point_var_all(ple_locator_t     *this_locator,
                       false);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start a non-blocking exchange of one or several variables between
+ * distant points and the processes owning the original points.
+ *
+ * This is a non-blocking variant of \ref ple_locator_exchange_point_var,
+ * with aggregation of several variables in a single message per distant
+ * rank. The matching communication may be overlapped with local
+ * computation, and must be completed by a call to
+ * \ref ple_locator_exchange_point_var_wait (optionally polled using
+ * \ref ple_locator_exchange_point_var_try); only one such exchange may
+ * be in progress at a time for a given locator.
+ *
+ * Contrary to the blocking exchange functions, no handshake is done to
+ * check send and receive arguments of matching ranks, so all processes
+ * of both coupled codes must use this non-blocking variant, with
+ * coherent send/receive (i.e. distant/local) participation.
+ *
+ * The variable arrays passed to this function, including local_var,
+ * must remain valid until the exchange is completed.
+ *
+ * \param[in]      this_locator pointer to locator structure
+ * \param[in]      n_vars       number of variables to exchange
+ * \param[in, out] distant_var  for each variable, values defined on
+ *                              distant points (ready to send), or NULL
+ *                              to receive only
+ * \param[in, out] local_var    for each variable, values defined on located
+ *                              local points (received), or NULL to send only
+ * \param[in]      local_list   optional indirection list for local_var
+ * \param[in]      type_size    sizeof (float or double) variable type
+ * \param[in]      stride       dimension of each variable (1 for scalar,
+ *                              3 for interleaved vector)
+ * \param[in]      reverse      if nonzero, exchange is reversed
+ *                              (receive values associated with distant points
+ *                              from the processes owning the original points)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_start(ple_locator_t     *this_locator,
+                                     int                n_vars,
+                                     void              *distant_var[],
+                                     void              *local_var[],
+                                     const ple_lnum_t  *local_list,
+                                     size_t             type_size,
+                                     const size_t       stride[],
+                                     int                reverse)
+{
+  int mpi_flag = 0;
+
+  _async_exchange_t *ae = _async_exchange_get(this_locator);
+
+  if (ae->active)
+    ple_error(__FILE__, __LINE__, 0,
+              _("%s: a previous non-blocking exchange on this locator\n"
+                "has not been completed (missing call to\n"
+                "ple_locator_exchange_point_var_wait)."),
+              __func__);
+
+  ae->w_start = ple_timer_wtime();
+  ae->cpu_start = ple_timer_cpu_time();
+
+  /* Save exchange parameters */
+
+  ae->n_vars = n_vars;
+  ae->reverse = reverse;
+  ae->type_size = type_size;
+  ae->local_list = local_list;
+
+  PLE_REALLOC(ae->stride, n_vars, size_t);
+
+  ae->t_stride = 0;
+  for (int v = 0; v < n_vars; v++) {
+    ae->stride[v] = stride[v];
+    ae->t_stride += stride[v];
+  }
+
+  if (distant_var != NULL) {
+    PLE_REALLOC(ae->distant_var, n_vars, void *);
+    for (int v = 0; v < n_vars; v++)
+      ae->distant_var[v] = distant_var[v];
+  }
+  else
+    PLE_FREE(ae->distant_var);
+
+  if (local_var != NULL) {
+    PLE_REALLOC(ae->local_var, n_vars, void *);
+    for (int v = 0; v < n_vars; v++)
+      ae->local_var[v] = local_var[v];
+  }
+  else
+    PLE_FREE(ae->local_var);
+
+#if defined(PLE_HAVE_MPI)
+
+  MPI_Initialized(&mpi_flag);
+
+  if (mpi_flag && this_locator->comm == MPI_COMM_NULL)
+    mpi_flag = 0;
+
+  if (mpi_flag) {
+
+    MPI_Datatype datatype = MPI_DATATYPE_NULL;
+
+    if (type_size == sizeof(double))
+      datatype = MPI_DOUBLE;
+    else if (type_size == sizeof(float))
+      datatype = MPI_FLOAT;
+    else
+      ple_error(__FILE__, __LINE__, 0,
+                _("type_size passed to %s does\n"
+                  "not correspond to double or float."),
+                __func__);
+
+    const ple_lnum_t n_points_loc_tot
+      = this_locator->local_points_idx[this_locator->n_intersects];
+    const ple_lnum_t n_points_dist_tot
+      = this_locator->distant_points_idx[this_locator->n_intersects];
+
+    /* Resize aggregated buffers if needed */
+
+    size_t send_size = 0, recv_size = 0;
+
+    if (reverse == 0) {
+      if (distant_var != NULL)
+        send_size = n_points_dist_tot * ae->t_stride * type_size;
+      if (local_var != NULL)
+        recv_size = n_points_loc_tot * ae->t_stride * type_size;
+    }
+    else {
+      if (local_var != NULL)
+        send_size = n_points_loc_tot * ae->t_stride * type_size;
+      if (distant_var != NULL)
+        recv_size = n_points_dist_tot * ae->t_stride * type_size;
+    }
+
+    if (send_size > ae->send_buf_size) {
+      ae->send_buf_size = send_size;
+      PLE_REALLOC(ae->send_buf, send_size, unsigned char);
+    }
+    if (recv_size > ae->recv_buf_size) {
+      ae->recv_buf_size = recv_size;
+      PLE_REALLOC(ae->recv_buf, recv_size, unsigned char);
+    }
+
+    /* Pack data to send, aggregating all variables per rank */
+
+    unsigned char *send_ptr = ae->send_buf;
+
+    for (int i = 0; i < this_locator->n_intersects; i++) {
+
+      const ple_lnum_t n_points_loc =   this_locator->local_points_idx[i+1]
+                                      - this_locator->local_points_idx[i];
+
+      const ple_lnum_t n_points_dist =   this_locator->distant_points_idx[i+1]
+                                       - this_locator->distant_points_idx[i];
+
+      if (reverse == 0 && distant_var != NULL) {
+        for (int v = 0; v < n_vars; v++) {
+          const size_t nbytes = stride[v]*type_size;
+          size_t dist_v_idx = this_locator->distant_points_idx[i]*nbytes;
+          memcpy(send_ptr,
+                 (const unsigned char *)(distant_var[v]) + dist_v_idx,
+                 n_points_dist*nbytes);
+          send_ptr += n_points_dist*nbytes;
+        }
+      }
+      else if (reverse != 0 && local_var != NULL) {
+        for (int v = 0; v < n_vars; v++) {
+          const size_t nbytes = stride[v]*type_size;
+          _async_copy_local_var(this_locator,
+                                i,
+                                0, /* to buffer */
+                                send_ptr,
+                                local_var[v],
+                                local_list,
+                                nbytes);
+          send_ptr += n_points_loc*nbytes;
+        }
+      }
+
+    }
+
+    /* Post receives and sends for all ranks */
+
+    PLE_REALLOC(ae->request, this_locator->n_intersects*2, MPI_Request);
+
+    send_ptr = ae->send_buf;
+    unsigned char *recv_ptr = ae->recv_buf;
+
+    for (int i = 0; i < this_locator->n_intersects; i++) {
+
+      const int dist_rank = this_locator->intersect_rank[i];
+
+      const ple_lnum_t n_points_loc =   this_locator->local_points_idx[i+1]
+                                      - this_locator->local_points_idx[i];
+
+      const ple_lnum_t n_points_dist =   this_locator->distant_points_idx[i+1]
+                                       - this_locator->distant_points_idx[i];
+
+      int send_count = 0, recv_count = 0;
+
+      if (reverse == 0) {
+        if (distant_var != NULL)
+          send_count = n_points_dist * ae->t_stride;
+        if (local_var != NULL)
+          recv_count = n_points_loc * ae->t_stride;
+      }
+      else {
+        if (local_var != NULL)
+          send_count = n_points_loc * ae->t_stride;
+        if (distant_var != NULL)
+          recv_count = n_points_dist * ae->t_stride;
+      }
+
+      MPI_Irecv(recv_ptr, recv_count, datatype, dist_rank, PLE_MPI_TAG,
+                this_locator->comm, &(ae->request[i*2]));
+      MPI_Isend(send_ptr, send_count, datatype, dist_rank, PLE_MPI_TAG,
+                this_locator->comm, &(ae->request[i*2+1]));
+
+      send_ptr += send_count*type_size;
+      recv_ptr += recv_count*type_size;
+
+    }
+
+    ae->n_requests = this_locator->n_intersects*2;
+
+  }
+
+#endif /* defined(PLE_HAVE_MPI) */
+
+  if (!mpi_flag) {
+
+    /* Purely local case: the exchange is done immediately, and the
+       wait/try functions are trivial */
+
+    for (int v = 0; v < n_vars; v++) {
+      void *d_var = (distant_var != NULL) ? distant_var[v] : NULL;
+      void *l_var = (local_var != NULL) ? local_var[v] : NULL;
+      _exchange_point_var_local(this_locator,
+                                d_var,
+                                l_var,
+                                local_list,
+                                type_size,
+                                stride[v],
+                                reverse);
+    }
+
+  }
+
+  ae->active = 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Test if a non-blocking exchange started with
+ * \ref ple_locator_exchange_point_var_start has completed.
+ *
+ * Even if this function returns 1, the exchange must still be finalized
+ * by a call to \ref ple_locator_exchange_point_var_wait (which will then
+ * return almost immediately) before the received values may be used or
+ * another exchange started.
+ *
+ * \param[in, out] this_locator pointer to locator structure
+ *
+ * \return 1 if no exchange is in progress or all messages have completed,
+ *         0 otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+ple_locator_exchange_point_var_try(ple_locator_t  *this_locator)
+{
+  int retval = 1;
+
+  _async_exchange_t *ae = this_locator->async_exchange;
+
+  if (ae == NULL || ae->active == 0)
+    return retval;
+
+#if defined(PLE_HAVE_MPI)
+
+  if (ae->n_requests > 0)
+    MPI_Testall(ae->n_requests, ae->request, &retval, MPI_STATUSES_IGNORE);
+
+#endif
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete a non-blocking exchange started with
+ * \ref ple_locator_exchange_point_var_start.
+ *
+ * Received values are unpacked to the variables passed to the matching
+ * start call, which may be used once this function returns.
+ *
+ * \param[in, out] this_locator pointer to locator structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_wait(ple_locator_t  *this_locator)
+{
+  _async_exchange_t *ae = this_locator->async_exchange;
+
+  if (ae == NULL || ae->active == 0)
+    return;
+
+#if defined(PLE_HAVE_MPI)
+
+  if (ae->n_requests > 0) {
+
+    double comm_timing[4] = {0., 0., 0., 0.};
+
+    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+    MPI_Waitall(ae->n_requests, ae->request, MPI_STATUSES_IGNORE);
+
+    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+    _async_exchange_unpack(this_locator);
+
+    this_locator->exchange_wtime[1] += comm_timing[0];
+    this_locator->exchange_cpu_time[1] += comm_timing[1];
+
+    ae->n_requests = 0;
+
+  }
+
+#endif
+
+  ae->active = 0;
+
+  /* Finalize timing */
+
+  double w_end = ple_timer_wtime();
+  double cpu_end = ple_timer_cpu_time();
+
+  this_locator->exchange_wtime[0] += (w_end - ae->w_start);
+  this_locator->exchange_cpu_time[0] += (cpu_end - ae->cpu_start);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return timing information.
@@ -4169,7 +5168,8 @@ ple_locator_set_default_option(const char  *key,
   _parse_locator_option(key,
                         value,
                         &_ple_locator_location_algorithm,
-                        &_ple_locator_async_threshold);
+                        &_ple_locator_async_threshold,
+                        &_ple_locator_relocation_mode);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -4193,7 +5193,8 @@ ple_locator_set_options(ple_locator_t  *this_locator,
   _parse_locator_option(key,
                         value,
                         &(this_locator->locate_algorithm),
-                        &(this_locator->async_threshold));
+                        &(this_locator->async_threshold),
+                        &(this_locator->relocation_mode));
 }
 
 #if defined(PLE_HAVE_MPI)
@@ -505,6 +505,86 @@ ple_locator_exchange_point_var_all(ple_locator_t     *this_locator,
                                    size_t             stride,
                                    int                reverse);
 
+/*----------------------------------------------------------------------------
+ * Start a non-blocking exchange of one or several variables between
+ * distant points and the processes owning the original points.
+ *
+ * This is a non-blocking variant of ple_locator_exchange_point_var(),
+ * with aggregation of several variables in a single message per distant
+ * rank. The matching communication may be overlapped with local
+ * computation, and must be completed by a call to
+ * ple_locator_exchange_point_var_wait() (optionally polled using
+ * ple_locator_exchange_point_var_try()); only one such exchange may be
+ * in progress at a time for a given locator.
+ *
+ * Contrary to the blocking exchange functions, no handshake is done to
+ * check send and receive arguments of matching ranks, so all processes
+ * of both coupled codes must use this non-blocking variant, with
+ * coherent send/receive (i.e. distant/local) participation.
+ *
+ * The variable arrays passed to this function, including local_var,
+ * must remain valid until the exchange is completed.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   n_vars        <-- number of variables to exchange
+ *   distant_var   <-> for each variable, values defined on distant points
+ *                     (ready to send), or NULL to receive only
+ *   local_var     <-> for each variable, values defined on located local
+ *                     points (received), or NULL to send only
+ *   local_list    <-- optional indirection list for local_var
+ *   type_size     <-- sizeof (float or double) variable type
+ *   stride        <-- dimension of each variable (1 for scalar,
+ *                     3 for interlaced vector)
+ *   reverse       <-- if nonzero, exchange is reversed
+ *                     (receive values associated with distant points
+ *                     from the processes owning the original points)
+ *----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_start(ple_locator_t     *this_locator,
+                                     int                n_vars,
+                                     void              *distant_var[],
+                                     void              *local_var[],
+                                     const ple_lnum_t  *local_list,
+                                     size_t             type_size,
+                                     const size_t       stride[],
+                                     int                reverse);
+
+/*----------------------------------------------------------------------------
+ * Test if a non-blocking exchange started with
+ * ple_locator_exchange_point_var_start() has completed.
+ *
+ * Even if this function returns 1, the exchange must still be finalized
+ * by a call to ple_locator_exchange_point_var_wait() (which will then
+ * return almost immediately) before the received values may be used or
+ * another exchange started.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *
+ * returns:
+ *   1 if no exchange is in progress or all messages have completed,
+ *   0 otherwise
+ *----------------------------------------------------------------------------*/
+
+int
+ple_locator_exchange_point_var_try(ple_locator_t  *this_locator);
+
+/*----------------------------------------------------------------------------
+ * Complete a non-blocking exchange started with
+ * ple_locator_exchange_point_var_start().
+ *
+ * Received values are unpacked to the variables passed to the matching
+ * start call, which may be used once this function returns.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_wait(ple_locator_t  *this_locator);
+
 /*----------------------------------------------------------------------------
  * Return timing information.
  *
@@ -28,6 +28,7 @@ dnl-----------------------------------------------------------------------------
 AC_DEFUN([CS_AC_TEST_CGNS], [
 
 cs_have_cgns=no
+cs_have_cgns_mpi=no
 cs_have_cgns_headers=no
 cgns_prefix=""
 
@@ -141,6 +142,24 @@ Otherwise, you need to provide a CGNS 3.1 library and development headers.])
                  ],
                  [])
 
+    # Check for parallel CGNS options
+    #--------------------------------
+
+    if test "x$cs_have_mpi" = "xyes" -a "x$cs_have_cgns" = "xyes"; then
+
+      AC_LINK_IFELSE([AC_LANG_PROGRAM(
+[[#include <mpi.h>
+#include <pcgnslib.h>]],
+[[(void)cgp_mpi_comm(MPI_COMM_NULL);]])
+                     ],
+                     [ AC_DEFINE([HAVE_CGNS_MPI], 1, [CGNS file MPI support])
+                       cs_have_cgns_mpi=yes
+                     ],
+                     [ AC_MSG_WARN([no CGNS file MPI support]) ],
+                    )
+
+    fi
+
   fi
 
   if test "x$cs_have_cgns" != "xyes"; then
@@ -0,0 +1,146 @@
+dnl--------------------------------------------------------------------------------
+dnl
+dnl This file is part of code_saturne, a general-purpose CFD tool.
+dnl
+dnl Copyright (C) 1998-2024 EDF S.A.
+dnl
+dnl This program is free software; you can redistribute it and/or modify it under
+dnl the terms of the GNU General Public License as published by the Free Software
+dnl Foundation; either version 2 of the License, or (at your option) any later
+dnl version.
+dnl
+dnl This program is distributed in the hope that it will be useful, but WITHOUT
+dnl ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+dnl FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+dnl details.
+dnl
+dnl You should have received a copy of the GNU General Public License along with
+dnl this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+dnl Street, Fifth Floor, Boston, MA 02110-1301, USA.
+dnl
+dnl--------------------------------------------------------------------------------
+
+# CS_AC_TEST_NCCL
+#----------------
+# modifies or sets cs_have_nccl, NCCL_CPPFLAGS, NCCL_LDFLAGS, and NCCL_LIBS
+# depending on libraries found
+
+AC_DEFUN([CS_AC_TEST_NCCL], [
+
+cs_have_nccl=no
+
+AC_ARG_WITH(nccl,
+            [AS_HELP_STRING([--with-nccl=PATH],
+                            [specify prefix directory for NCCL (or RCCL)])],
+            [if test "x$withval" = "x"; then
+               with_nccl=no
+             fi],
+            [with_nccl=no])
+
+AC_ARG_WITH(nccl-include,
+            [AS_HELP_STRING([--with-nccl-include=PATH],
+                            [specify directory for NCCL include files])],
+            [if test "x$with_nccl" = "xcheck"; then
+               with_nccl=yes
+             fi
+             NCCL_CPPFLAGS="-I$with_nccl_include"],
+            [if test "x$with_nccl" != "xno" -a "x$with_nccl" != "xyes" \
+	          -a "x$with_nccl" != "xcheck"; then
+               NCCL_CPPFLAGS="-I$with_nccl/include"
+             fi])
+
+AC_ARG_WITH(nccl-lib,
+            [AS_HELP_STRING([--with-nccl-lib=PATH],
+                            [specify directory for NCCL library])],
+            [if test "x$with_nccl" = "xcheck"; then
+               with_nccl=yes
+             fi
+             NCCL_LDFLAGS="-L$with_nccl_lib"
+             cs_nccl_libpath="$with_nccl_lib"],
+            [if test "x$with_nccl" != "xno" -a "x$with_nccl" != "xyes" \
+	          -a "x$with_nccl" != "xcheck"; then
+               NCCL_LDFLAGS="-L$with_nccl/lib"
+               cs_nccl_libpath="$with_nccl/lib"
+             fi])
+
+if test "x$with_nccl" != "xno" ; then
+
+  # Now run tests
+
+  saved_CPPFLAGS="$CPPFLAGS"
+  saved_LDFLAGS="$LDFLAGS"
+  saved_LIBS="$LIBS"
+
+  CPPFLAGS="${CPPFLAGS} ${NCCL_CPPFLAGS} ${CUDA_CPPFLAGS}"
+  LDFLAGS="${LDFLAGS} ${NCCL_LDFLAGS} ${CUDA_LDFLAGS}"
+
+  if test "x$cs_nccl_libpath" != x ; then
+    if test ! -d "$cs_nccl_libpath" ; then
+      AC_MSG_FAILURE([directory specified by --with-nccl-lib=$cs_nccl_libpath does not exist!])
+    fi
+  fi
+
+  AC_MSG_CHECKING([for NCCL])
+
+  NCCL_LIBS="-lnccl"
+  LIBS="${NCCL_LIBS} ${saved_LIBS}"
+
+  AC_LINK_IFELSE([AC_LANG_PROGRAM([[#include <nccl.h>]],
+                 [[ int v; ncclGetVersion(&v); ]])],
+                 [AC_DEFINE([HAVE_NCCL], 1, [NCCL library support])
+                  cs_have_nccl=yes],
+                 [cs_have_nccl=no])
+
+  AC_MSG_RESULT($cs_have_nccl)
+
+  if test "x$cs_have_nccl" = "xno"; then
+
+    # RCCL provides the same API for ROCm-based systems.
+
+    AC_MSG_CHECKING([for RCCL])
+
+    NCCL_LIBS="-lrccl"
+    LIBS="${NCCL_LIBS} ${saved_LIBS}"
+
+    AC_LINK_IFELSE([AC_LANG_PROGRAM([[#include <rccl/rccl.h>]],
+                   [[ int v; ncclGetVersion(&v); ]])],
+                   [AC_DEFINE([HAVE_NCCL], 1, [NCCL library support])
+                    AC_DEFINE([HAVE_RCCL], 1, [RCCL variant of NCCL])
+                    cs_have_nccl=yes],
+                   [cs_have_nccl=no])
+
+    AC_MSG_RESULT($cs_have_nccl)
+
+  fi
+
+  if test "x$cs_have_nccl" = "xno"; then
+    NCCL_CPPFLAGS=""
+    NCCL_LDFLAGS=""
+    NCCL_LIBS=""
+    if test "x$with_nccl" != "xcheck" ; then
+      AC_MSG_FAILURE([NCCL support is requested, but test for NCCL failed!])
+    else
+      AC_MSG_WARN([no NCCL support])
+    fi
+  fi
+
+  unset cs_nccl_libpath
+
+  CPPFLAGS="$saved_CPPFLAGS"
+  LDFLAGS="$saved_LDFLAGS"
+  LIBS="$saved_LIBS"
+
+  unset saved_CPPFLAGS
+  unset saved_LDFLAGS
+  unset saved_LIBS
+
+fi
+
+AM_CONDITIONAL(HAVE_NCCL, test x$cs_have_nccl = xyes)
+
+AC_SUBST(cs_have_nccl)
+AC_SUBST(NCCL_CPPFLAGS)
+AC_SUBST(NCCL_LDFLAGS)
+AC_SUBST(NCCL_LIBS)
+
+])dnl
@@ -134,6 +134,7 @@ class config:
                         'amgx', 'hypre', 'petsc',       # Linear algebra
                         'metis', 'scotch',              # Partionning libraries
                         'mpi',                          # MPI
+                        'nccl',                         # NCCL/RCCL collectives
                         'cuda',                         # CUDA
                         'blas',                         # BLAS (benchmark use)
                         'system']                       # User & system libraries
@@ -277,6 +278,8 @@ class config:
 
         self.libs['cuda'] =  prerequisite('CUDA', 'cuda', config_dict)
 
+        self.libs['nccl'] =  prerequisite('NCCL', 'nccl', config_dict)
+
         self.libs['petsc'] = prerequisite('PETSc', 'petsc', config_dict)
         self.libs['amgx']  = prerequisite('Amgx', 'amgx', config_dict)
         self.libs['hypre'] = prerequisite('HYPRE', 'hypre', config_dict)
@@ -550,6 +550,7 @@ class meg_to_c_interpreter:
 
         usr_blck += usr_defs
 
+        usr_blck += 2*tab + '# pragma omp parallel for if (n_elts > CS_THR_MIN)\n'
         usr_blck += 2*tab + 'for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {\n'
         usr_blck += 3*tab + '[[maybe_unused]] cs_lnum_t c_id = elt_ids[e_id];\n'
 
@@ -662,6 +663,7 @@ class meg_to_c_interpreter:
         usr_blck += usr_defs
 
         if need_for_loop:
+            usr_blck += 2*tab + '# pragma omp parallel for if (n_elts > CS_THR_MIN)\n'
             usr_blck += 2*tab + 'for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {\n'
             usr_blck += 3*tab + '[[maybe_unused]] cs_lnum_t b_e_id = elt_ids[e_id];\n'
 
@@ -780,6 +782,7 @@ class meg_to_c_interpreter:
 
         usr_blck += usr_defs
 
+        usr_blck += 2*tab + '# pragma omp parallel for if (n_elts > CS_THR_MIN)\n'
         usr_blck += 2*tab + 'for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {\n'
         usr_blck += 3*tab + '[[maybe_unused]] cs_lnum_t c_id = elt_ids[e_id];\n'
 
@@ -891,6 +894,7 @@ class meg_to_c_interpreter:
 
         usr_blck += usr_defs
 
+        usr_blck += 2*tab + '# pragma omp parallel for if (n_elts > CS_THR_MIN)\n'
         usr_blck += 2*tab + 'for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {\n'
         usr_blck += 3*tab + '[[maybe_unused]] cs_lnum_t c_id = elt_ids[e_id];\n'
 
@@ -1340,6 +1344,7 @@ class meg_to_c_interpreter:
 
         usr_blck += usr_defs
 
+        usr_blck += 2*tab + '# pragma omp parallel for if (n_elts > CS_THR_MIN)\n'
         usr_blck += 2*tab + 'for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {\n'
         usr_blck += 3*tab + '[[maybe_unused]] cs_lnum_t c_id = (elt_ids == NULL) ? e_id : elt_ids[e_id];\n'
 
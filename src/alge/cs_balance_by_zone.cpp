@@ -72,6 +72,7 @@
 #include "cs_physical_constants.h"
 #include "cs_thermal_model.h"
 #include "cs_volume_mass_injection.h"
+#include "cs_volume_zone.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -91,11 +92,77 @@ BEGIN_C_DECLS
 
 */
 
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* When balances are computed for all zones in a single pass
+   (see \ref cs_balance_by_zones), zone-independent intermediate arrays
+   are computed for the first zone only and reused for the following
+   ones through the cache below. */
+
+static bool  _balance_batch_active = false;
+
+static struct {
+
+  bool          primed;           /* true once the arrays below are set */
+
+  cs_real_t    *cpro_cp;          /* specific heat */
+  bool          own_cp;           /* false if mapped to a field array */
+
+  cs_real_3_t  *grad;             /* scalar gradient */
+  cs_real_3_t  *gradup;           /* upwind gradient (SOLU schemes) */
+  cs_real_3_t  *gradst;           /* slope test gradient */
+
+  cs_real_t    *f_reconstructed;  /* boundary face value */
+
+  cs_real_t    *local_min;        /* NVD/TVD limiter bounds */
+  cs_real_t    *local_max;
+  cs_real_t    *courant;          /* cell Courant number (VOF schemes) */
+
+  cs_real_t    *i_visc;           /* face viscosities */
+  cs_real_t    *b_visc;
+
+} _batch_cache = {false,
+                  NULL, false,
+                  NULL, NULL, NULL,
+                  NULL,
+                  NULL, NULL, NULL,
+                  NULL, NULL};
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
-/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+/*----------------------------------------------------------------------------
+ * Free arrays cached during a multiple-zone balance pass.
+ *----------------------------------------------------------------------------*/
+
+static void
+_balance_batch_cache_clear(void)
+{
+  if (_batch_cache.own_cp)
+    BFT_FREE(_batch_cache.cpro_cp);
+  _batch_cache.cpro_cp = NULL;
+  _batch_cache.own_cp = false;
+
+  BFT_FREE(_batch_cache.grad);
+  BFT_FREE(_batch_cache.gradup);
+  BFT_FREE(_batch_cache.gradst);
+
+  BFT_FREE(_batch_cache.f_reconstructed);
+
+  BFT_FREE(_batch_cache.local_min);
+  BFT_FREE(_batch_cache.local_max);
+  BFT_FREE(_batch_cache.courant);
+
+  BFT_FREE(_batch_cache.i_visc);
+  BFT_FREE(_batch_cache.b_visc);
+
+  _batch_cache.primed = false;
+}
 
 /*----------------------------------------------------------------------------
  * Compute convection and diffusion contributions to the flux of a scalar at
@@ -845,7 +912,10 @@ cs_balance_by_zone_compute(const char      *scalar_name,
   /* Specific heat (CP) */
   cs_real_t *cpro_cp = NULL;
   const int icp = cs_field_id_by_name("specific_heat");
-  if (itemperature) {
+  if (_batch_cache.primed) {
+    cpro_cp = _batch_cache.cpro_cp;
+  }
+  else if (itemperature) {
     if (icp != -1)
       cpro_cp = CS_F_(cp)->val;
     else {
@@ -964,15 +1034,22 @@ cs_balance_by_zone_compute(const char      *scalar_name,
     /* NVD/TVD limiters */
     if (ischcp == 4) {
       limiter_choice = cs_field_get_key_int(f, key_lim_choice);
-      BFT_MALLOC(local_max, n_cells_ext, cs_real_t);
-      BFT_MALLOC(local_min, n_cells_ext, cs_real_t);
-      cs_field_local_extrema_scalar(field_id,
-                                    halo_type,
-                                    local_max,
-                                    local_min);
-      if (limiter_choice >= CS_NVD_VOF_HRIC) {
-        BFT_MALLOC(courant, n_cells_ext, cs_real_t);
-        cs_cell_courant_number(f, ctx, courant);
+      if (_batch_cache.primed) {
+        local_max = _batch_cache.local_max;
+        local_min = _batch_cache.local_min;
+        courant = _batch_cache.courant;
+      }
+      else {
+        BFT_MALLOC(local_max, n_cells_ext, cs_real_t);
+        BFT_MALLOC(local_min, n_cells_ext, cs_real_t);
+        cs_field_local_extrema_scalar(field_id,
+                                      halo_type,
+                                      local_max,
+                                      local_min);
+        if (limiter_choice >= CS_NVD_VOF_HRIC) {
+          BFT_MALLOC(courant, n_cells_ext, cs_real_t);
+          cs_cell_courant_number(f, ctx, courant);
+        }
       }
     }
 
@@ -988,35 +1065,44 @@ cs_balance_by_zone_compute(const char      *scalar_name,
   }
 
   /* Allocate temporary array */
-  cs_real_t *f_reconstructed;
-  BFT_MALLOC(f_reconstructed, n_b_faces, cs_real_t);
+  cs_real_t *f_reconstructed = NULL;
 
   /* Reconstructed value */
-  cs_real_3_t *grad;
-  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+  cs_real_3_t *grad = NULL;
 
   halo_type = CS_HALO_STANDARD;
-  cs_field_gradient_scalar(f,
-                           true, /* use_previous_t */
-                           1, /* inc */
-                           grad);
 
-  if (false) { //FIXME
-    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-      /* Associated boundary cell */
-      cs_lnum_t c_id = b_face_cells[f_id];
-      f_reconstructed[f_id] = f->val[c_id]
-                               + grad[c_id][0]*diipb[f_id][0]
-                               + grad[c_id][1]*diipb[f_id][1]
-                               + grad[c_id][2]*diipb[f_id][2];
-    }
+  if (_batch_cache.primed) {
+    f_reconstructed = _batch_cache.f_reconstructed;
+    grad = _batch_cache.grad;
+  }
+  else {
 
-  /* Non-reconstructed value */
-  } else {
-    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-      /* Associated boundary cell */
-      cs_lnum_t c_id = b_face_cells[f_id];
-      f_reconstructed[f_id] = f->val[c_id];
+    BFT_MALLOC(f_reconstructed, n_b_faces, cs_real_t);
+    BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+
+    cs_field_gradient_scalar(f,
+                             true, /* use_previous_t */
+                             1, /* inc */
+                             grad);
+
+    if (false) { //FIXME
+      for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+        /* Associated boundary cell */
+        cs_lnum_t c_id = b_face_cells[f_id];
+        f_reconstructed[f_id] = f->val[c_id]
+                                 + grad[c_id][0]*diipb[f_id][0]
+                                 + grad[c_id][1]*diipb[f_id][1]
+                                 + grad[c_id][2]*diipb[f_id][2];
+      }
+
+    /* Non-reconstructed value */
+    } else {
+      for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+        /* Associated boundary cell */
+        cs_lnum_t c_id = b_face_cells[f_id];
+        f_reconstructed[f_id] = f->val[c_id];
+      }
     }
   }
 
@@ -1025,84 +1111,100 @@ cs_balance_by_zone_compute(const char      *scalar_name,
   /* Compute the gradient for convective scheme (the slope test, limiter, SOLU, etc) */
   cs_real_3_t *gradup = NULL;
   cs_real_3_t *gradst = NULL;
-  if (eqp->blencv > 0 && eqp->isstpc == 0) {
-    BFT_MALLOC(gradst, n_cells_ext, cs_real_3_t);
-    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-      gradst[c_id][0] = 0.;
-      gradst[c_id][1] = 0.;
-      gradst[c_id][2] = 0.;
-    }
-    /* Slope test gradient */
-    if (eqp->iconv > 0)
-      cs_slope_test_gradient(field_id,
-                             ctx,
-                             inc,
-                             halo_type,
-                             (const cs_real_3_t *)grad,
-                             gradst,
-                             f->val,
-                             f->bc_coeffs,
-                             i_mass_flux);
 
+  if (_batch_cache.primed) {
+    gradst = _batch_cache.gradst;
+    gradup = _batch_cache.gradup;
   }
-  /* Pure SOLU scheme without using gradient_slope_test function
-     or Roe and Sweby limiters */
-  if (eqp->blencv > 0
-      && (eqp->ischcv==2 || eqp->ischcv==4)) {
-    BFT_MALLOC(gradup, n_cells_ext, cs_real_3_t);
-    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-      gradup[c_id][0] = 0.;
-      gradup[c_id][1] = 0.;
-      gradup[c_id][2] = 0.;
+  else {
+
+    if (eqp->blencv > 0 && eqp->isstpc == 0) {
+      BFT_MALLOC(gradst, n_cells_ext, cs_real_3_t);
+      for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+        gradst[c_id][0] = 0.;
+        gradst[c_id][1] = 0.;
+        gradst[c_id][2] = 0.;
+      }
+      /* Slope test gradient */
+      if (eqp->iconv > 0)
+        cs_slope_test_gradient(field_id,
+                               ctx,
+                               inc,
+                               halo_type,
+                               (const cs_real_3_t *)grad,
+                               gradst,
+                               f->val,
+                               f->bc_coeffs,
+                               i_mass_flux);
+
     }
+    /* Pure SOLU scheme without using gradient_slope_test function
+       or Roe and Sweby limiters */
+    if (eqp->blencv > 0
+        && (eqp->ischcv==2 || eqp->ischcv==4)) {
+      BFT_MALLOC(gradup, n_cells_ext, cs_real_3_t);
+      for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+        gradup[c_id][0] = 0.;
+        gradup[c_id][1] = 0.;
+        gradup[c_id][2] = 0.;
+      }
 
-    if (eqp->iconv > 0)
-      cs_upwind_gradient(field_id,
-                         ctx,
-                         inc,
-                         halo_type,
-                         f->bc_coeffs,
-                         i_mass_flux,
-                         b_mass_flux,
-                         f->val,
-                         gradup);
+      if (eqp->iconv > 0)
+        cs_upwind_gradient(field_id,
+                           ctx,
+                           inc,
+                           halo_type,
+                           f->bc_coeffs,
+                           i_mass_flux,
+                           b_mass_flux,
+                           f->val,
+                           gradup);
 
+    }
   }
 
   /* Face viscosity */
   int imvisf = eqp->imvisf;
-  cs_real_t *i_visc;
-  cs_real_t *b_visc;
-  BFT_MALLOC(i_visc, n_i_faces, cs_real_t);
-  BFT_MALLOC(b_visc, n_b_faces, cs_real_t);
-
+  cs_real_t *i_visc = NULL;
+  cs_real_t *b_visc = NULL;
   cs_real_t *c_visc = NULL;
-  BFT_MALLOC(c_visc, n_cells_ext, cs_real_t);
-  const int kivisl
-    = cs_field_get_key_int(f, cs_field_key_id("diffusivity_id"));
-  if (kivisl != -1) {
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
-      c_visc[c_id] = cs_field_by_id(kivisl)->val[c_id];
+
+  if (_batch_cache.primed) {
+    i_visc = _batch_cache.i_visc;
+    b_visc = _batch_cache.b_visc;
   }
   else {
-    const double visls0
-      = cs_field_get_key_double(f, cs_field_key_id("diffusivity_ref"));
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      c_visc[c_id] = visls0;
+
+    BFT_MALLOC(i_visc, n_i_faces, cs_real_t);
+    BFT_MALLOC(b_visc, n_b_faces, cs_real_t);
+    BFT_MALLOC(c_visc, n_cells_ext, cs_real_t);
+
+    const int kivisl
+      = cs_field_get_key_int(f, cs_field_key_id("diffusivity_id"));
+    if (kivisl != -1) {
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+        c_visc[c_id] = cs_field_by_id(kivisl)->val[c_id];
+    }
+    else {
+      const double visls0
+        = cs_field_get_key_double(f, cs_field_key_id("diffusivity_ref"));
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+        c_visc[c_id] = visls0;
+      }
     }
-  }
 
-  /* Turbulent part */
-  cs_real_t *c_visct = cs_field_by_name("turbulent_viscosity")->val;
+    /* Turbulent part */
+    cs_real_t *c_visct = cs_field_by_name("turbulent_viscosity")->val;
 
-  if (eqp->idifft == 1) {
-    const int ksigmas = cs_field_key_id("turbulent_schmidt");
-    cs_real_t turb_schmidt = cs_field_get_key_double(f, ksigmas);
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
-      c_visc[c_id] += cpro_cp[c_id] * c_visct[c_id]/turb_schmidt;
-  }
+    if (eqp->idifft == 1) {
+      const int ksigmas = cs_field_key_id("turbulent_schmidt");
+      cs_real_t turb_schmidt = cs_field_get_key_double(f, ksigmas);
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+        c_visc[c_id] += cpro_cp[c_id] * c_visct[c_id]/turb_schmidt;
+    }
 
-  cs_face_viscosity(m, fvq, imvisf, c_visc, i_visc, b_visc);
+    cs_face_viscosity(m, fvq, imvisf, c_visc, i_visc, b_visc);
+  }
 
   /* Get user-selected zone
      ====================== */
@@ -1594,21 +1696,42 @@ cs_balance_by_zone_compute(const char      *scalar_name,
 
   }
 
-  /* Free memory */
-
-  BFT_FREE(grad);
-  BFT_FREE(gradup);
-  BFT_FREE(gradst);
-  BFT_FREE(f_reconstructed);
-  BFT_FREE(local_max);
-  BFT_FREE(local_min);
-  BFT_FREE(courant);
-
-  if (!itemperature || icp == -1)
-    BFT_FREE(cpro_cp);
-  BFT_FREE(c_visc);
-  BFT_FREE(i_visc);
-  BFT_FREE(b_visc);
+  /* Free memory; in a multiple-zone pass, transfer zone-independent
+     arrays to the batch cache instead, so that the following zones
+     may reuse them. */
+
+  if (_balance_batch_active) {
+    if (! _batch_cache.primed) {
+      _batch_cache.cpro_cp = cpro_cp;
+      _batch_cache.own_cp = (!itemperature || icp == -1);
+      _batch_cache.grad = grad;
+      _batch_cache.gradup = gradup;
+      _batch_cache.gradst = gradst;
+      _batch_cache.f_reconstructed = f_reconstructed;
+      _batch_cache.local_min = local_min;
+      _batch_cache.local_max = local_max;
+      _batch_cache.courant = courant;
+      _batch_cache.i_visc = i_visc;
+      _batch_cache.b_visc = b_visc;
+      _batch_cache.primed = true;
+    }
+    BFT_FREE(c_visc);  /* NULL for zones reusing the cache */
+  }
+  else {
+    BFT_FREE(grad);
+    BFT_FREE(gradup);
+    BFT_FREE(gradst);
+    BFT_FREE(f_reconstructed);
+    BFT_FREE(local_max);
+    BFT_FREE(local_min);
+    BFT_FREE(courant);
+
+    if (!itemperature || icp == -1)
+      BFT_FREE(cpro_cp);
+    BFT_FREE(c_visc);
+    BFT_FREE(i_visc);
+    BFT_FREE(b_visc);
+  }
 
   BFT_FREE(cells_tag_ids);
   BFT_FREE(bi_face_cells);
@@ -1747,6 +1870,96 @@ cs_balance_by_zone(const char  *selection_crit,
      balance[CS_BALANCE_TOTAL], balance[CS_BALANCE_TOTAL_NORMALIZED]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute and log the different terms of the balance of a given scalar
+ *        on all registered volume zones, in a single pass.
+ *
+ * This function is equivalent to calling \ref cs_balance_by_zone for each
+ * zone defined through the GUI or \ref cs_volume_zone_define, but
+ * intermediate arrays which do not depend on the zone (gradients, face
+ * viscosity, reconstructed boundary values, ...) are computed only once
+ * and shared by all zones, so it should be preferred when balances of the
+ * same scalar are required on many zones.
+ *
+ * Zone 0 (covering all cells) is skipped.
+ *
+ * \param[in]     scalar_name         scalar name
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zones(const char  *scalar_name)
+{
+  cs_real_t balance[CS_BALANCE_N_TERMS];
+
+  const int nt_cur = cs_glob_time_step->nt_cur;
+  const int n_zones = cs_volume_zone_n_zones();
+
+  /* If the requested scalar field is not computed, return */
+  if (cs_field_id_by_name(scalar_name) == -1) {
+    bft_printf("Scalar field does not exist. Balance will not be computed.\n");
+    return;
+  }
+
+  _balance_batch_active = true;
+
+  for (int z_id = 1; z_id < n_zones; z_id++) {
+
+    const cs_zone_t *z = cs_volume_zone_by_id(z_id);
+
+    /* Compute balance */
+
+    cs_balance_by_zone_compute(scalar_name,
+                               z->n_elts,
+                               z->elt_ids,
+                               balance);
+
+    /* Log results at time step n */
+
+    bft_printf
+      (_("   ** SCALAR BALANCE BY ZONE at iteration %6i\n"
+         "   ---------------------------------------------\n"
+         "------------------------------------------------------------\n"
+         "   SCALAR: %s\n"
+         "   ZONE: \"%s\" (id %d)\n"
+         "------------------------------------------------------------\n"
+         "   Unst. term   Inj. Mass.   Suc. Mass.\n"
+         "  %12.4e %12.4e %12.4e\n"
+         "------------------------------------------------------------\n"
+         "   IB inlet     IB outlet\n"
+         "  %12.4e %12.4e\n"
+         "------------------------------------------------------------\n"
+         "   Inlet        Outlet\n"
+         "  %12.4e %12.4e\n"
+         "------------------------------------------------------------\n"
+         "   Sym.         Smooth W.    Rough W.\n"
+         "  %12.4e %12.4e %12.4e\n"
+         "------------------------------------------------------------\n"
+         "   Coupled      Int. Coupling    Undef. BC\n"
+         "  %12.4e %12.4e     %12.4e\n"
+         "------------------------------------------------------------\n"
+         "   Total        Instant. norm. total\n"
+         "  %12.4e %12.4e\n"
+         "------------------------------------------------------------\n\n"),
+       nt_cur, scalar_name, z->name, z_id,
+       balance[CS_BALANCE_UNSTEADY],
+       balance[CS_BALANCE_MASS_IN], balance[CS_BALANCE_MASS_OUT],
+       balance[CS_BALANCE_INTERIOR_IN], balance[CS_BALANCE_INTERIOR_OUT],
+       balance[CS_BALANCE_BOUNDARY_IN], balance[CS_BALANCE_BOUNDARY_OUT],
+       balance[CS_BALANCE_BOUNDARY_SYM],
+       balance[CS_BALANCE_BOUNDARY_WALL_S], balance[CS_BALANCE_BOUNDARY_WALL_R],
+       balance[CS_BALANCE_BOUNDARY_COUPLED_E],
+       balance[CS_BALANCE_BOUNDARY_COUPLED_I],
+       balance[CS_BALANCE_BOUNDARY_OTHER],
+       balance[CS_BALANCE_TOTAL], balance[CS_BALANCE_TOTAL_NORMALIZED]);
+
+  }
+
+  _balance_batch_active = false;
+  _balance_batch_cache_clear();
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Computes one term of the head loss balance (pressure drop) on a
@@ -158,6 +158,27 @@ void
 cs_balance_by_zone(const char  *selection_crit,
                    const char  *scalar_name);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute and log the different terms of the balance of a given scalar
+ *        on all registered volume zones, in a single pass.
+ *
+ * This function is equivalent to calling \ref cs_balance_by_zone for each
+ * zone defined through the GUI or \ref cs_volume_zone_define, but
+ * intermediate arrays which do not depend on the zone (gradients, face
+ * viscosity, reconstructed boundary values, ...) are computed only once
+ * and shared by all zones, so it should be preferred when balances of the
+ * same scalar are required on many zones.
+ *
+ * Zone 0 (covering all cells) is skipped.
+ *
+ * \param[in]     scalar_name         scalar name
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zones(const char  *scalar_name);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Computes one term of the head loss balance (pressure drop) on a
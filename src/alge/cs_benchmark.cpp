@@ -126,6 +126,10 @@ static const char *_matrix_operation_name[CS_MATRIX_N_FILL_TYPES][2]
      {"Block y <- A.x",
       "Block y <- (A-D).x"}};
 
+/* Machine-readable summary file (rank 0 only) */
+
+static FILE  *_bench_csv = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -134,6 +138,7 @@ static const char *_matrix_operation_name[CS_MATRIX_N_FILL_TYPES][2]
  * Count number of operations.
  *
  * parameters:
+ *   name         <-- Operation name, for the machine-readable summary
  *   n_runs       <-- Local number of runs
  *   n_ops        <-- Local number of operations
  *   n_ops_single <-- Single-processor equivalent number of operations
@@ -142,20 +147,26 @@ static const char *_matrix_operation_name[CS_MATRIX_N_FILL_TYPES][2]
  *----------------------------------------------------------------------------*/
 
 static void
-_print_stats(long    n_runs,
-             long    n_ops,
-             long    n_ops_single,
-             double  wt)
+_print_stats(const char  *name,
+             long         n_runs,
+             long         n_ops,
+             long         n_ops_single,
+             double       wt)
 {
   double fm = 1.0 * n_runs / fmax(1.e9 * wt, 1);
 
-  if (cs_glob_n_ranks == 1)
+  if (cs_glob_n_ranks == 1) {
     cs_log_printf(CS_LOG_PERFORMANCE,
                   "  N ops:       %12ld\n"
                   "  Wall clock:  %12.5e\n"
                   "  GFLOPS:      %12.5e\n",
                   n_ops, wt/n_runs, n_ops*fm);
 
+    if (_bench_csv != NULL)
+      fprintf(_bench_csv, "%s,%ld,%ld,%.5e,%.5e\n",
+              name, n_runs, n_ops, wt/n_runs, n_ops*fm);
+  }
+
 #if defined(HAVE_MPI)
 
   else {
@@ -211,6 +222,10 @@ _print_stats(long    n_runs,
          glob_sum[0]/cs_glob_n_ranks, glob_min[0], glob_max[0],
          glob_sum[1]/cs_glob_n_ranks, glob_min[1], glob_max[1],
          n_ops_tot*fmg, n_ops_single*fmg);
+
+    if (_bench_csv != NULL)
+      fprintf(_bench_csv, "%s,%ld,%ld,%.5e,%.5e\n",
+              name, n_runs, n_ops_tot, glob_max[0], n_ops_tot*fmg);
   }
 
 #endif
@@ -464,7 +479,7 @@ _sub_matrix_vector_test(int                  n_time_runs,
                 "  (calls: %d;  test sum: %12.5f)\n",
                 n_time_runs, test_sum);
 
-  _print_stats(n_time_runs, n_ops, n_ops_glob, wt_r0);
+  _print_stats("spmv_exdiag_native", n_time_runs, n_ops, n_ops_glob, wt_r0);
 
   for (cs_lnum_t jj = 0; jj < n_cells_ext; jj++)
     y[jj] = 0.0;
@@ -491,7 +506,7 @@ _sub_matrix_vector_test(int                  n_time_runs,
                 "  (calls: %d;  test sum: %12.5f)\n",
                 n_time_runs, test_sum);
 
-  _print_stats(n_time_runs, n_ops, n_ops_glob, wt_r0);
+  _print_stats("spmv_exdiag_native_v1", n_time_runs, n_ops, n_ops_glob, wt_r0);
 
   /* Matrix.vector product, CUDA variant */
 
@@ -534,7 +549,7 @@ _sub_matrix_vector_test(int                  n_time_runs,
                 "  (calls: %d;  test sum: %12.5f)\n",
                 n_time_runs, test_sum);
 
-  _print_stats(n_time_runs, n_ops, n_ops_glob, wt_r0);
+  _print_stats("spmv_exdiag_cuda", n_time_runs, n_ops, n_ops_glob, wt_r0);
 
 #endif /* (HAVE_CUDA) */
 
@@ -566,7 +581,8 @@ _sub_matrix_vector_test(int                  n_time_runs,
                 "  (calls: %d;  test sum: %12.5f)\n",
                 n_time_runs, test_sum);
 
-  _print_stats(n_time_runs, n_ops, n_ops_glob, wt_r0);
+  _print_stats("spmv_exdiag_dispatch_accel",
+               n_time_runs, n_ops, n_ops_glob, wt_r0);
 
 #endif
 
@@ -593,7 +609,7 @@ _sub_matrix_vector_test(int                  n_time_runs,
                 "  (calls: %d;  test sum: %12.5f)\n",
                 n_time_runs, test_sum);
 
-  _print_stats(n_time_runs, n_ops, n_ops_glob, wt_r0);
+  _print_stats("spmv_exdiag_dispatch", n_time_runs, n_ops, n_ops_glob, wt_r0);
 
   /* Matrix.vector product, contribute to faces only */
 
@@ -632,7 +648,8 @@ _sub_matrix_vector_test(int                  n_time_runs,
                 "  (calls: %d;  test sum: %12.5f)\n",
                 n_time_runs, test_sum);
 
-  _print_stats(n_time_runs, n_ops, n_ops_glob, wt_r0);
+  _print_stats("spmv_exdiag_face_values",
+               n_time_runs, n_ops, n_ops_glob, wt_r0);
 }
 
 /*----------------------------------------------------------------------------
@@ -1175,6 +1192,16 @@ cs_benchmark(int  mpi_trace_mode)
                 "Benchmark mode activated\n"
                 "========================\n");
 
+  /* Open machine-readable summary, for automated comparison of
+     measured performance across machines and software stacks */
+
+  if (cs_glob_rank_id <= 0) {
+    _bench_csv = fopen("benchmark.csv", "w");
+    if (_bench_csv != NULL)
+      fprintf(_bench_csv,
+              "operation,n_calls,n_ops,mean_wall_time,gflops\n");
+  }
+
 #if defined(HAVE_HYPRE)
   /* Force HYPRE initialization */
   void *hypre_sles
@@ -1271,6 +1298,11 @@ cs_benchmark(int  mpi_trace_mode)
 
   cs_mesh_adjacencies_finalize();
 
+  if (_bench_csv != NULL) {
+    fclose(_bench_csv);
+    _bench_csv = NULL;
+  }
+
   cs_log_separator(CS_LOG_PERFORMANCE);
 
 #if defined(HAVE_HYPRE)
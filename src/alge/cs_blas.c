@@ -139,6 +139,26 @@ typedef void
                      double           *xy,
                      double           *yz);
 
+typedef void
+(cs_dot_xy_yz_zz_t) (cs_lnum_t         n,
+                     const cs_real_t  *x,
+                     const cs_real_t  *y,
+                     const cs_real_t  *z,
+                     double           *xy,
+                     double           *yz,
+                     double           *zz);
+
+typedef void
+(cs_dot_xy_xz_xw_yy_t) (cs_lnum_t         n,
+                        const cs_real_t  *x,
+                        const cs_real_t  *y,
+                        const cs_real_t  *z,
+                        const cs_real_t  *w,
+                        double           *xy,
+                        double           *xz,
+                        double           *xw,
+                        double           *yy);
+
 typedef void
 (cs_dot_xx_yy_xy_xz_yz_t)(cs_lnum_t                    n,
                           const cs_real_t  *restrict   x,
@@ -630,6 +650,180 @@ _cs_dot_xx_yy_xy_xz_yz_superblock(cs_lnum_t                    n,
   *yz = dot_yz;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 3 dot products of 3 vectors: x.y, y.z, and z.z
+ *        using a superblock algorithm.
+ *
+ * The products could be computed separately, but computing them
+ * simultaneously adds more optimization opportunities and possibly better
+ * cache behavior.
+ *
+ * \param[in]   n   size of arrays x, y, and z
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[out]  xy  x.y dot product
+ * \param[out]  yz  y.z dot product
+ * \param[out]  zz  z.z dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xy_yz_zz_superblock(cs_lnum_t                    n,
+                            const cs_real_t  *restrict   x,
+                            const cs_real_t  *restrict   y,
+                            const cs_real_t  *restrict   z,
+                            double                      *xy,
+                            double                      *yz,
+                            double                      *zz)
+{
+  double dot_xy = 0.0, dot_yz = 0.0, dot_zz = 0.0;
+
+# pragma omp parallel reduction(+:dot_xy, dot_yz, dot_zz) if (n > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    cs_parall_thread_range(n, sizeof(cs_real_t), &s_id, &e_id);
+
+    const cs_lnum_t _n = e_id - s_id;
+    const cs_real_t *_x = x + s_id;
+    const cs_real_t *_y = y + s_id;
+    const cs_real_t *_z = z + s_id;
+
+    const cs_lnum_t block_size = CS_SBLOCK_BLOCK_SIZE;
+    cs_lnum_t n_sblocks, blocks_in_sblocks;
+
+    _sbloc_sizes(_n, block_size, &n_sblocks, &blocks_in_sblocks);
+
+    for (cs_lnum_t sid = 0; sid < n_sblocks; sid++) {
+
+      double sdot_xy = 0.0;
+      double sdot_yz = 0.0;
+      double sdot_zz = 0.0;
+
+      for (cs_lnum_t bid = 0; bid < blocks_in_sblocks; bid++) {
+        cs_lnum_t start_id = block_size * (blocks_in_sblocks*sid + bid);
+        cs_lnum_t end_id = block_size * (blocks_in_sblocks*sid + bid + 1);
+        if (end_id > _n)
+          end_id = _n;
+        double cdot_xy = 0.0;
+        double cdot_yz = 0.0;
+        double cdot_zz = 0.0;
+        for (cs_lnum_t i = start_id; i < end_id; i++) {
+          cdot_xy += _x[i]*_y[i];
+          cdot_yz += _y[i]*_z[i];
+          cdot_zz += _z[i]*_z[i];
+        }
+        sdot_xy += cdot_xy;
+        sdot_yz += cdot_yz;
+        sdot_zz += cdot_zz;
+      }
+
+      dot_xy += sdot_xy;
+      dot_yz += sdot_yz;
+      dot_zz += sdot_zz;
+
+    }
+  }
+
+  *xy = dot_xy;
+  *yz = dot_yz;
+  *zz = dot_zz;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 4 dot products of 4 vectors: x.y, x.z, x.w, and y.y
+ *        using a superblock algorithm.
+ *
+ * The products could be computed separately, but computing them
+ * simultaneously adds more optimization opportunities and possibly better
+ * cache behavior.
+ *
+ * \param[in]   n   size of arrays x, y, z, and w
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[in]   w   array of floating-point values
+ * \param[out]  xy  x.y dot product
+ * \param[out]  xz  x.z dot product
+ * \param[out]  xw  x.w dot product
+ * \param[out]  yy  y.y dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xy_xz_xw_yy_superblock(cs_lnum_t                    n,
+                               const cs_real_t  *restrict   x,
+                               const cs_real_t  *restrict   y,
+                               const cs_real_t  *restrict   z,
+                               const cs_real_t  *restrict   w,
+                               double                      *xy,
+                               double                      *xz,
+                               double                      *xw,
+                               double                      *yy)
+{
+  double dot_xy = 0.0, dot_xz = 0.0, dot_xw = 0.0, dot_yy = 0.0;
+
+# pragma omp parallel reduction(+:dot_xy, dot_xz, dot_xw, dot_yy) \
+                      if (n > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    cs_parall_thread_range(n, sizeof(cs_real_t), &s_id, &e_id);
+
+    const cs_lnum_t _n = e_id - s_id;
+    const cs_real_t *_x = x + s_id;
+    const cs_real_t *_y = y + s_id;
+    const cs_real_t *_z = z + s_id;
+    const cs_real_t *_w = w + s_id;
+
+    const cs_lnum_t block_size = CS_SBLOCK_BLOCK_SIZE;
+    cs_lnum_t n_sblocks, blocks_in_sblocks;
+
+    _sbloc_sizes(_n, block_size, &n_sblocks, &blocks_in_sblocks);
+
+    for (cs_lnum_t sid = 0; sid < n_sblocks; sid++) {
+
+      double sdot_xy = 0.0;
+      double sdot_xz = 0.0;
+      double sdot_xw = 0.0;
+      double sdot_yy = 0.0;
+
+      for (cs_lnum_t bid = 0; bid < blocks_in_sblocks; bid++) {
+        cs_lnum_t start_id = block_size * (blocks_in_sblocks*sid + bid);
+        cs_lnum_t end_id = block_size * (blocks_in_sblocks*sid + bid + 1);
+        if (end_id > _n)
+          end_id = _n;
+        double cdot_xy = 0.0;
+        double cdot_xz = 0.0;
+        double cdot_xw = 0.0;
+        double cdot_yy = 0.0;
+        for (cs_lnum_t i = start_id; i < end_id; i++) {
+          cdot_xy += _x[i]*_y[i];
+          cdot_xz += _x[i]*_z[i];
+          cdot_xw += _x[i]*_w[i];
+          cdot_yy += _y[i]*_y[i];
+        }
+        sdot_xy += cdot_xy;
+        sdot_xz += cdot_xz;
+        sdot_xw += cdot_xw;
+        sdot_yy += cdot_yy;
+      }
+
+      dot_xy += sdot_xy;
+      dot_xz += sdot_xz;
+      dot_xw += sdot_xw;
+      dot_yy += sdot_yy;
+
+    }
+  }
+
+  *xy = dot_xy;
+  *xz = dot_xz;
+  *xw = dot_xw;
+  *yy = dot_yy;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return the global residual of 2 intensive vectors:
@@ -1187,6 +1381,145 @@ _cs_dot_xx_yy_xy_xz_yz_kahan(cs_lnum_t                    n,
   *yz = dot_yz;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 3 dot products of 3 vectors: x.y, y.z, and z.z
+ *        using Kahan summation.
+ *
+ * The products could be computed separately, but computing them
+ * simultaneously adds more optimization opportunities and possibly better
+ * cache behavior.
+ *
+ * \param[in]   n   size of arrays x, y, and z
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[out]  xy  x.y dot product
+ * \param[out]  yz  y.z dot product
+ * \param[out]  zz  z.z dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xy_yz_zz_kahan(cs_lnum_t                    n,
+                       const cs_real_t  *restrict   x,
+                       const cs_real_t  *restrict   y,
+                       const cs_real_t  *restrict   z,
+                       double                      *xy,
+                       double                      *yz,
+                       double                      *zz)
+{
+  double dot_xy = 0.0, dot_yz = 0.0, dot_zz = 0.0;
+
+# pragma omp parallel reduction(+:dot_xy, dot_yz, dot_zz) if (n > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    cs_parall_thread_range(n, sizeof(cs_real_t), &s_id, &e_id);
+
+    const cs_lnum_t _n = e_id - s_id;
+    const cs_real_t *_x = x + s_id;
+    const cs_real_t *_y = y + s_id;
+    const cs_real_t *_z = z + s_id;
+
+    double s[3] = {0, 0, 0};
+    double c[3] = {0, 0, 0};
+
+    for (cs_lnum_t i = 0; i < _n; i++) {
+      double t[3];
+      double u[3] = {(_x[i]*_y[i]) - c[0],
+                     (_y[i]*_z[i]) - c[1],
+                     (_z[i]*_z[i]) - c[2]};
+      for (int j = 0; j < 3; j++) {
+        t[j] = s[j] + u[j];
+        c[j] = (t[j] - s[j]) - u[j];
+        s[j] = t[j];
+      }
+    }
+
+    dot_xy = s[0];
+    dot_yz = s[1];
+    dot_zz = s[2];
+  }
+
+  *xy = dot_xy;
+  *yz = dot_yz;
+  *zz = dot_zz;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 4 dot products of 4 vectors: x.y, x.z, x.w, and y.y
+ *        using Kahan summation.
+ *
+ * The products could be computed separately, but computing them
+ * simultaneously adds more optimization opportunities and possibly better
+ * cache behavior.
+ *
+ * \param[in]   n   size of arrays x, y, z, and w
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[in]   w   array of floating-point values
+ * \param[out]  xy  x.y dot product
+ * \param[out]  xz  x.z dot product
+ * \param[out]  xw  x.w dot product
+ * \param[out]  yy  y.y dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xy_xz_xw_yy_kahan(cs_lnum_t                    n,
+                          const cs_real_t  *restrict   x,
+                          const cs_real_t  *restrict   y,
+                          const cs_real_t  *restrict   z,
+                          const cs_real_t  *restrict   w,
+                          double                      *xy,
+                          double                      *xz,
+                          double                      *xw,
+                          double                      *yy)
+{
+  double dot_xy = 0.0, dot_xz = 0.0, dot_xw = 0.0, dot_yy = 0.0;
+
+# pragma omp parallel reduction(+:dot_xy, dot_xz, dot_xw, dot_yy) \
+                      if (n > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    cs_parall_thread_range(n, sizeof(cs_real_t), &s_id, &e_id);
+
+    const cs_lnum_t _n = e_id - s_id;
+    const cs_real_t *_x = x + s_id;
+    const cs_real_t *_y = y + s_id;
+    const cs_real_t *_z = z + s_id;
+    const cs_real_t *_w = w + s_id;
+
+    double s[4] = {0, 0, 0, 0};
+    double c[4] = {0, 0, 0, 0};
+
+    for (cs_lnum_t i = 0; i < _n; i++) {
+      double t[4];
+      double u[4] = {(_x[i]*_y[i]) - c[0],
+                     (_x[i]*_z[i]) - c[1],
+                     (_x[i]*_w[i]) - c[2],
+                     (_y[i]*_y[i]) - c[3]};
+      for (int j = 0; j < 4; j++) {
+        t[j] = s[j] + u[j];
+        c[j] = (t[j] - s[j]) - u[j];
+        s[j] = t[j];
+      }
+    }
+
+    dot_xy = s[0];
+    dot_xz = s[1];
+    dot_xw = s[2];
+    dot_yy = s[3];
+  }
+
+  *xy = dot_xy;
+  *xz = dot_xz;
+  *xw = dot_xw;
+  *yy = dot_yy;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return the global residual of 2 extensive vectors:
@@ -1260,6 +1593,10 @@ static cs_dot_xx_xy_t *_cs_glob_dot_xx_xy = _cs_dot_xx_xy_superblock;
 static cs_dot_xy_yz_t *_cs_glob_dot_xy_yz = _cs_dot_xy_yz_superblock;
 static cs_dot_xx_xy_yz_t  *_cs_glob_dot_xx_xy_yz
   = _cs_dot_xx_xy_yz_superblock;
+static cs_dot_xy_yz_zz_t  *_cs_glob_dot_xy_yz_zz
+  = _cs_dot_xy_yz_zz_superblock;
+static cs_dot_xy_xz_xw_yy_t  *_cs_glob_dot_xy_xz_xw_yy
+  = _cs_dot_xy_xz_xw_yy_superblock;
 static cs_dot_xx_yy_xy_xz_yz_t  *_cs_glob_dot_xx_yy_xy_xz_yz
   = _cs_dot_xx_yy_xy_xz_yz_superblock;
 
@@ -1317,6 +1654,8 @@ cs_blas_set_reduce_algorithm(cs_blas_reduce_t  mode)
         _cs_glob_dot_xx_xy = _cs_dot_xx_xy_superblock;
         _cs_glob_dot_xy_yz = _cs_dot_xy_yz_superblock;
         _cs_glob_dot_xx_xy_yz = _cs_dot_xx_xy_yz_superblock;
+        _cs_glob_dot_xy_yz_zz = _cs_dot_xy_yz_zz_superblock;
+        _cs_glob_dot_xy_xz_xw_yy = _cs_dot_xy_xz_xw_yy_superblock;
         _cs_glob_dot_xx_yy_xy_xz_yz = _cs_dot_xx_yy_xy_xz_yz_superblock;
         _cs_glob_gres = _cs_gres_superblock;
       }
@@ -1328,6 +1667,8 @@ cs_blas_set_reduce_algorithm(cs_blas_reduce_t  mode)
         _cs_glob_dot_xx_xy = _cs_dot_xx_xy_kahan;
         _cs_glob_dot_xy_yz = _cs_dot_xy_yz_kahan;
         _cs_glob_dot_xx_xy_yz = _cs_dot_xx_xy_yz_kahan;
+        _cs_glob_dot_xy_yz_zz = _cs_dot_xy_yz_zz_kahan;
+        _cs_glob_dot_xy_xz_xw_yy = _cs_dot_xy_xz_xw_yy_kahan;
         _cs_glob_dot_xx_yy_xy_xz_yz = _cs_dot_xx_yy_xy_xz_yz_kahan;
         _cs_glob_gres = _cs_gres_kahan;
       }
@@ -1658,6 +1999,70 @@ cs_dot_xx_xy_yz(cs_lnum_t                    n,
   _cs_glob_dot_xx_xy_yz(n, x, y, z, xx, xy, yz);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 3 dot products of 3 vectors: x.y, y.z, and z.z
+ *
+ * The products could be computed separately, but computing them
+ * simultaneously adds more optimization opportunities and possibly better
+ * cache behavior.
+ *
+ * \param[in]   n   size of arrays x, y, and z
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[out]  xy  x.y dot product
+ * \param[out]  yz  y.z dot product
+ * \param[out]  zz  z.z dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_dot_xy_yz_zz(cs_lnum_t                    n,
+                const cs_real_t  *restrict   x,
+                const cs_real_t  *restrict   y,
+                const cs_real_t  *restrict   z,
+                double                      *xy,
+                double                      *yz,
+                double                      *zz)
+{
+  _cs_glob_dot_xy_yz_zz(n, x, y, z, xy, yz, zz);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 4 dot products of 4 vectors: x.y, x.z, x.w, and y.y
+ *
+ * The products could be computed separately, but computing them
+ * simultaneously adds more optimization opportunities and possibly better
+ * cache behavior.
+ *
+ * \param[in]   n   size of arrays x, y, z, and w
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[in]   w   array of floating-point values
+ * \param[out]  xy  x.y dot product
+ * \param[out]  xz  x.z dot product
+ * \param[out]  xw  x.w dot product
+ * \param[out]  yy  y.y dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_dot_xy_xz_xw_yy(cs_lnum_t                    n,
+                   const cs_real_t  *restrict   x,
+                   const cs_real_t  *restrict   y,
+                   const cs_real_t  *restrict   z,
+                   const cs_real_t  *restrict   w,
+                   double                      *xy,
+                   double                      *xz,
+                   double                      *xw,
+                   double                      *yy)
+{
+  _cs_glob_dot_xy_xz_xw_yy(n, x, y, z, w, xy, xz, xw, yy);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return 5 dot products of 3 vectors: x.x, y.y, x.y, x.z, and y.z
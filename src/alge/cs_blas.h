@@ -261,6 +261,62 @@ cs_dot_xx_xy_yz(cs_lnum_t                    n,
                 double                      *xy,
                 double                      *yz);
 
+/*----------------------------------------------------------------------------
+ * Return 3 dot products of 3 vectors: x.y, y.z, and z.z
+ *
+ * The products could be computed separately, but computing them
+ * simultaneously adds more optimization opportunities and possibly better
+ * cache behavior.
+ *
+ * parameters:
+ *   n  <-- size of arrays x, y, and z
+ *   x  <-- array of floating-point values
+ *   y  <-- array of floating-point values
+ *   z  <-- array of floating-point values
+ *   xy --> x.y dot product
+ *   yz --> y.z dot product
+ *   zz --> z.z dot product
+ *----------------------------------------------------------------------------*/
+
+void
+cs_dot_xy_yz_zz(cs_lnum_t                    n,
+                const cs_real_t  *restrict   x,
+                const cs_real_t  *restrict   y,
+                const cs_real_t  *restrict   z,
+                double                      *xy,
+                double                      *yz,
+                double                      *zz);
+
+/*----------------------------------------------------------------------------
+ * Return 4 dot products of 4 vectors: x.y, x.z, x.w, and y.y
+ *
+ * The products could be computed separately, but computing them
+ * simultaneously adds more optimization opportunities and possibly better
+ * cache behavior.
+ *
+ * parameters:
+ *   n  <-- size of arrays x, y, z, and w
+ *   x  <-- array of floating-point values
+ *   y  <-- array of floating-point values
+ *   z  <-- array of floating-point values
+ *   w  <-- array of floating-point values
+ *   xy --> x.y dot product
+ *   xz --> x.z dot product
+ *   xw --> x.w dot product
+ *   yy --> y.y dot product
+ *----------------------------------------------------------------------------*/
+
+void
+cs_dot_xy_xz_xw_yy(cs_lnum_t                    n,
+                   const cs_real_t  *restrict   x,
+                   const cs_real_t  *restrict   y,
+                   const cs_real_t  *restrict   z,
+                   const cs_real_t  *restrict   w,
+                   double                      *xy,
+                   double                      *xz,
+                   double                      *xw,
+                   double                      *yy);
+
 /*----------------------------------------------------------------------------
  * Return 5 dot products of 3 vectors: x.x, y.y, x.y, x.z, and y.z
  *
@@ -103,8 +103,8 @@ typedef  cs_real_t  cs_weight_t;  /* will allow testing single precision
  *  Global variables
  *============================================================================*/
 
-bool          _set[3] = {false, false, false};
-cs_weight_t  *_weights[3][2] = {{NULL, NULL}, {NULL, NULL}, {NULL, NULL}};
+static bool          _set[3] = {false, false, false};
+static cs_weight_t  *_weights[3][2] = {{NULL, NULL}, {NULL, NULL}, {NULL, NULL}};
 
 /* Short names for gradient computation types */
 
@@ -474,6 +474,7 @@ _cell_to_vertex_scalar(cs_cell_to_vertex_type_t   method,
           _cell_to_vertex_w_unweighted(tr_ignore);
 
         const cs_weight_t *w = _weights[CS_CELL_TO_VERTEX_UNWEIGHTED][0];
+#       pragma omp parallel for if(n_vertices > CS_THR_MIN)
         for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++)
           v_var[v_id] *= w[v_id];
       }
@@ -509,6 +510,7 @@ _cell_to_vertex_scalar(cs_cell_to_vertex_type_t   method,
                                   v_w);
         }
 
+#       pragma omp parallel for if(n_vertices > CS_THR_MIN)
         for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++)
           v_var[v_id] /= v_w[v_id];
 
@@ -628,6 +630,7 @@ _cell_to_vertex_scalar(cs_cell_to_vertex_type_t   method,
                                   CS_REAL_TYPE,
                                   tr_ignore,
                                   v_w);
+#       pragma omp parallel for if(n_vertices > CS_THR_MIN)
         for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++)
           v_var[v_id] /= v_w[v_id];
         BFT_FREE(v_w);
@@ -807,6 +810,7 @@ _cell_to_vertex_strided(cs_cell_to_vertex_type_t   method,
           _cell_to_vertex_w_unweighted(tr_ignore);
 
         const cs_weight_t *w = _weights[CS_CELL_TO_VERTEX_UNWEIGHTED][0];
+#       pragma omp parallel for if(n_vertices > CS_THR_MIN)
         for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
           for (cs_lnum_t k = 0; k < var_dim; k++)
             v_var[v_id*var_dim + k] *= w[v_id];
@@ -844,6 +848,7 @@ _cell_to_vertex_strided(cs_cell_to_vertex_type_t   method,
                                   tr_ignore,
                                   v_w);
         }
+#       pragma omp parallel for if(n_vertices > CS_THR_MIN)
         for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
           for (cs_lnum_t k = 0; k < var_dim; k++)
             v_var[v_id*var_dim + k] /= v_w[v_id];
@@ -973,6 +978,7 @@ _cell_to_vertex_strided(cs_cell_to_vertex_type_t   method,
                                   CS_REAL_TYPE,
                                   tr_ignore,
                                   v_w);
+#       pragma omp parallel for if(n_vertices > CS_THR_MIN)
         for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
           for (cs_lnum_t k = 0; k < var_dim; k++)
             v_var[v_id*var_dim+k] /= v_w[v_id];
@@ -1106,7 +1112,8 @@ cs_cell_to_vertex_free(void)
 {
   for (int i = 0; i < 3; i++) {
     for (int j = 0; j < 2; j++)
-    BFT_FREE(_weights[i][j]);
+      BFT_FREE(_weights[i][j]);
+    _set[i] = false;
   }
 }
 
@@ -75,6 +75,7 @@
 #include "cs_parameters.h"
 #include "cs_porous_model.h"
 #include "cs_prototypes.h"
+#include "cs_scratch.h"
 #include "cs_timer.h"
 #include "cs_velocity_pressure.h"
 
@@ -1554,7 +1555,7 @@ _convection_diffusion_scalar_steady(const cs_field_t           *f,
 
   /* Allocate work arrays */
 
-  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+  CS_SCRATCH_GET(grad, n_cells_ext, cs_real_3_t);
 
   /* Choose gradient type */
 
@@ -1698,7 +1699,7 @@ _convection_diffusion_scalar_steady(const cs_field_t           *f,
     /* Compute cell gradient used in slope test */
     if (isstpp == 0) {
 
-      BFT_MALLOC(gradst, n_cells_ext, cs_real_3_t);
+      CS_SCRATCH_GET(gradst, n_cells_ext, cs_real_3_t);
 
 #     pragma omp parallel for
       for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
@@ -1722,7 +1723,7 @@ _convection_diffusion_scalar_steady(const cs_field_t           *f,
     /* Pure SOLU scheme */
     if (ischcp == 2 || (xcpp != NULL && ischcp == 4)) {
 
-      BFT_MALLOC(gradup, n_cells_ext, cs_real_3_t);
+      CS_SCRATCH_GET(gradup, n_cells_ext, cs_real_3_t);
 
 #     pragma omp parallel for
       for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
@@ -2291,9 +2292,9 @@ _convection_diffusion_scalar_steady(const cs_field_t           *f,
   }
 
   /* Free memory */
-  BFT_FREE(grad);
-  BFT_FREE(gradup);
-  BFT_FREE(gradst);
+  CS_SCRATCH_RELEASE(grad);
+  CS_SCRATCH_RELEASE(gradup);
+  CS_SCRATCH_RELEASE(gradst);
 
 }
 
@@ -2432,7 +2433,7 @@ _face_convection_scalar_steady(const cs_field_t           *f,
 
   /* Allocate work arrays */
 
-  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+  CS_SCRATCH_GET(grad, n_cells_ext, cs_real_3_t);
 
   /* Choose gradient type */
 
@@ -2461,14 +2462,14 @@ _face_convection_scalar_steady(const cs_field_t           *f,
     /* NVD/TVD limiters */
     if (ischcp == 4) {
       limiter_choice = (cs_nvd_type_t)cs_field_get_key_int(f, key_lim_choice);
-      BFT_MALLOC(local_max, n_cells_ext, cs_real_t);
-      BFT_MALLOC(local_min, n_cells_ext, cs_real_t);
+      CS_SCRATCH_GET(local_max, n_cells_ext, cs_real_t);
+      CS_SCRATCH_GET(local_min, n_cells_ext, cs_real_t);
       cs_field_local_extrema_scalar(f_id,
                                     halo_type,
                                     local_max,
                                     local_min);
       if (limiter_choice >= CS_NVD_VOF_HRIC) {
-        BFT_MALLOC(courant, n_cells_ext, cs_real_t);
+        CS_SCRATCH_GET(courant, n_cells_ext, cs_real_t);
         cs_cell_courant_number(f, ctx, courant);
       }
     }
@@ -2580,7 +2581,7 @@ _face_convection_scalar_steady(const cs_field_t           *f,
     /* Compute cell gradient used in slope test */
     if (isstpp == 0) {
 
-      BFT_MALLOC(gradst, n_cells_ext, cs_real_3_t);
+      CS_SCRATCH_GET(gradst, n_cells_ext, cs_real_3_t);
 
 #     pragma omp parallel for
       for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
@@ -2604,7 +2605,7 @@ _face_convection_scalar_steady(const cs_field_t           *f,
     /* Pure SOLU scheme */
     if (ischcp == 2) {
 
-      BFT_MALLOC(gradup, n_cells_ext, cs_real_3_t);
+      CS_SCRATCH_GET(gradup, n_cells_ext, cs_real_3_t);
 
 #     pragma omp parallel for
       for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
@@ -2989,12 +2990,375 @@ _face_convection_scalar_steady(const cs_field_t           *f,
   }
 
   /* Free memory */
-  BFT_FREE(grad);
-  BFT_FREE(gradup);
-  BFT_FREE(gradst);
-  BFT_FREE(local_max);
-  BFT_FREE(local_min);
-  BFT_FREE(courant);
+  CS_SCRATCH_RELEASE(grad);
+  CS_SCRATCH_RELEASE(gradup);
+  CS_SCRATCH_RELEASE(gradst);
+  CS_SCRATCH_RELEASE(local_max);
+  CS_SCRATCH_RELEASE(local_min);
+  CS_SCRATCH_RELEASE(courant);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute convection/diffusion fluxes at interior faces for a scalar
+ * field, without slope test (possibly with a Min/Max Beta limiter).
+ *
+ * The convection scheme is a template parameter, so each instantiation
+ * runs a branch-free face loop specialized for a single scheme, which
+ * vectorizes much better than a per-face dispatch.
+ *
+ * template parameters:
+ * - is_thermal  true for temperature (with specific heat), false otherwise
+ * - ischcp      convection scheme:
+ *                - 0: legacy SOLU
+ *                - 1: centered
+ *                - 2: SOLU (upwind gradient)
+ *                - 3: centered/SOLU hybrid blending
+ *                - 4: NVD/TVD
+ * - recon       reconstruct face values (ircflu option)
+ *
+ * \param[in,out] ctx             reference to dispatch context
+ * \param[in]     m               pointer to mesh structure
+ * \param[in]     eqp             equation parameters
+ * \param[in]     imasac          take mass accumulation into account?
+ * \param[in]     limiter_choice  NVD limiter (for ischcp = 4)
+ * \param[in]     pvar            solved variable (synchronized)
+ * \param[in]     i_massflux      mass flux at interior faces
+ * \param[in]     i_visc          diffusion coefficient at interior faces
+ * \param[in]     xcpp            array of specific heat, or NULL
+ * \param[in]     grad            cell gradient
+ * \param[in]     gradup          upwind cell gradient, or NULL
+ * \param[in]     cv_limiter      convection limiter field values, or NULL
+ * \param[in]     df_limiter      diffusion limiter field values, or NULL
+ * \param[in]     hybrid_blend    hybrid blending field values, or NULL
+ * \param[in]     local_max       local maxima (for NVD/TVD), or NULL
+ * \param[in]     local_min       local minima (for NVD/TVD), or NULL
+ * \param[in]     courant         cell Courant number (for VOF NVD), or NULL
+ * \param[in]     i_sum_type      interior face sum type
+ * \param[in,out] rhs             right hand side
+ */
+/*----------------------------------------------------------------------------*/
+
+template <bool is_thermal, int ischcp, bool recon>
+static void
+_i_faces_flux_no_slope_test(cs_dispatch_context         &ctx,
+                            const cs_mesh_t             *m,
+                            const cs_equation_param_t   &eqp,
+                            int                          imasac,
+                            cs_nvd_type_t                limiter_choice,
+                            const cs_real_t   *restrict  pvar,
+                            const cs_real_t              i_massflux[],
+                            const cs_real_t              i_visc[],
+                            const cs_real_t              xcpp[],
+                            const cs_real_3_t *restrict  grad,
+                            const cs_real_3_t *restrict  gradup,
+                            const cs_real_t   *restrict  cv_limiter,
+                            const cs_real_t   *restrict  df_limiter,
+                            const cs_real_t   *restrict  hybrid_blend,
+                            const cs_real_t   *restrict  local_max,
+                            const cs_real_t   *restrict  local_min,
+                            const cs_real_t   *restrict  courant,
+                            cs_dispatch_sum_type_t       i_sum_type,
+                            cs_real_t         *restrict  rhs)
+{
+  const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
+
+  const int iconvp = eqp.iconv;
+  const int idiffp = eqp.idiff;
+  const int isstpp = eqp.isstpc;
+  const double blencp = eqp.blencv;
+  const double thetap = eqp.theta;
+
+  const cs_lnum_t n_cells = m->n_cells;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict i_face_u_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_u_normal;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)fvq->i_face_cog;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *restrict)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *restrict)fvq->djjpf;
+
+  ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
+
+    cs_lnum_t ii = i_face_cells[face_id][0];
+    cs_lnum_t jj = i_face_cells[face_id][1];
+
+    cs_real_t cpi = 1.0, cpj = 1.0;
+    if (is_thermal) {
+      cpi = xcpp[ii];
+      cpj = xcpp[jj];
+    }
+
+    cs_real_t beta = blencp;
+
+    cs_real_t pif, pjf;
+    cs_real_t pip, pjp;
+
+#if defined(__INTEL_LLVM_COMPILER)
+    // Silence unitialized variables warning due do compiler ignoring
+    // initializations in inlined functions.
+    pif = 0., pjf = 0.;
+#endif
+
+    /* Beta blending coefficient ensuring positivity of the scalar */
+    if (isstpp == 2) {
+      beta = cs_math_fmax(cs_math_fmin(cv_limiter[ii], cv_limiter[jj]),
+                          0.);
+    }
+
+    cs_real_t fluxi = 0., fluxj = 0.;
+
+    if (recon) {
+      cs_real_t bldfrp = 1.;
+      if (df_limiter != NULL)  /* Local limiter of the reconstruction */
+        bldfrp = cs_math_fmax(cs_math_fmin(df_limiter[ii], df_limiter[jj]),
+                              0.);
+
+      cs_real_t recoi, recoj;
+      cs_i_compute_quantities(bldfrp,
+                              diipf[face_id], djjpf[face_id],
+                              grad[ii], grad[jj],
+                              pvar[ii], pvar[jj],
+                              &recoi, &recoj,
+                              &pip, &pjp);
+    }
+    else {
+      pip = pvar[ii];
+      pjp = pvar[jj];
+    }
+
+    if (ischcp != 4) {
+
+      if (ischcp == 0) {
+
+        /* Legacy SOLU
+           -----------*/
+
+        cs_solu_f_val(cell_cen[ii],
+                      i_face_cog[face_id],
+                      grad[ii],
+                      pvar[ii],
+                      &pif);
+        cs_solu_f_val(cell_cen[jj],
+                      i_face_cog[face_id],
+                      grad[jj],
+                      pvar[jj],
+                      &pjf);
+      }
+      else if (ischcp == 1) {
+
+        /* Centered
+           --------*/
+
+        const cs_real_t w_f = weight[face_id];
+        pif = w_f*pip + (1.-w_f)*pjp;
+        pjf = pif;
+
+      }
+      else if (ischcp == 2) {
+
+        /* SOLU
+           ---- */
+
+        cs_solu_f_val(cell_cen[ii],
+                      i_face_cog[face_id],
+                      gradup[ii],
+                      pvar[ii],
+                      &pif);
+        cs_solu_f_val(cell_cen[jj],
+                      i_face_cog[face_id],
+                      gradup[jj],
+                      pvar[jj],
+                      &pjf);
+
+      }
+      else if (ischcp == 3) {
+
+        /* Centered
+           -------- */
+
+        const cs_real_t w_f = weight[face_id];
+        pif = w_f*pip + (1.-w_f)*pjp;
+        pjf = pif;
+
+        /* Legacy SOLU
+           -----------*/
+        cs_real_t pif_up, pjf_up;
+
+        cs_solu_f_val(cell_cen[ii],
+                      i_face_cog[face_id],
+                      grad[ii],
+                      pvar[ii],
+                      &pif_up);
+
+        cs_solu_f_val(cell_cen[jj],
+                      i_face_cog[face_id],
+                      grad[jj],
+                      pvar[jj],
+                      &pjf_up);
+
+        cs_real_t hybrid_blend_interp
+          = cs_math_fmin(hybrid_blend[ii], hybrid_blend[jj]);
+
+        pif = hybrid_blend_interp*pif + (1. - hybrid_blend_interp)*pif_up;
+        pjf = hybrid_blend_interp*pjf + (1. - hybrid_blend_interp)*pjf_up;
+
+      }
+
+      /* Blending
+         -------- */
+
+      pif = beta * pif + (1. - beta) * pvar[ii];
+      pjf = beta * pjf + (1. - beta) * pvar[jj];
+
+    }
+    else if (ischcp == 4) {
+
+      /* NVD/TVD family of high accuracy schemes */
+
+      cs_lnum_t ic, id;
+
+      /* Determine central and downwind sides w.r.t. current face */
+      if (i_massflux[face_id] >= 0.) {
+        ic = ii;
+        id = jj;
+      } else {
+        ic = jj;
+        id = ii;
+      }
+
+      cs_real_t courant_c = -1.;
+      if (courant != NULL && is_thermal == false)
+        courant_c = courant[ic];
+
+      cs_i_cd_unsteady_nvd(limiter_choice,
+                           beta,
+                           cell_cen[ic],
+                           cell_cen[id],
+                           i_face_u_normal[face_id],
+                           i_face_cog[face_id],
+                           grad[ic],
+                           pvar[ic],
+                           pvar[id],
+                           local_max[ic],
+                           local_min[ic],
+                           courant_c,
+                           &pif,
+                           &pjf);
+
+    }
+
+    // Convective flux
+
+    if (iconvp == 1) {
+      cs_real_t _i_massflux = i_massflux[face_id];
+      cs_real_t flui = 0.5*(_i_massflux + cs_math_fabs(_i_massflux));
+      cs_real_t fluj = 0.5*(_i_massflux - cs_math_fabs(_i_massflux));
+
+      fluxi += cpi*(  thetap*(flui*pif + fluj*pjf)
+                    - imasac*_i_massflux*pvar[ii]);
+
+      fluxj += cpj*(  thetap*(flui*pif + fluj*pjf)
+                    - imasac*_i_massflux*pvar[jj]);
+
+    }
+
+    // Diffusive flux (no relaxation)
+
+    cs_real_t diff_contrib = idiffp*thetap*i_visc[face_id]*(pip - pjp);
+    fluxi += diff_contrib;
+    fluxj += diff_contrib;
+
+    if (ii < n_cells)
+      cs_dispatch_sum(&rhs[ii], -fluxi, i_sum_type);
+    if (jj < n_cells)
+      cs_dispatch_sum(&rhs[jj],  fluxj, i_sum_type);
+
+  });
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select the _i_faces_flux_no_slope_test instantiation matching
+ * the convection scheme, with other options folded at compile time.
+ *
+ * The dispatch on run-constant options is thus done once per call,
+ * so the face loop itself is free of option branching.
+ *
+ * template parameters and arguments: see _i_faces_flux_no_slope_test.
+ */
+/*----------------------------------------------------------------------------*/
+
+template <bool is_thermal, bool recon>
+static void
+_i_faces_flux_no_slope_test_dispatch
+  (cs_dispatch_context         &ctx,
+   const cs_mesh_t             *m,
+   const cs_equation_param_t   &eqp,
+   int                          imasac,
+   cs_nvd_type_t                limiter_choice,
+   const cs_real_t   *restrict  pvar,
+   const cs_real_t              i_massflux[],
+   const cs_real_t              i_visc[],
+   const cs_real_t              xcpp[],
+   const cs_real_3_t *restrict  grad,
+   const cs_real_3_t *restrict  gradup,
+   const cs_real_t   *restrict  cv_limiter,
+   const cs_real_t   *restrict  df_limiter,
+   const cs_real_t   *restrict  hybrid_blend,
+   const cs_real_t   *restrict  local_max,
+   const cs_real_t   *restrict  local_min,
+   const cs_real_t   *restrict  courant,
+   cs_dispatch_sum_type_t       i_sum_type,
+   cs_real_t         *restrict  rhs)
+{
+  switch (eqp.ischcv) {
+  case 0:
+    _i_faces_flux_no_slope_test<is_thermal, 0, recon>
+      (ctx, m, eqp, imasac, limiter_choice, pvar,
+       i_massflux, i_visc, xcpp, grad, gradup,
+       cv_limiter, df_limiter, hybrid_blend,
+       local_max, local_min, courant, i_sum_type, rhs);
+    break;
+  case 1:
+    _i_faces_flux_no_slope_test<is_thermal, 1, recon>
+      (ctx, m, eqp, imasac, limiter_choice, pvar,
+       i_massflux, i_visc, xcpp, grad, gradup,
+       cv_limiter, df_limiter, hybrid_blend,
+       local_max, local_min, courant, i_sum_type, rhs);
+    break;
+  case 2:
+    _i_faces_flux_no_slope_test<is_thermal, 2, recon>
+      (ctx, m, eqp, imasac, limiter_choice, pvar,
+       i_massflux, i_visc, xcpp, grad, gradup,
+       cv_limiter, df_limiter, hybrid_blend,
+       local_max, local_min, courant, i_sum_type, rhs);
+    break;
+  case 3:
+    _i_faces_flux_no_slope_test<is_thermal, 3, recon>
+      (ctx, m, eqp, imasac, limiter_choice, pvar,
+       i_massflux, i_visc, xcpp, grad, gradup,
+       cv_limiter, df_limiter, hybrid_blend,
+       local_max, local_min, courant, i_sum_type, rhs);
+    break;
+  case 4:
+    _i_faces_flux_no_slope_test<is_thermal, 4, recon>
+      (ctx, m, eqp, imasac, limiter_choice, pvar,
+       i_massflux, i_visc, xcpp, grad, gradup,
+       cv_limiter, df_limiter, hybrid_blend,
+       local_max, local_min, courant, i_sum_type, rhs);
+    break;
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              _("invalid value of ischcv"));
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3461,48 +3825,58 @@ _convection_diffusion_scalar_unsteady
 
   else if (isstpp == 1 || isstpp == 2) {
 
-    if (ischcp < 0 || ischcp > 4) {
-      bft_error(__FILE__, __LINE__, 0,
-                _("invalid value of ischcv"));
-    }
-
     const cs_real_t *hybrid_blend = nullptr;
     if (CS_F_(hybrid_blend) != NULL)
       hybrid_blend = CS_F_(hybrid_blend)->val;
 
+    /* Face loops specialized (and branch-free) per convection scheme
+       and reconstruction option */
+
+    if (ircflp == 1)
+      _i_faces_flux_no_slope_test_dispatch<is_thermal, true>
+        (ctx, m, eqp, imasac, limiter_choice, _pvar,
+         i_massflux, i_visc, xcpp, grad, gradup,
+         cv_limiter, df_limiter, hybrid_blend,
+         local_max, local_min, courant, i_sum_type, rhs);
+    else
+      _i_faces_flux_no_slope_test_dispatch<is_thermal, false>
+        (ctx, m, eqp, imasac, limiter_choice, _pvar,
+         i_massflux, i_visc, xcpp, grad, gradup,
+         cv_limiter, df_limiter, hybrid_blend,
+         local_max, local_min, courant, i_sum_type, rhs);
+
+  /* --> Flux with slope test
+     ============================================*/
+
+  }
+  else { /* isstpp = 0 */
+
+    if (ischcp < 0 || ischcp > 2) {
+      bft_error(__FILE__, __LINE__, 0,
+                _("invalid value of ischcv"));
+    }
+
     ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
 
       cs_lnum_t ii = i_face_cells[face_id][0];
       cs_lnum_t jj = i_face_cells[face_id][1];
 
-      cs_real_t cpi = 1.0, cpj = 1.0;
+      cs_real_t cpi = 1., cpj = 1.;
       if (is_thermal) {
         cpi = xcpp[ii];
         cpj = xcpp[jj];
       }
 
-      cs_real_t beta = blencp;
+      bool upwind_switch = false;
+
+      cs_real_t fluxi = 0., fluxj = 0.;
 
       cs_real_t pif, pjf;
       cs_real_t pip, pjp;
 
-#if defined(__INTEL_LLVM_COMPILER)
-      // Silence unitialized variables warning due do compiler ignoring
-      // initializations in inlined functions.
-      pif = 0., pjf = 0.;
-#endif
-
-      /* Beta blending coefficient ensuring positivity of the scalar */
-      if (isstpp == 2) {
-        beta = cs_math_fmax(cs_math_fmin(cv_limiter[ii], cv_limiter[jj]),
-                            0.);
-      }
-
-      cs_real_t fluxi = 0., fluxj = 0.;
-
       if (ircflp == 1) {
         cs_real_t bldfrp = 1.;
-        if (df_limiter != NULL)  /* Local limiter of the reconstruction */
+        if (df_limiter != NULL)  /* Local limiter */
           bldfrp = cs_math_fmax(cs_math_fmin(df_limiter[ii], df_limiter[jj]),
                                 0.);
 
@@ -3523,12 +3897,26 @@ _convection_diffusion_scalar_unsteady
       const cs_real_t *cell_cenj = cell_cen[jj];
       const cs_real_t w_f = weight[face_id];
 
-      if (ischcp != 4) {
+      /* Slope test is needed with convection */
+      if (iconvp > 0) {
+        cs_real_t testij, tesqck;
+
+        cs_slope_test(_pvar[ii],
+                      _pvar[jj],
+                      i_dist[face_id],
+                      i_face_u_normal[face_id],
+                      grad[ii],
+                      grad[jj],
+                      gradst[ii],
+                      gradst[jj],
+                      i_massflux[face_id],
+                      &testij,
+                      &tesqck);
 
         if (ischcp == 0) {
 
-          /* Legacy SOLU
-             -----------*/
+          /* Original SOLU
+             --------------*/
 
           cs_solu_f_val(cell_ceni,
                         i_face_cog[face_id],
@@ -3550,10 +3938,10 @@ _convection_diffusion_scalar_unsteady
           pjf = pif;
 
         }
-        else if (ischcp == 2) {
+        else {
 
           /* SOLU
-             ---- */
+             -----*/
 
           cs_solu_f_val(cell_ceni,
                         i_face_cog[face_id],
@@ -3567,245 +3955,32 @@ _convection_diffusion_scalar_unsteady
                         &pjf);
 
         }
-        else if (ischcp == 3) {
-
-          /* Centered
-             -------- */
-
-          pif = w_f*pip + (1.-w_f)*pjp;
-          pjf = pif;
-
-          /* Legacy SOLU
-             -----------*/
-          cs_real_t pif_up, pjf_up;
 
-          cs_solu_f_val(cell_ceni,
-                        i_face_cog[face_id],
-                        grad[ii],
-                        _pvar[ii],
-                        &pif_up);
+        /* Slope test: percentage of upwind
+           -------------------------------- */
 
-          cs_solu_f_val(cell_cenj,
-                        i_face_cog[face_id],
-                        grad[jj],
-                        _pvar[jj],
-                        &pjf_up);
+        if (tesqck <= 0. || testij <= 0.) {
 
-          cs_real_t hybrid_blend_interp
-            = cs_math_fmin(hybrid_blend[ii], hybrid_blend[jj]);
+          cs_blend_f_val(blend_st, _pvar[ii], &pif);
+          cs_blend_f_val(blend_st, _pvar[jj], &pjf);
 
-          pif = hybrid_blend_interp*pif + (1. - hybrid_blend_interp)*pif_up;
-          pjf = hybrid_blend_interp*pjf + (1. - hybrid_blend_interp)*pjf_up;
+          upwind_switch = true;
 
         }
 
         /* Blending
            -------- */
 
-        pif = beta * pif + (1. - beta) * _pvar[ii];
-        pjf = beta * pjf + (1. - beta) * _pvar[jj];
+        cs_blend_f_val(blencp, _pvar[ii], &pif);
+        cs_blend_f_val(blencp, _pvar[jj], &pjf);
 
       }
-      else if (ischcp == 4) {
+      else { /* If iconv=0 p*fr* are useless */
 
-        /* NVD/TVD family of high accuracy schemes */
+        pif = _pvar[ii];
+        pjf = _pvar[jj];
 
-        cs_lnum_t ic, id;
-
-        /* Determine central and downwind sides w.r.t. current face */
-        if (i_massflux[face_id] >= 0.) {
-          ic = ii;
-          id = jj;
-        } else {
-          ic = jj;
-          id = ii;
-        }
-
-        cs_real_t courant_c = -1.;
-        if (courant != NULL && is_thermal == false)
-          courant_c = courant[ic];
-
-        cs_i_cd_unsteady_nvd(limiter_choice,
-                             beta,
-                             cell_cen[ic],
-                             cell_cen[id],
-                             i_face_u_normal[face_id],
-                             i_face_cog[face_id],
-                             grad[ic],
-                             _pvar[ic],
-                             _pvar[id],
-                             local_max[ic],
-                             local_min[ic],
-                             courant_c,
-                             &pif,
-                             &pjf);
-
-      }
-
-      // Convective flux
-
-      if (iconvp == 1) {
-        cs_real_t _i_massflux = i_massflux[face_id];
-        cs_real_t flui = 0.5*(_i_massflux + cs_math_fabs(_i_massflux));
-        cs_real_t fluj = 0.5*(_i_massflux - cs_math_fabs(_i_massflux));
-
-        fluxi += cpi*(  thetap*(flui*pif + fluj*pjf)
-                      - imasac*_i_massflux*_pvar[ii]);
-
-        fluxj += cpj*(  thetap*(flui*pif + fluj*pjf)
-                      - imasac*_i_massflux*_pvar[jj]);
-
-      }
-
-      // Diffusive flux (no relaxation)
-
-      cs_real_t diff_contrib = idiffp*thetap*i_visc[face_id]*(pip - pjp);
-      fluxi += diff_contrib;
-      fluxj += diff_contrib;
-
-      if (ii < n_cells)
-        cs_dispatch_sum(&rhs[ii], -fluxi, i_sum_type);
-      if (jj < n_cells)
-        cs_dispatch_sum(&rhs[jj],  fluxj, i_sum_type);
-
-    });
-
-  /* --> Flux with slope test
-     ============================================*/
-
-  }
-  else { /* isstpp = 0 */
-
-    if (ischcp < 0 || ischcp > 2) {
-      bft_error(__FILE__, __LINE__, 0,
-                _("invalid value of ischcv"));
-    }
-
-    ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
-
-      cs_lnum_t ii = i_face_cells[face_id][0];
-      cs_lnum_t jj = i_face_cells[face_id][1];
-
-      cs_real_t cpi = 1., cpj = 1.;
-      if (is_thermal) {
-        cpi = xcpp[ii];
-        cpj = xcpp[jj];
-      }
-
-      bool upwind_switch = false;
-
-      cs_real_t fluxi = 0., fluxj = 0.;
-
-      cs_real_t pif, pjf;
-      cs_real_t pip, pjp;
-
-      if (ircflp == 1) {
-        cs_real_t bldfrp = 1.;
-        if (df_limiter != NULL)  /* Local limiter */
-          bldfrp = cs_math_fmax(cs_math_fmin(df_limiter[ii], df_limiter[jj]),
-                                0.);
-
-        cs_real_t recoi, recoj;
-        cs_i_compute_quantities(bldfrp,
-                                diipf[face_id], djjpf[face_id],
-                                grad[ii], grad[jj],
-                                _pvar[ii], _pvar[jj],
-                                &recoi, &recoj,
-                                &pip, &pjp);
-      }
-      else {
-        pip = _pvar[ii];
-        pjp = _pvar[jj];
-      }
-
-      const cs_real_t *cell_ceni = cell_cen[ii];
-      const cs_real_t *cell_cenj = cell_cen[jj];
-      const cs_real_t w_f = weight[face_id];
-
-      /* Slope test is needed with convection */
-      if (iconvp > 0) {
-        cs_real_t testij, tesqck;
-
-        cs_slope_test(_pvar[ii],
-                      _pvar[jj],
-                      i_dist[face_id],
-                      i_face_u_normal[face_id],
-                      grad[ii],
-                      grad[jj],
-                      gradst[ii],
-                      gradst[jj],
-                      i_massflux[face_id],
-                      &testij,
-                      &tesqck);
-
-        if (ischcp == 0) {
-
-          /* Original SOLU
-             --------------*/
-
-          cs_solu_f_val(cell_ceni,
-                        i_face_cog[face_id],
-                        grad[ii],
-                        _pvar[ii],
-                        &pif);
-          cs_solu_f_val(cell_cenj,
-                        i_face_cog[face_id],
-                        grad[jj],
-                        _pvar[jj],
-                        &pjf);
-        }
-        else if (ischcp == 1) {
-
-          /* Centered
-             --------*/
-
-          pif = w_f*pip + (1.-w_f)*pjp;
-          pjf = pif;
-
-        }
-        else {
-
-          /* SOLU
-             -----*/
-
-          cs_solu_f_val(cell_ceni,
-                        i_face_cog[face_id],
-                        gradup[ii],
-                        _pvar[ii],
-                        &pif);
-          cs_solu_f_val(cell_cenj,
-                        i_face_cog[face_id],
-                        gradup[jj],
-                        _pvar[jj],
-                        &pjf);
-
-        }
-
-        /* Slope test: percentage of upwind
-           -------------------------------- */
-
-        if (tesqck <= 0. || testij <= 0.) {
-
-          cs_blend_f_val(blend_st, _pvar[ii], &pif);
-          cs_blend_f_val(blend_st, _pvar[jj], &pjf);
-
-          upwind_switch = true;
-
-        }
-
-        /* Blending
-           -------- */
-
-        cs_blend_f_val(blencp, _pvar[ii], &pif);
-        cs_blend_f_val(blencp, _pvar[jj], &pjf);
-
-      }
-      else { /* If iconv=0 p*fr* are useless */
-
-        pif = _pvar[ii];
-        pjf = _pvar[jj];
-
-      } /* End for slope test */
+      } /* End for slope test */
 
       // Convective flux
 
@@ -6011,7 +6186,7 @@ _convection_diffusion_tensor_steady(cs_field_t                  *f,
      ======================================================================*/
 
   if (iconvp > 0 && iupwin == 0 && isstpp == 0) {
-    BFT_MALLOC(grdpa, n_cells_ext, cs_real_63_t);
+    CS_SCRATCH_GET(grdpa, n_cells_ext, cs_real_63_t);
 
     _slope_test_gradient_strided<6>(ctx,
                                     inc,
@@ -6315,86 +6490,614 @@ _convection_diffusion_tensor_steady(cs_field_t                  *f,
 
         }
       }
-    }
+    }
+
+    if (iwarnp >= 2 && iconvp == 1)
+      cs_parall_counter(&n_upwind, 1);
+
+  } /* iupwin */
+
+  if (iwarnp >= 2 && iconvp == 1)
+    bft_printf(_(" %s: %llu Faces with upwind on %llu interior faces\n"),
+               var_name, (unsigned long long)n_upwind,
+               (unsigned long long)m->n_g_i_c_faces);
+
+  /* ======================================================================
+     Contribution from boundary faces
+     ======================================================================*/
+
+  /* Boundary convective flux are all computed with an upwind scheme */
+  if (icvflb == 0) {
+
+#   pragma omp parallel for if(m->n_b_faces > CS_THR_MIN)
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+      for (cs_lnum_t face_id = b_group_index[t_id*2];
+           face_id < b_group_index[t_id*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = b_face_cells[face_id];
+
+        double fluxi[6] ;
+        for (int isou =  0; isou < 6; isou++) {
+          fluxi[isou] = 0;
+        }
+        cs_real_t pir[6], pipr[6], pfac[6];
+
+        cs_real_t bldfrp = (cs_real_t) ircflp;
+        /* Local limitation of the reconstruction */
+        if (df_limiter != NULL && ircflp > 0)
+          bldfrp = cs_math_fmax(df_limiter[ii], 0.);
+
+        cs_b_cd_steady_strided<6>(bldfrp,
+                                  relaxp,
+                                  diipb[face_id],
+                                  (const cs_real_3_t *)grad[ii],
+                                  _pvar[ii],
+                                  pvara[ii],
+                                  pir,
+                                  pipr);
+
+        cs_b_upwind_flux_strided<6>(iconvp,
+                                    1., /* thetap */
+                                    1, /* imasac */
+                                    inc,
+                                    bc_type[face_id],
+                                    _pvar[ii],
+                                    pir,
+                                    pipr,
+                                    coefa[face_id],
+                                    coefb[face_id],
+                                    b_massflux[face_id],
+                                    pfac,
+                                    fluxi);
+
+        cs_b_diff_flux_strided<6>(idiffp,
+                                  1., /* thetap */
+                                  inc,
+                                  pipr,
+                                  cofaf[face_id],
+                                  cofbf[face_id],
+                                  b_visc[face_id],
+                                  fluxi);
+
+        for (int isou = 0; isou < 6; isou++) {
+          rhs[ii][isou] -= fluxi[isou];
+        }
+      }
+    }
+
+  }
+
+  /* Free memory */
+  CS_SCRATCH_RELEASE(grdpa);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute convection/diffusion fluxes at interior faces for a strided
+ * field, without slope test.
+ *
+ * As for the scalar variant, the convection scheme is a template parameter,
+ * so each instantiation runs a branch-free face loop specialized for a
+ * single scheme.
+ *
+ * template parameters:
+ * - stride      1 for scalars, 3 for vectors, 6 for symmetric tensors
+ * - porous_vel  account for porous modelling face factors?
+ * - ischcp      convection scheme:
+ *                - 0: legacy SOLU
+ *                - 1: centered
+ *                - 3: centered/SOLU hybrid blending
+ *
+ * \param[in,out] ctx              reference to dispatch context
+ * \param[in]     m                pointer to mesh structure
+ * \param[in]     eqp              equation parameters
+ * \param[in]     imasac           take mass accumulation into account?
+ * \param[in]     _pvar            solved variable (synchronized)
+ * \param[in]     i_massflux       mass flux at interior faces
+ * \param[in]     i_visc           diffusion coefficient at interior faces
+ * \param[in]     df_limiter       diffusion limiter field values, or NULL
+ * \param[in]     hybrid_blend     hybrid blending field values, or NULL
+ * \param[in]     i_f_face_factor  porous face factors, or NULL
+ * \param[in]     grad             cell gradient
+ * \param[in,out] i_pvar           values at interior faces, or NULL
+ * \param[in]     i_sum_type       interior face sum type
+ * \param[in,out] rhs              right hand side
+ */
+/*----------------------------------------------------------------------------*/
+
+template <cs_lnum_t stride, bool porous_vel, int ischcp>
+static void
+_i_faces_flux_strided_no_slope_test
+  (cs_dispatch_context          &ctx,
+   const cs_mesh_t              *m,
+   const cs_equation_param_t    &eqp,
+   int                           imasac,
+   const cs_real_t             (*restrict _pvar)[stride],
+   const cs_real_t               i_massflux[],
+   const cs_real_t               i_visc[],
+   const cs_real_t    *restrict  df_limiter,
+   const cs_real_t    *restrict  hybrid_blend,
+   const cs_real_2_t  *restrict  i_f_face_factor,
+   const cs_real_t             (*restrict grad)[stride][3],
+   cs_real_t          (*restrict i_pvar)[stride],
+   cs_dispatch_sum_type_t        i_sum_type,
+   cs_real_t          (*restrict rhs)[stride])
+{
+  using var_t = cs_real_t[stride];
+
+  const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
+
+  const int iconvp = eqp.iconv;
+  const int idiffp = eqp.idiff;
+  const int ircflp = eqp.ircflu;
+  const double blencp = eqp.blencv;
+  const double thetap = eqp.theta;
+
+  const cs_lnum_t n_cells = m->n_cells;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict i_face_u_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_u_normal;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)fvq->i_face_cog;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *restrict)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *restrict)fvq->djjpf;
+
+  ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
+
+    cs_lnum_t ii = i_face_cells[face_id][0];
+    cs_lnum_t jj = i_face_cells[face_id][1];
+
+    cs_real_t fluxi[stride], fluxj[stride] ;
+    for (cs_lnum_t isou =  0; isou < stride; isou++) {
+      fluxi[isou] = 0;
+      fluxj[isou] = 0;
+    }
+
+    cs_real_t pip[stride], pjp[stride];
+    cs_real_t pif[stride], pjf[stride];
+    cs_real_t _pi[stride], _pj[stride];
+
+    const var_t &pvar_i = _pvar[ii];
+    const var_t &pvar_j = _pvar[jj];
+
+    for (int i = 0; i < stride; i++) {
+      _pi[i]  = _pvar[ii][i];
+      _pj[i]  = _pvar[jj][i];
+    }
+
+    /* Scaling due to mass balance in porous modelling */
+    if (porous_vel) {
+      const cs_real_t *n = i_face_u_normal[face_id];
+      cs_math_3_normal_scaling(n, i_f_face_factor[face_id][0], _pi);
+      cs_math_3_normal_scaling(n, i_f_face_factor[face_id][1], _pj);
+    }
+
+    if (ircflp == 1) {
+      cs_real_t bldfrp = 1.;
+      if (df_limiter != NULL)  /* Local limiter */
+        bldfrp = cs_math_fmax(cs_math_fmin(df_limiter[ii], df_limiter[jj]),
+                              0.);
+
+      cs_real_t recoi[stride], recoj[stride];
+      cs_i_compute_quantities_strided<stride>(bldfrp,
+                                              diipf[face_id], djjpf[face_id],
+                                              grad[ii], grad[jj],
+                                              _pi, _pj,
+                                              recoi, recoj,
+                                              pip, pjp);
+    }
+    else {
+      for (cs_lnum_t isou = 0; isou < stride; isou++) {
+        pip[isou] = _pi[isou];
+        pjp[isou] = _pj[isou];
+      }
+    }
+
+    const cs_real_t *cell_ceni = cell_cen[ii];
+    const cs_real_t *cell_cenj = cell_cen[jj];
+    const cs_real_t w_f = weight[face_id];
+
+    if (ischcp == 1) {
+
+      /* Centered
+         --------*/
+
+      for (cs_lnum_t isou = 0; isou < stride; isou++) {
+        pif[isou] = w_f*pip[isou] + (1.-w_f)*pjp[isou];
+        pjf[isou] = pif[isou];
+      }
+
+    }
+    else if (ischcp == 3) {
+
+      cs_real_t hybrid_blend_interp
+        = fmin(hybrid_blend[ii], hybrid_blend[jj]);
+
+      /* Centered
+         -------- */
+
+      for (cs_lnum_t isou = 0; isou < stride; isou++) {
+        pif[isou] = w_f*pip[isou] + (1.-w_f)*pjp[isou];
+        pjf[isou] = pif[isou];
+      }
+
+      /* SOLU
+         -----*/
+      cs_real_t pif_up[stride], pjf_up[stride];
+
+      cs_solu_f_val_strided<stride>(cell_ceni,
+                                    i_face_cog[face_id],
+                                    grad[ii],
+                                    _pi,
+                                    pif_up);
+      cs_solu_f_val_strided<stride>(cell_cenj,
+                                    i_face_cog[face_id],
+                                    grad[jj],
+                                    _pj,
+                                    pjf_up);
+
+      for (cs_lnum_t isou = 0; isou < stride; isou++) {
+        pif[isou] =         hybrid_blend_interp *pif[isou]
+                    + (1. - hybrid_blend_interp)*pif_up[isou];
+        pjf[isou] =         hybrid_blend_interp *pjf[isou]
+                    + (1. - hybrid_blend_interp)*pjf_up[isou];
+      }
+    }
+    else {
+
+      /* Second order
+         ------------*/
+
+      cs_solu_f_val_strided<stride>(cell_ceni,
+                                    i_face_cog[face_id],
+                                    grad[ii],
+                                    _pi,
+                                    pif);
+      cs_solu_f_val_strided<stride>(cell_cenj,
+                                    i_face_cog[face_id],
+                                    grad[jj],
+                                    _pj,
+                                    pjf);
+
+    }
+
+    /* Blending
+       --------*/
+
+    for (cs_lnum_t isou = 0; isou < stride; isou++) {
+      pif[isou] = blencp*(pif[isou])+(1.-blencp)*_pi[isou];
+      pjf[isou] = blencp*(pjf[isou])+(1.-blencp)*_pj[isou];
+    }
+
+    // Convective flux
+
+    if (iconvp) {
+      cs_real_t _i_massflux = i_massflux[face_id];
+      cs_real_t flui = 0.5*(_i_massflux + cs_math_fabs(_i_massflux));
+      cs_real_t fluj = 0.5*(_i_massflux - cs_math_fabs(_i_massflux));
+
+      for (cs_lnum_t isou = 0; isou < stride; isou++) {
+        fluxi[isou] +=   thetap*(flui*pif[isou] + fluj*pjf[isou])
+                       - imasac*_i_massflux*pvar_i[isou];
+        fluxj[isou] +=   thetap*(flui*pif[isou] + fluj*pjf[isou])
+                       - imasac*_i_massflux*pvar_j[isou];
+      }
+    }
+
+    // Diffusive flux
+
+    cs_real_t t_i_visc = idiffp * i_visc[face_id] * thetap;
+    for (cs_lnum_t isou = 0; isou < stride; isou++) {
+      fluxi[isou] += t_i_visc*(pip[isou] -pjp[isou]);
+      fluxj[isou] += t_i_visc*(pip[isou] -pjp[isou]);
+    }
+
+    /* Save values at internal faces, if needed */
+    if (i_pvar != NULL) {
+      if (i_massflux[face_id] >= 0.) {
+        for (cs_lnum_t i = 0; i < stride; i++)
+          i_pvar[face_id][i] += thetap * pif[i];
+      }
+      else {
+        for (cs_lnum_t i = 0; i < stride; i++)
+          i_pvar[face_id][i] += thetap * pjf[i];
+      }
+    }
+
+    for (cs_lnum_t isou = 0; isou < stride; isou++)
+      fluxi[isou] *= -1;  /* For substraction in dispatch sum */
+
+    if (ii < n_cells)
+      cs_dispatch_sum<stride>(rhs[ii], fluxi, i_sum_type);
+    if (jj < n_cells)
+      cs_dispatch_sum<stride>(rhs[jj], fluxj, i_sum_type);
+  });
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute convection/diffusion fluxes at interior faces for a strided
+ * field, with slope test.
+ *
+ * As for the scalar variant, the convection scheme is a template parameter,
+ * so each instantiation runs a face loop specialized for a single scheme;
+ * only the solution-dependent upwind switch remains per face.
+ *
+ * template parameters:
+ * - stride      1 for scalars, 3 for vectors, 6 for symmetric tensors
+ * - porous_vel  account for porous modelling face factors?
+ * - ischcp      convection scheme:
+ *                - 0: legacy SOLU
+ *                - 1: centered
+ *
+ * \param[in,out] ctx              reference to dispatch context
+ * \param[in]     m                pointer to mesh structure
+ * \param[in]     eqp              equation parameters
+ * \param[in]     imasac           take mass accumulation into account?
+ * \param[in]     _pvar            solved variable (synchronized)
+ * \param[in]     i_massflux       mass flux at interior faces
+ * \param[in]     i_visc           diffusion coefficient at interior faces
+ * \param[in]     df_limiter       diffusion limiter field values, or NULL
+ * \param[in]     i_f_face_factor  porous face factors, or NULL
+ * \param[in]     grad             cell gradient
+ * \param[in]     grdpa            upwind gradient for the slope test
+ * \param[in,out] i_pvar           values at interior faces, or NULL
+ * \param[in,out] i_upwind         per-face upwind switch marker, or NULL
+ * \param[in,out] v_slope_test     slope test postprocessing field, or NULL
+ * \param[in]     i_sum_type       interior face sum type
+ * \param[in,out] rhs              right hand side
+ */
+/*----------------------------------------------------------------------------*/
+
+template <cs_lnum_t stride, bool porous_vel, int ischcp>
+static void
+_i_faces_flux_strided_slope_test
+  (cs_dispatch_context          &ctx,
+   const cs_mesh_t              *m,
+   const cs_equation_param_t    &eqp,
+   int                           imasac,
+   const cs_real_t             (*restrict _pvar)[stride],
+   const cs_real_t               i_massflux[],
+   const cs_real_t               i_visc[],
+   const cs_real_t    *restrict  df_limiter,
+   const cs_real_2_t  *restrict  i_f_face_factor,
+   const cs_real_t             (*restrict grad)[stride][3],
+   const cs_real_t             (*restrict grdpa)[stride][3],
+   cs_real_t          (*restrict i_pvar)[stride],
+   short              *restrict  i_upwind,
+   cs_real_t          *restrict  v_slope_test,
+   cs_dispatch_sum_type_t        i_sum_type,
+   cs_real_t          (*restrict rhs)[stride])
+{
+  using grad_t = cs_real_t[stride][3];
+  using var_t = cs_real_t[stride];
+
+  const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
+
+  const int iconvp = eqp.iconv;
+  const int idiffp = eqp.idiff;
+  const int ircflp = eqp.ircflu;
+  const double blencp = eqp.blencv;
+  const double blend_st = eqp.blend_st;
+  const double thetap = eqp.theta;
+
+  const cs_lnum_t n_cells = m->n_cells;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_t *restrict i_dist = fvq->i_dist;
+  const cs_real_t *restrict cell_vol = fvq->cell_vol;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict i_face_u_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_u_normal;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)fvq->i_face_cog;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *restrict)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *restrict)fvq->djjpf;
+
+  ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
+
+    cs_lnum_t ii = i_face_cells[face_id][0];
+    cs_lnum_t jj = i_face_cells[face_id][1];
+
+    cs_real_t fluxi[stride], fluxj[stride] ;
+    for (cs_lnum_t isou =  0; isou < stride; isou++) {
+      fluxi[isou] = 0;
+      fluxj[isou] = 0;
+    }
+    cs_real_t pip[stride], pjp[stride];
+    cs_real_t pif[stride], pjf[stride];
+    bool upwind_switch = false;
+    cs_real_t _pi[stride], _pj[stride];
+
+    const var_t &pvar_i = _pvar[ii];
+    const var_t &pvar_j = _pvar[jj];
+
+    for (int i = 0; i < stride; i++) {
+      _pi[i]  = _pvar[ii][i];
+      _pj[i]  = _pvar[jj][i];
+    }
+
+    /* Scaling due to mass balance in porous modelling */
+    if (porous_vel) {
+      const cs_real_t *n = i_face_u_normal[face_id];
+      cs_math_3_normal_scaling(n, i_f_face_factor[face_id][0], _pi);
+      cs_math_3_normal_scaling(n, i_f_face_factor[face_id][1], _pj);
+    }
+
+    if (ircflp == 1) {
+      cs_real_t bldfrp = 1.;
+      if (df_limiter != NULL)  /* Local limiter */
+        bldfrp = cs_math_fmax(cs_math_fmin(df_limiter[ii], df_limiter[jj]),
+                              0.);
+
+      cs_real_t recoi[stride], recoj[stride];
+      cs_i_compute_quantities_strided<stride>(bldfrp,
+                                              diipf[face_id], djjpf[face_id],
+                                              grad[ii], grad[jj],
+                                              _pi, _pj,
+                                              recoi, recoj,
+                                              pip, pjp);
+    }
+    else {
+      for (cs_lnum_t isou = 0; isou < stride; isou++) {
+        pip[isou] = _pi[isou];
+        pjp[isou] = _pj[isou];
+      }
+    }
+
+    const cs_real_t *cell_ceni = cell_cen[ii];
+    const cs_real_t *cell_cenj = cell_cen[jj];
+    const cs_real_t w_f = weight[face_id];
+
+    /* Slope test is needed with convection */
+    if (iconvp > 0) {
+      cs_real_t testij, tesqck;
+
+      const grad_t &gradi = grad[ii];
+      const grad_t &gradj = grad[jj];
+
+      cs_slope_test_strided<stride>(_pi, _pj,
+                                    i_dist[face_id],
+                                    i_face_u_normal[face_id],
+                                    gradi, gradj,
+                                    grdpa[ii], grdpa[jj],
+                                    i_massflux[face_id],
+                                    &testij, &tesqck);
+
+      for (cs_lnum_t isou = 0; isou < stride; isou++) {
+
+        if (ischcp == 1) {
+
+          /* Centered
+             --------*/
+
+          cs_centered_f_val(w_f,
+                            pip[isou], pjp[isou],
+                            &pif[isou]);
+          cs_centered_f_val(w_f,
+                            pip[isou], pjp[isou],
+                            &pjf[isou]);
+
+        }
+        else {
+
+          /* Second order
+             ------------*/
+
+          cs_solu_f_val(cell_ceni,
+                        i_face_cog[face_id],
+                        gradi[isou],
+                        _pi[isou],
+                        &pif[isou]);
+          cs_solu_f_val(cell_cenj,
+                        i_face_cog[face_id],
+                        gradj[isou],
+                        _pj[isou],
+                        &pjf[isou]);
+        }
+
+      }
 
-    if (iwarnp >= 2 && iconvp == 1)
-      cs_parall_counter(&n_upwind, 1);
+      /* Slope test activated: percentage of upwind */
+      if (tesqck <= 0. || testij <= 0.) {
 
-  } /* iupwin */
+        /* Upwind
+           ------ */
 
-  if (iwarnp >= 2 && iconvp == 1)
-    bft_printf(_(" %s: %llu Faces with upwind on %llu interior faces\n"),
-               var_name, (unsigned long long)n_upwind,
-               (unsigned long long)m->n_g_i_c_faces);
+        cs_blend_f_val_strided<stride>(blend_st, _pi, pif);
+        cs_blend_f_val_strided<stride>(blend_st, _pj, pjf);
 
-  /* ======================================================================
-     Contribution from boundary faces
-     ======================================================================*/
+        upwind_switch = true;
+      }
 
-  /* Boundary convective flux are all computed with an upwind scheme */
-  if (icvflb == 0) {
+      /* Blending
+         -------- */
 
-#   pragma omp parallel for if(m->n_b_faces > CS_THR_MIN)
-    for (int t_id = 0; t_id < n_b_threads; t_id++) {
-      for (cs_lnum_t face_id = b_group_index[t_id*2];
-           face_id < b_group_index[t_id*2 + 1];
-           face_id++) {
+      cs_blend_f_val_strided<stride>(blencp, _pi, pif);
+      cs_blend_f_val_strided<stride>(blencp, _pj, pjf);
 
-        cs_lnum_t ii = b_face_cells[face_id];
+    }
+    else { /* If iconv=0 p*fr* are useless */
 
-        double fluxi[6] ;
-        for (int isou =  0; isou < 6; isou++) {
-          fluxi[isou] = 0;
-        }
-        cs_real_t pir[6], pipr[6], pfac[6];
+      for (cs_lnum_t isou = 0; isou < stride; isou++) {
+        pif[isou] = _pi[isou];
+        pjf[isou] = _pj[isou];
+      }
 
-        cs_real_t bldfrp = (cs_real_t) ircflp;
-        /* Local limitation of the reconstruction */
-        if (df_limiter != NULL && ircflp > 0)
-          bldfrp = cs_math_fmax(df_limiter[ii], 0.);
+    } /* End for slope test */
 
-        cs_b_cd_steady_strided<6>(bldfrp,
-                                  relaxp,
-                                  diipb[face_id],
-                                  (const cs_real_3_t *)grad[ii],
-                                  _pvar[ii],
-                                  pvara[ii],
-                                  pir,
-                                  pipr);
+    // Convective flux
 
-        cs_b_upwind_flux_strided<6>(iconvp,
-                                    1., /* thetap */
-                                    1, /* imasac */
-                                    inc,
-                                    bc_type[face_id],
-                                    _pvar[ii],
-                                    pir,
-                                    pipr,
-                                    coefa[face_id],
-                                    coefb[face_id],
-                                    b_massflux[face_id],
-                                    pfac,
-                                    fluxi);
+    if (iconvp) {
+      cs_real_t _i_massflux = i_massflux[face_id];
+      cs_real_t flui = 0.5*(_i_massflux + cs_math_fabs(_i_massflux));
+      cs_real_t fluj = 0.5*(_i_massflux - cs_math_fabs(_i_massflux));
 
-        cs_b_diff_flux_strided<6>(idiffp,
-                                  1., /* thetap */
-                                  inc,
-                                  pipr,
-                                  cofaf[face_id],
-                                  cofbf[face_id],
-                                  b_visc[face_id],
-                                  fluxi);
+      for (cs_lnum_t isou = 0; isou < stride; isou++) {
+        fluxi[isou] +=   thetap*(flui*pif[isou] + fluj*pjf[isou])
+                       - imasac*_i_massflux*pvar_i[isou];
+        fluxj[isou] +=   thetap*(flui*pif[isou] + fluj*pjf[isou])
+                       - imasac*_i_massflux*pvar_j[isou];
+      }
+    }
 
-        for (int isou = 0; isou < 6; isou++) {
-          rhs[ii][isou] -= fluxi[isou];
-        }
+    // Diffusive flux
+
+    cs_real_t t_i_visc = idiffp * i_visc[face_id] * thetap;
+    for (cs_lnum_t isou = 0; isou < stride; isou++) {
+      fluxi[isou] += t_i_visc*(pip[isou] -pjp[isou]);
+      fluxj[isou] += t_i_visc*(pip[isou] -pjp[isou]);
+    }
+
+    if (upwind_switch) {
+      /* in parallel, face will be counted by one and only one rank */
+      if (i_upwind != nullptr && ii < n_cells) {
+        i_upwind[face_id] = 1;
+      }
+
+      if (v_slope_test != NULL) {
+        cs_dispatch_sum(&v_slope_test[ii],
+                        std::abs(i_massflux[face_id]) / cell_vol[ii],
+                        i_sum_type);
+        cs_dispatch_sum(&v_slope_test[jj],
+                        std::abs(i_massflux[face_id]) / cell_vol[jj],
+                        i_sum_type);
       }
     }
 
-  }
+    /* Save values at internal faces, if needed */
+    if (i_pvar != NULL) {
+      if (i_massflux[face_id] >= 0.) {
+        for (cs_lnum_t i = 0; i < stride; i++)
+          i_pvar[face_id][i] += thetap * pif[i];
+      }
+      else {
+        for (cs_lnum_t i = 0; i < stride; i++)
+          i_pvar[face_id][i] += thetap * pjf[i];
+      }
+    }
 
-  /* Free memory */
-  BFT_FREE(grdpa);
+    for (cs_lnum_t isou = 0; isou < stride; isou++)
+      fluxi[isou] *= -1;  /* For substraction in dispatch sum */
+
+    if (ii < n_cells)
+      cs_dispatch_sum<stride>(rhs[ii], fluxi, i_sum_type);
+    if (jj < n_cells)
+      cs_dispatch_sum<stride>(rhs[jj], fluxj, i_sum_type);
+  });
 }
 
 /*----------------------------------------------------------------------------*/
@@ -6766,180 +7469,24 @@ _convection_diffusion_unsteady_strided
 
     switch(ischcp) {
     case 0:
-      [[fallthrough]];
-    case 1:
-      [[fallthrough]];
-    case 3:
-      ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
-
-        cs_lnum_t ii = i_face_cells[face_id][0];
-        cs_lnum_t jj = i_face_cells[face_id][1];
-
-        cs_real_t fluxi[stride], fluxj[stride] ;
-        for (cs_lnum_t isou =  0; isou < stride; isou++) {
-          fluxi[isou] = 0;
-          fluxj[isou] = 0;
-        }
-
-        cs_real_t pip[stride], pjp[stride];
-        cs_real_t pif[stride], pjf[stride];
-        cs_real_t _pi[stride], _pj[stride];
-
-        const var_t &pvar_i = _pvar[ii];
-        const var_t &pvar_j = _pvar[jj];
-
-        for (int i = 0; i < stride; i++) {
-          _pi[i]  = _pvar[ii][i];
-          _pj[i]  = _pvar[jj][i];
-        }
-
-        /* Scaling due to mass balance in porous modelling */
-        if (porous_vel) {
-          const cs_real_t *n = i_face_u_normal[face_id];
-          cs_math_3_normal_scaling(n, i_f_face_factor[face_id][0], _pi);
-          cs_math_3_normal_scaling(n, i_f_face_factor[face_id][1], _pj);
-        }
-
-        if (ircflp == 1) {
-          cs_real_t bldfrp = 1.;
-          if (df_limiter != NULL)  /* Local limiter */
-            bldfrp = cs_math_fmax(cs_math_fmin(df_limiter[ii], df_limiter[jj]),
-                                  0.);
-
-          cs_real_t recoi[stride], recoj[stride];
-          cs_i_compute_quantities_strided<stride>(bldfrp,
-                                                  diipf[face_id], djjpf[face_id],
-                                                  grad[ii], grad[jj],
-                                                  _pi, _pj,
-                                                  recoi, recoj,
-                                                  pip, pjp);
-        }
-        else {
-          for (cs_lnum_t isou = 0; isou < stride; isou++) {
-            pip[isou] = _pi[isou];
-            pjp[isou] = _pj[isou];
-          }
-        }
-
-        const cs_real_t *cell_ceni = cell_cen[ii];
-        const cs_real_t *cell_cenj = cell_cen[jj];
-        const cs_real_t w_f = weight[face_id];
-
-        if (ischcp == 1) {
-
-          /* Centered
-             --------*/
-
-          for (cs_lnum_t isou = 0; isou < stride; isou++) {
-            pif[isou] = w_f*pip[isou] + (1.-w_f)*pjp[isou];
-            pjf[isou] = pif[isou];
-          }
-
-        }
-        else if (ischcp == 3) {
-
-          cs_real_t hybrid_blend_interp
-            = fmin(hybrid_blend[ii], hybrid_blend[jj]);
-
-          /* Centered
-             -------- */
-
-          for (cs_lnum_t isou = 0; isou < stride; isou++) {
-            pif[isou] = w_f*pip[isou] + (1.-w_f)*pjp[isou];
-            pjf[isou] = pif[isou];
-          }
-
-          /* SOLU
-             -----*/
-          cs_real_t pif_up[stride], pjf_up[stride];
-
-          cs_solu_f_val_strided<stride>(cell_ceni,
-                                        i_face_cog[face_id],
-                                        grad[ii],
-                                        _pi,
-                                        pif_up);
-          cs_solu_f_val_strided<stride>(cell_cenj,
-                                        i_face_cog[face_id],
-                                        grad[jj],
-                                        _pj,
-                                        pjf_up);
-
-          for (cs_lnum_t isou = 0; isou < stride; isou++) {
-            pif[isou] =         hybrid_blend_interp *pif[isou]
-                        + (1. - hybrid_blend_interp)*pif_up[isou];
-            pjf[isou] =         hybrid_blend_interp *pjf[isou]
-                        + (1. - hybrid_blend_interp)*pjf_up[isou];
-          }
-        }
-        else {
-
-          /* Second order
-             ------------*/
-
-          cs_solu_f_val_strided<stride>(cell_ceni,
-                                        i_face_cog[face_id],
-                                        grad[ii],
-                                        _pi,
-                                        pif);
-          cs_solu_f_val_strided<stride>(cell_cenj,
-                                        i_face_cog[face_id],
-                                        grad[jj],
-                                        _pj,
-                                        pjf);
-
-        }
-
-        /* Blending
-           --------*/
-
-        for (cs_lnum_t isou = 0; isou < stride; isou++) {
-          pif[isou] = blencp*(pif[isou])+(1.-blencp)*_pi[isou];
-          pjf[isou] = blencp*(pjf[isou])+(1.-blencp)*_pj[isou];
-        }
-
-        // Convective flux
-
-        if (iconvp) {
-          cs_real_t _i_massflux = i_massflux[face_id];
-          cs_real_t flui = 0.5*(_i_massflux + cs_math_fabs(_i_massflux));
-          cs_real_t fluj = 0.5*(_i_massflux - cs_math_fabs(_i_massflux));
-
-          for (cs_lnum_t isou = 0; isou < stride; isou++) {
-            fluxi[isou] +=   thetap*(flui*pif[isou] + fluj*pjf[isou])
-                           - imasac*_i_massflux*pvar_i[isou];
-            fluxj[isou] +=   thetap*(flui*pif[isou] + fluj*pjf[isou])
-                           - imasac*_i_massflux*pvar_j[isou];
-          }
-        }
-
-        // Diffusive flux
-
-        cs_real_t t_i_visc = idiffp * i_visc[face_id] * thetap;
-        for (cs_lnum_t isou = 0; isou < stride; isou++) {
-          fluxi[isou] += t_i_visc*(pip[isou] -pjp[isou]);
-          fluxj[isou] += t_i_visc*(pip[isou] -pjp[isou]);
-        }
-
-        /* Save values at internal faces, if needed */
-        if (i_pvar != NULL) {
-          if (i_massflux[face_id] >= 0.) {
-            for (cs_lnum_t i = 0; i < stride; i++)
-              i_pvar[face_id][i] += thetap * pif[i];
-          }
-          else {
-            for (cs_lnum_t i = 0; i < stride; i++)
-              i_pvar[face_id][i] += thetap * pjf[i];
-          }
-        }
+      _i_faces_flux_strided_no_slope_test<stride, porous_vel, 0>
+        (ctx, m, eqp, imasac, _pvar, i_massflux, i_visc,
+         df_limiter, hybrid_blend, i_f_face_factor,
+         (const grad_t *)grad, i_pvar, i_sum_type, rhs);
+      break;
 
-        for (cs_lnum_t isou = 0; isou < stride; isou++)
-          fluxi[isou] *= -1;  /* For substraction in dispatch sum */
+    case 1:
+      _i_faces_flux_strided_no_slope_test<stride, porous_vel, 1>
+        (ctx, m, eqp, imasac, _pvar, i_massflux, i_visc,
+         df_limiter, hybrid_blend, i_f_face_factor,
+         (const grad_t *)grad, i_pvar, i_sum_type, rhs);
+      break;
 
-        if (ii < n_cells)
-          cs_dispatch_sum<stride>(rhs[ii], fluxi, i_sum_type);
-        if (jj < n_cells)
-          cs_dispatch_sum<stride>(rhs[jj], fluxj, i_sum_type);
-      });
+    case 3:
+      _i_faces_flux_strided_no_slope_test<stride, porous_vel, 3>
+        (ctx, m, eqp, imasac, _pvar, i_massflux, i_visc,
+         df_limiter, hybrid_blend, i_f_face_factor,
+         (const grad_t *)grad, i_pvar, i_sum_type, rhs);
       break;
 
     default:
@@ -6956,199 +7503,19 @@ _convection_diffusion_unsteady_strided
 
     switch(ischcp) {
     case 0:
-      [[fallthrough]];
-    case 1:
-      ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
-
-        cs_lnum_t ii = i_face_cells[face_id][0];
-        cs_lnum_t jj = i_face_cells[face_id][1];
-
-        cs_real_t fluxi[stride], fluxj[stride] ;
-        for (cs_lnum_t isou =  0; isou < stride; isou++) {
-          fluxi[isou] = 0;
-          fluxj[isou] = 0;
-        }
-        cs_real_t pip[stride], pjp[stride];
-        cs_real_t pif[stride], pjf[stride];
-        bool upwind_switch = false;
-        cs_real_t _pi[stride], _pj[stride];
-
-        const var_t &pvar_i = _pvar[ii];
-        const var_t &pvar_j = _pvar[jj];
-
-        for (int i = 0; i < stride; i++) {
-          _pi[i]  = _pvar[ii][i];
-          _pj[i]  = _pvar[jj][i];
-        }
-
-        /* Scaling due to mass balance in porous modelling */
-        if (porous_vel) {
-          const cs_real_t *n = i_face_u_normal[face_id];
-          cs_math_3_normal_scaling(n, i_f_face_factor[face_id][0], _pi);
-          cs_math_3_normal_scaling(n, i_f_face_factor[face_id][1], _pj);
-        }
-
-        if (ircflp == 1) {
-          cs_real_t bldfrp = 1.;
-          if (df_limiter != NULL)  /* Local limiter */
-            bldfrp = cs_math_fmax(cs_math_fmin(df_limiter[ii], df_limiter[jj]),
-                                  0.);
-
-          cs_real_t recoi[stride], recoj[stride];
-          cs_i_compute_quantities_strided<stride>(bldfrp,
-                                                  diipf[face_id], djjpf[face_id],
-                                                  grad[ii], grad[jj],
-                                                  _pi, _pj,
-                                                  recoi, recoj,
-                                                  pip, pjp);
-        }
-        else {
-          for (cs_lnum_t isou = 0; isou < stride; isou++) {
-            pip[isou] = _pi[isou];
-            pjp[isou] = _pj[isou];
-          }
-        }
-
-        const cs_real_t *cell_ceni = cell_cen[ii];
-        const cs_real_t *cell_cenj = cell_cen[jj];
-        const cs_real_t w_f = weight[face_id];
-
-        /* Slope test is needed with convection */
-        if (iconvp > 0) {
-          cs_real_t testij, tesqck;
-
-          const grad_t &gradi = grad[ii];
-          const grad_t &gradj = grad[jj];
-
-          cs_slope_test_strided<stride>(_pi, _pj,
-                                        i_dist[face_id],
-                                        i_face_u_normal[face_id],
-                                        gradi, gradj,
-                                        grdpa[ii], grdpa[jj],
-                                        i_massflux[face_id],
-                                        &testij, &tesqck);
-
-          for (cs_lnum_t isou = 0; isou < stride; isou++) {
-
-            if (ischcp == 1) {
-
-              /* Centered
-                 --------*/
-
-              cs_centered_f_val(w_f,
-                                pip[isou], pjp[isou],
-                                &pif[isou]);
-              cs_centered_f_val(w_f,
-                                pip[isou], pjp[isou],
-                                &pjf[isou]);
-
-            }
-            else {
-
-              /* Second order
-                 ------------*/
-
-              cs_solu_f_val(cell_ceni,
-                            i_face_cog[face_id],
-                            gradi[isou],
-                            _pi[isou],
-                            &pif[isou]);
-              cs_solu_f_val(cell_cenj,
-                            i_face_cog[face_id],
-                            gradj[isou],
-                            _pj[isou],
-                            &pjf[isou]);
-            }
-
-          }
-
-          /* Slope test activated: percentage of upwind */
-          if (tesqck <= 0. || testij <= 0.) {
-
-            /* Upwind
-               ------ */
-
-            cs_blend_f_val_strided<stride>(blend_st, _pi, pif);
-            cs_blend_f_val_strided<stride>(blend_st, _pj, pjf);
-
-            upwind_switch = true;
-          }
-
-          /* Blending
-             -------- */
-
-          cs_blend_f_val_strided<stride>(blencp, _pi, pif);
-          cs_blend_f_val_strided<stride>(blencp, _pj, pjf);
-
-        }
-        else { /* If iconv=0 p*fr* are useless */
-
-          for (cs_lnum_t isou = 0; isou < stride; isou++) {
-            pif[isou] = _pi[isou];
-            pjf[isou] = _pj[isou];
-          }
-
-        } /* End for slope test */
-
-        // Convective flux
-
-        if (iconvp) {
-          cs_real_t _i_massflux = i_massflux[face_id];
-          cs_real_t flui = 0.5*(_i_massflux + cs_math_fabs(_i_massflux));
-          cs_real_t fluj = 0.5*(_i_massflux - cs_math_fabs(_i_massflux));
-
-          for (cs_lnum_t isou = 0; isou < stride; isou++) {
-            fluxi[isou] +=   thetap*(flui*pif[isou] + fluj*pjf[isou])
-                           - imasac*_i_massflux*pvar_i[isou];
-            fluxj[isou] +=   thetap*(flui*pif[isou] + fluj*pjf[isou])
-                           - imasac*_i_massflux*pvar_j[isou];
-          }
-        }
-
-        // Diffusive flux
-
-        cs_real_t t_i_visc = idiffp * i_visc[face_id] * thetap;
-        for (cs_lnum_t isou = 0; isou < stride; isou++) {
-          fluxi[isou] += t_i_visc*(pip[isou] -pjp[isou]);
-          fluxj[isou] += t_i_visc*(pip[isou] -pjp[isou]);
-        }
-
-        if (upwind_switch) {
-          /* in parallel, face will be counted by one and only one rank */
-          if (i_upwind != nullptr && ii < n_cells) {
-            i_upwind[face_id] = 1;
-          }
-
-          if (v_slope_test != NULL) {
-            cs_dispatch_sum(&v_slope_test[ii],
-                            std::abs(i_massflux[face_id]) / cell_vol[ii],
-                            i_sum_type);
-            cs_dispatch_sum(&v_slope_test[jj],
-                            std::abs(i_massflux[face_id]) / cell_vol[jj],
-                            i_sum_type);
-          }
-        }
-
-        /* Save values at internal faces, if needed */
-        if (i_pvar != NULL) {
-          if (i_massflux[face_id] >= 0.) {
-            for (cs_lnum_t i = 0; i < stride; i++)
-              i_pvar[face_id][i] += thetap * pif[i];
-          }
-          else {
-            for (cs_lnum_t i = 0; i < stride; i++)
-              i_pvar[face_id][i] += thetap * pjf[i];
-          }
-        }
-
-        for (cs_lnum_t isou = 0; isou < stride; isou++)
-          fluxi[isou] *= -1;  /* For substraction in dispatch sum */
+      _i_faces_flux_strided_slope_test<stride, porous_vel, 0>
+        (ctx, m, eqp, imasac, _pvar, i_massflux, i_visc,
+         df_limiter, i_f_face_factor,
+         (const grad_t *)grad, (const grad_t *)grdpa,
+         i_pvar, i_upwind, v_slope_test, i_sum_type, rhs);
+      break;
 
-        if (ii < n_cells)
-          cs_dispatch_sum<stride>(rhs[ii], fluxi, i_sum_type);
-        if (jj < n_cells)
-          cs_dispatch_sum<stride>(rhs[jj], fluxj, i_sum_type);
-      });
+    case 1:
+      _i_faces_flux_strided_slope_test<stride, porous_vel, 1>
+        (ctx, m, eqp, imasac, _pvar, i_massflux, i_visc,
+         df_limiter, i_f_face_factor,
+         (const grad_t *)grad, (const grad_t *)grdpa,
+         i_pvar, i_upwind, v_slope_test, i_sum_type, rhs);
       break;
 
     default:
@@ -8667,7 +9034,7 @@ cs_anisotropic_diffusion_scalar(int                         idtvar,
   w2 = NULL;
 
   /* Allocate work arrays */
-  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+  CS_SCRATCH_GET(grad, n_cells_ext, cs_real_3_t);
 
   /* Choose gradient type */
   cs_halo_type_t halo_type = CS_HALO_STANDARD;
@@ -8724,7 +9091,7 @@ cs_anisotropic_diffusion_scalar(int                         idtvar,
     /* With porosity */
   }
   else if (porosi != NULL && porosf == NULL) {
-    BFT_MALLOC(w2, n_cells_ext, cs_real_6_t);
+    CS_SCRATCH_GET(w2, n_cells_ext, cs_real_6_t);
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
       for (int isou = 0; isou < 6; isou++) {
         w2[cell_id][isou] = porosi[cell_id]*viscel[cell_id][isou];
@@ -8735,7 +9102,7 @@ cs_anisotropic_diffusion_scalar(int                         idtvar,
     /* With tensorial porosity */
   }
   else if (porosi != NULL && porosf != NULL) {
-    BFT_MALLOC(w2, n_cells_ext, cs_real_6_t);
+    CS_SCRATCH_GET(w2, n_cells_ext, cs_real_6_t);
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
       cs_math_sym_33_product(porosf[cell_id],
                              viscel[cell_id],
@@ -9274,8 +9641,8 @@ cs_anisotropic_diffusion_scalar(int                         idtvar,
   }
 
   /* Free memory */
-  BFT_FREE(grad);
-  BFT_FREE(w2);
+  CS_SCRATCH_RELEASE(grad);
+  CS_SCRATCH_RELEASE(w2);
 }
 
 /*-----------------------------------------------------------------------------*/
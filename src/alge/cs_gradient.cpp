@@ -130,11 +130,18 @@ typedef struct {
   cs_cocg_6_t   *cocg_lsq;         /* Interleaved cocg matrix
                                       for least square gradients */
 
+  cs_cocg_6_t   *cocgb_i_lsq;      /* inverted cocg at boundary cells,
+                                      including the neutral (coefb=1)
+                                      boundary contribution */
+
   cs_cocg_6_t   *cocgb_s_lsq_ext;  /* coupling of gradient components for
                                       least-square reconstruction at boundary */
   cs_cocg_6_t   *cocg_lsq_ext;     /* Interleaved cocg matrix for least
                                       squares gradients with ext. neighbors */
 
+  cs_cocg_6_t   *cocgb_i_lsq_ext;  /* inverted cocg at boundary cells,
+                                      with ext. neighbors */
+
 } cs_gradient_quantities_t;
 
 /* Basic per gradient computation options and logging */
@@ -251,8 +258,10 @@ _gradient_quantities_get(int  id)
       gq->cocg_it = nullptr;
       gq->cocgb_s_lsq = nullptr;
       gq->cocg_lsq = nullptr;
+      gq->cocgb_i_lsq = nullptr;
       gq->cocgb_s_lsq_ext = nullptr;
       gq->cocg_lsq_ext = nullptr;
+      gq->cocgb_i_lsq_ext = nullptr;
     }
 
     _n_gradient_quantities = id+1;
@@ -278,8 +287,10 @@ _gradient_quantities_destroy(void)
     BFT_FREE(gq->cocg_it);
     BFT_FREE(gq->cocgb_s_lsq);
     BFT_FREE(gq->cocg_lsq);
+    BFT_FREE(gq->cocgb_i_lsq);
     BFT_FREE(gq->cocgb_s_lsq_ext);
     BFT_FREE(gq->cocg_lsq_ext);
+    BFT_FREE(gq->cocgb_i_lsq_ext);
 
   }
 
@@ -725,7 +736,11 @@ _sync_strided_gradient_halo(const cs_mesh_t         *m,
 }
 
 /*----------------------------------------------------------------------------
- * Compute face-based gradient clipping factor based on per-cell factor.
+ * Compute face-based gradient clipping factor based on per-cell factor,
+ * and apply it to the gradient.
+ *
+ * The factor is applied to the gradient in the same blocked sweep as the
+ * neighbor minimum, while the matching cache lines are still resident.
  *
  * parameters:
  *   m              <-- pointer to associated mesh structure
@@ -733,6 +748,8 @@ _sync_strided_gradient_halo(const cs_mesh_t         *m,
  *   halo_type      <-- halo type (extended or not)
  *   factor         <-- per cell input factor
  *   clip_factor    <-> final clip factor (initialized to 1)
+ *   g_stride       <-- number of gradient components per cell (3*stride)
+ *   grad           <-> gradient to limit (interleaved, g_stride per cell)
  *----------------------------------------------------------------------------*/
 
 static void
@@ -740,7 +757,9 @@ _gradient_update_face_clip_factor(const cs_mesh_t              *m,
                                   const cs_mesh_adjacencies_t  *ma,
                                   cs_halo_type_t                halo_type,
                                   cs_real_t           *restrict factor,
-                                  cs_real_t           *restrict clip_factor)
+                                  cs_real_t           *restrict clip_factor,
+                                  cs_lnum_t                     g_stride,
+                                  cs_real_t           *restrict grad)
 {
   const cs_lnum_t n_cells = m->n_cells;
   const int n_adj = (halo_type == CS_HALO_EXTENDED) ? 2 : 1;
@@ -798,6 +817,15 @@ _gradient_update_face_clip_factor(const cs_mesh_t              *m,
 
     } /* End of loop on adjacency type */
 
+    /* Apply factor to gradient (multiplication by 1 is a no-op) */
+
+    for (cs_lnum_t c_id1 = s_id; c_id1 < e_id; c_id1++) {
+      const cs_real_t factor1 = clip_factor[c_id1];
+      cs_real_t *restrict g = grad + c_id1*g_stride;
+      for (cs_lnum_t j = 0; j < g_stride; j++)
+        g[j] *= factor1;
+    }
+
   } /* End of (parallel) loop on blocks */
 }
 
@@ -929,6 +957,10 @@ _scalar_gradient_clipping(const cs_mesh_t              *m,
 
           cs_lnum_t c_id1 = i + s_id;
 
+          const cs_real_t g1[3] = {grad[c_id1][0],
+                                   grad[c_id1][1],
+                                   grad[c_id1][2]};
+
           for (cs_lnum_t cidx = cell_cells_idx[c_id1];
                cidx < cell_cells_idx[c_id1+1];
                cidx++) {
@@ -940,9 +972,9 @@ _scalar_gradient_clipping(const cs_mesh_t              *m,
             for (cs_lnum_t k = 0; k < 3; k++)
               dist[k] = cell_f_cen[c_id1][k] - cell_f_cen[c_id2][k];
 
-            cs_real_t dist1 = std::abs(  dist[0]*grad[c_id1][0]
-                                       + dist[1]*grad[c_id1][1]
-                                       + dist[2]*grad[c_id1][2]);
+            cs_real_t dist1 = std::abs(  dist[0]*g1[0]
+                                       + dist[1]*g1[1]
+                                       + dist[2]*g1[2]);
             cs_real_t dvar = std::abs(pvar[c_id1] - pvar[c_id2]);
 
             denum[i] = std::max(denum[i], dist1);
@@ -954,12 +986,16 @@ _scalar_gradient_clipping(const cs_mesh_t              *m,
 
       } /* End of loop on adjacency type */
 
+      /* Compute and apply clip factor while the gradient block is
+         cache-resident (multiplication by 1 is a no-op) */
+
       for (cs_lnum_t i = 0; i < b_e_id; i++) { /* Loop on block elements */
-        cs_real_t factor1 = 1.;
-        if (denum[i] > climgp * denom[i])
-          factor1 = climgp * denom[i]/denum[i];
+        cs_real_t factor1 = (denum[i] > climgp * denom[i]) ?
+                             climgp * denom[i]/denum[i] : 1.;
 
         clip_factor[s_id + i] = factor1;
+        for (cs_lnum_t j = 0; j < 3; j++)
+          grad[s_id + i][j] *= factor1;
       }
 
     } /* End of (parallel) loop on blocks */
@@ -1052,9 +1088,11 @@ _scalar_gradient_clipping(const cs_mesh_t              *m,
 
     } /* End of (parallel) loop on blocks */
 
-    /* Now compute clip factor (kernel common to scalar and strided clases */
+    /* Now compute clip factor and apply it to the gradient
+       (kernel common to scalar and strided cases) */
 
-    _gradient_update_face_clip_factor(m, ma, halo_type, factor, clip_factor);
+    _gradient_update_face_clip_factor(m, ma, halo_type, factor, clip_factor,
+                                      3, (cs_real_t *)grad);
 
     BFT_FREE(factor);
 
@@ -1066,8 +1104,9 @@ _scalar_gradient_clipping(const cs_mesh_t              *m,
     cs_halo_sync_var(m->halo, halo_type, clip_factor);
   }
 
-  /* Apply clip factor to gradient
-     ----------------------------- */
+  /* The clip factor is applied to the gradient in the loops above;
+     only log statistics if requested here
+     ------------------------------------------------------------- */
 
   if (verbosity > 1) {
 
@@ -1081,13 +1120,8 @@ _scalar_gradient_clipping(const cs_mesh_t              *m,
 
 #   pragma omp parallel for reduction(+:n_clip) if (n_cells > CS_THR_MIN)
     for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-
-      cs_real_t factor1 = clip_factor[c_id];
-      if (factor1 < 1) {
-        for (cs_lnum_t j = 0; j < 3; j++)
-          grad[c_id][j] *= factor1;
+      if (clip_factor[c_id] < 1)
         n_clip += 1;
-      }
     }
 
     cs_real_t buf[2] = {-min_factor, max_factor};
@@ -1107,21 +1141,6 @@ _scalar_gradient_clipping(const cs_mesh_t              *m,
        (unsigned long long)n_clip, min_factor, max_factor, mean_factor);
   }
 
-  else { /* Avoid unneeded reduction if no logging */
-
-#   pragma omp parallel for if (n_cells > CS_THR_MIN)
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-
-      cs_real_t factor1 = clip_factor[c_id];
-      if (factor1 < 1) {
-        for (cs_lnum_t j = 0; j < 3; j++)
-          grad[c_id][j] *= factor1;
-      }
-
-    } /* End of loop on cells */
-
-  }
-
   /* Synchronize the updated Gradient */
 
   if (m->halo != nullptr) {
@@ -2560,6 +2579,28 @@ _compute_cell_cocg_lsq(const cs_mesh_t               *m,
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
     _math_6_inv_cramer_sym_in_place(cocg[c_id]);
   }
+
+  /* Save inverted cocg at boundary cells; as the boundary contribution
+     above matches that of neutral (coefb = 1) boundary coefficients,
+     these values may be reused directly in that common case, rather
+     than recomputed and re-inverted per variable. */
+
+  cs_cocg_6_t *cocgb_i = (extended) ? gq->cocgb_i_lsq_ext : gq->cocgb_i_lsq;
+
+  if (cocgb_i == nullptr) {
+    BFT_MALLOC(cocgb_i, m->n_b_cells, cs_cocg_6_t);
+    if (extended)
+      gq->cocgb_i_lsq_ext = cocgb_i;
+    else
+      gq->cocgb_i_lsq = cocgb_i;
+  }
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
+    cs_lnum_t c_id = m->b_cells[ii];
+    for (cs_lnum_t ll = 0; ll < 6; ll++)
+      cocgb_i[ii][ll] = cocg[c_id][ll];
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -2661,6 +2702,7 @@ _get_cell_cocg_lsq(const cs_mesh_t               *m,
  * parameters:
  *   m              <-- pointer to associated mesh structure
  *   fvq            <-- pointer to associated finite volume quantities
+ *   halo_type      <-- halo type (extended or not)
  *   bc_coeffs      <-- B.C. structure for boundary face normals
  *   cocgb          <-- saved B.C. coefficients for boundary cells
  *   cocgb          <-> B.C. coefficients, updated at boundary cells
@@ -2669,12 +2711,48 @@ _get_cell_cocg_lsq(const cs_mesh_t               *m,
 static void
 _recompute_lsq_scalar_cocg(const cs_mesh_t                *m,
                            const cs_mesh_quantities_t     *fvq,
+                           cs_halo_type_t                  halo_type,
                            const cs_field_bc_coeffs_t     *bc_coeffs,
                            const cs_cocg_t                 cocgb[restrict][6],
                            cs_cocg_t                       cocg[restrict][6])
 {
   const cs_real_t *coefbp = bc_coeffs->b;
   const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+
+  /* With neutral boundary coefficients, the inverted values saved when
+     cocg was first computed match those which would be recomputed here,
+     so they may simply be copied back. */
+
+  bool extended = (   halo_type == CS_HALO_EXTENDED
+                   && m->cell_cells_idx) ? true : false;
+
+  cs_gradient_quantities_t  *gq = _gradient_quantities_get(0);
+
+  const cs_cocg_6_t  *cocgb_i
+    = (extended) ? gq->cocgb_i_lsq_ext : gq->cocgb_i_lsq;
+
+  if (cocgb_i != nullptr) {
+
+    bool neutral_b = true;
+    const cs_lnum_t n_b_faces = m->n_b_faces;
+    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+      if (coefbp[f_id] != 1.) {
+        neutral_b = false;
+        break;
+      }
+    }
+
+    if (neutral_b) {
+#     pragma omp parallel for
+      for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
+        cs_lnum_t c_id = m->b_cells[ii];
+        for (cs_lnum_t ll = 0; ll < 6; ll++)
+          cocg[c_id][ll] = cocgb_i[ii][ll];
+      }
+      return;
+    }
+
+  }
   const cs_lnum_t *restrict cell_b_faces_idx
     = (const cs_lnum_t *restrict) ma->cell_b_faces_idx;
   const cs_lnum_t *restrict cell_b_faces
@@ -2822,6 +2900,7 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
   if (recompute_cocg)
     _recompute_lsq_scalar_cocg(m,
                                fvq,
+                               halo_type,
                                bc_coeffs,
                                cocgb,
                                cocg);
@@ -3091,6 +3170,7 @@ _lsq_scalar_gradient_hyd_p(const cs_mesh_t                *m,
   if (recompute_cocg)
     _recompute_lsq_scalar_cocg(m,
                                fvq,
+                               halo_type,
                                bc_coeffs,
                                cocgb,
                                cocg);
@@ -3260,12 +3340,10 @@ _lsq_scalar_gradient_hyd_p(const cs_mesh_t                *m,
     const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
     const cs_lnum_t *c2c_idx = ma->cell_cells_idx;
     const cs_lnum_t *c2c = ma->cell_cells;
-    const cs_lnum_t *c2f = ma->cell_i_faces;
-    short int *c2f_sgn = ma->cell_i_faces_sgn;
-    if (c2f == nullptr) {
-      cs_mesh_adjacencies_update_cell_i_faces();
-      c2f = ma->cell_i_faces;
-      c2f_sgn = ma->cell_i_faces_sgn;
+    const int32_t *c2f_p = ma->cell_i_faces_pck;
+    if (c2f_p == nullptr) {
+      cs_mesh_adjacencies_update_cell_i_faces_packed();
+      c2f_p = ma->cell_i_faces_pck;
     }
 
     if (c_weight_s != nullptr) {  /* With cell weighting */
@@ -3280,7 +3358,7 @@ _lsq_scalar_gradient_hyd_p(const cs_mesh_t                *m,
 
         for (cs_lnum_t i = s_id; i < e_id; i++) {
           const cs_lnum_t jj = c2c[i];
-          const cs_lnum_t f_id = c2f[i];
+          const cs_lnum_t f_id = cs_mesh_adjacencies_c2f_packed_id(c2f_p[i]);
           const cs_real_t w_jj = c_weight_s[jj];
 
           cs_real_2_t poro = {i_poro_duq_0[is_porous*f_id],
@@ -3301,7 +3379,8 @@ _lsq_scalar_gradient_hyd_p(const cs_mesh_t                *m,
                               - poro[1])
                            / cs_math_3_square_norm(dc);
 
-          cs_real_t pond = (c2f_sgn[i] > 0) ? weight[f_id] : 1. - weight[f_id];
+          cs_real_t pond = (cs_mesh_adjacencies_c2f_packed_sgn(c2f_p[i]) > 0) ?
+                             weight[f_id] : 1. - weight[f_id];
 
           pfac /= (  pond       *w_ii
                    + (1. - pond)*w_jj);
@@ -3327,7 +3406,7 @@ _lsq_scalar_gradient_hyd_p(const cs_mesh_t                *m,
 
         for (cs_lnum_t i = s_id; i < e_id; i++) {
           const cs_lnum_t jj = c2c[i];
-          const cs_lnum_t f_id = c2f[i];
+          const cs_lnum_t f_id = cs_mesh_adjacencies_c2f_packed_id(c2f_p[i]);
 
           cs_real_2_t poro = {i_poro_duq_0[is_porous*f_id],
                               i_poro_duq_1[is_porous*f_id]};
@@ -5051,12 +5130,18 @@ _strided_gradient_clipping(const cs_mesh_t              *m,
 
       } /* End of loop on adjacency type */
 
+      /* Compute and apply clip factor while the gradient block is
+         cache-resident (multiplication by 1 is a no-op) */
+
       for (cs_lnum_t i = 0; i < b_e_id; i++) { /* Loop on block elements */
-        cs_real_t factor1 = 1.;
-        if (denum[i] > clipp_coef_sq * denom[i])
-          factor1 = sqrt(clipp_coef_sq * denom[i]/denum[i]);
+        cs_real_t factor1 = (denum[i] > clipp_coef_sq * denom[i]) ?
+                             sqrt(clipp_coef_sq * denom[i]/denum[i]) : 1.;
 
         clip_factor[s_id + i] = factor1;
+        for (cs_lnum_t k = 0; k < stride; k++) {
+          for (cs_lnum_t j = 0; j < 3; j++)
+            grad[s_id + i][k][j] *= factor1;
+        }
       }
 
     } /* End of (parallel) loop on blocks */
@@ -5162,9 +5247,11 @@ _strided_gradient_clipping(const cs_mesh_t              *m,
 
     } /* End of (parallel) loop on blocks */
 
-    /* Now compute clip factor (kernel common to scalar and strided clases */
+    /* Now compute clip factor and apply it to the gradient
+       (kernel common to scalar and strided cases) */
 
-    _gradient_update_face_clip_factor(m, ma, halo_type, factor, clip_factor);
+    _gradient_update_face_clip_factor(m, ma, halo_type, factor, clip_factor,
+                                      3*stride, (cs_real_t *)grad);
 
     BFT_FREE(factor);
 
@@ -5176,8 +5263,9 @@ _strided_gradient_clipping(const cs_mesh_t              *m,
     cs_halo_sync_var(m->halo, halo_type, clip_factor);
   }
 
-  /* Apply clip factor to gradient
-     ----------------------------- */
+  /* The clip factor is applied to the gradient in the loops above;
+     only log statistics if requested here
+     ------------------------------------------------------------- */
 
   if (verbosity > 1) {
 
@@ -5191,15 +5279,8 @@ _strided_gradient_clipping(const cs_mesh_t              *m,
 
 #   pragma omp parallel for reduction(+:n_clip) if (n_cells > CS_THR_MIN)
     for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-
-      cs_real_t factor1 = clip_factor[c_id];
-      if (factor1 < 1) {
-        for (cs_lnum_t i = 0; i < stride; i++) {
-          for (cs_lnum_t j = 0; j < 3; j++)
-            grad[c_id][i][j] *= factor1;
-        }
+      if (clip_factor[c_id] < 1)
         n_clip += 1;
-      }
     }
 
     cs_real_t buf[2] = {-min_factor, max_factor};
@@ -5219,23 +5300,6 @@ _strided_gradient_clipping(const cs_mesh_t              *m,
        (unsigned long long)n_clip, min_factor, max_factor, mean_factor);
   }
 
-  else { /* Avoid unneeded reduction if no logging */
-
-#   pragma omp parallel for if (n_cells > CS_THR_MIN)
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-
-      cs_real_t factor1 = clip_factor[c_id];
-      if (factor1 < 1) {
-        for (cs_lnum_t i = 0; i < stride; i++) {
-          for (cs_lnum_t j = 0; j < 3; j++)
-            grad[c_id][i][j] *= factor1;
-        }
-      }
-
-    } /* End of loop on cells */
-
-  }
-
   /* Synchronize the updated Gradient */
 
   if (m->halo != nullptr) {
@@ -5844,6 +5908,22 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
 
   BFT_MALLOC(rhs, n_cells_ext, cs_real_33_t);
 
+  /* Interior face contributions may be assembled cell-wise (gather)
+     rather than face-wise, for better cache behavior over the
+     reconstruction sweeps */
+
+  const cs_lnum_t *c2c_idx = nullptr, *c2c = nullptr;
+  const int32_t *c2f_p = nullptr;
+
+  if (cs_glob_e2n_sum_type == CS_E2N_SUM_GATHER) {
+    const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+    if (ma->cell_i_faces_pck == nullptr)
+      cs_mesh_adjacencies_update_cell_i_faces_packed();
+    c2c_idx = ma->cell_cells_idx;
+    c2c = ma->cell_cells;
+    c2f_p = ma->cell_i_faces_pck;
+  }
+
   /* Gradient reconstruction to handle non-orthogonal meshes */
   /*---------------------------------------------------------*/
 
@@ -5873,60 +5953,110 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
 
       /* Interior face treatment */
 
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
+      if (c2c_idx != nullptr) {  /* cell-based (gather) assembly */
 
 #       pragma omp parallel for
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
+        for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
 
-          for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               f_id++) {
+          const cs_lnum_t s_id = c2c_idx[ii];
+          const cs_lnum_t e_id = c2c_idx[ii+1];
 
-            cs_lnum_t c_id1 = i_face_cells[f_id][0];
-            cs_lnum_t c_id2 = i_face_cells[f_id][1];
-            cs_real_t pond = weight[f_id];
+          for (cs_lnum_t cidx = s_id; cidx < e_id; cidx++) {
 
-            cs_real_t ktpond = (c_weight == nullptr) ?
-              pond :                     // no cell weighting
-              pond  * c_weight[c_id1] // cell weighting active
-                / (      pond  * c_weight[c_id1]
-                  + (1.0-pond) * c_weight[c_id2]);
+            cs_lnum_t jj = c2c[cidx];
+            cs_lnum_t f_id = cs_mesh_adjacencies_c2f_packed_id(c2f_p[cidx]);
+            short int f_sgn = cs_mesh_adjacencies_c2f_packed_sgn(c2f_p[cidx]);
 
-            /*
-               Remark: \f$ \varia_\face = \alpha_\ij \varia_\celli
-                                        + (1-\alpha_\ij) \varia_\cellj\f$
-                       but for the cell \f$ \celli \f$ we remove
-                       \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
-                       and for the cell \f$ \cellj \f$ we remove
-                       \f$ \varia_\cellj \sum_\face \vect{S}_\face = \vect{0} \f$
-            */
+            cs_real_t sgn = (f_sgn > 0) ? 1. : -1.;
+            cs_real_t pond = (f_sgn > 0) ?
+              weight[f_id] : 1. - weight[f_id];
+
+            cs_real_t ktpond = (c_weight == nullptr) ?
+              pond :                  // no cell weighting
+              pond  * c_weight[ii]  // cell weighting active
+                / (      pond  * c_weight[ii]
+                  + (1.0-pond) * c_weight[jj]);
 
             for (cs_lnum_t i = 0; i < 3; i++) {
 
               /* Reconstruction part */
               cs_real_t
-                pfaci = 0.5 * (    (grad[c_id1][i][0] + grad[c_id2][i][0])
-                                 * dofij[f_id][0]
-                               +   (grad[c_id1][i][1] + grad[c_id2][i][1])
-                                 * dofij[f_id][1]
-                               +   (grad[c_id1][i][2] + grad[c_id2][i][2])
-                                 * dofij[f_id][2]);
-              cs_real_t pfacj = pfaci;
+                pfac = 0.5 * (    (grad[ii][i][0] + grad[jj][i][0])
+                                * dofij[f_id][0]
+                              +   (grad[ii][i][1] + grad[jj][i][1])
+                                * dofij[f_id][1]
+                              +   (grad[ii][i][2] + grad[jj][i][2])
+                                * dofij[f_id][2]);
 
-              pfaci += (1.0-ktpond) * (pvar[c_id2][i] - pvar[c_id1][i]);
-              pfacj -=      ktpond  * (pvar[c_id2][i] - pvar[c_id1][i]);
+              pfac += (1.0-ktpond) * (pvar[jj][i] - pvar[ii][i]);
+
+              for (cs_lnum_t j = 0; j < 3; j++)
+                rhs[ii][i][j] += sgn * pfac * i_f_face_normal[f_id][j];
 
-              for (cs_lnum_t j = 0; j < 3; j++) {
-                rhs[c_id1][i][j] += pfaci * i_f_face_normal[f_id][j];
-                rhs[c_id2][i][j] -= pfacj * i_f_face_normal[f_id][j];
-              }
             }
 
-          } /* loop on faces */
+          } /* loop on adjacent cells */
 
-        } /* loop on threads */
+        } /* loop on cells */
 
-      } /* loop on thread groups */
+      }
+      else { /* face-based (scatter) assembly */
+
+        for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#         pragma omp parallel for
+          for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+            for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+                 f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+                 f_id++) {
+
+              cs_lnum_t c_id1 = i_face_cells[f_id][0];
+              cs_lnum_t c_id2 = i_face_cells[f_id][1];
+              cs_real_t pond = weight[f_id];
+
+              cs_real_t ktpond = (c_weight == nullptr) ?
+                pond :                     // no cell weighting
+                pond  * c_weight[c_id1] // cell weighting active
+                  / (      pond  * c_weight[c_id1]
+                    + (1.0-pond) * c_weight[c_id2]);
+
+              /*
+                 Remark: \f$ \varia_\face = \alpha_\ij \varia_\celli
+                                          + (1-\alpha_\ij) \varia_\cellj\f$
+                         but for the cell \f$ \celli \f$ we remove
+                         \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
+                         and for the cell \f$ \cellj \f$ we remove
+                         \f$ \varia_\cellj \sum_\face \vect{S}_\face = \vect{0} \f$
+              */
+
+              for (cs_lnum_t i = 0; i < 3; i++) {
+
+                /* Reconstruction part */
+                cs_real_t
+                  pfaci = 0.5 * (    (grad[c_id1][i][0] + grad[c_id2][i][0])
+                                   * dofij[f_id][0]
+                                 +   (grad[c_id1][i][1] + grad[c_id2][i][1])
+                                   * dofij[f_id][1]
+                                 +   (grad[c_id1][i][2] + grad[c_id2][i][2])
+                                   * dofij[f_id][2]);
+                cs_real_t pfacj = pfaci;
+
+                pfaci += (1.0-ktpond) * (pvar[c_id2][i] - pvar[c_id1][i]);
+                pfacj -=      ktpond  * (pvar[c_id2][i] - pvar[c_id1][i]);
+
+                for (cs_lnum_t j = 0; j < 3; j++) {
+                  rhs[c_id1][i][j] += pfaci * i_f_face_normal[f_id][j];
+                  rhs[c_id2][i][j] -= pfacj * i_f_face_normal[f_id][j];
+                }
+              }
+
+            } /* loop on faces */
+
+          } /* loop on threads */
+
+        } /* loop on thread groups */
+      } /* face-based assembly */
 
       /* Contribution from coupled faces */
       if (cpl != nullptr)
@@ -7233,12 +7363,10 @@ _lsq_strided_gradient(const cs_mesh_t             *m,
     const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
     const cs_lnum_t *c2c_idx = ma->cell_cells_idx;
     const cs_lnum_t *c2c = ma->cell_cells;
-    const cs_lnum_t *c2f = ma->cell_i_faces;
-    short int *c2f_sgn = ma->cell_i_faces_sgn;
-    if (c2f == nullptr) {
-      cs_mesh_adjacencies_update_cell_i_faces();
-      c2f = ma->cell_i_faces;
-      c2f_sgn = ma->cell_i_faces_sgn;
+    const int32_t *c2f_p = ma->cell_i_faces_pck;
+    if (c2f_p == nullptr) {
+      cs_mesh_adjacencies_update_cell_i_faces_packed();
+      c2f_p = ma->cell_i_faces_pck;
     }
 
     if (c_weight != nullptr) {  /* With cell weighting */
@@ -7258,7 +7386,7 @@ _lsq_strided_gradient(const cs_mesh_t             *m,
 
         for (cs_lnum_t i = s_id; i < e_id; i++) {
           const cs_lnum_t jj = c2c[i];
-          const cs_lnum_t f_id = c2f[i];
+          const cs_lnum_t f_id = cs_mesh_adjacencies_c2f_packed_id(c2f_p[i]);
           const cs_real_t w_jj = c_weight[jj];
 
           cs_real_t  dc[3];
@@ -7267,7 +7395,8 @@ _lsq_strided_gradient(const cs_mesh_t             *m,
 
           cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-          cs_real_t pond = (c2f_sgn[i] > 0) ? weight[f_id] : 1. - weight[f_id];
+          cs_real_t pond = (cs_mesh_adjacencies_c2f_packed_sgn(c2f_p[i]) > 0) ?
+                             weight[f_id] : 1. - weight[f_id];
 
           cs_real_t denom = 1. / (  pond       *w_ii
                                   + (1. - pond)*w_jj);
@@ -9752,6 +9881,112 @@ _gradient_strided_cell(const cs_mesh_t             *m,
   }  /* End of correction in case of Neumann BC's */
 }
 
+/*----------------------------------------------------------------------------
+ * Reconstruct face values from a cell gradient, while the gradient and
+ * variable arrays are still cache-resident.
+ *
+ * This is the second stage of the fused gradient + reconstruction pipeline:
+ * it replaces the separate re-streaming of cell and face arrays otherwise
+ * done downstream (in cs_convection_diffusion.cpp), so the mesh adjacency
+ * and variable arrays are traversed once less per variable and time step.
+ *
+ * parameters:
+ *   m           <-- pointer to associated mesh structure
+ *   fvq         <-- pointer to associated finite volume quantities
+ *   inc         <-- if 0, solve on increment; 1 otherwise
+ *   bc_coeffs   <-- B.C. structure for boundary face normals
+ *   pvar        <-- variable (cell values)
+ *   grad        <-- gradient of pvar
+ *   i_face_val  --> reconstructed values at interior faces
+ *   b_face_val  --> reconstructed values at boundary faces, or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_scalar_face_values_from_gradient(const cs_mesh_t             *m,
+                                  const cs_mesh_quantities_t  *fvq,
+                                  cs_real_t                    inc,
+                                  const cs_field_bc_coeffs_t  *bc_coeffs,
+                                  const cs_real_t              pvar[restrict],
+                                  const cs_real_t              grad[restrict][3],
+                                  cs_real_t          *restrict i_face_val,
+                                  cs_real_t          *restrict b_face_val)
+{
+  const cs_real_t *coefap = bc_coeffs->a;
+  const cs_real_t *coefbp = bc_coeffs->b;
+
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *restrict)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *restrict)fvq->djjpf;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+  const cs_real_t *restrict weight = fvq->weight;
+
+  /* Interior faces: centered value with non-orthogonality reconstruction */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
+
+        cs_lnum_t ii = i_face_cells[f_id][0];
+        cs_lnum_t jj = i_face_cells[f_id][1];
+
+        cs_real_t pond = weight[f_id];
+
+        cs_real_t pip =   pvar[ii]
+                        + cs_math_3_dot_product(grad[ii], diipf[f_id]);
+        cs_real_t pjp =   pvar[jj]
+                        + cs_math_3_dot_product(grad[jj], djjpf[f_id]);
+
+        i_face_val[f_id] = pond*pip + (1.-pond)*pjp;
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Boundary faces */
+
+  if (b_face_val != nullptr) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t f_id = b_group_index[t_id*2];
+           f_id < b_group_index[t_id*2 + 1];
+           f_id++) {
+
+        cs_lnum_t ii = b_face_cells[f_id];
+
+        cs_real_t pip =   pvar[ii]
+                        + cs_math_3_dot_product(grad[ii], diipb[f_id]);
+
+        b_face_val[f_id] = inc*coefap[f_id] + coefbp[f_id]*pip;
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  }
+}
+
 BEGIN_C_DECLS
 
 /*============================================================================
@@ -9932,8 +10167,10 @@ cs_gradient_free_quantities(void)
     BFT_FREE(gq->cocg_it);
     BFT_FREE(gq->cocgb_s_lsq);
     BFT_FREE(gq->cocg_lsq);
+    BFT_FREE(gq->cocgb_i_lsq);
     BFT_FREE(gq->cocgb_s_lsq_ext);
     BFT_FREE(gq->cocg_lsq_ext);
+    BFT_FREE(gq->cocgb_i_lsq_ext);
 
   }
 }
@@ -10339,6 +10576,111 @@ cs_gradient_scalar_synced_input(const char                 *var_name,
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradient of scalar field and reconstructed face
+ *         values in a fused pipeline.
+ *
+ * This combines \ref cs_gradient_scalar_synced_input with the face-value
+ * reconstruction otherwise repeated downstream by convection-diffusion
+ * operators; the reconstruction stage runs immediately after the gradient
+ * stage, while the gradient and variable arrays are still cache-resident,
+ * so the face adjacency is streamed once less per variable.
+ *
+ * As for \ref cs_gradient_scalar_synced_input, ghost cell values for input
+ * arrays (var and optionally c_weight) are assumed already synchronized.
+ *
+ * \param[in]   var_name        variable name
+ * \param[in]   gradient_type   gradient type
+ * \param[in]   halo_type       halo type
+ * \param[in]   inc             if 0, solve on increment; 1 otherwise
+ * \param[in]   n_r_sweeps      if > 1, number of reconstruction sweeps
+ *                              (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]   w_stride        stride for weighting coefficient
+ * \param[in]   verbosity       verbosity level
+ * \param[in]   clip_mode       clipping mode
+ * \param[in]   epsilon         precision for iterative gradient calculation
+ * \param[in]   clip_coeff      clipping coefficient
+ * \param[in]   bc_coeffs       boundary condition structure
+ * \param[in]   var             gradient's base variable
+ * \param[in]   c_weight        cell variable weight, or nullptr
+ * \param[out]  grad            gradient
+ * \param[out]  i_face_val      reconstructed values at interior faces
+ * \param[out]  b_face_val      reconstructed values at boundary faces,
+ *                              or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_face_values(const char                 *var_name,
+                               cs_gradient_type_t          gradient_type,
+                               cs_halo_type_t              halo_type,
+                               int                         inc,
+                               int                         n_r_sweeps,
+                               int                         w_stride,
+                               int                         verbosity,
+                               cs_gradient_limit_t         clip_mode,
+                               double                      epsilon,
+                               double                      clip_coeff,
+                               const cs_field_bc_coeffs_t *bc_coeffs,
+                               const cs_real_t             var[restrict],
+                               const cs_real_t             c_weight[restrict],
+                               cs_real_t                   grad[restrict][3],
+                               cs_real_t                   i_face_val[restrict],
+                               cs_real_t                   b_face_val[restrict])
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  cs_gradient_info_t *gradient_info = nullptr;
+  cs_timer_t t0, t1;
+
+  t0 = cs_timer_time();
+
+  gradient_info = _find_or_add_system(var_name, gradient_type);
+
+  _gradient_scalar(var_name,
+                   gradient_info,
+                   gradient_type,
+                   halo_type,
+                   inc,
+                   true,  /* Check recompute of cocg */
+                   n_r_sweeps,
+                   0,     /* hyd_p_flag */
+                   w_stride,
+                   verbosity,
+                   clip_mode,
+                   epsilon,
+                   clip_coeff,
+                   nullptr,  /* f_ext */
+                   bc_coeffs,
+                   var,
+                   c_weight,
+                   nullptr,  /* cpl */
+                   grad);
+
+  /* Reconstruction stage, fused while grad and var are cache-hot */
+
+  _scalar_face_values_from_gradient(mesh,
+                                    fvq,
+                                    (cs_real_t)inc,
+                                    bc_coeffs,
+                                    var,
+                                    grad,
+                                    i_face_val,
+                                    b_face_val);
+
+  t1 = cs_timer_time();
+
+  cs_timer_counter_add_diff(&_gradient_t_tot, &t0, &t1);
+
+  gradient_info->n_calls += 1;
+  cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
+
+  if (_gradient_stat_id > -1)
+    cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
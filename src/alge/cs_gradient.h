@@ -290,6 +290,58 @@ cs_gradient_scalar_synced_input(const char                 *var_name,
                                 const cs_internal_coupling_t  *cpl,
                                 cs_real_t                   grad[restrict][3]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradient of scalar field and reconstructed face
+ *         values in a fused pipeline.
+ *
+ * This combines \ref cs_gradient_scalar_synced_input with the face-value
+ * reconstruction otherwise repeated downstream by convection-diffusion
+ * operators, so cell and face arrays are streamed through memory once
+ * less per variable.
+ *
+ * Ghost cell values for input arrays (var and optionally c_weight) are
+ * assumed already synchronized.
+ *
+ * \param[in]   var_name        variable name
+ * \param[in]   gradient_type   gradient type
+ * \param[in]   halo_type       halo type
+ * \param[in]   inc             if 0, solve on increment; 1 otherwise
+ * \param[in]   n_r_sweeps      if > 1, number of reconstruction sweeps
+ *                              (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]   w_stride        stride for weighting coefficient
+ * \param[in]   verbosity       verbosity level
+ * \param[in]   clip_mode       clipping mode
+ * \param[in]   epsilon         precision for iterative gradient calculation
+ * \param[in]   clip_coeff      clipping coefficient
+ * \param[in]   bc_coeffs       boundary condition structure
+ * \param[in]   var             gradient's base variable
+ * \param[in]   c_weight        cell variable weight, or nullptr
+ * \param[out]  grad            gradient
+ * \param[out]  i_face_val      reconstructed values at interior faces
+ * \param[out]  b_face_val      reconstructed values at boundary faces,
+ *                              or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_face_values(const char                 *var_name,
+                               cs_gradient_type_t          gradient_type,
+                               cs_halo_type_t              halo_type,
+                               int                         inc,
+                               int                         n_r_sweeps,
+                               int                         w_stride,
+                               int                         verbosity,
+                               cs_gradient_limit_t         clip_mode,
+                               double                      epsilon,
+                               double                      clip_coeff,
+                               const cs_field_bc_coeffs_t *bc_coeffs,
+                               const cs_real_t             var[restrict],
+                               const cs_real_t             c_weight[restrict],
+                               cs_real_t                   grad[restrict][3],
+                               cs_real_t                   i_face_val[restrict],
+                               cs_real_t                   b_face_val[restrict]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
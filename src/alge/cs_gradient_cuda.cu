@@ -309,13 +309,14 @@ _compute_cocg_rhsv_lsq_s_i_face(cs_lnum_t           size,
   cs_lnum_t c_id = blockIdx.x * blockDim.x + threadIdx.x;
   if (c_id < size) {
 
-    /* Initialize COCG (RHS initialize before) */
+    /* Accumulate in registers, with a single write per array at the end */
 
-    cocg[c_id][0] = 0; cocg[c_id][1] = 0; cocg[c_id][2] = 0;
-    cocg[c_id][3] = 0; cocg[c_id][4] = 0; cocg[c_id][5] = 0;
+    cs_real_t _cocg[6] = {0., 0., 0., 0., 0., 0.};
+    cs_real_t _rhsv[3] = {0., 0., 0.};
 
     cs_lnum_t s_id = cell_cells_idx[c_id];
     cs_lnum_t e_id = cell_cells_idx[c_id + 1];
+    cs_real_t pvar_c = rhsv[c_id][3];
     cs_real_t dc[3], ddc, _weight;
     cs_lnum_t c_id1;
 
@@ -334,19 +335,30 @@ _compute_cocg_rhsv_lsq_s_i_face(cs_lnum_t           size,
       else
         _weight = 2. * c_weight[c_id1] / (c_weight[c_id] + c_weight[c_id1]);
 
-      _weight *= (rhsv[c_id1][3] - rhsv[c_id][3]) * ddc;
+      _weight *= (rhsv[c_id1][3] - pvar_c) * ddc;
 
-      rhsv[c_id][0] += dc[0] * _weight;
-      rhsv[c_id][1] += dc[1] * _weight;
-      rhsv[c_id][2] += dc[2] * _weight;
+      _rhsv[0] += dc[0] * _weight;
+      _rhsv[1] += dc[1] * _weight;
+      _rhsv[2] += dc[2] * _weight;
 
-      cocg[c_id][0] += dc[0] * dc[0] * ddc;
-      cocg[c_id][1] += dc[1] * dc[1] * ddc;
-      cocg[c_id][2] += dc[2] * dc[2] * ddc;
-      cocg[c_id][3] += dc[0] * dc[1] * ddc;
-      cocg[c_id][4] += dc[1] * dc[2] * ddc;
-      cocg[c_id][5] += dc[0] * dc[2] * ddc;
+      _cocg[0] += dc[0] * dc[0] * ddc;
+      _cocg[1] += dc[1] * dc[1] * ddc;
+      _cocg[2] += dc[2] * dc[2] * ddc;
+      _cocg[3] += dc[0] * dc[1] * ddc;
+      _cocg[4] += dc[1] * dc[2] * ddc;
+      _cocg[5] += dc[0] * dc[2] * ddc;
     }
+
+    rhsv[c_id][0] += _rhsv[0];
+    rhsv[c_id][1] += _rhsv[1];
+    rhsv[c_id][2] += _rhsv[2];
+
+    cocg[c_id][0] = _cocg[0];
+    cocg[c_id][1] = _cocg[1];
+    cocg[c_id][2] = _cocg[2];
+    cocg[c_id][3] = _cocg[3];
+    cocg[c_id][4] = _cocg[4];
+    cocg[c_id][5] = _cocg[5];
   }
 }
 
@@ -379,6 +391,11 @@ _compute_cocg_rhsv_lsq_s_b_face(cs_lnum_t         n_b_cells,
   cs_lnum_t s_id = cell_b_faces_idx[c_id];
   cs_lnum_t e_id = cell_b_faces_idx[c_id + 1];
 
+  cs_real_t pvar_c = rhsv[c_id][3];
+
+  cs_real_t _cocg[6] = {0., 0., 0., 0., 0., 0.};
+  cs_real_t _rhsv[3] = {0., 0., 0.};
+
   for (cs_lnum_t i = s_id; i < e_id; i++) {
     cs_lnum_t f_id = cell_b_faces[i];
 
@@ -389,19 +406,30 @@ _compute_cocg_rhsv_lsq_s_b_face(cs_lnum_t         n_b_cells,
     dddij[1] = b_face_u_normal[f_id][1] + umcbdd * diipb[f_id][1];
     dddij[2] = b_face_u_normal[f_id][2] + umcbdd * diipb[f_id][2];
 
-    unddij *= (coefap[f_id] * inc + (coefbp[f_id] - 1.) * rhsv[c_id][3]);
+    unddij *= (coefap[f_id] * inc + (coefbp[f_id] - 1.) * pvar_c);
 
-    rhsv[c_id][0] += dddij[0] * unddij;
-    rhsv[c_id][1] += dddij[1] * unddij;
-    rhsv[c_id][2] += dddij[2] * unddij;
+    _rhsv[0] += dddij[0] * unddij;
+    _rhsv[1] += dddij[1] * unddij;
+    _rhsv[2] += dddij[2] * unddij;
 
-    cocg[c_id][0] += dddij[0] * dddij[0];
-    cocg[c_id][1] += dddij[1] * dddij[1];
-    cocg[c_id][2] += dddij[2] * dddij[2];
-    cocg[c_id][3] += dddij[0] * dddij[1];
-    cocg[c_id][4] += dddij[1] * dddij[2];
-    cocg[c_id][5] += dddij[0] * dddij[2];
+    _cocg[0] += dddij[0] * dddij[0];
+    _cocg[1] += dddij[1] * dddij[1];
+    _cocg[2] += dddij[2] * dddij[2];
+    _cocg[3] += dddij[0] * dddij[1];
+    _cocg[4] += dddij[1] * dddij[2];
+    _cocg[5] += dddij[0] * dddij[2];
   }
+
+  rhsv[c_id][0] += _rhsv[0];
+  rhsv[c_id][1] += _rhsv[1];
+  rhsv[c_id][2] += _rhsv[2];
+
+  cocg[c_id][0] += _cocg[0];
+  cocg[c_id][1] += _cocg[1];
+  cocg[c_id][2] += _cocg[2];
+  cocg[c_id][3] += _cocg[3];
+  cocg[c_id][4] += _cocg[4];
+  cocg[c_id][5] += _cocg[5];
 }
 
 /*----------------------------------------------------------------------------
@@ -420,6 +448,8 @@ _compute_rhsv_lsq_s_i_face(cs_lnum_t          size,
   if (c_id < size) {
     cs_lnum_t s_id = cell_cells_idx[c_id];
     cs_lnum_t e_id = cell_cells_idx[c_id + 1];
+    cs_real_t pvar_c = rhsv[c_id][3];
+    cs_real_t _rhsv[3] = {0., 0., 0.};
     cs_real_t dc[3], ddc, _weight;
     cs_lnum_t c_id1;
     for (cs_lnum_t i = s_id; i < e_id; i++) {
@@ -434,12 +464,15 @@ _compute_rhsv_lsq_s_i_face(cs_lnum_t          size,
       dc[2] = cell_cen[c_id1][2] - cell_cen[c_id][2];
 
       ddc = 1. / (dc[0] * dc[0] + dc[1] * dc[1] + dc[2] * dc[2]);
-      _weight *= (rhsv[c_id1][3] - rhsv[c_id][3]) * ddc;
+      _weight *= (rhsv[c_id1][3] - pvar_c) * ddc;
 
-      rhsv[c_id][0] += dc[0] * _weight;
-      rhsv[c_id][1] += dc[1] * _weight;
-      rhsv[c_id][2] += dc[2] * _weight;
+      _rhsv[0] += dc[0] * _weight;
+      _rhsv[1] += dc[1] * _weight;
+      _rhsv[2] += dc[2] * _weight;
     }
+    rhsv[c_id][0] += _rhsv[0];
+    rhsv[c_id][1] += _rhsv[1];
+    rhsv[c_id][2] += _rhsv[2];
   }
 }
 
@@ -470,6 +503,9 @@ _compute_rhsv_lsq_s_b_face(cs_lnum_t         n_b_cells,
   cs_lnum_t s_id = cell_b_faces_idx[c_id];
   cs_lnum_t e_id = cell_b_faces_idx[c_id + 1];
 
+  cs_real_t pvar_c = rhsv[c_id][3];
+  cs_real_t _rhsv[3] = {0., 0., 0.};
+
   for (cs_lnum_t i = s_id; i < e_id; i++) {
     cs_lnum_t f_id = cell_b_faces[i];
 
@@ -480,12 +516,16 @@ _compute_rhsv_lsq_s_b_face(cs_lnum_t         n_b_cells,
     dddij[1] = b_face_u_normal[f_id][1] + umcbdd * diipb[f_id][1];
     dddij[2] = b_face_u_normal[f_id][2] + umcbdd * diipb[f_id][2];
 
-    unddij *= (coefap[f_id] * inc + (coefbp[f_id] - 1.) * rhsv[c_id][3]);
+    unddij *= (coefap[f_id] * inc + (coefbp[f_id] - 1.) * pvar_c);
 
-    rhsv[c_id][0] += dddij[0] * unddij;
-    rhsv[c_id][1] += dddij[1] * unddij;
-    rhsv[c_id][2] += dddij[2] * unddij;
+    _rhsv[0] += dddij[0] * unddij;
+    _rhsv[1] += dddij[1] * unddij;
+    _rhsv[2] += dddij[2] * unddij;
   }
+
+  rhsv[c_id][0] += _rhsv[0];
+  rhsv[c_id][1] += _rhsv[1];
+  rhsv[c_id][2] += _rhsv[2];
 }
 
 /*----------------------------------------------------------------------------
@@ -508,10 +548,16 @@ _init_rhsv(cs_lnum_t         size,
 }
 
 /*----------------------------------------------------------------------------
- * Compute rhsv contributions from neigboring cells for strided case
+ * Compute rhsv contributions from neigboring cells for strided case.
+ *
+ * Each cell is handled by a cooperative sub-warp group of "lanes" threads
+ * (lanes must divide the warp size and the block size): lanes gather the
+ * cell's adjacency in a coalesced manner, accumulate partial contributions
+ * in registers, and reduce them with shuffle intrinsics, so no shared
+ * memory staging of accumulators is needed.
  *----------------------------------------------------------------------------*/
 
-template <unsigned int blocksize, cs_lnum_t stride>
+template <unsigned int lanes, cs_lnum_t stride>
 __global__ static void
 _compute_rhs_lsq_strided_cells(cs_lnum_t             n_cells,
                                const cs_lnum_t      *restrict cell_cells_idx,
@@ -526,22 +572,23 @@ _compute_rhs_lsq_strided_cells(cs_lnum_t             n_cells,
                                const cs_real_t      *restrict c_weight,
                                cs_real_t           (*restrict rhs)[stride][3])
 {
-  cs_lnum_t c_id1 = blockIdx.x * blockDim.x + threadIdx.x;
-  cs_lnum_t lidx = threadIdx.x;
+  cs_lnum_t t_id = blockIdx.x * blockDim.x + threadIdx.x;
+  cs_lnum_t c_id1 = t_id / lanes;
+  unsigned int lane = threadIdx.x % lanes;
 
-  if (c_id1 >= n_cells) {
-    return;
-  }
+  /* All lanes of a group share the same cell, so groups exit as a whole
+     and the ballot below names only complete groups */
 
-  // size_t c_id1 = c_id / (3*3);
-  // size_t i = (c_id / 3) % 3;
-  // size_t j = c_id % 3;
+  unsigned int mask = __ballot_sync(0xffffffffu, c_id1 < n_cells);
 
-  __shared__ cs_real_t _rhs[blocksize][stride][3];
+  if (c_id1 >= n_cells)
+    return;
+
+  cs_real_t _rhs[stride][3];
 
   for (cs_lnum_t i = 0; i < stride; i++) {
     for (cs_lnum_t j = 0; j < 3; j++) {
-      _rhs[lidx][i][j] = 0.0;
+      _rhs[i][j] = 0.0;
     }
   }
 
@@ -556,7 +603,7 @@ _compute_rhs_lsq_strided_cells(cs_lnum_t             n_cells,
 
   cs_real_t dc[stride], fctb[stride], lweight, ddc;
 
-  for (cs_lnum_t idx = s_id; idx < e_id; idx++) {
+  for (cs_lnum_t idx = s_id + lane; idx < e_id; idx += lanes) {
     cs_lnum_t c_id2 = cell_cells[idx];
 
     auto cell_f_cen2 = cell_f_cen[c_id2];
@@ -585,20 +632,20 @@ _compute_rhs_lsq_strided_cells(cs_lnum_t             n_cells,
       cs_real_t pfac = (pvar2[i] - pvar1[i]) * ddc;
       for (cs_lnum_t j = 0; j < 3; j++) {
         fctb[j] = dc[j] * pfac;
-        _rhs[lidx][i][j] += lweight * fctb[j];
+        _rhs[i][j] += lweight * fctb[j];
       }
     }
 
   }
 
-  /* Contribution from standard neighborhod */
+  /* Contribution from extended neighborhod */
 
   if (cell_cells_e_idx != NULL) {
     s_id = cell_cells_e_idx[c_id1];
     e_id = cell_cells_e_idx[c_id1 + 1];
 
-    for (cs_lnum_t idx = s_id; idx < e_id; idx++) {
-      cs_lnum_t c_id2 = cell_cells[idx];
+    for (cs_lnum_t idx = s_id + lane; idx < e_id; idx += lanes) {
+      cs_lnum_t c_id2 = cell_cells_e[idx];
 
       auto cell_f_cen2 = cell_f_cen[c_id2];
 
@@ -613,17 +660,26 @@ _compute_rhs_lsq_strided_cells(cs_lnum_t             n_cells,
       for (cs_lnum_t i = 0; i < stride; i++) {
         cs_real_t pfac = (pvar2[i] - pvar1[i]) * ddc;
         for (cs_lnum_t j = 0; j < 3; j++) {
-          _rhs[lidx][i][j] += dc[j] * pfac;
+          _rhs[i][j] += dc[j] * pfac;
         }
       }
     }
   }
 
-  /* Copy from shared memory */
+  /* Reduce partial contributions across the group and write result */
 
-  for (cs_lnum_t i = 0; i < stride; i++) {
-    for (cs_lnum_t j = 0; j < 3; j++) {
-      rhs[c_id1][i][j] = _rhs[lidx][i][j];
+  for (unsigned int offset = lanes/2; offset > 0; offset /= 2) {
+    for (cs_lnum_t i = 0; i < stride; i++) {
+      for (cs_lnum_t j = 0; j < 3; j++)
+        _rhs[i][j] += __shfl_down_sync(mask, _rhs[i][j], offset, lanes);
+    }
+  }
+
+  if (lane == 0) {
+    for (cs_lnum_t i = 0; i < stride; i++) {
+      for (cs_lnum_t j = 0; j < 3; j++) {
+        rhs[c_id1][i][j] = _rhs[i][j];
+      }
     }
   }
 }
@@ -1587,8 +1643,13 @@ cs_gradient_strided_lsq_cuda(const cs_mesh_t               *m,
   const unsigned int blocksize = 256;
   int gridsize;
 
-  gridsize = cs_cuda_grid_size(n_cells, blocksize);
-  _compute_rhs_lsq_strided_cells<blocksize><<<gridsize, blocksize, 0, stream>>>
+  /* Sub-warp group size for the cooperative cells kernel; 8 lanes match
+     typical cell neighbor counts while keeping adjacency reads coalesced */
+
+  const unsigned int sw_lanes = 8;
+
+  gridsize = cs_cuda_grid_size(n_cells*sw_lanes, blocksize);
+  _compute_rhs_lsq_strided_cells<sw_lanes><<<gridsize, blocksize, 0, stream>>>
     (n_cells,
      cell_cells_idx,
      cell_cells,
@@ -139,6 +139,12 @@ struct _cs_grid_t {
 
   const struct _cs_grid_t  *parent; /* Pointer to parent (finer) grid */
 
+  cs_lnum_t           parent_n_rows;     /* Parent local row count at
+                                            coarsening time (to check a
+                                            new parent grid when updating
+                                            coefficients only) */
+  cs_lnum_t           parent_n_cols_ext; /* Matching column count */
+
   /* Connectivity information */
 
   cs_lnum_t           n_faces;      /* Local number of faces */
@@ -372,6 +378,8 @@ _create_grid(void)
   g->n_elts_r[1] = 0;
 
   g->parent = NULL;
+  g->parent_n_rows = 0;
+  g->parent_n_cols_ext = 0;
   g->conv_diff = false;
 
   g->relaxation = 0;
@@ -450,6 +458,8 @@ _coarse_init(const cs_grid_t  *f,
   cs_grid_t *c = _create_grid();
 
   c->parent = f;
+  c->parent_n_rows = f->n_rows;
+  c->parent_n_cols_ext = f->n_cols_ext;
   c->alloc_mode = alloc_mode;
 
   c->level = f->level + 1;
@@ -6389,6 +6399,198 @@ cs_grid_coarsen_to_single(const cs_grid_t  *f,
   return c;
 }
 
+/*----------------------------------------------------------------------------
+ * Update matrix coefficients of an existing coarse grid from a fine grid.
+ *
+ * This re-runs the Galerkin projection of matrix values using the
+ * aggregation and coarse matrix structure computed by a previous call to
+ * cs_grid_coarsen, so it may only be used when the fine grid's matrix
+ * structure (and aggregation quality) is unchanged, and only its
+ * coefficient values have been modified.
+ *
+ * The coarse grid's parent pointer is updated to the given fine grid.
+ *
+ * Currently limited to the default (MSR, non-relaxed, non-merged) coarse
+ * grid construction; in other cases, 1 is returned and the grid is not
+ * modified, so the caller should fall back to a full coarsening.
+ *
+ * parameters:
+ *   c <-> Coarse grid structure
+ *   f <-- Fine grid structure
+ *
+ * returns:
+ *   0 if coefficients were updated, 1 if a full rebuild is required
+ *----------------------------------------------------------------------------*/
+
+int
+cs_grid_update_coefficients(cs_grid_t        *c,
+                            const cs_grid_t  *f)
+{
+  assert(c != NULL && f != NULL);
+
+  /* Check the coarse grid was built through the Galerkin MSR path from a
+     matching fine grid, with no merging or recursion applied */
+
+  if (   c->coarse_row == NULL
+      || c->_matrix == NULL
+      || c->relaxation > 0
+      || c->conv_diff
+      || f->n_rows != c->parent_n_rows
+      || f->n_cols_ext != c->parent_n_cols_ext
+      || f->symmetric != c->symmetric
+      || f->db_size != c->db_size
+      || f->eb_size != c->eb_size
+      || c->level != f->level + 1)
+    return 1;
+
+  if (   cs_matrix_get_type(f->matrix) != CS_MATRIX_MSR
+      || cs_matrix_get_type(c->matrix) != CS_MATRIX_MSR)
+    return 1;
+
+#if defined(HAVE_MPI)
+  if (c->merge_sub_size > 1 || c->merge_cell_idx != NULL)
+    return 1;
+#endif
+
+  std::chrono::high_resolution_clock::time_point t_start;
+  if (cs_glob_timer_kernels_flag > 0)
+    t_start = std::chrono::high_resolution_clock::now();
+
+  const cs_lnum_t db_size = f->db_size;
+  const cs_lnum_t db_stride = db_size*db_size;
+  const cs_lnum_t eb_stride = f->eb_size*f->eb_size;
+
+  const cs_lnum_t f_n_rows = f->n_rows;
+  const cs_lnum_t c_n_rows = c->n_rows;
+  const cs_lnum_t *c_coarse_row = c->coarse_row;
+
+  /* Fine and coarse matrices in the MSR format; the coarse structure
+     (row index and column ids) is reused as is */
+
+  const cs_lnum_t  *f_row_index, *f_col_id;
+  const cs_real_t  *f_d_val, *f_x_val;
+
+  cs_matrix_get_msr_arrays(f->matrix,
+                           &f_row_index,
+                           &f_col_id,
+                           &f_d_val,
+                           &f_x_val);
+
+  const cs_lnum_t  *c_row_index, *c_col_id;
+
+  cs_matrix_get_msr_arrays(c->matrix,
+                           &c_row_index,
+                           &c_col_id,
+                           NULL,
+                           NULL);
+
+  cs_lnum_t c_size = c_row_index[c_n_rows];
+
+  cs_real_t *restrict c_d_val, *restrict c_x_val;
+
+  CS_MALLOC_HD(c_d_val, c_n_rows*db_stride, cs_real_t, c->alloc_mode);
+  CS_MALLOC_HD(c_x_val, c_size*eb_stride, cs_real_t, c->alloc_mode);
+
+  for (cs_lnum_t i = 0; i < c_n_rows*db_stride; i++)
+    c_d_val[i] = 0.0;
+
+  for (cs_lnum_t i = 0; i < c_size*eb_stride; i++)
+    c_x_val[i] = 0.0;
+
+  /* Diagonal contributions (penalized rows excluded from aggregation) */
+
+  if (db_size == 1) {
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+      cs_lnum_t ic = c_coarse_row[ii];
+      if (ic > -1 && ic < c_n_rows)
+        c_d_val[ic] += f_d_val[ii];
+    }
+  }
+  else {
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+      cs_lnum_t ic = c_coarse_row[ii];
+      if (ic > -1 && ic < c_n_rows) {
+        for (cs_lnum_t jj = 0; jj < db_size; jj++) {
+          for (cs_lnum_t kk = 0; kk < db_size; kk++)
+            c_d_val[ic*db_stride + db_size*jj + kk]
+              += f_d_val[ii*db_stride + db_size*jj + kk];
+        }
+      }
+    }
+  }
+
+  /* Extra-diagonal contributions, using the existing (sorted) coarse
+     column ids */
+
+  for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+
+    cs_lnum_t i = c_coarse_row[ii];
+
+    if (i > -1 && i < c_n_rows) {
+
+      for (cs_lnum_t jj_ind = f_row_index[ii];
+           jj_ind < f_row_index[ii+1];
+           jj_ind++) {
+
+        cs_lnum_t jj = f_col_id[jj_ind];
+
+        cs_lnum_t j = c_coarse_row[jj];
+
+        if (j > -1) {
+
+          if (i != j) {
+            cs_lnum_t s_id = c_row_index[i];
+            cs_lnum_t n_cols = c_row_index[i+1] - s_id;
+            /* ids are sorted, so binary search possible */
+            cs_lnum_t k = _l_id_binary_search(n_cols, j, c_col_id + s_id);
+            for (cs_lnum_t l = 0; l < eb_stride; l++)
+              c_x_val[(k + s_id)*eb_stride + l]
+                += f_x_val[jj_ind*eb_stride + l];
+          }
+          else { /* i == j */
+            for (cs_lnum_t kk = 0; kk < db_size; kk++) {
+              /* diagonal terms only */
+              /* Extra-diag block being isotropic, first entry suffices */
+              c_d_val[i*db_stride + db_size*kk + kk]
+                += f_x_val[jj_ind*eb_stride];
+            }
+          }
+
+        }
+      }
+
+    }
+
+  }
+
+  /* Replace coefficients, keeping the matrix structure */
+
+  cs_matrix_release_coefficients(c->_matrix);
+
+  cs_matrix_transfer_coefficients_msr(c->_matrix,
+                                      c->symmetric,
+                                      c->db_size,
+                                      c->eb_size,
+                                      c_row_index,
+                                      c_col_id,
+                                      &c_d_val,
+                                      &c_x_val);
+
+  c->parent = f;
+
+  if (cs_glob_timer_kernels_flag > 0) {
+    std::chrono::high_resolution_clock::time_point
+      t_stop = std::chrono::high_resolution_clock::now();
+    std::chrono::microseconds elapsed
+      = std::chrono::duration_cast
+          <std::chrono::microseconds>(t_stop - t_start);
+    printf("%d: %s (level %d)", cs_glob_rank_id, __func__, f->level);
+    printf(", total = %ld\n", elapsed.count());
+  }
+
+  return 0;
+}
+
 /*----------------------------------------------------------------------------
  * Project coarse grid row numbers to base grid.
  *
@@ -6918,19 +7120,31 @@ cs_grid_restrict_row_var(cs_dispatch_context  &ctx,
     MPI_Comm  comm = cs_glob_mpi_comm;
     static const int tag = 'r'+'e'+'s'+'t'+'r'+'i'+'c'+'t';
 
-    /* Append data */
+    /* Append data: all receives are posted at once on the gathering rank,
+       so latency is not multiplied by the number of merged ranks */
 
     if (c->merge_sub_rank == 0) {
-      int rank_id;
-      MPI_Status status;
+
+      MPI_Request _request[128];
+      MPI_Request *request = _request;
+
+      if (c->merge_sub_size - 1 > 128)
+        BFT_MALLOC(request, c->merge_sub_size - 1, MPI_Request);
+
       assert(cs_glob_rank_id == c->merge_sub_root);
-      for (rank_id = 1; rank_id < c->merge_sub_size; rank_id++) {
+      for (int rank_id = 1; rank_id < c->merge_sub_size; rank_id++) {
         cs_lnum_t n_recv = (  c->merge_cell_idx[rank_id+1]
                             - c->merge_cell_idx[rank_id]);
         int dist_rank = c->merge_sub_root + c->merge_stride*rank_id;
-        MPI_Recv(c_var + c->merge_cell_idx[rank_id]*db_size,
-                 n_recv*db_size, CS_MPI_REAL, dist_rank, tag, comm, &status);
+        MPI_Irecv(c_var + c->merge_cell_idx[rank_id]*db_size,
+                  n_recv*db_size, CS_MPI_REAL, dist_rank, tag, comm,
+                  &(request[rank_id-1]));
       }
+
+      MPI_Waitall(c->merge_sub_size - 1, request, MPI_STATUSES_IGNORE);
+
+      if (request != _request)
+        BFT_FREE(request);
     }
     else
       MPI_Send(c_var, c->n_elts_r[0]*db_size, CS_MPI_REAL,
@@ -6982,18 +7196,31 @@ cs_grid_prolong_row_var(cs_dispatch_context  &ctx,
     MPI_Comm  comm = cs_glob_mpi_comm;
     static const int tag = 'p'+'r'+'o'+'l'+'o'+'n'+'g';
 
-    /* Append data */
+    /* Scatter data: all sends are posted at once on the gathering rank,
+       so latency is not multiplied by the number of merged ranks */
 
     if (c->merge_sub_rank == 0) {
-      int rank_id;
+
+      MPI_Request _request[128];
+      MPI_Request *request = _request;
+
+      if (c->merge_sub_size - 1 > 128)
+        BFT_MALLOC(request, c->merge_sub_size - 1, MPI_Request);
+
       assert(cs_glob_rank_id == c->merge_sub_root);
-      for (rank_id = 1; rank_id < c->merge_sub_size; rank_id++) {
+      for (int rank_id = 1; rank_id < c->merge_sub_size; rank_id++) {
         cs_lnum_t n_send = (  c->merge_cell_idx[rank_id+1]
                             - c->merge_cell_idx[rank_id]);
         int dist_rank = c->merge_sub_root + c->merge_stride*rank_id;
-        MPI_Send(c_var + c->merge_cell_idx[rank_id]*db_size,
-                 n_send*db_size, CS_MPI_REAL, dist_rank, tag, comm);
+        MPI_Isend(c_var + c->merge_cell_idx[rank_id]*db_size,
+                  n_send*db_size, CS_MPI_REAL, dist_rank, tag, comm,
+                  &(request[rank_id-1]));
       }
+
+      MPI_Waitall(c->merge_sub_size - 1, request, MPI_STATUSES_IGNORE);
+
+      if (request != _request)
+        BFT_FREE(request);
     }
     else {
       MPI_Status status;
@@ -342,6 +342,33 @@ cs_grid_coarsen_to_single(const cs_grid_t  *f,
                           int               merge_stride,
                           int               verbosity);
 
+/*----------------------------------------------------------------------------
+ * Update matrix coefficients of an existing coarse grid from a fine grid.
+ *
+ * This re-runs the Galerkin projection of matrix values using the
+ * aggregation and coarse matrix structure computed by a previous call to
+ * cs_grid_coarsen, so it may only be used when the fine grid's matrix
+ * structure (and aggregation quality) is unchanged, and only its
+ * coefficient values have been modified.
+ *
+ * The coarse grid's parent pointer is updated to the given fine grid.
+ *
+ * Currently limited to the default (MSR, non-relaxed, non-merged) coarse
+ * grid construction; in other cases, 1 is returned and the grid is not
+ * modified, so the caller should fall back to a full coarsening.
+ *
+ * parameters:
+ *   c <-> Coarse grid structure
+ *   f <-- Fine grid structure
+ *
+ * returns:
+ *   0 if coefficients were updated, 1 if a full rebuild is required
+ *----------------------------------------------------------------------------*/
+
+int
+cs_grid_update_coefficients(cs_grid_t        *c,
+                            const cs_grid_t  *f);
+
 /*----------------------------------------------------------------------------
  * Project coarse grid row numbers to base grid.
  *
@@ -4180,6 +4180,46 @@ _matrix_create(cs_matrix_type_t  type)
   return m;
 }
 
+/*----------------------------------------------------------------------------
+ * Release matrix-free (mesh-based) operator data.
+ *
+ * The default matrix.vector product functions for the matrix's fill type
+ * are restored.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_unset_mesh_map(cs_matrix_t  *matrix)
+{
+  cs_matrix_mesh_map_t  *mm = (cs_matrix_mesh_map_t *)matrix->ext_lib_map;
+
+  if (mm == NULL)
+    return;
+
+  cs_matrix_coeff_dist_t  *mc = (cs_matrix_coeff_dist_t *)matrix->coeffs;
+  if (mc->d_val == mm->da)
+    mc->d_val = NULL;
+
+  BFT_FREE(mm->da);
+  BFT_FREE(matrix->ext_lib_map);
+  matrix->destroy_adaptor = NULL;
+
+  /* Restore default matrix.vector product functions */
+
+  if (matrix->fill_type < CS_MATRIX_N_FILL_TYPES) {
+    char xy_hd[CS_MATRIX_SPMV_N_TYPES];
+    cs_matrix_spmv_set_func(matrix->type,
+                            matrix->fill_type,
+                            CS_MATRIX_SPMV_N_TYPES,
+                            matrix->numbering,
+                            NULL, /* func_name */
+                            matrix->vector_multiply[matrix->fill_type],
+                            xy_hd);
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -5118,6 +5158,127 @@ cs_matrix_set_coefficients(cs_matrix_t        *matrix,
        cs_matrix_fill_type_name[matrix->fill_type]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set matrix coefficients in matrix-free (mesh-based) form, for a
+ * symmetric, scalar, diffusion-type system.
+ *
+ * Extra-diagonal coefficients are not assembled: the face values array is
+ * mapped (not copied), and the matrix.vector product computes the terms
+ * scale*f_val[edge] on the fly. Only the diagonal,
+ * da[i] = d_base[i] - scale * (sum of f_val over adjacent edges),
+ * is assembled. For a diffusion matrix matching that built by
+ * \ref cs_sym_matrix_scalar, scale should be -thetap, f_val the interior
+ * face diffusion coefficient, and d_base should combine the rovsdt and
+ * boundary face contributions.
+ *
+ * This mode is only available with the \ref CS_MATRIX_NATIVE format.
+ * As extra-diagonal values are implicit, functions querying or copying
+ * matrix coefficients should not be used with a matrix in this state.
+ *
+ * The matrix becomes unusable if the f_val array passed here is modified
+ * or freed (its coefficients should be released first to mark this).
+ *
+ * \param[in, out]  matrix   pointer to matrix structure
+ * \param[in]       scale    multiplier applied to face values
+ * \param[in]       n_edges  local number of graph edges
+ * \param[in]       edges    edges (row <-> column) connectivity
+ * \param[in]       d_base   base diagonal values (NULL if zero)
+ * \param[in]       f_val    face-based values (NULL if zero)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_mesh(cs_matrix_t        *matrix,
+                                double              scale,
+                                const cs_lnum_t     n_edges,
+                                const cs_lnum_2_t   edges[],
+                                const cs_real_t    *d_base,
+                                const cs_real_t    *f_val)
+{
+  if (matrix == NULL)
+    bft_error(__FILE__, __LINE__, 0, _("The matrix is not defined."));
+
+  if (matrix->type != CS_MATRIX_NATIVE)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       "Matrix format %s does not handle matrix-free (mesh-based)\n"
+       "coefficient assignment.",
+       matrix->type_name);
+
+  if (matrix->destroy_adaptor != NULL)
+    matrix->destroy_adaptor(matrix);
+
+  /* Set the fill type (symmetric, scalar) */
+
+  _set_fill_info(matrix, true, 1, 1);
+
+  /* Assemble the diagonal */
+
+  const cs_lnum_t n_rows = matrix->n_rows;
+  const cs_lnum_t n_cols_ext = matrix->n_cols_ext;
+
+  cs_matrix_mesh_map_t  *mm;
+  BFT_MALLOC(mm, 1, cs_matrix_mesh_map_t);
+  mm->scale = scale;
+  BFT_MALLOC(mm->da, n_cols_ext, cs_real_t);
+
+  cs_real_t  *restrict da = mm->da;
+
+  if (d_base != NULL) {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      da[ii] = d_base[ii];
+  }
+  else {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      da[ii] = 0.;
+  }
+  for (cs_lnum_t ii = n_rows; ii < n_cols_ext; ii++)
+    da[ii] = 0.;
+
+  if (f_val != NULL) {
+    for (cs_lnum_t edge_id = 0; edge_id < n_edges; edge_id++) {
+      cs_lnum_t ii = edges[edge_id][0];
+      cs_lnum_t jj = edges[edge_id][1];
+      cs_real_t aij = scale * f_val[edge_id];
+      da[ii] -= aij;
+      da[jj] -= aij;
+    }
+  }
+
+  /* Map the coefficients (matrix->xa is left NULL, as the assembled
+     extra-diagonal values it refers to do not exist in this mode) */
+
+  matrix->xa = NULL;
+  matrix->set_coefficients(matrix, true, false, n_edges, edges, mm->da, f_val);
+
+  /* Attach operator data and install the matrix-free
+     matrix.vector product functions */
+
+  matrix->ext_lib_map = mm;
+  matrix->destroy_adaptor = _unset_mesh_map;
+
+  char xy_hd[CS_MATRIX_SPMV_N_TYPES];
+  int retcode = cs_matrix_spmv_set_func(matrix->type,
+                                        matrix->fill_type,
+                                        CS_MATRIX_SPMV_N_TYPES,
+                                        matrix->numbering,
+                                        "mesh",
+                                        matrix->vector_multiply
+                                          [matrix->fill_type],
+                                        xy_hd);
+
+  if (retcode != 0)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       "Assignment of a matrix-free matrix.vector product for\n"
+       "matrix format %s with fill type %s failed.",
+       matrix->type_name,
+       cs_matrix_fill_type_name[matrix->fill_type]);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set matrix coefficients, copying values to private arrays.
@@ -6412,6 +6573,27 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
                  &n_variants_max,
                  m_variant);
 
+    if (   m->fill_type == CS_MATRIX_SCALAR
+        || m->fill_type == CS_MATRIX_SCALAR_SYM) {
+      _variant_add(_("MSR, SELL-C-sigma"),
+                   m->type,
+                   m->fill_type,
+                   m->numbering,
+                   "sell",
+                   n_variants,
+                   &n_variants_max,
+                   m_variant);
+
+      _variant_add(_("MSR, structured blocks"),
+                   m->type,
+                   m->fill_type,
+                   m->numbering,
+                   "struct",
+                   n_variants,
+                   &n_variants_max,
+                   m_variant);
+    }
+
 #if defined(HAVE_MKL_SPARSE_IE)
 
     _variant_add(_("MSR, with MKL"),
@@ -6590,6 +6772,8 @@ cs_matrix_variant_apply_tuned(cs_matrix_t          *m,
  *     default
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     omp_sched       (For OpenMP with scheduling)
+ *     sell            (SELL-C-sigma storage, for CS_MATRIX_SCALAR*)
+ *     struct          (structured-block fast path, for CS_MATRIX_SCALAR*)
  *
  * parameters:
  *   mv         <->  pointer to matrix variant
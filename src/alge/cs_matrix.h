@@ -559,6 +559,43 @@ cs_matrix_set_coefficients(cs_matrix_t        *matrix,
                            const cs_real_t    *da,
                            const cs_real_t    *xa);
 
+/*----------------------------------------------------------------------------
+ * Set matrix coefficients in matrix-free (mesh-based) form, for a
+ * symmetric, scalar, diffusion-type system.
+ *
+ * Extra-diagonal coefficients are not assembled: the face values array is
+ * mapped (not copied), and the matrix.vector product computes the terms
+ * scale*f_val[edge] on the fly. Only the diagonal,
+ * da[i] = d_base[i] - scale * (sum of f_val over adjacent edges),
+ * is assembled. For a diffusion matrix matching that built by
+ * cs_sym_matrix_scalar, scale should be -thetap, f_val the interior
+ * face diffusion coefficient, and d_base should combine the rovsdt and
+ * boundary face contributions.
+ *
+ * This mode is only available with the CS_MATRIX_NATIVE format.
+ * As extra-diagonal values are implicit, functions querying or copying
+ * matrix coefficients should not be used with a matrix in this state.
+ *
+ * The matrix becomes unusable if the f_val array passed here is modified
+ * or freed (its coefficients should be released first to mark this).
+ *
+ * parameters:
+ *   matrix  <-> pointer to matrix structure
+ *   scale   <-- multiplier applied to face values
+ *   n_edges <-- local number of graph edges
+ *   edges   <-- edges (row <-> column) connectivity
+ *   d_base  <-- base diagonal values (NULL if zero)
+ *   f_val   <-- face-based values (NULL if zero)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_mesh(cs_matrix_t        *matrix,
+                                double              scale,
+                                const cs_lnum_t     n_edges,
+                                const cs_lnum_2_t   edges[],
+                                const cs_real_t    *d_base,
+                                const cs_real_t    *f_val);
+
 /*----------------------------------------------------------------------------
  * Set matrix coefficients, copying values to private arrays.
  *
@@ -1132,6 +1169,8 @@ cs_matrix_variant_apply_tuned(cs_matrix_t          *m,
  *     default
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     omp_sched       (For OpenMP with scheduling)
+ *     sell            (SELL-C-sigma storage, for CS_MATRIX_SCALAR*)
+ *     struct          (structured-block fast path, for CS_MATRIX_SCALAR*)
  *
  * parameters:
  *   mv         <->  pointer to matrix variant
@@ -37,6 +37,10 @@
 #include <stdio.h>
 #include <string.h>
 
+#if defined(HAVE_OPENMP)
+#include <omp.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -122,6 +126,32 @@ BEGIN_C_DECLS
  * Local Structure Definitions
  *============================================================================*/
 
+/* Assembly plan structure, precomputing insertion positions and a
+   conflict-free thread schedule for a fixed set of contributing elements
+   (see \ref cs_matrix_assembler_plan_create). */
+
+struct _cs_matrix_assembler_plan_t {
+
+  const cs_matrix_assembler_t  *ma;  /* associated assembler (shared) */
+
+  cs_lnum_t    n_elts;    /* number of contributing elements */
+  cs_lnum_t    stride;    /* number of DoFs per element */
+
+  cs_lnum_t   *dof_id;    /* local DoF (row) ids (n_elts * stride) */
+  cs_lnum_t   *col_idx;   /* insertion position of each (i, j) DoF pair
+                             inside row i (n_elts * stride * stride) */
+
+  /* Thread schedule: elements are grouped in n_threads + 1 bins; elements
+     of bin t < n_threads only contribute to rows owned by thread t, so
+     those bins may be processed concurrently; the last bin holds elements
+     spanning several row ranges, processed separately */
+
+  int          n_threads;  /* number of conflict-free bins */
+  cs_lnum_t   *bin_idx;    /* start of each bin in elt_id (n_threads + 2) */
+  cs_lnum_t   *elt_id;     /* element ids, ordered by bin (n_elts) */
+
+};
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -2344,6 +2374,96 @@ _matrix_assembler_values_add_lg_g(cs_matrix_assembler_values_t  *mav,
 
 #endif /* HAVE_MPI */
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the contributions of a range of planned elements to a matrix
+ *        assembler values structure.
+ *
+ * When called concurrently, the given ranges must map to bins of the plan's
+ * thread schedule, so that no two threads contribute to the same row.
+ *
+ * \param[in]       plan      pointer to matrix assembler plan structure
+ * \param[in, out]  mav       pointer to matrix assembler values structure
+ * \param[in]       b_s_id    start id of range in plan->elt_id
+ * \param[in]       b_e_id    past-the-end id of range in plan->elt_id
+ * \param[in]       b_stride  block stride associated with matrix values
+ * \param[in]       val       element matrix values
+ *                            (size: n_elts * stride * stride * b_stride)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_plan_add_values(const cs_matrix_assembler_plan_t  *plan,
+                 cs_matrix_assembler_values_t      *mav,
+                 cs_lnum_t                          b_s_id,
+                 cs_lnum_t                          b_e_id,
+                 cs_lnum_t                          b_stride,
+                 const cs_real_t                    val[])
+{
+  const cs_matrix_assembler_t  *ma = plan->ma;
+
+  const cs_lnum_t stride = plan->stride;
+  const cs_lnum_t ss = stride*stride;
+
+  cs_lnum_t s_row_id[COEFF_GROUP_SIZE];
+  cs_lnum_t s_col_id[COEFF_GROUP_SIZE];
+
+  assert(stride <= COEFF_GROUP_SIZE);
+
+  for (cs_lnum_t i = b_s_id; i < b_e_id; i++) {
+
+    const cs_lnum_t e_id = plan->elt_id[i];
+
+    const cs_lnum_t  *e_dof_id = plan->dof_id + e_id*stride;
+    const cs_lnum_t  *e_col_idx = plan->col_idx + e_id*ss;
+    const cs_real_t  *e_val = val + e_id*ss*b_stride;
+
+    for (cs_lnum_t r = 0; r < stride; r++) {
+
+      for (cs_lnum_t j = 0; j < stride; j++)
+        s_row_id[j] = e_dof_id[r];
+
+      /* Direct indexed stores where possible, using the insertion
+         positions computed at plan creation */
+
+      if (mav->add_values != NULL) {
+
+        if (ma->separate_diag == mav->separate_diag)
+          mav->add_values(mav->matrix,
+                          stride,
+                          b_stride,
+                          s_row_id,
+                          e_col_idx + r*stride,
+                          e_val + r*stride*b_stride);
+
+        else
+          _matrix_assembler_values_add_cnv_idx(mav,
+                                               stride,
+                                               b_stride,
+                                               s_row_id,
+                                               e_col_idx + r*stride,
+                                               e_val + r*stride*b_stride);
+
+      }
+
+      /* Global id-based functions (external libraries) maintain their own
+         insertion logic, so fall back to the id-based path */
+
+      else {
+        for (cs_lnum_t j = 0; j < stride; j++)
+          s_col_id[j] = e_dof_id[j];
+        cs_matrix_assembler_values_add(mav,
+                                       stride,
+                                       s_row_id,
+                                       s_col_id,
+                                       e_val + r*stride*b_stride);
+      }
+
+    }
+
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -3248,6 +3368,221 @@ cs_matrix_assembler_values_add(cs_matrix_assembler_values_t  *mav,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add values to a matrix assembler values structure using local
+ *        row and column ids, with internal thread parallelism.
+ *
+ * Contrary to \ref cs_matrix_assembler_values_add, contributions to shared
+ * rows are allowed here, so no caller-side coloring or row partitioning
+ * constraint applies: this function parallelizes internally, using a
+ * two-phase scheme in which entries are first bucketed into thread-private
+ * bins based on a partitioning of rows into contiguous per-thread ranges,
+ * then sorted by row (using a counting sort) and merged by the single
+ * thread owning each row range, so no atomic operations are needed either.
+ *
+ * The restrictions of \ref cs_matrix_assembler_values_add relative to
+ * block sizes apply here also, and all entries of a given call must
+ * relate to the same type of coefficients (diagonal or extra-diagonal).
+ *
+ * This function must be called outside of an OpenMP parallel section.
+ *
+ * \param[in, out]  mav     pointer to matrix assembler values structure
+ * \param[in]       n       number of entries
+ * \param[in]       row_id  local row ids associated with entries
+ * \param[in]       col_id  local column ids associated with entries
+ * \param[in]       val     values associated with entries
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_values_add_parallel(cs_matrix_assembler_values_t  *mav,
+                                        cs_lnum_t                      n,
+                                        const cs_lnum_t                row_id[],
+                                        const cs_lnum_t                col_id[],
+                                        const cs_real_t                val[])
+{
+#if defined(HAVE_OPENMP)
+
+  const cs_matrix_assembler_t  *ma = mav->ma;
+
+  const int  n_t = cs_glob_n_threads;
+  const cs_lnum_t  n_rows = ma->n_rows;
+
+  if (   n_t < 2 || n < (cs_lnum_t)n_t * COEFF_GROUP_SIZE
+      || n_rows < (cs_lnum_t)n_t || mav->add_values == NULL) {
+    cs_matrix_assembler_values_add(mav, n, row_id, col_id, val);
+    return;
+  }
+
+  /* Base stride on first type of value encountered; as with
+     cs_matrix_assembler_values_add, all entries of a given call are
+     assumed to relate to the same type of coefficients */
+
+  cs_lnum_t stride = 0;
+  if (row_id[0] == col_id[0])
+    stride = mav->db_size * mav->db_size;
+  else
+    stride = mav->eb_size * mav->eb_size;
+
+  const cs_lnum_t  r_block_size = (n_rows + n_t - 1) / n_t;
+  const cs_lnum_t  e_block_size = (n + n_t - 1) / n_t;
+
+  /* Shared bin index: segment (o*n_t + t) holds entries scanned by
+     thread t and owned by thread o, segments being owner-major so each
+     owner's bin is contiguous after the exclusive scan */
+
+  cs_lnum_t  *bin_idx, *order;
+  BFT_MALLOC(bin_idx, (cs_lnum_t)n_t*n_t + 1, cs_lnum_t);
+  BFT_MALLOC(order, n, cs_lnum_t);
+
+# pragma omp parallel num_threads(n_t)
+  {
+    const int  t_id = omp_get_thread_num();
+
+    const cs_lnum_t  s_id = CS_MIN(e_block_size*t_id, n);
+    const cs_lnum_t  e_id = CS_MIN(s_id + e_block_size, n);
+
+    /* Phase 1: bucket entries into thread-private bins */
+
+    cs_lnum_t  *l_count;
+    BFT_MALLOC(l_count, n_t, cs_lnum_t);
+    for (int o = 0; o < n_t; o++)
+      l_count[o] = 0;
+
+    for (cs_lnum_t i = s_id; i < e_id; i++)
+      l_count[row_id[i] / r_block_size] += 1;
+
+    for (int o = 0; o < n_t; o++)
+      bin_idx[(cs_lnum_t)o*n_t + t_id] = l_count[o];
+
+#   pragma omp barrier
+
+#   pragma omp single
+    {
+      cs_lnum_t c_sum = 0;
+      for (cs_lnum_t i = 0; i < (cs_lnum_t)n_t*n_t; i++) {
+        cs_lnum_t c = bin_idx[i];
+        bin_idx[i] = c_sum;
+        c_sum += c;
+      }
+      bin_idx[(cs_lnum_t)n_t*n_t] = c_sum;
+      assert(c_sum == n);
+    }
+
+    for (int o = 0; o < n_t; o++)
+      l_count[o] = bin_idx[(cs_lnum_t)o*n_t + t_id];
+
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      int o = row_id[i] / r_block_size;
+      order[l_count[o]++] = i;
+    }
+
+#   pragma omp barrier
+
+    /* Phase 2: each thread sorts its own bin by row (counting sort)
+       and merges the matching contributions */
+
+    const cs_lnum_t  r0 = CS_MIN(r_block_size*t_id, n_rows);
+    const cs_lnum_t  r1 = CS_MIN(r0 + r_block_size, n_rows);
+
+    const cs_lnum_t  b_s_id = bin_idx[(cs_lnum_t)t_id*n_t];
+    const cs_lnum_t  b_e_id = bin_idx[(cs_lnum_t)(t_id+1)*n_t];
+    const cs_lnum_t  b_n = b_e_id - b_s_id;
+
+    if (b_n > 0) {
+
+      cs_lnum_t  *r_count, *b_order;
+      BFT_MALLOC(r_count, r1 - r0 + 1, cs_lnum_t);
+      BFT_MALLOC(b_order, b_n, cs_lnum_t);
+
+      for (cs_lnum_t i = 0; i < r1 - r0 + 1; i++)
+        r_count[i] = 0;
+
+      for (cs_lnum_t i = b_s_id; i < b_e_id; i++)
+        r_count[row_id[order[i]] - r0 + 1] += 1;
+
+      for (cs_lnum_t i = 0; i < r1 - r0; i++)
+        r_count[i+1] += r_count[i];
+
+      for (cs_lnum_t i = b_s_id; i < b_e_id; i++) {
+        cs_lnum_t e = order[i];
+        b_order[r_count[row_id[e] - r0]++] = e;
+      }
+
+      /* Gather sorted entries by groups and add them through the
+         standard (index-based) assembly path; threads are safe here
+         as each row belongs to a single thread's range */
+
+      cs_lnum_t  s_row_id[COEFF_GROUP_SIZE];
+      cs_lnum_t  s_col_idx[COEFF_GROUP_SIZE];
+      cs_real_t  *s_val;
+      BFT_MALLOC(s_val, (cs_lnum_t)COEFF_GROUP_SIZE*stride, cs_real_t);
+
+      for (cs_lnum_t i = 0; i < b_n; i += COEFF_GROUP_SIZE) {
+
+        cs_lnum_t b_size = COEFF_GROUP_SIZE;
+        if (i + COEFF_GROUP_SIZE > b_n)
+          b_size = b_n - i;
+
+        for (cs_lnum_t j = 0; j < b_size; j++) {
+
+          cs_lnum_t e = b_order[i+j];
+
+          cs_lnum_t l_r_id = row_id[e];
+          cs_lnum_t n_cols = ma->r_idx[l_r_id+1] - ma->r_idx[l_r_id];
+
+          s_row_id[j] = l_r_id;
+          s_col_idx[j] = _l_id_binary_search(n_cols,
+                                             col_id[e],
+                                             ma->c_id + ma->r_idx[l_r_id]);
+
+          assert(   s_col_idx[j] > -1
+                 || (ma->separate_diag && col_id[e] == l_r_id));
+
+          for (cs_lnum_t l = 0; l < stride; l++)
+            s_val[j*stride + l] = val[e*stride + l];
+
+        }
+
+        if (ma->separate_diag == mav->separate_diag)
+          mav->add_values(mav->matrix,
+                          b_size,
+                          stride,
+                          s_row_id,
+                          s_col_idx,
+                          s_val);
+
+        else
+          _matrix_assembler_values_add_cnv_idx(mav,
+                                               b_size,
+                                               stride,
+                                               s_row_id,
+                                               s_col_idx,
+                                               s_val);
+
+      }
+
+      BFT_FREE(s_val);
+      BFT_FREE(b_order);
+      BFT_FREE(r_count);
+
+    }
+
+    BFT_FREE(l_count);
+
+  } /* End of OpenMP parallel section */
+
+  BFT_FREE(order);
+  BFT_FREE(bin_idx);
+
+#else
+
+  cs_matrix_assembler_values_add(mav, n, row_id, col_id, val);
+
+#endif /* HAVE_OPENMP */
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add values to a matrix assembler values structure using global
@@ -3656,6 +3991,239 @@ cs_matrix_assembler_values_done(cs_matrix_assembler_values_t  *mav)
     mav->assembly_begin(mav->matrix);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a matrix assembler plan for a fixed set of contributing
+ *        elements.
+ *
+ * An assembly plan maps each element to a fixed list of local DoFs (matrix
+ * rows), each element contributing a dense local matrix coupling its DoFs.
+ * The plan precomputes the insertion position of every (row, column) pair
+ * in the assembled matrix rows, as well as a conflict-free thread schedule,
+ * so that repeated assembly passes over the same elements (such as once per
+ * time step or per nonlinear iteration) reduce to direct indexed stores,
+ * with no per-entry searches; the searches and scheduling are done once,
+ * at plan creation.
+ *
+ * All DoF ids must be local, and present as columns of the associated
+ * assembler (the same restriction as with
+ * \ref cs_matrix_assembler_values_add).
+ *
+ * The plan maintains a pointer to the associated assembler, which must not
+ * be destroyed before it, and may be used with any values structure based
+ * on that same assembler.
+ *
+ * \param[in]  ma      pointer to matrix assembler structure
+ * \param[in]  n_elts  number of contributing elements
+ * \param[in]  stride  number of DoFs per element
+ * \param[in]  dof_id  local DoF ids of each element (size: n_elts * stride)
+ *
+ * \return  pointer to created matrix assembler plan structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_assembler_plan_t *
+cs_matrix_assembler_plan_create(const cs_matrix_assembler_t  *ma,
+                                cs_lnum_t                     n_elts,
+                                cs_lnum_t                     stride,
+                                const cs_lnum_t               dof_id[])
+{
+  cs_matrix_assembler_plan_t  *plan;
+
+  assert(stride <= COEFF_GROUP_SIZE);
+
+  BFT_MALLOC(plan, 1, cs_matrix_assembler_plan_t);
+
+  plan->ma = ma;
+  plan->n_elts = n_elts;
+  plan->stride = stride;
+
+  BFT_MALLOC(plan->dof_id, n_elts*stride, cs_lnum_t);
+  memcpy(plan->dof_id, dof_id, sizeof(cs_lnum_t)*n_elts*stride);
+
+  /* Precompute insertion positions, replacing the per-entry binary
+     searches of the standard assembly paths */
+
+  const cs_lnum_t ss = stride*stride;
+
+  BFT_MALLOC(plan->col_idx, n_elts*ss, cs_lnum_t);
+
+# pragma omp parallel for  if(n_elts > THR_MIN)
+  for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {
+
+    const cs_lnum_t  *e_dof_id = dof_id + e_id*stride;
+    cs_lnum_t  *e_col_idx = plan->col_idx + e_id*ss;
+
+    for (cs_lnum_t i = 0; i < stride; i++) {
+
+      cs_lnum_t l_r_id = e_dof_id[i];
+      cs_lnum_t n_cols = ma->r_idx[l_r_id+1] - ma->r_idx[l_r_id];
+
+      for (cs_lnum_t j = 0; j < stride; j++) {
+        e_col_idx[i*stride + j]
+          = _l_id_binary_search(n_cols,
+                                e_dof_id[j],
+                                ma->c_id + ma->r_idx[l_r_id]);
+        assert(   e_col_idx[i*stride + j] > -1
+               || (ma->separate_diag && e_dof_id[j] == l_r_id));
+      }
+
+    }
+
+  }
+
+  /* Thread schedule: rows are partitioned into contiguous per-thread
+     ranges, and elements whose DoFs all fall in a single range are
+     binned by owning thread (counting sort); the remainder goes to a
+     final spill bin, handled separately */
+
+  const int  n_t = cs_glob_n_threads;
+  const cs_lnum_t  r_block_size = (ma->n_rows + n_t - 1) / n_t;
+
+  plan->n_threads = n_t;
+
+  BFT_MALLOC(plan->bin_idx, n_t + 2, cs_lnum_t);
+  BFT_MALLOC(plan->elt_id, n_elts, cs_lnum_t);
+
+  int  *elt_bin;
+  BFT_MALLOC(elt_bin, n_elts, int);
+
+  for (int t_id = 0; t_id < n_t + 2; t_id++)
+    plan->bin_idx[t_id] = 0;
+
+# pragma omp parallel for  if(n_elts > THR_MIN)
+  for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {
+    const cs_lnum_t  *e_dof_id = dof_id + e_id*stride;
+    int o = e_dof_id[0] / r_block_size;
+    for (cs_lnum_t i = 1; i < stride; i++) {
+      if (e_dof_id[i] / r_block_size != o)
+        o = n_t;
+    }
+    elt_bin[e_id] = o;
+  }
+
+  for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++)
+    plan->bin_idx[elt_bin[e_id] + 1] += 1;
+
+  for (int t_id = 0; t_id < n_t + 1; t_id++)
+    plan->bin_idx[t_id + 1] += plan->bin_idx[t_id];
+
+  {
+    cs_lnum_t  *shift;
+    BFT_MALLOC(shift, n_t + 1, cs_lnum_t);
+    for (int t_id = 0; t_id < n_t + 1; t_id++)
+      shift[t_id] = plan->bin_idx[t_id];
+
+    for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++)
+      plan->elt_id[shift[elt_bin[e_id]]++] = e_id;
+
+    BFT_FREE(shift);
+  }
+
+  BFT_FREE(elt_bin);
+
+  return plan;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a matrix assembler plan structure.
+ *
+ * \param[in, out]  plan  pointer to matrix assembler plan structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_plan_destroy(cs_matrix_assembler_plan_t  **plan)
+{
+  if (plan != NULL && *plan != NULL) {
+
+    cs_matrix_assembler_plan_t  *_plan = *plan;
+
+    BFT_FREE(_plan->elt_id);
+    BFT_FREE(_plan->bin_idx);
+    BFT_FREE(_plan->col_idx);
+    BFT_FREE(_plan->dof_id);
+
+    BFT_FREE(*plan);
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add values to a matrix assembler values structure following a
+ *        previously computed assembly plan.
+ *
+ * Values are expected as dense element matrices, in element-major, then
+ * row-major order, matching the DoF lists the plan was created with.
+ *
+ * This function parallelizes internally using the plan's thread schedule,
+ * and must be called outside of an OpenMP parallel section.
+ *
+ * As with \ref cs_matrix_assembler_values_add, the associated matrix
+ * diagonal and extra-diagonal block sizes must be equal, as element
+ * matrices mix both types of coefficients.
+ *
+ * \param[in]       plan  pointer to matrix assembler plan structure
+ * \param[in, out]  mav   pointer to matrix assembler values structure
+ * \param[in]       val   element matrix values
+ *                        (size: n_elts * stride * stride * block stride)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_plan_values_add(const cs_matrix_assembler_plan_t  *plan,
+                                    cs_matrix_assembler_values_t      *mav,
+                                    const cs_real_t                    val[])
+{
+  assert(mav->ma == plan->ma);
+  assert(mav->db_size == mav->eb_size);
+
+  const cs_lnum_t  b_stride = mav->eb_size * mav->eb_size;
+  const int  n_t = plan->n_threads;
+
+#if defined(HAVE_OPENMP)
+
+  /* Global id-based functions (external libraries) are not assumed to
+     be thread-safe, so only the direct indexed path is threaded */
+
+  if (mav->add_values != NULL) {
+
+#   pragma omp parallel num_threads(n_t)
+    {
+      const int  t_id = omp_get_thread_num();
+      _plan_add_values(plan,
+                       mav,
+                       plan->bin_idx[t_id],
+                       plan->bin_idx[t_id + 1],
+                       b_stride,
+                       val);
+    }
+
+    /* Spill bin: elements spanning several row ranges */
+
+    _plan_add_values(plan,
+                     mav,
+                     plan->bin_idx[n_t],
+                     plan->bin_idx[n_t + 1],
+                     b_stride,
+                     val);
+
+    return;
+
+  }
+
+#endif /* HAVE_OPENMP */
+
+  _plan_add_values(plan,
+                   mav,
+                   plan->bin_idx[0],
+                   plan->bin_idx[n_t + 1],
+                   b_stride,
+                   val);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
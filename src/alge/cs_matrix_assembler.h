@@ -64,6 +64,10 @@ typedef struct _cs_matrix_assembler_t  cs_matrix_assembler_t;
 
 typedef struct _cs_matrix_assembler_values_t  cs_matrix_assembler_values_t;
 
+/*! Structure used to plan repeated assembly of a fixed set of elements */
+
+typedef struct _cs_matrix_assembler_plan_t  cs_matrix_assembler_plan_t;
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Function pointer for initialization of matrix coefficients using
@@ -615,6 +619,115 @@ cs_matrix_assembler_values_add(cs_matrix_assembler_values_t  *mav,
                                const cs_lnum_t                col_id[],
                                const cs_real_t                val[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add values to a matrix assembler values structure using local
+ *        row and column ids, with internal thread parallelism.
+ *
+ * Contrary to \ref cs_matrix_assembler_values_add, contributions to shared
+ * rows are allowed here, so no caller-side coloring or row partitioning
+ * constraint applies: this function parallelizes internally, using a
+ * two-phase scheme in which entries are first bucketed into thread-private
+ * bins based on a partitioning of rows into contiguous per-thread ranges,
+ * then sorted by row (using a counting sort) and merged by the single
+ * thread owning each row range, so no atomic operations are needed either.
+ *
+ * The restrictions of \ref cs_matrix_assembler_values_add relative to
+ * block sizes apply here also, and all entries of a given call must
+ * relate to the same type of coefficients (diagonal or extra-diagonal).
+ *
+ * This function must be called outside of an OpenMP parallel section.
+ *
+ * \param[in, out]  mav     pointer to matrix assembler values structure
+ * \param[in]       n       number of entries
+ * \param[in]       row_id  local row ids associated with entries
+ * \param[in]       col_id  local column ids associated with entries
+ * \param[in]       val     values associated with entries
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_values_add_parallel(cs_matrix_assembler_values_t  *mav,
+                                        cs_lnum_t                      n,
+                                        const cs_lnum_t                row_id[],
+                                        const cs_lnum_t                col_id[],
+                                        const cs_real_t                val[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a matrix assembler plan for a fixed set of contributing
+ *        elements.
+ *
+ * An assembly plan maps each element to a fixed list of local DoFs (matrix
+ * rows), each element contributing a dense local matrix coupling its DoFs.
+ * The plan precomputes the insertion position of every (row, column) pair
+ * in the assembled matrix rows, as well as a conflict-free thread schedule,
+ * so that repeated assembly passes over the same elements (such as once per
+ * time step or per nonlinear iteration) reduce to direct indexed stores,
+ * with no per-entry searches; the searches and scheduling are done once,
+ * at plan creation.
+ *
+ * All DoF ids must be local, and present as columns of the associated
+ * assembler (the same restriction as with
+ * \ref cs_matrix_assembler_values_add).
+ *
+ * The plan maintains a pointer to the associated assembler, which must not
+ * be destroyed before it, and may be used with any values structure based
+ * on that same assembler.
+ *
+ * \param[in]  ma      pointer to matrix assembler structure
+ * \param[in]  n_elts  number of contributing elements
+ * \param[in]  stride  number of DoFs per element
+ * \param[in]  dof_id  local DoF ids of each element (size: n_elts * stride)
+ *
+ * \return  pointer to created matrix assembler plan structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_assembler_plan_t *
+cs_matrix_assembler_plan_create(const cs_matrix_assembler_t  *ma,
+                                cs_lnum_t                     n_elts,
+                                cs_lnum_t                     stride,
+                                const cs_lnum_t               dof_id[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a matrix assembler plan structure.
+ *
+ * \param[in, out]  plan  pointer to matrix assembler plan structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_plan_destroy(cs_matrix_assembler_plan_t  **plan);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add values to a matrix assembler values structure following a
+ *        previously computed assembly plan.
+ *
+ * Values are expected as dense element matrices, in element-major, then
+ * row-major order, matching the DoF lists the plan was created with.
+ *
+ * This function parallelizes internally using the plan's thread schedule,
+ * and must be called outside of an OpenMP parallel section.
+ *
+ * As with \ref cs_matrix_assembler_values_add, the associated matrix
+ * diagonal and extra-diagonal block sizes must be equal, as element
+ * matrices mix both types of coefficients.
+ *
+ * \param[in]       plan  pointer to matrix assembler plan structure
+ * \param[in, out]  mav   pointer to matrix assembler values structure
+ * \param[in]       val   element matrix values
+ *                        (size: n_elts * stride * stride * block stride)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_plan_values_add(const cs_matrix_assembler_plan_t  *plan,
+                                    cs_matrix_assembler_values_t      *mav,
+                                    const cs_real_t                    val[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add values to a matrix assembler values structure using global
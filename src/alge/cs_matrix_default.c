@@ -59,6 +59,7 @@
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
 #include "cs_numbering.h"
+#include "cs_parall.h"
 #include "cs_prototypes.h"
 #include "cs_range_set.h"
 #include "cs_timer.h"
@@ -82,6 +83,7 @@
 #endif
 
 #include "cs_matrix_priv.h"
+#include "cs_matrix_spmv.h"
 #include "cs_matrix_tuning.h"
 
 #include "cs_matrix_default.h"
@@ -135,6 +137,25 @@ static cs_matrix_fill_type_t  *_ext_fill_type = NULL;
 
 static int    _n_min_products = 30;
 
+/* Optional persistent tuning cache, allowing tuning decisions from a
+   previous run of the same case to be reloaded instead of re-measured */
+
+typedef struct {
+
+  int   type;                                 /* matrix type */
+  int   fill_type;                            /* matrix fill type */
+  int   n_variants;                           /* number of saved variants
+                                                 (1, or 3 with device) */
+  char  name[3][CS_MATRIX_SPMV_N_TYPES][32];  /* selected variant names */
+  char  xy_hd[3][CS_MATRIX_SPMV_N_TYPES];     /* h/d/g vector locations */
+
+} _tuning_cache_entry_t;
+
+static char                   *_tuning_cache_file_name = NULL;
+static bool                    _tuning_cache_read = false;
+static int                     _n_tuning_cache_entries = 0;
+static _tuning_cache_entry_t  *_tuning_cache_entries = NULL;
+
 /* Pointer to global (block-based) numbering, if used */
 
 static cs_lnum_t  _row_num_size = 0;
@@ -175,6 +196,296 @@ _initialize_api(void)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Read the persistent SpMV tuning cache file if enabled and not read yet.
+ *
+ * The file is read on rank 0 and broadcast to other ranks.
+ *----------------------------------------------------------------------------*/
+
+static void
+_tuning_cache_load(void)
+{
+  if (_tuning_cache_read || _tuning_cache_file_name == NULL)
+    return;
+
+  _tuning_cache_read = true;
+
+  if (cs_glob_rank_id < 1) {
+
+    FILE *f = fopen(_tuning_cache_file_name, "r");
+
+    if (f != NULL) {
+
+      char line[128];
+
+      while (fgets(line, 128, f) != NULL) {
+
+        int t_id, f_id, n_v;
+
+        if (sscanf(line, "entry %d %d %d", &t_id, &f_id, &n_v) != 3)
+          continue;
+
+        if (   t_id < 0 || t_id >= CS_MATRIX_N_BUILTIN_TYPES
+            || f_id < 0 || f_id >= CS_MATRIX_N_FILL_TYPES
+            || n_v < 1 || n_v > 3)
+          break;
+
+        _tuning_cache_entry_t e;
+        memset(&e, 0, sizeof(e));
+        e.type = t_id;
+        e.fill_type = f_id;
+        e.n_variants = n_v;
+
+        bool ok = true;
+
+        for (int k = 0; k < n_v && ok; k++) {
+          for (int j = 0; j < CS_MATRIX_SPMV_N_TYPES && ok; j++) {
+
+            int _k, _j, pos = 0;
+            char hd;
+
+            if (   fgets(line, 128, f) == NULL
+                || sscanf(line, "%d %d %c %n", &_k, &_j, &hd, &pos) != 3
+                || _k != k || _j != j) {
+              ok = false;
+              break;
+            }
+
+            char *s = line + pos;
+            size_t l = strlen(s);
+            while (l > 0 && (   s[l-1] == '\n' || s[l-1] == '\r'
+                             || s[l-1] == ' '))
+              s[--l] = '\0';
+
+            if (strcmp(s, "-") != 0)
+              strncpy(e.name[k][j], s, 31);
+            e.xy_hd[k][j] = hd;
+
+          }
+        }
+
+        if (ok == false)
+          break;
+
+        BFT_REALLOC(_tuning_cache_entries, _n_tuning_cache_entries + 1,
+                    _tuning_cache_entry_t);
+        _tuning_cache_entries[_n_tuning_cache_entries] = e;
+        _n_tuning_cache_entries += 1;
+
+      }
+
+      fclose(f);
+
+    }
+
+  }
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+    MPI_Bcast(&_n_tuning_cache_entries, 1, MPI_INT, 0, cs_glob_mpi_comm);
+    if (_n_tuning_cache_entries > 0) {
+      if (cs_glob_rank_id > 0)
+        BFT_REALLOC(_tuning_cache_entries, _n_tuning_cache_entries,
+                    _tuning_cache_entry_t);
+      MPI_Bcast(_tuning_cache_entries,
+                _n_tuning_cache_entries*sizeof(_tuning_cache_entry_t),
+                MPI_BYTE, 0, cs_glob_mpi_comm);
+    }
+  }
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Save the persistent SpMV tuning cache to file (rank 0 only).
+ *----------------------------------------------------------------------------*/
+
+static void
+_tuning_cache_save(void)
+{
+  if (cs_glob_rank_id > 0)
+    return;
+
+  FILE *f = fopen(_tuning_cache_file_name, "w");
+
+  if (f == NULL) {
+    bft_printf(_("\n"
+                 "Warning: could not write SpMV tuning cache \"%s\".\n"),
+               _tuning_cache_file_name);
+    return;
+  }
+
+  fprintf(f, "# SpMV tuning cache; remove this file after a mesh,\n"
+             "# partitioning, or build change to force re-tuning.\n");
+
+  for (int i = 0; i < _n_tuning_cache_entries; i++) {
+    const _tuning_cache_entry_t *e = _tuning_cache_entries + i;
+    fprintf(f, "entry %d %d %d\n", e->type, e->fill_type, e->n_variants);
+    for (int k = 0; k < e->n_variants; k++) {
+      for (int j = 0; j < CS_MATRIX_SPMV_N_TYPES; j++) {
+        const char *name = e->name[k][j];
+        char hd = e->xy_hd[k][j];
+        if (hd != 'h' && hd != 'd' && hd != 'g')
+          hd = 'h';
+        fprintf(f, "%d %d %c %s\n", k, j, hd,
+                (name[0] != '\0') ? name : "-");
+      }
+    }
+  }
+
+  fclose(f);
+}
+
+/*----------------------------------------------------------------------------
+ * Add the selected variants for a given matrix to the tuning cache,
+ * and update the cache file.
+ *
+ * parameters:
+ *   m  <-- matrix the variants were tuned for
+ *   mv <-- array of selected variants (1, or 3 with device)
+ *----------------------------------------------------------------------------*/
+
+static void
+_tuning_cache_add(const cs_matrix_t          *m,
+                  const cs_matrix_variant_t  *mv)
+{
+  int n_r_variants = (cs_get_device_id() > -1) ? 3 : 1;
+
+  BFT_REALLOC(_tuning_cache_entries, _n_tuning_cache_entries + 1,
+              _tuning_cache_entry_t);
+
+  _tuning_cache_entry_t *e = _tuning_cache_entries + _n_tuning_cache_entries;
+  _n_tuning_cache_entries += 1;
+
+  memset(e, 0, sizeof(*e));
+  e->type = m->type;
+  e->fill_type = m->fill_type;
+  e->n_variants = n_r_variants;
+
+  for (int k = 0; k < n_r_variants; k++) {
+    for (int j = 0; j < CS_MATRIX_SPMV_N_TYPES; j++) {
+      if (mv[k].vector_multiply[j] != NULL) {
+        strncpy(e->name[k][j], mv[k].name[j], 31);
+        e->name[k][j][31] = '\0';
+        e->xy_hd[k][j] = mv[k].vector_multiply_xy_hd[j];
+      }
+      else
+        e->xy_hd[k][j] = 'h';
+    }
+  }
+
+  _tuning_cache_save();
+}
+
+/*----------------------------------------------------------------------------
+ * Rebuild selected variants from a tuning cache entry.
+ *
+ * Variants are matched by name and vector location in the list of
+ * variants available for the given matrix, so decisions from a build
+ * or run configuration in which some variants are not available are
+ * simply ignored (leading to re-tuning).
+ *
+ * parameters:
+ *   m <-- matrix to build the variants for
+ *   e <-- matching tuning cache entry
+ *
+ * returns:
+ *   array of selected variants, or NULL if the entry could not be applied
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_variant_t *
+_variant_from_cache(cs_matrix_t                  *m,
+                    const _tuning_cache_entry_t  *e)
+{
+  int n_r_variants = (cs_get_device_id() > -1) ? 3 : 1;
+
+  if (e->n_variants != n_r_variants)
+    return NULL;
+
+  int n_variants = 0;
+  cs_matrix_variant_t *m_variant = NULL;
+
+  cs_matrix_variant_build_list(m, &n_variants, &m_variant);
+
+  cs_matrix_variant_t *r_variant = NULL;
+  BFT_MALLOC(r_variant, n_r_variants, cs_matrix_variant_t);
+
+  bool ok = true;
+
+  for (int k = 0; k < n_r_variants && ok; k++) {
+
+    cs_matrix_variant_t *o = r_variant + k;
+
+    o->type = m->type;
+    o->fill_type = m->fill_type;
+
+    /* Initialize with default functions, as for unselected
+       operation types in the tuned case */
+
+    for (int j = 0; j < CS_MATRIX_SPMV_N_TYPES; j++) {
+      o->vector_multiply[j] = NULL;
+      strncpy(o->name[j], "default", 31);
+      o->name[j][31] = '\0';
+      o->vector_multiply_xy_hd[j] = 'h';
+    }
+
+    for (cs_matrix_spmv_type_t spmv_type = 0;
+         spmv_type < CS_MATRIX_SPMV_N_TYPES;
+         spmv_type++)
+      cs_matrix_spmv_set_func(m->type,
+                              m->fill_type,
+                              spmv_type,
+                              m->numbering,
+                              NULL, /* func_name */
+                              o->vector_multiply,
+                              o->vector_multiply_xy_hd);
+
+    /* Now apply cached selections */
+
+    for (int j = 0; j < CS_MATRIX_SPMV_N_TYPES; j++) {
+
+      if (e->name[k][j][0] == '\0')
+        continue;
+
+      int i;
+      for (i = 0; i < n_variants; i++) {
+        const cs_matrix_variant_t *mv = m_variant + i;
+        if (   strncmp(mv->name[j], e->name[k][j], 31) == 0
+            && mv->vector_multiply_xy_hd[j] == e->xy_hd[k][j]
+            && mv->vector_multiply[j] != NULL) {
+          strcpy(o->name[j], mv->name[j]);
+          o->vector_multiply[j] = mv->vector_multiply[j];
+          o->vector_multiply_xy_hd[j] = mv->vector_multiply_xy_hd[j];
+          break;
+        }
+      }
+
+      if (i >= n_variants)
+        ok = false;  /* variant not available with this build or run */
+
+    }
+
+  }
+
+  BFT_FREE(m_variant);
+
+  if (ok == false)
+    BFT_FREE(r_variant);
+
+  else
+    cs_log_printf
+      (CS_LOG_PERFORMANCE,
+       _("\n"
+         "Reloaded SpMV variant selection for matrices of type %s and\n"
+         "fill %s from tuning cache \"%s\".\n"),
+       cs_matrix_get_type_name(m),
+       cs_matrix_fill_type_name[m->fill_type],
+       _tuning_cache_file_name);
+
+  return r_variant;
+}
+
 /*----------------------------------------------------------------------------
  * Build a global block row numbering.
  *
@@ -512,6 +823,13 @@ cs_matrix_finalize(void)
 
   cs_matrix_assembler_destroy(&_matrix_assembler);
 
+  /* Tuning cache */
+
+  BFT_FREE(_tuning_cache_entries);
+  _n_tuning_cache_entries = 0;
+  BFT_FREE(_tuning_cache_file_name);
+  _tuning_cache_read = false;
+
   /* Matrices for internal couplings */
 
   int n_ic = cs_internal_coupling_n_couplings();
@@ -819,10 +1137,31 @@ cs_matrix_default_set_tuned(cs_matrix_t  *m)
     m_t->eb_size = m->eb_size;
     m_t->coeffs = m->coeffs;
 
-    _matrix_variant_tuned[m->type][m->fill_type]
-      = cs_matrix_variant_tuned(m_t,
-                                1,
-                                _n_min_products);
+    /* Try the persistent tuning cache first when enabled */
+
+    if (_tuning_cache_file_name != NULL) {
+      _tuning_cache_load();
+      for (int i = 0; i < _n_tuning_cache_entries; i++) {
+        const _tuning_cache_entry_t *e = _tuning_cache_entries + i;
+        if (e->type == (int)m->type && e->fill_type == (int)m->fill_type) {
+          _matrix_variant_tuned[m->type][m->fill_type]
+            = _variant_from_cache(m_t, e);
+          break;
+        }
+      }
+    }
+
+    if (_matrix_variant_tuned[m->type][m->fill_type] == NULL) {
+
+      _matrix_variant_tuned[m->type][m->fill_type]
+        = cs_matrix_variant_tuned(m_t,
+                                  1,
+                                  _n_min_products);
+
+      if (_tuning_cache_file_name != NULL)
+        _tuning_cache_add(m_t, _matrix_variant_tuned[m->type][m->fill_type]);
+
+    }
 
     *m_t = m_t_save;
 
@@ -868,6 +1207,38 @@ cs_matrix_get_tuning_runs(void)
   return _n_min_products;
 }
 
+/*----------------------------------------------------------------------------
+ * Set file name for the persistent SpMV tuning cache.
+ *
+ * When a file name is set, tuning decisions are saved to that file,
+ * and reloaded from it on subsequent runs instead of being re-measured.
+ * Cached selections matching variants not available with the current
+ * build or run configuration are ignored, leading to re-tuning.
+ *
+ * The file should be removed after a mesh, partitioning, or build
+ * change, as the cached decisions may not be optimal anymore.
+ *
+ * parameters:
+ *   file_name <-- tuning cache file name, or NULL to disable the cache
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_tuning_cache_file(const char  *file_name)
+{
+  if (!_initialized)
+    _initialize_api();
+
+  BFT_FREE(_tuning_cache_file_name);
+
+  if (file_name != NULL) {
+    size_t l = strlen(file_name);
+    BFT_MALLOC(_tuning_cache_file_name, l+1, char);
+    strcpy(_tuning_cache_file_name, file_name);
+  }
+
+  _tuning_cache_read = false;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set default matrix type for a given fill type.
@@ -1064,6 +1435,70 @@ cs_matrix_set_coefficients_by_assembler(const cs_field_t  *f,
   return m;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute a symmetric diagonal equilibration scaling for a matrix,
+ *        based on its native diagonal coefficients.
+ *
+ * The scaling is defined as \f$ d_i = 1 / \sqrt{|a_{ii}|} \f$ (with
+ * \f$ d_i = 1 \f$ where the diagonal is zero), so that the scaled matrix
+ * \f$ D A D \f$ has a unit diagonal magnitude and remains symmetric when
+ * \f$ A \f$ is. It is only computed when the range of diagonal magnitudes
+ * indicates a poorly-scaled system (for example in strongly heterogeneous
+ * porous media), for which equilibration usually reduces iteration counts.
+ *
+ * The range statistics use global reductions, so the return value is
+ * identical on all ranks.
+ *
+ * \param[in]   n_rows   local number of matrix rows
+ * \param[in]   da       diagonal values (NULL if zero)
+ * \param[out]  scaling  computed scaling, size n_rows (only filled when
+ *                       the return value is 1)
+ *
+ * \return  1 if scaling was deemed useful and computed, 0 otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_matrix_equilibration_scaling(cs_lnum_t        n_rows,
+                                const cs_real_t  da[],
+                                cs_real_t        scaling[])
+{
+  /* Ratio of extreme diagonal magnitudes above which equilibration
+     is considered worthwhile */
+
+  const double threshold = 1e6;
+
+  if (da == NULL)
+    return 0;
+
+  double dmin = HUGE_VAL, dmax = 0.;
+
+# pragma omp parallel for reduction(min:dmin) reduction(max:dmax) \
+                          if (n_rows > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    double d = fabs(da[i]);
+    if (d < dmin)
+      dmin = d;
+    if (d > dmax)
+      dmax = d;
+  }
+
+  cs_parall_min(1, CS_DOUBLE, &dmin);
+  cs_parall_max(1, CS_DOUBLE, &dmax);
+
+  if (dmax <= 0. || dmax < threshold*dmin)
+    return 0;
+
+# pragma omp parallel for  if (n_rows > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    double d = fabs(da[i]);
+    scaling[i] = (d > 0.) ? 1./sqrt(d) : 1.;
+  }
+
+  return 1;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
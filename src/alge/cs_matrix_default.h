@@ -241,6 +241,24 @@ cs_matrix_set_tuning_runs(int     n_min_products);
 int
 cs_matrix_get_tuning_runs(void);
 
+/*----------------------------------------------------------------------------
+ * Set file name for the persistent SpMV tuning cache.
+ *
+ * When a file name is set, tuning decisions are saved to that file,
+ * and reloaded from it on subsequent runs instead of being re-measured.
+ * Cached selections matching variants not available with the current
+ * build or run configuration are ignored, leading to re-tuning.
+ *
+ * The file should be removed after a mesh, partitioning, or build
+ * change, as the cached decisions may not be optimal anymore.
+ *
+ * parameters:
+ *   file_name <-- tuning cache file name, or NULL to disable the cache
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_tuning_cache_file(const char  *file_name);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set default matrix type for a given fill type.
@@ -299,6 +317,29 @@ cs_matrix_set_coefficients_by_assembler(const cs_field_t  *f,
                                         const cs_real_t   *da,
                                         const cs_real_t   *xa);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute a symmetric diagonal equilibration scaling for a matrix,
+ *        based on its native diagonal coefficients.
+ *
+ * The scaling is only computed when the range of diagonal magnitudes
+ * indicates a poorly-scaled system; the decision is identical on all
+ * ranks.
+ *
+ * \param[in]   n_rows   local number of matrix rows
+ * \param[in]   da       diagonal values (NULL if zero)
+ * \param[out]  scaling  computed scaling, size n_rows (only filled when
+ *                       the return value is 1)
+ *
+ * \return  1 if scaling was deemed useful and computed, 0 otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_matrix_equilibration_scaling(cs_lnum_t        n_rows,
+                                const cs_real_t  da[],
+                                cs_real_t        scaling[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
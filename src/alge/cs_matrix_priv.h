@@ -259,6 +259,23 @@ typedef struct _cs_matrix_coeff_dist_t {
 
 } cs_matrix_coeff_dist_t;
 
+/* Matrix-free (mesh-based) operator data */
+/*----------------------------------------*/
+
+/* Used with the native matrix type when extra-diagonal coefficients are
+   not assembled, but computed on the fly from face-based values
+   (such as the face diffusion coefficients of a pressure-type system);
+   assigned to a matrix's ext_lib_map member. */
+
+typedef struct _cs_matrix_mesh_map_t {
+
+  cs_real_t         scale;            /* Multiplier applied to face values
+                                         (-thetap for a diffusion matrix) */
+
+  cs_real_t        *da;               /* Assembled diagonal (private) */
+
+} cs_matrix_mesh_map_t;
+
 /* Matrix structure (representation-independent part) */
 /*----------------------------------------------------*/
 
@@ -102,6 +102,13 @@ BEGIN_C_DECLS
 
 static const cs_lnum_t _cs_cl = (CS_CL_SIZE/8);
 
+/* SELL-C-sigma parameters: slice height (C), chosen as a multiple of
+   common SIMD widths, and sorting window (sigma), over which rows are
+   sorted by decreasing length to limit slice padding. */
+
+#define CS_MATRIX_SELL_C      8
+#define CS_MATRIX_SELL_SIGMA  256
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -147,6 +154,58 @@ typedef struct _cs_matrix_mkl_sparse_sycl_map_t {
 
 #endif // defined(HAVE_MKL_SPARSE_IE)
 
+/* Mapping of MSR extra-diagonal coefficients to SELL-C-sigma storage */
+/*--------------------------------------------------------------------*/
+
+/* Sliced ELLPACK with sorting (SELL-C-sigma): rows are sorted by
+   decreasing length within windows of sigma rows, then grouped in
+   slices of C rows; each slice is stored column-major (coefficient j
+   of the C rows of a slice are contiguous), padded with zero
+   coefficients, so the SpMV inner loop over a slice is SIMD-clean
+   even with irregular row lengths. */
+
+typedef struct _cs_matrix_sell_map_t {
+
+  cs_lnum_t    n_slices;      /* Number of row slices */
+
+  cs_lnum_t   *slice_index;   /* Start of each slice in val and col_id
+                                 (size: n_slices + 1) */
+  cs_lnum_t   *row_id;        /* Original row id by slice position
+                                 (size: n_slices*C, -1 for padding rows) */
+  cs_lnum_t   *col_id;        /* Slice-major column ids */
+  cs_real_t   *val;           /* Slice-major coefficients (zero-padded) */
+
+} cs_matrix_sell_map_t;
+
+/* Structured-block mapping of MSR extra-diagonal structure */
+/*----------------------------------------------------------*/
+
+/* Meshes produced by cs_mesh_cartesian.c or hex-dominant generators,
+   numbered lexicographically, contain long runs of consecutive rows
+   sharing the same column offset pattern (col_id - row_id). Detecting
+   those runs once allows replacing per-coefficient column id loads by
+   direct index arithmetic over each run, with the generic indirect
+   loop kept for the rows between runs. */
+
+#define CS_MATRIX_STRUCT_B_MIN  8  /* Minimum rows for a structured block */
+
+typedef struct _cs_matrix_struct_map_t {
+
+  cs_lnum_t    n_blocks;      /* Number of structured row blocks
+                                 (0 if coverage is too low to be useful) */
+  cs_lnum_t    n_rows_struct; /* Number of rows covered by blocks */
+
+  cs_lnum_t   *block_row;     /* Start and past-the-end row of each block
+                                 (size: 2*(n_blocks+1)); the last entry is
+                                 an empty sentinel at n_rows, so tail rows
+                                 are handled like other inter-block gaps */
+  cs_lnum_t   *offset_index;  /* Start of each block's offsets
+                                 (size: n_blocks + 1) */
+  cs_lnum_t   *offset;        /* Column offsets relative to row id,
+                                 common to all rows of a block */
+
+} cs_matrix_struct_map_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -1074,6 +1133,76 @@ _mat_vec_p_l_native(cs_matrix_t  *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with native matrix, matrix-free variant.
+ *
+ * Extra-diagonal coefficients are not assembled; they are computed on the
+ * fly as the shared face values (mapped to e_val) multiplied by the scaling
+ * factor carried by the matrix's mesh map.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_native_mf(cs_matrix_t  *matrix,
+                       bool          exclude_diag,
+                       bool          sync,
+                       cs_real_t     x[restrict],
+                       cs_real_t     y[restrict])
+{
+  const cs_matrix_struct_native_t  *ms
+    = (const cs_matrix_struct_native_t *)matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+  const cs_matrix_mesh_map_t  *mm
+    = (const cs_matrix_mesh_map_t *)matrix->ext_lib_map;
+
+  const cs_real_t  *restrict f_val = mc->e_val;
+  const cs_real_t  scale = mm->scale;
+
+  assert(mc->symmetric);
+
+  /* Initialize ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
+  /* Diagonal part of matrix.vector product */
+
+  if (! exclude_diag) {
+    _diag_vec_p_l(mc->d_val, x, y, ms->n_rows);
+    _zero_range(y, ms->n_rows, ms->n_cols_ext);
+  }
+  else
+    _zero_range(y, 0, ms->n_cols_ext);
+
+  /* Finalize ghost cell comunication if overlap used */
+
+  if (hs != NULL)
+    cs_halo_sync_wait(matrix->halo, x, hs);
+
+  /* non-diagonal terms */
+
+  if (f_val != NULL) {
+
+    const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+
+    for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
+      cs_lnum_t ii = face_cel_p[face_id][0];
+      cs_lnum_t jj = face_cel_p[face_id][1];
+      cs_real_t aij = scale * f_val[face_id];
+      y[ii] += aij * x[jj];
+      y[jj] += aij * x[ii];
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Matrix.vector product y = A.x with native matrix.
  *
@@ -1794,6 +1923,91 @@ _b_mat_vec_p_l_native_omp_atomic(cs_matrix_t  *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with native matrix, matrix-free variant.
+ *
+ * This variant uses a threads-based face numbering; extra-diagonal
+ * coefficients are not assembled, but computed on the fly as the shared
+ * face values (mapped to e_val) multiplied by the scaling factor carried
+ * by the matrix's mesh map.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_native_mf_omp(cs_matrix_t  *matrix,
+                           bool          exclude_diag,
+                           bool          sync,
+                           cs_real_t     x[restrict],
+                           cs_real_t     y[restrict])
+{
+  const int n_threads = matrix->numbering->n_threads;
+  const int n_groups = matrix->numbering->n_groups;
+  const cs_lnum_t *group_index = matrix->numbering->group_index;
+
+  const cs_matrix_struct_native_t  *ms
+    = (const cs_matrix_struct_native_t *)matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+  const cs_matrix_mesh_map_t  *mm
+    = (const cs_matrix_mesh_map_t *)matrix->ext_lib_map;
+
+  const cs_real_t  *restrict f_val = mc->e_val;
+  const cs_real_t  scale = mm->scale;
+
+  assert(matrix->numbering->type == CS_NUMBERING_THREADS);
+  assert(mc->symmetric);
+
+  /* Initialize ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
+  /* Diagonal part of matrix.vector product */
+
+  if (! exclude_diag) {
+    _diag_vec_p_l(mc->d_val, x, y, ms->n_rows);
+    _zero_range(y, ms->n_rows, ms->n_cols_ext);
+  }
+  else
+    _zero_range(y, 0, ms->n_cols_ext);
+
+  /* Finalize ghost cell comunication if overlap used */
+
+  if (hs != NULL)
+    cs_halo_sync_wait(matrix->halo, x, hs);
+
+  /* non-diagonal terms */
+
+  if (f_val != NULL) {
+
+    const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+
+    for (int g_id = 0; g_id < n_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_threads; t_id++) {
+
+        for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
+             face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+             face_id++) {
+          cs_lnum_t ii = face_cel_p[face_id][0];
+          cs_lnum_t jj = face_cel_p[face_id][1];
+          cs_real_t aij = scale * f_val[face_id];
+          y[ii] += aij * x[jj];
+          y[jj] += aij * x[ii];
+        }
+      }
+    }
+
+  }
+}
+
 #endif /* defined(HAVE_OPENMP) */
 
 /*----------------------------------------------------------------------------
@@ -2438,13 +2652,25 @@ _b_mat_vec_p_l_msr_3(cs_matrix_t  *matrix,
       const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
       cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
 
-      _dense_3_3_ax(ii, mc->d_val, x, y);
+      /* Accumulate in registers, storing to y only once per row */
+
+      cs_real_t y0 = 0., y1 = 0., y2 = 0.;
 
       for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 3; kk++)
-          y[ii*3 + kk] += (m_row[jj]*x[col_id[jj]*3 + kk]);
+        const cs_real_t *restrict _x = x + col_id[jj]*3;
+        const cs_real_t mij = m_row[jj];
+        y0 += mij*_x[0];
+        y1 += mij*_x[1];
+        y2 += mij*_x[2];
       }
 
+      const cs_real_t *restrict d = mc->d_val + ii*9;
+      const cs_real_t *restrict xd = x + ii*3;
+
+      y[ii*3]     = y0 + d[0]*xd[0] + d[1]*xd[1] + d[2]*xd[2];
+      y[ii*3 + 1] = y1 + d[3]*xd[0] + d[4]*xd[1] + d[5]*xd[2];
+      y[ii*3 + 2] = y2 + d[6]*xd[0] + d[7]*xd[1] + d[8]*xd[2];
+
     }
 
   }
@@ -2460,14 +2686,20 @@ _b_mat_vec_p_l_msr_3(cs_matrix_t  *matrix,
       const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
       cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
 
-      for (cs_lnum_t kk = 0; kk < 3; kk++)
-        y[ii*3 + kk] = 0.;
+      cs_real_t y0 = 0., y1 = 0., y2 = 0.;
 
       for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 3; kk++)
-          y[ii*3 + kk] += (m_row[jj]*x[col_id[jj]*3 + kk]);
+        const cs_real_t *restrict _x = x + col_id[jj]*3;
+        const cs_real_t mij = m_row[jj];
+        y0 += mij*_x[0];
+        y1 += mij*_x[1];
+        y2 += mij*_x[2];
       }
 
+      y[ii*3]     = y0;
+      y[ii*3 + 1] = y1;
+      y[ii*3 + 2] = y2;
+
     }
   }
 
@@ -2521,13 +2753,25 @@ _b_mat_vec_p_l_msr_6(cs_matrix_t  *matrix,
       const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
       cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
 
-      _dense_6_6_ax(ii, mc->d_val, x, y);
+      /* Accumulate in registers, storing to y only once per row */
+
+      cs_real_t s[6] = {0., 0., 0., 0., 0., 0.};
 
       for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t *restrict _x = x + col_id[jj]*6;
+        const cs_real_t mij = m_row[jj];
         for (cs_lnum_t kk = 0; kk < 6; kk++)
-          y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
+          s[kk] += mij*_x[kk];
       }
 
+      const cs_real_t *restrict d = mc->d_val + ii*36;
+      const cs_real_t *restrict xd = x + ii*6;
+
+      for (cs_lnum_t kk = 0; kk < 6; kk++)
+        y[ii*6 + kk] = s[kk] + (  d[kk*6]*xd[0]   + d[kk*6 + 1]*xd[1]
+                                + d[kk*6 + 2]*xd[2] + d[kk*6 + 3]*xd[3]
+                                + d[kk*6 + 4]*xd[4] + d[kk*6 + 5]*xd[5]);
+
     }
 
   }
@@ -2543,14 +2787,18 @@ _b_mat_vec_p_l_msr_6(cs_matrix_t  *matrix,
       const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
       cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
 
-      for (cs_lnum_t kk = 0; kk < 6; kk++)
-        y[ii*6 + kk] = 0.;
+      cs_real_t s[6] = {0., 0., 0., 0., 0., 0.};
 
       for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t *restrict _x = x + col_id[jj]*6;
+        const cs_real_t mij = m_row[jj];
         for (cs_lnum_t kk = 0; kk < 6; kk++)
-          y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
+          s[kk] += mij*_x[kk];
       }
 
+      for (cs_lnum_t kk = 0; kk < 6; kk++)
+        y[ii*6 + kk] = s[kk];
+
     }
   }
 
@@ -2632,22 +2880,27 @@ _bb_mat_vec_p_l_msr_3(cs_matrix_t  *matrix,
       const cs_real_t *restrict m_row =  mc->e_val + (e_row_index[ii]*9);
       cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
 
-      _dense_3_3_ax(ii, mc->d_val, x, y);
+      /* Accumulate in registers, storing to y only once per row */
 
-      cs_real_t * _y = y + ii*3;
+      cs_real_t y0 = 0., y1 = 0., y2 = 0.;
 
       for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        _y[0] += (  m_row[jj*9]         * x[col_id[jj]*3]
-                  + m_row[jj*9 + 1]     * x[col_id[jj]*3 + 1]
-                  + m_row[jj*9 + 2]     * x[col_id[jj]*3 + 2]);
-        _y[1] += (  m_row[jj*9 + 3]     * x[col_id[jj]*3]
-                  + m_row[jj*9 + 3 + 1] * x[col_id[jj]*3 + 1]
-                  + m_row[jj*9 + 3 + 2] * x[col_id[jj]*3 + 2]);
-        _y[2] += (  m_row[jj*9 + 6]     * x[col_id[jj]*3]
-                  + m_row[jj*9 + 6 + 1] * x[col_id[jj]*3 + 1]
-                  + m_row[jj*9 + 6 + 2] * x[col_id[jj]*3 + 2]);
+        const cs_real_t *restrict _m = m_row + jj*9;
+        const cs_real_t xj0 = x[col_id[jj]*3];
+        const cs_real_t xj1 = x[col_id[jj]*3 + 1];
+        const cs_real_t xj2 = x[col_id[jj]*3 + 2];
+        y0 += _m[0]*xj0 + _m[1]*xj1 + _m[2]*xj2;
+        y1 += _m[3]*xj0 + _m[4]*xj1 + _m[5]*xj2;
+        y2 += _m[6]*xj0 + _m[7]*xj1 + _m[8]*xj2;
       }
 
+      const cs_real_t *restrict d = mc->d_val + ii*9;
+      const cs_real_t *restrict xd = x + ii*3;
+
+      y[ii*3]     = y0 + d[0]*xd[0] + d[1]*xd[1] + d[2]*xd[2];
+      y[ii*3 + 1] = y1 + d[3]*xd[0] + d[4]*xd[1] + d[5]*xd[2];
+      y[ii*3 + 2] = y2 + d[6]*xd[0] + d[7]*xd[1] + d[8]*xd[2];
+
     }
 
   }
@@ -2663,23 +2916,126 @@ _bb_mat_vec_p_l_msr_3(cs_matrix_t  *matrix,
       const cs_real_t *restrict m_row =  mc->e_val + (e_row_index[ii]*9);
       cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
 
-      cs_real_t * _y = y + (ii*3);
+      cs_real_t y0 = 0., y1 = 0., y2 = 0.;
 
-      for (cs_lnum_t kk = 0; kk < 3; kk++)
-        _y[kk] = 0.;
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t *restrict _m = m_row + jj*9;
+        const cs_real_t xj0 = x[col_id[jj]*3];
+        const cs_real_t xj1 = x[col_id[jj]*3 + 1];
+        const cs_real_t xj2 = x[col_id[jj]*3 + 2];
+        y0 += _m[0]*xj0 + _m[1]*xj1 + _m[2]*xj2;
+        y1 += _m[3]*xj0 + _m[4]*xj1 + _m[5]*xj2;
+        y2 += _m[6]*xj0 + _m[7]*xj1 + _m[8]*xj2;
+      }
+
+      y[ii*3]     = y0;
+      y[ii*3 + 1] = y1;
+      y[ii*3 + 2] = y2;
+
+    }
+  }
+
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with MSR matrix, 6x6 blocked version.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_mat_vec_p_l_msr_6(cs_matrix_t  *matrix,
+                      bool          exclude_diag,
+                      bool          sync,
+                      cs_real_t     x[restrict],
+                      cs_real_t     y[restrict])
+{
+  const cs_matrix_struct_dist_t  *ms
+    = (const cs_matrix_struct_dist_t *)matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  const cs_lnum_t  *e_col_id = ms->e.col_id;
+  const cs_lnum_t  *e_row_index = ms->e.row_index;
+
+  assert(matrix->db_size == 6 && matrix->eb_size == 6);
+
+  /* Ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+  if (hs != NULL)
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+
+  /* Standard case */
+
+  if (!exclude_diag && mc->d_val != NULL) {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+      const cs_real_t *restrict m_row =  mc->e_val + (e_row_index[ii]*36);
+      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+
+      /* Accumulate in registers, storing to y only once per row;
+         fixed trip counts allow full unrolling by the compiler */
+
+      cs_real_t s[6] = {0., 0., 0., 0., 0., 0.};
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t *restrict _m = m_row + jj*36;
+        const cs_real_t *restrict _x = x + col_id[jj]*6;
+        for (cs_lnum_t kk = 0; kk < 6; kk++)
+          s[kk] += (  _m[kk*6]*_x[0]     + _m[kk*6 + 1]*_x[1]
+                    + _m[kk*6 + 2]*_x[2] + _m[kk*6 + 3]*_x[3]
+                    + _m[kk*6 + 4]*_x[4] + _m[kk*6 + 5]*_x[5]);
+      }
+
+      const cs_real_t *restrict d = mc->d_val + ii*36;
+      const cs_real_t *restrict xd = x + ii*6;
+
+      for (cs_lnum_t kk = 0; kk < 6; kk++)
+        y[ii*6 + kk] = s[kk] + (  d[kk*6]*xd[0]     + d[kk*6 + 1]*xd[1]
+                                + d[kk*6 + 2]*xd[2] + d[kk*6 + 3]*xd[3]
+                                + d[kk*6 + 4]*xd[4] + d[kk*6 + 5]*xd[5]);
+
+    }
+
+  }
+
+  /* Exclude diagonal */
+
+  else {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+      const cs_real_t *restrict m_row =  mc->e_val + (e_row_index[ii]*36);
+      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+
+      cs_real_t s[6] = {0., 0., 0., 0., 0., 0.};
 
       for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        _y[0] += (  m_row[jj*9]         * x[col_id[jj]*3]
-                  + m_row[jj*9 + 1]     * x[col_id[jj]*3 + 1]
-                  + m_row[jj*9 + 2]     * x[col_id[jj]*3 + 2]);
-        _y[1] += (  m_row[jj*9 + 3]     * x[col_id[jj]*3]
-                  + m_row[jj*9 + 3 + 1] * x[col_id[jj]*3 + 1]
-                  + m_row[jj*9 + 3 + 2] * x[col_id[jj]*3 + 2]);
-        _y[2] += (  m_row[jj*9 + 6]     * x[col_id[jj]*3]
-                  + m_row[jj*9 + 6 + 1] * x[col_id[jj]*3 + 1]
-                  + m_row[jj*9 + 6 + 2] * x[col_id[jj]*3 + 2]);
+        const cs_real_t *restrict _m = m_row + jj*36;
+        const cs_real_t *restrict _x = x + col_id[jj]*6;
+        for (cs_lnum_t kk = 0; kk < 6; kk++)
+          s[kk] += (  _m[kk*6]*_x[0]     + _m[kk*6 + 1]*_x[1]
+                    + _m[kk*6 + 2]*_x[2] + _m[kk*6 + 3]*_x[3]
+                    + _m[kk*6 + 4]*_x[4] + _m[kk*6 + 5]*_x[5]);
       }
 
+      for (cs_lnum_t kk = 0; kk < 6; kk++)
+        y[ii*6 + kk] = s[kk];
+
     }
   }
 
@@ -2805,41 +3161,564 @@ _bb_mat_vec_p_l_msr(cs_matrix_t  *matrix,
   if (matrix->eb_size == 3)
     _bb_mat_vec_p_l_msr_3(matrix, exclude_diag, sync, x, y);
 
+  else if (matrix->eb_size == 6 && matrix->db_size == 6)
+    _bb_mat_vec_p_l_msr_6(matrix, exclude_diag, sync, x, y);
+
   else
     _bb_mat_vec_p_l_msr_generic(matrix, exclude_diag, sync, x, y);
 }
 
 /*----------------------------------------------------------------------------
- * Matrix.vector product y = A.x with MSR matrix, using MKL
+ * Unset matrix SELL-C-sigma mapping.
  *
  * parameters:
- *   exclude_diag <-- exclude diagonal if true
- *   matrix       <-- pointer to matrix structure
- *   hs           <-- halo state: if non-NULL, call cs_halo_sync_wait
- *                    locally (possibly allowing computation/communication
- *                    overlap)
- *   x            <-> multipliying vector values
- *   y            --> resulting vector
+ *   matrix    <-- pointer to matrix structure
  *----------------------------------------------------------------------------*/
 
-#if defined (HAVE_MKL_SPARSE_IE)
-
 static void
-_mat_vec_p_l_msr_mkl(cs_matrix_t  *matrix,
-                     bool          exclude_diag,
-                     bool          sync,
-                     cs_real_t     x[restrict],
-                     cs_real_t     y[restrict])
+_unset_sell_map(cs_matrix_t   *matrix)
 {
-  const cs_matrix_coeff_dist_t  *mc
-    = (const cs_matrix_coeff_dist_t  *)matrix->coeffs;
+  cs_matrix_sell_map_t *csm
+    = (cs_matrix_sell_map_t *)matrix->ext_lib_map;
 
-  /* Ghost cell communication */
+  if (csm == NULL)
+    return;
 
-  cs_halo_state_t *hs
-    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
-  if (hs != NULL)
-    cs_halo_sync_wait(matrix->halo, x, hs);
+  BFT_FREE(csm->slice_index);
+  BFT_FREE(csm->row_id);
+  BFT_FREE(csm->col_id);
+  BFT_FREE(csm->val);
+
+  BFT_FREE(matrix->ext_lib_map);
+  matrix->destroy_adaptor = NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Build matrix SELL-C-sigma mapping from MSR extra-diagonal part.
+ *
+ * As for external library adaptors, the mapping is dropped when matrix
+ * coefficients are modified or released, so it is rebuilt lazily on the
+ * next SpMV call.
+ *
+ * parameters:
+ *   matrix    <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_sell_map_t *
+_set_sell_map(cs_matrix_t   *matrix)
+{
+  cs_matrix_sell_map_t *csm
+    = (cs_matrix_sell_map_t *)matrix->ext_lib_map;
+
+  if (csm != NULL)
+    _unset_sell_map(matrix);
+
+  BFT_MALLOC(csm, 1, cs_matrix_sell_map_t);
+  matrix->ext_lib_map = (void *)csm;
+  matrix->destroy_adaptor = _unset_sell_map;
+
+  const cs_matrix_struct_dist_t  *ms
+    = (const cs_matrix_struct_dist_t *)matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  const cs_lnum_t  *e_col_id = ms->e.col_id;
+  const cs_lnum_t  *e_row_index = ms->e.row_index;
+  const cs_real_t  *e_val = mc->e_val;
+
+  const cs_lnum_t c = CS_MATRIX_SELL_C;
+  const cs_lnum_t sigma = CS_MATRIX_SELL_SIGMA;
+
+  cs_lnum_t n_slices = (n_rows + c - 1) / c;
+
+  csm->n_slices = n_slices;
+  BFT_MALLOC(csm->slice_index, n_slices + 1, cs_lnum_t);
+  BFT_MALLOC(csm->row_id, n_slices*c, cs_lnum_t);
+
+  /* Sort rows by decreasing length inside each sigma window
+     (simple insertion sort; windows are small) */
+
+  cs_lnum_t *perm;
+  BFT_MALLOC(perm, n_slices*c, cs_lnum_t);
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    perm[ii] = ii;
+  for (cs_lnum_t ii = n_rows; ii < n_slices*c; ii++)
+    perm[ii] = -1;
+
+  for (cs_lnum_t w_start = 0; w_start < n_rows; w_start += sigma) {
+    cs_lnum_t w_end = CS_MIN(w_start + sigma, n_rows);
+    for (cs_lnum_t ii = w_start + 1; ii < w_end; ii++) {
+      cs_lnum_t r = perm[ii];
+      cs_lnum_t l = e_row_index[r+1] - e_row_index[r];
+      cs_lnum_t jj = ii;
+      while (jj > w_start) {
+        cs_lnum_t r_p = perm[jj-1];
+        if (e_row_index[r_p+1] - e_row_index[r_p] >= l)
+          break;
+        perm[jj] = r_p;
+        jj--;
+      }
+      perm[jj] = r;
+    }
+  }
+
+  memcpy(csm->row_id, perm, sizeof(cs_lnum_t)*n_slices*c);
+
+  /* Compute slice widths and index */
+
+  csm->slice_index[0] = 0;
+
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+    cs_lnum_t w = 0;
+    for (cs_lnum_t k = 0; k < c; k++) {
+      cs_lnum_t r = perm[s_id*c + k];
+      if (r > -1) {
+        cs_lnum_t l = e_row_index[r+1] - e_row_index[r];
+        w = CS_MAX(w, l);
+      }
+    }
+    csm->slice_index[s_id+1] = csm->slice_index[s_id] + w*c;
+  }
+
+  /* Fill slice-major storage, padding with zero coefficients on
+     column 0 (always valid) */
+
+  cs_lnum_t nnz_s = csm->slice_index[n_slices];
+
+  BFT_MALLOC(csm->col_id, nnz_s, cs_lnum_t);
+  BFT_MALLOC(csm->val, nnz_s, cs_real_t);
+
+# pragma omp parallel for  if(n_slices > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+
+    cs_lnum_t s_start = csm->slice_index[s_id];
+    cs_lnum_t w = (csm->slice_index[s_id+1] - s_start) / c;
+
+    for (cs_lnum_t k = 0; k < c; k++) {
+
+      cs_lnum_t r = perm[s_id*c + k];
+      cs_lnum_t l = 0;
+
+      if (r > -1) {
+        l = e_row_index[r+1] - e_row_index[r];
+        const cs_lnum_t *restrict col_id = e_col_id + e_row_index[r];
+        const cs_real_t *restrict m_row = e_val + e_row_index[r];
+        for (cs_lnum_t jj = 0; jj < l; jj++) {
+          csm->col_id[s_start + jj*c + k] = col_id[jj];
+          csm->val[s_start + jj*c + k] = m_row[jj];
+        }
+      }
+
+      for (cs_lnum_t jj = l; jj < w; jj++) {
+        csm->col_id[s_start + jj*c + k] = 0;
+        csm->val[s_start + jj*c + k] = 0.;
+      }
+
+    }
+
+  }
+
+  BFT_FREE(perm);
+
+  return csm;
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with MSR matrix, using SELL-C-sigma
+ * storage for the extra-diagonal part.
+ *
+ * The SELL-C-sigma mapping is built lazily on first call after each
+ * coefficient assignment.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_sell(cs_matrix_t  *matrix,
+                      bool          exclude_diag,
+                      bool          sync,
+                      cs_real_t    *restrict x,
+                      cs_real_t    *restrict y)
+{
+  const cs_matrix_coeff_dist_t  *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+
+  /* Ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+  if (hs != NULL)
+    cs_halo_sync_wait(matrix->halo, x, hs);
+
+  /* Map matrix if not yet done */
+
+  cs_matrix_sell_map_t *csm
+    = (cs_matrix_sell_map_t *)matrix->ext_lib_map;
+
+  if (csm == NULL)
+    csm = _set_sell_map(matrix);
+
+  const cs_lnum_t  n_slices = csm->n_slices;
+  const cs_lnum_t  *restrict slice_index = csm->slice_index;
+  const cs_lnum_t  *restrict row_id = csm->row_id;
+  const cs_lnum_t  *restrict col_id = csm->col_id;
+  const cs_real_t  *restrict val = csm->val;
+
+  const cs_lnum_t c = CS_MATRIX_SELL_C;
+
+  const bool add_diag = (!exclude_diag && mc->d_val != NULL);
+  const cs_real_t  *restrict d_val = mc->d_val;
+
+# pragma omp parallel for  if(n_slices > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+
+    cs_lnum_t s_start = slice_index[s_id];
+    cs_lnum_t w = (slice_index[s_id+1] - s_start) / c;
+
+    cs_real_t sii[CS_MATRIX_SELL_C];
+    for (cs_lnum_t k = 0; k < c; k++)
+      sii[k] = 0.0;
+
+    for (cs_lnum_t jj = 0; jj < w; jj++) {
+      const cs_lnum_t *restrict s_col = col_id + s_start + jj*c;
+      const cs_real_t *restrict s_val = val + s_start + jj*c;
+#     pragma omp simd
+      for (cs_lnum_t k = 0; k < c; k++)
+        sii[k] += s_val[k] * x[s_col[k]];
+    }
+
+    if (add_diag) {
+      for (cs_lnum_t k = 0; k < c; k++) {
+        cs_lnum_t r = row_id[s_id*c + k];
+        if (r > -1)
+          y[r] = sii[k] + d_val[r]*x[r];
+      }
+    }
+    else {
+      for (cs_lnum_t k = 0; k < c; k++) {
+        cs_lnum_t r = row_id[s_id*c + k];
+        if (r > -1)
+          y[r] = sii[k];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Release structured-block mapping.
+ *
+ * parameters:
+ *   matrix    <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_unset_struct_map(cs_matrix_t   *matrix)
+{
+  cs_matrix_struct_map_t *csm
+    = (cs_matrix_struct_map_t *)matrix->ext_lib_map;
+
+  if (csm == NULL)
+    return;
+
+  BFT_FREE(csm->block_row);
+  BFT_FREE(csm->offset_index);
+  BFT_FREE(csm->offset);
+
+  BFT_FREE(matrix->ext_lib_map);
+  matrix->destroy_adaptor = NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Detect structured row blocks in MSR extra-diagonal structure.
+ *
+ * A block is a maximal run of consecutive rows with identical column
+ * offsets relative to the row id; runs shorter than CS_MATRIX_STRUCT_B_MIN
+ * are ignored. If less than half of the rows belong to such blocks, the
+ * mapping is marked as empty so the product falls back to the fully
+ * generic loop.
+ *
+ * As for external library adaptors, the mapping is dropped when matrix
+ * coefficients are modified or released, so it is rebuilt lazily on the
+ * next SpMV call.
+ *
+ * parameters:
+ *   matrix    <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_struct_map_t *
+_set_struct_map(cs_matrix_t   *matrix)
+{
+  cs_matrix_struct_map_t *csm
+    = (cs_matrix_struct_map_t *)matrix->ext_lib_map;
+
+  if (csm != NULL)
+    _unset_struct_map(matrix);
+
+  BFT_MALLOC(csm, 1, cs_matrix_struct_map_t);
+  matrix->ext_lib_map = (void *)csm;
+  matrix->destroy_adaptor = _unset_struct_map;
+
+  const cs_matrix_struct_dist_t  *ms
+    = (const cs_matrix_struct_dist_t *)matrix->structure;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  const cs_lnum_t  *e_col_id = ms->e.col_id;
+  const cs_lnum_t  *e_row_index = ms->e.row_index;
+
+  /* Flag rows whose offset pattern continues that of the previous row */
+
+  char *cont;
+  BFT_MALLOC(cont, n_rows, char);
+
+  if (n_rows > 0)
+    cont[0] = 0;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 1; ii < n_rows; ii++) {
+    cs_lnum_t s_id = e_row_index[ii];
+    cs_lnum_t p_id = e_row_index[ii-1];
+    cs_lnum_t n_cols = e_row_index[ii+1] - s_id;
+    char c = (n_cols == s_id - p_id) ? 1 : 0;
+    for (cs_lnum_t jj = 0; c && jj < n_cols; jj++) {
+      if (e_col_id[s_id + jj] - e_col_id[p_id + jj] != 1)
+        c = 0;
+    }
+    cont[ii] = c;
+  }
+
+  /* Count retained runs, then build block arrays */
+
+  cs_lnum_t n_blocks = 0, n_rows_struct = 0, n_offsets = 0;
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_lnum_t jj = ii;
+    while (jj+1 < n_rows && cont[jj+1] == 1)
+      jj++;
+    cs_lnum_t l = jj + 1 - ii;
+    if (l >= CS_MATRIX_STRUCT_B_MIN) {
+      n_blocks += 1;
+      n_rows_struct += l;
+      n_offsets += e_row_index[ii+1] - e_row_index[ii];
+    }
+    ii = jj;
+  }
+
+  csm->n_rows_struct = n_rows_struct;
+
+  if (n_rows_struct*2 < n_rows) {  /* mostly unstructured; not worth it */
+    csm->n_blocks = 0;
+    csm->block_row = NULL;
+    csm->offset_index = NULL;
+    csm->offset = NULL;
+    BFT_FREE(cont);
+    return csm;
+  }
+
+  csm->n_blocks = n_blocks;
+  BFT_MALLOC(csm->block_row, 2*(n_blocks+1), cs_lnum_t);
+  BFT_MALLOC(csm->offset_index, n_blocks+1, cs_lnum_t);
+  BFT_MALLOC(csm->offset, n_offsets, cs_lnum_t);
+
+  cs_lnum_t b_id = 0, o_id = 0;
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_lnum_t jj = ii;
+    while (jj+1 < n_rows && cont[jj+1] == 1)
+      jj++;
+    if (jj + 1 - ii >= CS_MATRIX_STRUCT_B_MIN) {
+      csm->block_row[2*b_id] = ii;
+      csm->block_row[2*b_id + 1] = jj + 1;
+      csm->offset_index[b_id] = o_id;
+      for (cs_lnum_t kk = e_row_index[ii]; kk < e_row_index[ii+1]; kk++)
+        csm->offset[o_id++] = e_col_id[kk] - ii;
+      b_id += 1;
+    }
+    ii = jj;
+  }
+
+  csm->block_row[2*n_blocks] = n_rows;     /* empty sentinel */
+  csm->block_row[2*n_blocks + 1] = n_rows;
+  csm->offset_index[n_blocks] = o_id;
+
+  BFT_FREE(cont);
+
+  return csm;
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with MSR matrix, using direct index
+ * arithmetic over structured row blocks.
+ *
+ * The structured-block mapping is built lazily on first call after each
+ * coefficient assignment; if the matrix turns out mostly unstructured,
+ * the product reduces to the generic indirect loop.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_struct(cs_matrix_t  *matrix,
+                        bool          exclude_diag,
+                        bool          sync,
+                        cs_real_t    *restrict x,
+                        cs_real_t    *restrict y)
+{
+  const cs_matrix_struct_dist_t  *ms
+    = (const cs_matrix_struct_dist_t *)matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+
+  const cs_lnum_t  *e_col_id = ms->e.col_id;
+  const cs_lnum_t  *e_row_index = ms->e.row_index;
+  const cs_real_t  *e_val = mc->e_val;
+
+  /* Ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+  if (hs != NULL)
+    cs_halo_sync_wait(matrix->halo, x, hs);
+
+  /* Map matrix if not yet done */
+
+  cs_matrix_struct_map_t *csm
+    = (cs_matrix_struct_map_t *)matrix->ext_lib_map;
+
+  if (csm == NULL)
+    csm = _set_struct_map(matrix);
+
+  const bool add_diag = (!exclude_diag && mc->d_val != NULL);
+  const cs_real_t  *restrict d_val = mc->d_val;
+
+  /* Mostly unstructured matrix: generic loop */
+
+  if (csm->n_blocks == 0) {
+
+    const cs_lnum_t  n_rows = ms->n_rows;
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+      const cs_real_t *restrict m_row = e_val + e_row_index[ii];
+      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+      cs_real_t sii = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += (m_row[jj]*x[col_id[jj]]);
+
+      y[ii] = (add_diag) ? sii + d_val[ii]*x[ii] : sii;
+
+    }
+
+    return;
+  }
+
+  /* Structured blocks, with generic handling of inter-block gaps;
+     the trailing sentinel block covers the gap after the last block */
+
+  const cs_lnum_t  n_blocks = csm->n_blocks;
+  const cs_lnum_t  *restrict block_row = csm->block_row;
+  const cs_lnum_t  *restrict offset_index = csm->offset_index;
+  const cs_lnum_t  *restrict offset = csm->offset;
+
+# pragma omp parallel for  if(n_blocks > CS_THR_MIN)
+  for (cs_lnum_t b_id = 0; b_id < n_blocks + 1; b_id++) {
+
+    cs_lnum_t g_start = (b_id > 0) ? block_row[2*b_id - 1] : 0;
+    cs_lnum_t s_start = block_row[2*b_id];
+    cs_lnum_t s_end = block_row[2*b_id + 1];
+
+    for (cs_lnum_t ii = g_start; ii < s_start; ii++) {
+
+      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+      const cs_real_t *restrict m_row = e_val + e_row_index[ii];
+      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+      cs_real_t sii = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += (m_row[jj]*x[col_id[jj]]);
+
+      y[ii] = (add_diag) ? sii + d_val[ii]*x[ii] : sii;
+
+    }
+
+    if (s_end > s_start) {
+
+      cs_lnum_t o_start = offset_index[b_id];
+      cs_lnum_t n_cols = offset_index[b_id + 1] - o_start;
+      const cs_lnum_t *restrict b_offset = offset + o_start;
+
+      if (add_diag) {
+        for (cs_lnum_t ii = s_start; ii < s_end; ii++) {
+          const cs_real_t *restrict m_row = e_val + e_row_index[ii];
+          cs_real_t sii = 0.0;
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+            sii += (m_row[jj]*x[ii + b_offset[jj]]);
+          y[ii] = sii + d_val[ii]*x[ii];
+        }
+      }
+      else {
+        for (cs_lnum_t ii = s_start; ii < s_end; ii++) {
+          const cs_real_t *restrict m_row = e_val + e_row_index[ii];
+          cs_real_t sii = 0.0;
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+            sii += (m_row[jj]*x[ii + b_offset[jj]]);
+          y[ii] = sii;
+        }
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with MSR matrix, using MKL
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   hs           <-- halo state: if non-NULL, call cs_halo_sync_wait
+ *                    locally (possibly allowing computation/communication
+ *                    overlap)
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+#if defined (HAVE_MKL_SPARSE_IE)
+
+static void
+_mat_vec_p_l_msr_mkl(cs_matrix_t  *matrix,
+                     bool          exclude_diag,
+                     bool          sync,
+                     cs_real_t     x[restrict],
+                     cs_real_t     y[restrict])
+{
+  const cs_matrix_coeff_dist_t  *mc
+    = (const cs_matrix_coeff_dist_t  *)matrix->coeffs;
+
+  /* Ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+  if (hs != NULL)
+    cs_halo_sync_wait(matrix->halo, x, hs);
 
   /* Call MKL function */
 
@@ -3509,20 +4388,98 @@ _bb_mat_vec_p_l_dist_3(cs_matrix_t  *matrix,
       const cs_real_t *restrict m_row =  mc->h_val + (h_row_index[ii]*9);
       cs_lnum_t n_cols = h_row_index[ii+1] - h_row_index[ii];
 
-      cs_real_t * _y = y + ii*3;
+      cs_real_t y0 = 0., y1 = 0., y2 = 0.;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t *restrict _m = m_row + jj*9;
+        const cs_real_t xj0 = x[col_id[jj]*3];
+        const cs_real_t xj1 = x[col_id[jj]*3 + 1];
+        const cs_real_t xj2 = x[col_id[jj]*3 + 2];
+        y0 += _m[0]*xj0 + _m[1]*xj1 + _m[2]*xj2;
+        y1 += _m[3]*xj0 + _m[4]*xj1 + _m[5]*xj2;
+        y2 += _m[6]*xj0 + _m[7]*xj1 + _m[8]*xj2;
+      }
+
+      y[ii*3]     += y0;
+      y[ii*3 + 1] += y1;
+      y[ii*3 + 2] += y2;
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with MSR matrix, 6x6 blocked version.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_mat_vec_p_l_dist_6(cs_matrix_t  *matrix,
+                       bool          exclude_diag,
+                       bool          sync,
+                       cs_real_t     x[restrict],
+                       cs_real_t     y[restrict])
+{
+  /* Initialize halo synchronization */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
+  /* Compute local part */
+
+  _bb_mat_vec_p_l_msr_6(matrix,
+                        exclude_diag,
+                        false,
+                        x,
+                        y);
+
+  /* Finalize halo communication */
+
+  if (hs != NULL)
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+
+  /* Compute distant part */
+
+  const cs_matrix_struct_dist_t  *ms
+    = (const cs_matrix_struct_dist_t *)matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+
+  const cs_lnum_t  n_h_rows = ms->h.n_rows;
+
+  if (n_h_rows > 0) {
+
+    const cs_lnum_t  *h_col_id = ms->h.col_id;
+    const cs_lnum_t  *h_row_index = ms->h.row_index;
+
+#   pragma omp parallel for  if(n_h_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_h_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = h_col_id + h_row_index[ii];
+      const cs_real_t *restrict m_row =  mc->h_val + (h_row_index[ii]*36);
+      cs_lnum_t n_cols = h_row_index[ii+1] - h_row_index[ii];
+
+      cs_real_t s[6] = {0., 0., 0., 0., 0., 0.};
 
       for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        _y[0] += (  m_row[jj*9]         * x[col_id[jj]*3]
-                  + m_row[jj*9 + 1]     * x[col_id[jj]*3 + 1]
-                  + m_row[jj*9 + 2]     * x[col_id[jj]*3 + 2]);
-        _y[1] += (  m_row[jj*9 + 3]     * x[col_id[jj]*3]
-                  + m_row[jj*9 + 3 + 1] * x[col_id[jj]*3 + 1]
-                  + m_row[jj*9 + 3 + 2] * x[col_id[jj]*3 + 2]);
-        _y[2] += (  m_row[jj*9 + 6]     * x[col_id[jj]*3]
-                  + m_row[jj*9 + 6 + 1] * x[col_id[jj]*3 + 1]
-                  + m_row[jj*9 + 6 + 2] * x[col_id[jj]*3 + 2]);
+        const cs_real_t *restrict _m = m_row + jj*36;
+        const cs_real_t *restrict _x = x + col_id[jj]*6;
+        for (cs_lnum_t kk = 0; kk < 6; kk++)
+          s[kk] += (  _m[kk*6]*_x[0]     + _m[kk*6 + 1]*_x[1]
+                    + _m[kk*6 + 2]*_x[2] + _m[kk*6 + 3]*_x[3]
+                    + _m[kk*6 + 4]*_x[4] + _m[kk*6 + 5]*_x[5]);
       }
 
+      for (cs_lnum_t kk = 0; kk < 6; kk++)
+        y[ii*6 + kk] += s[kk];
+
     }
 
   }
@@ -3626,6 +4583,9 @@ _bb_mat_vec_p_l_dist(cs_matrix_t  *matrix,
   if (matrix->eb_size == 3)
     _bb_mat_vec_p_l_dist_3(matrix, exclude_diag, sync, x, y);
 
+  else if (matrix->eb_size == 6 && matrix->db_size == 6)
+    _bb_mat_vec_p_l_dist_6(matrix, exclude_diag, sync, x, y);
+
   else
     _bb_mat_vec_p_l_dist_generic(matrix, exclude_diag, sync, x, y);
 }
@@ -4128,6 +5088,27 @@ cs_matrix_spmv_set_func(cs_matrix_type_t             m_type,
       }
     }
 
+    else if (!strcmp(func_name, "mesh")) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+        [[fallthrough]];
+      case CS_MATRIX_SCALAR_SYM:
+        _spmv[0] = _mat_vec_p_l_native_mf;
+        _spmv[1] = _mat_vec_p_l_native_mf;
+#if defined(HAVE_OPENMP)
+        if (numbering != NULL) {
+          if (numbering->type == CS_NUMBERING_THREADS) {
+            _spmv[0] = _mat_vec_p_l_native_mf_omp;
+            _spmv[1] = _mat_vec_p_l_native_mf_omp;
+          }
+        }
+#endif
+        break;
+      default:
+        break;
+      }
+    }
+
     else if (!strcmp(func_name, "cuda")) {
 #if defined(HAVE_CUDA)
       switch(fill_type) {
@@ -4347,6 +5328,30 @@ cs_matrix_spmv_set_func(cs_matrix_type_t             m_type,
       }
     }
 
+    else if (!strcmp(func_name, "sell")) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        _spmv[0] = _mat_vec_p_l_msr_sell;
+        _spmv[1] = _mat_vec_p_l_msr_sell;
+        break;
+      default:
+        break;
+      }
+    }
+
+    else if (!strcmp(func_name, "struct")) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        _spmv[0] = _mat_vec_p_l_msr_struct;
+        _spmv[1] = _mat_vec_p_l_msr_struct;
+        break;
+      default:
+        break;
+      }
+    }
+
     break;
 
   /* Distributed
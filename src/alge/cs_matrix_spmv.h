@@ -92,6 +92,8 @@ cs_matrix_spmv_set_defaults(cs_matrix_t  *m);
  *   CS_MATRIX_MSR
  *     default
  *     omp_sched       (Improved OpenMP scheduling, for CS_MATRIX_SCALAR*)
+ *     sell            (SELL-C-sigma storage, for CS_MATRIX_SCALAR*)
+ *     struct          (structured-block fast path, for CS_MATRIX_SCALAR*)
  *     mkl             (with MKL)
  *     mkl_sycl        (with MKL, using SYCL offload)
  *     cuda            (CUDA-accelerated)
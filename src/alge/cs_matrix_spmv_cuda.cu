@@ -136,6 +136,30 @@ typedef struct _cs_matrix_cusparse_map_t {
 
 #endif // defined(HAVE_CUSPARSE)
 
+/* Row-length bucket mapping for MSR SpMV */
+/*----------------------------------------*/
+
+/* Meshes mixing tetrahedra (4-6 extra-diagonal entries per row) and
+   polyhedra (30 or more) make a fixed thread-per-row mapping diverge
+   badly, as a warp's short rows idle while its longest row finishes.
+   Rows are sorted into 3 buckets by length at first product: short
+   rows keep the thread-per-row mapping, while medium and long rows
+   are handled by 4-lane and 32-lane sub-warp kernels, with one launch
+   per non-empty bucket on the same stream. */
+
+#define CS_MATRIX_CUDA_BUCKET_SHORT  6
+#define CS_MATRIX_CUDA_BUCKET_MED    18
+
+typedef struct _cs_matrix_msr_bucket_map_t {
+
+  cs_lnum_t   n_rows[3];   /* Number of rows per bucket */
+
+  cs_lnum_t  *row_id;      /* Device array of row ids, bucket-major;
+                              NULL if all rows are short, in which case
+                              the plain thread-per-row kernels are used */
+
+} cs_matrix_msr_bucket_map_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -413,6 +437,118 @@ _mat_vect_p_l_msr(cs_lnum_t         n_rows,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/* \brief Local matrix.vector product y = A.x with MSR matrix arrays,
+ *        over a gathered list of rows, one thread per row.
+ *
+ * If d_val is NULL, the diagonal contribution is not added
+ * (excluded diagonal case).
+ *
+ * \param[in]   n_b_rows   number of rows in bucket
+ * \param[in]   b_row_id   row ids of bucket
+ * \param[in]   row_index  pointer to matrix rows index
+ * \param[in]   col_id     pointer to matrix column id
+ * \param[in]   d_val      pointer to diagonal matrix values, or NULL
+ * \param[in]   x_val      pointer to extradiagonal matrix values
+ * \param[in]   x          multipliying vector values
+ * \param[out]  y          resulting vector
+ */
+/*----------------------------------------------------------------------------*/
+
+__global__ static void
+_mat_vect_p_l_msr_gather(cs_lnum_t         n_b_rows,
+                         const cs_lnum_t  *__restrict__ b_row_id,
+                         const cs_lnum_t  *__restrict__ row_index,
+                         const cs_lnum_t  *__restrict__ col_id,
+                         const cs_real_t  *__restrict__ d_val,
+                         const cs_real_t  *__restrict__ x_val,
+                         const cs_real_t  *__restrict__ x,
+                         cs_real_t        *__restrict__ y)
+{
+  cs_lnum_t r_idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+  if (r_idx < n_b_rows) {
+    cs_lnum_t ii = b_row_id[r_idx];
+    const cs_lnum_t *__restrict__ _col_id = col_id + row_index[ii];
+    const cs_real_t *__restrict__ m_row  = x_val + row_index[ii];
+
+    cs_lnum_t n_cols = row_index[ii + 1] - row_index[ii];
+
+    cs_real_t sii = 0.0;
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      sii += m_row[jj] * __ldg(x + _col_id[jj]);
+
+    if (d_val != NULL)
+      sii += d_val[ii] * x[ii];
+
+    y[ii] = sii;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/* \brief Local matrix.vector product y = A.x with MSR matrix arrays,
+ *        over a gathered list of rows, several lanes cooperating per row.
+ *
+ * The number of lanes must divide both the warp size and the block size;
+ * all lanes of a group share the same row, so groups exit together and
+ * the ballot mask is safe for the sub-warp reduction.
+ *
+ * If d_val is NULL, the diagonal contribution is not added
+ * (excluded diagonal case).
+ *
+ * \param[in]   n_b_rows   number of rows in bucket
+ * \param[in]   b_row_id   row ids of bucket
+ * \param[in]   row_index  pointer to matrix rows index
+ * \param[in]   col_id     pointer to matrix column id
+ * \param[in]   d_val      pointer to diagonal matrix values, or NULL
+ * \param[in]   x_val      pointer to extradiagonal matrix values
+ * \param[in]   x          multipliying vector values
+ * \param[out]  y          resulting vector
+ */
+/*----------------------------------------------------------------------------*/
+
+template <unsigned int lanes>
+__global__ static void
+_mat_vect_p_l_msr_vec(cs_lnum_t         n_b_rows,
+                      const cs_lnum_t  *__restrict__ b_row_id,
+                      const cs_lnum_t  *__restrict__ row_index,
+                      const cs_lnum_t  *__restrict__ col_id,
+                      const cs_real_t  *__restrict__ d_val,
+                      const cs_real_t  *__restrict__ x_val,
+                      const cs_real_t  *__restrict__ x,
+                      cs_real_t        *__restrict__ y)
+{
+  cs_lnum_t t_id = blockIdx.x * blockDim.x + threadIdx.x;
+  cs_lnum_t r_idx = t_id / lanes;
+  unsigned int lane = threadIdx.x % lanes;
+
+  unsigned int mask = __ballot_sync(0xffffffffu, r_idx < n_b_rows);
+
+  if (r_idx >= n_b_rows)
+    return;
+
+  cs_lnum_t ii = b_row_id[r_idx];
+  const cs_lnum_t *__restrict__ _col_id = col_id + row_index[ii];
+  const cs_real_t *__restrict__ m_row  = x_val + row_index[ii];
+
+  cs_lnum_t n_cols = row_index[ii + 1] - row_index[ii];
+
+  cs_real_t sii = 0.0;
+
+  for (cs_lnum_t jj = lane; jj < n_cols; jj += lanes)
+    sii += m_row[jj] * __ldg(x + _col_id[jj]);
+
+  for (unsigned int offset = lanes/2; offset > 0; offset /= 2)
+    sii += __shfl_down_sync(mask, sii, offset, lanes);
+
+  if (lane == 0) {
+    if (d_val != NULL)
+      sii += d_val[ii] * x[ii];
+    y[ii] = sii;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /* \brief Local diagonal contribution y = Da.x  + y.
  *
@@ -695,6 +831,111 @@ _b_mat_vect_p_l_msr_exdiag(cs_lnum_t        n_rows,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Unset matrix row-length bucket mapping.
+ *
+ * parameters:
+ *   matrix    <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_unset_msr_bucket_map(cs_matrix_t   *matrix)
+{
+  cs_matrix_msr_bucket_map_t *bm
+    = (cs_matrix_msr_bucket_map_t *)matrix->ext_lib_map;
+
+  if (bm == NULL)
+    return;
+
+  if (bm->row_id != NULL) {
+    CS_CUDA_CHECK(cudaFree(bm->row_id));
+    bm->row_id = NULL;
+  }
+
+  BFT_FREE(matrix->ext_lib_map);
+  matrix->destroy_adaptor = NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Build matrix row-length bucket mapping for MSR SpMV.
+ *
+ * Rows are grouped by extra-diagonal length: at most
+ * CS_MATRIX_CUDA_BUCKET_SHORT (thread per row), at most
+ * CS_MATRIX_CUDA_BUCKET_MED (4 lanes per row), and longer
+ * (32 lanes per row). If all rows fall in the first bucket, no
+ * device list is built and the plain kernels are used.
+ *
+ * As for external library adaptors, the mapping is dropped when matrix
+ * coefficients are modified or released, so it is rebuilt lazily on the
+ * next SpMV call.
+ *
+ * parameters:
+ *   matrix    <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_msr_bucket_map_t *
+_set_msr_bucket_map(cs_matrix_t   *matrix)
+{
+  cs_matrix_msr_bucket_map_t *bm
+    = (cs_matrix_msr_bucket_map_t *)matrix->ext_lib_map;
+
+  if (bm != NULL)
+    _unset_msr_bucket_map(matrix);
+
+  BFT_MALLOC(bm, 1, cs_matrix_msr_bucket_map_t);
+  matrix->ext_lib_map = (void *)bm;
+  matrix->destroy_adaptor = _unset_msr_bucket_map;
+
+  const cs_matrix_struct_dist_t *ms
+    = (const cs_matrix_struct_dist_t *)matrix->structure;
+
+  const cs_lnum_t n_rows = ms->n_rows;
+  const cs_lnum_t *e_row_index = ms->e.row_index;
+
+  bm->n_rows[0] = 0;
+  bm->n_rows[1] = 0;
+  bm->n_rows[2] = 0;
+  bm->row_id = NULL;
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+    if (n_cols <= CS_MATRIX_CUDA_BUCKET_SHORT)
+      bm->n_rows[0] += 1;
+    else if (n_cols <= CS_MATRIX_CUDA_BUCKET_MED)
+      bm->n_rows[1] += 1;
+    else
+      bm->n_rows[2] += 1;
+  }
+
+  if (bm->n_rows[1] + bm->n_rows[2] == 0)  /* uniformly short rows */
+    return bm;
+
+  cs_lnum_t *row_id;
+  BFT_MALLOC(row_id, n_rows, cs_lnum_t);
+
+  cs_lnum_t shift[3] = {0,
+                        bm->n_rows[0],
+                        bm->n_rows[0] + bm->n_rows[1]};
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+    if (n_cols <= CS_MATRIX_CUDA_BUCKET_SHORT)
+      row_id[shift[0]++] = ii;
+    else if (n_cols <= CS_MATRIX_CUDA_BUCKET_MED)
+      row_id[shift[1]++] = ii;
+    else
+      row_id[shift[2]++] = ii;
+  }
+
+  CS_CUDA_CHECK(cudaMalloc(&(bm->row_id), n_rows*sizeof(cs_lnum_t)));
+  CS_CUDA_CHECK(cudaMemcpy(bm->row_id, row_id, n_rows*sizeof(cs_lnum_t),
+                           cudaMemcpyHostToDevice));
+
+  BFT_FREE(row_id);
+
+  return bm;
+}
+
 /*----------------------------------------------------------------------------
  * Start synchronization of ghost values prior to matrix.vector product.
  *
@@ -1546,18 +1787,64 @@ cs_matrix_spmv_cuda_msr(cs_matrix_t  *matrix,
     cs_halo_sync_wait(matrix->halo, d_x, hs);
   }
 
+  /* Map row-length buckets if not yet done */
+
+  cs_matrix_msr_bucket_map_t *bm
+    = (cs_matrix_msr_bucket_map_t *)matrix->ext_lib_map;
+
+  if (bm == NULL)
+    bm = _set_msr_bucket_map(matrix);
+
   /* Compute SpMV */
 
   unsigned int blocksize = 256;
-  unsigned int gridsize
-    = (unsigned int)ceil((double)ms->n_rows / blocksize);
 
-  if (!exclude_diag)
-    _mat_vect_p_l_msr<<<gridsize, blocksize, 0, _stream>>>
-      (ms->n_rows, row_index, col_id, d_val, x_val, d_x, d_y);
-  else
-    _mat_vect_p_l_csr<<<gridsize, blocksize, 0, _stream>>>
-      (ms->n_rows, row_index, col_id, x_val, d_x, d_y);
+  if (bm->row_id == NULL) {  /* uniformly short rows: thread per row */
+
+    unsigned int gridsize
+      = (unsigned int)ceil((double)ms->n_rows / blocksize);
+
+    if (!exclude_diag)
+      _mat_vect_p_l_msr<<<gridsize, blocksize, 0, _stream>>>
+        (ms->n_rows, row_index, col_id, d_val, x_val, d_x, d_y);
+    else
+      _mat_vect_p_l_csr<<<gridsize, blocksize, 0, _stream>>>
+        (ms->n_rows, row_index, col_id, x_val, d_x, d_y);
+
+  }
+
+  else {  /* one launch per non-empty row-length bucket */
+
+    const cs_real_t *diag = (!exclude_diag) ? d_val : NULL;
+
+    const cs_lnum_t *b_row_id = bm->row_id;
+
+    if (bm->n_rows[0] > 0) {
+      unsigned int gridsize
+        = (unsigned int)ceil((double)bm->n_rows[0] / blocksize);
+      _mat_vect_p_l_msr_gather<<<gridsize, blocksize, 0, _stream>>>
+        (bm->n_rows[0], b_row_id, row_index, col_id, diag, x_val, d_x, d_y);
+    }
+
+    b_row_id += bm->n_rows[0];
+
+    if (bm->n_rows[1] > 0) {
+      unsigned int gridsize
+        = (unsigned int)ceil((double)(bm->n_rows[1]*4) / blocksize);
+      _mat_vect_p_l_msr_vec<4><<<gridsize, blocksize, 0, _stream>>>
+        (bm->n_rows[1], b_row_id, row_index, col_id, diag, x_val, d_x, d_y);
+    }
+
+    b_row_id += bm->n_rows[1];
+
+    if (bm->n_rows[2] > 0) {
+      unsigned int gridsize
+        = (unsigned int)ceil((double)(bm->n_rows[2]*32) / blocksize);
+      _mat_vect_p_l_msr_vec<32><<<gridsize, blocksize, 0, _stream>>>
+        (bm->n_rows[2], b_row_id, row_index, col_id, diag, x_val, d_x, d_y);
+    }
+
+  }
 
   if (_stream == 0) {
     cudaStreamSynchronize(0);
@@ -300,6 +300,12 @@ struct _cs_multigrid_t {
   double     p0p1_relax;         /* p0/p1 relaxation_parameter */
   double     k_cycle_threshold;  /* threshold for k cycle */
 
+  int        grid_reuse_interval; /* if > 0, maximum number of successive
+                                     setups which may reuse the cached
+                                     coarsening, updating only the coarse
+                                     matrix coefficients, before a full
+                                     rebuild of the hierarchy */
+
   /* Setting for use as a preconditioner */
 
   double     pc_precision;       /* preconditioner precision */
@@ -350,6 +356,13 @@ struct _cs_multigrid_t {
 
   cs_multigrid_setup_data_t  *setup_data;   /* setup data */
 
+  /* Coarsening cached between setups (grid_reuse_interval > 0) */
+
+  unsigned     n_cached_levels;       /* number of cached coarse grids */
+  unsigned     n_setups_since_build;  /* setups since last full coarsening */
+  cs_grid_t  **cached_grid_hierarchy; /* coarse grids kept from the previous
+                                         setup, or nullptr */
+
   cs_time_plot_t             *cycle_plot;       /* plotting of cycles */
   int                         plot_time_stamp;  /* plotting time stamp;
                                                    if < 0, use wall clock */
@@ -375,7 +388,9 @@ static int _k_cycle_hpc_recurse_threshold = 256; /* under this size, coarsest
                                                     use k-cycle preconditioning */
 
 static int _grid_max_level_for_device = 1; /* grids over this level are
-                                              solved on host only */
+                                              solved on host only;
+                                              < 0 for a fully device-resident
+                                              hierarchy */
 
 /*============================================================================
  * Private function prototypes for recursive
@@ -392,6 +407,32 @@ _setup_k_cycle_hpc_sub(cs_multigrid_t     *mg,
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Indicate if a given grid level should be device-resident.
+ *
+ * With a negative maximum device level, the whole hierarchy remains on
+ * device (fully device-resident cycles).
+ *
+ * parameters:
+ *   level <-- grid level (0 for finest)
+ *
+ * returns:
+ *   true if the level's matrix, vectors, and smoothers should reside
+ *   on device
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_level_uses_device(int  level)
+{
+  if (cs_get_device_id() < 0)
+    return false;
+
+  if (_grid_max_level_for_device < 0)
+    return true;
+
+  return (level <= _grid_max_level_for_device);
+}
+
 /*----------------------------------------------------------------------------
  * Initialize multigrid info structure.
  *
@@ -538,6 +579,11 @@ _multigrid_setup_log(const cs_multigrid_t *mg)
                   mg->p0p1_relax, mg->info.n_max_cycles);
   }
 
+  if (mg->grid_reuse_interval > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("    Grid hierarchy reuse interval:   %d\n"),
+                  mg->grid_reuse_interval);
+
 #if defined(HAVE_MPI)
   if (cs_glob_n_ranks > 1)
     cs_log_printf(CS_LOG_SETUP,
@@ -2016,8 +2062,7 @@ _multigrid_setup_sles(cs_multigrid_t  *mg,
     }
 
     int k = 0;
-    if (   cs_get_device_id() > -1
-        && i <= _grid_max_level_for_device)
+    if (_level_uses_device(i))
       k = 3;
 
     for (int j = 0; j < n_ops; j++) {
@@ -2092,8 +2137,7 @@ _multigrid_setup_sles(cs_multigrid_t  *mg,
     i = n_levels - 1;
 
     int k = 0;
-    if (   cs_get_device_id() > -1
-        && i <= _grid_max_level_for_device)
+    if (_level_uses_device(i))
       k = 3;
 
     g = mgd->grid_hierarchy[i];
@@ -2294,6 +2338,75 @@ _setup_hierarchy(void             *context,
 
   bool add_grid = true;
 
+  /* When grid hierarchy caching is active, try to reuse the coarsening
+     from a previous setup, re-running only the Galerkin projection of the
+     coefficients; if this fails at any level (or the reuse interval is
+     reached), the remaining cached grids are discarded and coarsening
+     restarts normally from the last valid level. */
+
+  if (mg->cached_grid_hierarchy != nullptr) {
+
+    bool reuse = (mg->n_setups_since_build < (unsigned)mg->grid_reuse_interval);
+
+    unsigned i = 0;
+
+    while (reuse && i < mg->n_cached_levels) {
+
+      cs_grid_t *c = mg->cached_grid_hierarchy[i];
+
+      if (cs_grid_update_coefficients(c, g) != 0) {
+        reuse = false;
+        break;
+      }
+
+      mg->cached_grid_hierarchy[i] = nullptr;
+      i++;
+
+      _multigrid_add_level(mg, c); /* Assign to hierarchy */
+
+      int grid_lv;
+      cs_grid_get_info(c,
+                       &grid_lv,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       &n_coarse_ranks,
+                       &n_rows,
+                       &n_cols_ext,
+                       &n_entries,
+                       &n_g_rows);
+
+      mg_lv_info = mg->lv_info + grid_lv;
+      mg_lv_info->n_ranks[0] = n_coarse_ranks;
+      mg_lv_info->n_elts[0][0] = n_rows;
+      mg_lv_info->n_elts[1][0] = n_cols_ext;
+      mg_lv_info->n_elts[2][0] = n_entries;
+
+      g = c;
+
+      t2 = cs_timer_time();
+      cs_timer_counter_add_diff(&(mg_lv_info->t_tot[0]), &t1, &t2);
+      t1 = t2;
+
+    }
+
+    if (reuse) { /* whole hierarchy reused */
+      add_grid = false;
+      mg->n_setups_since_build += 1;
+      if (verbosity > 2)
+        bft_printf(_("\n   reusing previous grid hierarchy\n"));
+    }
+    else
+      mg->n_setups_since_build = 0;
+
+    for (unsigned j = i; j < mg->n_cached_levels; j++)
+      cs_grid_destroy(mg->cached_grid_hierarchy + j);
+
+    BFT_FREE(mg->cached_grid_hierarchy);
+    mg->n_cached_levels = 0;
+
+  }
+
   while (add_grid) {
 
     n_g_rows_prev = n_g_rows;
@@ -2310,7 +2423,7 @@ _setup_hierarchy(void             *context,
       bft_printf(_("\n   building level %2u grid\n"), mg->setup_data->n_levels);
 
     cs_alloc_mode_t amode = cs_grid_get_alloc_mode(g);
-    if (mg->setup_data->n_levels > _grid_max_level_for_device)
+    if (! _level_uses_device(mg->setup_data->n_levels))
       amode = CS_ALLOC_HOST;
 
     if (mg->subtype == CS_MULTIGRID_BOTTOM)
@@ -4400,6 +4513,11 @@ cs_multigrid_finalize(void)
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set maximum grid level which should run on device (i.e. GPU).
+ *
+ * A negative value requests a fully device-resident hierarchy: all
+ * levels' matrices and work vectors are kept on device, and cycle
+ * restriction, prolongation, and smoothing run on device at every
+ * level, avoiding host-device transfers during cycles.
  */
 /*----------------------------------------------------------------------------*/
 
@@ -4512,6 +4630,11 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
   mg->p0p1_relax = 0.;
   mg->k_cycle_threshold = 0;
 
+  mg->grid_reuse_interval = 0;
+  mg->n_cached_levels = 0;
+  mg->n_setups_since_build = 0;
+  mg->cached_grid_hierarchy = nullptr;
+
   _multigrid_info_init(&(mg->info));
   for (int i = 0; i < 3; i++)
     mg->lv_mg[i] = nullptr;
@@ -4623,6 +4746,13 @@ cs_multigrid_destroy(void  **context)
 
   BFT_FREE(mg->post_name);
 
+  if (mg->cached_grid_hierarchy != nullptr) {
+    for (int i = mg->n_cached_levels - 1; i > -1; i--)
+      cs_grid_destroy(mg->cached_grid_hierarchy + i);
+    BFT_FREE(mg->cached_grid_hierarchy);
+    mg->n_cached_levels = 0;
+  }
+
   if (mg->cycle_plot != nullptr)
     cs_time_plot_finalize(&(mg->cycle_plot));
 
@@ -4764,6 +4894,41 @@ cs_multigrid_set_coarsening_options_fine_grid
   mg->coarsening_type[0] = coarsening_type;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the grid hierarchy reuse interval for successive setups.
+ *
+ * When \c interval is greater than 0, the coarse grid hierarchy built
+ * during a setup is kept when the associated solver setup is freed, and
+ * up to \c interval successive setups may reuse the cached coarsening
+ * and coarse matrix structures, only updating the coarse matrix
+ * coefficients (re-running the Galerkin projection). A full rebuild of
+ * the hierarchy occurs every \c interval setups, so that the aggregation
+ * may track slow changes in the system, as well as whenever the fine
+ * matrix structure changes or the cached construction cannot be reused
+ * (reuse is limited to the default non-relaxed, non-merged MSR-based
+ * coarse grid construction).
+ *
+ * This is mainly useful for transient computations, where the system
+ * matrix coefficients change at each time step but its structure does not.
+ *
+ * \param[in, out]  mg        pointer to multigrid info and context
+ * \param[in]       interval  maximum number of successive setups reusing
+ *                            the cached hierarchy; 0 (the default)
+ *                            deactivates reuse
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_grid_reuse_interval(cs_multigrid_t  *mg,
+                                     int              interval)
+{
+  if (mg == nullptr)
+    return;
+
+  mg->grid_reuse_interval = interval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set multigrid parameters for associated iterative solvers.
@@ -5416,10 +5581,24 @@ cs_multigrid_free(void  *context)
     }
     BFT_FREE(mgd->sles_hierarchy);
 
-    /* Destroy grid hierarchy */
-
-    for (int i = mgd->n_levels - 1; i > -1; i--)
-      cs_grid_destroy(mgd->grid_hierarchy + i);
+    /* Destroy grid hierarchy, or keep coarse levels for the next setup
+       when grid hierarchy caching is active (level 0 wraps the caller's
+       matrix, so it is always rebuilt) */
+
+    if (   mg->grid_reuse_interval > 0
+        && mg->subtype == CS_MULTIGRID_MAIN
+        && mg->cached_grid_hierarchy == nullptr
+        && mgd->n_levels > 1) {
+      mg->n_cached_levels = mgd->n_levels - 1;
+      BFT_MALLOC(mg->cached_grid_hierarchy, mg->n_cached_levels, cs_grid_t *);
+      for (unsigned i = 1; i < mgd->n_levels; i++)
+        mg->cached_grid_hierarchy[i-1] = mgd->grid_hierarchy[i];
+      cs_grid_destroy(mgd->grid_hierarchy);
+    }
+    else {
+      for (int i = mgd->n_levels - 1; i > -1; i--)
+        cs_grid_destroy(mgd->grid_hierarchy + i);
+    }
     BFT_FREE(mgd->grid_hierarchy);
 
     BFT_FREE(mgd->lv_names_buffer);
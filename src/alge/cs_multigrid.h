@@ -95,6 +95,11 @@ cs_multigrid_finalize(void);
 
 /*----------------------------------------------------------------------------*
  * Set maximum grid level which should run on device (i.e. GPU).
+ *
+ * A negative value requests a fully device-resident hierarchy: all
+ * levels' matrices and work vectors are allocated on device, and cycle
+ * restriction, prolongation, and smoothing run on device at every
+ * level, so cycles avoid host-device transfers entirely.
  *----------------------------------------------------------------------------*/
 
 void
@@ -219,6 +224,31 @@ cs_multigrid_set_coarsening_options_fine_grid
    int                   aggregation_limit,
    cs_grid_coarsening_t  coarsening_type);
 
+/*----------------------------------------------------------------------------
+ * Set the grid hierarchy reuse interval for successive setups.
+ *
+ * When interval is greater than 0, the coarse grid hierarchy built during
+ * a setup is kept when the associated solver setup is freed, and up to
+ * interval successive setups may reuse the cached coarsening and coarse
+ * matrix structures, only updating the coarse matrix coefficients.
+ * A full rebuild of the hierarchy occurs every interval setups, as well
+ * as whenever the fine matrix structure changes or the cached construction
+ * cannot be reused (reuse is limited to the default non-relaxed, non-merged
+ * MSR-based coarse grid construction).
+ *
+ * This is mainly useful for transient computations, where the system
+ * matrix coefficients change at each time step but its structure does not.
+ *
+ * parameters:
+ *   mg       <-> pointer to multigrid info and context
+ *   interval <-- maximum number of successive setups reusing the cached
+ *                hierarchy; 0 (the default) deactivates reuse
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_grid_reuse_interval(cs_multigrid_t  *mg,
+                                     int              interval);
+
 /*----------------------------------------------------------------------------
  * Set multigrid parameters for associated iterative solvers.
  *
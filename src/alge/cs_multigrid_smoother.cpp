@@ -105,6 +105,13 @@ static int _thread_debug = 0;
 
 static cs_lnum_t _pcg_sr_threshold = 512;
 
+/* Should ghost values be exchanged in reduced (single) precision during
+   smoothing sweeps? Full precision is not needed there, as smoothers only
+   damp error components, while coarse corrections and final residuals are
+   computed outside this context, at full exchange precision. */
+
+static bool _reduced_precision_halo = false;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -1046,21 +1053,34 @@ _jacobi(cs_sles_it_t              *c,
   /* Current iteration */
   /*-------------------*/
 
-  for (n_iter = iter_ini; n_iter < convergence->n_iterations_max; n_iter++) {
+  /* Alternate between vx and rk instead of copying the current
+     solution at each sweep; as smoothers run a fixed number of sweeps,
+     a final copy is only needed for an odd number of alternations */
 
-#   pragma omp parallel for if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-      rk[ii] = vx[ii];
+  cs_real_t *x_cur = vx;
+  cs_real_t *x_nxt = rk;
 
-    /* Compute Vx <- Vx - (A-diag).Rk */
+  for (n_iter = iter_ini; n_iter < convergence->n_iterations_max; n_iter++) {
+
+    /* Compute X_nxt <- diag^-1 . (Rhs - (A-diag).X_cur) */
 
-    cs_matrix_vector_multiply_partial(a, CS_MATRIX_SPMV_E, rk, vx);
+    cs_matrix_vector_multiply_partial(a, CS_MATRIX_SPMV_E, x_cur, x_nxt);
 
 #   pragma omp parallel for if(n_rows > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-      vx[ii] = (rhs[ii]-vx[ii])*ad_inv[ii];
+      x_nxt[ii] = (rhs[ii]-x_nxt[ii])*ad_inv[ii];
     }
 
+    cs_real_t *x_swap = x_cur;
+    x_cur = x_nxt;
+    x_nxt = x_swap;
+
+  }
+
+  if (x_cur != vx) {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      vx[ii] = x_cur[ii];
   }
 
   if (_aux_vectors != aux_vectors)
@@ -1164,23 +1184,38 @@ _block_3_jacobi(cs_sles_it_t              *c,
   /* Current iteration */
   /*-------------------*/
 
-  for (n_iter = iter_ini; n_iter < convergence->n_iterations_max; n_iter++) {
+  /* Alternate between vx and rk instead of copying the current
+     solution at each sweep; as smoothers run a fixed number of sweeps,
+     a final copy is only needed for an odd number of alternations */
+
+  cs_real_t *x_cur = vx;
+  cs_real_t *x_nxt = rk;
 
-    memcpy(rk, vx, n_rows * sizeof(cs_real_t));  /* rk <- vx */
+  for (n_iter = iter_ini; n_iter < convergence->n_iterations_max; n_iter++) {
 
-    /* Compute vxx <- vx - (a-diag).rk */
+    /* Compute vxx <- (a-diag).x_cur */
 
-    cs_matrix_vector_multiply_partial(a, CS_MATRIX_SPMV_E, rk, vxx);
+    cs_matrix_vector_multiply_partial(a, CS_MATRIX_SPMV_E, x_cur, vxx);
 
-    /* Compute vx <- diag^-1 . (vxx - rhs) */
+    /* Compute x_nxt <- diag^-1 . (rhs - vxx) */
 #   pragma omp parallel for if(n_blocks > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < n_blocks; ii++) {
       _fw_and_bw_lu33(ad_inv + 9*ii,
-                      vx + 3*ii,
+                      x_nxt + 3*ii,
                       vxx + 3*ii,
                       rhs + 3*ii);
     }
 
+    cs_real_t *x_swap = x_cur;
+    x_cur = x_nxt;
+    x_nxt = x_swap;
+
+  }
+
+  if (x_cur != vx) {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      vx[ii] = x_cur[ii];
   }
 
   if (_aux_vectors != aux_vectors)
@@ -1283,23 +1318,39 @@ _block_jacobi(cs_sles_it_t              *c,
   /* Current iteration */
   /*-------------------*/
 
-  for (n_iter = iter_ini; n_iter < convergence->n_iterations_max; n_iter++) {
+  /* Alternate between vx and rk instead of copying the current
+     solution at each sweep; as smoothers run a fixed number of sweeps,
+     a final copy is only needed for an odd number of alternations */
 
-    memcpy(rk, vx, n_rows * sizeof(cs_real_t));  /* rk <- vx */
+  cs_real_t *x_cur = vx;
+  cs_real_t *x_nxt = rk;
 
-    /* Compute Vx <- Vx - (A-diag).Rk */
+  for (n_iter = iter_ini; n_iter < convergence->n_iterations_max; n_iter++) {
 
-    cs_matrix_vector_multiply_partial(a, CS_MATRIX_SPMV_E, rk, vxx);
+    /* Compute vxx <- (a-diag).x_cur */
 
+    cs_matrix_vector_multiply_partial(a, CS_MATRIX_SPMV_E, x_cur, vxx);
+
+    /* Compute x_nxt <- diag^-1 . (rhs - vxx) */
 #   pragma omp parallel for if(n_blocks > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < n_blocks; ii++) {
       _fw_and_bw_lu(ad_inv + db_size_2*ii,
                     db_size,
-                    vx + db_size*ii,
+                    x_nxt + db_size*ii,
                     vxx + db_size*ii,
                     rhs + db_size*ii);
     }
 
+    cs_real_t *x_swap = x_cur;
+    x_cur = x_nxt;
+    x_nxt = x_swap;
+
+  }
+
+  if (x_cur != vx) {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      vx[ii] = x_cur[ii];
   }
 
   if (_aux_vectors != aux_vectors)
@@ -2438,11 +2489,18 @@ cs_multigrid_smoother_solve(void                *context,
   if (c->caller_n_ranks < 2 || c->comm != MPI_COMM_NULL) {
 #endif
 
+    bool reduce_prev = cs_halo_get_reduced_real_exchange();
+    if (_reduced_precision_halo)
+      cs_halo_set_reduced_real_exchange(true);
+
     cvg = c->solve(c,
                    a, diag_block_size, &convergence,
                    rhs, vx_ini, vx,
                    aux_size, aux_vectors);
 
+    if (_reduced_precision_halo)
+      cs_halo_set_reduced_real_exchange(reduce_prev);
+
 #if defined(HAVE_MPI)
   }
 #endif
@@ -2455,6 +2513,26 @@ cs_multigrid_smoother_solve(void                *context,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the use of reduced-precision ghost value exchanges in
+ *        smoothing sweeps.
+ *
+ * When active, halo synchronizations during smoother iterations are
+ * down-converted to single precision on the wire (see
+ * \ref cs_halo_set_reduced_real_exchange); exchanges outside smoothing
+ * sweeps are not affected.
+ *
+ * \param[in]  activate  true to activate, false to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_smoother_set_reduced_precision_halo(bool  activate)
+{
+  _reduced_precision_halo = activate;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
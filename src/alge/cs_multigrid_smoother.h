@@ -191,6 +191,23 @@ cs_multigrid_smoother_log(const void  *context,
 cs_sles_it_type_t
 cs_multigrid_smoother_get_type(const cs_multigrid_smoother_t  *context);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the use of reduced-precision ghost value exchanges in
+ *        smoothing sweeps.
+ *
+ * When active, halo synchronizations during smoother iterations are
+ * down-converted to single precision on the wire (see
+ * \ref cs_halo_set_reduced_real_exchange); exchanges outside smoothing
+ * sweeps are not affected.
+ *
+ * \param[in]  activate  true to activate, false to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_smoother_set_reduced_precision_halo(bool  activate);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -128,10 +128,46 @@ typedef int
 static int  cs_saddle_solver_n_systems = 0;
 static cs_saddle_solver_t  **cs_saddle_solver_systems = NULL;
 
+/* Pooled work buffers, reused from one solve to the next, so that Krylov
+   algorithms and block preconditioners do not allocate buffers at each call.
+   These pools are freed in cs_saddle_solver_finalize() */
+
+static cs_lnum_t   _wsp_pool_size = 0;
+static cs_real_t  *_wsp_pool = NULL;
+static cs_lnum_t   _pc_wsp_pool_size = 0;
+static cs_real_t  *_pc_wsp_pool = NULL;
+static cs_lnum_t   _x1_scratch_size = 0;
+static cs_real_t  *_x1_scratch = NULL;
+
 /*============================================================================
  * Static inline private function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Retrieve a buffer from a pool, growing the pool if needed
+ *
+ * \param[in]      size       requested number of values
+ * \param[in, out] pool_size  allocated size of the pool
+ * \param[in, out] pool       pool buffer
+ *
+ * \return a pointer to the pool buffer, usable for at least "size" values
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_real_t *
+_get_pool_buffer(cs_lnum_t    size,
+                 cs_lnum_t   *pool_size,
+                 cs_real_t  **pool)
+{
+  if (size > *pool_size) {
+    *pool_size = size;
+    BFT_REALLOC(*pool, size, cs_real_t);
+  }
+
+  return *pool;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Retrieve the position id in the array used to store a upper-right
@@ -635,8 +671,8 @@ _compute_residual(cs_saddle_solver_t *solver,
    * b) res2 = rhs2 - M21.x1
    */
 
-  cs_real_t *m12x2 = NULL;
-  BFT_MALLOC(m12x2, solver->n1_scatter_dofs, cs_real_t);
+  cs_real_t *m12x2 = _get_pool_buffer(solver->n1_scatter_dofs,
+                                      &_x1_scratch_size, &_x1_scratch);
   cs_array_real_fill_zero(solver->n1_scatter_dofs, m12x2);
 
   const cs_adjacency_t *adj = ctx->m21_adj;
@@ -716,8 +752,6 @@ _compute_residual(cs_saddle_solver_t *solver,
 #pragma omp parallel for if (solver->n1_scatter_dofs > CS_THR_MIN)
   for (cs_lnum_t i1 = 0; i1 < solver->n1_scatter_dofs; i1++)
     res1[i1] = rhs1[i1] - res1[i1] - m12x2[i1];
-
-  BFT_FREE(m12x2);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -756,8 +790,8 @@ _matvec_product(cs_saddle_solver_t *solver, cs_real_t *vec, cs_real_t *matvec)
 
   /* 1) M12.v2 and M21.v1 */
 
-  cs_real_t *m12v2 = NULL;
-  BFT_MALLOC(m12v2, solver->n1_scatter_dofs, cs_real_t);
+  cs_real_t *m12v2 = _get_pool_buffer(solver->n1_scatter_dofs,
+                                      &_x1_scratch_size, &_x1_scratch);
   cs_array_real_fill_zero(solver->n1_scatter_dofs, m12v2);
 
   assert(solver->n2_scatter_dofs == adj->n_elts);
@@ -832,8 +866,6 @@ _matvec_product(cs_saddle_solver_t *solver, cs_real_t *vec, cs_real_t *matvec)
 #pragma omp parallel for if (solver->n1_scatter_dofs > CS_THR_MIN)
   for (cs_lnum_t i1 = 0; i1 < solver->n1_scatter_dofs; i1++)
     mv1[i1] += m12v2[i1];
-
-  BFT_FREE(m12v2);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1028,6 +1060,124 @@ _solve_schur_approximation(cs_saddle_solver_t  *solver,
   return n_iter;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute res = sign * (r2 - m21.x1) in a single pass, fusing the
+ *        SpMV with the vector combination. Stride = 3 version.
+ *
+ * \param[in]  n2_dofs  number of (scatter) DoFs for the (2,2)-block
+ * \param[in]  x1       array for the first set
+ * \param[in]  m21_adj  adjacency related to the M21 operator
+ * \param[in]  m21_val  values associated to the M21 operator (unassembled)
+ * \param[in]  r2       rhs array for the second set
+ * \param[in]  sign     +1 or -1, sign applied to the combination
+ * \param[out] res      resulting array (have to be allocated)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_m21_multiply_vector_diff(cs_lnum_t              n2_dofs,
+                          const cs_real_t       *x1,
+                          const cs_adjacency_t  *m21_adj,
+                          const cs_real_t       *m21_val,
+                          const cs_real_t       *r2,
+                          cs_real_t              sign,
+                          cs_real_t             *res)
+{
+  assert(n2_dofs == m21_adj->n_elts);
+
+# pragma omp parallel for if (n2_dofs > CS_THR_MIN)
+  for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++) {
+
+    cs_real_t  _m21x1 = 0.;
+    for (cs_lnum_t j = m21_adj->idx[i2]; j < m21_adj->idx[i2+1]; j++)
+      _m21x1 += cs_math_3_dot_product(m21_val + 3*j, x1 + 3*m21_adj->ids[j]);
+
+    res[i2] = sign * (r2[i2] - _m21x1);
+
+  } /* Loop on x2 elements */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute res = sign * (r2 - m21.x1) in a single pass, fusing the
+ *        SpMV with the vector combination. Stride = 1 version.
+ *
+ * \param[in]  n2_dofs  number of (scatter) DoFs for the (2,2)-block
+ * \param[in]  x1       array for the first set
+ * \param[in]  m21_adj  adjacency related to the M21 operator
+ * \param[in]  m21_val  values associated to the M21 operator (unassembled)
+ * \param[in]  r2       rhs array for the second set
+ * \param[in]  sign     +1 or -1, sign applied to the combination
+ * \param[out] res      resulting array (have to be allocated)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_m21_multiply_scalar_diff(cs_lnum_t              n2_dofs,
+                          const cs_real_t       *x1,
+                          const cs_adjacency_t  *m21_adj,
+                          const cs_real_t       *m21_val,
+                          const cs_real_t       *r2,
+                          cs_real_t              sign,
+                          cs_real_t             *res)
+{
+  assert(n2_dofs == m21_adj->n_elts);
+
+# pragma omp parallel for if (n2_dofs > CS_THR_MIN)
+  for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++) {
+
+    cs_real_t  _m21x1 = 0.;
+    for (cs_lnum_t j = m21_adj->idx[i2]; j < m21_adj->idx[i2+1]; j++)
+      _m21x1 += m21_val[j] * x1[m21_adj->ids[j]];
+
+    res[i2] = sign * (r2[i2] - _m21x1);
+
+  } /* Loop on x2 elements */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute res = sign * (r2 - m21.x1), using a fused kernel when the
+ *        m21 operator matches one of the kernels of this file, and falling
+ *        back to an SpMV followed by a separate sweep otherwise
+ *
+ * \param[in]  ctx      context structure for block preconditioner
+ * \param[in]  n2_dofs  number of (scatter) DoFs for the (2,2)-block
+ * \param[in]  x1       array for the first set
+ * \param[in]  r2       rhs array for the second set
+ * \param[in]  sign     +1 or -1, sign applied to the combination
+ * \param[out] res      resulting array (have to be allocated)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_m21_multiply_diff(const cs_saddle_solver_context_block_pcd_t  *ctx,
+                   cs_lnum_t                                    n2_dofs,
+                   const cs_real_t                             *x1,
+                   const cs_real_t                             *r2,
+                   cs_real_t                                    sign,
+                   cs_real_t                                   *res)
+{
+  if (ctx->m21_vector_multiply == cs_saddle_solver_m21_multiply_vector)
+    _m21_multiply_vector_diff(n2_dofs, x1, ctx->m21_adj, ctx->m21_val,
+                              r2, sign, res);
+
+  else if (ctx->m21_vector_multiply == cs_saddle_solver_m21_multiply_scalar)
+    _m21_multiply_scalar_diff(n2_dofs, x1, ctx->m21_adj, ctx->m21_val,
+                              r2, sign, res);
+
+  else { /* Generic fallback: SpMV, then combine in a second sweep */
+
+    ctx->m21_vector_multiply(n2_dofs, x1, ctx->m21_adj, ctx->m21_val, res);
+
+#   pragma omp parallel for if (n2_dofs > CS_THR_MIN)
+    for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++)
+      res[i2] = sign * (r2[i2] - res[i2]);
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Apply a block diagonal preconditioning: Compute z s.t. P_d z = r
@@ -1126,13 +1276,9 @@ _lower_schur_pc_apply(cs_saddle_solver_t                    *solver,
   const cs_real_t  *r2 = r + ctx->b11_max_size;
   cs_real_t  *r2_tilda = pc_wsp;
 
-  ctx->m21_vector_multiply(solver->n2_scatter_dofs,
-                           z, ctx->m21_adj, ctx->m21_val,
-                           r2_tilda);
-
-# pragma omp parallel for if (solver->n2_scatter_dofs > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < solver->n2_scatter_dofs; i2++)
-    r2_tilda[i2] = r2[i2] - r2_tilda[i2];
+  _m21_multiply_diff(ctx, solver->n2_scatter_dofs, z, r2,
+                     1.0,        /* r2_tilda = r2 - m21.z1 */
+                     r2_tilda);
 
   /* 3. Solve S z2 = r2_tilda (S -> Schur approximation for the m22 block)
      ===================================================================== */
@@ -1279,14 +1425,12 @@ _sgs_schur_pc_apply(cs_saddle_solver_t                    *solver,
 
   cs_real_t  *r2_hat = pc_wsp + ctx->b11_max_size; /* x2_size */
 
-  ctx->m21_vector_multiply(n2_elts, z1_hat, ctx->m21_adj, ctx->m21_val,
-                           r2_hat); /* z1_hat has to be "scatter" */
-
   const cs_real_t  *r2 = r + ctx->b11_max_size;
 
-# pragma omp parallel for if (n2_elts > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_elts; i2++)
-    r2_hat[i2] = r2_hat[i2] - r2[i2];
+  _m21_multiply_diff(ctx, n2_elts, z1_hat, /* z1_hat has to be "scatter" */
+                     r2,
+                     -1.0,      /* r2_hat = m21.z1_hat - r2 */
+                     r2_hat);
 
   /* 3. Solve S z2 = r2_hat (S -> Schur approximation for the m22 block)
      =================================================================== */
@@ -1394,14 +1538,11 @@ _uza_schur_pc_apply(cs_saddle_solver_t                    *solver,
 
   cs_real_t  *r2_hat = pc_wsp;  /* x2_size */
 
-  ctx->m21_vector_multiply(n2_elts, z, ctx->m21_adj, ctx->m21_val,
-                           r2_hat);
-
   const cs_real_t  *r2 = r + ctx->b11_max_size;
 
-# pragma omp parallel for if (n2_elts > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_elts; i2++)
-    r2_hat[i2] = r2[i2] - r2_hat[i2];
+  _m21_multiply_diff(ctx, n2_elts, z, r2,
+                     1.0,       /* r2_hat = r2 - m21.z1 */
+                     r2_hat);
 
   /* 3. Solve S z2 = r2_hat (S -> Schur approximation for the m22 block)
      =================================================================== */
@@ -1551,25 +1692,25 @@ _set_pc_by_block(const cs_saddle_solver_t                    *solver,
 
   case CS_PARAM_SADDLE_PRECOND_LOWER:
     *wsp_size = ctx->b22_max_size;
-    BFT_MALLOC(*p_wsp, *wsp_size, cs_real_t);
+    *p_wsp = _get_pool_buffer(*wsp_size, &_pc_wsp_pool_size, &_pc_wsp_pool);
 
     return _lower_schur_pc_apply;
 
   case CS_PARAM_SADDLE_PRECOND_SGS:
     *wsp_size = 2*ctx->b11_max_size;
-    BFT_MALLOC(*p_wsp, *wsp_size, cs_real_t);
+    *p_wsp = _get_pool_buffer(*wsp_size, &_pc_wsp_pool_size, &_pc_wsp_pool);
 
     return _sgs_schur_pc_apply;
 
   case CS_PARAM_SADDLE_PRECOND_UPPER:
     *wsp_size = ctx->b11_max_size;
-    BFT_MALLOC(*p_wsp, *wsp_size, cs_real_t);
+    *p_wsp = _get_pool_buffer(*wsp_size, &_pc_wsp_pool_size, &_pc_wsp_pool);
 
     return _upper_schur_pc_apply;
 
   case CS_PARAM_SADDLE_PRECOND_UZAWA:
     *wsp_size = 2*(ctx->b11_max_size + ctx->b22_max_size);
-    BFT_MALLOC(*p_wsp, *wsp_size, cs_real_t);
+    *p_wsp = _get_pool_buffer(*wsp_size, &_pc_wsp_pool_size, &_pc_wsp_pool);
 
     return _uza_schur_pc_apply;
 
@@ -2188,6 +2329,15 @@ cs_saddle_solver_finalize(void)
 {
   BFT_FREE(cs_saddle_solver_systems);
   cs_saddle_solver_n_systems = 0;
+
+  /* Free the pooled work buffers */
+
+  BFT_FREE(_wsp_pool);
+  _wsp_pool_size = 0;
+  BFT_FREE(_pc_wsp_pool);
+  _pc_wsp_pool_size = 0;
+  BFT_FREE(_x1_scratch);
+  _x1_scratch_size = 0;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3656,9 +3806,7 @@ cs_saddle_solver_minres(cs_saddle_solver_t  *solver,
 
   const cs_lnum_t  ssys_size = ctx->b11_max_size + ctx->b22_max_size;
   cs_lnum_t  wsp_size = 7*ssys_size;
-  cs_real_t  *wsp = NULL;
-
-  BFT_MALLOC(wsp, wsp_size, cs_real_t);
+  cs_real_t  *wsp = _get_pool_buffer(wsp_size, &_wsp_pool_size, &_wsp_pool);
 
   /* Avoid calling an OpenMP initialization on the full buffer (first touch
      paragdim could slows down the memory access when used) */
@@ -3869,10 +4017,7 @@ cs_saddle_solver_minres(cs_saddle_solver_t  *solver,
 
   }
 
-  /* Free temporary workspace */
-
-  BFT_FREE(wsp);
-  BFT_FREE(pc_wsp);
+  /* The wsp and pc_wsp buffers are pooled and kept for the next call */
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3925,8 +4070,7 @@ cs_saddle_solver_gcr(cs_saddle_solver_t  *solver,
 
   const cs_lnum_t  ssys_size = ctx->b11_max_size + ctx->b22_max_size;
   cs_lnum_t  wsp_size = (2 + 2*restart)*ssys_size;
-  cs_real_t  *wsp = NULL;
-  BFT_MALLOC(wsp, wsp_size, cs_real_t);
+  cs_real_t  *wsp = _get_pool_buffer(wsp_size, &_wsp_pool_size, &_wsp_pool);
   memset(wsp, 0, wsp_size*sizeof(cs_real_t));
 
   cs_real_t  *zsave = wsp;
@@ -4099,8 +4243,8 @@ cs_saddle_solver_gcr(cs_saddle_solver_t  *solver,
 
   BFT_FREE(gamma);
   BFT_FREE(alpha);
-  BFT_FREE(wsp);
-  BFT_FREE(pc_wsp);
+
+  /* The wsp and pc_wsp buffers are pooled and kept for the next call */
 }
 
 /*----------------------------------------------------------------------------*/
@@ -353,6 +353,10 @@ static cs_map_name_to_id_t  *_type_name_map = NULL;
 static cs_sles_define_t *_cs_sles_define_default = NULL;
 static cs_sles_verbosity_t *_cs_sles_default_verbosity = NULL;
 
+/* Optional solve monitoring function */
+
+static cs_sles_solve_monitor_t *_cs_sles_solve_monitor = NULL;
+
 /* Current and maximum number of systems respectively defined by field id,
    by name, or redefined after use */
 
@@ -1813,6 +1817,12 @@ cs_sles_solve(cs_sles_t           *sles,
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(&_sles_t_tot, &t0, &t1);
 
+  /* Call monitoring function last, so that it may safely redefine
+     the solver based on the observed convergence behavior */
+
+  if (_cs_sles_solve_monitor != NULL)
+    _cs_sles_solve_monitor(sles, state, *n_iter, *residual);
+
   return state;
 }
 
@@ -1978,6 +1988,24 @@ cs_sles_set_default_verbosity(cs_sles_verbosity_t  *verbosity_func)
   _cs_sles_default_verbosity = verbosity_func;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set solve monitoring function.
+ *
+ * The provided function will be called at the end of each call to
+ * \ref cs_sles_solve, and may be used to adapt solver definitions based
+ * on the observed convergence history.
+ *
+ * \param[in]  monitor_func pointer to monitoring function, or NULL to unset
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_solve_monitor(cs_sles_solve_monitor_t  *monitor_func)
+{
+  _cs_sles_solve_monitor = monitor_func;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Output default post-processing data for failed system convergence.
@@ -285,6 +285,30 @@ typedef int
 (cs_sles_verbosity_t) (int          f_id,
                        const char  *name);
 
+/*----------------------------------------------------------------------------
+ * Function pointer for monitoring of a sparse linear equation
+ * solver's convergence behavior
+ *
+ * The function may be associated using cs_sles_set_solve_monitor(), so
+ * that it is called at the end of each call to cs_sles_solve(), after
+ * any error handler. It may be used to track iteration counts and
+ * residuals over successive solves, and may safely redefine the solver
+ * (using cs_sles_define() or a higher level function) based on that
+ * history, as it is called after all other accesses to the solver context.
+ *
+ * parameters:
+ *   sles     <-> pointer to solver object
+ *   state    <-- convergence status
+ *   n_iter   <-- number of iterations used
+ *   residual <-- residual obtained
+ *----------------------------------------------------------------------------*/
+
+typedef void
+(cs_sles_solve_monitor_t) (cs_sles_t                    *sles,
+                           cs_sles_convergence_state_t   state,
+                           int                           n_iter,
+                           double                        residual);
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -804,6 +828,21 @@ cs_sles_set_default_define(cs_sles_define_t  *define_func);
 void
 cs_sles_set_default_verbosity(cs_sles_verbosity_t  *verbosity_func);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Set solve monitoring function.
+ *
+ * The provided function will be called at the end of each call to
+ * \ref cs_sles_solve, and may be used to adapt solver definitions based
+ * on the observed convergence history.
+ *
+ * \param[in]  monitor_func pointer to monitoring function, or NULL to unset
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_solve_monitor(cs_sles_solve_monitor_t  *monitor_func);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief Output default post-processing data for failed system convergence.
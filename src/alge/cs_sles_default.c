@@ -95,10 +95,28 @@ BEGIN_C_DECLS
 
 #define CS_SLES_DEFAULT_N_SETUPS 2  /* Number of concurrent setups allowed */
 
+#define CS_SIMD_SIZE(s) (((s-1)/16+1)*16)
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
 
+/* Adaptive solver selection info, for systems whose solver is switched
+   at run time based on the observed convergence behavior */
+
+typedef struct {
+
+  int     f_id;       /* associated field id, or < 0 */
+  char   *name;       /* associated name if f_id < 0, or NULL */
+
+  int     tier;       /* current solver tier (0: Jacobi-preconditioned
+                         FCG, 1: GCR, 2: multigrid-preconditioned FCG) */
+  int     n_solves;   /* number of solves since the last switch */
+  double  mean_iter;  /* exponentially-weighted mean iteration count,
+                         or -1 if no solve since the last switch */
+
+} cs_sles_adaptive_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -107,10 +125,38 @@ static int           _n_setups = 0;
 static cs_sles_t    *_sles_setup[CS_SLES_DEFAULT_N_SETUPS];
 static cs_matrix_t  *_matrix_setup[CS_SLES_DEFAULT_N_SETUPS][2];
 
+/* Optional symmetric diagonal equilibration of native systems;
+   when active for a given setup, the matrix coefficients are the
+   scaled ones, and the stored arrays must outlive the matrix. */
+
+static bool _use_equilibration = false;
+
+static struct {
+  cs_real_t  *scale;   /* scaling vector (size n_cells_with_ghosts) */
+  cs_real_t  *da;      /* scaled diagonal coefficients */
+  cs_real_t  *xa;      /* scaled extra-diagonal coefficients */
+} _equil_setup[CS_SLES_DEFAULT_N_SETUPS];
+
 static const int _poly_degree_default = 0;
 static const int _n_max_iter_default = 10000;
 static const int _n_max_iter_default_jacobi = 100;
 
+/* Systems using adaptive solver selection */
+
+static int                  _n_adaptive = 0;
+static cs_sles_adaptive_t  *_adaptive = NULL;
+
+/* Mean iteration counts above which a stronger solver tier is selected,
+   and below which a cheaper one is restored; the gap between the two
+   avoids oscillating between tiers near a threshold */
+
+static const double  _adaptive_iter_upper = 50.;
+static const double  _adaptive_iter_lower = 12.;
+
+/* Minimum number of solves between switches (hysteresis) */
+
+static const int  _adaptive_min_solves = 5;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -309,6 +355,67 @@ _sles_setup_matrix_native(int                  f_id,
   bool need_external = false;
   char external_type[32] = "";
 
+  /* Optional symmetric diagonal equilibration: solve D.A.D.y = D.rhs
+     instead of A.x = rhs (with x = D.y), for poorly-scaled scalar
+     systems; the right-hand side and solution transforms are applied
+     at solve time. */
+
+  const cs_real_t *da_p = da, *xa_p = xa;
+
+  if (   _use_equilibration
+      && db_size == 1 && eb_size == 1
+      && da != NULL && xa != NULL) {
+
+    const cs_lnum_t n_cols_ext = m->n_cells_with_ghosts;
+
+    cs_real_t *scale;
+    BFT_MALLOC(scale, n_cols_ext, cs_real_t);
+
+    if (cs_matrix_equilibration_scaling(m->n_cells, da, scale) > 0) {
+
+      if (m->halo != NULL)
+        cs_halo_sync_var(m->halo, CS_HALO_STANDARD, scale);
+
+      cs_real_t *da_s, *xa_s;
+      const cs_lnum_t n_xa_vals = symmetric ? m->n_i_faces : 2*m->n_i_faces;
+      BFT_MALLOC(da_s, n_cols_ext, cs_real_t);
+      BFT_MALLOC(xa_s, n_xa_vals, cs_real_t);
+
+#     pragma omp parallel for  if (n_cols_ext > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_cols_ext; i++)
+        da_s[i] = (i < m->n_cells) ? da[i]*scale[i]*scale[i] : 0.;
+
+      const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+
+      if (symmetric) {
+#       pragma omp parallel for  if (m->n_i_faces > CS_THR_MIN)
+        for (cs_lnum_t f = 0; f < m->n_i_faces; f++)
+          xa_s[f] =   xa[f]
+                    * scale[i_face_cells[f][0]] * scale[i_face_cells[f][1]];
+      }
+      else {
+#       pragma omp parallel for  if (m->n_i_faces > CS_THR_MIN)
+        for (cs_lnum_t f = 0; f < m->n_i_faces; f++) {
+          const cs_real_t ds
+            = scale[i_face_cells[f][0]] * scale[i_face_cells[f][1]];
+          xa_s[f*2] = xa[f*2] * ds;
+          xa_s[f*2+1] = xa[f*2+1] * ds;
+        }
+      }
+
+      da_p = da_s;
+      xa_p = xa_s;
+
+      _equil_setup[setup_id].scale = scale;
+      _equil_setup[setup_id].da = da_s;
+      _equil_setup[setup_id].xa = xa_s;
+
+    }
+    else
+      BFT_FREE(scale);
+
+  }
+
   /* If context has not been defined yet, temporarily set
      matrix coefficients (using native matrix, which has lowest
      overhead as coefficients are provided in that form)
@@ -328,8 +435,8 @@ _sles_setup_matrix_native(int                  f_id,
                                eb_size,
                                m->n_i_faces,
                                (const cs_lnum_2_t *)(m->i_face_cells),
-                               da,
-                               xa);
+                               da_p,
+                               xa_p);
 
     cs_sles_define_t  *sles_default_func = cs_sles_get_default_define();
     sles_default_func(f_id, name, a);
@@ -419,8 +526,8 @@ _sles_setup_matrix_native(int                  f_id,
                              eb_size,
                              m->n_i_faces,
                              (const cs_lnum_2_t *)(m->i_face_cells),
-                             da,
-                             xa);
+                             da_p,
+                             xa_p);
 
   const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
   const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
@@ -504,6 +611,441 @@ _sles_setup_matrix_by_assembler(int               f_id,
   _matrix_setup[setup_id][1] = a; /* so it is freed later */
 }
 
+/*----------------------------------------------------------------------------
+ * Call sparse linear equation solver using native matrix arrays,
+ * with an optional caller-provided work area.
+ *
+ * parameters:
+ *   f_id                  <-- associated field id, or < 0
+ *   name                  <-- associated name if f_id < 0, or NULL
+ *   symmetric             <-- indicates if matrix coefficients are symmetric
+ *   diag_block_size       <-- block sizes for diagonal
+ *   extra_diag_block_size <-- block sizes for extra diagonal
+ *   da                    <-- diagonal values (NULL if zero)
+ *   xa                    <-- extradiagonal values (NULL if zero)
+ *   precision             <-- solver precision
+ *   r_norm                <-- residual normalization
+ *   n_iter                --> number of "equivalent" iterations
+ *   residual              --> residual
+ *   rhs                   <-- right hand side
+ *   vx                    <-> system solution
+ *   aux_size              <-- size of aux_vectors (in bytes)
+ *   aux_vectors           --- optional working area (solver allocates its
+ *                             own if NULL or too small)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_sles_solve_native(int                  f_id,
+                   const char          *name,
+                   bool                 symmetric,
+                   cs_lnum_t            diag_block_size,
+                   cs_lnum_t            extra_diag_block_size,
+                   const cs_real_t     *da,
+                   const cs_real_t     *xa,
+                   double               precision,
+                   double               r_norm,
+                   int                 *n_iter,
+                   double              *residual,
+                   const cs_real_t     *rhs,
+                   cs_real_t           *vx,
+                   size_t               aux_size,
+                   void                *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  cs_matrix_t *a = NULL;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  /* Check if this system has already been setup */
+
+  cs_sles_t *sc = cs_sles_find_or_add(f_id, name);
+
+  int setup_id = 0;
+  while (setup_id < _n_setups) {
+    if (_sles_setup[setup_id] == sc)
+      break;
+    else
+      setup_id++;
+  }
+
+  if (setup_id >= _n_setups) {
+
+    _n_setups += 1;
+
+    if (_n_setups > CS_SLES_DEFAULT_N_SETUPS)
+      bft_error
+        (__FILE__, __LINE__, 0,
+         "Too many linear systems solved without calling cs_sles_free_native\n"
+         "  maximum number of systems: %d\n"
+         "If this is not an error, increase CS_SLES_DEFAULT_N_SETUPS\n"
+         "  in file %s.", CS_SLES_DEFAULT_N_SETUPS, __FILE__);
+
+    /* Check if we need to used a matrix assembler */
+
+    bool need_matrix_assembler = false;
+
+    if (f_id > -1) {
+      const cs_field_t *f = cs_field_by_id(f_id);
+      int coupling_id
+        = cs_field_get_key_int(f, cs_field_key_id("coupling_entity"));
+      if (coupling_id > -1)
+        need_matrix_assembler = true;
+    }
+    const char *sles_type = cs_sles_get_type(sc);
+    if (strcmp(sles_type, "cs_sles_amgx_t") == 0) {
+      need_matrix_assembler = true;
+    }
+
+    if (need_matrix_assembler)
+      _sles_setup_matrix_by_assembler(f_id,
+                                      setup_id,
+                                      sc,
+                                      symmetric,
+                                      diag_block_size,
+                                      extra_diag_block_size,
+                                      da,
+                                      xa);
+
+    else
+      _sles_setup_matrix_native(f_id,
+                                name,
+                                setup_id,
+                                sc,
+                                symmetric,
+                                diag_block_size,
+                                extra_diag_block_size,
+                                da,
+                                xa);
+
+    _sles_setup[setup_id] = sc;
+  }
+
+  a = _matrix_setup[setup_id][0];
+
+  cs_real_t *_vx = vx, *_rhs = NULL;
+  const cs_real_t *rhs_p = rhs;
+
+  /* When equilibration scaling is active, solve the scaled system
+     D.A.D.y = D.rhs, starting from y = D^-1.x. */
+
+  const cs_real_t *e_scale = _equil_setup[setup_id].scale;
+  cs_real_t *rhs_e = NULL;
+
+  if (e_scale != NULL) {
+    cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+    BFT_MALLOC(rhs_e, n_rows, cs_real_t);
+#   pragma omp parallel for  if (n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      rhs_e[i] = rhs[i]*e_scale[i];
+      vx[i] /= e_scale[i];
+    }
+    rhs_p = rhs_e;
+  }
+
+  /* If system uses specific halo (i.e. when matrix contains more than
+     face->cell nonzeroes), allocate specific buffers and synchronize
+     right hand side. */
+
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
+  if (halo != NULL && halo != m->halo) {
+
+    size_t stride = diag_block_size;
+    cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+    cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(a);
+    assert(n_rows == m->n_cells);
+    cs_lnum_t _n_rows = n_rows*stride;
+    BFT_MALLOC(_rhs, n_cols_ext*stride, cs_real_t);
+    BFT_MALLOC(_vx, n_cols_ext*stride, cs_real_t);
+#   pragma omp parallel for  if(_n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < _n_rows; i++) {
+      _rhs[i] = rhs_p[i];
+      _vx[i] = vx[i];
+    }
+    cs_matrix_pre_vector_multiply_sync(a, _rhs);
+    rhs_p = _rhs;
+
+  }
+
+  /* Solve system */
+
+  cvg = cs_sles_solve(sc,
+                      a,
+                      precision,
+                      r_norm,
+                      n_iter,
+                      residual,
+                      rhs_p,
+                      _vx,
+                      aux_size,
+                      aux_vectors);
+
+  BFT_FREE(_rhs);
+  if (_vx != vx) {
+    size_t stride = diag_block_size;
+    cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+    cs_lnum_t _n_rows = n_rows*stride;
+#   pragma omp parallel for  if(_n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < _n_rows; i++)
+      vx[i] = _vx[i];
+    BFT_FREE(_vx);
+  }
+
+  if (e_scale != NULL) {
+    cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+#   pragma omp parallel for  if (n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      vx[i] *= e_scale[i];
+    BFT_FREE(rhs_e);
+  }
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute a flow-aligned cell ordering based on an interior face flux.
+ *
+ * Cells are ordered level by level, from upstream to downstream: each level
+ * groups cells whose upwind neighbors all belong to previous levels, so
+ * cells of a same level have no direct dependency on each other through
+ * the flux graph. Recirculation makes the graph cyclic; cycles are broken
+ * by forcing the lowest-numbered cell not yet ordered.
+ *
+ * parameters:
+ *   i_flux <-- interior face flux (usually the mass flux)
+ *
+ * returns:
+ *   ordering array of size mesh->n_cells (to be freed by caller)
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t *
+_flow_aligned_order(const cs_real_t  i_flux[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+
+  cs_mesh_adjacencies_update_cell_i_faces();
+
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+  const cs_lnum_t *c2c_idx = ma->cell_cells_idx;
+  const cs_lnum_t *c2c = ma->cell_cells;
+  const cs_lnum_t *c2f = ma->cell_i_faces;
+  const short int *c2f_sgn = ma->cell_i_faces_sgn;
+
+  cs_lnum_t *order, *n_upwind;
+  BFT_MALLOC(order, n_cells, cs_lnum_t);
+  BFT_MALLOC(n_upwind, n_cells, cs_lnum_t);
+
+  /* Count upwind neighbors (incoming flux); halo cells induce no local
+     dependency, as their values are not updated during a local sweep */
+
+# pragma omp parallel for  if(n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cs_lnum_t n = 0;
+    for (cs_lnum_t i = c2c_idx[c_id]; i < c2c_idx[c_id+1]; i++) {
+      if (c2c[i] < n_cells && c2f_sgn[i]*i_flux[c2f[i]] < 0)
+        n += 1;
+    }
+    n_upwind[c_id] = n;
+  }
+
+  /* Order cells by dependency level (Kahn's algorithm); ordered cells are
+     marked with a negative upwind count */
+
+  cs_lnum_t n_ordered = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (n_upwind[c_id] == 0) {
+      order[n_ordered++] = c_id;
+      n_upwind[c_id] = -1;
+    }
+  }
+
+  cs_lnum_t s_id = 0, scan_id = 0;
+
+  while (s_id < n_cells) {
+
+    if (s_id >= n_ordered) {
+      /* Remaining cells all belong to cycles (recirculation zones);
+         break the tie at the lowest-numbered cell not yet ordered */
+      while (n_upwind[scan_id] < 0)
+        scan_id++;
+      order[n_ordered++] = scan_id;
+      n_upwind[scan_id] = -1;
+    }
+
+    cs_lnum_t c_id = order[s_id++];
+
+    for (cs_lnum_t i = c2c_idx[c_id]; i < c2c_idx[c_id+1]; i++) {
+      cs_lnum_t c_id2 = c2c[i];
+      if (c_id2 < n_cells && n_upwind[c_id2] > 0
+          && c2f_sgn[i]*i_flux[c2f[i]] > 0) {
+        n_upwind[c_id2] -= 1;
+        if (n_upwind[c_id2] == 0) {
+          order[n_ordered++] = c_id2;
+          n_upwind[c_id2] = -1;
+        }
+      }
+    }
+
+  }
+
+  BFT_FREE(n_upwind);
+
+  return order;
+}
+
+/*----------------------------------------------------------------------------
+ * Return adaptive solver selection info for a given system, if present.
+ *
+ * parameters:
+ *   f_id <-- associated field id, or < 0
+ *   name <-- associated name if f_id < 0, or NULL
+ *
+ * returns:
+ *   pointer to matching adaptive solver info, or NULL
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_adaptive_t *
+_adaptive_entry(int          f_id,
+                const char  *name)
+{
+  for (int i = 0; i < _n_adaptive; i++) {
+    cs_sles_adaptive_t *e = _adaptive + i;
+    if (f_id > -1) {
+      if (e->f_id == f_id)
+        return e;
+    }
+    else if (e->f_id < 0 && name != NULL && e->name != NULL) {
+      if (strcmp(e->name, name) == 0)
+        return e;
+    }
+  }
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Define the solver matching the current tier of an adaptive system.
+ *
+ * Redefining the solver necessarily discards its setup data, but the
+ * matrix coefficients and sparsity (and any associated multigrid
+ * hierarchy built later) are not affected.
+ *
+ * parameters:
+ *   e <-> adaptive solver selection info
+ *----------------------------------------------------------------------------*/
+
+static void
+_adaptive_apply_tier(cs_sles_adaptive_t  *e)
+{
+  switch(e->tier) {
+
+  case 0:
+    cs_sles_it_define(e->f_id,
+                      e->name,
+                      CS_SLES_FCG,
+                      _poly_degree_default,
+                      _n_max_iter_default);
+    break;
+
+  case 1:
+    cs_sles_it_define(e->f_id,
+                      e->name,
+                      CS_SLES_GCR,
+                      _poly_degree_default,
+                      _n_max_iter_default);
+    break;
+
+  default:
+    {
+      cs_sles_it_t *c = cs_sles_it_define(e->f_id,
+                                          e->name,
+                                          CS_SLES_FCG,
+                                          -1, /* poly_degree */
+                                          _n_max_iter_default);
+      cs_sles_pc_t *pc = cs_multigrid_pc_create(CS_MULTIGRID_V_CYCLE);
+      cs_sles_it_transfer_pc(c, &pc);
+      cs_sles_t *sc = cs_sles_find(e->f_id, e->name);
+      cs_sles_set_error_handler(sc, cs_sles_default_error);
+    }
+    break;
+
+  }
+
+  e->n_solves = 0;
+  e->mean_iter = -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Monitor convergence of adaptive systems, switching solver tiers when
+ * the mean iteration count leaves the expected range.
+ *
+ * Called at the end of each call to cs_sles_solve (for all systems, so
+ * systems without a matching adaptive entry are simply ignored).
+ *
+ * parameters:
+ *   sles     <-> pointer to solver object
+ *   state    <-- convergence status
+ *   n_iter   <-- number of iterations used
+ *   residual <-- residual obtained
+ *----------------------------------------------------------------------------*/
+
+static void
+_adaptive_solve_monitor(cs_sles_t                    *sles,
+                        cs_sles_convergence_state_t   state,
+                        int                           n_iter,
+                        double                        residual)
+{
+  CS_UNUSED(residual);
+
+  cs_sles_adaptive_t *e = _adaptive_entry(cs_sles_get_f_id(sles),
+                                          cs_sles_get_name(sles));
+
+  if (e == NULL)
+    return;
+
+  if (e->mean_iter < 0)
+    e->mean_iter = n_iter;
+  else
+    e->mean_iter = 0.7*e->mean_iter + 0.3*n_iter;
+  e->n_solves += 1;
+
+  int tier = e->tier;
+
+  /* Escalate immediately on breakdown or divergence; otherwise, require
+     a stable trend over several solves before switching */
+
+  if (state <= CS_SLES_BREAKDOWN)
+    tier += 1;
+
+  else if (e->n_solves >= _adaptive_min_solves) {
+    if (e->mean_iter > _adaptive_iter_upper)
+      tier += 1;
+    else if (e->mean_iter < _adaptive_iter_lower)
+      tier -= 1;
+  }
+
+  if (tier < 0)
+    tier = 0;
+  else if (tier > 2)
+    tier = 2;
+
+  if (tier != e->tier) {
+    if (cs_sles_get_verbosity(sles) > 0)
+      cs_log_printf(CS_LOG_DEFAULT,
+                    _("\n"
+                      " Adaptive solver switch for \"%s\":"
+                      " tier %d -> %d (mean iterations: %5.1f)\n"),
+                    cs_sles_base_name(e->f_id, e->name),
+                    e->tier, tier, e->mean_iter);
+    e->tier = tier;
+    _adaptive_apply_tier(e);
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -531,6 +1073,27 @@ cs_sles_default(int                 f_id,
   _sles_default_native(f_id, name, type, symmetric);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate symmetric diagonal equilibration of
+ *        native linear systems.
+ *
+ * When active, scalar systems whose diagonal magnitude range indicates
+ * poor scaling (as may occur with strongly heterogeneous porous media)
+ * are scaled as D.A.D, with matching right-hand side and solution
+ * transforms, which usually reduces iteration counts; convergence is
+ * then tested on the scaled system. Other systems are not modified.
+ *
+ * \param[in]  enable  true to activate, false to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_default_set_equilibration(bool  enable)
+{
+  _use_equilibration = enable;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Default setup for sparse linear equation solver API.
@@ -602,6 +1165,14 @@ cs_sles_default_finalize(void)
 {
   cs_sles_log(CS_LOG_PERFORMANCE);
 
+  if (_n_adaptive > 0) {
+    cs_sles_set_solve_monitor(NULL);
+    for (int i = 0; i < _n_adaptive; i++)
+      BFT_FREE(_adaptive[i].name);
+    BFT_FREE(_adaptive);
+    _n_adaptive = 0;
+  }
+
   cs_multigrid_finalize();
   cs_sles_finalize();
 }
@@ -784,127 +1355,115 @@ cs_sles_solve_native(int                  f_id,
                      const cs_real_t     *rhs,
                      cs_real_t           *vx)
 {
-  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
-  cs_matrix_t *a = NULL;
-
-  const cs_mesh_t *m = cs_glob_mesh;
-
-  /* Check if this system has already been setup */
-
-  cs_sles_t *sc = cs_sles_find_or_add(f_id, name);
-
-  int setup_id = 0;
-  while (setup_id < _n_setups) {
-    if (_sles_setup[setup_id] == sc)
-      break;
-    else
-      setup_id++;
-  }
-
-  if (setup_id >= _n_setups) {
-
-    _n_setups += 1;
-
-    if (_n_setups > CS_SLES_DEFAULT_N_SETUPS)
-      bft_error
-        (__FILE__, __LINE__, 0,
-         "Too many linear systems solved without calling cs_sles_free_native\n"
-         "  maximum number of systems: %d\n"
-         "If this is not an error, increase CS_SLES_DEFAULT_N_SETUPS\n"
-         "  in file %s.", CS_SLES_DEFAULT_N_SETUPS, __FILE__);
-
-    /* Check if we need to used a matrix assembler */
-
-    bool need_matrix_assembler = false;
-
-    if (f_id > -1) {
-      const cs_field_t *f = cs_field_by_id(f_id);
-      int coupling_id
-        = cs_field_get_key_int(f, cs_field_key_id("coupling_entity"));
-      if (coupling_id > -1)
-        need_matrix_assembler = true;
-    }
-    const char *sles_type = cs_sles_get_type(sc);
-    if (strcmp(sles_type, "cs_sles_amgx_t") == 0) {
-      need_matrix_assembler = true;
-    }
-
-    if (need_matrix_assembler)
-      _sles_setup_matrix_by_assembler(f_id,
-                                      setup_id,
-                                      sc,
-                                      symmetric,
-                                      diag_block_size,
-                                      extra_diag_block_size,
-                                      da,
-                                      xa);
-
-    else
-      _sles_setup_matrix_native(f_id,
-                                name,
-                                setup_id,
-                                sc,
-                                symmetric,
-                                diag_block_size,
-                                extra_diag_block_size,
-                                da,
-                                xa);
-
-    _sles_setup[setup_id] = sc;
-  }
-
-  a = _matrix_setup[setup_id][0];
+  return _sles_solve_native(f_id,
+                            name,
+                            symmetric,
+                            diag_block_size,
+                            extra_diag_block_size,
+                            da,
+                            xa,
+                            precision,
+                            r_norm,
+                            n_iter,
+                            residual,
+                            rhs,
+                            vx,
+                            0,
+                            NULL);
+}
 
-  /* If system uses specific halo (i.e. when matrix contains more than
-     face->cell nonzeroes), allocate specific buffers and synchronize
-     right hand side. */
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call sparse linear equation solver for a batch of independent
+ *        systems sharing the mesh's native matrix structure.
+ *
+ * The systems are solved back to back, sharing a pooled work area, so
+ * the Krylov work arrays are allocated once per batch rather than once
+ * per system. The setup of each system is freed after its solve, as
+ * with successive cs_sles_solve_native / cs_sles_free_native calls.
+ *
+ * \param[in]       n_sys                  number of systems in batch
+ * \param[in]       f_id                   associated field ids, or < 0
+ * \param[in]       name                   associated names if f_id < 0,
+ *                                         or NULL
+ * \param[in]       symmetric              indicates if matrix coefficients
+ *                                         are symmetric, per system
+ * \param[in]       diag_block_size        block sizes for diagonal
+ * \param[in]       extra_diag_block_size  block sizes for extra diagonal
+ * \param[in]       da                     diagonal values, per system
+ *                                         (NULL if zero)
+ * \param[in]       xa                     extradiagonal values, per system
+ *                                         (NULL if zero)
+ * \param[in]       precision              solver precision
+ * \param[in]       r_norm                 residual normalization, per system
+ * \param[out]      n_iter                 number of "equivalent" iterations,
+ *                                         per system
+ * \param[out]      residual               residual, per system
+ * \param[in]       rhs                    right hand sides, per system
+ * \param[in, out]  vx                     system solutions, per system
+ *
+ * \return  worst convergence state over the batch
+ */
+/*----------------------------------------------------------------------------*/
 
-  cs_real_t *_vx = vx, *_rhs = NULL;
-  const cs_real_t *rhs_p = rhs;
+cs_sles_convergence_state_t
+cs_sles_solve_native_batch(int                      n_sys,
+                           const int                f_id[],
+                           const char       *const  name[],
+                           const bool               symmetric[],
+                           cs_lnum_t                diag_block_size,
+                           cs_lnum_t                extra_diag_block_size,
+                           const cs_real_t  *const  da[],
+                           const cs_real_t  *const  xa[],
+                           double                   precision,
+                           const double             r_norm[],
+                           int                      n_iter[],
+                           double                   residual[],
+                           const cs_real_t  *const  rhs[],
+                           cs_real_t        *const  vx[])
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_CONVERGED;
 
-  const cs_halo_t *halo = cs_matrix_get_halo(a);
-  if (halo != NULL && halo != m->halo) {
+  const cs_mesh_t *m = cs_glob_mesh;
 
-    size_t stride = diag_block_size;
-    cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
-    cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(a);
-    assert(n_rows == m->n_cells);
-    cs_lnum_t _n_rows = n_rows*stride;
-    BFT_MALLOC(_rhs, n_cols_ext*stride, cs_real_t);
-    BFT_MALLOC(_vx, n_cols_ext*stride, cs_real_t);
-#   pragma omp parallel for  if(_n_rows > CS_THR_MIN)
-    for (cs_lnum_t i = 0; i < _n_rows; i++) {
-      _rhs[i] = rhs[i];
-      _vx[i] = vx[i];
-    }
-    cs_matrix_pre_vector_multiply_sync(a, _rhs);
-    rhs_p = _rhs;
+  /* Pooled work area, shared by all systems of the batch; it is sized
+     for the usual Krylov solvers on the mesh's native structure, and a
+     solver needing more simply allocates its own (see cs_sles_it.c). */
+
+  const size_t n_wa = 10;
+  const size_t wa_size
+    = CS_SIMD_SIZE((size_t)(m->n_cells_with_ghosts) * diag_block_size);
+
+  cs_real_t *aux_vectors = NULL;
+  BFT_MALLOC(aux_vectors, wa_size*n_wa, cs_real_t);
+
+  for (int i = 0; i < n_sys; i++) {
+
+    cs_sles_convergence_state_t s_cvg
+      = _sles_solve_native(f_id[i],
+                           (name != NULL) ? name[i] : NULL,
+                           symmetric[i],
+                           diag_block_size,
+                           extra_diag_block_size,
+                           da[i],
+                           xa[i],
+                           precision,
+                           r_norm[i],
+                           n_iter + i,
+                           residual + i,
+                           rhs[i],
+                           vx[i],
+                           wa_size*n_wa*sizeof(cs_real_t),
+                           aux_vectors);
+
+    if (s_cvg < cvg)
+      cvg = s_cvg;
+
+    cs_sles_free_native(f_id[i], (name != NULL) ? name[i] : NULL);
 
   }
 
-  /* Solve system */
-
-  cvg = cs_sles_solve(sc,
-                      a,
-                      precision,
-                      r_norm,
-                      n_iter,
-                      residual,
-                      rhs_p,
-                      _vx,
-                      0,
-                      NULL);
-
-  BFT_FREE(_rhs);
-  if (_vx != vx) {
-    size_t stride = diag_block_size;
-    cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
-    cs_lnum_t _n_rows = n_rows*stride;
-#   pragma omp parallel for  if(_n_rows > CS_THR_MIN)
-    for (cs_lnum_t i = 0; i < _n_rows; i++)
-      vx[i] = _vx[i];
-    BFT_FREE(_vx);
-  }
+  BFT_FREE(aux_vectors);
 
   return cvg;
 }
@@ -941,6 +1500,10 @@ cs_sles_free_native(int          f_id,
     if (_matrix_setup[setup_id][1] != NULL)
       cs_matrix_destroy(&(_matrix_setup[setup_id][1]));
 
+    BFT_FREE(_equil_setup[setup_id].scale);
+    BFT_FREE(_equil_setup[setup_id].da);
+    BFT_FREE(_equil_setup[setup_id].xa);
+
     _n_setups -= 1;
 
     if (setup_id < _n_setups) {
@@ -948,8 +1511,106 @@ cs_sles_free_native(int          f_id,
         _matrix_setup[setup_id][i] = _matrix_setup[_n_setups][i];
       _sles_setup[setup_id] = _sles_setup[_n_setups];
       }
+      _equil_setup[setup_id] = _equil_setup[_n_setups];
+      _equil_setup[_n_setups].scale = NULL;
+      _equil_setup[_n_setups].da = NULL;
+      _equil_setup[_n_setups].xa = NULL;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Assign a flow-aligned cell ordering to a Gauss-Seidel solver.
+ *
+ * Cells are ordered from upstream to downstream relative to the given
+ * interior face flux (usually the mass flux), and grouped by dependency
+ * level, so that sweeps propagate information along the main flow
+ * direction and cells updated simultaneously by different threads have
+ * as few direct dependencies on each other as possible.
+ *
+ * This only applies to solvers of type \ref CS_SLES_P_GAUSS_SEIDEL, and
+ * is ignored for other solver types; the matching solver must already be
+ * defined when this function is called. The ordering only influences
+ * convergence speed, not correctness, so it does not need to be updated
+ * at each time step when the flow evolves slowly.
+ *
+ * \param[in]  f_id    associated field id, or < 0
+ * \param[in]  name    associated name if f_id < 0, or NULL
+ * \param[in]  i_flux  interior face flux (size: mesh->n_i_faces)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_default_assign_flow_order(int               f_id,
+                                  const char       *name,
+                                  const cs_real_t   i_flux[])
+{
+  cs_sles_t *sc = cs_sles_find(f_id, name);
+
+  if (sc == NULL)
+    return;
+
+  if (strcmp(cs_sles_get_type(sc), "cs_sles_it_t") != 0)
+    return;
+
+  cs_sles_it_t *c = cs_sles_get_context(sc);
+
+  if (cs_sles_it_get_type(c) != CS_SLES_P_GAUSS_SEIDEL)
+    return;
+
+  cs_lnum_t *order = _flow_aligned_order(i_flux);
+
+  cs_sles_it_assign_order(c, &order);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable adaptive solver selection for a given system.
+ *
+ * The solver for the matching system is switched at run time between a
+ * Jacobi-preconditioned flexible conjugate gradient, a generalized
+ * conjugate residual method, and a multigrid-preconditioned flexible
+ * conjugate gradient, based on the iteration counts observed over
+ * successive solves: a stronger (respectively cheaper) variant is
+ * selected when the mean count rises above (respectively falls below)
+ * a given range, with hysteresis so that a switch requires a stable
+ * trend rather than a single hard solve. Breakdown or divergence causes
+ * immediate escalation.
+ *
+ * This replaces any existing solver definition for that system, starting
+ * with the cheapest variant. As the sparsity pattern and matrix
+ * coefficients are not tied to the solver definition, they do not need
+ * to be rebuilt when the solver is switched.
+ *
+ * \param[in]  f_id  associated field id, or < 0
+ * \param[in]  name  associated name if f_id < 0, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_default_set_adaptive(int          f_id,
+                             const char  *name)
+{
+  cs_sles_adaptive_t *e = _adaptive_entry(f_id, name);
+
+  if (e == NULL) {
+    BFT_REALLOC(_adaptive, _n_adaptive + 1, cs_sles_adaptive_t);
+    e = _adaptive + _n_adaptive;
+    _n_adaptive += 1;
+
+    e->f_id = f_id;
+    e->name = NULL;
+    if (f_id < 0 && name != NULL) {
+      BFT_MALLOC(e->name, strlen(name) + 1, char);
+      strcpy(e->name, name);
     }
   }
+
+  e->tier = 0;
+  _adaptive_apply_tier(e);
+
+  cs_sles_set_solve_monitor(_adaptive_solve_monitor);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -77,6 +77,21 @@ cs_sles_default(int                 f_id,
                 const char         *name,
                 const cs_matrix_t  *a);
 
+/*----------------------------------------------------------------------------
+ * Activate or deactivate symmetric diagonal equilibration of native
+ * linear systems.
+ *
+ * When active, scalar systems whose diagonal magnitude range indicates
+ * poor scaling are scaled as D.A.D, with matching right-hand side and
+ * solution transforms; convergence is then tested on the scaled system.
+ *
+ * parameters:
+ *   enable <-- true to activate, false to deactivate
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sles_default_set_equilibration(bool  enable);
+
 /*----------------------------------------------------------------------------
  * Default setup setup for sparse linear equation solver API.
  *
@@ -171,6 +186,53 @@ cs_sles_solve_native(int                  f_id,
                      const cs_real_t     *rhs,
                      cs_real_t           *vx);
 
+/*----------------------------------------------------------------------------
+ * Call sparse linear equation solver for a batch of independent systems
+ * sharing the mesh's native matrix structure.
+ *
+ * The systems are solved back to back, sharing a pooled work area, so the
+ * Krylov work arrays are allocated once per batch rather than once per
+ * system. The setup of each system is freed after its solve, as with
+ * successive cs_sles_solve_native / cs_sles_free_native calls.
+ *
+ * parameters:
+ *   n_sys                  <-- number of systems in batch
+ *   f_id                   <-- associated field ids, or < 0
+ *   name                   <-- associated names if f_id < 0, or NULL
+ *   symmetric              <-- indicates if matrix coefficients are
+ *                              symmetric, per system
+ *   diag_block_size        <-- block sizes for diagonal
+ *   extra_diag_block_size  <-- block sizes for extra diagonal
+ *   da                     <-- diagonal values, per system (NULL if zero)
+ *   xa                     <-- extradiagonal values, per system
+ *                              (NULL if zero)
+ *   precision              <-- solver precision
+ *   r_norm                 <-- residual normalization, per system
+ *   n_iter                 --> number of "equivalent" iterations, per system
+ *   residual               --> residual, per system
+ *   rhs                    <-- right hand sides, per system
+ *   vx                     <-> system solutions, per system
+ *
+ * returns:
+ *   worst convergence state over the batch
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_native_batch(int                      n_sys,
+                           const int                f_id[],
+                           const char       *const  name[],
+                           const bool               symmetric[],
+                           cs_lnum_t                diag_block_size,
+                           cs_lnum_t                extra_diag_block_size,
+                           const cs_real_t  *const  da[],
+                           const cs_real_t  *const  xa[],
+                           double                   precision,
+                           const double             r_norm[],
+                           int                      n_iter[],
+                           double                   residual[],
+                           const cs_real_t  *const  rhs[],
+                           cs_real_t        *const  vx[]);
+
 /*----------------------------------------------------------------------------
  * Free sparse linear equation solver setup using native matrix arrays.
  *
@@ -183,6 +245,53 @@ void
 cs_sles_free_native(int          f_id,
                     const char  *name);
 
+/*----------------------------------------------------------------------------
+ * Assign a flow-aligned cell ordering to a Gauss-Seidel solver.
+ *
+ * Cells are ordered from upstream to downstream relative to the given
+ * interior face flux (usually the mass flux), and grouped by dependency
+ * level, so that sweeps propagate information along the main flow direction
+ * and cells updated simultaneously by different threads have as few direct
+ * dependencies on each other as possible.
+ *
+ * This only applies to solvers of type CS_SLES_P_GAUSS_SEIDEL, and is
+ * ignored for other solver types; the matching solver must already be
+ * defined when this function is called. The ordering only influences
+ * convergence speed, not correctness, so it does not need to be updated
+ * at each time step when the flow evolves slowly.
+ *
+ * parameters:
+ *   f_id   <-- associated field id, or < 0
+ *   name   <-- associated name if f_id < 0, or NULL
+ *   i_flux <-- interior face flux (size: mesh->n_i_faces)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sles_default_assign_flow_order(int               f_id,
+                                  const char       *name,
+                                  const cs_real_t   i_flux[]);
+
+/*----------------------------------------------------------------------------
+ * Enable adaptive solver selection for a given system.
+ *
+ * The solver for the matching system is switched at run time between a
+ * Jacobi-preconditioned flexible conjugate gradient, a generalized
+ * conjugate residual method, and a multigrid-preconditioned flexible
+ * conjugate gradient, based on the iteration counts observed over
+ * successive solves. Breakdown or divergence causes immediate escalation.
+ *
+ * This replaces any existing solver definition for that system, starting
+ * with the cheapest variant.
+ *
+ * parameters:
+ *   f_id <-- associated field id, or < 0
+ *   name <-- associated name if f_id < 0, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sles_default_set_adaptive(int          f_id,
+                             const char  *name);
+
 /*----------------------------------------------------------------------------
  * Error handler attempting fallback to alternative solution procedure for
  * sparse linear equation solver.
@@ -46,6 +46,8 @@
  * Local headers
  *----------------------------------------------------------------------------*/
 
+#include "cs_all_to_all.h"
+#include "cs_matrix_assembler.h"
 #include "cs_parall.h"
 
 /*----------------------------------------------------------------------------
@@ -134,6 +136,7 @@ const char *cs_sles_it_type_name[]
   = {N_("Conjugate Gradient"),
      N_("Flexible Conjugate Gradient"),
      N_("Inexact Preconditioned Conjugate Gradient"),
+     N_("Pipelined Conjugate Gradient"),
      N_("Jacobi"),
      N_("BiCGstab"),
      N_("BiCGstab2"),
@@ -313,10 +316,7 @@ _dot_products_vr_vw_vq_rr(const cs_sles_it_t  *c,
 {
   double s[4];
 
-  /* Use two separate call as cs_blas.c does not yet hav matching call */
-
-  cs_dot_xy_yz(c->setup_data->n_rows, w, v, q, s+1, s+2);
-  cs_dot_xx_xy(c->setup_data->n_rows, r, v, s+3, s);
+  cs_dot_xy_xz_xw_yy(c->setup_data->n_rows, v, r, w, q, s, s+1, s+2, s+3);
 
 #if defined(HAVE_MPI)
 
@@ -334,6 +334,432 @@ _dot_products_vr_vw_vq_rr(const cs_sles_it_t  *c,
   *s4 = s[3];
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Bounded-staleness residual reduction state.
+ *
+ * When a nonzero lag is used, residual norm contributions are summed using
+ * nonblocking allreduces whose results are only consumed "lag" iterations
+ * after being posted, so iterations do not need to wait on a global
+ * synchronization; convergence detection is delayed by up to lag iterations.
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  int           lag;        /* staleness bound (0: synchronous reduction) */
+  int           n_posted;   /* number of reductions posted */
+  int           n_done;     /* number of results consumed */
+
+  MPI_Comm      comm;       /* associated communicator */
+
+  double       *sum_buf;    /* ring of send/receive buffer pairs (2*lag) */
+  MPI_Request  *request;    /* ring of pending requests (lag) */
+
+} _stale_reduce_t;
+
+/*----------------------------------------------------------------------------
+ * Initialize bounded-staleness reduction state from solver options.
+ *
+ * parameters:
+ *   sr <-> reduction state
+ *   c  <-- pointer to solver context info
+ *----------------------------------------------------------------------------*/
+
+static void
+_stale_reduce_init(_stale_reduce_t     *sr,
+                   const cs_sles_it_t  *c)
+{
+  sr->lag = 0;
+  sr->n_posted = 0;
+  sr->n_done = 0;
+  sr->comm = c->comm;
+  sr->sum_buf = NULL;
+  sr->request = NULL;
+
+  if (c->comm != MPI_COMM_NULL && c->res_reduce_lag > 0) {
+    sr->lag = c->res_reduce_lag;
+    BFT_MALLOC(sr->sum_buf, sr->lag*2, double);
+    BFT_MALLOC(sr->request, sr->lag, MPI_Request);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Reduce a residual norm contribution over all ranks.
+ *
+ * In synchronous mode, s is summed in place and true is returned.
+ * Otherwise, a nonblocking allreduce of s is posted, and s is replaced by
+ * the result of the reduction posted lag calls earlier when available.
+ *
+ * parameters:
+ *   sr <-> reduction state
+ *   s  <-> local contribution in, (possibly stale) global sum out
+ *
+ * returns:
+ *   true if s now contains a globally reduced value
+ *----------------------------------------------------------------------------*/
+
+static bool
+_stale_reduce_apply(_stale_reduce_t  *sr,
+                    double           *s)
+{
+  if (sr->comm == MPI_COMM_NULL)
+    return true;
+
+  if (sr->lag == 0) {
+    double _sum;
+    MPI_Allreduce(s, &_sum, 1, MPI_DOUBLE, MPI_SUM, sr->comm);
+    *s = _sum;
+    return true;
+  }
+
+  bool retval = false;
+  double r = 0;
+  int slot = sr->n_posted % sr->lag;
+
+  /* The slot's reduction was posted lag calls ago, so it has had lag
+     iterations to progress and the wait below should not block */
+
+  if (sr->n_posted - sr->n_done >= sr->lag) {
+    MPI_Wait(sr->request + slot, MPI_STATUS_IGNORE);
+    sr->n_done += 1;
+    r = sr->sum_buf[slot*2 + 1];
+    retval = true;
+  }
+
+  sr->sum_buf[slot*2] = *s;
+  MPI_Iallreduce(sr->sum_buf + slot*2, sr->sum_buf + slot*2 + 1,
+                 1, MPI_DOUBLE, MPI_SUM, sr->comm, sr->request + slot);
+  sr->n_posted += 1;
+
+  if (retval)
+    *s = r;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Complete pending residual norm reductions and free associated buffers.
+ *
+ * parameters:
+ *   sr <-> reduction state
+ *   s  --> most recently posted reduction result, if available
+ *
+ * returns:
+ *   true if at least one pending result was completed
+ *----------------------------------------------------------------------------*/
+
+static bool
+_stale_reduce_finalize(_stale_reduce_t  *sr,
+                       double           *s)
+{
+  bool retval = false;
+
+  if (sr->lag > 0) {
+    while (sr->n_done < sr->n_posted) {
+      int slot = sr->n_done % sr->lag;
+      MPI_Wait(sr->request + slot, MPI_STATUS_IGNORE);
+      sr->n_done += 1;
+      *s = sr->sum_buf[slot*2 + 1];
+      retval = true;
+    }
+    BFT_FREE(sr->sum_buf);
+    BFT_FREE(sr->request);
+    sr->lag = 0;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Rank folding data for small distributed systems.
+ *
+ * Below a given global size, a system is gathered on a subset of the
+ * calling ranks (using a block distribution of its rows), so that
+ * reduction and halo exchange latency during its solution involves
+ * only those ranks.
+ *----------------------------------------------------------------------------*/
+
+typedef struct _cs_sles_it_fold_t {
+
+  int                     n_f_ranks;   /* number of ranks after folding */
+
+  cs_lnum_t               n_rows;      /* local rows of source system */
+  cs_lnum_t               n_nz;        /* local extra-diagonal nonzeroes
+                                          of source system */
+
+  cs_all_to_all_t        *d;           /* row values redistributor */
+
+  cs_matrix_assembler_t  *ma;          /* assembler for folded matrix */
+  cs_matrix_t            *a;           /* folded matrix */
+
+  cs_gnum_t              *g_row_id;    /* global row ids of local matrix
+                                          entries (diagonal included) */
+  cs_gnum_t              *g_col_id;    /* matching global column ids */
+
+  cs_real_t              *rhs;         /* folded right-hand side */
+  cs_real_t              *vx;          /* folded solution */
+
+} cs_sles_it_fold_t;
+
+/*----------------------------------------------------------------------------
+ * Destroy rank folding data and restore the solver communicator.
+ *
+ * parameters:
+ *   c <-> pointer to solver context info
+ *----------------------------------------------------------------------------*/
+
+static void
+_fold_destroy(cs_sles_it_t  *c)
+{
+  cs_sles_it_fold_t *f = c->fold;
+
+  if (f == NULL)
+    return;
+
+  BFT_FREE(f->rhs);
+  BFT_FREE(f->vx);
+  BFT_FREE(f->g_row_id);
+  BFT_FREE(f->g_col_id);
+
+  if (f->a != NULL)
+    cs_matrix_destroy(&(f->a));
+  if (f->ma != NULL)
+    cs_matrix_assembler_destroy(&(f->ma));
+  if (f->d != NULL)
+    cs_all_to_all_destroy(&(f->d));
+
+  BFT_FREE(f);
+  c->fold = NULL;
+
+  c->comm = c->caller_comm;
+}
+
+/*----------------------------------------------------------------------------
+ * Update rank folding data for a given matrix.
+ *
+ * When the system is small enough, the folded matrix is built (or its
+ * coefficients simply refreshed when the cached gather pattern still
+ * matches), and the solver communicator is switched to the cached
+ * sub-communicator; otherwise, previous folding data is destroyed.
+ *
+ * This function is collective on the caller communicator.
+ *
+ * parameters:
+ *   c         <-> pointer to solver context info
+ *   name      <-- pointer to system name
+ *   a         <-- matrix
+ *   verbosity <-- associated verbosity
+ *
+ * returns:
+ *   true if folding is active (the folded matrix should then be
+ *   substituted for the caller's matrix), false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_fold_update(cs_sles_it_t       *c,
+             const char         *name,
+             const cs_matrix_t  *a,
+             int                 verbosity)
+{
+  /* Only applicable when reductions span all calling ranks, for
+     scalar MSR matrices */
+
+  if (   c->caller_n_ranks < 2
+      || c->caller_comm != cs_glob_mpi_comm
+      || (c->comm != c->caller_comm && c->fold == NULL)
+      || cs_matrix_get_type(a) != CS_MATRIX_MSR
+      || cs_matrix_get_diag_block_size(a) != 1
+      || cs_matrix_get_extra_diag_block_size(a) != 1) {
+    _fold_destroy(c);
+    return false;
+  }
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(a);
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
+
+  const cs_lnum_t *row_index, *col_id;
+  const cs_real_t *d_val, *x_val;
+  cs_matrix_get_msr_arrays(a, &row_index, &col_id, &d_val, &x_val);
+
+  const cs_lnum_t n_nz = row_index[n_rows];
+
+  /* Check matching of cached gather pattern and global size
+     in a single reduction */
+
+  cs_gnum_t counts[3] = {(cs_gnum_t)n_rows, 1, 0};
+  if (   c->fold != NULL
+      && c->fold->n_rows == n_rows
+      && c->fold->n_nz == n_nz)
+    counts[1] = 0;
+  if (halo == NULL && n_cols_ext > n_rows)
+    counts[2] = 1;
+
+  MPI_Allreduce(MPI_IN_PLACE, counts, 3, CS_MPI_GNUM, MPI_SUM,
+                c->caller_comm);
+
+  const cs_gnum_t n_g_rows = counts[0];
+
+  if (n_g_rows == 0 || n_g_rows >= c->fold_threshold || counts[2] > 0) {
+    _fold_destroy(c);
+    return false;
+  }
+
+  /* Size the folded rank set and matching block distribution */
+
+  cs_lnum_t min_rows = (c->fold_min_rows > 0) ? c->fold_min_rows : 1;
+  int n_f_ranks = n_g_rows / (cs_gnum_t)min_rows;
+  if (n_f_ranks < 1)
+    n_f_ranks = 1;
+  else if (n_f_ranks > c->caller_n_ranks)
+    n_f_ranks = c->caller_n_ranks;
+
+  int rank_step = c->caller_n_ranks / n_f_ranks;
+  if (rank_step < 2) {
+    _fold_destroy(c);
+    return false;
+  }
+  n_f_ranks = (c->caller_n_ranks + rank_step - 1) / rank_step;
+
+  const cs_gnum_t b_size = n_g_rows / (cs_gnum_t)n_f_ranks;
+  const cs_gnum_t b_rem = n_g_rows % (cs_gnum_t)n_f_ranks;
+  const cs_gnum_t b_cut = b_rem*(b_size+1);
+
+  /* (Re)build gather pattern and folded matrix structure if needed */
+
+  if (counts[1] > 0) {
+
+    _fold_destroy(c);
+
+    cs_sles_it_fold_t *f;
+    BFT_MALLOC(f, 1, cs_sles_it_fold_t);
+    f->n_f_ranks = n_f_ranks;
+    f->n_rows = n_rows;
+    f->n_nz = n_nz;
+
+    /* Global row ids based on a scan of the current distribution,
+       extended to ghost columns */
+
+    cs_gnum_t row_shift = 0, _n_rows = n_rows;
+    MPI_Scan(&_n_rows, &row_shift, 1, CS_MPI_GNUM, MPI_SUM, c->caller_comm);
+    row_shift -= (cs_gnum_t)n_rows;
+
+    cs_gnum_t *g_ext_id;
+    BFT_MALLOC(g_ext_id, n_cols_ext, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_cols_ext; i++)
+      g_ext_id[i] = row_shift + (cs_gnum_t)i;
+    if (halo != NULL)
+      cs_halo_sync_untyped(halo, CS_HALO_STANDARD, sizeof(cs_gnum_t),
+                           g_ext_id);
+
+    /* Local range of the folded block distribution; ranks not on the
+       sub-communicator rank step are assigned an empty range */
+
+    int rank_id;
+    MPI_Comm_rank(c->caller_comm, &rank_id);
+
+    cs_gnum_t l_range[2] = {0, 0};
+    if (rank_id % rank_step == 0) {
+      cs_gnum_t b_id = rank_id / rank_step;
+      l_range[0] = b_id*b_size + CS_MIN(b_id, b_rem);
+      l_range[1] = (b_id+1)*b_size + CS_MIN(b_id+1, b_rem);
+    }
+
+    /* Assemble folded matrix structure from global ids; ranks with an
+       empty range simply contribute all their entries to distant rows */
+
+    BFT_MALLOC(f->g_row_id, n_rows + n_nz, cs_gnum_t);
+    BFT_MALLOC(f->g_col_id, n_rows + n_nz, cs_gnum_t);
+
+    cs_lnum_t k = 0;
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      f->g_row_id[k] = row_shift + (cs_gnum_t)i;
+      f->g_col_id[k] = f->g_row_id[k];
+      k++;
+      for (cs_lnum_t j = row_index[i]; j < row_index[i+1]; j++) {
+        f->g_row_id[k] = row_shift + (cs_gnum_t)i;
+        f->g_col_id[k] = g_ext_id[col_id[j]];
+        k++;
+      }
+    }
+
+    BFT_FREE(g_ext_id);
+
+    f->ma = cs_matrix_assembler_create(l_range, true);
+    cs_matrix_assembler_add_g_ids(f->ma, n_rows + n_nz,
+                                  f->g_row_id, f->g_col_id);
+    cs_matrix_assembler_compute(f->ma);
+
+    f->a = cs_matrix_create_from_assembler(CS_MATRIX_MSR, f->ma);
+
+    const cs_lnum_t n_cols_f = cs_matrix_get_n_columns(f->a);
+    BFT_MALLOC(f->rhs, n_cols_f, cs_real_t);
+    BFT_MALLOC(f->vx, n_cols_f, cs_real_t);
+
+    /* Row values redistributor matching the folded block distribution */
+
+    int *dest_rank;
+    cs_lnum_t *dest_id;
+    BFT_MALLOC(dest_rank, n_rows, int);
+    BFT_MALLOC(dest_id, n_rows, cs_lnum_t);
+
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      cs_gnum_t g_id = row_shift + (cs_gnum_t)i;
+      cs_gnum_t b_id = (g_id < b_cut) ?
+        g_id/(b_size+1) : b_rem + (g_id - b_cut)/b_size;
+      dest_rank[i] = (int)b_id * rank_step;
+      dest_id[i] = g_id - (b_id*b_size + CS_MIN(b_id, b_rem));
+    }
+
+    f->d = cs_all_to_all_create(n_rows,
+                                CS_ALL_TO_ALL_USE_DEST_ID,
+                                dest_id,
+                                dest_rank,
+                                c->caller_comm);
+
+    cs_all_to_all_transfer_dest_rank(f->d, &dest_rank);
+    cs_all_to_all_transfer_dest_id(f->d, &dest_id);
+
+    c->fold = f;
+    c->comm = cs_base_get_rank_step_comm(rank_step);
+
+    if (verbosity > 1)
+      bft_printf(_("\n Folding of linear system \"%s\" (%llu rows)"
+                   " on %d ranks\n"),
+                 name, (unsigned long long)n_g_rows, n_f_ranks);
+
+  }
+
+  /* Gather matrix coefficients (at each setup) */
+
+  {
+    cs_sles_it_fold_t *f = c->fold;
+
+    cs_real_t *val;
+    BFT_MALLOC(val, n_rows + n_nz, cs_real_t);
+
+    cs_lnum_t k = 0;
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      val[k++] = d_val[i];
+      for (cs_lnum_t j = row_index[i]; j < row_index[i+1]; j++)
+        val[k++] = x_val[j];
+    }
+
+    cs_matrix_assembler_values_t *mav
+      = cs_matrix_assembler_values_init(f->a, 1, 1);
+    cs_matrix_assembler_values_add_g(mav, n_rows + n_nz,
+                                     f->g_row_id, f->g_col_id, val);
+    cs_matrix_assembler_values_finalize(&mav);
+
+    BFT_FREE(val);
+  }
+
+  return true;
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using preconditioned conjugate gradient.
  *
@@ -903,30 +1329,257 @@ _conjugate_gradient_ip(cs_sles_it_t              *c,
     beta = (CS_ABS(rk_gk_m1) > DBL_MIN) ? (rk_gk - rkm1_gk) / rk_gk_m1 : 0.;
     rk_gk_m1 = rk_gk;
 
-#   pragma omp parallel for firstprivate(alpha) if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-      dk[ii] = gk[ii] + (beta * dk[ii]);
+#   pragma omp parallel for firstprivate(alpha) if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      dk[ii] = gk[ii] + (beta * dk[ii]);
+
+    cs_matrix_vector_multiply(a, dk, zk);
+
+    _dot_products_xy_yz(c, rk, dk, zk, &ro_0, &ro_1);
+
+    cs_real_t d_ro_1 = (CS_ABS(ro_1) > DBL_MIN) ? 1. / ro_1 : 0.;
+    alpha =  - ro_0 * d_ro_1;
+
+#   pragma omp parallel if(n_rows > CS_THR_MIN)
+    {
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        vx[ii] += (alpha * dk[ii]);
+
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        rkm1[ii] = rk[ii];
+        rk[ii] += (alpha * zk[ii]);
+      }
+    }
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using pipelined preconditioned conjugate gradient.
+ *
+ * This variant, described in \cite Ghysels:2014, uses a single global
+ * reduction per iteration, started in non-blocking mode (MPI_Iallreduce)
+ * and overlapped with the preconditioner application and matrix.vector
+ * product, at the cost of additional local vector operations.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx_ini          <-- initial system solution
+ *                       (vx if nonzero, nullptr if zero)
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_conjugate_gradient_pipelined(cs_sles_it_t              *c,
+                              const cs_matrix_t         *a,
+                              cs_lnum_t                  diag_block_size,
+                              cs_sles_it_convergence_t  *convergence,
+                              const cs_real_t           *rhs,
+                              cs_real_t                 *restrict vx_ini,
+                              cs_real_t                 *restrict vx,
+                              size_t                     aux_size,
+                              void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict uk, *restrict wk;
+  cs_real_t  *restrict pk, *restrict sk, *restrict qk, *restrict zk;
+  cs_real_t  *restrict mk, *restrict nk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 9;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    rk = _aux_vectors;
+    uk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+    pk = _aux_vectors + wa_size*3;
+    sk = _aux_vectors + wa_size*4;
+    qk = _aux_vectors + wa_size*5;
+    zk = _aux_vectors + wa_size*6;
+    mk = _aux_vectors + wa_size*7;
+    nk = _aux_vectors + wa_size*8;
+  }
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  /* Residual */
+
+  if (vx_ini == vx) {
+    cs_matrix_vector_multiply(a, vx, rk);  /* rk = A.x0 */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      rk[ii] = rhs[ii] - rk[ii];
+  }
+  else {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      rk[ii] = rhs[ii];
+      vx[ii] = 0.;
+    }
+  }
+
+  /* uk = M^-1.rk, wk = A.uk */
+
+  c->setup_data->pc_apply(c->setup_data->pc_context, rk, uk);
+
+  cs_matrix_vector_multiply(a, uk, wk);
+
+  double gamma_km1 = 0., alpha = 0.;
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* Local parts of gamma = (rk, uk), delta = (wk, uk),
+       and residual; a single reduction is started here, and
+       overlapped with the preconditioner application and
+       matrix.vector product below. */
+
+    double s[3];
+
+    cs_dot_xy_yz_zz(n_rows, wk, uk, rk, s, s+1, s+2);
+
+#if defined(HAVE_MPI)
+
+    MPI_Request nb_request = MPI_REQUEST_NULL;
+
+    if (c->comm != MPI_COMM_NULL) {
+#if (MPI_VERSION >= 3)
+      MPI_Iallreduce(MPI_IN_PLACE, s, 3, MPI_DOUBLE, MPI_SUM, c->comm,
+                     &nb_request);
+#else
+      MPI_Allreduce(MPI_IN_PLACE, s, 3, MPI_DOUBLE, MPI_SUM, c->comm);
+#endif
+    }
+
+#endif /* defined(HAVE_MPI) */
+
+    /* Overlapped with the reduction:
+       mk = M^-1.wk, nk = A.mk */
+
+    c->setup_data->pc_apply(c->setup_data->pc_context, wk, mk);
+
+    cs_matrix_vector_multiply(a, mk, nk);
+
+#if defined(HAVE_MPI)
+
+    if (nb_request != MPI_REQUEST_NULL)
+      MPI_Wait(&nb_request, MPI_STATUS_IGNORE);
+
+#endif /* defined(HAVE_MPI) */
+
+    double delta_k = s[0];
+    double gamma_k = s[1];
+    double residual = sqrt(s[2]);
+
+    /* Convergence test for end of previous iteration */
+
+    if (n_iter > 0)
+      cvg = _convergence_test(c, n_iter, residual, convergence);
+    else
+      c->setup_data->initial_residual = residual;
+
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    /* Descent parameter and search direction recurrences */
+
+    double beta;
+
+    if (n_iter > 0) {
+      beta = (CS_ABS(gamma_km1) > DBL_MIN) ? gamma_k / gamma_km1 : 0.;
+      double dd =   delta_k
+                  - beta * ((CS_ABS(alpha) > DBL_MIN) ? gamma_k / alpha : 0.);
+      alpha = (CS_ABS(dd) > DBL_MIN) ? gamma_k / dd : 0.;
+
+#     pragma omp parallel if(n_rows > CS_THR_MIN)
+      {
+#       pragma omp for nowait
+        for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+          zk[ii] = nk[ii] + beta * zk[ii];
+          qk[ii] = mk[ii] + beta * qk[ii];
+        }
+
+#       pragma omp for nowait
+        for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+          sk[ii] = wk[ii] + beta * sk[ii];
+          pk[ii] = uk[ii] + beta * pk[ii];
+        }
+      }
+    }
+    else { /* n_iter == 0 */
+      alpha = (CS_ABS(delta_k) > DBL_MIN) ? gamma_k / delta_k : 0.;
 
-    cs_matrix_vector_multiply(a, dk, zk);
+#     pragma omp parallel if(n_rows > CS_THR_MIN)
+      {
+#       pragma omp for nowait
+        for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+          zk[ii] = nk[ii];
+          qk[ii] = mk[ii];
+        }
 
-    _dot_products_xy_yz(c, rk, dk, zk, &ro_0, &ro_1);
+#       pragma omp for nowait
+        for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+          sk[ii] = wk[ii];
+          pk[ii] = uk[ii];
+        }
+      }
+    }
 
-    cs_real_t d_ro_1 = (CS_ABS(ro_1) > DBL_MIN) ? 1. / ro_1 : 0.;
-    alpha =  - ro_0 * d_ro_1;
+    /* Update solution, residual, and auxiliary vectors */
 
 #   pragma omp parallel if(n_rows > CS_THR_MIN)
     {
 #     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-        vx[ii] += (alpha * dk[ii]);
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        vx[ii] += alpha * pk[ii];
+        rk[ii] -= alpha * sk[ii];
+      }
 
 #     pragma omp for nowait
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-        rkm1[ii] = rk[ii];
-        rk[ii] += (alpha * zk[ii]);
+        uk[ii] -= alpha * qk[ii];
+        wk[ii] -= alpha * zk[ii];
       }
     }
 
+    gamma_km1 = gamma_k;
+
+    n_iter += 1;
   }
 
   if (_aux_vectors != aux_vectors)
@@ -1773,11 +2426,20 @@ _jacobi(cs_sles_it_t              *c,
   /* First iteration simplified if vx == 0
      ------------------------------------- */
 
+  unsigned res_lag = 0;
+
+#if defined(HAVE_MPI)
+  _stale_reduce_t sr;
+  _stale_reduce_init(&sr, c);
+  res_lag = sr.lag;
+#endif
+
   if (vx_ini != vx) {
     assert(vx_ini == NULL);
     n_iter += 1;
 
     double  res2 = 0.0;
+    bool    res_valid = true;
 
     if (convergence->precision > 0. || c->plot != NULL) {
 
@@ -1791,15 +2453,12 @@ _jacobi(cs_sles_it_t              *c,
 
 #if defined(HAVE_MPI)
 
-      if (c->comm != MPI_COMM_NULL) {
-        double _sum;
-        MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
-        res2 = _sum;
-      }
+      res_valid = _stale_reduce_apply(&sr, &res2);
 
 #endif /* defined(HAVE_MPI) */
 
-      residual = sqrt(res2); /* Actually, residual of previous iteration */
+      if (res_valid)
+        residual = sqrt(res2); /* Actually, residual of previous iteration */
 
     }
     else {
@@ -1812,12 +2471,16 @@ _jacobi(cs_sles_it_t              *c,
 
     }
 
-    /* Convergence test */
+    /* Convergence test (delayed by up to res_lag iterations) */
 
-    if (n_iter == 1)
-      c->setup_data->initial_residual = residual;
+    if (res_valid) {
 
-    cvg = _convergence_test(c, n_iter, residual, convergence);
+      if (n_iter == res_lag + 1)
+        c->setup_data->initial_residual = residual;
+
+      cvg = _convergence_test(c, n_iter, residual, convergence);
+
+    }
 
   }
 
@@ -1843,6 +2506,7 @@ _jacobi(cs_sles_it_t              *c,
     cs_matrix_vector_multiply_partial(a, CS_MATRIX_SPMV_E, rk, vx);
 
     double  res2 = 0.0;
+    bool    res_valid = true;
 
     if (convergence->precision > 0. || c->plot != NULL) {
 
@@ -1856,15 +2520,12 @@ _jacobi(cs_sles_it_t              *c,
 
 #if defined(HAVE_MPI)
 
-      if (c->comm != MPI_COMM_NULL) {
-        double _sum;
-        MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
-        res2 = _sum;
-      }
+      res_valid = _stale_reduce_apply(&sr, &res2);
 
 #endif /* defined(HAVE_MPI) */
 
-      residual = sqrt(res2); /* Actually, residual of previous iteration */
+      if (res_valid)
+        residual = sqrt(res2); /* Actually, residual of previous iteration */
 
     }
     else {
@@ -1877,15 +2538,34 @@ _jacobi(cs_sles_it_t              *c,
 
     }
 
-    /* Convergence test */
+    /* Convergence test (delayed by up to res_lag iterations) */
 
-    if (n_iter == 1)
-      c->setup_data->initial_residual = residual;
+    if (res_valid) {
 
-    cvg = _convergence_test(c, n_iter, residual, convergence);
+      if (n_iter == res_lag + 1)
+        c->setup_data->initial_residual = residual;
+
+      cvg = _convergence_test(c, n_iter, residual, convergence);
+
+    }
+#if defined(HAVE_MPI)
+    else if (n_iter >= convergence->n_iterations_max) {
+      if (_stale_reduce_finalize(&sr, &res2))
+        residual = sqrt(res2);
+      cvg = _convergence_test(c, n_iter, residual, convergence);
+    }
+#endif
 
   }
 
+#if defined(HAVE_MPI)
+  {
+    double res2_last = 0;
+    if (_stale_reduce_finalize(&sr, &res2_last))
+      convergence->residual = sqrt(res2_last);
+  }
+#endif
+
   if (_aux_vectors != aux_vectors)
     BFT_FREE(_aux_vectors);
 
@@ -1929,7 +2609,7 @@ _block_3_jacobi(cs_sles_it_t              *c,
   assert(diag_block_size == 3);
 
   cs_sles_convergence_state_t cvg;
-  double  res2, residual;
+  double  res2, residual = -1;
   cs_real_t *_aux_vectors;
   cs_real_t  *restrict rk, *restrict vxx;
 
@@ -1966,11 +2646,20 @@ _block_3_jacobi(cs_sles_it_t              *c,
   /* First iteration simplified if vx == 0
      ------------------------------------- */
 
+  unsigned res_lag = 0;
+
+#if defined(HAVE_MPI)
+  _stale_reduce_t sr;
+  _stale_reduce_init(&sr, c);
+  res_lag = sr.lag;
+#endif
+
   if (vx_ini != vx) {
     assert(vx_ini == NULL);
 
     n_iter += 1;
     res2 = 0.0;
+    bool res_valid = true;
 
     /* Compute vx <- diag^-1 . (vxx - rhs) and residual. */
 #   pragma omp parallel for reduction(+:res2) if(n_blocks > CS_THR_MIN)
@@ -1994,22 +2683,22 @@ _block_3_jacobi(cs_sles_it_t              *c,
 
 #if defined(HAVE_MPI)
 
-    if (c->comm != MPI_COMM_NULL) {
-      double _sum;
-      MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
-      res2 = _sum;
-    }
+    res_valid = _stale_reduce_apply(&sr, &res2);
 
 #endif /* defined(HAVE_MPI) */
 
-    residual = sqrt(res2); /* Actually, residual of previous iteration */
+    /* Convergence test (delayed by up to res_lag iterations) */
 
-    if (n_iter == 1)
-      c->setup_data->initial_residual = residual;
+    if (res_valid) {
 
-    /* Convergence test */
+      residual = sqrt(res2); /* Actually, residual of previous iteration */
 
-    cvg = _convergence_test(c, n_iter, residual, convergence);
+      if (n_iter == res_lag + 1)
+        c->setup_data->initial_residual = residual;
+
+      cvg = _convergence_test(c, n_iter, residual, convergence);
+
+    }
   }
 
   /* Current iteration */
@@ -2025,6 +2714,7 @@ _block_3_jacobi(cs_sles_it_t              *c,
     cs_matrix_vector_multiply_partial(a, CS_MATRIX_SPMV_E, rk, vxx);
 
     res2 = 0.0;
+    bool res_valid = true;
 
     /* Compute vx <- diag^-1 . (vxx - rhs) and residual. */
 #   pragma omp parallel for reduction(+:res2) if(n_blocks > CS_THR_MIN)
@@ -2044,24 +2734,39 @@ _block_3_jacobi(cs_sles_it_t              *c,
 
 #if defined(HAVE_MPI)
 
-    if (c->comm != MPI_COMM_NULL) {
-      double _sum;
-      MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
-      res2 = _sum;
-    }
+    res_valid = _stale_reduce_apply(&sr, &res2);
 
 #endif /* defined(HAVE_MPI) */
 
-    residual = sqrt(res2); /* Actually, residual of previous iteration */
+    /* Convergence test (delayed by up to res_lag iterations) */
 
-    if (n_iter == 1)
-      c->setup_data->initial_residual = residual;
+    if (res_valid) {
 
-    /* Convergence test */
+      residual = sqrt(res2); /* Actually, residual of previous iteration */
 
-    cvg = _convergence_test(c, n_iter, residual, convergence);
+      if (n_iter == res_lag + 1)
+        c->setup_data->initial_residual = residual;
+
+      cvg = _convergence_test(c, n_iter, residual, convergence);
 
+    }
+#if defined(HAVE_MPI)
+    else if (n_iter >= convergence->n_iterations_max) {
+      if (_stale_reduce_finalize(&sr, &res2))
+        residual = sqrt(res2);
+      cvg = _convergence_test(c, n_iter, residual, convergence);
+    }
+#endif
+
+  }
+
+#if defined(HAVE_MPI)
+  {
+    double res2_last = 0;
+    if (_stale_reduce_finalize(&sr, &res2_last))
+      convergence->residual = sqrt(res2_last);
   }
+#endif
 
   if (_aux_vectors != aux_vectors)
     BFT_FREE(_aux_vectors);
@@ -2101,7 +2806,7 @@ _block_jacobi(cs_sles_it_t              *c,
               void                      *aux_vectors)
 {
   cs_sles_convergence_state_t cvg;
-  double  res2, residual;
+  double  res2, residual = -1;
   cs_real_t *_aux_vectors;
   cs_real_t  *restrict rk, *restrict vxx;
 
@@ -2140,11 +2845,20 @@ _block_jacobi(cs_sles_it_t              *c,
   /* First iteration simplified if vx == 0
      ------------------------------------- */
 
+  unsigned res_lag = 0;
+
+#if defined(HAVE_MPI)
+  _stale_reduce_t sr;
+  _stale_reduce_init(&sr, c);
+  res_lag = sr.lag;
+#endif
+
   if (vx_ini != vx) {
     assert(vx_ini == NULL);
 
     n_iter += 1;
     res2 = 0.0;
+    bool res_valid = true;
 
     /* Compute Vx <- Vx - (A-diag).Rk and residual. */
 
@@ -2170,22 +2884,22 @@ _block_jacobi(cs_sles_it_t              *c,
 
 #if defined(HAVE_MPI)
 
-    if (c->comm != MPI_COMM_NULL) {
-      double _sum;
-      MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
-      res2 = _sum;
-    }
+    res_valid = _stale_reduce_apply(&sr, &res2);
 
 #endif /* defined(HAVE_MPI) */
 
-    residual = sqrt(res2); /* Actually, residual of previous iteration */
+    /* Convergence test (delayed by up to res_lag iterations) */
 
-    if (n_iter == 1)
-      c->setup_data->initial_residual = residual;
+    if (res_valid) {
 
-    /* Convergence test */
+      residual = sqrt(res2); /* Actually, residual of previous iteration */
 
-    cvg = _convergence_test(c, n_iter, residual, convergence);
+      if (n_iter == res_lag + 1)
+        c->setup_data->initial_residual = residual;
+
+      cvg = _convergence_test(c, n_iter, residual, convergence);
+
+    }
   }
 
   /* Current iteration */
@@ -2201,6 +2915,7 @@ _block_jacobi(cs_sles_it_t              *c,
     cs_matrix_vector_multiply_partial(a, CS_MATRIX_SPMV_E, rk, vxx);
 
     res2 = 0.0;
+    bool res_valid = true;
 
 #   pragma omp parallel for reduction(+:res2) if(n_blocks > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < n_blocks; ii++) {
@@ -2220,24 +2935,39 @@ _block_jacobi(cs_sles_it_t              *c,
 
 #if defined(HAVE_MPI)
 
-    if (c->comm != MPI_COMM_NULL) {
-      double _sum;
-      MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
-      res2 = _sum;
-    }
+    res_valid = _stale_reduce_apply(&sr, &res2);
 
 #endif /* defined(HAVE_MPI) */
 
-    residual = sqrt(res2); /* Actually, residual of previous iteration */
+    /* Convergence test (delayed by up to res_lag iterations) */
 
-    if (n_iter == 1)
-      c->setup_data->initial_residual = residual;
+    if (res_valid) {
 
-    /* Convergence test */
+      residual = sqrt(res2); /* Actually, residual of previous iteration */
 
-    cvg = _convergence_test(c, n_iter, residual, convergence);
+      if (n_iter == res_lag + 1)
+        c->setup_data->initial_residual = residual;
+
+      cvg = _convergence_test(c, n_iter, residual, convergence);
+
+    }
+#if defined(HAVE_MPI)
+    else if (n_iter >= convergence->n_iterations_max) {
+      if (_stale_reduce_finalize(&sr, &res2))
+        residual = sqrt(res2);
+      cvg = _convergence_test(c, n_iter, residual, convergence);
+    }
+#endif
+
+  }
 
+#if defined(HAVE_MPI)
+  {
+    double res2_last = 0;
+    if (_stale_reduce_finalize(&sr, &res2_last))
+      convergence->residual = sqrt(res2_last);
   }
+#endif
 
   if (_aux_vectors != aux_vectors)
     BFT_FREE(_aux_vectors);
@@ -4304,6 +5034,10 @@ cs_sles_it_create(cs_sles_it_type_t   solver_type,
 
   c->n_max_iter = n_max_iter;
   c->restart_interval = 20; /* Default value commonly found in the literature */
+  c->res_reduce_lag = 0;
+
+  c->precision_mult = 1.;
+  c->precision_mult_max = 1.;
 
   c->n_setups = 0;
   c->n_solves = 0;
@@ -4328,6 +5062,10 @@ cs_sles_it_create(cs_sles_it_type_t   solver_type,
     c->comm = MPI_COMM_NULL;
     c->caller_comm = cs_glob_mpi_comm;
   }
+
+  c->fold_threshold = 0;
+  c->fold_min_rows = 3000;
+  c->fold = NULL;
 #endif
 
   c->setup_data = NULL;
@@ -4373,6 +5111,9 @@ cs_sles_it_destroy(void **context)
     }
     cs_sles_pc_destroy(&(c->_pc));
     cs_sles_it_free(c);
+#if defined(HAVE_MPI)
+    _fold_destroy(c);
+#endif
     if (c->_plot != NULL) {
       cs_time_plot_finalize(&(c->_plot));
       c->plot = NULL;
@@ -4423,8 +5164,15 @@ cs_sles_it_copy(const void  *context)
     if (c->type == CS_SLES_GMRES || c->type == CS_SLES_GCR)
       d->restart_interval = c->restart_interval;
 
+    d->res_reduce_lag = c->res_reduce_lag;
+
+    /* Copy the adaptive precision bound, but restart the adaptation */
+    d->precision_mult_max = c->precision_mult_max;
+
 #if defined(HAVE_MPI)
-    d->comm = c->comm;
+    d->comm = (c->fold == NULL) ? c->comm : c->caller_comm;
+    d->fold_threshold = c->fold_threshold;
+    d->fold_min_rows = c->fold_min_rows;
 #endif
   }
 
@@ -4463,6 +5211,16 @@ cs_sles_it_log(const void  *context,
     cs_log_printf(log_type,
                   _("  Maximum number of iterations:      %d\n"),
                   c->n_max_iter);
+#if defined(HAVE_MPI)
+    if (c->fold != NULL)
+      cs_log_printf(log_type,
+                    _("  Rank folding:                      on %d ranks\n"),
+                    c->fold->n_f_ranks);
+#endif
+    if (c->precision_mult_max > 1.)
+      cs_log_printf(log_type,
+                    _("  Adaptive precision relaxation:     up to %g x\n"),
+                    c->precision_mult_max);
   }
 
   else if (log_type == CS_LOG_PERFORMANCE) {
@@ -4567,6 +5325,16 @@ cs_sles_it_setup(void               *context,
   if (c->update_stats == true)
     t0 = cs_timer_time();
 
+#if defined(HAVE_MPI)
+  /* Optional rank folding: gather small systems on a sub-communicator,
+     and run the rest of the setup on the folded matrix */
+
+  if (c->fold_threshold > 0 || c->fold != NULL) {
+    if (_fold_update(c, name, a, verbosity))
+      a = c->fold->a;
+  }
+#endif
+
 #if defined(HAVE_ACCEL)
   bool on_device = (cs_matrix_get_alloc_mode(a) > CS_ALLOC_HOST) ?
     true : false;
@@ -4646,6 +5414,10 @@ cs_sles_it_setup(void               *context,
     c->solve = _conjugate_gradient_ip;
     break;
 
+  case CS_SLES_PIPECG:
+    c->solve = _conjugate_gradient_pipelined;
+    break;
+
   case CS_SLES_JACOBI:
     if (diag_block_size == 1)
       c->solve = _jacobi;
@@ -4801,8 +5573,45 @@ cs_sles_it_solve(void                *context,
 
   }
 
+#if defined(HAVE_MPI)
+
+  /* With rank folding, gather right-hand side and initial guess on the
+     sub-communicator and substitute the folded system; the solution is
+     scattered back before returning. */
+
+  cs_real_t  *vx_unfold = NULL;
+
+  if (c->fold != NULL) {
+    cs_all_to_all_copy_array(c->fold->d,
+                             CS_REAL_TYPE,
+                             1,
+                             false, /* reverse */
+                             rhs,
+                             c->fold->rhs);
+    if (vx_ini == vx)
+      cs_all_to_all_copy_array(c->fold->d,
+                               CS_REAL_TYPE,
+                               1,
+                               false, /* reverse */
+                               vx,
+                               c->fold->vx);
+    vx_unfold = vx;
+    a = c->fold->a;
+    rhs = c->fold->rhs;
+    vx_ini = (vx_ini == vx) ? c->fold->vx : NULL;
+    vx = c->fold->vx;
+  }
+
+#endif
+
+  /* Adaptive convergence control: apply the current precision multiplier */
+
+  double _precision = precision;
+  if (c->precision_mult_max > 1.)
+    _precision *= c->precision_mult;
+
   if (c->pc != NULL)
-    cs_sles_pc_set_tolerance(c->pc, precision, r_norm);
+    cs_sles_pc_set_tolerance(c->pc, _precision, r_norm);
 
   /* Solve sparse linear system */
 
@@ -4810,7 +5619,7 @@ cs_sles_it_solve(void                *context,
                               name,
                               verbosity,
                               c->n_max_iter,
-                              precision,
+                              _precision,
                               r_norm,
                               residual);
 
@@ -4951,6 +5760,31 @@ cs_sles_it_solve(void                *context,
 
   }
 
+  /* Adaptive convergence control: relax the working precision towards its
+     configured bound while the residual decay per iteration remains fast,
+     and tighten it again as soon as convergence degrades */
+
+  if (c->precision_mult_max > 1. && c->ignore_convergence == false) {
+
+    double mult = c->precision_mult;
+
+    if (cvg == CS_SLES_CONVERGED) {
+      double r0 = c->setup_data->initial_residual;
+      if (_n_iter > 0 && r0 > 0. && *residual > 0.) {
+        double decay = pow(*residual / r0, 1./_n_iter);
+        if (decay < 0.5)
+          mult *= 2.;
+        else if (decay > 0.9)
+          mult *= 0.5;
+      }
+    }
+    else
+      mult *= 0.25;
+
+    c->precision_mult = CS_MAX(1., CS_MIN(mult, c->precision_mult_max));
+
+  }
+
   if (fallback_type != CS_SLES_N_IT_TYPES)
     cvg = _fallback(c,
                     fallback_type,
@@ -4964,6 +5798,20 @@ cs_sles_it_solve(void                *context,
                     aux_size,
                     aux_vectors);
 
+#if defined(HAVE_MPI)
+
+  /* Scatter solution of folded system back to the caller's distribution */
+
+  if (c->fold != NULL)
+    cs_all_to_all_copy_array(c->fold->d,
+                             CS_REAL_TYPE,
+                             1,
+                             true, /* reverse */
+                             c->fold->vx,
+                             vx_unfold);
+
+#endif
+
   return cvg;
 }
 
@@ -5237,6 +6085,46 @@ cs_sles_it_set_mpi_reduce_comm(cs_sles_it_t  *context,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set rank folding options for small systems.
+ *
+ * When the global number of matrix rows falls under the given threshold,
+ * the system is gathered on a sub-communicator sized so as to approach
+ * the given mean number of rows per rank, solved there, and the solution
+ * scattered back to the caller's distribution. The gather pattern and
+ * sub-communicator are cached, so successive setups of a system whose
+ * structure is unchanged only refresh the gathered coefficients.
+ *
+ * Folding is currently limited to scalar MSR matrices, when reductions
+ * span all ranks (so it may not be combined with
+ * \ref cs_sles_it_set_mpi_reduce_comm), and is ignored in other cases.
+ *
+ * \param[in, out]  context             pointer to iterative solver info
+ *                                      and context
+ * \param[in]       n_g_rows_threshold  global number of rows under which
+ *                                      folding is applied (0: never)
+ * \param[in]       mean_rows_per_rank  mean number of rows per rank aimed
+ *                                      for when sizing the
+ *                                      sub-communicator
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_rank_fold(cs_sles_it_t  *context,
+                         cs_gnum_t      n_g_rows_threshold,
+                         cs_lnum_t      mean_rows_per_rank)
+{
+  cs_sles_it_t  *c = context;
+
+  if (c == NULL)
+    return;
+
+  c->fold_threshold = n_g_rows_threshold;
+  if (mean_rows_per_rank > 0)
+    c->fold_min_rows = mean_rows_per_rank;
+}
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------*/
@@ -5373,6 +6261,69 @@ cs_sles_it_set_n_max_iter(cs_sles_it_t  *context,
   context->n_max_iter = n_max_iter;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the bound up to which the solver precision may be relaxed
+ *        relative to the requested precision.
+ *
+ * When this bound is greater than 1, the effective precision of each solve
+ * is the requested precision times a multiplier adapted automatically,
+ * based on the residual decay rate observed over previous solves for the
+ * same system: the multiplier is increased (up to the given bound) while
+ * convergence remains fast, and decreased (down to 1) when convergence
+ * slows or fails. This is intended for non-critical systems, such as
+ * passive scalars, whose precision requirements are dominated by the
+ * temporal discretization error rather than by the requested precision.
+ *
+ * \param[in, out]  context   pointer to iterative solver info and context
+ * \param[in]       mult_max  maximum precision multiplier
+ *                            (<= 1: deactivate adaptation)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_adaptive_precision(cs_sles_it_t  *context,
+                                  double         mult_max)
+{
+  if (context == NULL)
+    return;
+
+  context->precision_mult_max = mult_max;
+  context->precision_mult = 1.;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the number of iterations by which residual norm reductions
+ *        may lag behind the current iteration.
+ *
+ * When lag > 0, residual norms are summed over ranks using nonblocking
+ * allreduces whose results are only consumed lag iterations after being
+ * posted, so iterations do not wait on a global synchronization; the
+ * trade-off is that convergence is detected up to lag iterations late,
+ * so up to lag extra iterations may be run.
+ *
+ * This option currently only applies to Jacobi-type solvers, whose
+ * residual reduction is used for convergence testing only; Krylov-type
+ * solvers fuse the residual norm with reductions their recurrences
+ * require synchronously. It is ignored for non-parallel runs.
+ *
+ * \param[in, out]  context  pointer to iterative solver info and context
+ * \param[in]       lag      staleness bound, in iterations
+ *                           (0: synchronous reductions)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_res_reduce_lag(cs_sles_it_t  *context,
+                              int            lag)
+{
+  if (context == NULL)
+    return;
+
+  context->res_reduce_lag = (lag > 0) ? lag : 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Query mean number of rows under which Conjugate Gradient algorithm
@@ -58,6 +58,11 @@ typedef enum {
   CS_SLES_FCG,                 /*!< Preconditions flexible conjugate gradient,
                                     described in \cite Notay:2015 */
   CS_SLES_IPCG,                /*!< Preconditions inexact conjugate gradient */
+  CS_SLES_PIPECG,              /*!< Pipelined conjugate gradient, described
+                                    in \cite Ghysels:2014; uses a single,
+                                    non-blocking reduction per iteration,
+                                    overlapped with the preconditioner and
+                                    matrix.vector product */
   CS_SLES_JACOBI,              /*!< Jacobi */
   CS_SLES_BICGSTAB,            /*!< Preconditioned BiCGstab
                                     (biconjugate gradient stabilized) */
@@ -436,6 +441,35 @@ cs_sles_it_set_mpi_reduce_comm(cs_sles_it_t  *context,
                                MPI_Comm       comm,
                                MPI_Comm       caller_comm);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set rank folding options for small systems.
+ *
+ * When the global number of matrix rows falls under the given threshold,
+ * the system is gathered on a sub-communicator sized so as to approach
+ * the given mean number of rows per rank, solved there, and the solution
+ * scattered back to the caller's distribution. The gather pattern and
+ * sub-communicator are cached, so successive setups of a system whose
+ * structure is unchanged only refresh the gathered coefficients.
+ *
+ * Folding is currently limited to scalar MSR matrices, when reductions
+ * span all ranks (so it may not be combined with
+ * \ref cs_sles_it_set_mpi_reduce_comm), and is ignored in other cases.
+ *
+ * \param[in, out]  context             pointer to iterative solver info
+ *                                      and context
+ * \param[in]       n_g_rows_threshold  global number of rows under which
+ *                                      folding is applied (0: never)
+ * \param[in]       mean_rows_per_rank  mean number of rows per rank aimed
+ *                                      for when sizing the sub-communicator
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_rank_fold(cs_sles_it_t  *context,
+                         cs_gnum_t      n_g_rows_threshold,
+                         cs_lnum_t      mean_rows_per_rank);
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
@@ -530,6 +564,51 @@ void
 cs_sles_it_set_n_max_iter(cs_sles_it_t  *context,
                           int            n_max_iter);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the bound up to which the solver precision may be relaxed
+ *        relative to the requested precision.
+ *
+ * When this bound is greater than 1, the effective precision of each solve
+ * is adapted automatically based on the convergence history of the system,
+ * so that non-critical systems such as passive scalars are not
+ * over-converged.
+ *
+ * \param[in, out]  context   pointer to iterative solver info and context
+ * \param[in]       mult_max  maximum precision multiplier
+ *                            (<= 1: deactivate adaptation)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_adaptive_precision(cs_sles_it_t  *context,
+                                  double         mult_max);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the number of iterations by which residual norm reductions
+ *        may lag behind the current iteration.
+ *
+ * When lag > 0, residual norms are summed over ranks using nonblocking
+ * allreduces whose results are only consumed lag iterations after being
+ * posted, so iterations do not wait on a global synchronization; the
+ * trade-off is that convergence is detected up to lag iterations late,
+ * so up to lag extra iterations may be run.
+ *
+ * This option currently only applies to Jacobi-type solvers, whose
+ * residual reduction is used for convergence testing only; it is ignored
+ * for non-parallel runs.
+ *
+ * \param[in, out]  context  pointer to iterative solver info and context
+ * \param[in]       lag      staleness bound, in iterations
+ *                           (0: synchronous reductions)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_res_reduce_lag(cs_sles_it_t  *context,
+                              int            lag);
+
 /*----------------------------------------------------------------------------
  * Query mean number of rows under which Conjugate Gradient algorithm
  * uses the single-reduction variant.
@@ -108,6 +108,14 @@ namespace cg = cooperative_groups;
 
 static bool _use_cublas = false;
 
+/* Number of iterations between host synchronizations for convergence
+   testing in fixed-point type solvers; with values > 1, several
+   iterations' kernel launches (or captured graph replays) are queued
+   back to back, and only the residual of the last queued iteration is
+   reduced and tested, at the cost of up to that many extra iterations. */
+
+static int _conv_sync_interval = 1;
+
 /*============================================================================
  * Private function and kernel definitions
  *============================================================================*/
@@ -1362,33 +1370,55 @@ cs_sles_it_cuda_jacobi(cs_sles_it_t              *c,
   /* Current iteration
      ----------------- */
 
+  /* With no plotting, convergence may be checked only every few
+     iterations, so host synchronization (and the associated global
+     reduction) does not gate every single iteration. */
+
+  int n_sync_iter = 1;
+  if (_conv_sync_interval > 1 && convergence->precision > 0.
+      && c->plot == NULL)
+    n_sync_iter = _conv_sync_interval;
+
   while (cvg == CS_SLES_ITERATING) {
 
-    n_iter += 1;
+    int n_batch = 1;
+    if (n_sync_iter > 1 && n_iter > 0) {
+      n_batch = n_sync_iter;
+      if ((unsigned)n_batch > convergence->n_iterations_max - n_iter)
+        n_batch = convergence->n_iterations_max - n_iter;
+      if (n_batch < 1)
+        n_batch = 1;
+    }
 
-    /* SpmV done outside of graph capture as halo synchronization
-       currently synchonizes separate streams and may not be captured. */
+    for (int b_id = 0; b_id < n_batch; b_id++) {
 
-    cs_matrix_vector_multiply_partial_d(a, CS_MATRIX_SPMV_E, rk, vx);
+      n_iter += 1;
 
-    /* Compute Vx <- Vx - (A-diag).Rk and residual. */
+      /* SpmV done outside of graph capture as halo synchronization
+         currently synchonizes separate streams and may not be captured. */
+
+      cs_matrix_vector_multiply_partial_d(a, CS_MATRIX_SPMV_E, rk, vx);
+
+      /* Compute Vx <- Vx - (A-diag).Rk and residual. */
 
 #if HAVE_GRAPH_CAPTURE > 0
-    if (cs_glob_cuda_allow_graph)
-      cudaGraphLaunch(graph_exec, stream);
+      if (cs_glob_cuda_allow_graph)
+        cudaGraphLaunch(graph_exec, stream);
 
-    else
+      else
 #endif // HAVE_GRAPH_CAPTURE > 0
-    {
-      if (convergence->precision > 0. || c->plot != NULL) {
-        _jacobi_compute_vx_and_residual<blocksize><<<gridsize, blocksize, 0, stream>>>
-          (n_rows, ad_inv, ad, rhs, vx, rk, sum_block);
-        cs_blas_cuda_reduce_single_block<blocksize, 1><<<1, blocksize, 0, stream>>>
-          (gridsize, sum_block, res);
+      {
+        if (convergence->precision > 0. || c->plot != NULL) {
+          _jacobi_compute_vx_and_residual<blocksize><<<gridsize, blocksize, 0, stream>>>
+            (n_rows, ad_inv, ad, rhs, vx, rk, sum_block);
+          cs_blas_cuda_reduce_single_block<blocksize, 1><<<1, blocksize, 0, stream>>>
+            (gridsize, sum_block, res);
+        }
+        else
+          _jacobi_compute_vx<blocksize><<<gridsize, blocksize, 0, stream>>>
+            (n_rows, ad_inv, rhs, vx, rk);
       }
-      else
-        _jacobi_compute_vx<blocksize><<<gridsize, blocksize, 0, stream>>>
-          (n_rows, ad_inv, rhs, vx, rk);
+
     }
 
     if (convergence->precision > 0. || c->plot != NULL) {
@@ -1605,37 +1635,59 @@ cs_sles_it_cuda_block_jacobi(cs_sles_it_t              *c,
   /* Current iteration
      ----------------- */
 
+  /* With no plotting, convergence may be checked only every few
+     iterations, so host synchronization (and the associated global
+     reduction) does not gate every single iteration. */
+
+  int n_sync_iter = 1;
+  if (_conv_sync_interval > 1 && convergence->precision > 0.
+      && c->plot == NULL)
+    n_sync_iter = _conv_sync_interval;
+
   while (cvg == CS_SLES_ITERATING) {
 
-    n_iter += 1;
+    int n_batch = 1;
+    if (n_sync_iter > 1 && n_iter > 0) {
+      n_batch = n_sync_iter;
+      if ((unsigned)n_batch > convergence->n_iterations_max - n_iter)
+        n_batch = convergence->n_iterations_max - n_iter;
+      if (n_batch < 1)
+        n_batch = 1;
+    }
 
-    /* SpmV done outside of graph capture as halo synchronization
-       currently synchonizes separate streams and may not be captured. */
+    for (int b_id = 0; b_id < n_batch; b_id++) {
 
-    cs_matrix_vector_multiply_partial_d(a, CS_MATRIX_SPMV_E, rk, vx);
+      n_iter += 1;
 
-    /* Compute Vx <- Vx - (A-diag).Rk and residual. */
+      /* SpmV done outside of graph capture as halo synchronization
+         currently synchonizes separate streams and may not be captured. */
+
+      cs_matrix_vector_multiply_partial_d(a, CS_MATRIX_SPMV_E, rk, vx);
+
+      /* Compute Vx <- Vx - (A-diag).Rk and residual. */
 
 #if HAVE_GRAPH_CAPTURE > 0
-    if (cs_glob_cuda_allow_graph)
-      cudaGraphLaunch(graph_exec, stream);
+      if (cs_glob_cuda_allow_graph)
+        cudaGraphLaunch(graph_exec, stream);
 
-    else
-#endif // HAVE_GRAPH_CAPTURE > 0
-    {
-      if (diag_block_size == 3)
-        _block_3_jacobi_compute_vx_and_residual
-          <blocksize><<<gridsize, blocksize, 0, stream>>>
-          (n_b_rows, ad_inv, ad, rhs, vx, rk, sum_block);
       else
-        _block_jacobi_compute_vx_and_residual
-          <blocksize><<<gridsize, blocksize, 0, stream>>>
-          (n_b_rows, diag_block_size, ad_inv, ad, rhs, vx, rk, sum_block);
-
-      if (convergence->precision > 0. || c->plot != NULL) {
-        cs_blas_cuda_reduce_single_block<blocksize, 1><<<1, blocksize, 0, stream>>>
-          (gridsize, sum_block, res);
+#endif // HAVE_GRAPH_CAPTURE > 0
+      {
+        if (diag_block_size == 3)
+          _block_3_jacobi_compute_vx_and_residual
+            <blocksize><<<gridsize, blocksize, 0, stream>>>
+            (n_b_rows, ad_inv, ad, rhs, vx, rk, sum_block);
+        else
+          _block_jacobi_compute_vx_and_residual
+            <blocksize><<<gridsize, blocksize, 0, stream>>>
+            (n_b_rows, diag_block_size, ad_inv, ad, rhs, vx, rk, sum_block);
+
+        if (convergence->precision > 0. || c->plot != NULL) {
+          cs_blas_cuda_reduce_single_block<blocksize, 1><<<1, blocksize, 0, stream>>>
+            (gridsize, sum_block, res);
+        }
       }
+
     }
 
     if (convergence->precision > 0. || c->plot != NULL) {
@@ -2157,6 +2209,43 @@ cs_sles_it_cuda_gcr(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Set the interval (in iterations) between host synchronizations for
+ * convergence testing in fixed-point type solvers (CUDA version).
+ *
+ * With an interval n > 1, the kernel launches (or captured graph
+ * replays) of up to n iterations are queued on the stream back to back,
+ * and only the residual of the last queued iteration is reduced and
+ * tested, so per-iteration launch and synchronization latency is
+ * amortized, at the cost of up to n-1 extra iterations.
+ *
+ * parameters:
+ *   interval <-- number of iterations between convergence tests
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_cuda_set_conv_sync_interval(int  interval)
+{
+  if (interval < 1)
+    interval = 1;
+
+  _conv_sync_interval = interval;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the interval (in iterations) between host synchronizations for
+ * convergence testing in fixed-point type solvers (CUDA version).
+ *
+ * returns:
+ *   number of iterations between convergence tests
+ *----------------------------------------------------------------------------*/
+
+int
+cs_sles_it_cuda_get_conv_sync_interval(void)
+{
+  return _conv_sync_interval;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
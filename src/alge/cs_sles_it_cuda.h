@@ -195,6 +195,34 @@ cs_sles_it_cuda_gcr(cs_sles_it_t              *c,
                     size_t                     aux_size,
                     void                      *aux_vectors);
 
+/*----------------------------------------------------------------------------
+ * Set the interval (in iterations) between host synchronizations for
+ * convergence testing in fixed-point type solvers (CUDA version).
+ *
+ * With an interval n > 1, the kernel launches (or captured graph
+ * replays) of up to n iterations are queued on the stream back to back,
+ * and only the residual of the last queued iteration is reduced and
+ * tested, so per-iteration launch and synchronization latency is
+ * amortized, at the cost of up to n-1 extra iterations.
+ *
+ * parameters:
+ *   interval <-- number of iterations between convergence tests
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_cuda_set_conv_sync_interval(int  interval);
+
+/*----------------------------------------------------------------------------
+ * Return the interval (in iterations) between host synchronizations for
+ * convergence testing in fixed-point type solvers (CUDA version).
+ *
+ * returns:
+ *   number of iterations between convergence tests
+ *----------------------------------------------------------------------------*/
+
+int
+cs_sles_it_cuda_get_conv_sync_interval(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
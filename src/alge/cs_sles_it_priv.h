@@ -170,6 +170,20 @@ struct _cs_sles_it_t {
                                               (only applicable for GMRES or GCR
                                               algorithm up to now) */
 
+  int                  res_reduce_lag;     /* number of iterations by which
+                                              residual norm reductions may lag
+                                              behind the current iteration
+                                              (0: synchronous reductions; only
+                                              applicable to Jacobi variants
+                                              up to now) */
+
+  double               precision_mult;     /* current precision multiplier
+                                              (adaptive convergence control) */
+  double               precision_mult_max; /* bound up to which the precision
+                                              may be relaxed relative to the
+                                              requested precision
+                                              (<= 1: adaptation inactive) */
+
   cs_sles_it_solve_t  *solve;              /* pointer to solve function */
 
   cs_sles_pc_t        *pc;                 /* pointer to possibly shared
@@ -208,6 +222,18 @@ struct _cs_sles_it_t {
   MPI_Comm comm;
   MPI_Comm caller_comm;
   int      caller_n_ranks;
+
+  /* Rank folding for small systems: when the global number of rows falls
+     under the given threshold, the system is gathered on a sub-communicator
+     sized so as to approach the given mean number of rows per rank, solved
+     there, and the solution scattered back. */
+
+  cs_gnum_t                   fold_threshold; /* global rows under which the
+                                                 system is folded (0: never) */
+  cs_lnum_t                   fold_min_rows;  /* mean rows per rank aimed for
+                                                 when sizing the folded
+                                                 sub-communicator */
+  struct _cs_sles_it_fold_t  *fold;           /* rank folding data, or NULL */
 # endif
 
   /* Solver setup */
@@ -174,6 +174,27 @@ struct _cs_sles_mumps_t {
   void                        *hook_context;  /* Optional user context */
   cs_sles_mumps_setup_hook_t  *setup_hook;    /* Post setup function */
 
+  /* Factorization reuse. Useful for repeated solves where coefficients
+     evolve slowly relative to the solved systems, such as multigrid
+     coarse systems or small ALE systems */
+
+  int                  reuse_level;   /* 0: rebuild everything at each setup;
+                                         1: keep the symbolic analysis, redo
+                                            the numeric factorization;
+                                         2: also keep the numeric
+                                            factorization until the solve
+                                            residual drifts above the given
+                                            threshold */
+  double               drift_threshold; /* scaled residual above which a
+                                           reused factorization is refreshed
+                                           (reuse_level 2) */
+  bool                 need_facto;    /* numeric factorization based on
+                                         previous coefficients */
+  int                  n_reuses;      /* number of setups having reused the
+                                         previous analysis or factorization */
+  cs_lnum_t            n_rows_ref;    /* row count at last full setup, used
+                                         to detect structure changes */
+
   /* MUMPS structure: either a pointer to SMUMPS_STRUC_C structure in case of a
    * single-precision settings or a pointer to a DMUMPS_STRUC_C structure in
    * case of a double-precision settings */
@@ -2525,6 +2546,307 @@ _automatic_smumps_settings_before_facto(const cs_param_sles_t   *slesp,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free the matrix coefficient arrays given to MUMPS.
+ *
+ * \param[in, out] c  pointer to sparse direct solver info and context
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_free_mumps_arrays(cs_sles_mumps_t  *c)
+{
+  if (_is_dmumps(c)) {
+
+    DMUMPS_STRUC_C  *dmumps = c->mumps_struct;
+
+    if (cs_glob_n_ranks == 1) {
+
+      BFT_FREE(dmumps->irn);
+      BFT_FREE(dmumps->jcn);
+      BFT_FREE(dmumps->a);
+
+    }
+    else {
+
+      BFT_FREE(dmumps->irn_loc);
+      BFT_FREE(dmumps->jcn_loc);
+      BFT_FREE(dmumps->a_loc);
+
+    }
+
+  }
+  else {
+
+    SMUMPS_STRUC_C  *smumps = c->mumps_struct;
+
+    if (cs_glob_n_ranks == 1) {
+
+      BFT_FREE(smumps->irn);
+      BFT_FREE(smumps->jcn);
+      BFT_FREE(smumps->a);
+
+    }
+    else {
+
+      BFT_FREE(smumps->irn_loc);
+      BFT_FREE(smumps->jcn_loc);
+      BFT_FREE(smumps->a_loc);
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Release the MUMPS structure and all associated arrays.
+ *
+ * \param[in, out] c  pointer to sparse direct solver info and context
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_free_mumps_struct(cs_sles_mumps_t  *c)
+{
+  if (c->mumps_struct == NULL)
+    return;
+
+  if (_is_dmumps(c)) {
+
+    DMUMPS_STRUC_C  *dmumps = c->mumps_struct;
+
+    dmumps->job = MUMPS_JOB_END;
+    dmumps_c(dmumps);
+
+  }
+  else {
+
+    SMUMPS_STRUC_C  *smumps = c->mumps_struct;
+
+    smumps->job = MUMPS_JOB_END;
+    smumps_c(smumps);
+
+  }
+
+  _free_mumps_arrays(c);
+
+  if (_is_dmumps(c)) {
+    DMUMPS_STRUC_C  *dmumps = c->mumps_struct;
+    BFT_FREE(dmumps);
+  }
+  else {
+    SMUMPS_STRUC_C  *smumps = c->mumps_struct;
+    BFT_FREE(smumps);
+  }
+
+  c->mumps_struct = NULL;
+  c->need_facto = false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Fill the MUMPS structure from the given matrix, according to the
+ *        type of factorization, precision, parallelism and matrix format.
+ *
+ * \param[in, out] c          pointer to sparse direct solver info and context
+ * \param[in]      a          associated matrix
+ * \param[in]      verbosity  associated verbosity
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_fill_mumps_matrix(cs_sles_mumps_t    *c,
+                   const cs_matrix_t  *a,
+                   int                 verbosity)
+{
+  const cs_matrix_type_t  cs_mat_type = cs_matrix_get_type(a);
+
+  switch (c->type) {
+
+  case CS_SLES_MUMPS_DOUBLE_LU:
+    if (cs_glob_n_ranks > 1) { /* Parallel computation */
+
+      if (cs_mat_type == CS_MATRIX_MSR)
+        _parall_msr_dmumps(verbosity, a, c->mumps_struct);
+      else if (cs_mat_type == CS_MATRIX_NATIVE)
+        _parall_native_dmumps(verbosity, a, c->mumps_struct);
+      else
+        bft_error(__FILE__, __LINE__, 0,
+                  " %s: Invalid matrix format in parallel", __func__);
+
+    }
+    else { /* Sequential computation */
+
+      if (cs_mat_type == CS_MATRIX_MSR)
+        _msr_dmumps(verbosity, a, c->mumps_struct);
+      else if (cs_mat_type == CS_MATRIX_NATIVE)
+        _native_dmumps(verbosity, a, c->mumps_struct);
+      else
+        bft_error(__FILE__, __LINE__, 0,
+                  " %s: Invalid matrix format", __func__);
+
+    }
+    break;
+
+  case CS_SLES_MUMPS_DOUBLE_LDLT_SPD:
+  case CS_SLES_MUMPS_DOUBLE_LDLT_SYM:
+    if (cs_glob_n_ranks > 1) { /* Parallel computation */
+
+      if (cs_mat_type == CS_MATRIX_MSR)
+        _parall_msr_sym_dmumps(verbosity, a, c->mumps_struct);
+      else
+        bft_error(__FILE__, __LINE__, 0,
+                  " %s: Invalid matrix format in parallel", __func__);
+
+    }
+    else { /* Sequential computation */
+
+      if (cs_mat_type == CS_MATRIX_MSR)
+        _msr_sym_dmumps(verbosity, a, c->mumps_struct);
+      else if (cs_mat_type == CS_MATRIX_NATIVE)
+        _native_sym_dmumps(verbosity, a, c->mumps_struct);
+      else
+        bft_error(__FILE__, __LINE__, 0,
+                  " %s: Invalid matrix format", __func__);
+
+    }
+    break;
+
+  case CS_SLES_MUMPS_SINGLE_LU:
+    if (cs_glob_n_ranks > 1) { /* Parallel computation */
+
+      if (cs_mat_type == CS_MATRIX_MSR)
+        _parall_msr_smumps(verbosity, a, c->mumps_struct);
+      else
+        bft_error(__FILE__, __LINE__, 0,
+                  " %s: Invalid matrix format in parallel", __func__);
+
+    }
+    else { /* Sequential computation */
+
+      if (cs_mat_type == CS_MATRIX_MSR)
+        _msr_smumps(verbosity, a, c->mumps_struct);
+      else if (cs_mat_type == CS_MATRIX_NATIVE)
+        _native_smumps(verbosity, a, c->mumps_struct);
+      else
+        bft_error(__FILE__, __LINE__, 0,
+                  " %s: Invalid matrix format", __func__);
+
+    }
+    break;
+
+  case CS_SLES_MUMPS_SINGLE_LDLT_SPD:
+  case CS_SLES_MUMPS_SINGLE_LDLT_SYM:
+    if (cs_glob_n_ranks > 1) { /* Parallel computation */
+
+      if (cs_mat_type == CS_MATRIX_MSR)
+        _parall_msr_sym_smumps(verbosity, a, c->mumps_struct);
+      else
+        bft_error(__FILE__, __LINE__, 0,
+                  " %s: Invalid matrix format in parallel", __func__);
+
+    }
+    else { /* Sequential computation */
+
+      if (cs_mat_type == CS_MATRIX_MSR)
+        _msr_sym_smumps(verbosity, a, c->mumps_struct);
+      else if (cs_mat_type == CS_MATRIX_NATIVE)
+        _native_sym_smumps(verbosity, a, c->mumps_struct);
+      else
+        bft_error(__FILE__, __LINE__, 0,
+                  " %s: Invalid matrix format", __func__);
+
+    }
+    break;
+
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: MUMPS is not set as a solver.\n"
+              " Please check your settings.", __func__);
+
+  } /* End of switch */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Refresh the numeric factorization from the given (updated) matrix
+ *        coefficients, keeping the symbolic analysis.
+ *
+ * The matrix structure is assumed unchanged since the analysis, so that
+ * the rebuilt index arrays match the analyzed pattern.
+ *
+ * \param[in, out] c          pointer to sparse direct solver info and context
+ * \param[in]      a          associated matrix
+ * \param[in]      verbosity  associated verbosity
+ *
+ * \return true in case of success, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_refresh_facto(cs_sles_mumps_t    *c,
+               const cs_matrix_t  *a,
+               int                 verbosity)
+{
+  MUMPS_INT  infog1 = 0;
+
+  _free_mumps_arrays(c);
+  _fill_mumps_matrix(c, a, verbosity);
+
+  if (_is_dmumps(c)) {
+
+    DMUMPS_STRUC_C  *dmumps = c->mumps_struct;
+
+    dmumps->job = MUMPS_JOB_FACTORIZATION;
+
+    _automatic_dmumps_settings_before_facto(c->sles_param, dmumps);
+
+    /* Window to enable advanced user settings (before factorization) */
+
+    if (c->setup_hook != NULL)
+      c->setup_hook(c->sles_param, c->hook_context, dmumps);
+
+    dmumps_c(dmumps);
+
+    infog1 = dmumps->INFOG(1);
+
+    /* Reset solve-stage settings possibly modified while serving the
+       previous factorization */
+
+    dmumps->ICNTL(10) = 0;
+    dmumps->ICNTL(11) = (verbosity > 2) ? 2 : 0;
+
+  }
+  else {
+
+    SMUMPS_STRUC_C  *smumps = c->mumps_struct;
+
+    smumps->job = MUMPS_JOB_FACTORIZATION;
+
+    _automatic_smumps_settings_before_facto(c->sles_param, smumps);
+
+    /* Window to enable advanced user settings (before factorization) */
+
+    if (c->setup_hook != NULL)
+      c->setup_hook(c->sles_param, c->hook_context, smumps);
+
+    smumps_c(smumps);
+
+    infog1 = smumps->INFOG(1);
+
+    smumps->ICNTL(10) = 0;
+    smumps->ICNTL(11) = (verbosity > 2) ? 2 : 0;
+
+  }
+
+  c->need_facto = false;
+  c->n_reuses += 1;
+
+  return (infog1 >= 0);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -2693,6 +3015,12 @@ cs_sles_mumps_create(const cs_param_sles_t       *slesp,
   c->hook_context = context;
   c->setup_hook = setup_hook;
 
+  c->reuse_level = 0;
+  c->drift_threshold = 0;
+  c->need_facto = false;
+  c->n_reuses = 0;
+  c->n_rows_ref = 0;
+
   /* Setup data structure */
 
   c->mumps_struct = NULL;
@@ -2723,11 +3051,47 @@ cs_sles_mumps_copy(const void   *context)
     d = cs_sles_mumps_create(c->sles_param,
                              c->setup_hook,
                              c->hook_context);
+    d->reuse_level = c->reuse_level;
+    d->drift_threshold = c->drift_threshold;
   }
 
   return d;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the reuse policy of a MUMPS factorization across coefficient
+ *        updates.
+ *
+ * With reuse_level = 0 (the default), each setup performs a full symbolic
+ * analysis and numeric factorization. With reuse_level = 1, the symbolic
+ * analysis is kept across coefficient updates (the matrix structure is
+ * assumed unchanged, which is checked using the local row count), and only
+ * the numeric factorization is redone. With reuse_level = 2, the numeric
+ * factorization is also kept, and solves use additional iterative
+ * refinement steps; the factorization is only refreshed when the scaled
+ * residual (RINFOG(11)) exceeds drift_threshold.
+ *
+ * \param[in, out]  context          pointer to sparse direct solver info and
+ *                                   context (actual type: cs_sles_mumps_t  *)
+ * \param[in]       reuse_level      0, 1, or 2
+ * \param[in]       drift_threshold  scaled residual above which reused
+ *                                   factors are refreshed (reuse_level = 2)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_mumps_set_reuse(cs_sles_mumps_t  *context,
+                        int               reuse_level,
+                        double            drift_threshold)
+{
+  if (context == NULL)
+    return;
+
+  context->reuse_level = reuse_level;
+  context->drift_threshold = drift_threshold;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free MUMPS linear equation solver setup context.
@@ -2754,58 +3118,16 @@ cs_sles_mumps_free(void  *context)
 
   if (c->mumps_struct != NULL) {
 
-    if (_is_dmumps(c)) {
-
-      DMUMPS_STRUC_C  *dmumps = c->mumps_struct;
-
-      dmumps->job = MUMPS_JOB_END;
-      dmumps_c(dmumps);
+    if (c->reuse_level > 0) {
 
-      if (cs_glob_n_ranks == 1) {
+      /* Keep the symbolic analysis (and factors): the next setup will
+         only refresh the numeric factorization, or defer it further */
 
-        BFT_FREE(dmumps->irn);
-        BFT_FREE(dmumps->jcn);
-        BFT_FREE(dmumps->a);
-
-      }
-      else {
-
-        BFT_FREE(dmumps->irn_loc);
-        BFT_FREE(dmumps->jcn_loc);
-        BFT_FREE(dmumps->a_loc);
-
-      }
-
-      BFT_FREE(dmumps);
+      c->need_facto = true;
 
     }
-    else {
-
-      SMUMPS_STRUC_C  *smumps = c->mumps_struct;
-
-      smumps->job = MUMPS_JOB_END;
-      smumps_c(smumps);
-
-      if (cs_glob_n_ranks == 1) {
-
-        BFT_FREE(smumps->irn);
-        BFT_FREE(smumps->jcn);
-        BFT_FREE(smumps->a);
-
-      }
-      else {
-
-        BFT_FREE(smumps->irn_loc);
-        BFT_FREE(smumps->jcn_loc);
-        BFT_FREE(smumps->a_loc);
-
-      }
-
-      BFT_FREE(smumps);
-
-    }
-
-    c->mumps_struct = NULL;
+    else
+      _free_mumps_struct(c);
 
   } /* MUMPS structure is not freed */
 
@@ -2830,6 +3152,7 @@ cs_sles_mumps_destroy(void   **context)
 
     /* Free structure */
 
+    c->reuse_level = 0;  /* force a full release */
     cs_sles_mumps_free(c);
     BFT_FREE(c);
     *context = c;
@@ -2898,6 +3221,40 @@ cs_sles_mumps_setup(void               *context,
 
   cs_sles_mumps_t  *c = context;
 
+  /* When a previous setup has been kept (factorization reuse), only the
+     numeric values need refreshing, keeping the symbolic analysis; at
+     the deepest reuse level even the refresh is deferred, and the
+     previous factorization keeps serving solves until their residual
+     drifts above the given threshold. */
+
+  if (c->mumps_struct != NULL) {
+
+    if (cs_matrix_get_n_rows(a) == c->n_rows_ref) {
+
+      bool reuse_ok = true;
+
+      if (c->reuse_level >= 2)
+        c->n_reuses += 1;  /* drift checked at solve time */
+      else
+        reuse_ok = _refresh_facto(c, a, verbosity);
+
+      if (reuse_ok) {
+        c->n_setups += 1;
+
+        cs_timer_t t1 = cs_timer_time();
+        cs_timer_counter_add_diff(&(c->t_setup), &t0, &t1);
+        return;
+      }
+
+    }
+
+    /* Structure changed or numeric refresh failed:
+       fall back to a full setup */
+
+    _free_mumps_struct(c);
+
+  }
+
   c->mumps_struct = NULL;
 
   /* 1. Initialize the MUMPS structure */
@@ -2992,112 +3349,7 @@ cs_sles_mumps_setup(void               *context,
   /* 2. Fill the MUMPS structure before the analysis step */
   /* ---------------------------------------------------- */
 
-  const cs_matrix_type_t  cs_mat_type = cs_matrix_get_type(a);
-
-  switch (c->type) {
-
-  case CS_SLES_MUMPS_DOUBLE_LU:
-    if (cs_glob_n_ranks > 1) { /* Parallel computation */
-
-      if (cs_mat_type == CS_MATRIX_MSR)
-        _parall_msr_dmumps(verbosity, a, c->mumps_struct);
-      else if (cs_mat_type == CS_MATRIX_NATIVE)
-        _parall_native_dmumps(verbosity, a, c->mumps_struct);
-      else
-        bft_error(__FILE__, __LINE__, 0,
-                  " %s: Invalid matrix format in parallel", __func__);
-
-    }
-    else { /* Sequential computation */
-
-      if (cs_mat_type == CS_MATRIX_MSR)
-        _msr_dmumps(verbosity, a, c->mumps_struct);
-      else if (cs_mat_type == CS_MATRIX_NATIVE)
-        _native_dmumps(verbosity, a, c->mumps_struct);
-      else
-        bft_error(__FILE__, __LINE__, 0,
-                  " %s: Invalid matrix format", __func__);
-
-    }
-    break;
-
-  case CS_SLES_MUMPS_DOUBLE_LDLT_SPD:
-  case CS_SLES_MUMPS_DOUBLE_LDLT_SYM:
-    if (cs_glob_n_ranks > 1) { /* Parallel computation */
-
-      if (cs_mat_type == CS_MATRIX_MSR)
-        _parall_msr_sym_dmumps(verbosity, a, c->mumps_struct);
-      else
-        bft_error(__FILE__, __LINE__, 0,
-                  " %s: Invalid matrix format in parallel", __func__);
-
-    }
-    else { /* Sequential computation */
-
-      if (cs_mat_type == CS_MATRIX_MSR)
-        _msr_sym_dmumps(verbosity, a, c->mumps_struct);
-      else if (cs_mat_type == CS_MATRIX_NATIVE)
-        _native_sym_dmumps(verbosity, a, c->mumps_struct);
-      else
-        bft_error(__FILE__, __LINE__, 0,
-                  " %s: Invalid matrix format", __func__);
-
-    }
-    break;
-
-  case CS_SLES_MUMPS_SINGLE_LU:
-    if (cs_glob_n_ranks > 1) { /* Parallel computation */
-
-      if (cs_mat_type == CS_MATRIX_MSR)
-        _parall_msr_smumps(verbosity, a, c->mumps_struct);
-      else
-        bft_error(__FILE__, __LINE__, 0,
-                  " %s: Invalid matrix format in parallel", __func__);
-
-    }
-    else { /* Sequential computation */
-
-      if (cs_mat_type == CS_MATRIX_MSR)
-        _msr_smumps(verbosity, a, c->mumps_struct);
-      else if (cs_mat_type == CS_MATRIX_NATIVE)
-        _native_smumps(verbosity, a, c->mumps_struct);
-      else
-        bft_error(__FILE__, __LINE__, 0,
-                  " %s: Invalid matrix format", __func__);
-
-    }
-    break;
-
-  case CS_SLES_MUMPS_SINGLE_LDLT_SPD:
-  case CS_SLES_MUMPS_SINGLE_LDLT_SYM:
-    if (cs_glob_n_ranks > 1) { /* Parallel computation */
-
-      if (cs_mat_type == CS_MATRIX_MSR)
-        _parall_msr_sym_smumps(verbosity, a, c->mumps_struct);
-      else
-        bft_error(__FILE__, __LINE__, 0,
-                  " %s: Invalid matrix format in parallel", __func__);
-
-    }
-    else { /* Sequential computation */
-
-      if (cs_mat_type == CS_MATRIX_MSR)
-        _msr_sym_smumps(verbosity, a, c->mumps_struct);
-      else if (cs_mat_type == CS_MATRIX_NATIVE)
-        _native_sym_smumps(verbosity, a, c->mumps_struct);
-      else
-        bft_error(__FILE__, __LINE__, 0,
-                  " %s: Invalid matrix format", __func__);
-
-    }
-    break;
-
-  default:
-    bft_error(__FILE__, __LINE__, 0,
-              " %s: MUMPS is not set as a solver.\n"
-              " Please check your settings.", __func__);
-
-  } /* End of switch */
+  _fill_mumps_matrix(c, a, verbosity);
 
   /* 3. Analysis and factorization */
   /* ----------------------------- */
@@ -3220,6 +3472,8 @@ cs_sles_mumps_setup(void               *context,
   /* Update returned values */
 
   c->n_setups += 1;
+  c->n_rows_ref = cs_matrix_get_n_rows(a);
+  c->need_facto = false;
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(&(c->t_setup), &t0, &t1);
@@ -3323,6 +3577,13 @@ cs_sles_mumps_solve(void                *context,
 
     /* 2. Resolution */
 
+    if (c->need_facto) {
+      /* Factors based on previous coefficients: add iterative refinement
+         steps and error analysis so that drift may be monitored */
+      dmumps->ICNTL(10) = 2;
+      dmumps->ICNTL(11) = 2;
+    }
+
     dmumps->job = MUMPS_JOB_SOLVE;
     dmumps_c(dmumps);
     infog1 = dmumps->INFOG(1);     /* feedback */
@@ -3405,6 +3666,13 @@ cs_sles_mumps_solve(void                *context,
 
     /* 2. Resolution */
 
+    if (c->need_facto) {
+      /* Factors based on previous coefficients: add iterative refinement
+         steps and error analysis so that drift may be monitored */
+      smumps->ICNTL(10) = 2;
+      smumps->ICNTL(11) = 2;
+    }
+
     smumps->job = MUMPS_JOB_SOLVE;
     smumps_c(smumps);
     infog1 = smumps->INFOG(1);     /* feedback */
@@ -3451,6 +3719,37 @@ cs_sles_mumps_solve(void                *context,
 
   cs_fp_exception_restore_trap();
 
+  /* Drift check: when the factorization is based on previous coefficients,
+     the scaled residual (computed above thanks to ICNTL(11)) measures how
+     far the reused factors have drifted from the current matrix. Above the
+     threshold, refresh the numeric factorization and solve again. */
+
+  if (c->need_facto && *residual > c->drift_threshold) {
+
+    cs_timer_t td = cs_timer_time();
+    cs_timer_counter_add_diff(&(c->t_solve), &t0, &td);
+    c->n_solves += 1;
+
+    if (!_refresh_facto(c, a, verbosity))
+      bft_error(__FILE__, __LINE__, 0,
+                "%s: Error detected while refreshing the factorization.\n"
+                " Please refer to the MUMPS documentation to get a more"
+                " detailed feedback.\n",
+                __func__);
+
+    c->n_setups += 1;
+
+    cs_timer_t te = cs_timer_time();
+    cs_timer_counter_add_diff(&(c->t_setup), &td, &te);
+
+    /* Single retry: need_facto is now false */
+
+    return cs_sles_mumps_solve(context, name, a, verbosity,
+                               precision, r_norm, n_iter, residual,
+                               rhs, vx_ini, vx, aux_size, aux_vectors);
+
+  }
+
   /* Output */
 
   cs_sles_convergence_state_t cvg = CS_SLES_CONVERGED;
@@ -3560,6 +3859,11 @@ cs_sles_mumps_log(const void  *context,
                     c->n_setups, c->n_solves,
                     c->t_setup.nsec*1e-9, c->t_solve.nsec*1e-9);
 
+    if (c->reuse_level > 0)
+      cs_log_printf(log_type,
+                    _("  Number of setups with reuse:   %12d\n"),
+                    c->n_reuses);
+
   }
 }
 
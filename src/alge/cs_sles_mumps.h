@@ -206,6 +206,33 @@ cs_sles_mumps_create(const cs_param_sles_t       *slesp,
 void *
 cs_sles_mumps_copy(const void   *context);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the reuse policy of a MUMPS factorization across coefficient
+ *        updates.
+ *
+ * With reuse_level = 0 (the default), each setup performs a full symbolic
+ * analysis and numeric factorization. With reuse_level = 1, the symbolic
+ * analysis is kept across coefficient updates (the matrix structure is
+ * assumed unchanged, which is checked using the local row count), and only
+ * the numeric factorization is redone. With reuse_level = 2, the numeric
+ * factorization is also kept, and solves use additional iterative
+ * refinement steps; the factorization is only refreshed when the scaled
+ * residual (RINFOG(11)) exceeds drift_threshold.
+ *
+ * \param[in, out]  context          pointer to sparse direct solver info and
+ *                                   context (actual type: cs_sles_mumps_t  *)
+ * \param[in]       reuse_level      0, 1, or 2
+ * \param[in]       drift_threshold  scaled residual above which reused
+ *                                   factors are refreshed (reuse_level = 2)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_mumps_set_reuse(cs_sles_mumps_t  *context,
+                        int               reuse_level,
+                        double            drift_threshold);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free MUMPS linear equation solver setup context.
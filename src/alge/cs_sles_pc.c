@@ -211,6 +211,7 @@ BEGIN_C_DECLS
   - Jacobi
   - polynomial of degree 1
   - polynomial of degree 2
+  - block SSOR (restricted additive Schwarz by row blocks)
 
   Polynomial preconditioning is explained here:
   \a D being the diagonal part of matrix \a A and \a X its extra-diagonal
@@ -274,14 +275,213 @@ struct _cs_sles_pc_t {
 
 };
 
+/* Additive Schwarz (by contiguous row blocks) preconditioner with
+   local SSOR solves */
+/*----------------------------------------------------------------*/
+
+typedef struct {
+
+  cs_lnum_t            block_size;        /* base rows per subdomain */
+  cs_lnum_t            n_overlap_rows;    /* additional rows included on
+                                             each side of a subdomain */
+
+  cs_lnum_t            n_rows;            /* number of associated rows */
+  cs_lnum_t            n_blocks;          /* number of subdomains */
+
+  cs_lnum_t            n_aux;             /* size of auxiliary data */
+
+  const cs_matrix_t   *a;                 /* pointer to associated matrix */
+
+  const cs_lnum_t     *row_index;         /* shared MSR row index */
+  const cs_lnum_t     *col_id;            /* shared MSR column ids */
+  const cs_real_t     *d_val;             /* shared diagonal values */
+  const cs_real_t     *x_val;             /* shared extra-diagonal values */
+
+  cs_real_t           *ad_inv;            /* inverse of diagonal */
+
+  cs_real_t           *aux;               /* auxiliary data */
+
+} cs_sles_pc_schwarz_t;
+
+/* Pooled inverse diagonal shared across Jacobi and polynomial
+   preconditioners whose associated matrices have identical diagonals
+   (frequent for series of scalar solves with equal diffusivities) */
+/*--------------------------------------------------------------------*/
+
+typedef struct {
+
+  int                  id;          /* unique id of this pool entry */
+  int                  n_refs;      /* number of attached preconditioners */
+
+  cs_lnum_t            n_rows;      /* number of associated rows */
+  cs_gnum_t            d_hash;      /* hash of associated matrix diagonal */
+
+  cs_real_t           *ad_inv;      /* shared inverse of diagonal */
+
+} _pc_diag_share_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
 
+/* Use single-precision storage for the inverse diagonal of Jacobi and
+   polynomial preconditioners ? */
+
+static bool _use_sp_diag = false;
+
+/* Share the inverse diagonal of Jacobi and polynomial preconditioners
+   across systems with matching matrix diagonals ? */
+
+static bool _use_shared_diag = false;
+
+static int _pc_diag_pool_size = 0;
+static int _pc_diag_pool_next_id = 0;
+static _pc_diag_share_t *_pc_diag_pool = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Compute a hash of a matrix diagonal, used as a filter when searching
+ * the shared diagonal pool.
+ *
+ * parameters:
+ *   n_rows <-- number of diagonal values
+ *   ad     <-- diagonal values
+ *
+ * returns:
+ *   hash of the diagonal values
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_pc_diag_hash(cs_lnum_t         n_rows,
+              const cs_real_t  *ad)
+{
+  cs_gnum_t h = 0;
+
+# pragma omp parallel for reduction(^:h) if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    cs_gnum_t w = 0;
+    memcpy(&w, ad + i, sizeof(cs_real_t));
+    w ^= (cs_gnum_t)i;
+    /* 64-bit finalization mix (based on splitmix64) */
+    w *= 0xbf58476d1ce4e5b9ULL;
+    w ^= w >> 27;
+    w *= 0x94d049bb133111ebULL;
+    w ^= w >> 31;
+    h ^= w;
+  }
+
+  return h;
+}
+
+/*----------------------------------------------------------------------------
+ * Release the reference of a preconditioner context to a shared diagonal
+ * pool entry, freeing the entry when no references remain.
+ *
+ * parameters:
+ *   c <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_pc_diag_share_release(cs_sles_pc_poly_t  *c)
+{
+  for (int i = 0; i < _pc_diag_pool_size; i++) {
+
+    _pc_diag_share_t  *e = _pc_diag_pool + i;
+
+    if (e->id != c->shared_id)
+      continue;
+
+    e->n_refs -= 1;
+
+    if (e->n_refs < 1) {
+      CS_FREE_HD(e->ad_inv);
+      _pc_diag_pool_size -= 1;
+      if (_pc_diag_pool_size > 0)
+        *e = _pc_diag_pool[_pc_diag_pool_size];
+      else
+        BFT_FREE(_pc_diag_pool);
+    }
+
+    break;
+  }
+
+  c->shared_id = -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Attach a preconditioner context to the shared diagonal pool, adding a
+ * new entry if no pooled scaling matches the given matrix.
+ *
+ * The hash only acts as a filter: an exact comparison confirms a match,
+ * so a hash collision can never lead to sharing a stale or mismatched
+ * scaling.
+ *
+ * parameters:
+ *   c <-> pointer to preconditioner context
+ *   a <-- associated matrix
+ *
+ * returns:
+ *   pointer to shared inverse of diagonal
+ *----------------------------------------------------------------------------*/
+
+static const cs_real_t *
+_pc_diag_share_attach(cs_sles_pc_poly_t  *c,
+                      const cs_matrix_t  *a)
+{
+  const cs_lnum_t n_rows = c->n_rows;
+  const cs_real_t *ad = cs_matrix_get_diagonal(a);
+
+  const cs_gnum_t d_hash = _pc_diag_hash(n_rows, ad);
+
+  for (int i = 0; i < _pc_diag_pool_size; i++) {
+
+    _pc_diag_share_t  *e = _pc_diag_pool + i;
+
+    if (e->n_rows != n_rows || e->d_hash != d_hash)
+      continue;
+
+    const cs_real_t *restrict e_ad_inv = e->ad_inv;
+    cs_lnum_t n_diff = 0;
+#   pragma omp parallel for reduction(+:n_diff) if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t j = 0; j < n_rows; j++) {
+      if (e_ad_inv[j] != 1. / ad[j])
+        n_diff++;
+    }
+    if (n_diff > 0)
+      continue;
+
+    e->n_refs += 1;
+    c->shared_id = e->id;
+    return e->ad_inv;
+
+  }
+
+  /* No match: add an entry to the pool */
+
+  int i = _pc_diag_pool_size;
+  _pc_diag_pool_size += 1;
+  BFT_REALLOC(_pc_diag_pool, _pc_diag_pool_size, _pc_diag_share_t);
+
+  _pc_diag_share_t  *e = _pc_diag_pool + i;
+
+  e->id = _pc_diag_pool_next_id++;
+  e->n_refs = 1;
+  e->n_rows = n_rows;
+  e->d_hash = d_hash;
+  CS_MALLOC_HD(e->ad_inv, n_rows, cs_real_t, CS_ALLOC_HOST);
+
+  cs_real_t *restrict ad_inv = e->ad_inv;
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t j = 0; j < n_rows; j++)
+    ad_inv[j] = 1. / ad[j];
+
+  c->shared_id = e->id;
+  return e->ad_inv;
+}
+
 /*----------------------------------------------------------------------------
  * Create a Polynomial preconditioner structure.
  *
@@ -309,6 +509,10 @@ _sles_pc_poly_create(void)
   pc->ad_inv = NULL;
   pc->_ad_inv = NULL;
 
+  pc->ad_inv_sp = NULL;
+
+  pc->shared_id = -1;
+
   pc->aux = NULL;
 
   return pc;
@@ -388,23 +592,68 @@ _sles_pc_poly_setup(void               *context,
 
   const cs_lnum_t n_rows = c->n_rows;
 
-  if (c->n_rows > n_rows_prev) {
+  /* Optionally share the inverse diagonal with other preconditioners
+     associated to matrices with matching diagonals; restricted to
+     scalar systems using built-in matrix types, on the host. */
+
+  bool use_shared_diag = _use_shared_diag;
+#if defined(HAVE_ACCEL)
+  if (c->accelerated)
+    use_shared_diag = false;
+#endif
+  if (db_size > 1 || cs_matrix_get_type(a) >= CS_MATRIX_N_BUILTIN_TYPES)
+    use_shared_diag = false;
+
+  if (c->shared_id > -1)
+    _pc_diag_share_release(c);
+
+  if (use_shared_diag) {
+    c->ad_inv = _pc_diag_share_attach(c, a);
     CS_FREE_HD(c->_ad_inv);
-    CS_MALLOC_HD(c->_ad_inv, n_rows, cs_real_t, amode);
   }
-  c->ad_inv = c->_ad_inv;
 
-  cs_matrix_copy_diagonal(a, c->_ad_inv);
+  else {
 
-# pragma omp parallel for if(n_rows > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < n_rows; i++)
-    c->_ad_inv[i] = 1.0 / c->_ad_inv[i];
+    if (c->_ad_inv == NULL || c->n_rows > n_rows_prev) {
+      CS_FREE_HD(c->_ad_inv);
+      CS_MALLOC_HD(c->_ad_inv, n_rows, cs_real_t, amode);
+    }
+    c->ad_inv = c->_ad_inv;
 
+    cs_matrix_copy_diagonal(a, c->_ad_inv);
 
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      c->_ad_inv[i] = 1.0 / c->_ad_inv[i];
+
+#if defined(HAVE_ACCEL)
+    if (c->accelerated)
+      cs_sync_h2d_future(c->_ad_inv);
+#endif
+
+  }
+
+  /* Optional single-precision copy, to reduce bandwidth in the apply
+     stages; rounding here only perturbs the preconditioning, as the
+     outer solver iterations remain in double precision. Device kernels
+     use the double-precision data, so this applies to the host only. */
+
+  bool use_sp_diag = _use_sp_diag;
 #if defined(HAVE_ACCEL)
   if (c->accelerated)
-    cs_sync_h2d_future(c->_ad_inv);
+    use_sp_diag = false;
 #endif
+
+  if (use_sp_diag) {
+    BFT_REALLOC(c->ad_inv_sp, n_rows, float);
+    const cs_real_t *restrict ad_inv = c->ad_inv;
+    float *restrict ad_inv_sp = c->ad_inv_sp;
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      ad_inv_sp[i] = ad_inv[i];
+  }
+  else
+    BFT_FREE(c->ad_inv_sp);
 }
 
 /*----------------------------------------------------------------------------
@@ -520,6 +769,21 @@ _sles_pc_poly_apply_jacobi(void                *context,
   const cs_lnum_t n_rows = c->n_rows;
   const cs_real_t *restrict ad_inv = c->ad_inv;
 
+  if (c->ad_inv_sp != NULL) {
+    const float *restrict ad_inv_sp = c->ad_inv_sp;
+    if (x_in != NULL) {
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        x_out[ii] = x_in[ii] * ad_inv_sp[ii];
+    }
+    else {
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        x_out[ii] *= ad_inv_sp[ii];
+    }
+    return CS_SLES_PC_CONVERGED;
+  }
+
   if (x_in != NULL) {
 #   pragma omp parallel for if(n_rows > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < n_rows; ii++)
@@ -589,6 +853,29 @@ _sles_pc_poly_apply_poly(void                *context,
 
   }
 
+  if (c->ad_inv_sp != NULL) {
+
+    const float *restrict ad_inv_sp = c->ad_inv_sp;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      x_out[ii] = r[ii] * ad_inv_sp[ii];
+
+    for (int deg_id = 1; deg_id <= c->poly_degree; deg_id++) {
+
+      /* Compute Wk = (A-diag).Gk */
+
+      cs_matrix_vector_multiply_partial(c->a, CS_MATRIX_SPMV_E, x_out, w);
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        x_out[ii] = (r[ii] - w[ii]) * ad_inv_sp[ii];
+
+    }
+
+    return CS_SLES_PC_CONVERGED;
+  }
+
 # pragma omp parallel for if(n_rows > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < n_rows; ii++)
     x_out[ii] = r[ii] * ad_inv[ii];
@@ -626,8 +913,12 @@ _sles_pc_poly_free(void  *context)
 
   c->a = NULL;
 
+  if (c->shared_id > -1)
+    _pc_diag_share_release(c);
+
   c->ad_inv = NULL;
   CS_FREE_HD(c->_ad_inv);
+  BFT_FREE(c->ad_inv_sp);
   CS_FREE_HD(c->aux);
 }
 
@@ -679,6 +970,311 @@ _sles_pc_poly_destroy (void  **context)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Create a block SSOR (additive Schwarz) preconditioner structure.
+ *
+ * parameters:
+ *   block_size     <-- base number of rows per subdomain
+ *   n_overlap_rows <-- number of additional rows included on each side
+ *                      of a subdomain
+ *
+ * returns:
+ *   pointer to newly created preconditioner context.
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_pc_schwarz_t *
+_sles_pc_schwarz_create(cs_lnum_t  block_size,
+                        cs_lnum_t  n_overlap_rows)
+{
+  cs_sles_pc_schwarz_t *pc;
+
+  BFT_MALLOC(pc, 1, cs_sles_pc_schwarz_t);
+
+  pc->block_size = (block_size > 0) ? block_size : 1024;
+  pc->n_overlap_rows = (n_overlap_rows > 0) ? n_overlap_rows : 0;
+
+  pc->n_rows = 0;
+  pc->n_blocks = 0;
+  pc->n_aux = 0;
+
+  pc->a = NULL;
+
+  pc->row_index = NULL;
+  pc->col_id = NULL;
+  pc->d_val = NULL;
+  pc->x_val = NULL;
+
+  pc->ad_inv = NULL;
+  pc->aux = NULL;
+
+  return pc;
+}
+
+/*----------------------------------------------------------------------------
+ * Function returning the type name of a block SSOR preconditioner context.
+ *
+ * parameters:
+ *   context   <-- pointer to preconditioner context
+ *   logging   <-- if true, logging description; if false, canonical name
+ *----------------------------------------------------------------------------*/
+
+static const char *
+_sles_pc_schwarz_get_type(const void  *context,
+                          bool         logging)
+{
+  CS_UNUSED(context);
+
+  if (logging == false) {
+    static const char t[] = "block_ssor";
+    return t;
+  }
+  else {
+    static const char t[] = N_("block SSOR (additive Schwarz)");
+    return _(t);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Function for setup of a block SSOR preconditioner context.
+ *
+ * parameters:
+ *   context   <-> pointer to preconditioner context
+ *   name      <-- pointer to name of associated linear system
+ *   a         <-- matrix
+ *   accel     <-- use accelerator version ?
+ *   verbosity <-- associated verbosity
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_schwarz_setup(void               *context,
+                       const char         *name,
+                       const cs_matrix_t  *a,
+                       bool                accel,
+                       int                 verbosity)
+{
+  CS_UNUSED(accel);
+  CS_UNUSED(verbosity);
+
+  cs_sles_pc_schwarz_t  *c = context;
+
+  if (   cs_matrix_get_type(a) != CS_MATRIX_MSR
+      || cs_matrix_get_diag_block_size(a) > 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: block SSOR preconditioning of system \"%s\"\n"
+                "requires a scalar matrix in MSR format (type here: %s)."),
+              __func__, name, cs_matrix_get_type_name(a));
+
+  cs_lnum_t n_rows_prev = c->n_rows;
+  c->n_rows = cs_matrix_get_n_rows(a);
+
+  c->a = a;
+
+  cs_matrix_get_msr_arrays(a,
+                           &(c->row_index),
+                           &(c->col_id),
+                           &(c->d_val),
+                           &(c->x_val));
+
+  c->n_blocks = (c->n_rows + c->block_size - 1) / c->block_size;
+
+  const cs_lnum_t n_rows = c->n_rows;
+
+  if (c->n_rows > n_rows_prev)
+    BFT_REALLOC(c->ad_inv, n_rows, cs_real_t);
+
+  const cs_real_t *restrict d_val = c->d_val;
+  cs_real_t *restrict ad_inv = c->ad_inv;
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    ad_inv[i] = 1.0 / d_val[i];
+}
+
+/*----------------------------------------------------------------------------
+ * Function for application of a block SSOR preconditioner.
+ *
+ * The preconditioner is an additive Schwarz method over contiguous
+ * subdomains of block_size rows, each extended by n_overlap_rows rows on
+ * each side; a symmetric Gauss-Seidel (SSOR with relaxation 1) solve is
+ * used on each subdomain, couplings to rows outside the subdomain being
+ * ignored, and only values of non-overlap rows are kept (restricted
+ * additive Schwarz), so no averaging of overlap values is needed and
+ * subdomains may be handled independently. With cells renumbered for
+ * locality, contiguous row ranges approximate adjacency-based subdomains
+ * while keeping the working set of each subdomain cache-sized.
+ *
+ * In cases where it is desired that the preconditioner modify a vector
+ * "in place", x_in should be set to NULL, and x_out contain the vector to
+ * be modified (\f$x_{out} \leftarrow M^{-1}x_{out})\f$).
+ *
+ * parameters:
+ *   context       <-> pointer to preconditioner context
+ *   x_in          <-- input vector
+ *   x_out         <-> input/output vector
+ *
+ * returns:
+ *   preconditioner application status
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_pc_state_t
+_sles_pc_schwarz_apply(void                *context,
+                       const cs_real_t     *x_in,
+                       cs_real_t           *x_out)
+{
+  cs_sles_pc_schwarz_t  *c = context;
+
+  const cs_lnum_t n_rows = c->n_rows;
+  const cs_lnum_t n_blocks = c->n_blocks;
+  const cs_lnum_t block_size = c->block_size;
+  const cs_lnum_t n_ov = c->n_overlap_rows;
+  const cs_lnum_t ext_size = block_size + 2*n_ov;
+
+  /* Scratch data: one extended subdomain per block, plus a copy
+     of the input vector when applied in place */
+
+  cs_lnum_t n_aux = n_blocks*ext_size;
+  if (x_in == NULL)
+    n_aux += CS_SIMD_SIZE(n_rows);
+
+  if (c->n_aux < n_aux) {
+    c->n_aux = n_aux;
+    BFT_REALLOC(c->aux, c->n_aux, cs_real_t);
+  }
+
+  const cs_real_t *restrict r = x_in;
+
+  if (x_in == NULL) {
+
+    cs_real_t *restrict _r = c->aux + n_blocks*ext_size;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      _r[ii] = x_out[ii];
+
+    r = _r;
+
+  }
+
+  const cs_lnum_t *restrict row_index = c->row_index;
+  const cs_lnum_t *restrict col_id = c->col_id;
+  const cs_real_t *restrict x_val = c->x_val;
+  const cs_real_t *restrict ad_inv = c->ad_inv;
+  cs_real_t *restrict aux = c->aux;
+
+# pragma omp parallel for if(n_blocks > 1)
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+
+    const cs_lnum_t s_id = b_id*block_size;
+    const cs_lnum_t e_id = CS_MIN(s_id + block_size, n_rows);
+    const cs_lnum_t ls = CS_MAX(s_id - n_ov, 0);
+    const cs_lnum_t le = CS_MIN(e_id + n_ov, n_rows);
+
+    cs_real_t *restrict w = aux + b_id*ext_size;
+
+    /* Forward sweep: w = (D+L)^-1 r */
+
+    for (cs_lnum_t i = ls; i < le; i++) {
+      cs_real_t s = r[i];
+      for (cs_lnum_t j = row_index[i]; j < row_index[i+1]; j++) {
+        cs_lnum_t jc_id = col_id[j];
+        if (jc_id >= ls && jc_id < i)
+          s -= x_val[j]*w[jc_id - ls];
+      }
+      w[i - ls] = s*ad_inv[i];
+    }
+
+    /* Backward sweep (in place): w = (D+U)^-1 D w */
+
+    for (cs_lnum_t i = le-1; i >= ls; i--) {
+      cs_real_t s = 0;
+      for (cs_lnum_t j = row_index[i]; j < row_index[i+1]; j++) {
+        cs_lnum_t jc_id = col_id[j];
+        if (jc_id > i && jc_id < le)
+          s += x_val[j]*w[jc_id - ls];
+      }
+      w[i - ls] -= s*ad_inv[i];
+    }
+
+    /* Restriction: only values of non-overlap rows are kept */
+
+    for (cs_lnum_t i = s_id; i < e_id; i++)
+      x_out[i] = w[i - ls];
+
+  } /* loop on subdomains */
+
+  return CS_SLES_PC_CONVERGED;
+}
+
+/*----------------------------------------------------------------------------
+ * Function for freeing of a block SSOR preconditioner's context data.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_schwarz_free(void  *context)
+{
+  cs_sles_pc_schwarz_t  *c = context;
+
+  c->n_rows = 0;
+  c->n_blocks = 0;
+  c->n_aux = 0;
+
+  c->a = NULL;
+
+  c->row_index = NULL;
+  c->col_id = NULL;
+  c->d_val = NULL;
+  c->x_val = NULL;
+
+  BFT_FREE(c->ad_inv);
+  BFT_FREE(c->aux);
+}
+
+/*----------------------------------------------------------------------------
+ * Function for creation of a block SSOR preconditioner context based on the
+ * copy of another.
+ *
+ * The new context copies the settings of the copied context, but not
+ * its setup data and logged info, such as performance data.
+ *
+ * parameters:
+ *   context  <-- context to clone
+ *
+ * returns:
+ *   pointer to newly created context
+ *----------------------------------------------------------------------------*/
+
+static void *
+_sles_pc_schwarz_clone(const void  *context)
+{
+  const cs_sles_pc_schwarz_t *c = (const cs_sles_pc_schwarz_t *)context;
+
+  cs_sles_pc_schwarz_t *pc = _sles_pc_schwarz_create(c->block_size,
+                                                     c->n_overlap_rows);
+
+  return pc;
+}
+
+/*----------------------------------------------------------------------------
+ * Function pointer for destruction of a block SSOR preconditioner context.
+ *
+ * This function should free all context data.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_schwarz_destroy(void  **context)
+{
+  if (context != NULL) {
+    _sles_pc_schwarz_free(*context);
+    BFT_FREE(*context);
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1140,6 +1736,140 @@ cs_sles_pc_poly_2_create(void)
   return pc;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a block SSOR (additive Schwarz) preconditioner.
+ *
+ * The preconditioner is a restricted additive Schwarz method over
+ * contiguous subdomains of \c block_size rows, extended on each side by
+ * \c n_overlap_rows rows, with a local symmetric Gauss-Seidel (SSOR)
+ * solve on each subdomain. It requires a scalar matrix in MSR format.
+ *
+ * Compared to Jacobi or polynomial preconditioning, each application is
+ * more costly but stronger, so it may reduce the iteration count
+ * significantly on ill-conditioned (for example strongly anisotropic)
+ * systems. It is not selected through the usual polynomial degree
+ * setting, but may be associated with an iterative solver using
+ * \ref cs_sles_it_transfer_pc.
+ *
+ * \param[in]  block_size      base number of rows per subdomain,
+ *                             or 0 for default (1024)
+ * \param[in]  n_overlap_rows  number of additional rows included on each
+ *                             side of a subdomain (0 for no overlap)
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_block_ssor_create(cs_lnum_t  block_size,
+                             cs_lnum_t  n_overlap_rows)
+{
+  cs_sles_pc_schwarz_t *pcs = _sles_pc_schwarz_create(block_size,
+                                                      n_overlap_rows);
+
+  cs_sles_pc_t *pc = cs_sles_pc_define(pcs,
+                                       _sles_pc_schwarz_get_type,
+                                       _sles_pc_schwarz_setup,
+                                       NULL,
+                                       _sles_pc_schwarz_apply,
+                                       _sles_pc_schwarz_free,
+                                       NULL,
+                                       _sles_pc_schwarz_clone,
+                                       _sles_pc_schwarz_destroy);
+
+  return pc;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if single-precision storage is used for the inverse
+ *        diagonal of Jacobi and polynomial preconditioners.
+ *
+ * \return  true if single-precision storage is enabled, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_pc_get_single_precision_diagonal(void)
+{
+  return _use_sp_diag;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable single-precision storage of the inverse
+ *        diagonal of Jacobi and polynomial preconditioners.
+ *
+ * When enabled, the inverse diagonal of those preconditioners is stored
+ * and applied in single precision, reducing the memory bandwidth of the
+ * preconditioner application; solver iterations remain in double
+ * precision, so the rounding acts only as a perturbation of the
+ * preconditioning, and the achievable solution accuracy is unchanged.
+ *
+ * The setting is applied at preconditioner setup, so it affects
+ * preconditioners set up after this call. It applies to the host
+ * implementations only.
+ *
+ * \param[in]  enable  true to enable, false to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_pc_set_single_precision_diagonal(bool  enable)
+{
+  _use_sp_diag = enable;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if the inverse diagonal of Jacobi and polynomial
+ *        preconditioners is shared across systems with matching
+ *        matrix diagonals.
+ *
+ * \return  true if diagonal sharing is enabled, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_pc_get_diagonal_sharing(void)
+{
+  return _use_shared_diag;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable sharing of the inverse diagonal of Jacobi
+ *        and polynomial preconditioners across linear systems.
+ *
+ * When enabled, preconditioners whose associated matrices have the same
+ * number of rows and bitwise identical diagonal coefficients reference
+ * a single pooled inverse diagonal rather than each setting up their
+ * own copy. This is typically useful for series of scalar convection-
+ * diffusion solves (such as species transport with equal diffusivities),
+ * where many systems share both sparsity and coefficients within a
+ * time step, and avoids replicating both the setup work and the storage.
+ *
+ * A candidate match is located using a hash of the matrix diagonal and
+ * confirmed by exact comparison, so sharing never modifies results;
+ * systems whose coefficients do not match simply keep separate setups.
+ * The pooled data is reference-counted, and released when the attached
+ * preconditioners are freed or set up again with different coefficients.
+ *
+ * The setting is applied at preconditioner setup, so it affects
+ * preconditioners set up after this call. It applies to scalar systems
+ * using built-in matrix types, on the host only.
+ *
+ * \param[in]  enable  true to enable, false to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_pc_set_diagonal_sharing(bool  enable)
+{
+  _use_shared_diag = enable;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -508,6 +508,108 @@ cs_sles_pc_poly_1_create(void);
 cs_sles_pc_t *
 cs_sles_pc_poly_2_create(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a block SSOR (additive Schwarz) preconditioner.
+ *
+ * The preconditioner is a restricted additive Schwarz method over
+ * contiguous subdomains of \c block_size rows, extended on each side by
+ * \c n_overlap_rows rows, with a local symmetric Gauss-Seidel (SSOR)
+ * solve on each subdomain. It requires a scalar matrix in MSR format.
+ *
+ * It is not selected through the usual polynomial degree setting, but may
+ * be associated with an iterative solver using \ref cs_sles_it_transfer_pc.
+ *
+ * \param[in]  block_size      base number of rows per subdomain,
+ *                             or 0 for default (1024)
+ * \param[in]  n_overlap_rows  number of additional rows included on each
+ *                             side of a subdomain (0 for no overlap)
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_block_ssor_create(cs_lnum_t  block_size,
+                             cs_lnum_t  n_overlap_rows);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if single-precision storage is used for the inverse
+ *        diagonal of Jacobi and polynomial preconditioners.
+ *
+ * \return  true if single-precision storage is enabled, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_pc_get_single_precision_diagonal(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable single-precision storage of the inverse
+ *        diagonal of Jacobi and polynomial preconditioners.
+ *
+ * When enabled, the inverse diagonal of those preconditioners is stored
+ * and applied in single precision, reducing the memory bandwidth of the
+ * preconditioner application; solver iterations remain in double
+ * precision, so the rounding acts only as a perturbation of the
+ * preconditioning, and the achievable solution accuracy is unchanged.
+ *
+ * The setting is applied at preconditioner setup, so it affects
+ * preconditioners set up after this call. It applies to the host
+ * implementations only.
+ *
+ * \param[in]  enable  true to enable, false to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_pc_set_single_precision_diagonal(bool  enable);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if the inverse diagonal of Jacobi and polynomial
+ *        preconditioners is shared across systems with matching
+ *        matrix diagonals.
+ *
+ * \return  true if diagonal sharing is enabled, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_pc_get_diagonal_sharing(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable sharing of the inverse diagonal of Jacobi
+ *        and polynomial preconditioners across linear systems.
+ *
+ * When enabled, preconditioners whose associated matrices have the same
+ * number of rows and bitwise identical diagonal coefficients reference
+ * a single pooled inverse diagonal rather than each setting up their
+ * own copy. This is typically useful for series of scalar convection-
+ * diffusion solves (such as species transport with equal diffusivities),
+ * where many systems share both sparsity and coefficients within a
+ * time step, and avoids replicating both the setup work and the storage.
+ *
+ * A candidate match is located using a hash of the matrix diagonal and
+ * confirmed by exact comparison, so sharing never modifies results;
+ * systems whose coefficients do not match simply keep separate setups.
+ * The pooled data is reference-counted, and released when the attached
+ * preconditioners are freed or set up again with different coefficients.
+ *
+ * The setting is applied at preconditioner setup, so it affects
+ * preconditioners set up after this call. It applies to scalar systems
+ * using built-in matrix types, on the host only.
+ *
+ * \param[in]  enable  true to enable, false to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_pc_set_diagonal_sharing(bool  enable);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -71,6 +71,12 @@ typedef struct {
   cs_real_t           *_ad_inv;           /* private pointer to
                                              diagonal inverse */
 
+  float               *ad_inv_sp;         /* optional single-precision copy
+                                             of diagonal inverse (host) */
+
+  int                  shared_id;         /* id of pooled shared diagonal
+                                             inverse, or -1 if not shared */
+
   cs_real_t           *aux;               /* Auxiliary data */
 
 } cs_sles_pc_poly_t;
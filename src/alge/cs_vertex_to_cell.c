@@ -103,8 +103,8 @@ typedef  cs_real_t  cs_weight_t;  /* will allow testing single precision
  *  Global variables
  *============================================================================*/
 
-bool          _set_vtc[3] = {false, false, false};
-cs_weight_t  *_weights_vtc[3] = {NULL, NULL, NULL};
+static bool          _set_vtc[3] = {false, false, false};
+static cs_weight_t  *_weights_vtc[3] = {NULL, NULL, NULL};
 
 /* Short names for gradient computation types */
 
@@ -645,8 +645,10 @@ _vertex_to_cell_strided(cs_vertex_to_cell_type_t   method,
 void
 cs_vertex_to_cell_free(void)
 {
-  for (int i = 0; i < 3; i++)
+  for (int i = 0; i < 3; i++) {
     BFT_FREE(_weights_vtc[i]);
+    _set_vtc[i] = false;
+  }
 }
 
 /*----------------------------------------------------------------------------*/
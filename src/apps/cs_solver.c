@@ -60,6 +60,7 @@
 #include "cs_coupling.h"
 #include "cs_ctwr.h"
 #include "cs_domain_setup.h"
+#include "cs_ensemble.h"
 #include "cs_ext_library_info.h"
 #include "cs_fan.h"
 #include "cs_field.h"
@@ -77,6 +78,7 @@
 #include "cs_gui_particles.h"
 #include "cs_gui_radiative_transfer.h"
 #include "cs_gui_util.h"
+#include "cs_halo.h"
 #include "cs_io.h"
 #include "cs_ibm.h"
 #include "cs_join.h"
@@ -87,6 +89,7 @@
 #include "cs_matrix_default.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
+#include "cs_mesh_cartesian.h"
 #include "cs_mesh_coherency.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quality.h"
@@ -271,6 +274,33 @@ _run(void)
   cs_sles_initialize();
   cs_sles_set_default_verbosity(cs_sles_default_get_verbosity);
 
+  /* In benchmark mode, allow running without a case mesh: if no mesh
+     input is available, define a synthetic Cartesian mesh, so machine
+     qualification runs do not require maintaining a reference case */
+
+  if (   opts.benchmark > 0
+      && cs_mesh_cartesian_need_build() == 0
+      && cs_preprocessor_data_is_input_present() == false) {
+
+    int nc = 64;
+    const char *s = getenv("CS_BENCHMARK_MESH_SIZE");
+    if (s != NULL && atoi(s) > 0)
+      nc = atoi(s);
+
+    int ncells[3] = {nc, nc, nc};
+    cs_real_t xyz[6] = {0., 0., 0., 1., 1., 1.};
+
+    cs_mesh_cartesian_define_simple(NULL, ncells, xyz);
+
+    bft_printf(_("\n"
+                 " No mesh input available in benchmark mode:\n"
+                 "   using a synthetic %d x %d x %d Cartesian mesh\n"
+                 "   (cells per direction may be set using the\n"
+                 "   CS_BENCHMARK_MESH_SIZE environment variable).\n"),
+               nc, nc, nc);
+
+  }
+
   cs_preprocessor_data_read_headers(cs_glob_mesh,
                                     cs_glob_mesh_builder,
                                     false);
@@ -575,6 +605,7 @@ _run(void)
   cs_sat_coupling_all_finalize();
   cs_sys_coupling_all_finalize();
   cs_paramedmem_coupling_all_finalize();
+  cs_ensemble_finalize();
   cs_coupling_finalize();
 #endif
 
@@ -668,6 +699,8 @@ _run(void)
   /* CPU times and memory management finalization */
 
   cs_all_to_all_log_finalize();
+  cs_halo_log_finalize();
+  cs_parall_log_finalize();
   cs_io_log_finalize();
 
   cs_timer_stats_finalize();
@@ -67,6 +67,7 @@ double precision heuray, albedo, emis, foir, fos
 double precision xvert, yvert
 double precision surf_zone
 double precision zrac,fpond,rap,tmoy,rhum,dum
+double precision tausupl
 
 integer, allocatable :: cressm(:), interp(:)
 integer, dimension(:), pointer :: elt_ids
@@ -75,6 +76,7 @@ double precision, allocatable, dimension(:) :: temray, qvray, qlray, ncray
 double precision, allocatable, dimension(:) :: fneray, romray, preray
 double precision, allocatable, dimension(:) :: zproj, ttvert, romvert
 double precision, allocatable, dimension(:) :: aeroso, infrad
+double precision, allocatable, dimension(:) :: tauzql, tauzl, zql
 double precision, allocatable, dimension(:,:,:) :: coords(:,:,:)
 double precision, dimension(:), pointer :: crom, cpro_pcliq
 double precision, dimension(:), pointer :: cvara_totwt, cpro_tempc, cvara_ntdrp
@@ -135,6 +137,7 @@ if (mod(ntcabs,nfatr1).eq.0.or.ideb.eq.0) then
   allocate(fneray(kmx), romray(kmx), preray(kmx))
   allocate(zproj(kmx), ttvert(kmx*nvert), romvert(kmx*nvert))
   allocate(aeroso(kmx))
+  allocate(tauzql(kmx+1), tauzl(kmx+1), zql(kmx+1))
 
   ! Get pointers from C
   call cs_f_atmo_rad_1d_arrays_get_pointers(c_qwvert,  &
@@ -171,7 +174,6 @@ if (mod(ntcabs,nfatr1).eq.0.or.ideb.eq.0) then
 
   ! --- Initialization:
   do k = 2, kvert
-    zray(k) = 0.d0
     preray(k) = 0.d0
     temray(k) = 0.d0
     qvray(k) = 0.d0
@@ -182,6 +184,11 @@ if (mod(ntcabs,nfatr1).eq.0.or.ideb.eq.0) then
     aeroso(k) = 0.d0
   enddo
 
+  ! --- Vertical coordinate, identical for all verticals
+  do k = 1, kmx
+    zray(k) = zvert(k)
+  enddo
+
   call field_get_val_s(icrom, crom)
   call field_get_val_s(itempc, cpro_tempc)
 
@@ -307,6 +314,16 @@ if (mod(ntcabs,nfatr1).eq.0.or.ideb.eq.0) then
 
   ! --- Loop on the vertical array:
 
+  ! Verticals are independent, so they are distributed over threads,
+  ! each working on private profile arrays. The CO2 absorption tables
+  ! (aco2, acsup, ...) are built inside rayir when ico2 = 1, so the loop
+  ! runs serially in that case and in parallel once they are only read.
+
+  !$omp parallel do if(ico2.eq.0)                                   &
+  !$omp private(xvert, yvert, albedo, emis, imer1, k, k1, kmray,    &
+  !$omp         ktamp, icompt, zrac, fpond, rap, tmoy, rhum, dum,   &
+  !$omp         foir, fos, temray, qvray, qlray, ncray, fneray,     &
+  !$omp         romray, preray, aeroso, tauzql, tauzl, tausupl, zql)
   do ii = 1, nvert
 
     ! FIXME the x, y position plays no role...
@@ -323,8 +340,11 @@ if (mod(ntcabs,nfatr1).eq.0.or.ideb.eq.0) then
     ! 2.1 Profiles used for the computation of the radiative fluxes
     !--------------------------------------------------------------
 
+    do k = 1, kmx
+      aeroso(k) = 0.d0
+    enddo
+
     ! Soil variables
-    zray(1)   = zvert(1)
     temray(1) = soilvert(ii)%ttsoil
     qvray(1)  = soilvert(ii)%totwat
     romray(1) = soilvert(ii)%density
@@ -332,7 +352,6 @@ if (mod(ntcabs,nfatr1).eq.0.or.ideb.eq.0) then
     qlray(1)  = 0.d0
     ncray(1)  = 0.d0
     fneray(1) = 0.d0
-    aeroso(1) = 0.d0
 
     ! Interpolation of temperature, humidity, density on the vertical
     ! The ref pressure profile is the one computed from the meteo profile
@@ -343,8 +362,6 @@ if (mod(ntcabs,nfatr1).eq.0.or.ideb.eq.0) then
     endif
 
     do k = 2, kvert
-      zray(k) = zvert(k)
-
       temray(k) = ttvert(k + (ii-1)*kmx)
       qvray(k)  = qvvert(k, ii)
       romray(k) = romvert(k + (ii-1)*kmx)
@@ -376,11 +393,9 @@ if (mod(ntcabs,nfatr1).eq.0.or.ideb.eq.0) then
     kmray = kmx
 
     do k = kvert+1, kmray
-      zray(k) = zvert(k)
       qlray(k) = 0.d0
       qvray(k) = 0.d0
       fneray(k) = 0.d0
-      aeroso(k) = 0.d0
       ncray(k) = 0.d0
 
       ! initialize with standard atmosphere
@@ -442,7 +457,7 @@ if (mod(ntcabs,nfatr1).eq.0.or.ideb.eq.0) then
 
     ! --- Long-wave: InfraRed
     call rayir(ii, k1, kmray, ico2, emis,                         &
-               tauzq, tauz, tausup, zq,                           &
+               tauzql, tauzl, tausupl, zql,                       &
                acinfe, dacinfe, aco2, daco2, aco2s, daco2s,       &
                acsup, dacsup, acsups, dacsups,                    &
                zray, temray, qvray,                               &
@@ -451,12 +466,13 @@ if (mod(ntcabs,nfatr1).eq.0.or.ideb.eq.0) then
 
     ! --- Short-wave: Sun
     call rayso(ii, k1, kmray, heuray, imer1, albedo,              &
-               tauzq, tauz, tausup, zq,                           &
+               tauzql, tauzl, tausupl, zql,                       &
                zray,                                              &
                qvray, qlray, fneray, romray, preray, temray,      &
                fos, rayst(:,ii), ncray)
 
   enddo
+  !$omp end parallel do
 
   do ii = 1, kmx*nvert
     cressm(ii) = 1
@@ -476,6 +492,7 @@ if (mod(ntcabs,nfatr1).eq.0.or.ideb.eq.0) then
 
   deallocate(temray, qvray, qlray)
   deallocate(fneray, romray, preray)
+  deallocate(tauzql, tauzl, zql)
   deallocate(zproj, ttvert, romvert)
   deallocate(aeroso)
   deallocate(cressm)
@@ -103,6 +103,14 @@ do ii = 1, nespg
   call field_get_val_prev_s(ivarfl(isca(isca_chem(ii))), cvara_espg(ii)%p)
 enddo
 
+! Cells are integrated independently: all work arrays are cell-local and
+! the Rosenbrock, mechanism and LU routines carry no saved state, so the
+! stiff solves may run in parallel; dynamic scheduling compensates for
+! the varying cost of the per-cell integrations.
+
+!$omp parallel do private(ii, rom, dtc, ncycle, dtrest,            &
+!$omp                     dlconc, source, dchema, conv_factor, rk) &
+!$omp             schedule(dynamic, 64)
 do iel = 1, ncel
 
   ! time step
@@ -182,6 +190,7 @@ do iel = 1, ncel
   enddo
 
 enddo
+!$omp end parallel do
 
 deallocate(cvar_espg, cvara_espg)
 
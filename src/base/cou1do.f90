@@ -153,36 +153,12 @@ call cs_user_1d_wall_thermal(iappel, isuit1)
 iappel = 3
 call cs_1d_wall_thermal_check(iappel, isuit1)
 
-! coupling with radiative module
-if (iirayo.ge.1) then
+! Solve the 1D systems of all coupled faces in a single threaded pass;
+! when coupling with the radiative module, non-wall faces, whose
+! radiative properties are not set, are skipped by
+! cs_1d_wall_thermal_solve_all.
 
-  do ii = 1, nfpt1d
-
-    ifac = ifpt1d(ii)
-
-    ! FIXME pour gerer les faces qui ne sont pas des parois ou beps n'est pas
-    ! renseigne, par exemple si une meme couleur est utilisee pour designer
-    ! plusieurs faces, paroi + autre
-    if (itypfb(ifac).eq.iparoi.or.itypfb(ifac).eq.iparug) then
-
-      call cs_1d_wall_thermal_solve(ii-1, tbord(ifac), hbord(ifac))
-
-    endif
-
-  enddo
-
-! without coupling with radiative module
-else
-
-  do ii = 1, nfpt1d
-
-    ifac = ifpt1d(ii)
-
-    call cs_1d_wall_thermal_solve(ii-1, tbord(ifac), hbord(ifac))
-
-  enddo
-
-endif
+call cs_1d_wall_thermal_solve_all(tbord, hbord)
 
 if (itherm .gt. 1) deallocate(wa)
 
@@ -35,6 +35,10 @@
 #include <stdio.h>
 #include <string.h>
 
+#if defined(HAVE_OPENMP)
+#include <omp.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -44,6 +48,7 @@
 #include "bft_printf.h"
 
 #include "cs_base.h"
+#include "cs_boundary_conditions.h"
 #include "cs_math.h"
 #include "cs_field.h"
 #include "cs_field_pointer.h"
@@ -51,6 +56,7 @@
 #include "cs_mesh.h"
 #include "cs_mesh_location.h"
 #include "cs_parall.h"
+#include "cs_parameters.h"
 #include "cs_physical_constants.h"
 #include "cs_restart.h"
 #include "cs_restart_default.h"
@@ -246,6 +252,169 @@ _1d_wall_thermal_local_models_init(void)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build and solve the tridiagonal system for a given face.
+ *
+ * \param[in]   ii   face number
+ * \param[in]   tf   fluid temperature at the boundary
+ * \param[in]   hf   exchange coefficient for the fluid
+ * \param[in]   al   caller-provided scratch array of size 4*nppt1d
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_1d_wall_thermal_solve_face(cs_lnum_t   ii,
+                            cs_real_t   tf,
+                            cs_real_t   hf,
+                            cs_real_t  *al)
+{
+  cs_lnum_t kk;
+  cs_real_t qinc, eps;
+  cs_lnum_t ifac = _1d_wall_thermal.ifpt1d[ii] - 1;
+
+  if (cs_glob_lagr_extra_module->radiative_model >= 1) {
+    /* coupling with radiative module, qinc and qeps != 0 */
+    /* incident radiative flux at the boundary at the boundary */
+    qinc = CS_F_(qinci)->val[ifac];
+
+    /* emissivity */
+    eps = CS_F_(emissivity)->val[ifac];
+  } else {
+    /* without coupling with radiative module */
+    qinc = 0.;
+    eps = 0.;
+  }
+
+  /* thermal diffusivity */
+  cs_real_t xlmbt1 = _1d_wall_thermal.local_models[ii].xlmbt1;
+
+  /* volumetric heat capacity of the wall */
+  cs_real_t rcp = _1d_wall_thermal.local_models[ii].rcpt1d;
+
+  /* exchange coefficient on the exterior wall */
+  cs_real_t hept1d = _1d_wall_thermal.local_models[ii].hept1d;
+
+  /* flux on the exterior wall */
+  cs_real_t fept1d = _1d_wall_thermal.local_models[ii].fept1d;
+
+  /* thickness of the 1D wall */
+  cs_real_t eppt1d = _1d_wall_thermal.local_models[ii].eppt1d;
+
+  /* temperature on the exterior boundary */
+  cs_real_t tept1d = _1d_wall_thermal.local_models[ii].tept1d;
+
+  /* time-step for the solid resolution */
+  cs_real_t dtpt1d = _1d_wall_thermal.local_models[ii].dtpt1d;
+
+  /* type of exterior boundary condition */
+  int iclt1d = _1d_wall_thermal.local_models[ii].iclt1d;
+
+  cs_real_t a1; /* extrapolation coefficient for temperature1 */
+  cs_real_t h2; /* thermal exchange coefficient on T(1) */
+  cs_real_t f3; /* thermal flux on Tfluide */
+  cs_real_t a4; /* extrapolation coefficient for temperature4 */
+
+  cs_real_t h5 = 0.; /* thermal exchange coefficient on T(n) */
+  cs_real_t f6 = 0.; /* thermal flux on Text */
+
+  cs_real_t m;
+
+  cs_real_t *bl, *cl, *dl;
+  cs_real_t *zz;
+  cs_lnum_t n;
+
+  n = _1d_wall_thermal.local_models[ii].nppt1d;
+
+  bl = al+n;
+  cl = bl+n;
+  dl = cl+n;
+
+  zz = _1d_wall_thermal.local_models[ii].z;
+
+  /* Build the tri-diagonal matrix */
+
+  /* Boundary conditions on the fluid side: flux conservation */
+  /*   flux in the fluid = flux in the solid = f3 + h2*T1 */
+
+  a1 = 1./hf + zz[0]/xlmbt1;
+  h2 = -1./a1; // TAKE CARE TO THE MINUS !
+  f3 = -h2*tf + qinc;
+
+  /* Boundary conditions on the exterior */
+  /*   flux in the fluid = flux in the solid = f6 + h5*T(n-1) */
+
+  /* Dirichlet condition */
+  if (iclt1d == 1) {
+    a4 = 1./hept1d + (eppt1d - zz[n-1])/xlmbt1;
+    h5 = -1./a4;
+    f6 = -h5*tept1d;
+  }
+  /* Forced flux condition */
+  else if (iclt1d == 3) {
+    h5 = 0.;
+    f6 = fept1d;
+  }
+
+  /* Mesh interior points */
+  for (kk = 1; kk <= n-1; kk++) {
+    al[kk] = -xlmbt1/(zz[kk]-zz[kk-1]);
+  }
+
+  m = 2*zz[0];
+  for (kk = 1; kk <= n-2; kk++) {
+    m = 2*(zz[kk]-zz[kk-1])-m;
+    bl[kk] = rcp/dtpt1d*m + xlmbt1/(zz[kk+1]-zz[kk]) + xlmbt1/(zz[kk]-zz[kk-1]);
+  }
+
+  for (kk = 0; kk <= n-2; kk++) {
+    cl[kk] =  -xlmbt1/(zz[kk+1]-zz[kk]);
+  }
+
+  m = 2*zz[0];
+  dl[0] = rcp/dtpt1d*m*(_1d_wall_thermal.local_models[ii].t)[0];
+
+  for (kk = 1; kk <= n-1; kk++) {
+    m = 2*(zz[kk]-zz[kk-1])-m;
+    dl[kk] = rcp/dtpt1d*m*(_1d_wall_thermal.local_models[ii].t)[kk];
+  }
+
+  /* Boundary points */
+  /* bl[0] and bl[n-1] are initialized here and set later,
+     in the case where 0 = n-1 */
+  bl[0] = 0.;
+  bl[n-1] = 0.;
+  al[0] = 0.;
+  bl[0] += rcp/dtpt1d*2*zz[0] + xlmbt1/(zz[1]-zz[0]) - h2
+         + eps*cs_physical_constants_stephan
+         * pow(_1d_wall_thermal.local_models[ii].t[0],3.);
+  dl[0] += f3;
+  bl[n-1] += rcp/dtpt1d*2*(_1d_wall_thermal.local_models[ii].eppt1d-zz[n-1])
+           + xlmbt1/(zz[n-1]-zz[n-2]) - h5;
+  cl[n-1] = 0.;
+  dl[n-1] += f6;
+
+  /* System resolution by a Cholesky method ("dual-scan") */
+  for (kk = 1; kk <= n-1; kk++) {
+    bl[kk] -= al[kk]*cl[kk-1]/bl[kk-1];
+    dl[kk] -= al[kk]*dl[kk-1]/bl[kk-1];
+  }
+
+  _1d_wall_thermal.local_models[ii].t[n-1] = dl[n-1]/bl[n-1];
+
+  for (kk=n-2; kk>=0; kk--) {
+    _1d_wall_thermal.local_models[ii].t[kk] =
+       (dl[kk] - cl[kk]*_1d_wall_thermal.local_models[ii].t[kk+1])/bl[kk];
+  }
+
+  /* Compute the new value of tp */
+  _1d_wall_thermal.tppt1d[ii] = hf + xlmbt1/zz[0];
+  _1d_wall_thermal.tppt1d[ii]
+    = 1./_1d_wall_thermal.tppt1d[ii]
+         *(xlmbt1*_1d_wall_thermal.local_models[ii].t[0]/zz[0]
+           + hf*tf);
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -428,160 +597,74 @@ cs_1d_wall_thermal_solve(cs_lnum_t ii,
                          cs_real_t tf,
                          cs_real_t hf)
 {
-  cs_lnum_t kk;
-  cs_real_t qinc, eps;
-  cs_lnum_t ifac = _1d_wall_thermal.ifpt1d[ii] - 1;
-
-  if (cs_glob_lagr_extra_module->radiative_model >= 1) {
-    /* coupling with radiative module, qinc and qeps != 0 */
-    /* incident radiative flux at the boundary at the boundary */
-    qinc = CS_F_(qinci)->val[ifac];
-
-    /* emissivity */
-    eps = CS_F_(emissivity)->val[ifac];
-  } else {
-    /* without coupling with radiative module */
-    qinc = 0.;
-    eps = 0.;
-  }
-
-  /* thermal diffusivity */
-  cs_real_t xlmbt1 = _1d_wall_thermal.local_models[ii].xlmbt1;
-
-  /* volumetric heat capacity of the wall */
-  cs_real_t rcp = _1d_wall_thermal.local_models[ii].rcpt1d;
-
-  /* exchange coefficient on the exterior wall */
-  cs_real_t hept1d = _1d_wall_thermal.local_models[ii].hept1d;
-
-  /* flux on the exterior wall */
-  cs_real_t fept1d = _1d_wall_thermal.local_models[ii].fept1d;
-
-  /* thickness of the 1D wall */
-  cs_real_t eppt1d = _1d_wall_thermal.local_models[ii].eppt1d;
-
-  /* temperature on the exterior boundary */
-  cs_real_t tept1d = _1d_wall_thermal.local_models[ii].tept1d;
-
-  /* time-step for the solid resolution */
-  cs_real_t dtpt1d = _1d_wall_thermal.local_models[ii].dtpt1d;
-
-  /* type of exterior boundary condition */
-  int iclt1d = _1d_wall_thermal.local_models[ii].iclt1d;
-
-  cs_real_t a1; /* extrapolation coefficient for temperature1 */
-  cs_real_t h2; /* thermal exchange coefficient on T(1) */
-  cs_real_t f3; /* thermal flux on Tfluide */
-  cs_real_t a4; /* extrapolation coefficient for temperature4 */
-
-  cs_real_t h5 = 0.; /* thermal exchange coefficient on T(n) */
-  cs_real_t f6 = 0.; /* thermal flux on Text */
-
-  cs_real_t m;
-
   cs_real_t _al[128];
-  cs_real_t *al, *bl, *cl, *dl;
-  cs_real_t *zz;
-  cs_lnum_t n;
+  cs_real_t *al;
 
-  n = _1d_wall_thermal.local_models[ii].nppt1d;
+  cs_lnum_t n = _1d_wall_thermal.local_models[ii].nppt1d;
 
   if (n > 32)
     BFT_MALLOC(al, 4*n, cs_real_t);
   else
     al = _al;
 
-  bl = al+n;
-  cl = bl+n;
-  dl = cl+n;
-
-  zz = _1d_wall_thermal.local_models[ii].z;
-
-  /* Build the tri-diagonal matrix */
+  _1d_wall_thermal_solve_face(ii, tf, hf, al);
 
-  /* Boundary conditions on the fluid side: flux conservation */
-  /*   flux in the fluid = flux in the solid = f3 + h2*T1 */
-
-  a1 = 1./hf + zz[0]/xlmbt1;
-  h2 = -1./a1; // TAKE CARE TO THE MINUS !
-  f3 = -h2*tf + qinc;
-
-  /* Boundary conditions on the exterior */
-  /*   flux in the fluid = flux in the solid = f6 + h5*T(n-1) */
+  if (al != _al)
+    BFT_FREE(al);
+}
 
-  /* Dirichlet condition */
-  if (iclt1d == 1) {
-    a4 = 1./hept1d + (eppt1d - zz[n-1])/xlmbt1;
-    h5 = -1./a4;
-    f6 = -h5*tept1d;
-  }
-  /* Forced flux condition */
-  else if (iclt1d == 3) {
-    h5 = 0.;
-    f6 = fept1d;
-  }
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Solve the 1D equation for all coupled faces.
+ *
+ * The independent per-face tridiagonal systems are solved in a single
+ * threaded pass, with scratch arrays allocated once per thread rather
+ * than once per face. When coupled with the radiative module, faces
+ * which are not (smooth or rough) walls are skipped, as their radiative
+ * properties are not set.
+ *
+ * \param[in]   tb   fluid temperature at boundary faces
+ * \param[in]   hb   fluid exchange coefficient at boundary faces
+ */
+/*----------------------------------------------------------------------------*/
 
-  /* Mesh interior points */
-  for (kk = 1; kk <= n-1; kk++) {
-    al[kk] = -xlmbt1/(zz[kk]-zz[kk-1]);
-  }
+void
+cs_1d_wall_thermal_solve_all(const cs_real_t  tb[],
+                             const cs_real_t  hb[])
+{
+  const cs_lnum_t nfpt1d = _1d_wall_thermal.nfpt1d;
+  const cs_lnum_t *ifpt1d = _1d_wall_thermal.ifpt1d;
+  const int *bc_type = cs_glob_bc_type;
 
-  m = 2*zz[0];
-  for (kk = 1; kk <= n-2; kk++) {
-    m = 2*(zz[kk]-zz[kk-1])-m;
-    bl[kk] = rcp/dtpt1d*m + xlmbt1/(zz[kk+1]-zz[kk]) + xlmbt1/(zz[kk]-zz[kk-1]);
-  }
+  const bool walls_only
+    = (cs_glob_lagr_extra_module->radiative_model >= 1) ? true : false;
 
-  for (kk = 0; kk <= n-2; kk++) {
-    cl[kk] =  -xlmbt1/(zz[kk+1]-zz[kk]);
-  }
+  const cs_lnum_t scratch_size = 4*_1d_wall_thermal.nmxt1d;
 
-  m = 2*zz[0];
-  dl[0] = rcp/dtpt1d*m*(_1d_wall_thermal.local_models[ii].t)[0];
+  cs_real_t *al_t = NULL;
+  BFT_MALLOC(al_t, scratch_size*cs_glob_n_threads, cs_real_t);
 
-  for (kk = 1; kk <= n-1; kk++) {
-    m = 2*(zz[kk]-zz[kk-1])-m;
-    dl[kk] = rcp/dtpt1d*m*(_1d_wall_thermal.local_models[ii].t)[kk];
-  }
+# pragma omp parallel for  if (nfpt1d > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < nfpt1d; ii++) {
 
-  /* Boundary points */
-  /* bl[0] and bl[n-1] are initialized here and set later,
-     in the case where 0 = n-1 */
-  bl[0] = 0.;
-  bl[n-1] = 0.;
-  al[0] = 0.;
-  bl[0] += rcp/dtpt1d*2*zz[0] + xlmbt1/(zz[1]-zz[0]) - h2
-         + eps*cs_physical_constants_stephan
-         * pow(_1d_wall_thermal.local_models[ii].t[0],3.);
-  dl[0] += f3;
-  bl[n-1] += rcp/dtpt1d*2*(_1d_wall_thermal.local_models[ii].eppt1d-zz[n-1])
-           + xlmbt1/(zz[n-1]-zz[n-2]) - h5;
-  cl[n-1] = 0.;
-  dl[n-1] += f6;
+#if defined(HAVE_OPENMP)
+    cs_real_t *al = al_t + scratch_size*omp_get_thread_num();
+#else
+    cs_real_t *al = al_t;
+#endif
 
-  /* System resolution by a Cholesky method ("dual-scan") */
-  for (kk = 1; kk <= n-1; kk++) {
-    bl[kk] -= al[kk]*cl[kk-1]/bl[kk-1];
-    dl[kk] -= al[kk]*dl[kk-1]/bl[kk-1];
-  }
+    if (walls_only) {
+      cs_lnum_t ifac = ifpt1d[ii] - 1;
+      if (   bc_type[ifac] != CS_SMOOTHWALL
+          && bc_type[ifac] != CS_ROUGHWALL)
+        continue;
+    }
 
-  _1d_wall_thermal.local_models[ii].t[n-1] = dl[n-1]/bl[n-1];
+    _1d_wall_thermal_solve_face(ii, tb[ifpt1d[ii]-1], hb[ifpt1d[ii]-1], al);
 
-  for (kk=n-2; kk>=0; kk--) {
-    _1d_wall_thermal.local_models[ii].t[kk] =
-       (dl[kk] - cl[kk]*_1d_wall_thermal.local_models[ii].t[kk+1])/bl[kk];
   }
 
-  /* Compute the new value of tp */
-  _1d_wall_thermal.tppt1d[ii] = hf + xlmbt1/zz[0];
-  _1d_wall_thermal.tppt1d[ii]
-    = 1./_1d_wall_thermal.tppt1d[ii]
-         *(xlmbt1*_1d_wall_thermal.local_models[ii].t[0]/zz[0]
-           + hf*tf);
-
-  if (al != _al)
-    BFT_FREE(al);
-
+  BFT_FREE(al_t);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -180,6 +180,24 @@ cs_1d_wall_thermal_solve(cs_lnum_t ii,
                          cs_real_t tf,
                          cs_real_t hf);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Solve the 1D equation for all coupled faces.
+ *
+ * The independent per-face tridiagonal systems are solved in a single
+ * threaded pass. When coupled with the radiative module, faces which are
+ * not (smooth or rough) walls are skipped.
+ *
+ * parameters:
+ * \param[in]   tb   fluid temperature at boundary faces
+ * \param[in]   hb   fluid exchange coefficient at boundary faces
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_1d_wall_thermal_solve_all(const cs_real_t  tb[],
+                             const cs_real_t  hb[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Read the restart file of the 1D-wall thermal module.
@@ -30,6 +30,8 @@
  * Standard C library headers
  *----------------------------------------------------------------------------*/
 
+#include <math.h>
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -43,6 +45,7 @@
 #include "cs_boundary_conditions_set_coeffs.h"
 #include "cs_boundary_zone.h"
 #include "cs_cell_to_vertex.h"
+#include "cs_vertex_to_cell.h"
 #include "cs_cdo_quantities.h"
 #include "cs_cdo_connect.h"
 #include "cs_cdo_main.h"
@@ -149,6 +152,25 @@ static cs_ale_cdo_bc_t  *_cdo_bc = NULL;
 
 static bool cs_ale_active = false;
 
+/* Cached face viscosity arrays for the legacy mesh velocity solve.
+   The mesh viscosity operator only depends on the (usually slowly moving)
+   mesh geometry and on the mesh viscosity field, so these arrays are kept
+   across time steps and only rebuilt when the accumulated mesh drift since
+   they were built exceeds a fraction of the smallest cell size, or when
+   the mesh viscosity field itself has changed */
+
+static cs_real_t  *_ale_i_visc = NULL;
+static cs_real_t  *_ale_b_visc = NULL;
+static cs_real_t   _ale_visc_drift = 0.;  /* drift since last rebuild */
+static cs_real_t   _ale_visc_sum = 0.;    /* viscosity sum at last rebuild */
+
+/* Mesh drift (relative to the smallest cell size) above which the face
+   viscosity arrays are rebuilt, and displacement increment below which a
+   single reconstruction sweep is used for the mesh velocity solve */
+
+static const cs_real_t  _ale_visc_rebuild_tol = 0.05;
+static const cs_real_t  _ale_smoothing_tol = 1.e-4;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -1007,34 +1029,83 @@ _ale_solve_poisson_legacy(const cs_domain_t *domain,
     }
   }
 
-  cs_real_t *i_visc = NULL, *b_visc = NULL;
+  /* Face viscosity, cached across time steps (refresh-on-drift);
+     the drift is measured as the accumulated maximum displacement
+     increment, relative to the smallest cell size, and the decision
+     is reduced over all ranks so that communications stay matched */
 
-  BFT_MALLOC(b_visc, n_b_faces, cs_real_t);
+  const cs_real_t l_ref = cbrt(mq->min_vol);
 
-  if (idftnp & CS_ISOTROPIC_DIFFUSION) {
+  cs_real_t d_max = 0.;
+  for (cs_lnum_t v = 0; v < n_vertices; v++) {
+    for (int i = 0; i < 3; i++) {
+      cs_real_t d = fabs(disale[v][i] - disala[v][i]);
+      if (d > d_max)
+        d_max = d;
+    }
+  }
+  cs_parall_max(1, CS_REAL_TYPE, &d_max);
 
-    BFT_MALLOC(i_visc, n_i_faces, cs_real_t);
+  _ale_visc_drift += d_max;
 
-    cs_face_viscosity(m,
-                      mq,
-                      eqp->imvisf,
-                      CS_F_(vism)->val,
-                      i_visc,
-                      b_visc);
+  cs_lnum_t n_visc_vals = m->n_cells;
+  if (idftnp & CS_ANISOTROPIC_LEFT_DIFFUSION)
+    n_visc_vals *= 6;
 
-  }
-  else if (idftnp & CS_ANISOTROPIC_LEFT_DIFFUSION) {
+  cs_real_t visc_sum = 0.;
+  for (cs_lnum_t i = 0; i < n_visc_vals; i++)
+    visc_sum += CS_F_(vism)->val[i];
+
+  int rebuild = 0;
+  if (   _ale_i_visc == NULL
+      || _ale_visc_drift > _ale_visc_rebuild_tol * l_ref
+      || fabs(visc_sum - _ale_visc_sum) > cs_math_epzero*fabs(_ale_visc_sum))
+    rebuild = 1;
+  cs_parall_max(1, CS_INT_TYPE, &rebuild);
+
+  if (rebuild) {
+
+    BFT_REALLOC(_ale_b_visc, n_b_faces, cs_real_t);
+
+    if (idftnp & CS_ISOTROPIC_DIFFUSION) {
 
-    BFT_MALLOC(i_visc, 9*n_i_faces, cs_real_t);
+      BFT_REALLOC(_ale_i_visc, n_i_faces, cs_real_t);
+
+      cs_face_viscosity(m,
+                        mq,
+                        eqp->imvisf,
+                        CS_F_(vism)->val,
+                        _ale_i_visc,
+                        _ale_b_visc);
+
+    }
+    else if (idftnp & CS_ANISOTROPIC_LEFT_DIFFUSION) {
+
+      BFT_REALLOC(_ale_i_visc, 9*n_i_faces, cs_real_t);
+
+      cs_face_anisotropic_viscosity_vector(m,
+                                           mq,
+                                           eqp->imvisf,
+                                           (cs_real_6_t *)CS_F_(vism)->val,
+                                           (cs_real_33_t *)_ale_i_visc,
+                                           _ale_b_visc);
+    }
+
+    _ale_visc_drift = 0.;
+    _ale_visc_sum = visc_sum;
 
-    cs_face_anisotropic_viscosity_vector(m,
-                                         mq,
-                                         eqp->imvisf,
-                                         (cs_real_6_t *)CS_F_(vism)->val,
-                                         (cs_real_33_t *)i_visc,
-                                         b_visc);
   }
 
+  cs_real_t *i_visc = _ale_i_visc, *b_visc = _ale_b_visc;
+
+  /* For very small displacement increments, the previous mesh velocity is
+     already a good estimate of the solution, so a single reconstruction
+     sweep (acting as a cheap smoothing of that estimate) is enough */
+
+  int nswrsm_save = eqp->nswrsm;
+  if (rebuild == 0 && d_max < _ale_smoothing_tol * l_ref)
+    eqp->nswrsm = 1;
+
   cs_equation_iterative_solve_vector(cs_glob_time_step_options->idtvar,
                                      iterns,
                                      CS_F_(mesh_u)->id,
@@ -1063,11 +1134,11 @@ _ale_solve_poisson_legacy(const cs_domain_t *domain,
                                      mshvel,
                                      NULL); /* eswork */
 
-  /* Free memory */
+  eqp->nswrsm = nswrsm_save;
+
+  /* Free memory (face viscosity arrays are kept for the next time step) */
   BFT_FREE(smbr);
   BFT_FREE(fimp);
-  BFT_FREE(i_visc);
-  BFT_FREE(b_visc);
 
   /* 3. Update nodes displacement */
 
@@ -1171,6 +1242,7 @@ cs_ale_update_mesh_quantities(cs_real_t  *min_vol,
 
   cs_gradient_free_quantities();
   cs_cell_to_vertex_free();
+  cs_vertex_to_cell_free();
   cs_mesh_quantities_compute(m, mq);
   cs_mesh_bad_cells_detect(m, mq);
 
@@ -1791,6 +1863,9 @@ cs_ale_destroy_all(void)
 {
   BFT_FREE(_vtx_coord0);
 
+  BFT_FREE(_ale_i_visc);
+  BFT_FREE(_ale_b_visc);
+
   if (_cdo_bc != NULL) {
     BFT_FREE(_cdo_bc->vtx_values);
 
@@ -82,6 +82,11 @@ BEGIN_C_DECLS
   \var CS_ALL_TO_ALL_MPI_DEFAULT
        Use MPI_Alltoall and MPI_Alltoallv sequences
 
+  \var CS_ALL_TO_ALL_NODE_AWARE
+       Use MPI_Alltoall and a two-level (node-aware) MPI_Alltoallv
+       variant, aggregating messages per node so the interconnect
+       sees one message per node pair
+
   \var CS_ALL_TO_ALL_CRYSTAL_ROUTER
        Use crystal router algorithm
 
@@ -197,6 +202,31 @@ typedef struct {
 
 } _hybrid_pex_t;
 
+/* Node-aware (two-level) exchange data */
+
+typedef struct {
+
+  MPI_Comm   comm;           /* Reference communicator */
+  MPI_Comm   node_comm;      /* Intra-node communicator */
+  MPI_Comm   root_comm;      /* Inter-node communicator, grouping the first
+                                rank of each node (MPI_COMM_NULL on other
+                                ranks) */
+
+  int        n_ranks;        /* Size of reference communicator */
+  int        node_size;      /* Size of intra-node communicator */
+  int        node_rank;      /* Rank in intra-node communicator */
+
+  int        n_nodes;        /* Number of nodes */
+  int        node_id;        /* Id of the local node */
+
+  int       *rank_node;      /* Node id for each rank of comm */
+  int       *node_ranks;     /* Ranks of comm, grouped by node, in
+                                increasing rank order inside each node */
+  int       *node_shift;     /* Start of each node's entries in
+                                node_ranks (size: n_nodes + 1) */
+
+} _node_comm_data_t;
+
 #endif /* defined(HAVE_MPI) */
 
 /* Structure used to redistribute data */
@@ -266,6 +296,14 @@ static cs_rank_neighbors_exchange_t _hybrid_meta_type
 
 #if defined(HAVE_MPI)
 
+/* Cached node-aware communicator data */
+
+static _node_comm_data_t *_node_comm_data = NULL;
+
+#endif
+
+#if defined(HAVE_MPI)
+
 /* Call counter and timer: 0: total, 1: metadata comm, 2: data comm */
 
 static size_t              _all_to_all_calls[3] = {0, 0, 0};
@@ -871,6 +909,314 @@ _alltoall_caller_prepare_i(_mpi_all_to_all_caller_t  *dc,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Return node-aware communicator data for a given communicator.
+ *
+ * The data is built on the first call for a given communicator, and
+ * cached for subsequent calls until a different communicator is used.
+ *
+ * parameters:
+ *   comm <-- associated MPI communicator
+ *
+ * returns:
+ *   pointer to node-aware communicator data, or NULL if node-level
+ *   aggregation is not available or all ranks are on the same node
+ *----------------------------------------------------------------------------*/
+
+static _node_comm_data_t *
+_node_comm_data_get(MPI_Comm  comm)
+{
+#if (MPI_VERSION >= 3)
+
+  _node_comm_data_t *nd = _node_comm_data;
+
+  if (nd != NULL) {
+    if (nd->comm == comm)
+      return (nd->n_nodes > 1) ? nd : NULL;
+    else {  /* Rebuild for new communicator */
+      MPI_Comm_free(&(nd->node_comm));
+      if (nd->root_comm != MPI_COMM_NULL)
+        MPI_Comm_free(&(nd->root_comm));
+      BFT_FREE(nd->rank_node);
+      BFT_FREE(nd->node_ranks);
+      BFT_FREE(nd->node_shift);
+      BFT_FREE(_node_comm_data);
+    }
+  }
+
+  BFT_MALLOC(nd, 1, _node_comm_data_t);
+  _node_comm_data = nd;
+
+  nd->comm = comm;
+  MPI_Comm_size(comm, &(nd->n_ranks));
+
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0,
+                      MPI_INFO_NULL, &(nd->node_comm));
+
+  MPI_Comm_rank(nd->node_comm, &(nd->node_rank));
+  MPI_Comm_size(nd->node_comm, &(nd->node_size));
+
+  int color = (nd->node_rank == 0) ? 0 : MPI_UNDEFINED;
+  MPI_Comm_split(comm, color, 0, &(nd->root_comm));
+
+  int node_info[2] = {0, 0};  /* local node id, number of nodes */
+  if (nd->root_comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(nd->root_comm, node_info);
+    MPI_Comm_size(nd->root_comm, node_info + 1);
+  }
+  MPI_Bcast(node_info, 2, MPI_INT, 0, nd->node_comm);
+  nd->node_id = node_info[0];
+  nd->n_nodes = node_info[1];
+
+  /* Global rank to node mappings */
+
+  BFT_MALLOC(nd->rank_node, nd->n_ranks, int);
+  MPI_Allgather(&(nd->node_id), 1, MPI_INT,
+                nd->rank_node, 1, MPI_INT, comm);
+
+  BFT_MALLOC(nd->node_ranks, nd->n_ranks, int);
+  BFT_MALLOC(nd->node_shift, nd->n_nodes + 1, int);
+
+  for (int i = 0; i < nd->n_nodes + 1; i++)
+    nd->node_shift[i] = 0;
+  for (int i = 0; i < nd->n_ranks; i++)
+    nd->node_shift[nd->rank_node[i] + 1] += 1;
+  for (int i = 0; i < nd->n_nodes; i++)
+    nd->node_shift[i+1] += nd->node_shift[i];
+
+  {
+    int *shift;
+    BFT_MALLOC(shift, nd->n_nodes, int);
+    memcpy(shift, nd->node_shift, nd->n_nodes*sizeof(int));
+    for (int i = 0; i < nd->n_ranks; i++) {
+      nd->node_ranks[shift[nd->rank_node[i]]] = i;
+      shift[nd->rank_node[i]] += 1;
+    }
+    BFT_FREE(shift);
+  }
+
+  return (nd->n_nodes > 1) ? nd : NULL;
+
+#else
+
+  CS_UNUSED(comm);
+  return NULL;
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Node-aware (two-level) variant of MPI_Alltoallv for an MPI_Alltoall(v)
+ * caller.
+ *
+ * Data from all ranks of a node is first aggregated on the node's first
+ * rank (through shared memory), exchanged between nodes with one message
+ * per node pair, then distributed to the destination ranks, so the
+ * interconnect sees at most n_nodes^2 messages instead of n_ranks^2.
+ *
+ * The result matches that of a direct MPI_Alltoallv call with the same
+ * counts and displacements, which is also used as a fallback when
+ * node-level aggregation is not available.
+ *
+ * parameters:
+ *   dc      <-> associated MPI_Alltoall(v) caller structure
+ *   sendbuf <-- send buffer
+ *   recvbuf --> receive buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_node_alltoallv(_mpi_all_to_all_caller_t  *dc,
+                const void                *sendbuf,
+                void                      *recvbuf)
+{
+  _node_comm_data_t *nd = _node_comm_data_get(dc->comm);
+
+  if (nd == NULL) {  /* Fall back to single-level exchange */
+    MPI_Alltoallv(sendbuf, dc->send_count, dc->send_displ, dc->comp_type,
+                  recvbuf, dc->recv_count, dc->recv_displ, dc->comp_type,
+                  dc->comm);
+    return;
+  }
+
+  const int n_ranks = nd->n_ranks;
+  const int n_nodes = nd->n_nodes;
+  const int node_size = nd->node_size;
+  const size_t comp_size = dc->comp_size;
+
+  int send_size = 0, recv_size = 0;
+  for (int i = 0; i < n_ranks; i++) {
+    send_size += dc->send_count[i];
+    recv_size += dc->recv_count[i];
+  }
+
+  /* Aggregate per-rank counts and data on the node's first rank */
+
+  int *all_send_count = NULL, *all_recv_count = NULL;
+  int *g_count = NULL, *g_displ = NULL;
+  unsigned char *g_data = NULL;
+
+  if (nd->node_rank == 0) {
+    BFT_MALLOC(all_send_count, (size_t)node_size*n_ranks, int);
+    BFT_MALLOC(all_recv_count, (size_t)node_size*n_ranks, int);
+    BFT_MALLOC(g_count, node_size, int);
+    BFT_MALLOC(g_displ, node_size + 1, int);
+  }
+
+  MPI_Gather(dc->send_count, n_ranks, MPI_INT,
+             all_send_count, n_ranks, MPI_INT, 0, nd->node_comm);
+  MPI_Gather(dc->recv_count, n_ranks, MPI_INT,
+             all_recv_count, n_ranks, MPI_INT, 0, nd->node_comm);
+  MPI_Gather(&send_size, 1, MPI_INT,
+             g_count, 1, MPI_INT, 0, nd->node_comm);
+
+  if (nd->node_rank == 0) {
+    g_displ[0] = 0;
+    for (int i = 0; i < node_size; i++)
+      g_displ[i+1] = g_displ[i] + g_count[i];
+    BFT_MALLOC(g_data, (size_t)(g_displ[node_size])*comp_size, unsigned char);
+  }
+
+  MPI_Gatherv(sendbuf, send_size, dc->comp_type,
+              g_data, g_count, g_displ, dc->comp_type, 0, nd->node_comm);
+
+  /* On the node's first rank, regroup data by destination node
+     (segments ordered by destination rank, then source rank, both in
+     increasing order), and exchange between nodes */
+
+  int *s_count = NULL, *s_displ = NULL;
+  unsigned char *s_data = NULL;
+
+  if (nd->node_rank == 0) {
+
+    int *node_send_count, *node_send_displ;
+    int *node_recv_count, *node_recv_displ;
+
+    BFT_MALLOC(node_send_count, n_nodes, int);
+    BFT_MALLOC(node_send_displ, n_nodes + 1, int);
+    BFT_MALLOC(node_recv_count, n_nodes, int);
+    BFT_MALLOC(node_recv_displ, n_nodes + 1, int);
+
+    for (int i = 0; i < n_nodes; i++) {
+      node_send_count[i] = 0;
+      node_recv_count[i] = 0;
+    }
+    for (int s = 0; s < node_size; s++) {
+      for (int r = 0; r < n_ranks; r++) {
+        node_send_count[nd->rank_node[r]] += all_send_count[s*n_ranks + r];
+        node_recv_count[nd->rank_node[r]] += all_recv_count[s*n_ranks + r];
+      }
+    }
+    node_send_displ[0] = 0;
+    node_recv_displ[0] = 0;
+    for (int i = 0; i < n_nodes; i++) {
+      node_send_displ[i+1] = node_send_displ[i] + node_send_count[i];
+      node_recv_displ[i+1] = node_recv_displ[i] + node_recv_count[i];
+    }
+
+    /* Displacement of each (source, destination) segment in g_data */
+
+    int *l_send_displ;
+    BFT_MALLOC(l_send_displ, (size_t)node_size*n_ranks, int);
+    for (int s = 0; s < node_size; s++) {
+      int shift = g_displ[s];
+      for (int r = 0; r < n_ranks; r++) {
+        l_send_displ[s*n_ranks + r] = shift;
+        shift += all_send_count[s*n_ranks + r];
+      }
+    }
+
+    unsigned char *pack_data;
+    BFT_MALLOC(pack_data,
+               (size_t)(node_send_displ[n_nodes])*comp_size,
+               unsigned char);
+
+    size_t shift = 0;
+    for (int i = 0; i < n_nodes; i++) {
+      for (int j = nd->node_shift[i]; j < nd->node_shift[i+1]; j++) {
+        int r = nd->node_ranks[j];
+        for (int s = 0; s < node_size; s++) {
+          size_t l = (size_t)(all_send_count[s*n_ranks + r])*comp_size;
+          memcpy(pack_data + shift,
+                 g_data + (size_t)(l_send_displ[s*n_ranks + r])*comp_size,
+                 l);
+          shift += l;
+        }
+      }
+    }
+
+    BFT_FREE(l_send_displ);
+    BFT_FREE(g_data);
+
+    unsigned char *node_recv_data;
+    BFT_MALLOC(node_recv_data,
+               (size_t)(node_recv_displ[n_nodes])*comp_size,
+               unsigned char);
+
+    MPI_Alltoallv(pack_data, node_send_count, node_send_displ, dc->comp_type,
+                  node_recv_data, node_recv_count, node_recv_displ,
+                  dc->comp_type, nd->root_comm);
+
+    BFT_FREE(pack_data);
+    BFT_FREE(node_send_count);
+    BFT_FREE(node_send_displ);
+    BFT_FREE(node_recv_count);
+
+    /* Reorder received data by destination rank, then source rank, to
+       match the layout of a direct MPI_Alltoallv on each local rank */
+
+    BFT_MALLOC(s_count, node_size, int);
+    BFT_MALLOC(s_displ, node_size + 1, int);
+
+    s_displ[0] = 0;
+    for (int d = 0; d < node_size; d++) {
+      s_count[d] = 0;
+      for (int r = 0; r < n_ranks; r++)
+        s_count[d] += all_recv_count[d*n_ranks + r];
+      s_displ[d+1] = s_displ[d] + s_count[d];
+    }
+
+    int *m_cursor;
+    BFT_MALLOC(m_cursor, n_nodes, int);
+    for (int i = 0; i < n_nodes; i++)
+      m_cursor[i] = node_recv_displ[i];
+
+    BFT_MALLOC(s_data,
+               (size_t)(s_displ[node_size])*comp_size,
+               unsigned char);
+
+    shift = 0;
+    for (int d = 0; d < node_size; d++) {
+      for (int r = 0; r < n_ranks; r++) {
+        int m = nd->rank_node[r];
+        size_t l = (size_t)(all_recv_count[d*n_ranks + r])*comp_size;
+        memcpy(s_data + shift,
+               node_recv_data + (size_t)(m_cursor[m])*comp_size,
+               l);
+        m_cursor[m] += all_recv_count[d*n_ranks + r];
+        shift += l;
+      }
+    }
+
+    BFT_FREE(m_cursor);
+    BFT_FREE(node_recv_data);
+    BFT_FREE(node_recv_displ);
+
+  }
+
+  /* Distribute to destination ranks */
+
+  MPI_Scatterv(s_data, s_count, s_displ, dc->comp_type,
+               recvbuf, recv_size, dc->comp_type, 0, nd->node_comm);
+
+  BFT_FREE(s_data);
+  BFT_FREE(s_count);
+  BFT_FREE(s_displ);
+  BFT_FREE(all_send_count);
+  BFT_FREE(all_recv_count);
+  BFT_FREE(g_count);
+  BFT_FREE(g_displ);
+}
+
 /*----------------------------------------------------------------------------
  * Exchange metadata for an MPI_Alltoall(v) caller.
  *
@@ -1003,9 +1349,13 @@ _alltoall_caller_exchange_s(cs_all_to_all_t           *d,
     _n_trace += 1;
   }
 
-  MPI_Alltoallv(dc->send_buffer, dc->send_count, dc->send_displ, dc->comp_type,
-                _recv_data, dc->recv_count, dc->recv_displ, dc->comp_type,
-                dc->comm);
+  if (d->type == CS_ALL_TO_ALL_NODE_AWARE)
+    _node_alltoallv(dc, dc->send_buffer, _recv_data);
+  else
+    MPI_Alltoallv(dc->send_buffer, dc->send_count, dc->send_displ,
+                  dc->comp_type,
+                  _recv_data, dc->recv_count, dc->recv_displ, dc->comp_type,
+                  dc->comm);
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_EXCHANGE,
@@ -1162,9 +1512,13 @@ _alltoall_caller_exchange_i(cs_all_to_all_t           *d,
     _n_trace += 1;
   }
 
-  MPI_Alltoallv(dc->send_buffer, dc->send_count, dc->send_displ, dc->comp_type,
-                _recv_data, dc->recv_count, dc->recv_displ, dc->comp_type,
-                dc->comm);
+  if (d->type == CS_ALL_TO_ALL_NODE_AWARE)
+    _node_alltoallv(dc, dc->send_buffer, _recv_data);
+  else
+    MPI_Alltoallv(dc->send_buffer, dc->send_count, dc->send_displ,
+                  dc->comp_type,
+                  _recv_data, dc->recv_count, dc->recv_displ, dc->comp_type,
+                  dc->comm);
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_EXCHANGE,
@@ -2400,7 +2754,8 @@ cs_all_to_all_create(size_t            n_elts,
   /* Create substructures based on info available at this stage
      (for Crystal Router, delay creation as data is not passed yet) */
 
-  if (d->type == CS_ALL_TO_ALL_MPI_DEFAULT)
+  if (   d->type == CS_ALL_TO_ALL_MPI_DEFAULT
+      || d->type == CS_ALL_TO_ALL_NODE_AWARE)
     d->dc = _alltoall_caller_create_meta(flags, comm);
   else if (d->type == CS_ALL_TO_ALL_HYBRID)
     d->hc = _hybrid_pex_create_meta(flags, comm);
@@ -2491,7 +2846,8 @@ cs_all_to_all_create_from_block(size_t                 n_elts,
   /* Create substructures based on info available at this stage
      (for Crystal Router, delay creation as data is not passed yet) */
 
-  if (d->type == CS_ALL_TO_ALL_MPI_DEFAULT)
+  if (   d->type == CS_ALL_TO_ALL_MPI_DEFAULT
+      || d->type == CS_ALL_TO_ALL_NODE_AWARE)
     d->dc = _alltoall_caller_create_meta(flags, comm);
   else if (d->type == CS_ALL_TO_ALL_HYBRID)
     d->hc = _hybrid_pex_create_meta(flags, comm);
@@ -2640,6 +2996,7 @@ cs_all_to_all_n_elts_dest(cs_all_to_all_t  *d)
 
     switch(d->type) {
     case CS_ALL_TO_ALL_MPI_DEFAULT:
+    case CS_ALL_TO_ALL_NODE_AWARE:
       {
         _alltoall_caller_exchange_meta(d->dc,
                                        d->n_elts_src,
@@ -2829,6 +3186,7 @@ cs_all_to_all_copy_array(cs_all_to_all_t   *d,
   switch(d->type) {
 
   case CS_ALL_TO_ALL_MPI_DEFAULT:
+  case CS_ALL_TO_ALL_NODE_AWARE:
     {
       if (d->n_elts_dest < 0) { /* Exchange metadata if not done yet */
         _alltoall_caller_exchange_meta(d->dc,
@@ -3203,6 +3561,7 @@ cs_all_to_all_copy_indexed(cs_all_to_all_t  *d,
   switch(d->type) {
 
   case CS_ALL_TO_ALL_MPI_DEFAULT:
+  case CS_ALL_TO_ALL_NODE_AWARE:
     {
       if (d->n_elts_dest < 0) { /* Exchange metadata if not done yet */
         _alltoall_caller_exchange_meta(d->dc,
@@ -3459,6 +3818,7 @@ cs_all_to_all_get_src_rank(cs_all_to_all_t  *d)
   switch(d->type) {
 
   case CS_ALL_TO_ALL_MPI_DEFAULT:
+  case CS_ALL_TO_ALL_NODE_AWARE:
     {
       const _mpi_all_to_all_caller_t *dc = d->dc;
 
@@ -3577,6 +3937,10 @@ cs_all_to_all_log_finalize(void)
   case CS_ALL_TO_ALL_MPI_DEFAULT:
     snprintf(method_name, 96, N_("MPI_Alltoall and MPI_Alltoallv"));
     break;
+  case CS_ALL_TO_ALL_NODE_AWARE:
+    snprintf(method_name, 96,
+             N_("MPI_Alltoall and node-aware (two-level) MPI_Alltoallv"));
+    break;
   case CS_ALL_TO_ALL_HYBRID:
     snprintf(method_name, 96, N_("Hybrid, %s (metadata), %s (data)"),
              _(cs_rank_neighbors_exchange_name[_hybrid_meta_type]),
@@ -66,6 +66,7 @@ BEGIN_C_DECLS
 typedef enum {
 
   CS_ALL_TO_ALL_MPI_DEFAULT,
+  CS_ALL_TO_ALL_NODE_AWARE,
   CS_ALL_TO_ALL_HYBRID,
   CS_ALL_TO_ALL_CRYSTAL_ROUTER
 
@@ -508,6 +508,78 @@ cs_array_real_padd(cs_lnum_t       n_elts,
     r[ii] += l_add[ii];
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Assign a scaled array s.t. dest = scaling_factor * src
+ *
+ * Fuses the copy and scaling steps into a single sweep.
+ *
+ * \param[in]  n_elts          number of elements
+ * \param[in]  scaling_factor  value of the scaling factor
+ * \param[in]  src             source array values
+ * \param[out] dest            destination array values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_array_real_copy_scale(cs_lnum_t        n_elts,
+                         cs_real_t        scaling_factor,
+                         const cs_real_t  src[],
+                         cs_real_t        dest[restrict])
+{
+  if (n_elts < 1)
+    return;
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_elts; ii++)
+    dest[ii] = scaling_factor * src[ii];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Assign a linear combination s.t. dest = a*x + b*z + c
+ *
+ * Fuses chained copy, scale and add steps into a single sweep.
+ * If z is NULL, one assigns dest = a*x + c.
+ *
+ * \param[in]  n_elts  number of elements
+ * \param[in]  a       scaling factor for x
+ * \param[in]  x       first source array values
+ * \param[in]  b       scaling factor for z (ignored if z is NULL)
+ * \param[in]  z       second source array values, or NULL
+ * \param[in]  c       constant to add
+ * \param[out] dest    destination array values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_array_real_lin_comb(cs_lnum_t        n_elts,
+                       cs_real_t        a,
+                       const cs_real_t  x[],
+                       cs_real_t        b,
+                       const cs_real_t  z[],
+                       cs_real_t        c,
+                       cs_real_t        dest[restrict])
+{
+  if (n_elts < 1)
+    return;
+
+  if (z != NULL) {
+
+#   pragma omp parallel for if (n_elts > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_elts; ii++)
+      dest[ii] = a*x[ii] + b*z[ii] + c;
+
+  }
+  else {
+
+#   pragma omp parallel for if (n_elts > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_elts; ii++)
+      dest[ii] = a*x[ii] + c;
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Assign a constant value of dim "stride" to an interlaced array
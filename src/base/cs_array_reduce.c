@@ -1121,6 +1121,168 @@ _cs_real_sstats_1d_w_iv(cs_lnum_t         n,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute simple local stats (minima, maxima, sum, sum of squares, weighted
+ * sum) of several 1-dimensional arrays in a single sweep.
+ *
+ * The weight array, when present, is shared by all value arrays, and the
+ * weighted sum is only computed for arrays whose w_use flag is set.
+ *
+ * The algorithm here is similar to that used for blas, but computes several
+ * quantities simultaneously for better cache behavior; all arrays are swept
+ * over the same block of elements before moving to the next block, so the
+ * shared weights remain in cache across arrays.
+ *
+ * parameters:
+ *   n        <-- local number of elements
+ *   n_arrays <-- number of value arrays (max: 10)
+ *   v        <-- pointers to array values (size: n each)
+ *   wl       <-- pointer to optional element weights list, or NULL
+ *   w        <-- pointer to optional weights, or NULL
+ *   w_use    <-- optional flags indicating for each array if the weighted
+ *                sum is required, or NULL for all
+ *   vmin     --> resulting min array (size: n_arrays)
+ *   vmax     --> resulting max array (size: n_arrays)
+ *   vsum     --> resulting sum array (size: n_arrays)
+ *   vssum    --> resulting sum of squares array (size: n_arrays)
+ *   wsum     --> resulting weighted sum array (size: n_arrays);
+ *                only set if w is non-NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_cs_real_sstats_1d_n(cs_lnum_t          n,
+                     int                n_arrays,
+                     const cs_real_t  **v,
+                     const cs_lnum_t   *wl,
+                     const cs_real_t   *w,
+                     const bool        *w_use,
+                     double             vmin[],
+                     double             vmax[],
+                     double             vsum[],
+                     double             vssum[],
+                     double             wsum[])
+{
+  assert(n_arrays <= 10);
+
+  for (int a = 0; a < n_arrays; a++) {
+    vmin[a] = HUGE_VAL;
+    vmax[a] = -HUGE_VAL;
+    vsum[a] = 0.;
+    vssum[a] = 0.;
+    if (w != NULL)
+      wsum[a] = 0.;
+  }
+
+# pragma omp parallel if (n > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    cs_parall_thread_range(n, sizeof(cs_real_t), &s_id, &e_id);
+
+    const cs_lnum_t _n = e_id - s_id;
+
+    const cs_lnum_t block_size = CS_SBLOCK_BLOCK_SIZE;
+    cs_lnum_t n_sblocks, blocks_in_sblocks;
+
+    _sbloc_sizes(_n, block_size, &n_sblocks, &blocks_in_sblocks);
+
+    const int na2 = n_arrays*2, na3 = n_arrays*3;
+
+    cs_real_t lmin[10], lmax[10];
+    double lsum[30];
+
+    for (int a = 0; a < n_arrays; a++) {
+      lmin[a] = HUGE_VAL;
+      lmax[a] = -HUGE_VAL;
+      lsum[a] = 0;
+      lsum[a + n_arrays] = 0;
+      lsum[a + na2] = 0;
+    }
+
+    for (cs_lnum_t sid = 0; sid < n_sblocks; sid++) {
+
+      double s[30];
+      for (int j = 0; j < na3; j++)
+        s[j] = 0.;
+
+      for (cs_lnum_t bid = 0; bid < blocks_in_sblocks; bid++) {
+        cs_lnum_t start_id = block_size * (blocks_in_sblocks*sid + bid);
+        cs_lnum_t end_id = block_size * (blocks_in_sblocks*sid + bid + 1);
+        if (end_id > _n)
+          end_id = _n;
+
+        for (int a = 0; a < n_arrays; a++) {
+
+          const cs_real_t *_v = v[a] + s_id;
+          double c[3] = {0., 0., 0.};
+
+          if (w != NULL && (w_use == NULL || w_use[a])) {
+
+            if (wl == NULL) {
+              const cs_real_t *_w = w + s_id;
+              for (cs_lnum_t i = start_id; i < end_id; i++) {
+                c[0] += _v[i];
+                c[1] += _v[i]*_v[i];
+                c[2] += _v[i]*_w[i];
+                if (_v[i] < lmin[a])
+                  lmin[a] = _v[i];
+                if (_v[i] > lmax[a])
+                  lmax[a] = _v[i];
+              }
+            }
+            else {
+              const cs_lnum_t *_wl = wl + s_id;
+              for (cs_lnum_t i = start_id; i < end_id; i++) {
+                c[0] += _v[i];
+                c[1] += _v[i]*_v[i];
+                c[2] += _v[i]*w[_wl[i]];
+                if (_v[i] < lmin[a])
+                  lmin[a] = _v[i];
+                if (_v[i] > lmax[a])
+                  lmax[a] = _v[i];
+              }
+            }
+
+          }
+          else {
+            for (cs_lnum_t i = start_id; i < end_id; i++) {
+              c[0] += _v[i];
+              c[1] += _v[i]*_v[i];
+              if (_v[i] < lmin[a])
+                lmin[a] = _v[i];
+              if (_v[i] > lmax[a])
+                lmax[a] = _v[i];
+            }
+          }
+
+          s[a] += c[0];
+          s[a + n_arrays] += c[1];
+          s[a + na2] += c[2];
+
+        }
+      }
+
+      for (int j = 0; j < na3; j++)
+        lsum[j] += s[j];
+
+    }
+
+#   pragma omp critical
+    {
+      for (int a = 0; a < n_arrays; a++) {
+        if (lmin[a] < vmin[a])
+          vmin[a] = lmin[a];
+        if (lmax[a] > vmax[a])
+          vmax[a] = lmax[a];
+        vsum[a] += lsum[a];
+        vssum[a] += lsum[a + n_arrays];
+        if (w != NULL)
+          wsum[a] += lsum[a + na2];
+      }
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute simple local stats (minima, maxima, several sums and weighted sums)
  * of a 1-dimensional array.
@@ -3658,6 +3820,74 @@ cs_array_reduce_simple_stats_l_w(cs_lnum_t         n_elts,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute simple local stats (minima, maxima, sum, sum of squares,
+ * weighted sum) of several 1-dimensional cs_real_t arrays in a single sweep.
+ *
+ * The arrays must all be defined on the same elements; the weight array,
+ * when present, is shared by all value arrays, and the weighted sum is only
+ * computed for arrays whose w_use flag is set (the matching wsum entries
+ * are set to 0 otherwise).
+ *
+ * Sweeping all arrays in one pass avoids rereading shared weights and
+ * restarting a parallel region for each array.
+ *
+ * The algorithm here is similar to that used for BLAS, but computes several
+ * quantities simultaneously for better cache behavior
+ *
+ * \param[in]   n_elts      number of local elements
+ * \param[in]   n_arrays    number of value arrays
+ * \param[in]   w_elt_list  optional list of parent elements on which weights
+ *                          are defined, or NULL
+ * \param[in]   v           pointers to array values (size: n_elts each)
+ * \param[in]   w           pointer to weights, or NULL
+ * \param[in]   w_use       optional flags indicating for each array if the
+ *                          weighted sum is required, or NULL for all
+ * \param[out]  vmin        resulting min array (size: n_arrays)
+ * \param[out]  vmax        resulting max array (size: n_arrays)
+ * \param[out]  vsum        resulting sum array (size: n_arrays)
+ * \param[out]  vssum       resulting sum of squares array (size: n_arrays)
+ * \param[out]  wsum        resulting weighted sum array (size: n_arrays);
+ *                          only set if w is non-NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_array_reduce_simple_stats_l_n(cs_lnum_t          n_elts,
+                                 int                n_arrays,
+                                 const cs_lnum_t   *w_elt_list,
+                                 const cs_real_t  **v,
+                                 const cs_real_t   *w,
+                                 const bool        *w_use,
+                                 double             vmin[],
+                                 double             vmax[],
+                                 double             vsum[],
+                                 double             vssum[],
+                                 double             wsum[])
+{
+  /* The single-sweep kernel uses fixed-size local accumulators,
+     so larger batches are handled by groups */
+
+  for (int a_0 = 0; a_0 < n_arrays; a_0 += 10) {
+
+    int n_a = CS_MIN(n_arrays - a_0, 10);
+
+    _cs_real_sstats_1d_n(n_elts,
+                         n_a,
+                         v + a_0,
+                         w_elt_list,
+                         w,
+                         (w_use != NULL) ? w_use + a_0 : NULL,
+                         vmin + a_0,
+                         vmax + a_0,
+                         vsum + a_0,
+                         vssum + a_0,
+                         (w != NULL) ? wsum + a_0 : NULL);
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute simple local stats and norms (minima, maxima, sum, weighted
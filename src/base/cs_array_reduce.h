@@ -276,6 +276,52 @@ cs_array_reduce_simple_stats_l_w(cs_lnum_t         n_elts,
                                  double            vsum[],
                                  double            wsum[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute simple local stats (minima, maxima, sum, sum of squares,
+ * weighted sum) of several 1-dimensional cs_real_t arrays in a single sweep.
+ *
+ * The arrays must all be defined on the same elements; the weight array,
+ * when present, is shared by all value arrays, and the weighted sum is only
+ * computed for arrays whose w_use flag is set (the matching wsum entries
+ * are set to 0 otherwise).
+ *
+ * Sweeping all arrays in one pass avoids rereading shared weights and
+ * restarting a parallel region for each array.
+ *
+ * The algorithm here is similar to that used for BLAS, but computes several
+ * quantities simultaneously for better cache behavior
+ *
+ * \param[in]   n_elts      number of local elements
+ * \param[in]   n_arrays    number of value arrays
+ * \param[in]   w_elt_list  optional list of parent elements on which weights
+ *                          are defined, or NULL
+ * \param[in]   v           pointers to array values (size: n_elts each)
+ * \param[in]   w           pointer to weights, or NULL
+ * \param[in]   w_use       optional flags indicating for each array if the
+ *                          weighted sum is required, or NULL for all
+ * \param[out]  vmin        resulting min array (size: n_arrays)
+ * \param[out]  vmax        resulting max array (size: n_arrays)
+ * \param[out]  vsum        resulting sum array (size: n_arrays)
+ * \param[out]  vssum       resulting sum of squares array (size: n_arrays)
+ * \param[out]  wsum        resulting weighted sum array (size: n_arrays);
+ *                          only set if w is non-NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_array_reduce_simple_stats_l_n(cs_lnum_t          n_elts,
+                                 int                n_arrays,
+                                 const cs_lnum_t   *w_elt_list,
+                                 const cs_real_t  **v,
+                                 const cs_real_t   *w,
+                                 const bool        *w_use,
+                                 double             vmin[],
+                                 double             vmax[],
+                                 double             vsum[],
+                                 double             vssum[],
+                                 double             wsum[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute simple local stats and norms (minima, maxima, sum, weighted
@@ -202,6 +202,22 @@ static int       *_step_ranks = NULL;
 static MPI_Comm  *_step_comm = NULL;
 #endif
 
+/* Intra-node shared-memory windows (see cs_base_shared_mem_allocate) */
+
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+
+typedef struct {
+  void     *base;   /* locally mapped base address; NULL if slot unused */
+  MPI_Win   win;    /* associated MPI window */
+} _shared_mem_window_t;
+
+static int                    _n_shared_mem_windows = 0;
+static _shared_mem_window_t  *_shared_mem_windows = NULL;
+
+static MPI_Comm  _shared_mem_comm = MPI_COMM_NULL;
+
+#endif
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -856,6 +872,23 @@ _cs_base_mpi_fin(void)
   bft_error_handler_set(cs_glob_base_err_handler_save);
   ple_error_handler_set(cs_glob_base_err_handler_save);
 
+#if (MPI_VERSION >= 3)
+
+  for (int w_id = 0; w_id < _n_shared_mem_windows; w_id++) {
+    if (_shared_mem_windows[w_id].base != NULL) {
+      MPI_Win_unlock_all(_shared_mem_windows[w_id].win);
+      MPI_Win_free(&(_shared_mem_windows[w_id].win));
+      _shared_mem_windows[w_id].base = NULL;
+    }
+  }
+  BFT_FREE(_shared_mem_windows);
+  _n_shared_mem_windows = 0;
+
+  if (_shared_mem_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&_shared_mem_comm);
+
+#endif
+
   if (   cs_glob_mpi_comm != MPI_COMM_NULL
       && cs_glob_mpi_comm != MPI_COMM_WORLD)
     MPI_Comm_free(&cs_glob_mpi_comm);
@@ -985,6 +1018,81 @@ _mpi_node_info(void)
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Optionally reorder the ranks of the main communicator by
+ *        node locality.
+ *
+ * When the CS_MPI_RANK_REORDER environment variable is set to a value
+ * of at least 1, ranks are relabeled so that ranks sharing a compute
+ * node are contiguous in the main communicator, keeping their relative
+ * order. As partitioning assigns neighboring subdomains to ranks with
+ * close numbers, this maps most halo and rank-neighbor exchanges to
+ * node-local communication when the resource manager's placement is
+ * not already node-contiguous.
+ *
+ * Node adjacency is determined portably through a shared-memory
+ * communicator split, so no batch system or topology library query
+ * is needed. The reorder is applied transparently, before any mesh
+ * distribution, by replacing the main communicator; placements which
+ * are already node-contiguous are detected and left unchanged.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_mpi_rank_reorder(void)
+{
+#if (MPI_VERSION >= 3)
+
+  const char *s = getenv("CS_MPI_RANK_REORDER");
+  if (s == NULL || atoi(s) < 1)
+    return;
+
+  if (cs_glob_n_ranks < 2)
+    return;
+
+  /* Determine a node id, numbering nodes by their lowest rank */
+
+  MPI_Comm sh_comm;
+  MPI_Comm_split_type(cs_glob_mpi_comm, MPI_COMM_TYPE_SHARED, 0,
+                      MPI_INFO_NULL, &sh_comm);
+
+  int sh_rank;
+  MPI_Comm_rank(sh_comm, &sh_rank);
+
+  int is_leader = (sh_rank == 0) ? 1 : 0;
+  int node_id = 0;
+  MPI_Exscan(&is_leader, &node_id, 1, MPI_INT, MPI_SUM, cs_glob_mpi_comm);
+  MPI_Bcast(&node_id, 1, MPI_INT, 0, sh_comm);
+
+  MPI_Comm_free(&sh_comm);
+
+  /* Relabel ranks grouped by node; MPI_Comm_split orders ranks with
+     equal keys by their previous rank, so within-node order is kept */
+
+  MPI_Comm r_comm;
+  MPI_Comm_split(cs_glob_mpi_comm, 0, node_id, &r_comm);
+
+  int r_rank;
+  MPI_Comm_rank(r_comm, &r_rank);
+
+  int diff = (r_rank != cs_glob_rank_id) ? 1 : 0;
+  MPI_Allreduce(MPI_IN_PLACE, &diff, 1, MPI_INT, MPI_MAX, cs_glob_mpi_comm);
+
+  if (diff == 0) {
+    MPI_Comm_free(&r_comm);
+    return;
+  }
+
+  if (cs_glob_mpi_comm != MPI_COMM_WORLD)
+    MPI_Comm_free(&cs_glob_mpi_comm);
+
+  cs_glob_mpi_comm = r_comm;
+  cs_glob_rank_id = r_rank;
+
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Complete MPI setup.
  *
@@ -1044,6 +1152,11 @@ _cs_base_mpi_setup(const char *app_name)
   if (cs_glob_n_ranks == 1 && app_num > -1)
     cs_glob_rank_id = -1;
 
+  /* Optional locality-based rank relabeling, before any distribution
+     depends on rank numbering */
+
+  _mpi_rank_reorder();
+
   _mpi_node_info();
 
   /* Initialize datatype conversion */
@@ -1504,6 +1617,170 @@ cs_base_get_rank_step_comm_recursive(MPI_Comm  parent_comm,
 
 #endif /* HAVE_MPI */
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allocate memory shared by all ranks of the local compute node.
+ *
+ * When MPI 3 shared-memory windows are available and multiple ranks share
+ * the node, the memory is allocated once per node (on the first rank of
+ * the node-local communicator) and mapped in the address space of all
+ * local ranks, so large read-only tables need not be duplicated.
+ *
+ * The usual usage pattern is for the node leader (and only the node
+ * leader) to fill the array, with all ranks then calling
+ * \ref cs_base_shared_mem_sync before reading it. The array should be
+ * freed using \ref cs_base_shared_mem_free.
+ *
+ * In serial mode, or when shared-memory windows are not available, a
+ * private allocation is returned on each rank, and each rank is
+ * considered a node leader (so the fill-then-sync pattern remains valid).
+ *
+ * This function is collective on the global communicator.
+ *
+ * \param[in]   size            allocation size, in bytes
+ * \param[out]  is_node_leader  true if the local rank should initialize
+ *                              the array's contents (optional, may be null)
+ *
+ * \return  pointer to allocated memory
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_base_shared_mem_allocate(size_t   size,
+                            bool    *is_node_leader)
+{
+  void *p = NULL;
+
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+
+  if (cs_glob_n_ranks > 1 && cs_glob_node_n_ranks > 1) {
+
+    if (_shared_mem_comm == MPI_COMM_NULL)
+      MPI_Comm_split_type(cs_glob_mpi_comm, MPI_COMM_TYPE_SHARED, 0,
+                          MPI_INFO_NULL, &_shared_mem_comm);
+
+    int node_rank;
+    MPI_Comm_rank(_shared_mem_comm, &node_rank);
+
+    /* Only the node leader provides a nonzero size; other ranks
+       query and map its segment. */
+
+    MPI_Win win;
+    MPI_Aint w_size = (node_rank == 0) ? (MPI_Aint)size : 0;
+
+    MPI_Win_allocate_shared(w_size, 1, MPI_INFO_NULL, _shared_mem_comm,
+                            &p, &win);
+
+    if (node_rank != 0) {
+      MPI_Aint q_size;
+      int disp_unit;
+      MPI_Win_shared_query(win, 0, &q_size, &disp_unit, &p);
+    }
+
+    /* Direct load/store access for the window's lifetime */
+
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+
+    int w_id = 0;
+    while (   w_id < _n_shared_mem_windows
+           && _shared_mem_windows[w_id].base != NULL)
+      w_id++;
+
+    if (w_id >= _n_shared_mem_windows) {
+      int n_prv = _n_shared_mem_windows;
+      _n_shared_mem_windows = n_prv + 4;
+      BFT_REALLOC(_shared_mem_windows, _n_shared_mem_windows,
+                  _shared_mem_window_t);
+      for (int i = n_prv; i < _n_shared_mem_windows; i++)
+        _shared_mem_windows[i].base = NULL;
+    }
+
+    _shared_mem_windows[w_id].base = p;
+    _shared_mem_windows[w_id].win = win;
+
+    if (is_node_leader != NULL)
+      *is_node_leader = (node_rank == 0) ? true : false;
+
+    return p;
+
+  }
+
+#endif /* defined(HAVE_MPI) && (MPI_VERSION >= 3) */
+
+  /* Fallback: private allocation on each rank */
+
+  BFT_MALLOC(p, size, unsigned char);
+
+  if (is_node_leader != NULL)
+    *is_node_leader = true;
+
+  return p;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Synchronize access to memory shared by ranks of a compute node.
+ *
+ * This function must be called on all ranks after the node leader has
+ * initialized (or modified) an array obtained with
+ * \ref cs_base_shared_mem_allocate, and before other ranks access it.
+ *
+ * \param[in]  p  pointer to shared memory
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_base_shared_mem_sync(const void  *p)
+{
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+
+  for (int w_id = 0; w_id < _n_shared_mem_windows; w_id++) {
+    if (_shared_mem_windows[w_id].base == p) {
+      MPI_Win_sync(_shared_mem_windows[w_id].win);
+      MPI_Barrier(_shared_mem_comm);
+      MPI_Win_sync(_shared_mem_windows[w_id].win);
+      return;
+    }
+  }
+
+#endif
+
+  CS_UNUSED(p);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free memory allocated with \ref cs_base_shared_mem_allocate.
+ *
+ * This function is collective on the global communicator.
+ *
+ * \param[in, out]  p  pointer to pointer to shared memory
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_base_shared_mem_free(void  **p)
+{
+  if (p == NULL)
+    return;
+
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+
+  for (int w_id = 0; w_id < _n_shared_mem_windows; w_id++) {
+    if (_shared_mem_windows[w_id].base == *p && *p != NULL) {
+      MPI_Win_unlock_all(_shared_mem_windows[w_id].win);
+      MPI_Win_free(&(_shared_mem_windows[w_id].win));
+      _shared_mem_windows[w_id].base = NULL;
+      *p = NULL;
+      return;
+    }
+  }
+
+#endif
+
+  BFT_FREE(*p);
+}
+
 /*----------------------------------------------------------------------------
  * Exit, with handling for both normal and error cases.
  *
@@ -1668,6 +1945,17 @@ cs_base_mem_init(void)
     cs_glob_base_bft_mem_init = true;
 
   }
+
+  /* Optional tracing of all allocator traffic, for debugging; tracing
+     may also be activated around a section of interest only, using
+     bft_mem_trace_mode_set directly (for example from user-defined
+     functions, to audit the main time loop once work arrays have been
+     allocated) */
+
+  const char  *p_trace = getenv("CS_MEM_TRACE");
+
+  if (p_trace != NULL)
+    bft_mem_trace_mode_set(atoi(p_trace));
 }
 
 /*----------------------------------------------------------------------------
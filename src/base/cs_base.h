@@ -193,6 +193,62 @@ cs_base_get_rank_step_comm_recursive(MPI_Comm  parent_comm,
 
 #endif /* defined(HAVE_MPI) */
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allocate memory shared by all ranks of the local compute node.
+ *
+ * When MPI 3 shared-memory windows are available and multiple ranks share
+ * the node, the memory is allocated once per node and mapped in the
+ * address space of all local ranks, so large read-only tables need not
+ * be duplicated. The node leader should fill the array, with all ranks
+ * then calling \ref cs_base_shared_mem_sync before reading it.
+ *
+ * In serial mode, or when shared-memory windows are not available, a
+ * private allocation is returned on each rank, and each rank is
+ * considered a node leader.
+ *
+ * This function is collective on the global communicator.
+ *
+ * \param[in]   size            allocation size, in bytes
+ * \param[out]  is_node_leader  true if the local rank should initialize
+ *                              the array's contents (optional, may be null)
+ *
+ * \return  pointer to allocated memory
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_base_shared_mem_allocate(size_t   size,
+                            bool    *is_node_leader);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Synchronize access to memory shared by ranks of a compute node.
+ *
+ * This function must be called on all ranks after the node leader has
+ * initialized (or modified) an array obtained with
+ * \ref cs_base_shared_mem_allocate, and before other ranks access it.
+ *
+ * \param[in]  p  pointer to shared memory
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_base_shared_mem_sync(const void  *p);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free memory allocated with \ref cs_base_shared_mem_allocate.
+ *
+ * This function is collective on the global communicator.
+ *
+ * \param[in, out]  p  pointer to pointer to shared memory
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_base_shared_mem_free(void  **p);
+
 /*----------------------------------------------------------------------------
  * Exit, with handling for both normal and error cases.
  *
@@ -510,7 +510,7 @@ cs_malloc_hd(cs_alloc_mode_t   mode,
     .mode = mode};
 
   if (mode < CS_ALLOC_HOST_DEVICE_PINNED) {
-    me.host_ptr = bft_mem_malloc(ni, size, var_name, nullptr, 0);
+    me.host_ptr = bft_mem_malloc_hp(ni, size, var_name, nullptr, 0);
   }
 
   // Device allocation will be postponed later thru call to
@@ -230,7 +230,7 @@ cs_malloc_hd(cs_alloc_mode_t   mode,
              int               line_num)
 {
   CS_UNUSED(mode);
-  return bft_mem_malloc(ni, size, var_name, file_name, line_num);
+  return bft_mem_malloc_hp(ni, size, var_name, file_name, line_num);
 }
 
 #endif
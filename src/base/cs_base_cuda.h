@@ -42,6 +42,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_base_accel.h"
+#include "cs_hip_compat.h"
 #include "cs_log.h"
 
 /*=============================================================================
@@ -64,11 +65,16 @@
     } \
   }
 
-/* For all current compute capabilities, the warp size is 32; If it ever
-   changes, it can be obtained through cudaDeviceProp, so we could then
-   replace this macro with a global variable */
+/* For all current compute capabilities, the warp size is 32 (64 for the
+   wavefronts of AMD devices targeted through HIP); If it ever changes, it
+   can be obtained through cudaDeviceProp, so we could then replace this
+   macro with a global variable */
 
+#if defined(__HIP__) && !defined(__NVCC__)
+#define CS_CUDA_WARP_SIZE 64
+#else
 #define CS_CUDA_WARP_SIZE 32
+#endif
 
 /*----------------------------------------------------------------------------*/
 
@@ -129,6 +129,17 @@ typedef struct {
 
 } cs_bc_map_t;
 
+/* Cached zone evaluation of a time-invariant BC definition */
+/*----------------------------------------------------------*/
+
+typedef struct {
+
+  const cs_xdef_t  *def;     /* matching definition */
+  cs_lnum_t         n_vals;  /* number of cached values */
+  cs_real_t        *vals;    /* cached values, in dense zone order */
+
+} cs_bc_eval_cache_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -145,6 +156,9 @@ static cs_boundary_conditions_open_t **_bc_open = NULL;
 
 static cs_real_t *_b_head_loss = NULL;
 
+static int _n_bc_eval_caches = 0;
+static cs_bc_eval_cache_t *_bc_eval_caches = NULL;
+
 /*============================================================================
  * Global variables
  *============================================================================*/
@@ -368,6 +382,97 @@ _inlet_sum(const cs_field_t            *f,
   cs_parall_sum(dim, CS_REAL_TYPE, inlet_sum);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check whether a boundary condition definition is time-invariant.
+ *
+ * A definition is considered time-invariant if it is flagged as steady
+ * and the associated zone is not time varying.
+ *
+ * \param[in]  def  pointer to a boundary condition definition
+ *
+ * \return  true if the definition is time-invariant, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_bc_def_is_time_invariant(const cs_xdef_t  *def)
+{
+  if (!(def->state & CS_FLAG_STATE_STEADY))
+    return false;
+
+  const cs_zone_t *bz = cs_boundary_zone_by_id(def->z_id);
+  if (bz->time_varying)
+    return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Evaluate a boundary condition definition at its zone,
+ *          caching values of time-invariant definitions.
+ *
+ * For time-invariant definitions (see \ref _bc_def_is_time_invariant),
+ * the definition is evaluated once, and cached values are returned for
+ * subsequent calls, so only the (vectorizable) scatter to the matching
+ * faces remains to be done at each time step. Cached entries are
+ * re-evaluated if the associated zone size changes (i.e. if the mesh
+ * distribution is modified), and may be dropped explicitly using
+ * \ref cs_boundary_conditions_invalidate_steady_bcs.
+ *
+ * \param[in]  def          pointer to a boundary condition definition
+ * \param[in]  description  description string (for error logging)
+ * \param[in]  t_eval       time at which one evaluates the boundary cond.
+ * \param      eval_buf     evaluation buffer (work array)
+ *
+ * \return  pointer to evaluated (dense) values: either eval_buf,
+ *          or a cached array for time-invariant definitions
+ */
+/*----------------------------------------------------------------------------*/
+
+static const cs_real_t *
+_eval_at_zone_cached(const cs_xdef_t  *def,
+                     const char       *description,
+                     cs_real_t         t_eval,
+                     cs_real_t         eval_buf[])
+{
+  if (_bc_def_is_time_invariant(def) == false) {
+    cs_xdef_eval_at_zone(def, description, t_eval, true, eval_buf);
+    return eval_buf;
+  }
+
+  const cs_zone_t *bz = cs_boundary_zone_by_id(def->z_id);
+  const cs_lnum_t n_vals = bz->n_elts * (cs_lnum_t)(def->dim);
+
+  cs_bc_eval_cache_t *c = NULL;
+
+  for (int i = 0; i < _n_bc_eval_caches; i++) {
+    if (_bc_eval_caches[i].def == def) {
+      c = _bc_eval_caches + i;
+      break;
+    }
+  }
+
+  if (c != NULL && c->n_vals == n_vals)
+    return c->vals;
+
+  if (c == NULL) {
+    BFT_REALLOC(_bc_eval_caches, _n_bc_eval_caches + 1, cs_bc_eval_cache_t);
+    c = _bc_eval_caches + _n_bc_eval_caches;
+    _n_bc_eval_caches += 1;
+    c->def = def;
+    c->vals = NULL;
+  }
+
+  c->n_vals = n_vals;
+  BFT_REALLOC(c->vals, n_vals, cs_real_t);
+
+  cs_xdef_eval_at_zone(def, description, t_eval, true, c->vals);
+
+  return c->vals;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Compute the values of the homogeneous Dirichlet BCs
@@ -522,11 +627,10 @@ _compute_dirichlet_bc(const cs_mesh_t            *mesh,
 
   default:
     {
-      cs_xdef_eval_at_zone(def,
-                           description,
-                           t_eval,
-                           true,  /* dense */
-                           eval_buf);
+      const cs_real_t *eval_vals = _eval_at_zone_cached(def,
+                                                        description,
+                                                        t_eval,
+                                                        eval_buf);
 
       const cs_lnum_t _dim = def->dim;
 
@@ -539,7 +643,7 @@ _compute_dirichlet_bc(const cs_mesh_t            *mesh,
         for (cs_lnum_t i = 0; i < n_elts; i++) {
           const cs_lnum_t  elt_id = elt_ids[i];
           _icodcl[elt_id]  = bc_code;
-          _rcodcl1[elt_id] = eval_buf[_dim*i + coo_id];
+          _rcodcl1[elt_id] = eval_vals[_dim*i + coo_id];
         }
 
       }
@@ -646,11 +750,10 @@ _compute_neumann_bc(const cs_mesh_t            *mesh,
 
   default:
     {
-      cs_xdef_eval_at_zone(def,
-                           description,
-                           t_eval,
-                           true,  /* dense */
-                           eval_buf);
+      const cs_real_t *eval_vals = _eval_at_zone_cached(def,
+                                                        description,
+                                                        t_eval,
+                                                        eval_buf);
 
       const cs_lnum_t _dim = def->dim;
 
@@ -663,7 +766,7 @@ _compute_neumann_bc(const cs_mesh_t            *mesh,
         for (cs_lnum_t i = 0; i < n_elts; i++) {
           const cs_lnum_t  elt_id = elt_ids[i];
           _icodcl[elt_id]  = bc_code;
-          _rcodcl3[elt_id] = eval_buf[_dim*i + coo_id];
+          _rcodcl3[elt_id] = eval_vals[_dim*i + coo_id];
         }
 
       }
@@ -765,11 +868,10 @@ _compute_robin_bc(const cs_mesh_t            *mesh,
 
   default:
     {
-      cs_xdef_eval_at_zone(def,
-                           description,
-                           t_eval,
-                           true,  /* dense */
-                           eval_buf);
+      const cs_real_t *eval_vals = _eval_at_zone_cached(def,
+                                                        description,
+                                                        t_eval,
+                                                        eval_buf);
 
       for (cs_lnum_t coo_id = 0; coo_id < eqp->dim; coo_id++) {
 
@@ -781,8 +883,8 @@ _compute_robin_bc(const cs_mesh_t            *mesh,
         for (cs_lnum_t i = 0; i < n_elts; i++) {
           const cs_lnum_t  elt_id = elt_ids[i];
           _icodcl[elt_id]  = bc_code;
-          _rcodcl1[elt_id] = eval_buf[stride*i + 1 + coo_id];
-          _rcodcl2[elt_id] = -eval_buf[stride*i];
+          _rcodcl1[elt_id] = eval_vals[stride*i + 1 + coo_id];
+          _rcodcl2[elt_id] = -eval_vals[stride*i];
         }
 
       }
@@ -2478,6 +2580,29 @@ cs_boundary_conditions_free(void)
   }
 
   BFT_FREE(_b_head_loss);
+
+  cs_boundary_conditions_invalidate_steady_bcs();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Invalidate cached evaluations of time-invariant boundary
+ *        condition definitions.
+ *
+ * Cached values are rebuilt the next time the matching definitions are
+ * evaluated. This should be called when the mesh distribution or the
+ * boundary zone definitions are modified during a computation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_boundary_conditions_invalidate_steady_bcs(void)
+{
+  for (int i = 0; i < _n_bc_eval_caches; i++)
+    BFT_FREE(_bc_eval_caches[i].vals);
+
+  BFT_FREE(_bc_eval_caches);
+  _n_bc_eval_caches = 0;
 }
 
 /*----------------------------------------------------------------------------*/
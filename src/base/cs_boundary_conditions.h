@@ -328,6 +328,20 @@ cs_boundary_conditions_create(void);
 void
 cs_boundary_conditions_free(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Invalidate cached evaluations of time-invariant boundary
+ *        condition definitions.
+ *
+ * Cached values are rebuilt the next time the matching definitions are
+ * evaluated. This should be called when the mesh distribution or the
+ * boundary zone definitions are modified during a computation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_boundary_conditions_invalidate_steady_bcs(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Prepare (reset) condition coefficients for all variable fields.
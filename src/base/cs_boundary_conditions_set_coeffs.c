@@ -54,6 +54,7 @@
 #include "cs_array.h"
 #include "cs_assert.h"
 #include "cs_base.h"
+#include "cs_base_accel.h"
 #include "cs_boundary.h"
 #include "cs_boundary_conditions.h"
 #include "cs_boundary_conditions_check.h"
@@ -168,6 +169,50 @@ cs_f_user_boundary_conditions_wrapper(const cs_lnum_t  itrifb[],
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Prefetch boundary condition coefficients to the active device.
+ *
+ * Once coefficients have been set on the host, migrating them immediately
+ * (and asynchronously where possible) avoids paying the transfer or page
+ * fault cost inside each device-side consumer (gradients, matrix and
+ * right-hand side contributions) over the rest of the time step.
+ *
+ * Only coefficients using shared (unified) memory are concerned; with
+ * separate host and device allocations, consumers synchronize explicitly,
+ * and an anticipated copy here would simply be repeated.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_ACCEL)
+
+static void
+_sync_bc_coeffs_h2d(void)
+{
+  const int n_fields = cs_field_n_fields();
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+
+    const cs_field_t  *f = cs_field_by_id(f_id);
+    const cs_field_bc_coeffs_t  *bc_coeffs = f->bc_coeffs;
+
+    if (bc_coeffs == NULL)
+      continue;
+
+    const cs_real_t *p[] = {bc_coeffs->a,  bc_coeffs->b,
+                            bc_coeffs->af, bc_coeffs->bf,
+                            bc_coeffs->ac, bc_coeffs->bc};
+
+    for (int i = 0; i < 6; i++) {
+      if (p[i] != NULL) {
+        if (cs_check_device_ptr(p[i]) == CS_ALLOC_HOST_DEVICE_SHARED)
+          cs_sync_h2d_future(p[i]);
+      }
+    }
+
+  }
+}
+
+#endif /* defined(HAVE_ACCEL) */
+
 /*----------------------------------------------------------------------------
  * Compute boundary condition code for radiative transfer
  *----------------------------------------------------------------------------*/
@@ -3449,6 +3494,13 @@ cs_boundary_conditions_set_coeffs(int        nvar,
     BFT_FREE(lbt2h);
     BFT_FREE(vbt2h);
   }
+
+  /* Make the freshly set coefficients available on the active device */
+
+#if defined(HAVE_ACCEL)
+  if (cs_get_device_id() > -1)
+    _sync_bc_coeffs_h2d();
+#endif
 }
 
 /*---------------------------------------------------------------------------- */
@@ -2613,6 +2613,20 @@ module cs_c_bindings
 
     !---------------------------------------------------------------------------
 
+    !> \brief Solve the 1D equation for all coupled faces.
+
+    !> \param[in]   tb   fluid temperature at boundary faces
+    !> \param[in]   hb   fluid exchange coefficient at boundary faces
+
+    subroutine cs_1d_wall_thermal_solve_all(tb, hb)  &
+      bind(C, name='cs_1d_wall_thermal_solve_all')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      real(kind=c_double), dimension(*), intent(in) :: tb, hb
+    end subroutine cs_1d_wall_thermal_solve_all
+
+    !---------------------------------------------------------------------------
+
     !> \brief Log information related to 1D wall thermal problem
 
     subroutine cs_1d_wall_thermal_log()  &
@@ -84,6 +84,67 @@ static cs_coolprop_state_t *_states = NULL;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the CoolProp output name matching a property type.
+ *
+ * \param[in]   property  type of property to compute
+ * \param[out]  outputs   matching CoolProp output name
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_property_output_name(cs_phys_prop_type_t  property,
+                      char                 outputs[32])
+{
+  switch (property) {
+    case CS_PHYS_PROP_PRESSURE:
+      bft_error(__FILE__, __LINE__, 0,
+                _("bad choice: you can't choose pressure as an output variable"));
+      break;
+    case CS_PHYS_PROP_TEMPERATURE:
+      /* temperature is in K */
+      strncpy(outputs, "T", 31);
+      break;
+    case CS_PHYS_PROP_ENTHALPY:
+      strncpy(outputs, "H", 31);
+      break;
+    case CS_PHYS_PROP_ENTROPY:
+      strncpy(outputs, "S", 31);
+      break;
+    case CS_PHYS_PROP_ISOBARIC_HEAT_CAPACITY:
+      strncpy(outputs, "CPMASS", 31);
+      break;
+    case CS_PHYS_PROP_ISOCHORIC_HEAT_CAPACITY:
+      strncpy(outputs, "CVMASS", 31);
+      break;
+    case CS_PHYS_PROP_SPECIFIC_VOLUME:
+      bft_error(__FILE__, __LINE__, 0,
+                _("bad choice: specific volume not available yet"));
+      break;
+    case CS_PHYS_PROP_DENSITY:
+      strncpy(outputs, "D", 31);
+      break;
+    case CS_PHYS_PROP_INTERNAL_ENERGY:
+      strncpy(outputs, "U", 31);
+      break;
+    case CS_PHYS_PROP_QUALITY:
+      bft_error(__FILE__, __LINE__, 0,
+                _("bad choice: quality not available yet"));
+      break;
+    case CS_PHYS_PROP_THERMAL_CONDUCTIVITY:
+      strncpy(outputs, "L", 31);
+      break;
+    case CS_PHYS_PROP_DYNAMIC_VISCOSITY:
+      strncpy(outputs, "V", 31);
+      break;
+    case CS_PHYS_PROP_SPEED_OF_SOUND:
+      strncpy(outputs, "SPEED_OF_SOUND", 31);
+      break;
+  }
+  outputs[31] = '\0';
+}
+
 /*============================================================================
  * Public function definitions
  *============================================================================*/
@@ -92,31 +153,39 @@ BEGIN_C_DECLS
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief Computes physical properties in (P,h,Yi) for compressible flow.
+ * \brief Computes several physical properties in (P,h,Yi) for compressible
+ *        flow, sharing a single equation of state evaluation.
+ *
+ * All properties are deduced from the same thermodynamic state update
+ * (a single table walk per element with tabulated backends), so computing
+ * related properties together is significantly cheaper than separate
+ * calls per property.
  *
  * \param[in]   coolprop_material  CoolProp material
  * \param[in]   coolprop_backend   CoolProp backend ("HEOS" by default,
  *                                 "SRK" for cubic, "TTSE&HEOS" or
  *                                 "BICUBIC&HEOS" for tabulated)
  * \param[in]   thermo_plane       type of thermal plane
- * \param[in]   property           type of property to compute
+ * \param[in]   n_props            number of properties to compute
+ * \param[in]   properties         types of properties to compute
  * \param(in]   n_vals             size of variable and property arrays
  * \param[in]   var1               first variable of thermodynamic plane
  *                                 (pressure)
  * \param[in]   var2               second variable of thermodynamic plane
- * \param[out]  val                computed property values
+ * \param[out]  val                computed property value arrays
  */
 /*----------------------------------------------------------------------------*/
 
 void
-cs_phys_prop_coolprop(char                              *coolprop_material,
-                      const char                        *coolprop_backend,
-                      cs_phys_prop_thermo_plane_type_t   thermo_plane,
-                      cs_phys_prop_type_t                property,
-                      const cs_lnum_t                    n_vals,
-                      const cs_real_t                    var1[],
-                      const cs_real_t                    var2[],
-                      cs_real_t                          val[])
+cs_phys_prop_coolprop_multi(char                              *coolprop_material,
+                            const char                        *coolprop_backend,
+                            cs_phys_prop_thermo_plane_type_t   thermo_plane,
+                            int                                n_props,
+                            const cs_phys_prop_type_t          properties[],
+                            const cs_lnum_t                    n_vals,
+                            const cs_real_t                    var1[],
+                            const cs_real_t                    var2[],
+                            cs_real_t                         *val[])
 {
   const int mb_size = 511;
   char message_buffer[mb_size + 1];
@@ -135,6 +204,8 @@ cs_phys_prop_coolprop(char                              *coolprop_material,
   long errcode = 0;
   long state_handle = -1;
 
+  assert(n_props > 0);
+
   /* API choice for easier testing:
      - 0: high level interface.
      - 1: low level interfaces with array data.
@@ -199,74 +270,41 @@ cs_phys_prop_coolprop(char                              *coolprop_material,
   }
   name2[1] = '\0';
 
-  char outputs[32];
-  switch (property) {
-    case CS_PHYS_PROP_PRESSURE:
-      bft_error(__FILE__, __LINE__, 0,
-                _("bad choice: you can't choose pressure as an output variable"));
-      break;
-    case CS_PHYS_PROP_TEMPERATURE:
-      /* temperature is in K */
-      strncpy(outputs, "T", 31);
-      break;
-    case CS_PHYS_PROP_ENTHALPY:
-      strncpy(outputs, "H", 31);
-      break;
-    case CS_PHYS_PROP_ENTROPY:
-      strncpy(outputs, "S", 31);
-      break;
-    case CS_PHYS_PROP_ISOBARIC_HEAT_CAPACITY:
-      strncpy(outputs, "CPMASS", 31);
-      break;
-    case CS_PHYS_PROP_ISOCHORIC_HEAT_CAPACITY:
-      strncpy(outputs, "CVMASS", 31);
-      break;
-    case CS_PHYS_PROP_SPECIFIC_VOLUME:
-      bft_error(__FILE__, __LINE__, 0,
-                _("bad choice: specific volume not available yet"));
-      break;
-    case CS_PHYS_PROP_DENSITY:
-      strncpy(outputs, "D", 31);
-      break;
-    case CS_PHYS_PROP_INTERNAL_ENERGY:
-      strncpy(outputs, "U", 31);
-      break;
-    case CS_PHYS_PROP_QUALITY:
-      bft_error(__FILE__, __LINE__, 0,
-                _("bad choice: quality not available yet"));
-      break;
-    case CS_PHYS_PROP_THERMAL_CONDUCTIVITY:
-      strncpy(outputs, "L", 31);
-      break;
-    case CS_PHYS_PROP_DYNAMIC_VISCOSITY:
-      strncpy(outputs, "V", 31);
-      break;
-    case CS_PHYS_PROP_SPEED_OF_SOUND:
-      strncpy(outputs, "SPEED_OF_SOUND", 31);
-      break;
+  char *output_names;
+  long *output_keys;
+  BFT_MALLOC(output_names, n_props*32, char);
+  BFT_MALLOC(output_keys, n_props, long);
+
+  for (int p = 0; p < n_props; p++) {
+    _property_output_name(properties[p], output_names + p*32);
+    output_keys[p] = get_param_index(output_names + p*32);
   }
-  outputs[31] = '\0';
-  long output_key = get_param_index(outputs);
 
-  double *prop1, *prop2, *result;
-  double *_prop1 = NULL, *_prop2 = NULL, *_result = NULL;
+  double *prop1, *prop2;
+  double *_prop1 = NULL, *_prop2 = NULL;
+  double **result;
+  double *_result_vals = NULL;
+
+  BFT_MALLOC(result, n_props, double *);
 
   if (sizeof(cs_real_t) != sizeof(double)) {
     BFT_MALLOC(_prop1, n_vals, double);
     BFT_MALLOC(_prop2, n_vals, double);
-    BFT_MALLOC(_result, n_vals, double);
+    BFT_MALLOC(_result_vals, n_vals*n_props, double);
     for (cs_lnum_t i = 0; i < n_vals; i++) {
       _prop1[i] = var1[i];
-      _prop2[i] = var1[i];
+      _prop2[i] = var2[i];
     }
     prop1 = _prop1;
     prop2 = _prop2;
-    result = _result;
+    for (int p = 0; p < n_props; p++)
+      result[p] = _result_vals + p*n_vals;
   }
   else {
     prop1 = const_cast<double *>(var1);
     prop2 = const_cast<double *>(var2);
-    result = val;
+    for (int p = 0; p < n_props; p++)
+      result[p] = val[p];
   }
 
   cs_fp_exception_disable_trap();
@@ -274,18 +312,32 @@ cs_phys_prop_coolprop(char                              *coolprop_material,
   switch(api_choice) {
   case 0:
     {
-      long resdim1 = n_vals, resdim2 = 1;
+      long resdim1 = n_vals, resdim2 = n_props;
       double fractions[1] = {1.0};
 
-      PropsSImulti(outputs,
+      /* Concatenated output names: all properties are computed from a
+         single state evaluation per element */
+
+      char *outputs_s;
+      BFT_MALLOC(outputs_s, n_props*32, char);
+      strcpy(outputs_s, output_names);
+      for (int p = 1; p < n_props; p++) {
+        strcat(outputs_s, ",");
+        strcat(outputs_s, output_names + p*32);
+      }
+
+      double *res_m;
+      BFT_MALLOC(res_m, n_vals*n_props, double);
+
+      PropsSImulti(outputs_s,
                    name1, prop1, n_vals,
                    name2, prop2, n_vals,
                    backend,
                    fluid_names,
                    fractions, 1,
-                   result, &resdim1, &resdim2);
+                   res_m, &resdim1, &resdim2);
 
-      if (resdim1 != n_vals) {
+      if (resdim1 != n_vals || resdim2 != n_props) {
         get_global_param_string("errstring", message_buffer, mb_size);
         bft_error(__FILE__, __LINE__, 0,
                   _("CoolProp was unable to compute some fluid properties with\n"
@@ -294,23 +346,64 @@ cs_phys_prop_coolprop(char                              *coolprop_material,
                     "%s."),
                   name1, name2, backend, fluid_names, message_buffer);
       }
-      assert(resdim2 == 1);
+
+      /* De-interleave result matrix (one row per element) */
+
+      for (int p = 0; p < n_props; p++) {
+        double *res_p = result[p];
+        for (cs_lnum_t i = 0; i < n_vals; i++)
+          res_p[i] = res_m[i*n_props + p];
+      }
+
+      BFT_FREE(res_m);
+      BFT_FREE(outputs_s);
     }
     break;
 
   case 1:
     {
-      AbstractState_update_and_1_out(state_handle, input_pair,
-                                     prop1, prop2, n_vals, output_key,
-                                     result,
-                                     &errcode, message_buffer, mb_size);
-      if (errcode != 0)
-        bft_error(__FILE__, __LINE__, 0,
-                  _("CoolProp was unable to compute property \"%s\" with\n"
-                    "input variable names: \"%s\", \"%s\" and backend \"%s\".\n\n"
-                    "Fluid(s) considered: \"%s\".\n\n"
-                    "%s."),
-                  outputs, name1, name2, backend, fluid_names, message_buffer);
+      /* The low level array interface computes up to 5 outputs from a
+         single state update (one table walk with tabulated backends);
+         unused slots are filled with the last key and a scratch array. */
+
+      double *scratch = NULL;
+      if (n_props % 5 != 0)
+        BFT_MALLOC(scratch, n_vals, double);
+
+      for (int p0 = 0; p0 < n_props; p0 += 5) {
+
+        int nb = CS_MIN(n_props - p0, 5);
+
+        long keys[5];
+        double *outp[5];
+        for (int k = 0; k < 5; k++) {
+          if (k < nb) {
+            keys[k] = output_keys[p0 + k];
+            outp[k] = result[p0 + k];
+          }
+          else {
+            keys[k] = output_keys[p0 + nb - 1];
+            outp[k] = scratch;
+          }
+        }
+
+        AbstractState_update_and_5_out(state_handle, input_pair,
+                                       prop1, prop2, n_vals, keys,
+                                       outp[0], outp[1], outp[2],
+                                       outp[3], outp[4],
+                                       &errcode, message_buffer, mb_size);
+        if (errcode != 0)
+          bft_error(__FILE__, __LINE__, 0,
+                    _("CoolProp was unable to compute property \"%s\" with\n"
+                      "input variable names: \"%s\", \"%s\" and backend \"%s\".\n\n"
+                      "Fluid(s) considered: \"%s\".\n\n"
+                      "%s."),
+                    output_names + p0*32, name1, name2, backend, fluid_names,
+                    message_buffer);
+
+      }
+
+      BFT_FREE(scratch);
     }
     break;
 
@@ -320,16 +413,18 @@ cs_phys_prop_coolprop(char                              *coolprop_material,
         AbstractState_update(state_handle, input_pair,
                              prop1[i], prop2[i],
                              &errcode, message_buffer, mb_size);
-        if (errcode == 0)
-          result[i] = AbstractState_keyed_output(state_handle, output_key,
-                                                 &errcode, message_buffer, mb_size);
+        for (int p = 0; p < n_props && errcode == 0; p++)
+          result[p][i] = AbstractState_keyed_output(state_handle,
+                                                    output_keys[p],
+                                                    &errcode, message_buffer,
+                                                    mb_size);
         if (errcode != 0)
           bft_error(__FILE__, __LINE__, 0,
-                    _("CoolProp was unable to compute property \"%s\" with\n"
+                    _("CoolProp was unable to compute properties with\n"
                       "input variable names: \"%s\", \"%s\" and backend \"%s\".\n\n"
                       "Fluid(s) considered: \"%s\".\n\n"
                       "%s."),
-                    outputs, name1, name2, backend, fluid_names, message_buffer);
+                    name1, name2, backend, fluid_names, message_buffer);
       }
     }
     break;
@@ -340,16 +435,63 @@ cs_phys_prop_coolprop(char                              *coolprop_material,
 
   cs_fp_exception_restore_trap();
 
-  if (_result != NULL) {
-    for (int i = 0; i < n_vals; i++)
-      val[i] = result[i];
-    BFT_FREE(_result);
+  if (_result_vals != NULL) {
+    for (int p = 0; p < n_props; p++) {
+      for (cs_lnum_t i = 0; i < n_vals; i++)
+        val[p][i] = result[p][i];
+    }
+    BFT_FREE(_result_vals);
   }
 
+  BFT_FREE(result);
+  BFT_FREE(output_keys);
+  BFT_FREE(output_names);
+
   BFT_FREE(_prop1);
   BFT_FREE(_prop2);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Computes physical properties in (P,h,Yi) for compressible flow.
+ *
+ * \param[in]   coolprop_material  CoolProp material
+ * \param[in]   coolprop_backend   CoolProp backend ("HEOS" by default,
+ *                                 "SRK" for cubic, "TTSE&HEOS" or
+ *                                 "BICUBIC&HEOS" for tabulated)
+ * \param[in]   thermo_plane       type of thermal plane
+ * \param[in]   property           type of property to compute
+ * \param(in]   n_vals             size of variable and property arrays
+ * \param[in]   var1               first variable of thermodynamic plane
+ *                                 (pressure)
+ * \param[in]   var2               second variable of thermodynamic plane
+ * \param[out]  val                computed property values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_phys_prop_coolprop(char                              *coolprop_material,
+                      const char                        *coolprop_backend,
+                      cs_phys_prop_thermo_plane_type_t   thermo_plane,
+                      cs_phys_prop_type_t                property,
+                      const cs_lnum_t                    n_vals,
+                      const cs_real_t                    var1[],
+                      const cs_real_t                    var2[],
+                      cs_real_t                          val[])
+{
+  cs_real_t *_val[1] = {val};
+
+  cs_phys_prop_coolprop_multi(coolprop_material,
+                              coolprop_backend,
+                              thermo_plane,
+                              1,
+                              &property,
+                              n_vals,
+                              var1,
+                              var2,
+                              _val);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free state for Coolprop plugin.
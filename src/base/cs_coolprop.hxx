@@ -59,6 +59,37 @@ BEGIN_C_DECLS
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * Computes several physical properties in (P,h,Yi) for compressible flow,
+ * sharing a single equation of state evaluation.
+ *
+ * \param[in]   coolprop_material  CoolProp material
+ * \param[in]   coolprop_backend   CoolProp backend ("HEOS" by default,
+ *                                 "SRK" for cubic, "TTSE&HEOS" or
+ *                                 "BICUBIC&HEOS" for tabulated)
+ * \param[in]   thermo_plane       type of thermal plane
+ * \param[in]   n_props            number of properties to compute
+ * \param[in]   properties         types of properties to compute
+ * \param(in]   n_vals             size of variable and property arrays
+ * \param[in]   var1               first variable of thermodynamic plane
+ *                                 (pressure)
+ * \param[in]   var2               second variable of thermodynamic plane
+ * \param[out]  val                computed property value arrays
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_phys_prop_coolprop_multi(char                              *coolprop_material,
+                            const char                        *coolprop_backend,
+                            cs_phys_prop_thermo_plane_type_t   thermo_plane,
+                            int                                n_props,
+                            const cs_phys_prop_type_t          properties[],
+                            const cs_lnum_t                    n_vals,
+                            const cs_real_t                    var1[],
+                            const cs_real_t                    var2[],
+                            cs_real_t                         *val[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * Computes physical properties in (P,h,Yi) for compressible flow.
@@ -908,13 +908,19 @@ _crystal_sendrecv(cs_crystal_router_t  *cr,
   cs_lnum_t send_size[2];
   uint64_t test_size;
 
-  MPI_Status status[3];
-  MPI_Request request[3] = {MPI_REQUEST_NULL,
+  MPI_Status status[4];
+  MPI_Request request[4] = {MPI_REQUEST_NULL,
+                            MPI_REQUEST_NULL,
                             MPI_REQUEST_NULL,
                             MPI_REQUEST_NULL};
   cs_lnum_t recv_size[4] = {0, 0, 0, 0};
 
-  /* Send message to target process */
+  /* Send message to target process; since the payload size is known
+     locally, the data send may be posted immediately after the size send,
+     so that it progresses while sizes are exchanged and the local receive
+     buffer is resized. As messages sharing a (communicator, rank, tag)
+     triplet are non-overtaking, the receiver matches the size message
+     first, in posting order. */
 
   test_size = _comm_type_count(cr, cr->n_elts[1], cr->n_vals[1]);
 
@@ -930,11 +936,17 @@ _crystal_sendrecv(cs_crystal_router_t  *cr,
   MPI_Isend(&send_size, 2, CS_MPI_LNUM, target, cr->rank_id,
             cr->comm, &request[0]);
 
+  MPI_Isend(cr->buffer[1], send_size[1], cr->mpi_type,
+            target, cr->rank_id, cr->comm, &request[1]);
+
   for (int i = 0; i < n_recv; i++)
     MPI_Irecv(recv_size+i*2, 2, CS_MPI_LNUM, target+i, target+i,
-              cr->comm, request+i+1);
+              cr->comm, request+i+2);
 
-  MPI_Waitall(n_recv + 1, request, status);
+  /* Wait only on the size receives; the sends complete with the final
+     wait below, overlapping with the buffer resize */
+
+  MPI_Waitall(n_recv, request+2, status);
 
   size_t loc_size = _data_size(cr, cr->n_elts[0], cr->n_vals[0]);
   for (int i = 0; i < n_recv; i++)
@@ -950,9 +962,6 @@ _crystal_sendrecv(cs_crystal_router_t  *cr,
       cr->alloc_tot_max = alloc_tot;
   }
 
-  MPI_Isend(cr->buffer[1], send_size[1], cr->mpi_type,
-            target, cr->rank_id, cr->comm, request);
-
   cr->n_elts[1] = 0;
 
   for (int i = 0; i < n_recv; i++) {
@@ -961,7 +970,7 @@ _crystal_sendrecv(cs_crystal_router_t  *cr,
                            + _data_size(cr, cr->n_elts[0], cr->n_vals[0]);
 
     MPI_Irecv(r_ptr, recv_size[i*2 + 1], cr->mpi_type,
-              target+i, target+i, cr->comm, request+1+i);
+              target+i, target+i, cr->comm, request+2+i);
 
     cr->n_elts[0] += recv_size[i*2];
     cr->n_vals[0] += _comm_type_count_to_n_vals(cr,
@@ -970,7 +979,7 @@ _crystal_sendrecv(cs_crystal_router_t  *cr,
 
   }
 
-  MPI_Waitall(n_recv+1, request, status);
+  MPI_Waitall(n_recv+2, request, status);
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_cr_timers + 1, &t0, &t1);
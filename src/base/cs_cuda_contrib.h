@@ -36,9 +36,17 @@
 
 template <class T>
 __device__ __forceinline__ T warpReduceSum(unsigned int mask, T mySum) {
+#if defined(__HIP__) && !defined(__NVCC__)
+  // No masked shuffle variants on AMD wavefronts
+  (void)mask;
+  for (int offset = warpSize / 2; offset > 0; offset /= 2) {
+    mySum += __shfl_down(mySum, offset);
+  }
+#else
   for (int offset = warpSize / 2; offset > 0; offset /= 2) {
     mySum += __shfl_down_sync(mask, mySum, offset);
   }
+#endif
   return mySum;
 }
 
@@ -50,7 +50,8 @@
 #include "cs_assert.h"
 #include "cs_mesh.h"
 
-#ifdef __NVCC__
+#if defined(__NVCC__) || defined(__HIP__)
+#include "cs_hip_compat.h"
 #include "cs_base_cuda.h"
 #include "cs_blas_cuda.h"
 #include "cs_alge_cuda.cuh"
@@ -187,10 +188,24 @@ private:
   cs_lnum_t  n_min_for_threads;  /*!< Run on single thread
                                    under this threshold */
 
+  bool       use_dynamic_scheduling_;  /*!< Use dynamic (chunked)
+                                         scheduling for plain loops */
+
+  //! Chunk size for dynamic scheduling; aim for several chunks per
+  //! thread so idle threads can pick up remaining work, while keeping
+  //! chunks large enough to limit scheduling overhead and false sharing.
+  cs_lnum_t
+  dynamic_chunk_size_(cs_lnum_t n) const {
+    cs_lnum_t chunk_size = n / (cs_glob_n_threads * 16);
+    if (chunk_size < 64)
+      chunk_size = 64;
+    return chunk_size;
+  }
+
 public:
 
   cs_host_context()
-    : n_min_for_threads(CS_THR_MIN)
+    : n_min_for_threads(CS_THR_MIN), use_dynamic_scheduling_(false)
   {}
 
 public:
@@ -207,13 +222,37 @@ public:
     return this->n_min_for_threads;
   }
 
+  //! Set or unset dynamic (chunked) scheduling for plain CPU loops.
+  //! This may help load balancing with irregular kernels, such as
+  //! boundary condition loops on boundary-heavy partitions, at the
+  //! cost of a slight scheduling overhead on regular ones.
+  void
+  set_use_cpu_dynamic_scheduling(bool  use_dynamic) {
+    this->use_dynamic_scheduling_ = use_dynamic;
+  }
+
+  //! Indicate if dynamic scheduling is used for plain CPU loops.
+  bool
+  use_cpu_dynamic_scheduling(void) {
+    return this->use_dynamic_scheduling_;
+  }
+
   //! Iterate using a plain omp parallel for
   template <class F, class... Args>
   bool
   parallel_for(cs_lnum_t n, F&& f, Args&&... args) {
-#   pragma omp parallel for  if (n >= n_min_for_threads)
-    for (cs_lnum_t i = 0; i < n; ++i) {
-      f(i, args...);
+    if (use_dynamic_scheduling_ && n >= n_min_for_threads) {
+      const cs_lnum_t chunk_size = dynamic_chunk_size_(n);
+#     pragma omp parallel for schedule(dynamic, chunk_size)
+      for (cs_lnum_t i = 0; i < n; ++i) {
+        f(i, args...);
+      }
+    }
+    else {
+#     pragma omp parallel for  if (n >= n_min_for_threads)
+      for (cs_lnum_t i = 0; i < n; ++i) {
+        f(i, args...);
+      }
     }
     return true;
   }
@@ -266,9 +305,18 @@ public:
                           F&&       f,
                           Args&&... args) {
     sum = 0;
-#   pragma omp parallel for reduction(+:sum) if (n >= n_min_for_threads)
-    for (cs_lnum_t i = 0; i < n; ++i) {
-      f(i, sum, args...);
+    if (use_dynamic_scheduling_ && n >= n_min_for_threads) {
+      const cs_lnum_t chunk_size = dynamic_chunk_size_(n);
+#     pragma omp parallel for reduction(+:sum) schedule(dynamic, chunk_size)
+      for (cs_lnum_t i = 0; i < n; ++i) {
+        f(i, sum, args...);
+      }
+    }
+    else {
+#     pragma omp parallel for reduction(+:sum) if (n >= n_min_for_threads)
+      for (cs_lnum_t i = 0; i < n; ++i) {
+        f(i, sum, args...);
+      }
     }
     return true;
   }
@@ -291,7 +339,7 @@ public:
 
 };
 
-#if defined(__NVCC__)
+#if defined(__NVCC__) || defined(__HIP__)
 
 /* Default kernel that loops over an integer range and calls a device functor.
    This kernel uses a grid_size-stride loop and thus guarantees that all
@@ -366,13 +414,17 @@ private:
 
   bool          use_gpu_;     /*!< Run on GPU if available */
 
+  double        cpu_fraction_;  /*!< Fraction of plain dispatched ranges
+                                  run on the host CPU, overlapping the
+                                  device launch (0 by default) */
+
 public:
 
   //! Constructor
 
   cs_device_context(void)
     : grid_size_(0), block_size_(256), stream_(cs_cuda_get_stream(0)),
-      device_(0), use_gpu_(true)
+      device_(0), use_gpu_(true), cpu_fraction_(0.)
   {
     device_ = cs_base_cuda_get_device();
   }
@@ -382,14 +434,14 @@ public:
                     cudaStream_t  stream,
                     int           device)
     : grid_size_(grid_size), block_size_(block_size), stream_(stream),
-      device_(device), use_gpu_(true)
+      device_(device), use_gpu_(true), cpu_fraction_(0.)
   {}
 
   cs_device_context(long          grid_size,
                     long          block_size,
                     cudaStream_t  stream)
     : grid_size_(grid_size), block_size_(block_size), stream_(stream),
-      device_(0), use_gpu_(true)
+      device_(0), use_gpu_(true), cpu_fraction_(0.)
   {
     device_ = cs_base_cuda_get_device();
   }
@@ -397,14 +449,15 @@ public:
   cs_device_context(long  grid_size,
                     long  block_size)
     : grid_size_(grid_size), block_size_(block_size),
-       stream_(cs_cuda_get_stream(0)), device_(0), use_gpu_(true)
+       stream_(cs_cuda_get_stream(0)), device_(0), use_gpu_(true),
+       cpu_fraction_(0.)
   {
     device_ = cs_base_cuda_get_device();
   }
 
   cs_device_context(cudaStream_t  stream)
     : grid_size_(0), block_size_(256), stream_(stream), device_(0),
-      use_gpu_(true)
+      use_gpu_(true), cpu_fraction_(0.)
   {
     device_ = cs_base_cuda_get_device();
   }
@@ -453,6 +506,22 @@ public:
     this->use_gpu_ = use_gpu;
   }
 
+  //! Set fraction of plain dispatched ranges run on the host CPU.
+  //! The tail of each range is run with OpenMP on the host while the
+  //! head runs asynchronously on the device, so otherwise idle CPU
+  //! cores contribute during device execution. This must only be
+  //! enabled for kernels whose arrays are host-accessible (shared or
+  //! host-device allocations), so it is off (0) by default.
+
+  void
+  set_hybrid_cpu_fraction(double  fraction) {
+    if (fraction < 0.)
+      fraction = 0.;
+    else if (fraction > 0.9)
+      fraction = 0.9;
+    this->cpu_fraction_ = fraction;
+  }
+
   //! Check whether we are trying to run on GPU
 
   bool
@@ -491,13 +560,30 @@ public:
       return false;
     }
 
-    long l_grid_size = grid_size_;
-    if (l_grid_size < 1) {
-      l_grid_size = (n % block_size_) ? n/block_size_ + 1 : n/block_size_;
+    cs_lnum_t n_device = n;
+    if (cpu_fraction_ > 0.)
+      n_device = n - (cs_lnum_t)(n*cpu_fraction_);
+
+    if (n_device > 0) {
+      long l_grid_size = grid_size_;
+      if (l_grid_size < 1) {
+        l_grid_size =   (n_device % block_size_)
+                      ? n_device/block_size_ + 1 : n_device/block_size_;
+      }
+
+      cs_cuda_kernel_parallel_for<<<l_grid_size, block_size_, 0, stream_>>>
+        (n_device, f, args...);
     }
 
-    cs_cuda_kernel_parallel_for<<<l_grid_size, block_size_, 0, stream_>>>
-      (n, static_cast<F&&>(f), static_cast<Args&&>(args)...);
+    /* Remaining (highest-numbered) portion on the host, overlapping
+       the asynchronous device launch above */
+
+    if (n_device < n) {
+#     pragma omp parallel for  if (n - n_device > CS_THR_MIN)
+      for (cs_lnum_t i = n_device; i < n; i++) {
+        f(i, args...);
+      }
+    }
 
     return true;
   }
@@ -628,12 +714,18 @@ private:
 
   bool              use_gpu_;    /*!< Run on GPU ? */
 
+  double            cpu_fraction_;  /*!< Fraction of plain dispatched
+                                      ranges run on the host CPU,
+                                      overlapping the device launch
+                                      (0 by default) */
+
 public:
 
   //! Constructor
 
   cs_device_context(void)
-    : queue_(cs_glob_sycl_queue), is_gpu(false), use_gpu_(true)
+    : queue_(cs_glob_sycl_queue), is_gpu(false), use_gpu_(true),
+      cpu_fraction_(0.)
   {
     is_gpu = queue_.get_device().is_gpu();
   }
@@ -645,6 +737,22 @@ public:
     this->use_gpu_ = use_gpu;
   }
 
+  //! Set fraction of plain dispatched ranges run on the host CPU.
+  //! The tail of each range is run with OpenMP on the host while the
+  //! head runs asynchronously on the device, so otherwise idle CPU
+  //! cores contribute during device execution. This must only be
+  //! enabled for kernels whose arrays are host-accessible (shared or
+  //! host-device allocations), so it is off (0) by default.
+
+  void
+  set_hybrid_cpu_fraction(double  fraction) {
+    if (fraction < 0.)
+      fraction = 0.;
+    else if (fraction > 0.9)
+      fraction = 0.9;
+    this->cpu_fraction_ = fraction;
+  }
+
   //! Check whether we are trying to run on GPU
 
   bool
@@ -678,7 +786,22 @@ public:
       return false;
     }
 
-    queue_.parallel_for(n, static_cast<F&&>(f), static_cast<Args&&>(args)...);
+    cs_lnum_t n_device = n;
+    if (cpu_fraction_ > 0.)
+      n_device = n - (cs_lnum_t)(n*cpu_fraction_);
+
+    if (n_device > 0)
+      queue_.parallel_for(n_device, f, args...);
+
+    /* Remaining (highest-numbered) portion on the host, overlapping
+       the asynchronous device launch above */
+
+    if (n_device < n) {
+#     pragma omp parallel for  if (n - n_device > CS_THR_MIN)
+      for (cs_lnum_t i = n_device; i < n; i++) {
+        f(i, args...);
+      }
+    }
 
     return true;
   }
@@ -758,7 +881,7 @@ public:
 
 };
 
-#endif  // __NVCC__ or SYCL
+#endif  // (__NVCC__ || __HIP__) or SYCL
 
 /*!
  * Context to group unused options and catch missing execution paths.
@@ -773,7 +896,7 @@ public:
   cs_void_context(void)
   {}
 
-#if !defined(__NVCC__)
+#if !defined(__NVCC__) && !defined(__HIP__)
 
   /* Fill-in for CUDA methods, so as to allow using these methods
      in final cs_dispatch_context even when CUDA is not available,
@@ -795,9 +918,9 @@ public:
   set_cuda_device([[maybe_unused]] int  device_id) {
   }
 
-#endif  // __NVCC__
+#endif  // ! __NVCC__ && ! __HIP__
 
-#if !defined(__NVCC__) && !defined(SYCL_LANGUAGE_VERSION)
+#if !defined(__NVCC__) && !defined(__HIP__) && !defined(SYCL_LANGUAGE_VERSION)
 
   /* Fill-in for device methods */
 
@@ -805,6 +928,10 @@ public:
   set_use_gpu([[maybe_unused]] bool  use_gpu) {
   }
 
+  void
+  set_hybrid_cpu_fraction([[maybe_unused]] double  fraction) {
+  }
+
   //! Check whether we are trying to run on GPU
 
   bool
@@ -828,7 +955,7 @@ public:
   wait(void) {
   }
 
-#endif  // ! __NVCC__ && ! SYCL_LANGUAGE_VERSION
+#endif  // ! __NVCC__ && ! __HIP__ && ! SYCL_LANGUAGE_VERSION
 
 public:
 
@@ -946,7 +1073,7 @@ public:
 /*----------------------------------------------------------------------------*/
 
 class cs_dispatch_context : public cs_combined_context<
-#if defined(__NVCC__) || defined(SYCL_LANGUAGE_VERSION)
+#if defined(__NVCC__) || defined(__HIP__) || defined(SYCL_LANGUAGE_VERSION)
   cs_device_context,
 #endif
   cs_host_context,
@@ -956,7 +1083,7 @@ class cs_dispatch_context : public cs_combined_context<
 
 private:
   using base_t = cs_combined_context<
-#if defined(__NVCC__) || defined(SYCL_LANGUAGE_VERSION)
+#if defined(__NVCC__) || defined(__HIP__) || defined(SYCL_LANGUAGE_VERSION)
   cs_device_context,
 #endif
   cs_host_context,
@@ -1010,7 +1137,8 @@ public:
  */
 /*----------------------------------------------------------------------------*/
 
-#ifdef __CUDA_ARCH__   // Test whether we are on GPU or CPU...
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)   \
+    // Test whether we are on GPU or CPU...
 
 template <typename T>
 __device__ static void __forceinline__
@@ -1019,7 +1147,7 @@ cs_dispatch_sum(T                       *dest,
                 cs_dispatch_sum_type_t   sum_type)
 {
   if (sum_type == CS_DISPATCH_SUM_ATOMIC) {
-#if 1
+#if !defined(__HIP_DEVICE_COMPILE__)  /* warp-match path, CUDA only */
     using sum_v = assembled_value<T>;
     sum_v v;
 
@@ -1088,7 +1216,8 @@ cs_dispatch_sum(T                       *dest,
  */
 /*----------------------------------------------------------------------------*/
 
-#ifdef __CUDA_ARCH__   // Test whether we are on GPU or CPU...
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)   \
+    // Test whether we are on GPU or CPU...
 
 template <size_t dim, typename T>
 __device__ static void __forceinline__
@@ -1102,7 +1231,7 @@ cs_dispatch_sum(T                       *dest,
     }
   }
   else if (sum_type == CS_DISPATCH_SUM_ATOMIC) {
-#if __CUDA_ARCH__ >= 700
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 700
     using sum_v = assembled_value<T, dim>;
     sum_v v;
 
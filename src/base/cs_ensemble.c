@@ -0,0 +1,361 @@
+/*============================================================================
+ * Ensemble execution mode for multiple instances of a same case.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * PLE library headers
+ *----------------------------------------------------------------------------*/
+
+#include <ple_coupling.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_coupling.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_ensemble.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_ensemble.c
+        Ensemble execution mode for multiple instances of a same case.
+
+  Ensemble members are run as separate instances of a single MPI job,
+  using the same mechanism as code-code couplings, so their time stepping
+  is kept in lockstep by the usual coupling synchronization
+  (\ref cs_coupling_sync_apps). This module identifies the members among
+  the applications of the coupling group and provides cross-member
+  reductions (ensemble mean and spread), as required for example by
+  ensemble-based atmospheric data assimilation.
+
+  All members must run the same case on the same number of ranks, so
+  that mesh partitioning, and thus the distribution of mesh-based
+  arrays, is identical across members.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+static int  _n_members = 0;   /* 0 if ensemble mode inactive */
+static int  _member_id = -1;
+
+#if defined(HAVE_MPI)
+
+/* Communicator grouping ranks of same intra-member rank across all
+   members, in member id order; as partitioning is identical across
+   members, reductions on this communicator operate element-wise on
+   matching mesh entities. */
+
+static MPI_Comm  _member_cross_comm = MPI_COMM_NULL;
+
+#endif
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate ensemble execution mode, identifying member instances
+ *        among the applications of the same MPI coupling group.
+ *
+ * Applications whose instance name starts with the given prefix are
+ * considered ensemble members; members are numbered in the order in which
+ * they appear in the coupling group. All members must run the same case
+ * on the same number of MPI ranks, so that mesh partitioning is identical
+ * across members.
+ *
+ * If the current application is not a member (for example a driver
+ * application sharing the same MPI job), this function simply returns,
+ * and ensemble mode remains inactive for it.
+ *
+ * \param[in]  member_prefix  common prefix of member instance names
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_ensemble_initialize(const char  *member_prefix)
+{
+#if defined(HAVE_MPI)
+
+  const ple_coupling_mpi_set_t *mpi_apps = cs_coupling_get_mpi_apps();
+
+  if (mpi_apps == NULL || member_prefix == NULL)
+    return;
+
+  const int n_apps = ple_coupling_mpi_set_n_apps(mpi_apps);
+  const int app_id = ple_coupling_mpi_set_get_app_id(mpi_apps);
+  const size_t p_len = strlen(member_prefix);
+
+  int n_members = 0, member_id = -1, member_n_ranks = -1;
+  int *member_root_rank;
+  BFT_MALLOC(member_root_rank, n_apps, int);
+
+  for (int i = 0; i < n_apps; i++) {
+    ple_coupling_mpi_set_info_t ai = ple_coupling_mpi_set_get_info(mpi_apps, i);
+
+    if (strncmp(ai.app_name, member_prefix, p_len) != 0)
+      continue;
+
+    if (i == app_id)
+      member_id = n_members;
+
+    if (member_n_ranks < 0)
+      member_n_ranks = ai.n_ranks;
+    else if (ai.n_ranks != member_n_ranks)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Ensemble member \"%s\" runs on %d ranks while previous "
+                  "members run on %d ranks;\n"
+                  "all members must use the same number of ranks so that "
+                  "mesh partitioning matches."),
+                ai.app_name, ai.n_ranks, member_n_ranks);
+
+    member_root_rank[n_members] = ai.root_rank;
+    n_members++;
+  }
+
+  /* A non-member application (such as a driver sharing the same MPI job)
+     does not participate in cross-member communicators. */
+
+  if (member_id < 0) {
+    BFT_FREE(member_root_rank);
+    return;
+  }
+
+  _n_members = n_members;
+  _member_id = member_id;
+
+  /* Build the cross-member communicator, grouping the ranks of same
+     intra-member rank of all members; the group-collective constructor
+     is used so that non-member applications are not involved. */
+
+  if (n_members > 1) {
+
+    const int l_rank = CS_MAX(cs_glob_rank_id, 0);
+
+    int *group_ranks;
+    BFT_MALLOC(group_ranks, n_members, int);
+    for (int i = 0; i < n_members; i++)
+      group_ranks[i] = member_root_rank[i] + l_rank;
+
+    MPI_Comm base_comm = ple_coupling_mpi_set_get_base_comm(mpi_apps);
+
+    MPI_Group base_group, cross_group;
+    MPI_Comm_group(base_comm, &base_group);
+    MPI_Group_incl(base_group, n_members, group_ranks, &cross_group);
+    MPI_Comm_create_group(base_comm, cross_group, l_rank,
+                          &_member_cross_comm);
+    MPI_Group_free(&cross_group);
+    MPI_Group_free(&base_group);
+
+    BFT_FREE(group_ranks);
+  }
+
+  BFT_FREE(member_root_rank);
+
+  if (cs_glob_rank_id < 1)
+    bft_printf
+      (_("\n"
+         "Ensemble execution mode:\n"
+         "------------------------\n\n"
+         "  number of members: %d\n"
+         "  local member id:   %d\n\n"),
+       _n_members, _member_id);
+
+#else
+
+  CS_UNUSED(member_prefix);
+
+#endif /* HAVE_MPI */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Finalize ensemble execution mode.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_ensemble_finalize(void)
+{
+#if defined(HAVE_MPI)
+  if (_member_cross_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&_member_cross_comm);
+#endif
+
+  _n_members = 0;
+  _member_id = -1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the number of ensemble members.
+ *
+ * \return  number of ensemble members, or 0 if ensemble mode is not active
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_ensemble_n_members(void)
+{
+  return _n_members;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the id of the current ensemble member.
+ *
+ * \return  id of the current member (0 to n_members - 1), or -1 if
+ *          ensemble mode is not active
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_ensemble_member_id(void)
+{
+  return _member_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the ensemble mean and optionally the ensemble spread
+ *        of a local array across all members.
+ *
+ * As mesh partitioning is identical across members, values are reduced
+ * element-wise over matching ranks of each member, so this may be used
+ * with any array based on mesh entities (cell values, interleaved
+ * multidimensional fields, ...).
+ *
+ * The spread is the unbiased standard deviation over members, and is
+ * zero for a single-member ensemble.
+ *
+ * If ensemble mode is not active, the mean is simply a copy of the local
+ * values, and the spread is zero.
+ *
+ * \param[in]   n_vals  local number of values
+ * \param[in]   vals    local values (size: n_vals)
+ * \param[out]  mean    ensemble mean (size: n_vals)
+ * \param[out]  spread  ensemble spread (size: n_vals), or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_ensemble_stats(cs_lnum_t        n_vals,
+                  const cs_real_t  vals[],
+                  cs_real_t        mean[],
+                  cs_real_t        spread[])
+{
+#if defined(HAVE_MPI)
+
+  if (_n_members > 1) {
+
+    MPI_Allreduce(vals, mean, n_vals, CS_MPI_REAL, MPI_SUM,
+                  _member_cross_comm);
+
+#   pragma omp parallel for if (n_vals > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_vals; i++)
+      mean[i] /= _n_members;
+
+    if (spread != NULL) {
+
+      cs_real_t *sq_dev;
+      BFT_MALLOC(sq_dev, n_vals, cs_real_t);
+
+#     pragma omp parallel for if (n_vals > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_vals; i++) {
+        cs_real_t d = vals[i] - mean[i];
+        sq_dev[i] = d*d;
+      }
+
+      MPI_Allreduce(sq_dev, spread, n_vals, CS_MPI_REAL, MPI_SUM,
+                    _member_cross_comm);
+
+      BFT_FREE(sq_dev);
+
+#     pragma omp parallel for if (n_vals > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_vals; i++)
+        spread[i] = sqrt(spread[i] / (_n_members - 1));
+
+    }
+
+    return;
+  }
+
+#endif /* HAVE_MPI */
+
+  memcpy(mean, vals, n_vals*sizeof(cs_real_t));
+  if (spread != NULL) {
+#   pragma omp parallel for if (n_vals > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_vals; i++)
+      spread[i] = 0.;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,139 @@
+#ifndef __CS_ENSEMBLE_H__
+#define __CS_ENSEMBLE_H__
+
+/*============================================================================
+ * Ensemble execution mode for multiple instances of a same case.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_base.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate ensemble execution mode, identifying member instances
+ *        among the applications of the same MPI coupling group.
+ *
+ * Applications whose instance name starts with the given prefix are
+ * considered ensemble members; members are numbered in the order in which
+ * they appear in the coupling group. All members must run the same case
+ * on the same number of MPI ranks, so that mesh partitioning is identical
+ * across members.
+ *
+ * If the current application is not a member (for example a driver
+ * application sharing the same MPI job), this function simply returns,
+ * and ensemble mode remains inactive for it.
+ *
+ * \param[in]  member_prefix  common prefix of member instance names
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_ensemble_initialize(const char  *member_prefix);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Finalize ensemble execution mode.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_ensemble_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the number of ensemble members.
+ *
+ * \return  number of ensemble members, or 0 if ensemble mode is not active
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_ensemble_n_members(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the id of the current ensemble member.
+ *
+ * \return  id of the current member (0 to n_members - 1), or -1 if
+ *          ensemble mode is not active
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_ensemble_member_id(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the ensemble mean and optionally the ensemble spread
+ *        of a local array across all members.
+ *
+ * As mesh partitioning is identical across members, values are reduced
+ * element-wise over matching ranks of each member, so this may be used
+ * with any array based on mesh entities (cell values, interleaved
+ * multidimensional fields, ...).
+ *
+ * The spread is the unbiased standard deviation over members, and is
+ * zero for a single-member ensemble.
+ *
+ * If ensemble mode is not active, the mean is simply a copy of the local
+ * values, and the spread is zero.
+ *
+ * \param[in]   n_vals  local number of values
+ * \param[in]   vals    local values (size: n_vals)
+ * \param[out]  mean    ensemble mean (size: n_vals)
+ * \param[out]  spread  ensemble spread (size: n_vals), or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_ensemble_stats(cs_lnum_t        n_vals,
+                  const cs_real_t  vals[],
+                  cs_real_t        mean[],
+                  cs_real_t        spread[]);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_ENSEMBLE_H__ */
@@ -46,10 +46,12 @@
 #include "bft_error.h"
 #include "bft_printf.h"
 
+#include "cs_base_accel.h"
 #include "cs_log.h"
 #include "cs_map.h"
 #include "cs_mesh_location.h"
 #include "cs_parall.h"
+#include "cs_time_step.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -203,6 +205,20 @@ typedef struct {
 
 } cs_field_key_val_t;
 
+/* Pool for grouped allocation of field values */
+
+typedef struct {
+
+  int         location_id;   /* Associated mesh location */
+  int         dim;           /* Field dimension */
+
+  cs_lnum_t   block_size;    /* Size of one value array (n_elts * dim) */
+  int         n_blocks;      /* Number of value arrays in pool */
+
+  cs_real_t  *buf;           /* Associated contiguous buffer */
+
+} _field_pool_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -214,6 +230,57 @@ static int  _n_fields_max = 0;
 static cs_field_t  **_fields = NULL;
 static cs_map_name_to_id_t  *_field_map = NULL;
 
+/* Host/device synchronization state, indexed by field id
+   (fields start in the host-dirty state, as values are initialized
+   on the host side), and associated transfer statistics */
+
+static cs_field_sync_state_t  *_sync_state = NULL;
+
+static unsigned long long  _n_h2d_transfers = 0;
+static unsigned long long  _n_d2h_transfers = 0;
+static unsigned long long  _h2d_transfer_bytes = 0;
+static unsigned long long  _d2h_transfer_bytes = 0;
+
+/* Optional grouped (pooled) allocation of field values: owned values of
+   fields of the same location and dimension are allocated from one
+   contiguous buffer, in increasing field id order, so whole groups may
+   be handled with single large operations (checkpoint writes,
+   host/device transfers, ...) rather than one per field array. */
+
+static bool            _use_field_pools = false;
+static int             _n_field_pools = 0;
+static _field_pool_t  *_field_pools = NULL;
+
+/* Id of the pool each field's values were allocated from, indexed by
+   field id (-1 for non-pooled fields), or NULL */
+
+static int   _n_field_pool_ids = 0;
+static int  *_field_pool_id = NULL;
+
+/* Optional gradient caches, indexed by field id. When enabled for a
+   field, gradients computed through cs_field_gradient_* functions are
+   kept, at full or single (compressed) precision, and reused by later
+   calls with the same parameters in the same time step, so that only
+   the first consumer of a given gradient pays its computation. */
+
+typedef struct {
+
+  bool        enabled;   /* cache values for matching field ? */
+  bool        full;      /* cache at full rather than single precision ? */
+
+  float      *buf;       /* packed gradient values, or NULL */
+  cs_real_t  *buf_r;     /* full precision gradient values, or NULL */
+  cs_lnum_t   size;      /* allocated number of values */
+
+  int         nt_cur;    /* time step at last update, or -1 if invalid */
+  bool        prev;      /* based on previous time step values */
+  int         inc;       /* "inc" flag at last update */
+
+} _grad_cache_t;
+
+static int             _n_grad_caches = 0;
+static _grad_cache_t  *_grad_caches = NULL;
+
 /* Key definitions */
 
 static int  _n_keys = 0;
@@ -380,6 +447,28 @@ cs_f_field_get_label(int           f_id,
  * Private function definitions
  *============================================================================*/
 
+#if defined(HAVE_ACCEL)
+
+/*----------------------------------------------------------------------------
+ * Compute the size in bytes of a field's current value array.
+ *
+ * parameters:
+ *   f <-- pointer to field structure
+ *
+ * returns:
+ *   size in bytes of f->val, including halo values.
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_field_val_bytes(const cs_field_t  *f)
+{
+  const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
+
+  return (size_t)(n_elts[2]) * f->dim * sizeof(cs_real_t);
+}
+
+#endif /* defined(HAVE_ACCEL) */
+
 /*----------------------------------------------------------------------------
  * Create a field descriptor.
  *
@@ -451,8 +540,11 @@ _field_create(const char   *name,
       _n_fields_max *= 2;
     BFT_REALLOC(_fields, _n_fields_max, cs_field_t *);
     BFT_REALLOC(_key_vals, _n_keys_max*_n_fields_max, cs_field_key_val_t);
+    BFT_REALLOC(_sync_state, _n_fields_max, cs_field_sync_state_t);
   }
 
+  _sync_state[field_id] = CS_FIELD_SYNC_STATE_HOST_DIRTY;
+
   /* Allocate fields descriptor block if necessary
      (to reduce fragmentation and improve locality of field
      descriptors, they are allocated in blocks) */
@@ -547,6 +639,144 @@ _add_val(cs_lnum_t   n_elts,
   return val;
 }
 
+/*----------------------------------------------------------------------------
+ * Return the id of the field value pool matching a given mesh location
+ * and dimension, adding it if not already present.
+ *
+ * parameters:
+ *   location_id <-- associated mesh location id
+ *   dim         <-- associated field dimension
+ *
+ * returns:
+ *   id of matching pool
+ *----------------------------------------------------------------------------*/
+
+static int
+_find_or_add_pool(int  location_id,
+                  int  dim)
+{
+  int p_id;
+
+  /* Pools whose buffer is already allocated are full, so a new pool
+     is required for matching fields defined since */
+
+  for (p_id = 0; p_id < _n_field_pools; p_id++) {
+    if (   _field_pools[p_id].location_id == location_id
+        && _field_pools[p_id].dim == dim
+        && _field_pools[p_id].buf == NULL)
+      return p_id;
+  }
+
+  BFT_REALLOC(_field_pools, _n_field_pools+1, _field_pool_t);
+
+  _field_pool_t *p = _field_pools + _n_field_pools;
+
+  p->location_id = location_id;
+  p->dim = dim;
+  p->block_size = 0;
+  p->n_blocks = 0;
+  p->buf = NULL;
+
+  _n_field_pools += 1;
+
+  return p_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Allocate values of all owner fields not yet allocated using per
+ * (location, dimension) pools.
+ *
+ * Within each pool, value arrays are assigned in order of increasing
+ * field id, with current values preceding previous time values, so the
+ * layout is stable for a given field definition sequence.
+ *----------------------------------------------------------------------------*/
+
+static void
+_allocate_values_pooled(void)
+{
+  const int i_start = _n_field_pool_ids;
+
+  if (_n_fields > _n_field_pool_ids) {
+    BFT_REALLOC(_field_pool_id, _n_fields, int);
+    _n_field_pool_ids = _n_fields;
+  }
+
+  /* Count value arrays per (location, dimension) group; fields already
+     handled by a previous call keep their pool assignment */
+
+  for (int i = i_start; i < _n_fields; i++) {
+    cs_field_t *f = _fields[i];
+    _field_pool_id[i] = -1;
+    if (f->is_owner == false || f->val != NULL)
+      continue;
+    int p_id = _find_or_add_pool(f->location_id, f->dim);
+    _field_pools[p_id].n_blocks += f->n_time_vals;
+    _field_pool_id[i] = p_id;
+  }
+
+  /* Allocate and initialize pool buffers (see _add_val regarding
+     first-touch initialization) */
+
+  for (int p_id = 0; p_id < _n_field_pools; p_id++) {
+
+    _field_pool_t *p = _field_pools + p_id;
+
+    if (p->buf != NULL)  /* pool from a previous call, already assigned */
+      continue;
+
+    const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(p->location_id);
+    p->block_size = n_elts[2] * (cs_lnum_t)(p->dim);
+
+    CS_MALLOC_HD(p->buf, p->block_size*p->n_blocks, cs_real_t, cs_alloc_mode);
+
+    const cs_lnum_t _n_vals = p->block_size*p->n_blocks;
+#   pragma omp parallel for if (_n_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < _n_vals; ii++)
+      p->buf[ii] = 0.0;
+
+    /* Assign blocks in order of increasing field id */
+
+    cs_lnum_t shift = 0;
+
+    for (int i = 0; i < _n_fields; i++) {
+      cs_field_t *f = _fields[i];
+      if (_field_pool_id[i] != p_id)
+        continue;
+      for (int ii = 0; ii < f->n_time_vals; ii++) {
+        f->vals[ii] = p->buf + shift;
+        shift += p->block_size;
+      }
+      f->val = f->vals[0];
+      if (f->n_time_vals > 1)
+        f->val_pre = f->vals[1];
+    }
+
+    assert(shift == p->block_size*p->n_blocks);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Indicate if a given field's values were allocated from a pool.
+ *
+ * parameters:
+ *   f <-- pointer to field structure
+ *
+ * returns:
+ *   true if the field's values belong to a pool, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_field_is_pooled(const cs_field_t  *f)
+{
+  if (_field_pool_id != NULL && f->id < _n_field_pool_ids) {
+    if (_field_pool_id[f->id] > -1)
+      return true;
+  }
+
+  return false;
+}
+
 /*----------------------------------------------------------------------------
  * Find an id matching a key or define a new key and associated id.
  *
@@ -733,6 +963,40 @@ _check_key(const cs_field_t  *f,
   return errcode;
 }
 
+/*----------------------------------------------------------------------------
+ * Return the gradient cache entry matching a given field id, creating
+ * and initializing new entries as required.
+ *
+ * parameters:
+ *   f_id <-- field id
+ *
+ * returns:
+ *   pointer to matching gradient cache entry
+ *----------------------------------------------------------------------------*/
+
+static _grad_cache_t *
+_grad_cache_ensure(int  f_id)
+{
+  if (f_id >= _n_grad_caches) {
+    int n_prev = _n_grad_caches;
+    _n_grad_caches = f_id + 1;
+    BFT_REALLOC(_grad_caches, _n_grad_caches, _grad_cache_t);
+    for (int i = n_prev; i < _n_grad_caches; i++) {
+      _grad_cache_t *gc = _grad_caches + i;
+      gc->enabled = false;
+      gc->full = false;
+      gc->buf = NULL;
+      gc->buf_r = NULL;
+      gc->size = 0;
+      gc->nt_cur = -1;
+      gc->prev = false;
+      gc->inc = 0;
+    }
+  }
+
+  return _grad_caches + f_id;
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -1800,6 +2064,12 @@ cs_field_set_n_time_vals(cs_field_t  *f,
   /* If allocation or mapping has already been done */
 
   if (f->val != NULL) {
+    if (_field_is_pooled(f))
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: field \"%s\" uses pooled value allocation, so its\n"
+                  "number of time values may not be modified once it is\n"
+                  "allocated."),
+                __func__, f->name);
     if (n_time_vals_ini > _n_time_vals) {
       assert(n_time_vals_ini == 2 && _n_time_vals == 1);
       if (f->is_owner)
@@ -1831,6 +2101,11 @@ cs_field_allocate_values(cs_field_t  *f)
 
   if (f->is_owner) {
 
+    /* Values allocated from a pool may not be reallocated individually */
+
+    if (f->val != NULL && _field_is_pooled(f))
+      return;
+
     const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
     int ii;
 
@@ -1865,6 +2140,11 @@ cs_field_map_values(cs_field_t   *f,
     return;
 
   if (f->is_owner) {
+    if (_field_is_pooled(f))
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: field \"%s\" uses pooled value allocation, so its\n"
+                  "values may not be remapped."),
+                __func__, f->name);
     BFT_FREE(f->val);
     BFT_FREE(f->val_pre);
     f->is_owner = false;
@@ -2275,6 +2555,265 @@ cs_field_allocate_gradient(cs_field_t  *f)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Enable or disable compressed gradient caching for a field.
+ *
+ * When enabled, gradients computed for this field through the
+ * \ref cs_field_gradient_scalar, \ref cs_field_gradient_vector, or
+ * \ref cs_field_gradient_tensor functions are kept quantized to single
+ * precision, and dequantized on demand by subsequent calls with the same
+ * parameters in the same time step, instead of being recomputed. This
+ * halves the memory cost relative to the full precision cache accessible
+ * through the field's "grad" member, at the cost of truncating the
+ * reused gradient values to single precision; it should not be combined
+ * with that cache for a same field.
+ *
+ * \param[in]  f       pointer to field structure
+ * \param[in]  enable  enable compressed gradient caching for this field ?
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_set_gradient_compression(const cs_field_t  *f,
+                                  bool               enable)
+{
+  assert(f != NULL);
+
+  _grad_cache_t *gc = _grad_cache_ensure(f->id);
+
+  gc->enabled = enable;
+  gc->full = false;
+
+  if (enable == false || gc->buf_r != NULL) {
+    BFT_FREE(gc->buf);
+    BFT_FREE(gc->buf_r);
+    gc->size = 0;
+    gc->nt_cur = -1;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Enable or disable full-precision gradient caching for a field.
+ *
+ * When enabled, the first gradient computed for this field through the
+ * \ref cs_field_gradient_scalar, \ref cs_field_gradient_vector, or
+ * \ref cs_field_gradient_tensor functions in a given time step is kept,
+ * and returned directly to subsequent calls with the same parameters in
+ * the same time step instead of being recomputed. The cached values are
+ * also invalidated when \ref cs_field_current_to_previous advances the
+ * field's state.
+ *
+ * This is useful for fields such as velocity whose gradient is requested
+ * by several independent consumers (turbulence, postprocessing, source
+ * terms) in a same time step. For a lower memory cost, at the price of
+ * truncation to single precision, see
+ * \ref cs_field_set_gradient_compression.
+ *
+ * \param[in]  f       pointer to field structure
+ * \param[in]  enable  enable gradient caching for this field ?
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_set_gradient_caching(const cs_field_t  *f,
+                              bool               enable)
+{
+  assert(f != NULL);
+
+  _grad_cache_t *gc = _grad_cache_ensure(f->id);
+
+  gc->enabled = enable;
+  gc->full = enable;
+
+  if (enable == false || gc->buf != NULL) {
+    BFT_FREE(gc->buf);
+    BFT_FREE(gc->buf_r);
+    gc->size = 0;
+    gc->nt_cur = -1;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Query whether compressed gradient caching is enabled for a field.
+ *
+ * \param[in]  f  pointer to field structure
+ *
+ * \return  true if compressed gradient caching is enabled for this field
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_field_get_gradient_compression(const cs_field_t  *f)
+{
+  assert(f != NULL);
+
+  if (f->id < _n_grad_caches)
+    return (   _grad_caches[f->id].enabled
+            && _grad_caches[f->id].full == false);
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Query whether full-precision gradient caching is enabled for
+ *         a field.
+ *
+ * \param[in]  f  pointer to field structure
+ *
+ * \return  true if full-precision gradient caching is enabled for this field
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_field_get_gradient_caching(const cs_field_t  *f)
+{
+  assert(f != NULL);
+
+  if (f->id < _n_grad_caches)
+    return (_grad_caches[f->id].enabled && _grad_caches[f->id].full);
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Dequantize a field's compressed gradient cache if available.
+ *
+ * The cache is considered available if compressed gradient caching is
+ * enabled for the field, and the cached values were computed during the
+ * current time step with matching parameters, for the current mesh size.
+ *
+ * \param[in]   f               pointer to field structure
+ * \param[in]   use_previous_t  based on previous time step values ?
+ * \param[in]   inc             if 0, gradient of increment
+ * \param[out]  grad            gradient values (size 3*dim per element)
+ *
+ * \return  true if the gradient was restored from the cache
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_field_gradient_cache_retrieve(const cs_field_t  *f,
+                                 bool               use_previous_t,
+                                 int                inc,
+                                 cs_real_t         *grad)
+{
+  assert(f != NULL);
+
+  if (f->id >= _n_grad_caches)
+    return false;
+
+  _grad_cache_t *gc = _grad_caches + f->id;
+
+  const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
+  const cs_lnum_t n_vals = n_elts[2] * 3*f->dim;
+
+  if (   gc->enabled == false
+      || gc->nt_cur != cs_glob_time_step->nt_cur
+      || gc->prev != use_previous_t
+      || gc->inc != inc
+      || gc->size != n_vals)
+    return false;
+
+  if (gc->full) {
+
+    if (gc->buf_r == NULL)
+      return false;
+
+    const cs_real_t *buf_r = gc->buf_r;
+
+#   pragma omp parallel for if (n_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+      grad[ii] = buf_r[ii];
+
+  }
+  else {
+
+    if (gc->buf == NULL)
+      return false;
+
+    const float *buf = gc->buf;
+
+#   pragma omp parallel for if (n_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+      grad[ii] = buf[ii];
+
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Quantize gradient values into a field's compressed cache.
+ *
+ * This is a no-op if compressed gradient caching is not enabled for
+ * the field (see \ref cs_field_set_gradient_compression).
+ *
+ * \param[in]  f               pointer to field structure
+ * \param[in]  use_previous_t  based on previous time step values ?
+ * \param[in]  inc             if 0, gradient of increment
+ * \param[in]  grad            gradient values (size 3*dim per element)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_update(const cs_field_t  *f,
+                               bool               use_previous_t,
+                               int                inc,
+                               const cs_real_t   *grad)
+{
+  assert(f != NULL);
+
+  if (f->id >= _n_grad_caches)
+    return;
+
+  _grad_cache_t *gc = _grad_caches + f->id;
+
+  if (gc->enabled == false)
+    return;
+
+  const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
+  const cs_lnum_t n_vals = n_elts[2] * 3*f->dim;
+
+  if (gc->full) {
+
+    if (gc->size != n_vals) {
+      BFT_REALLOC(gc->buf_r, n_vals, cs_real_t);
+      gc->size = n_vals;
+    }
+
+    cs_real_t *buf_r = gc->buf_r;
+
+#   pragma omp parallel for if (n_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+      buf_r[ii] = grad[ii];
+
+  }
+  else {
+
+    if (gc->size != n_vals) {
+      BFT_REALLOC(gc->buf, n_vals, float);
+      gc->size = n_vals;
+    }
+
+    float *buf = gc->buf;
+
+#   pragma omp parallel for if (n_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+      buf[ii] = grad[ii];
+
+  }
+
+  gc->nt_cur = cs_glob_time_step->nt_cur;
+  gc->prev = use_previous_t;
+  gc->inc = inc;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Set current field values to the given constant.
@@ -2316,6 +2855,12 @@ cs_field_current_to_previous(cs_field_t  *f)
 {
   assert(f != NULL);
 
+  /* The field's state advances, so any cached gradient based on the
+     current values is invalidated */
+
+  if (f->id < _n_grad_caches)
+    _grad_caches[f->id].nt_cur = -1;
+
   if (f->n_time_vals > 1) {
 
     const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
@@ -2363,6 +2908,160 @@ cs_field_current_to_previous(cs_field_t  *f)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Mark a field's current values as modified on the host.
+ *
+ * Any matching device copy is considered outdated, and will be updated
+ * at the next call to \ref cs_field_sync_h2d.
+ *
+ * \param[in, out]  f  pointer to field structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_set_host_dirty(cs_field_t  *f)
+{
+  assert(f != NULL);
+
+  _sync_state[f->id] = CS_FIELD_SYNC_STATE_HOST_DIRTY;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Mark a field's current values as modified on the device.
+ *
+ * The host copy is considered outdated, and will be updated at the next
+ * call to \ref cs_field_sync_d2h.
+ *
+ * \param[in, out]  f  pointer to field structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_set_device_dirty(cs_field_t  *f)
+{
+  assert(f != NULL);
+
+  _sync_state[f->id] = CS_FIELD_SYNC_STATE_DEVICE_DIRTY;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update a field's device values from the host if needed.
+ *
+ * No data is moved unless the field was marked as modified on the host
+ * (using \ref cs_field_set_host_dirty) since the last synchronization,
+ * so this may be called before each device-side access at no cost when
+ * values are already up to date.
+ *
+ * If the field's values are not associated with device memory, only the
+ * synchronization state is updated.
+ *
+ * \param[in, out]  f  pointer to field structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_sync_h2d(cs_field_t  *f)
+{
+  assert(f != NULL);
+
+  if (_sync_state[f->id] != CS_FIELD_SYNC_STATE_HOST_DIRTY)
+    return;
+
+#if defined(HAVE_ACCEL)
+  if (cs_check_device_ptr(f->val) != CS_ALLOC_HOST) {
+    cs_sync_h2d(f->val);
+    _n_h2d_transfers += 1;
+    _h2d_transfer_bytes += _field_val_bytes(f);
+  }
+#endif
+
+  _sync_state[f->id] = CS_FIELD_SYNC_STATE_SYNC;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update a field's host values from the device if needed.
+ *
+ * No data is moved unless the field was marked as modified on the device
+ * (using \ref cs_field_set_device_dirty) since the last synchronization,
+ * so this may be called before each host-side access at no cost when
+ * values are already up to date.
+ *
+ * If the field's values are not associated with device memory, only the
+ * synchronization state is updated.
+ *
+ * \param[in, out]  f  pointer to field structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_sync_d2h(cs_field_t  *f)
+{
+  assert(f != NULL);
+
+  if (_sync_state[f->id] != CS_FIELD_SYNC_STATE_DEVICE_DIRTY)
+    return;
+
+#if defined(HAVE_ACCEL)
+  if (cs_check_device_ptr(f->val) != CS_ALLOC_HOST) {
+    cs_sync_d2h(f->val);
+    _n_d2h_transfers += 1;
+    _d2h_transfer_bytes += _field_val_bytes(f);
+  }
+#endif
+
+  _sync_state[f->id] = CS_FIELD_SYNC_STATE_SYNC;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return a field's current host/device synchronization state.
+ *
+ * \param[in]  f  pointer to field structure
+ *
+ * \return  synchronization state of the field's current values
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_field_sync_state_t
+cs_field_get_sync_state(const cs_field_t  *f)
+{
+  assert(f != NULL);
+
+  return _sync_state[f->id];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log and reset host/device field transfer statistics.
+ *
+ * Counters are cumulative since the last call to this function, so
+ * calling it at the end of each time step provides per-step transfer
+ * volumes.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_log_sync_stats(void)
+{
+  if (_n_h2d_transfers + _n_d2h_transfers > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Field host/device value transfers:\n"
+                    "  host to device: %llu (%llu bytes)\n"
+                    "  device to host: %llu (%llu bytes)\n"),
+                  _n_h2d_transfers, _h2d_transfer_bytes,
+                  _n_d2h_transfers, _d2h_transfer_bytes);
+
+  _n_h2d_transfers = 0;
+  _n_d2h_transfers = 0;
+  _h2d_transfer_bytes = 0;
+  _d2h_transfer_bytes = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Destroy all defined fields.
@@ -2377,8 +3076,14 @@ cs_field_destroy_all(void)
     if (f->is_owner) {
       if (f->vals != NULL) {
         int ii;
-        for (ii = 0; ii < f->n_time_vals; ii++)
-          BFT_FREE(f->vals[ii]);
+        if (_field_is_pooled(f)) {  /* freed with associated pool below */
+          for (ii = 0; ii < f->n_time_vals; ii++)
+            f->vals[ii] = NULL;
+        }
+        else {
+          for (ii = 0; ii < f->n_time_vals; ii++)
+            BFT_FREE(f->vals[ii]);
+        }
       }
     }
     BFT_FREE(f->vals);
@@ -2415,6 +3120,28 @@ cs_field_destroy_all(void)
 
   BFT_FREE(_key_vals);
 
+  BFT_FREE(_sync_state);
+
+  for (int i = 0; i < _n_grad_caches; i++) {
+    BFT_FREE(_grad_caches[i].buf);
+    BFT_FREE(_grad_caches[i].buf_r);
+  }
+  BFT_FREE(_grad_caches);
+  _n_grad_caches = 0;
+
+  for (int i = 0; i < _n_field_pools; i++)
+    CS_FREE_HD(_field_pools[i].buf);
+  BFT_FREE(_field_pools);
+  _n_field_pools = 0;
+
+  BFT_FREE(_field_pool_id);
+  _n_field_pool_ids = 0;
+
+  _n_h2d_transfers = 0;
+  _n_d2h_transfers = 0;
+  _h2d_transfer_bytes = 0;
+  _d2h_transfer_bytes = 0;
+
   _n_fields = 0;
   _n_fields_max = 0;
 }
@@ -2435,6 +3162,9 @@ cs_field_allocate_or_map_all(void)
 {
   int i;
 
+  if (_use_field_pools)
+    _allocate_values_pooled();
+
   for (i = 0; i < _n_fields; i++) {
     cs_field_t  *f = _fields[i];
     if (f->is_owner)
@@ -2449,6 +3179,106 @@ cs_field_allocate_or_map_all(void)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate pooled allocation of field values.
+ *
+ * When active, \ref cs_field_allocate_or_map_all allocates the values of
+ * owner fields sharing the same mesh location and dimension from a single
+ * contiguous buffer, assigned in order of increasing field id (with
+ * current values preceding previous time values for a given field).
+ *
+ * This allows handling whole groups of fields with single large
+ * operations (such as checkpoint writes or host/device transfers)
+ * instead of one operation per field array, and must be set before
+ * fields are allocated.
+ *
+ * Pooled fields may not be remapped (\ref cs_field_map_values), and
+ * their number of time values may not be modified once allocated.
+ *
+ * \param[in]  enable  true to activate pooled allocation
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_set_pooled_allocation(bool  enable)
+{
+  cs_base_check_bool(&enable);
+
+  _use_field_pools = enable;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether pooled allocation of field values is active.
+ *
+ * \return  true if pooled allocation is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_field_pooled_allocation(void)
+{
+  return _use_field_pools;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the number of field value pools.
+ *
+ * \return  number of field value pools
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_field_n_value_pools(void)
+{
+  return _n_field_pools;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return a pointer to the buffer of a given field value pool.
+ *
+ * The buffer contains n_blocks arrays of block_size values each,
+ * assigned to the matching owner fields in order of increasing field id,
+ * with current values preceding previous time values for a given field.
+ *
+ * \param[in]   pool_id      pool id (0 to cs_field_n_value_pools() - 1)
+ * \param[out]  location_id  associated mesh location id, or NULL
+ * \param[out]  dim          associated field dimension, or NULL
+ * \param[out]  n_blocks     number of value arrays in pool, or NULL
+ * \param[out]  block_size   size of one value array, or NULL
+ *
+ * \return  pointer to pool buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_real_t *
+cs_field_value_pool(int         pool_id,
+                    int        *location_id,
+                    int        *dim,
+                    int        *n_blocks,
+                    cs_lnum_t  *block_size)
+{
+  if (pool_id < 0 || pool_id >= _n_field_pools)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Field value pool with id %d is not defined."), pool_id);
+
+  const _field_pool_t *p = _field_pools + pool_id;
+
+  if (location_id != NULL)
+    *location_id = p->location_id;
+  if (dim != NULL)
+    *dim = p->dim;
+  if (n_blocks != NULL)
+    *n_blocks = p->n_blocks;
+  if (block_size != NULL)
+    *block_size = p->block_size;
+
+  return p->buf;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return a pointer to a field based on its id.
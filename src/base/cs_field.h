@@ -98,6 +98,19 @@ typedef enum {
 
 } cs_field_error_type_t;
 
+/* Field host/device synchronization states */
+/*------------------------------------------*/
+
+typedef enum {
+
+  CS_FIELD_SYNC_STATE_SYNC,          /* host and device values up to date */
+  CS_FIELD_SYNC_STATE_HOST_DIRTY,    /* host values modified since last
+                                        synchronization */
+  CS_FIELD_SYNC_STATE_DEVICE_DIRTY   /* device values modified since last
+                                        synchronization */
+
+} cs_field_sync_state_t;
+
 /*! Field boundary condition descriptor (for variables) */
 /*------------------------------------------------------*/
 
@@ -412,6 +425,119 @@ cs_field_init_bc_coeffs(cs_field_t  *f);
 void
 cs_field_allocate_gradient(cs_field_t  *f);
 
+/*----------------------------------------------------------------------------
+ * Enable or disable compressed gradient caching for a field.
+ *
+ * When enabled, gradients computed for this field through the
+ * cs_field_gradient_* functions are kept quantized to single precision,
+ * and dequantized on demand by subsequent calls with the same parameters
+ * in the same time step, instead of being recomputed. This halves the
+ * memory cost relative to the full precision cache accessible through
+ * the field's "grad" member, at the cost of truncating the reused
+ * gradient values to single precision; it should not be combined with
+ * that cache for a same field.
+ *
+ * parameters:
+ *   f      <-- pointer to field structure
+ *   enable <-- enable compressed gradient caching for this field ?
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_set_gradient_compression(const cs_field_t  *f,
+                                  bool               enable);
+
+/*----------------------------------------------------------------------------
+ * Query whether compressed gradient caching is enabled for a field.
+ *
+ * parameters:
+ *   f <-- pointer to field structure
+ *
+ * returns:
+ *   true if compressed gradient caching is enabled for this field
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_field_get_gradient_compression(const cs_field_t  *f);
+
+/*----------------------------------------------------------------------------
+ * Enable or disable full-precision gradient caching for a field.
+ *
+ * When enabled, the first gradient computed for this field through the
+ * cs_field_gradient_* functions in a given time step is kept, and
+ * returned directly to subsequent calls with the same parameters in the
+ * same time step instead of being recomputed. The cached values are also
+ * invalidated when cs_field_current_to_previous advances the field's
+ * state.
+ *
+ * This is useful for fields such as velocity whose gradient is requested
+ * by several independent consumers (turbulence, postprocessing, source
+ * terms) in a same time step. For a lower memory cost, at the price of
+ * truncation to single precision, see cs_field_set_gradient_compression.
+ *
+ * parameters:
+ *   f      <-- pointer to field structure
+ *   enable <-- enable gradient caching for this field ?
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_set_gradient_caching(const cs_field_t  *f,
+                              bool               enable);
+
+/*----------------------------------------------------------------------------
+ * Query whether full-precision gradient caching is enabled for a field.
+ *
+ * parameters:
+ *   f <-- pointer to field structure
+ *
+ * returns:
+ *   true if full-precision gradient caching is enabled for this field
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_field_get_gradient_caching(const cs_field_t  *f);
+
+/*----------------------------------------------------------------------------
+ * Dequantize a field's compressed gradient cache if available.
+ *
+ * The cache is considered available if compressed gradient caching is
+ * enabled for the field, and the cached values were computed during the
+ * current time step with matching parameters, for the current mesh size.
+ *
+ * parameters:
+ *   f              <-- pointer to field structure
+ *   use_previous_t <-- based on previous time step values ?
+ *   inc            <-- if 0, gradient of increment
+ *   grad           --> gradient values (size 3*dim per element)
+ *
+ * returns:
+ *   true if the gradient was restored from the cache
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_field_gradient_cache_retrieve(const cs_field_t  *f,
+                                 bool               use_previous_t,
+                                 int                inc,
+                                 cs_real_t         *grad);
+
+/*----------------------------------------------------------------------------
+ * Quantize gradient values into a field's compressed cache.
+ *
+ * This is a no-op if compressed gradient caching is not enabled for
+ * the field (see cs_field_set_gradient_compression).
+ *
+ * parameters:
+ *   f              <-- pointer to field structure
+ *   use_previous_t <-- based on previous time step values ?
+ *   inc            <-- if 0, gradient of increment
+ *   grad           <-- gradient values (size 3*dim per element)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_update(const cs_field_t  *f,
+                               bool               use_previous_t,
+                               int                inc,
+                               const cs_real_t   *grad);
+
 /*----------------------------------------------------------------------------
  * Set current field values to the given constant.
  *
@@ -437,6 +563,80 @@ cs_field_set_values(cs_field_t  *f,
 void
 cs_field_current_to_previous(cs_field_t  *f);
 
+/*----------------------------------------------------------------------------
+ * Mark a field's current values as modified on the host.
+ *
+ * Any matching device copy is considered outdated, and will be updated
+ * at the next call to cs_field_sync_h2d.
+ *
+ * parameters:
+ *   f <-> pointer to field structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_set_host_dirty(cs_field_t  *f);
+
+/*----------------------------------------------------------------------------
+ * Mark a field's current values as modified on the device.
+ *
+ * The host copy is considered outdated, and will be updated at the next
+ * call to cs_field_sync_d2h.
+ *
+ * parameters:
+ *   f <-> pointer to field structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_set_device_dirty(cs_field_t  *f);
+
+/*----------------------------------------------------------------------------
+ * Update a field's device values from the host if needed.
+ *
+ * No data is moved unless the field was marked as modified on the host
+ * since the last synchronization.
+ *
+ * parameters:
+ *   f <-> pointer to field structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_sync_h2d(cs_field_t  *f);
+
+/*----------------------------------------------------------------------------
+ * Update a field's host values from the device if needed.
+ *
+ * No data is moved unless the field was marked as modified on the device
+ * since the last synchronization.
+ *
+ * parameters:
+ *   f <-> pointer to field structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_sync_d2h(cs_field_t  *f);
+
+/*----------------------------------------------------------------------------
+ * Return a field's current host/device synchronization state.
+ *
+ * parameters:
+ *   f <-- pointer to field structure
+ *
+ * returns:
+ *   synchronization state of the field's current values
+ *----------------------------------------------------------------------------*/
+
+cs_field_sync_state_t
+cs_field_get_sync_state(const cs_field_t  *f);
+
+/*----------------------------------------------------------------------------
+ * Log and reset host/device field transfer statistics.
+ *
+ * Counters are cumulative since the last call to this function.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_log_sync_stats(void);
+
 /*----------------------------------------------------------------------------
  * Destroy all defined fields.
  *----------------------------------------------------------------------------*/
@@ -456,6 +656,74 @@ cs_field_destroy_all(void);
 void
 cs_field_allocate_or_map_all(void);
 
+/*----------------------------------------------------------------------------
+ * Activate or deactivate pooled allocation of field values.
+ *
+ * When active, cs_field_allocate_or_map_all allocates the values of
+ * owner fields sharing the same mesh location and dimension from a single
+ * contiguous buffer, assigned in order of increasing field id (with
+ * current values preceding previous time values for a given field).
+ *
+ * This allows handling whole groups of fields with single large
+ * operations (such as checkpoint writes or host/device transfers)
+ * instead of one operation per field array, and must be set before
+ * fields are allocated.
+ *
+ * Pooled fields may not be remapped (cs_field_map_values), and their
+ * number of time values may not be modified once allocated.
+ *
+ * parameters:
+ *   enable <-- true to activate pooled allocation
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_set_pooled_allocation(bool  enable);
+
+/*----------------------------------------------------------------------------
+ * Indicate whether pooled allocation of field values is active.
+ *
+ * returns:
+ *   true if pooled allocation is active, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_field_pooled_allocation(void);
+
+/*----------------------------------------------------------------------------
+ * Return the number of field value pools.
+ *
+ * returns:
+ *   number of field value pools
+ *----------------------------------------------------------------------------*/
+
+int
+cs_field_n_value_pools(void);
+
+/*----------------------------------------------------------------------------
+ * Return a pointer to the buffer of a given field value pool.
+ *
+ * The buffer contains n_blocks arrays of block_size values each,
+ * assigned to the matching owner fields in order of increasing field id,
+ * with current values preceding previous time values for a given field.
+ *
+ * parameters:
+ *   pool_id     <-- pool id (0 to cs_field_n_value_pools() - 1)
+ *   location_id --> associated mesh location id, or NULL
+ *   dim         --> associated field dimension, or NULL
+ *   n_blocks    --> number of value arrays in pool, or NULL
+ *   block_size  --> size of one value array, or NULL
+ *
+ * returns:
+ *   pointer to pool buffer
+ *----------------------------------------------------------------------------*/
+
+cs_real_t *
+cs_field_value_pool(int         pool_id,
+                    int        *location_id,
+                    int        *dim,
+                    int        *n_blocks,
+                    cs_lnum_t  *block_size);
+
 /*----------------------------------------------------------------------------
  * Return a pointer to a field based on its id.
  *
@@ -472,6 +472,10 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                          int                        inc,
                          cs_real_3_t      *restrict grad)
 {
+  if (cs_field_gradient_cache_retrieve(f, use_previous_t, inc,
+                                       (cs_real_t *)grad))
+    return;
+
   cs_halo_type_t halo_type = CS_HALO_STANDARD;
   cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
 
@@ -558,6 +562,9 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                      c_weight,
                      cpl, /* internal coupling */
                      grad);
+
+  cs_field_gradient_cache_update(f, use_previous_t, inc,
+                                 (const cs_real_t *)grad);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -756,6 +763,10 @@ cs_field_gradient_vector(const cs_field_t          *f,
                          int                        inc,
                          cs_real_33_t     *restrict grad)
 {
+  if (cs_field_gradient_cache_retrieve(f, use_previous_t, inc,
+                                       (cs_real_t *)grad))
+    return;
+
   cs_halo_type_t halo_type = CS_HALO_STANDARD;
   cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
 
@@ -833,6 +844,9 @@ cs_field_gradient_vector(const cs_field_t          *f,
                      c_weight,
                      cpl,
                      grad);
+
+  cs_field_gradient_cache_update(f, use_previous_t, inc,
+                                 (const cs_real_t *)grad);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -853,6 +867,10 @@ cs_field_gradient_tensor(const cs_field_t          *f,
                          int                        inc,
                          cs_real_63_t     *restrict grad)
 {
+  if (cs_field_gradient_cache_retrieve(f, use_previous_t, inc,
+                                       (cs_real_t *)grad))
+    return;
+
   cs_halo_type_t halo_type = CS_HALO_STANDARD;
   cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
 
@@ -902,6 +920,9 @@ cs_field_gradient_tensor(const cs_field_t          *f,
                      bc_coeffs_ts,
                      var,
                      grad);
+
+  cs_field_gradient_cache_update(f, use_previous_t, inc,
+                                 (const cs_real_t *)grad);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1552,6 +1573,101 @@ cs_field_synchronize(cs_field_t      *f,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start synchronization of parallel and periodic field values.
+ *
+ * Values at interface cells are packed into the halo send buffer and the
+ * MPI exchange is started immediately, so the caller may overlap further
+ * (interior) computation with the communication before calling
+ * \ref cs_field_synchronize_finish.
+ *
+ * This function currently only updates fields based on
+ * CS_MESH_LOCATION_CELLS.
+ *
+ * \param[in, out]   f           pointer to field
+ * \param[in]        halo_type   halo type
+ *
+ * \return  halo state to pass to \ref cs_field_synchronize_finish,
+ *          or NULL if no synchronization is needed
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_state_t *
+cs_field_synchronize_start(cs_field_t      *f,
+                           cs_halo_type_t   halo_type)
+{
+  cs_halo_state_t *hs = NULL;
+
+  if (f->location_id == CS_MESH_LOCATION_CELLS) {
+
+    const cs_halo_t *halo = cs_glob_mesh->halo;
+
+    if (halo != NULL) {
+
+      hs = cs_halo_state_get_default();
+
+      cs_halo_sync_pack(halo,
+                        halo_type,
+                        CS_REAL_TYPE,
+                        f->dim,
+                        f->val,
+                        NULL,
+                        hs);
+
+      cs_halo_sync_start(halo, f->val, hs);
+
+    }
+
+  }
+
+  return hs;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Finish synchronization of parallel and periodic field values.
+ *
+ * This function waits for the exchange started by
+ * \ref cs_field_synchronize_start, then handles periodicity of rotation
+ * for strided fields.
+ *
+ * \param[in, out]   f           pointer to field
+ * \param[in]        halo_type   halo type
+ * \param[in, out]   hs          halo state returned by
+ *                               \ref cs_field_synchronize_start
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_synchronize_finish(cs_field_t       *f,
+                            cs_halo_type_t    halo_type,
+                            cs_halo_state_t  *hs)
+{
+  if (hs == NULL)
+    return;
+
+  const cs_halo_t *halo = cs_glob_mesh->halo;
+
+  cs_halo_sync_wait(halo, f->val, hs);
+
+  if (f->dim > 1 && cs_glob_mesh->n_init_perio > 0) {
+    switch(f->dim) {
+    case 9:
+      cs_halo_perio_sync_var_tens(halo, halo_type, f->val);
+      break;
+    case 6:
+      cs_halo_perio_sync_var_sym_tens(halo, halo_type, f->val);
+      break;
+    case 3:
+      cs_halo_perio_sync_var_vect(halo, halo_type, f->val, 3);
+      break;
+    default:
+      break;
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
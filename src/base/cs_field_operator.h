@@ -34,6 +34,7 @@
 #include "cs_defs.h"
 #include "cs_field.h"
 #include "cs_gradient.h"
+#include "cs_halo.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -281,6 +282,50 @@ void
 cs_field_synchronize(cs_field_t      *f,
                      cs_halo_type_t   halo_type);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start synchronization of parallel and periodic field values.
+ *
+ * Values at interface cells are packed into the halo send buffer and the
+ * MPI exchange is started immediately, so the caller may overlap further
+ * (interior) computation with the communication before calling
+ * \ref cs_field_synchronize_finish.
+ *
+ * This function currently only updates fields based on
+ * CS_MESH_LOCATION_CELLS.
+ *
+ * \param[in, out]   f           pointer to field
+ * \param[in]        halo_type   halo type
+ *
+ * \return  halo state to pass to \ref cs_field_synchronize_finish,
+ *          or NULL if no synchronization is needed
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_state_t *
+cs_field_synchronize_start(cs_field_t      *f,
+                           cs_halo_type_t   halo_type);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Finish synchronization of parallel and periodic field values.
+ *
+ * This function waits for the exchange started by
+ * \ref cs_field_synchronize_start, then handles periodicity of rotation
+ * for strided fields.
+ *
+ * \param[in, out]   f           pointer to field
+ * \param[in]        halo_type   halo type
+ * \param[in, out]   hs          halo state returned by
+ *                               \ref cs_field_synchronize_start
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_synchronize_finish(cs_field_t       *f,
+                            cs_halo_type_t    halo_type,
+                            cs_halo_state_t  *hs);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -135,14 +135,17 @@ void
 cs_fp_exception_disable_trap(void)
 {
 #if defined(CS_FPE_TRAP)
-  if (_fenv_save == 0) {
-    if (fegetenv(&_fenv_old) == 0) {
-      _fenv_save += 1;
-      fedisableexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
+  #pragma omp critical(cs_fp_exception)
+  {
+    if (_fenv_save == 0) {
+      if (fegetenv(&_fenv_old) == 0) {
+        _fenv_save += 1;
+        fedisableexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
+      }
     }
+    else
+      _fenv_save += 1;
   }
-  else
-    _fenv_save += 1;
 #endif
 }
 
@@ -156,10 +159,13 @@ void
 cs_fp_exception_restore_trap(void)
 {
 #if defined(CS_FPE_TRAP)
-  if (_fenv_save) {
-    _fenv_save -= 1;
-    if (_fenv_save == 0)
-      fesetenv(&_fenv_old);
+  #pragma omp critical(cs_fp_exception)
+  {
+    if (_fenv_save) {
+      _fenv_save -= 1;
+      if (_fenv_save == 0)
+        fesetenv(&_fenv_old);
+    }
   }
 #endif
 }
@@ -47,7 +47,9 @@
 #if defined(HAVE_CUDA)
 #include "cs_base_cuda.h"
 #endif
+#include "cs_log.h"
 #include "cs_order.h"
+#include "cs_timer.h"
 
 #include "cs_interface.h"
 #include "cs_rank_neighbors.h"
@@ -64,6 +66,14 @@
 #include "cs_halo_cuda.h"
 #endif
 
+#if defined(HAVE_NCCL)
+#if defined(HAVE_RCCL)
+#include <rccl/rccl.h>
+#else
+#include <nccl.h>
+#endif
+#endif
+
 /*----------------------------------------------------------------------------*/
 
 BEGIN_C_DECLS
@@ -97,6 +107,30 @@ BEGIN_C_DECLS
  * Local type definitions
  *============================================================================*/
 
+#if defined(HAVE_MPI)
+
+/* Persistent exchange channel, allowing reuse of MPI persistent requests
+   for repeated synchronizations of a same field layout
+   (see cs_halo_set_use_persistent). A channel matches only if the halo,
+   data layout, and send/receive addresses are unchanged. */
+
+typedef struct {
+
+  const cs_halo_t  *halo;          /* Associated halo */
+  cs_datatype_t     data_type;     /* Datatype */
+  int               stride;        /* Number of values per location */
+  cs_halo_type_t    sync_mode;     /* Standard or extended */
+  const void       *send_buffer;   /* Matching packed send buffer */
+  const void       *dest;          /* Matching receive destination */
+
+  int               local_rank_id; /* Id of halo for own rank, or -1 */
+  int               n_requests;    /* Number of persistent requests */
+  MPI_Request      *request;       /* Persistent requests (receives, sends) */
+
+} _halo_channel_t;
+
+#endif /* defined(HAVE_MPI) */
+
 /* Structure to maintain halo exchange state */
 
 struct _cs_halo_state_t {
@@ -105,6 +139,9 @@ struct _cs_halo_state_t {
 
   cs_halo_type_t  sync_mode;      /* Standard or extended */
   cs_datatype_t   data_type;      /* Datatype */
+  cs_datatype_t   wire_type;      /* Datatype on the wire; may be reduced
+                                     relative to data_type to halve
+                                     exchanged bytes */
   int             stride;         /* Number of values per location */
 
   cs_alloc_mode_t var_location;   /* Allocation info for exchanged variable */
@@ -134,10 +171,36 @@ struct _cs_halo_state_t {
 
   MPI_Win       win;              /* MPI-3 RMA window */
 
+  int              n_channels;    /* Number of persistent channels */
+  int              channel_id;    /* Channel used by current exchange, or -1 */
+  _halo_channel_t *channel;       /* Persistent channels */
+
+#if defined(HAVE_NCCL)
+  bool             nccl_active;   /* Current exchange uses NCCL */
+#endif
+
 #endif
 
 };
 
+/* Anticipated (prefetched) halo exchange, started ahead of the matching
+   synchronization call (see cs_halo_sync_prefetch). Exchanges are keyed
+   on the destination array, so a standard cs_halo_sync call for that
+   array completes an exchange already in flight instead of starting
+   a new one. */
+
+typedef struct {
+
+  const cs_halo_t  *halo;       /* Associated halo, or nullptr if slot free */
+  void             *val;        /* Destination array */
+  cs_halo_type_t    sync_mode;  /* Standard or extended */
+  cs_datatype_t     data_type;  /* Datatype */
+  int               stride;     /* Number of values per location */
+
+  cs_halo_state_t  *hs;         /* Dedicated state (kept for reuse) */
+
+} _halo_prefetch_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -156,12 +219,48 @@ static cs_alloc_mode_t _halo_buffer_alloc_mode = CS_ALLOC_HOST_DEVICE_PINNED;
 /* Should we use barriers after posting receives ? */
 static int _halo_use_barrier = false;
 
+/* Should we use persistent exchange channels for repeated
+   synchronizations of a same field layout ? */
+static bool _halo_use_persistent = false;
+
 /* Default halo state handler */
 static cs_halo_state_t *_halo_state = nullptr;
 
+/* Anticipated halo exchanges in flight */
+static int _halo_prefetch_size = 0;
+static _halo_prefetch_t *_halo_prefetch = nullptr;
+
+/* Call counters and timers for halo exchange profiling
+   (see cs_halo_log_finalize): 0: pack; 1: exchange completion (wait) */
+
+static unsigned long long  _halo_sync_n_calls = 0;
+static unsigned long long  _halo_sync_send_bytes = 0;
+static cs_timer_counter_t  _halo_sync_timers[2] = {{0}, {0}};
+
 /* Halo communications mode */
 static cs_halo_comm_mode_t _halo_comm_mode = CS_HALO_COMM_P2P;
 
+/* Should real-valued exchanges be reduced to single precision on the wire
+   (with full-precision endpoints)? Set per call site, typically bracketing
+   synchronizations whose ghost values tolerate reduced precision. */
+static bool _halo_reduce_real = false;
+
+#if defined(HAVE_NCCL)
+
+/* NCCL (or RCCL) communicator matching cs_glob_mpi_comm and associated
+   device stream, created on first use when CS_HALO_COMM_NCCL is selected */
+
+#if defined(HAVE_RCCL)
+typedef hipStream_t _halo_device_stream_t;
+#else
+typedef cudaStream_t _halo_device_stream_t;
+#endif
+
+static ncclComm_t             _halo_nccl_comm = nullptr;
+static _halo_device_stream_t  _halo_nccl_stream = nullptr;
+
+#endif /* defined(HAVE_NCCL) */
+
 END_C_DECLS
 
 /*============================================================================
@@ -206,6 +305,50 @@ _order_int_test(const int  list[],
     return 0;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return id of in-flight anticipated exchange for a given array.
+ *
+ * \param[in]  halo  pointer to halo structure
+ * \param[in]  val   pointer to destination array
+ *
+ * \return  id of matching slot, or -1 if no exchange is in flight
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_prefetch_id(const cs_halo_t  *halo,
+             const void       *val)
+{
+  for (int i = 0; i < _halo_prefetch_size; i++) {
+    if (_halo_prefetch[i].halo == halo && _halo_prefetch[i].val == val)
+      return i;
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete an in-flight anticipated exchange and free its slot.
+ *
+ * The associated state is kept for reuse by later prefetches.
+ *
+ * \param[in]  id  id of prefetch slot
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_prefetch_complete(int  id)
+{
+  _halo_prefetch_t *p = _halo_prefetch + id;
+
+  cs_halo_sync_wait(p->halo, p->val, p->hs);
+
+  p->halo = nullptr;
+  p->val = nullptr;
+}
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -236,6 +379,174 @@ _update_requests(const cs_halo_t  *halo,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Free persistent requests associated with a given channel.
+ *
+ * parameters:
+ *   c <-> pointer to channel structure.
+ *---------------------------------------------------------------------------*/
+
+static void
+_channel_free_requests(_halo_channel_t  *c)
+{
+  for (int i = 0; i < c->n_requests; i++)
+    MPI_Request_free(c->request + i);
+
+  BFT_FREE(c->request);
+  c->n_requests = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Drop persistent channels referencing a given halo from a halo state.
+ *
+ * This should be called before destroying a halo, so that inactive
+ * persistent requests do not outlive the structures they reference.
+ *
+ * parameters:
+ *   hs   <-> pointer to halo state structure, or null
+ *   halo <-- pointer to cs_halo_t structure.
+ *---------------------------------------------------------------------------*/
+
+static void
+_halo_state_drop_channels(cs_halo_state_t  *hs,
+                          const cs_halo_t  *halo)
+{
+  if (hs == nullptr)
+    return;
+
+  int j = 0;
+  for (int i = 0; i < hs->n_channels; i++) {
+    if (hs->channel[i].halo == halo)
+      _channel_free_requests(hs->channel + i);
+    else {
+      if (j < i)
+        hs->channel[j] = hs->channel[i];
+      j++;
+    }
+  }
+  hs->n_channels = j;
+}
+
+/*----------------------------------------------------------------------------
+ * Obtain a persistent exchange channel matching the current exchange,
+ * building it on first use.
+ *
+ * The caller is responsible for checking that persistent channels are
+ * usable for the current exchange (host-resident data, P2P mode).
+ *
+ * parameters:
+ *   halo <-- pointer to cs_halo_t structure.
+ *   hs   <-> pointer to halo state structure.
+ *   val  <-> pointer to variable value array
+ *
+ * returns:
+ *   id of matching channel in halo state
+ *---------------------------------------------------------------------------*/
+
+static int
+_get_persistent_channel(const cs_halo_t  *halo,
+                        cs_halo_state_t  *hs,
+                        void             *val)
+{
+  cs_lnum_t stride = hs->stride;
+  size_t elt_size = cs_datatype_size[hs->data_type] * stride;
+  size_t n_loc_elts = halo->n_local_elts;
+
+  unsigned char *restrict _val_dest
+    = (unsigned char *)val + n_loc_elts*elt_size;
+
+  /* Search for a matching channel */
+
+  for (int i = 0; i < hs->n_channels; i++) {
+    _halo_channel_t *c = hs->channel + i;
+    if (   c->halo == halo
+        && c->data_type == hs->data_type
+        && c->stride == stride
+        && c->sync_mode == hs->sync_mode
+        && c->send_buffer == hs->send_buffer_cur
+        && c->dest == _val_dest)
+      return i;
+  }
+
+  /* Build a new channel */
+
+  int c_id = hs->n_channels;
+  hs->n_channels += 1;
+  BFT_REALLOC(hs->channel, hs->n_channels, _halo_channel_t);
+
+  _halo_channel_t *c = hs->channel + c_id;
+
+  c->halo = halo;
+  c->data_type = hs->data_type;
+  c->stride = stride;
+  c->sync_mode = hs->sync_mode;
+  c->send_buffer = hs->send_buffer_cur;
+  c->dest = _val_dest;
+
+  c->local_rank_id = -1;
+  c->n_requests = 0;
+  BFT_MALLOC(c->request, halo->n_c_domains*2, MPI_Request);
+
+  cs_lnum_t end_shift = (hs->sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+
+  MPI_Datatype mpi_datatype = cs_datatype_to_mpi[hs->data_type];
+
+  int request_count = 0;
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  /* Persistent receives from distant ranks */
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t length = (  halo->index[2*rank_id + end_shift]
+                        - halo->index[2*rank_id]) * stride;
+
+    if (halo->c_domain_rank[rank_id] != local_rank) {
+
+      if (length > 0) {
+        size_t start = (size_t)(halo->index[2*rank_id]);
+        unsigned char *dest = _val_dest + start*elt_size;
+
+        MPI_Recv_init(dest,
+                      length,
+                      mpi_datatype,
+                      halo->c_domain_rank[rank_id],
+                      halo->c_domain_rank[rank_id],
+                      cs_glob_mpi_comm,
+                      &(c->request[request_count++]));
+      }
+
+    }
+    else
+      c->local_rank_id = rank_id;
+  }
+
+  /* Persistent sends to distant ranks */
+
+  unsigned char *buffer = (unsigned char *)(hs->send_buffer_cur);
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t start = halo->send_index[2*rank_id]*elt_size;
+    cs_lnum_t length = (  halo->send_index[2*rank_id + end_shift]
+                        - halo->send_index[2*rank_id]);
+
+    if (halo->c_domain_rank[rank_id] != local_rank && length > 0)
+      MPI_Send_init(buffer + start,
+                    length*stride,
+                    mpi_datatype,
+                    halo->c_domain_rank[rank_id],
+                    local_rank,
+                    cs_glob_mpi_comm,
+                    &(c->request[request_count++]));
+
+  }
+
+  c->n_requests = request_count;
+
+  return c_id;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Exchange send shift in send buffer for one-sided get.
@@ -475,6 +786,172 @@ _halo_sync_complete_one_sided(const cs_halo_t  *halo,
 }
 
 #endif /* (MPI_VERSION >= 3) */
+
+#if defined(HAVE_NCCL)
+
+/*----------------------------------------------------------------------------
+ * Check return code of a NCCL call, aborting in case of error.
+ *
+ * parameters:
+ *   retcode <-- NCCL call return code
+ *---------------------------------------------------------------------------*/
+
+static inline void
+_nccl_check(ncclResult_t  retcode)
+{
+  if (retcode != ncclSuccess)
+    bft_error(__FILE__, __LINE__, 0, _("NCCL error: %s"),
+              ncclGetErrorString(retcode));
+}
+
+/*----------------------------------------------------------------------------
+ * Build NCCL communicator matching cs_glob_mpi_comm, on first use.
+ *---------------------------------------------------------------------------*/
+
+static void
+_halo_nccl_init(void)
+{
+  ncclUniqueId comm_id;
+
+  if (cs_glob_rank_id <= 0)
+    _nccl_check(ncclGetUniqueId(&comm_id));
+
+  MPI_Bcast(&comm_id, sizeof(ncclUniqueId), MPI_BYTE, 0, cs_glob_mpi_comm);
+
+  _nccl_check(ncclCommInitRank(&_halo_nccl_comm,
+                               cs_glob_n_ranks,
+                               comm_id,
+                               CS_MAX(cs_glob_rank_id, 0)));
+
+#if defined(HAVE_RCCL)
+  hipStreamCreate(&_halo_nccl_stream);
+#else
+  cudaStreamCreate(&_halo_nccl_stream);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Return NCCL datatype and element size multiplier matching a given datatype.
+ *
+ * Types with no direct NCCL equivalent are exchanged as bytes, with the
+ * multiplier set to the datatype size.
+ *
+ * parameters:
+ *   data_type <-- datatype
+ *   mult      --> element count multiplier
+ *
+ * returns:
+ *   matching NCCL datatype
+ *---------------------------------------------------------------------------*/
+
+static ncclDataType_t
+_nccl_datatype(cs_datatype_t   data_type,
+               size_t         *mult)
+{
+  *mult = 1;
+
+  switch (data_type) {
+  case CS_DOUBLE:
+    return ncclDouble;
+  case CS_FLOAT:
+    return ncclFloat;
+  case CS_INT32:
+    return ncclInt32;
+  case CS_INT64:
+    return ncclInt64;
+  case CS_UINT32:
+    return ncclUint32;
+  case CS_UINT64:
+    return ncclUint64;
+  default:
+    *mult = cs_datatype_size[data_type];
+    return ncclChar;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Launch halo synchronization using NCCL device-to-device communication.
+ *
+ * Send and receive operations for all neighbor ranks are grouped in a
+ * single NCCL group, so the library may batch them over NVLink or
+ * GPUDirect transports, without staging through the host.
+ *
+ * parameters:
+ *   halo <-- pointer to halo structure
+ *   val  <-> pointer to variable value array (device-resident)
+ *   hs   <-> pointer to halo state
+ *---------------------------------------------------------------------------*/
+
+static void
+_halo_sync_start_nccl(const cs_halo_t  *halo,
+                      void             *val,
+                      cs_halo_state_t  *hs)
+{
+  if (_halo_nccl_comm == nullptr)
+    _halo_nccl_init();
+
+  cs_lnum_t end_shift = (hs->sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+  cs_lnum_t stride = hs->stride;
+  size_t elt_size = cs_datatype_size[hs->data_type] * stride;
+  size_t n_loc_elts = halo->n_local_elts;
+
+  size_t mult = 1;
+  ncclDataType_t nccl_type = _nccl_datatype(hs->data_type, &mult);
+
+  unsigned char *restrict _val = (unsigned char *)val;
+  unsigned char *restrict _val_dest = _val + n_loc_elts*elt_size;
+
+  unsigned char *buffer
+    = (unsigned char *)cs_get_device_ptr(hs->send_buffer_cur);
+
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  _nccl_check(ncclGroupStart());
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    if (halo->c_domain_rank[rank_id] != local_rank) {
+
+      cs_lnum_t r_length = (  halo->index[2*rank_id + end_shift]
+                            - halo->index[2*rank_id]);
+
+      if (r_length > 0) {
+        size_t start = (size_t)(halo->index[2*rank_id]);
+        unsigned char *dest = _val_dest + start*elt_size;
+        _nccl_check(ncclRecv(dest,
+                             (size_t)r_length*stride*mult,
+                             nccl_type,
+                             halo->c_domain_rank[rank_id],
+                             _halo_nccl_comm,
+                             _halo_nccl_stream));
+      }
+
+      cs_lnum_t s_length = (  halo->send_index[2*rank_id + end_shift]
+                            - halo->send_index[2*rank_id]);
+
+      if (s_length > 0) {
+        size_t start = halo->send_index[2*rank_id]*elt_size;
+        _nccl_check(ncclSend(buffer + start,
+                             (size_t)s_length*stride*mult,
+                             nccl_type,
+                             halo->c_domain_rank[rank_id],
+                             _halo_nccl_comm,
+                             _halo_nccl_stream));
+      }
+
+    }
+    else
+      hs->local_rank_id = rank_id;
+
+  }
+
+  _nccl_check(ncclGroupEnd());
+
+  hs->nccl_active = true;
+}
+
+#endif /* defined(HAVE_NCCL) */
+
 #endif /* defined(HAVE_MPI) */
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -650,7 +1127,7 @@ cs_halo_create_complete(cs_halo_t  *halo)
   }
 
   /* Create group for one-sided communication */
-  if (_halo_comm_mode > CS_HALO_COMM_P2P) {
+  if (_halo_comm_mode == CS_HALO_COMM_RMA_GET) {
     const int local_rank = CS_MAX(cs_glob_rank_id, 0);
     int n_group_ranks = 0;
     int *group_ranks = nullptr;
@@ -736,6 +1213,29 @@ cs_halo_create_complete(cs_halo_t  *halo)
     _halo_state = cs_halo_state_create();
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Drop cached exchange state associated with a given halo.
+ *
+ * This should be called when a halo's indexes or element lists are
+ * modified in place, so that cached exchange state (such as persistent
+ * communication channels) matching the previous halo contents is not
+ * reused.
+ *
+ * \param[in]  halo  pointer to halo structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_drop_state(const cs_halo_t  *halo)
+{
+#if defined(HAVE_MPI)
+  _halo_state_drop_channels(_halo_state, halo);
+#else
+  CS_UNUSED(halo);
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create a halo structure, given a reference halo.
@@ -1081,7 +1581,18 @@ cs_halo_destroy(cs_halo_t  **halo)
 
   cs_halo_t  *_halo = *halo;
 
+  for (int i = 0; i < _halo_prefetch_size; i++) {
+    if (_halo_prefetch[i].halo == _halo)
+      _prefetch_complete(i);
+  }
+
 #if defined(HAVE_MPI)
+  _halo_state_drop_channels(_halo_state, _halo);
+  for (int i = 0; i < _halo_prefetch_size; i++) {
+    if (_halo_prefetch[i].hs != nullptr)
+      _halo_state_drop_channels(_halo_prefetch[i].hs, _halo);
+  }
+
   if (_halo->c_domain_group != MPI_GROUP_NULL)
     MPI_Group_free(&(_halo->c_domain_group));
 
@@ -1105,8 +1616,29 @@ cs_halo_destroy(cs_halo_t  **halo)
 
   /* Delete default state if no halo remains */
 
-  if (_n_halos == 0)
+  if (_n_halos == 0) {
     cs_halo_state_destroy(&_halo_state);
+
+    for (int i = 0; i < _halo_prefetch_size; i++) {
+      if (_halo_prefetch[i].hs != nullptr)
+        cs_halo_state_destroy(&(_halo_prefetch[i].hs));
+    }
+    BFT_FREE(_halo_prefetch);
+    _halo_prefetch_size = 0;
+
+#if defined(HAVE_NCCL)
+    if (_halo_nccl_comm != nullptr) {
+      ncclCommDestroy(_halo_nccl_comm);
+      _halo_nccl_comm = nullptr;
+#if defined(HAVE_RCCL)
+      hipStreamDestroy(_halo_nccl_stream);
+#else
+      cudaStreamDestroy(_halo_nccl_stream);
+#endif
+      _halo_nccl_stream = nullptr;
+    }
+#endif
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1126,6 +1658,7 @@ cs_halo_state_create(void)
   cs_halo_state_t hs_ini = {
     .sync_mode = CS_HALO_STANDARD,
     .data_type = CS_DATATYPE_NULL,
+    .wire_type = CS_DATATYPE_NULL,
     .stride = 0,
     .var_location = CS_ALLOC_HOST,
     .send_buffer_location = CS_ALLOC_HOST,
@@ -1141,7 +1674,15 @@ cs_halo_state_create(void)
     .request_size = 0,
     .request = nullptr,
     .status = nullptr,
-    .win = MPI_WIN_NULL
+    .win = MPI_WIN_NULL,
+    .n_channels = 0,
+    .channel_id = -1,
+    .channel = nullptr
+
+#if defined(HAVE_NCCL)
+    ,
+    .nccl_active = false
+#endif
 
 #endif
   };
@@ -1179,6 +1720,10 @@ cs_halo_state_destroy(cs_halo_state_t  **halo_state)
     CS_FREE_HD(hs->recv_buffer);
 
 #if defined(HAVE_MPI)
+    for (int i = 0; i < hs->n_channels; i++)
+      _channel_free_requests(hs->channel + i);
+    BFT_FREE(hs->channel);
+
     BFT_FREE(hs->request);
     BFT_FREE(hs->status);
 #endif
@@ -1460,9 +2005,20 @@ cs_halo_sync_pack_init_state(const cs_halo_t  *halo,
 
   _hs->sync_mode = sync_mode;
   _hs->data_type = data_type;
+  _hs->wire_type = data_type;
   _hs->stride = stride;
 
-  return _send_buffer;
+  /* Reduced-precision exchange is limited to host-based point-to-point
+     communication of double-precision reals; other modes handle the
+     send buffer outside this layer's control. */
+
+  if (   _halo_reduce_real
+      && data_type == CS_REAL_TYPE && sizeof(cs_real_t) == 8
+      && _halo_comm_mode == CS_HALO_COMM_P2P
+      && _halo_use_persistent == false)
+    _hs->wire_type = CS_FLOAT;
+
+  return _send_buffer;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1498,6 +2054,8 @@ cs_halo_sync_pack(const cs_halo_t  *halo,
   if (halo == nullptr)
     return;
 
+  cs_timer_t t0 = cs_timer_time();
+
   void *_send_buffer = cs_halo_sync_pack_init_state(halo,
                                                     sync_mode,
                                                     data_type,
@@ -1505,6 +2063,9 @@ cs_halo_sync_pack(const cs_halo_t  *halo,
                                                     send_buf,
                                                     hs);
 
+  const cs_datatype_t wire_type
+    = ((hs != nullptr) ? hs : _halo_state)->wire_type;
+
   const size_t block_size = halo->std_send_block_size;
   const cs_lnum_t *send_list = halo->send_list;
   const cs_lnum_t *send_blocks = nullptr;
@@ -1539,7 +2100,29 @@ cs_halo_sync_pack(const cs_halo_t  *halo,
         e_id = n_send;
     }
 
-    if (data_type == CS_REAL_TYPE) {
+    if (data_type == CS_REAL_TYPE && wire_type != data_type) {
+
+      /* Reduced-precision exchange: down-convert while packing */
+
+      float *buffer = (float *)_send_buffer;
+      cs_real_t *var = (cs_real_t *)val;
+
+      if (stride == 1) {
+        for (size_t i = s_id; i < e_id; i++)
+          buffer[i] = (float)var[send_list[i]];
+      }
+      else {
+        size_t _stride = stride;
+        for (size_t i = s_id; i < e_id; i++) {
+          size_t j_s = send_list[i]*_stride;
+          for (size_t k = 0; k < _stride; k++)
+            buffer[i*_stride + k] = (float)var[j_s + k];
+        }
+      }
+
+    }
+
+    else if (data_type == CS_REAL_TYPE) {
 
       cs_real_t *buffer = (cs_real_t *)_send_buffer;
       cs_real_t *var = (cs_real_t *)val;
@@ -1583,6 +2166,9 @@ cs_halo_sync_pack(const cs_halo_t  *halo,
     }
 
   } /* End of loop on blocks */
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(_halo_sync_timers, &t0, &t1);
 }
 
 #if defined(HAVE_ACCEL)
@@ -1630,6 +2216,10 @@ cs_halo_sync_pack_d(const cs_halo_t  *halo,
                                                  send_buf,
                                                  _hs);
 
+  /* Precision reduction is not handled on device paths */
+
+  _hs->wire_type = data_type;
+
 #if defined(HAVE_CUDA)
 
   void *val_host_ptr = cs_cuda_get_host_ptr(val);
@@ -1709,8 +2299,17 @@ cs_halo_sync_start(const cs_halo_t  *halo,
 
   cs_halo_state_t  *_hs = (hs != nullptr) ? hs : _halo_state;
 
+#if defined(HAVE_NCCL)
+  if (   _halo_comm_mode == CS_HALO_COMM_NCCL
+      && _hs->var_location > CS_ALLOC_HOST
+      && cs_glob_n_ranks > 1) {
+    _halo_sync_start_nccl(halo, val, _hs);
+    return;
+  }
+#endif
+
 #if (MPI_VERSION >= 3)
-  if (_halo_comm_mode > CS_HALO_COMM_P2P) {
+  if (_halo_comm_mode == CS_HALO_COMM_RMA_GET) {
     _halo_sync_start_one_sided(halo, val, _hs);
     return;
   }
@@ -1719,6 +2318,7 @@ cs_halo_sync_start(const cs_halo_t  *halo,
   cs_lnum_t end_shift = (_hs->sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
   cs_lnum_t stride = _hs->stride;
   size_t elt_size = cs_datatype_size[_hs->data_type] * stride;
+  size_t wire_elt_size = cs_datatype_size[_hs->wire_type] * stride;
   size_t n_loc_elts = halo->n_local_elts;
 
   unsigned char *restrict _val = (unsigned char *)val;
@@ -1769,9 +2369,31 @@ cs_halo_sync_start(const cs_halo_t  *halo,
 
 #if defined(HAVE_MPI)
 
+  /* Persistent-channel mode: repeated syncs of a same field layout
+     reduce to restarting already-built persistent requests. */
+
+  if (   _halo_use_persistent
+      && _hs->var_location == CS_ALLOC_HOST
+      && buffer == _hs->send_buffer_cur) {
+
+    int c_id = _get_persistent_channel(halo, _hs, val);
+    _halo_channel_t *c = _hs->channel + c_id;
+
+    if (c->n_requests > 0)
+      MPI_Startall(c->n_requests, c->request);
+
+    _hs->channel_id = c_id;
+    _hs->local_rank_id = c->local_rank_id;
+
+    return;
+  }
+
   _update_requests(halo, _hs);
 
-  MPI_Datatype mpi_datatype = cs_datatype_to_mpi[_hs->data_type];
+  /* With a reduced wire type, data is received packed at the head of the
+     ghost values area, and expanded in place at wait time */
+
+  MPI_Datatype mpi_datatype = cs_datatype_to_mpi[_hs->wire_type];
 
   int request_count = 0;
   const int local_rank = CS_MAX(cs_glob_rank_id, 0);
@@ -1787,7 +2409,7 @@ cs_halo_sync_start(const cs_halo_t  *halo,
 
       if (length > 0) {
         size_t start = (size_t)(halo->index[2*rank_id]);
-        unsigned char *dest = _val_dest + start*elt_size;
+        unsigned char *dest = _val_dest + start*wire_elt_size;
 
         MPI_Irecv(dest,
                   length*_hs->stride,
@@ -1812,7 +2434,7 @@ cs_halo_sync_start(const cs_halo_t  *halo,
 
   for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
-    cs_lnum_t start = halo->send_index[2*rank_id]*elt_size;
+    cs_lnum_t start = halo->send_index[2*rank_id]*wire_elt_size;
     cs_lnum_t length = (  halo->send_index[2*rank_id + end_shift]
                         - halo->send_index[2*rank_id]);
 
@@ -1871,8 +2493,42 @@ cs_halo_sync_wait(const cs_halo_t  *halo,
 
   cs_halo_state_t  *_hs = (hs != nullptr) ? hs : _halo_state;
 
+#if defined(HAVE_NCCL)
+
+  /* With NCCL, ghost values are received directly in the device-resident
+     array, so we only need to wait for the stream, then handle the
+     local (periodic) copy and cleanup. */
+
+  if (_hs->nccl_active) {
+
+#if defined(HAVE_RCCL)
+    hipStreamSynchronize(_halo_nccl_stream);
+#else
+    cudaStreamSynchronize(_halo_nccl_stream);
+#endif
+    _hs->nccl_active = false;
+
+    if (_hs->local_rank_id > -1) {
+      size_t elt_size = cs_datatype_size[_hs->data_type] * _hs->stride;
+      _sync_local(halo, _hs->local_rank_id, _hs->sync_mode, elt_size,
+                  _hs->var_location, _hs->send_buffer_cur, val);
+    }
+
+    _hs->sync_mode = CS_HALO_STANDARD;
+    _hs->data_type = CS_DATATYPE_NULL;
+    _hs->wire_type = CS_DATATYPE_NULL;
+    _hs->stride = 0;
+    _hs->send_buffer_cur = nullptr;
+    _hs->n_requests = 0;
+    _hs->local_rank_id  = -1;
+
+    return;
+  }
+
+#endif /* defined(HAVE_NCCL) */
+
 #if (MPI_VERSION >= 3)
-  if (_halo_comm_mode > CS_HALO_COMM_P2P) {
+  if (_halo_comm_mode == CS_HALO_COMM_RMA_GET) {
     _halo_sync_complete_one_sided(halo, val, _hs);
     return;
   }
@@ -1882,9 +2538,28 @@ cs_halo_sync_wait(const cs_halo_t  *halo,
 
   /* Wait for all exchanges */
 
-  if (_hs->n_requests > 0)
+  cs_timer_t t0 = cs_timer_time();
+
+  if (_hs->channel_id > -1) {
+    _halo_channel_t *c = _hs->channel + _hs->channel_id;
+    if (c->n_requests > 0)
+      MPI_Waitall(c->n_requests, c->request, MPI_STATUSES_IGNORE);
+    _hs->channel_id = -1;
+  }
+  else if (_hs->n_requests > 0)
     MPI_Waitall(_hs->n_requests, _hs->request, _hs->status);
 
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(_halo_sync_timers + 1, &t0, &t1);
+
+  _halo_sync_n_calls += 1;
+  {
+    int e_id = (_hs->sync_mode == CS_HALO_EXTENDED) ? 1 : 0;
+    size_t elt_size = cs_datatype_size[_hs->wire_type] * _hs->stride;
+    _halo_sync_send_bytes
+      += (unsigned long long)(halo->n_send_elts[e_id]) * elt_size;
+  }
+
 #endif /* defined(HAVE_MPI) */
 
 #if defined(HAVE_ACCEL)
@@ -1912,18 +2587,72 @@ cs_halo_sync_wait(const cs_halo_t  *halo,
 
 #endif /* defined(HAVE_ACCEL) */
 
+  /* With a reduced wire type, received values are packed at the head of
+     the ghost values area; expand them in place, processing sections in
+     decreasing element order so sources are read before being overwritten */
+
+  if (_hs->wire_type != _hs->data_type && _hs->data_type == CS_REAL_TYPE) {
+
+    const cs_lnum_t end_shift
+      = (_hs->sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+    const size_t stride = _hs->stride;
+
+    cs_real_t *ghost_d = (cs_real_t *)val + halo->n_local_elts*stride;
+    const float *ghost_w = (const float *)ghost_d;
+
+    for (int rank_id = halo->n_c_domains - 1; rank_id >= 0; rank_id--) {
+
+      if (rank_id == _hs->local_rank_id)
+        continue;
+
+      const cs_lnum_t s_id = halo->index[2*rank_id] * (cs_lnum_t)stride;
+      const cs_lnum_t e_id
+        = halo->index[2*rank_id + end_shift] * (cs_lnum_t)stride;
+
+      for (cs_lnum_t i = e_id - 1; i >= s_id; i--)
+        ghost_d[i] = (cs_real_t)ghost_w[i];
+
+    }
+
+  }
+
   /* Copy local values in case of periodicity */
 
   if (_hs->local_rank_id > -1) {
-    size_t elt_size = cs_datatype_size[_hs->data_type] * _hs->stride;
-    _sync_local(halo, _hs->local_rank_id, _hs->sync_mode, elt_size,
-                _hs->var_location, _hs->send_buffer_cur, val);
+
+    if (_hs->wire_type != _hs->data_type && _hs->data_type == CS_REAL_TYPE) {
+
+      const cs_lnum_t end_shift
+        = (_hs->sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+      const int lr = _hs->local_rank_id;
+      const size_t stride = _hs->stride;
+
+      const float *buffer = (const float *)_hs->send_buffer_cur;
+      cs_real_t *v
+        = (cs_real_t *)val
+          + (halo->n_local_elts + halo->index[2*lr])*stride;
+
+      const size_t start = halo->send_index[2*lr]*stride;
+      const size_t count = (  halo->send_index[2*lr + end_shift]
+                            - halo->send_index[2*lr])*stride;
+
+      for (size_t i = 0; i < count; i++)
+        v[i] = (cs_real_t)buffer[start + i];
+
+    }
+    else {
+      size_t elt_size = cs_datatype_size[_hs->data_type] * _hs->stride;
+      _sync_local(halo, _hs->local_rank_id, _hs->sync_mode, elt_size,
+                  _hs->var_location, _hs->send_buffer_cur, val);
+    }
+
   }
 
   /* Cleanup */
 
   _hs->sync_mode = CS_HALO_STANDARD;
   _hs->data_type = CS_DATATYPE_NULL;
+  _hs->wire_type = CS_DATATYPE_NULL;
   _hs->stride = 0;
   _hs->send_buffer_cur = nullptr;
   _hs->n_requests = 0;
@@ -1956,6 +2685,22 @@ cs_halo_sync(const cs_halo_t  *halo,
   if (halo == nullptr)
     return;
 
+  /* If a matching anticipated exchange is already in flight,
+     complete it rather than start a new one */
+
+  int p_id = _prefetch_id(halo, val);
+
+  if (p_id > -1) {
+    const _halo_prefetch_t *p = _halo_prefetch + p_id;
+    bool compatible = (   p->data_type == data_type
+                       && p->stride == stride
+                       && (   p->sync_mode == sync_mode
+                           || p->sync_mode == CS_HALO_EXTENDED));
+    _prefetch_complete(p_id);
+    if (compatible)
+      return;
+  }
+
   cs_halo_sync_pack(halo,
                     sync_mode,
                     data_type,
@@ -1969,6 +2714,399 @@ cs_halo_sync(const cs_halo_t  *halo,
   cs_halo_sync_wait(halo, val, nullptr);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start an anticipated halo exchange for an array whose local
+ *        values are final.
+ *
+ * The exchange is initiated immediately, using a dedicated exchange state,
+ * and progresses while the caller continues with unrelated work. It is
+ * completed either by a later call to \ref cs_halo_sync for the same array
+ * with compatible parameters (which then reduces to a simple wait), or by
+ * \ref cs_halo_sync_prefetch_wait. This allows overlapping communication
+ * of a known upcoming synchronization with intermediate computation,
+ * without modifying the downstream code doing that synchronization.
+ *
+ * Local values of the array must not be modified before the exchange
+ * is completed.
+ *
+ * \param[in]   halo        pointer to halo structure
+ * \param[in]   sync_mode   synchronization mode (standard or extended)
+ * \param[in]   data_type   data type
+ * \param[in]   stride      number of (interlaced) values by entity
+ * \param[in]   val         pointer to variable value array
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_prefetch(const cs_halo_t  *halo,
+                      cs_halo_type_t    sync_mode,
+                      cs_datatype_t     data_type,
+                      int               stride,
+                      void             *val)
+{
+  if (halo == nullptr)
+    return;
+
+  int id = _prefetch_id(halo, val);
+
+  if (id > -1) {
+    _halo_prefetch_t *p = _halo_prefetch + id;
+    if (   p->sync_mode == sync_mode
+        && p->data_type == data_type
+        && p->stride == stride)
+      return;
+    _prefetch_complete(id);  /* restart with new layout, reusing the slot */
+  }
+  else {
+    for (id = 0; id < _halo_prefetch_size; id++) {
+      if (_halo_prefetch[id].halo == nullptr)
+        break;
+    }
+  }
+
+  if (id >= _halo_prefetch_size) {
+    int n = _halo_prefetch_size + 4;
+    BFT_REALLOC(_halo_prefetch, n, _halo_prefetch_t);
+    for (int i = _halo_prefetch_size; i < n; i++) {
+      _halo_prefetch[i].halo = nullptr;
+      _halo_prefetch[i].val = nullptr;
+      _halo_prefetch[i].hs = nullptr;
+    }
+    _halo_prefetch_size = n;
+  }
+
+  _halo_prefetch_t *p = _halo_prefetch + id;
+
+  if (p->hs == nullptr)
+    p->hs = cs_halo_state_create();
+
+  p->halo = halo;
+  p->val = val;
+  p->sync_mode = sync_mode;
+  p->data_type = data_type;
+  p->stride = stride;
+
+  cs_halo_sync_pack(halo,
+                    sync_mode,
+                    data_type,
+                    stride,
+                    val,
+                    nullptr,
+                    p->hs);
+
+  cs_halo_sync_start(halo, val, p->hs);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete an anticipated halo exchange for a given array.
+ *
+ * If no exchange started by \ref cs_halo_sync_prefetch is in flight
+ * for this array, this function does nothing.
+ *
+ * \param[in]   halo  pointer to halo structure
+ * \param[in]   val   pointer to variable value array
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_prefetch_wait(const cs_halo_t  *halo,
+                           void             *val)
+{
+  if (halo == nullptr)
+    return;
+
+  int id = _prefetch_id(halo, val);
+
+  if (id > -1)
+    _prefetch_complete(id);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update multiple arrays of values in case of parallelism
+ *        or periodicity, using a single message per neighbor rank.
+ *
+ * All arrays must be associated with the same halo, and are packed
+ * in an interleaved manner into a single send buffer, so only one
+ * message is exchanged with each neighboring rank instead of one
+ * per array; this reduces latency and message count when many fields
+ * with the same exchange pattern are synchronized in sequence.
+ *
+ * As with \ref cs_halo_sync, values are copied as is, so rotational
+ * periodicity handling for vector and tensor fields remains the
+ * caller's responsibility.
+ *
+ * \param[in]   halo        pointer to halo structure
+ * \param[in]   sync_mode   synchronization mode (standard or extended)
+ * \param[in]   data_type   data type (common to all arrays)
+ * \param[in]   n_fields    number of arrays to synchronize
+ * \param[in]   stride      for each array, number of (interlaced) values
+ *                          by entity
+ * \param[in]   val         for each array, pointer to variable values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_batch(const cs_halo_t  *halo,
+                   cs_halo_type_t    sync_mode,
+                   cs_datatype_t     data_type,
+                   int               n_fields,
+                   const int         stride[],
+                   void             *val[])
+{
+  if (halo == nullptr || n_fields < 1)
+    return;
+
+  cs_halo_state_t  *_hs = _halo_state;
+
+  /* Offset (in values) of each field in an interleaved element block;
+     the combined blocks behave like a single field whose stride is the
+     sum of the field strides */
+
+  int s_sum = 0;
+  int s_shift[128];
+  assert(n_fields <= 128);
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+    s_shift[f_id] = s_sum;
+    s_sum += stride[f_id];
+  }
+
+  const size_t type_size = cs_datatype_size[data_type];
+  const size_t elt_size = type_size * s_sum;
+
+  unsigned char *send_buf
+    = (unsigned char *)cs_halo_sync_pack_init_state(halo,
+                                                    sync_mode,
+                                                    data_type,
+                                                    s_sum,
+                                                    nullptr,
+                                                    _hs);
+
+  /* Precision reduction is not handled on this path, which manages
+     its own exchange at the declared data type */
+
+  _hs->wire_type = data_type;
+
+  /* Pack all fields, interleaved by element (same blocking as
+     cs_halo_sync_pack, to allow threading) */
+
+  const size_t block_size = halo->std_send_block_size;
+  const cs_lnum_t *send_list = halo->send_list;
+  const cs_lnum_t *send_blocks = nullptr;
+
+  size_t n_send = 0, n_blocks = 0;
+
+  if (sync_mode == CS_HALO_STANDARD && halo->n_std_send_blocks > 0) {
+    n_send = halo->std_send_block_size * halo->n_std_send_blocks;
+    n_blocks = halo->n_std_send_blocks;
+    send_blocks = halo->std_send_blocks;
+  }
+  else {
+    n_send = halo->n_send_elts[1];
+    n_blocks = (n_send % block_size) ? n_send/block_size + 1 : n_send/block_size;
+  }
+
+  #pragma omp parallel for  if (n_send > CS_THR_MIN)
+  for (size_t b_id = 0; b_id < n_blocks; b_id++) {
+
+    size_t s_id, e_id;
+    if (send_blocks != nullptr) {
+      s_id = send_blocks[b_id*2];
+      e_id = send_blocks[b_id*2 + 1];
+    }
+    else {
+      s_id = b_id*block_size;
+      e_id = (b_id+1)*block_size;
+      if (e_id > n_send)
+        e_id = n_send;
+    }
+
+    for (int f_id = 0; f_id < n_fields; f_id++) {
+
+      const size_t _stride = stride[f_id];
+      const size_t _shift = s_shift[f_id];
+
+      if (data_type == CS_REAL_TYPE) {
+        cs_real_t *buffer = (cs_real_t *)send_buf;
+        const cs_real_t *var = (const cs_real_t *)val[f_id];
+        for (size_t i = s_id; i < e_id; i++) {
+          size_t j_s = send_list[i]*_stride;
+          for (size_t k = 0; k < _stride; k++)
+            buffer[i*s_sum + _shift + k] = var[j_s + k];
+        }
+      }
+      else {
+        unsigned char *buffer = send_buf;
+        const unsigned char *var = (const unsigned char *)val[f_id];
+        size_t f_size = type_size * _stride;
+        for (size_t i = s_id; i < e_id; i++) {
+          size_t i_s = i*elt_size + _shift*type_size;
+          size_t j_s = send_list[i]*f_size;
+          for (size_t k = 0; k < f_size; k++)
+            buffer[i_s + k] = var[j_s + k];
+        }
+      }
+
+    }
+
+  } /* End of loop on blocks */
+
+  /* Exchange interleaved blocks, with ghost values received in a
+     dense buffer (they cannot be received in place, as each element
+     block mixes all fields) */
+
+  cs_lnum_t end_shift = (sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+  int local_rank_id = -1;
+
+  size_t recv_size = halo->n_elts[CS_HALO_EXTENDED] * elt_size;
+  if (_hs->recv_buffer_size < recv_size) {
+    _hs->recv_buffer_size = recv_size;
+    CS_FREE_HD(_hs->recv_buffer);
+    CS_MALLOC_HD(_hs->recv_buffer, _hs->recv_buffer_size, unsigned char,
+                 CS_ALLOC_HOST_DEVICE_PINNED);
+  }
+  unsigned char *recv_buf = (unsigned char *)_hs->recv_buffer;
+
+#if defined(HAVE_MPI)
+
+  _update_requests(halo, _hs);
+
+  MPI_Datatype mpi_datatype = cs_datatype_to_mpi[data_type];
+
+  int request_count = 0;
+
+  /* Receive data from distant ranks */
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t length = (  halo->index[2*rank_id + end_shift]
+                        - halo->index[2*rank_id]);
+
+    if (halo->c_domain_rank[rank_id] != local_rank) {
+
+      if (length > 0)
+        MPI_Irecv(recv_buf + (size_t)(halo->index[2*rank_id])*elt_size,
+                  length*s_sum,
+                  mpi_datatype,
+                  halo->c_domain_rank[rank_id],
+                  halo->c_domain_rank[rank_id],
+                  cs_glob_mpi_comm,
+                  &(_hs->request[request_count++]));
+
+    }
+    else
+      local_rank_id = rank_id;
+  }
+
+  if (_halo_use_barrier)
+    MPI_Barrier(cs_glob_mpi_comm);
+
+  /* Send data to distant ranks */
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t start = halo->send_index[2*rank_id]*elt_size;
+    cs_lnum_t length = (  halo->send_index[2*rank_id + end_shift]
+                        - halo->send_index[2*rank_id]);
+
+    if (halo->c_domain_rank[rank_id] != local_rank && length > 0)
+      MPI_Isend(send_buf + start,
+                length*s_sum,
+                mpi_datatype,
+                halo->c_domain_rank[rank_id],
+                local_rank,
+                cs_glob_mpi_comm,
+                &(_hs->request[request_count++]));
+
+  }
+
+#else /* defined(HAVE_MPI) */
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    if (halo->c_domain_rank[rank_id] == local_rank)
+      local_rank_id = rank_id;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Copy local halo section (periodicity) while messages are in flight */
+
+  if (local_rank_id > -1) {
+
+    cs_lnum_t *recv_index = halo->index + 2*local_rank_id;
+    cs_lnum_t *send_index = halo->send_index + 2*local_rank_id;
+
+    cs_lnum_t length = recv_index[end_shift] - recv_index[0];
+
+    memcpy(recv_buf + (size_t)(recv_index[0])*elt_size,
+           send_buf + (size_t)(send_index[0])*elt_size,
+           (size_t)length*elt_size);
+
+  }
+
+#if defined(HAVE_MPI)
+
+  if (request_count > 0)
+    MPI_Waitall(request_count, _hs->request, _hs->status);
+
+#endif
+
+  /* Unpack ghost values to their respective arrays, by received
+     (per-rank) section so untouched extended sections are skipped */
+
+  const size_t n_loc_elts = halo->n_local_elts;
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    const cs_lnum_t r_start = halo->index[2*rank_id];
+    const cs_lnum_t r_length =   halo->index[2*rank_id + end_shift]
+                               - halo->index[2*rank_id];
+
+    #pragma omp parallel for  if (r_length*n_fields > CS_THR_MIN)
+    for (cs_lnum_t i = r_start; i < r_start + r_length; i++) {
+
+      for (int f_id = 0; f_id < n_fields; f_id++) {
+
+        const size_t _stride = stride[f_id];
+        const size_t _shift = s_shift[f_id];
+
+        if (data_type == CS_REAL_TYPE) {
+          const cs_real_t *buffer = (const cs_real_t *)recv_buf;
+          cs_real_t *var = (cs_real_t *)val[f_id];
+          size_t j_s = (n_loc_elts + i)*_stride;
+          for (size_t k = 0; k < _stride; k++)
+            var[j_s + k] = buffer[i*s_sum + _shift + k];
+        }
+        else {
+          const unsigned char *buffer = recv_buf;
+          unsigned char *var = (unsigned char *)val[f_id];
+          size_t f_size = type_size * _stride;
+          size_t i_s = i*elt_size + _shift*type_size;
+          size_t j_s = (n_loc_elts + i)*f_size;
+          for (size_t k = 0; k < f_size; k++)
+            var[j_s + k] = buffer[i_s + k];
+        }
+
+      }
+
+    }
+
+  }
+
+  /* Cleanup state (same as at the end of a regular exchange) */
+
+  _hs->sync_mode = CS_HALO_STANDARD;
+  _hs->data_type = CS_DATATYPE_NULL;
+  _hs->stride = 0;
+  _hs->send_buffer_cur = nullptr;
+  _hs->n_requests = 0;
+  _hs->local_rank_id = -1;
+}
+
 #if defined(HAVE_ACCEL)
 
 /*----------------------------------------------------------------------------*/
@@ -2138,6 +3276,79 @@ cs_halo_set_use_barrier(bool use_barrier)
   _halo_use_barrier = use_barrier;
 }
 
+/*----------------------------------------------------------------------------
+ * Return persistent channel usage flag.
+ *
+ * returns:
+ *   true if MPI persistent requests are reused for repeated
+ *   synchronizations of a same field layout, false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_persistent(void)
+{
+  return _halo_use_persistent;
+}
+
+/*----------------------------------------------------------------------------
+ * Set persistent channel usage flag.
+ *
+ * When this flag is set, halo exchanges of host-resident arrays build
+ * MPI persistent (MPI_Send_init/MPI_Recv_init) requests keyed by halo,
+ * datatype, stride, and buffer addresses, so repeated synchronizations
+ * of a same field layout reduce to an MPI_Startall/MPI_Waitall pair.
+ *
+ * parameters:
+ *   use_persistent <-- true if persistent requests should be reused for
+ *                      repeated synchronizations of a same field layout,
+ *                      false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_persistent(bool use_persistent)
+{
+  _halo_use_persistent = use_persistent;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * rief Get reduced-precision exchange flag.
+ *
+ * eturn  true if real-valued exchanges are reduced to single precision
+ *          on the wire, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_reduced_real_exchange(void)
+{
+  return _halo_reduce_real;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * rief Set reduced-precision exchange flag.
+ *
+ * When this flag is set, real-valued (double precision) halo exchanges are
+ * down-converted to single precision on the wire, halving exchanged bytes,
+ * with full-precision endpoint arrays. This only applies to host-based
+ * point-to-point exchanges; other communication modes ignore the flag.
+ *
+ * As the flag is checked when packing, it is intended to be set (and
+ * restored) per call site, bracketing synchronizations whose ghost values
+ * tolerate reduced precision, such as smoothing sweeps.
+ *
+ * \param[in]  reduce  true if real-valued exchanges should be reduced to
+ *                     single precision on the wire, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_set_reduced_real_exchange(bool reduce)
+{
+  _halo_reduce_real = reduce;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Get default communication mode for halo exchange.
@@ -2163,7 +3374,13 @@ cs_halo_get_comm_mode(void)
 void
 cs_halo_set_comm_mode(cs_halo_comm_mode_t  mode)
 {
-  if (mode >= CS_HALO_COMM_P2P && mode <= CS_HALO_COMM_RMA_GET)
+#if defined(HAVE_NCCL)
+  const cs_halo_comm_mode_t mode_max = CS_HALO_COMM_NCCL;
+#else
+  const cs_halo_comm_mode_t mode_max = CS_HALO_COMM_RMA_GET;
+#endif
+
+  if (mode >= CS_HALO_COMM_P2P && mode <= mode_max)
     _halo_comm_mode = mode;
 }
 
@@ -2195,6 +3412,74 @@ cs_halo_set_buffer_alloc_mode(cs_alloc_mode_t  mode)
   _halo_buffer_alloc_mode = mode;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log performance information relative to halo exchanges.
+ *
+ * Pack and completion (wait) times are cumulated over all halo
+ * synchronizations since the start of the run; the spread of the wait
+ * time across ranks indicates load or communication imbalance, as
+ * lightly-loaded ranks wait for their neighbors' messages.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_log_finalize(void)
+{
+  if (_halo_sync_n_calls < 1)
+    return;
+
+  double stats[4] = {_halo_sync_timers[0].nsec*1e-9,
+                     _halo_sync_timers[1].nsec*1e-9,
+                     (double)_halo_sync_n_calls,
+                     (double)_halo_sync_send_bytes*1e-6};
+
+  double stats_mean[4], stats_min[4], stats_max[4];
+  for (int i = 0; i < 4; i++) {
+    stats_mean[i] = stats[i];
+    stats_min[i] = stats[i];
+    stats_max[i] = stats[i];
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Allreduce(stats, stats_mean, 4, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(stats, stats_min, 4, MPI_DOUBLE, MPI_MIN,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(stats, stats_max, 4, MPI_DOUBLE, MPI_MAX,
+                  cs_glob_mpi_comm);
+  }
+#endif
+
+  for (int i = 0; i < 4; i++)
+    stats_mean[i] /= cs_glob_n_ranks;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nHalo exchanges:\n\n"));
+
+  cs_log_printf
+    (CS_LOG_PERFORMANCE,
+     _("                             mean        minimum      maximum\n"
+       "  Pack:              %12.5f s %12.5f %12.5f s\n"
+       "  Completion (wait): %12.5f s %12.5f %12.5f s\n"
+       "  Exchanges:         %12.0f   %12.0f %12.0f\n"
+       "  Sent volume:       %12.3f MB %10.3f %12.3f MB\n"),
+     stats_mean[0], stats_min[0], stats_max[0],
+     stats_mean[1], stats_min[1], stats_max[1],
+     stats_mean[2], stats_min[2], stats_max[2],
+     stats_mean[3], stats_min[3], stats_max[3]);
+
+  if (stats_mean[1] > 0)
+    cs_log_printf
+      (CS_LOG_PERFORMANCE,
+       _("  Wait imbalance ((max-mean)/mean): %.1f %%\n"),
+       (stats_max[1] - stats_mean[1])/stats_mean[1]*100.);
+
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+  cs_log_separator(CS_LOG_PERFORMANCE);
+}
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
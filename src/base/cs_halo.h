@@ -66,8 +66,13 @@ typedef enum {
 typedef enum {
 
   CS_HALO_COMM_P2P,      /*!< non-blocking point-to-point communication */
-  CS_HALO_COMM_RMA_GET   /*!< MPI-3 one-sided with get semantics and
+  CS_HALO_COMM_RMA_GET,  /*!< MPI-3 one-sided with get semantics and
                            active target synchronization */
+  CS_HALO_COMM_NCCL      /*!< NCCL (or RCCL) device-to-device communication
+                           for device-resident variables, grouped across
+                           neighbor ranks; requires NCCL support, and falls
+                           back to point-to-point communication for
+                           host-resident variables */
 
 } cs_halo_comm_mode_t;
 
@@ -215,6 +220,22 @@ cs_halo_create(const cs_interface_set_t  *ifs);
 void
 cs_halo_create_complete(cs_halo_t  *halo);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Drop cached exchange state associated with a given halo.
+ *
+ * This should be called when a halo's indexes or element lists are
+ * modified in place, so that cached exchange state (such as persistent
+ * communication channels) matching the previous halo contents is not
+ * reused.
+ *
+ * \param[in]  halo  pointer to halo structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_drop_state(const cs_halo_t  *halo);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create a halo structure, given a reference halo.
@@ -523,6 +544,86 @@ cs_halo_sync(const cs_halo_t  *halo,
              int               stride,
              void             *val);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start an anticipated halo exchange for an array whose local
+ *        values are final.
+ *
+ * The exchange is initiated immediately, using a dedicated exchange state,
+ * and progresses while the caller continues with unrelated work. It is
+ * completed either by a later call to \ref cs_halo_sync for the same array
+ * with compatible parameters (which then reduces to a simple wait), or by
+ * \ref cs_halo_sync_prefetch_wait. This allows overlapping communication
+ * of a known upcoming synchronization with intermediate computation,
+ * without modifying the downstream code doing that synchronization.
+ *
+ * Local values of the array must not be modified before the exchange
+ * is completed.
+ *
+ * \param[in]   halo        pointer to halo structure
+ * \param[in]   sync_mode   synchronization mode (standard or extended)
+ * \param[in]   data_type   data type
+ * \param[in]   stride      number of (interlaced) values by entity
+ * \param[in]   val         pointer to variable value array
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_prefetch(const cs_halo_t  *halo,
+                      cs_halo_type_t    sync_mode,
+                      cs_datatype_t     data_type,
+                      int               stride,
+                      void             *val);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete an anticipated halo exchange for a given array.
+ *
+ * If no exchange started by \ref cs_halo_sync_prefetch is in flight
+ * for this array, this function does nothing.
+ *
+ * \param[in]   halo  pointer to halo structure
+ * \param[in]   val   pointer to variable value array
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_prefetch_wait(const cs_halo_t  *halo,
+                           void             *val);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update multiple arrays of values in case of parallelism
+ *        or periodicity, using a single message per neighbor rank.
+ *
+ * All arrays must be associated with the same halo, and are packed
+ * in an interleaved manner into a single send buffer, so only one
+ * message is exchanged with each neighboring rank instead of one
+ * per array; this reduces latency and message count when many fields
+ * with the same exchange pattern are synchronized in sequence.
+ *
+ * As with \ref cs_halo_sync, values are copied as is, so rotational
+ * periodicity handling for vector and tensor fields remains the
+ * caller's responsibility.
+ *
+ * \param[in]   halo        pointer to halo structure
+ * \param[in]   sync_mode   synchronization mode (standard or extended)
+ * \param[in]   data_type   data type (common to all arrays)
+ * \param[in]   n_fields    number of arrays to synchronize
+ * \param[in]   stride      for each array, number of (interlaced) values
+ *                          by entity
+ * \param[in]   val         for each array, pointer to variable values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_batch(const cs_halo_t  *halo,
+                   cs_halo_type_t    sync_mode,
+                   cs_datatype_t     data_type,
+                   int               n_fields,
+                   const int         stride[],
+                   void             *val[]);
+
 #if defined(HAVE_ACCEL)
 
 /*----------------------------------------------------------------------------*/
@@ -657,6 +758,66 @@ cs_halo_get_use_barrier(void);
 void
 cs_halo_set_use_barrier(bool use_barrier);
 
+/*----------------------------------------------------------------------------
+ * Return persistent channel usage flag.
+ *
+ * returns:
+ *   true if MPI persistent requests are reused for repeated
+ *   synchronizations of a same field layout, false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_persistent(void);
+
+/*----------------------------------------------------------------------------
+ * Set persistent channel usage flag.
+ *
+ * When this flag is set, halo exchanges of host-resident arrays build
+ * MPI persistent (MPI_Send_init/MPI_Recv_init) requests keyed by halo,
+ * datatype, stride, and buffer addresses, so repeated synchronizations
+ * of a same field layout reduce to an MPI_Startall/MPI_Waitall pair.
+ *
+ * parameters:
+ *   use_persistent <-- true if persistent requests should be reused for
+ *                      repeated synchronizations of a same field layout,
+ *                      false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_persistent(bool use_persistent);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * rief Get reduced-precision exchange flag.
+ *
+ * eturn  true if real-valued exchanges are reduced to single precision
+ *          on the wire, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_reduced_real_exchange(void);
+
+/*----------------------------------------------------------------------------
+ * Set reduced-precision exchange flag.
+ *
+ * When this flag is set, real-valued (double precision) halo exchanges are
+ * down-converted to single precision on the wire, halving exchanged bytes,
+ * with full-precision endpoint arrays. This only applies to host-based
+ * point-to-point exchanges; other communication modes ignore the flag.
+ *
+ * As the flag is checked when packing, it is intended to be set (and
+ * restored) per call site, bracketing synchronizations whose ghost values
+ * tolerate reduced precision, such as smoothing sweeps.
+ *
+ * parameters:
+ *   reduce <-- true if real-valued exchanges should be reduced to single
+ *              precision on the wire, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_reduced_real_exchange(bool reduce);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Get default communication mode for halo exchange.
@@ -701,6 +862,19 @@ cs_halo_get_buffer_alloc_mode(void);
 void
 cs_halo_set_buffer_alloc_mode(cs_alloc_mode_t  mode);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log performance information relative to halo exchanges.
+ *
+ * Pack and completion (wait) times are cumulated over all halo
+ * synchronizations since the start of the run; the spread of the wait
+ * time across ranks indicates load or communication imbalance.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_log_finalize(void);
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
@@ -155,126 +155,143 @@ _apply_vector_transfo(cs_real_t    matrix[3][4],
 }
 
 /*----------------------------------------------------------------------------
- * Compute a matrix/vector product to apply a transformation to a given
- * interleaved vector.
+ * Apply a rotation to a contiguous block of interleaved vectors.
+ *
+ * The rotation part (3x3) of the transformation matrix is extracted once,
+ * so the loop on elements reduces to dense matrix/vector products on
+ * contiguous values.
  *
  * parameters:
  *   matrix[3][4] --> matrix of the transformation in homogeneous coord.
  *                    last line = [0; 0; 0; 1] (Not used here)
- *   xyz          <-> array of coordinates
+ *   n_elts       --> number of vectors in block
+ *   xyz          <-> interleaved vector values (block start)
  *----------------------------------------------------------------------------*/
 
 static void
 _apply_vector_rotation(cs_real_t    matrix[3][4],
+                       cs_lnum_t    n_elts,
                        cs_real_t   *xyz)
 {
-  cs_lnum_t  i;
-
-  cs_real_t  t[3];
-  for (i = 0; i < 3; i++)
-    t[i] = xyz[i];
-
-  /* Initialize output */
-
-  for (i = 0; i < 3; i++)
-    xyz[i] = matrix[i][0]*t[0] + matrix[i][1]*t[1] + matrix[i][2]*t[2];
-
+  const cs_real_t m00 = matrix[0][0], m01 = matrix[0][1], m02 = matrix[0][2];
+  const cs_real_t m10 = matrix[1][0], m11 = matrix[1][1], m12 = matrix[1][2];
+  const cs_real_t m20 = matrix[2][0], m21 = matrix[2][1], m22 = matrix[2][2];
+
+# pragma omp parallel for  if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    cs_real_t *v = xyz + 3*i;
+    const cs_real_t t0 = v[0], t1 = v[1], t2 = v[2];
+    v[0] = m00*t0 + m01*t1 + m02*t2;
+    v[1] = m10*t0 + m11*t1 + m12*t2;
+    v[2] = m20*t0 + m21*t1 + m22*t2;
+  }
 }
 
 /*----------------------------------------------------------------------------
- * Compute a matrix * tensor * Tmatrix product to apply a rotation to a
- * given interleaved tensor
+ * Apply a matrix * tensor * Tmatrix rotation to a contiguous block of
+ * interleaved tensors.
  *
  * parameters:
  *   matrix[3][4]        --> transformation matrix in homogeneous coords.
  *                           last line = [0; 0; 0; 1] (Not used here)
- *   tensor              <-> incoming 3x3 tensor
+ *   n_elts              --> number of tensors in block
+ *   tensor              <-> interleaved 3x3 tensor values (block start)
  *----------------------------------------------------------------------------*/
 
 static void
 _apply_tensor_rotation(cs_real_t   matrix[3][4],
+                       cs_lnum_t   n_elts,
                        cs_real_t   *tensor)
 {
-  cs_lnum_t  i, j, k, l;
+# pragma omp parallel for  if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {
 
-  cs_real_t  t[3][3];
+    cs_real_t *t_e = tensor + 9*e_id;
+    cs_real_t  t[3][3];
 
-  for (k = 0; k < 3; k++) {
-    for (j = 0; j < 3; j++) {
-      t[k][j] = 0.;
-      for (l = 0; l < 3; l++)
-        t[k][j] += matrix[j][l] * tensor[k*3+l];
+    for (cs_lnum_t k = 0; k < 3; k++) {
+      for (cs_lnum_t j = 0; j < 3; j++) {
+        t[k][j] = 0.;
+        for (cs_lnum_t l = 0; l < 3; l++)
+          t[k][j] += matrix[j][l] * t_e[k*3+l];
+      }
     }
-  }
 
-  for (i = 0; i < 3; i++) {
-    for (j = 0; j < 3; j++) {
-      tensor[i*3+j] = 0.;
-      for (k = 0; k < 3; k++)
-        tensor[i*3+j] += matrix[i][k] * t[k][j];
+    for (cs_lnum_t i = 0; i < 3; i++) {
+      for (cs_lnum_t j = 0; j < 3; j++) {
+        t_e[i*3+j] = 0.;
+        for (cs_lnum_t k = 0; k < 3; k++)
+          t_e[i*3+j] += matrix[i][k] * t[k][j];
+      }
     }
-  }
 
+  }
 }
 
 /*----------------------------------------------------------------------------
- * Compute a matrix * tensor * Tmatrix product to apply a rotation to a
- * given symmetric interleaved tensor
+ * Apply a matrix * tensor * Tmatrix rotation to a contiguous block of
+ * symmetric interleaved tensors.
  *
  * parameters:
  *   matrix[3][4]        --> transformation matrix in homogeneous coords.
  *                           last line = [0; 0; 0; 1] (Not used here)
- *   tensor              <-> incoming (6) symmetric tensor
+ *   n_elts              --> number of tensors in block
+ *   tensor              <-> interleaved (6) symmetric tensor values
+ *                           (block start)
  *----------------------------------------------------------------------------*/
 
 static void
 _apply_sym_tensor_rotation(cs_real_t   matrix[3][4],
+                           cs_lnum_t   n_elts,
                            cs_real_t   *tensor)
 {
-  cs_lnum_t  i, j, k, l;
-
-  cs_real_t  t[3][3];
-  cs_real_t  t0[3][3];
-
-  t0[0][0] = tensor[0];
-  t0[1][1] = tensor[1];
-  t0[2][2] = tensor[2];
-  t0[0][1] = tensor[3];
-  t0[1][0] = tensor[3];
-  t0[1][2] = tensor[4];
-  t0[2][1] = tensor[4];
-  t0[0][2] = tensor[5];
-  t0[2][0] = tensor[5];
-
-  for (k = 0; k < 3; k++) {
-    for (j = 0; j < 3; j++) {
-      t[k][j] = 0.;
-      for (l = 0; l < 3; l++)
-        t[k][j] += matrix[j][l] * t0[k][l];
+# pragma omp parallel for  if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {
+
+    cs_real_t *t_e = tensor + 6*e_id;
+
+    cs_real_t  t[3][3];
+    cs_real_t  t0[3][3];
+
+    t0[0][0] = t_e[0];
+    t0[1][1] = t_e[1];
+    t0[2][2] = t_e[2];
+    t0[0][1] = t_e[3];
+    t0[1][0] = t_e[3];
+    t0[1][2] = t_e[4];
+    t0[2][1] = t_e[4];
+    t0[0][2] = t_e[5];
+    t0[2][0] = t_e[5];
+
+    for (cs_lnum_t k = 0; k < 3; k++) {
+      for (cs_lnum_t j = 0; j < 3; j++) {
+        t[k][j] = 0.;
+        for (cs_lnum_t l = 0; l < 3; l++)
+          t[k][j] += matrix[j][l] * t0[k][l];
+      }
     }
-  }
 
-  for (i = 0; i < 3; i++) {
-    for (j = 0; j < 3; j++) {
-      t0[i][j] = 0.;
-      for (k = 0; k < 3; k++)
-        t0[i][j] += matrix[i][k] * t[k][j];
+    for (cs_lnum_t i = 0; i < 3; i++) {
+      for (cs_lnum_t j = 0; j < 3; j++) {
+        t0[i][j] = 0.;
+        for (cs_lnum_t k = 0; k < 3; k++)
+          t0[i][j] += matrix[i][k] * t[k][j];
+      }
     }
-  }
 
-  tensor[0] = t0[0][0];
-  tensor[1] = t0[1][1];
-  tensor[2] = t0[2][2];
-  tensor[3] = t0[0][1];
-  tensor[3] = t0[1][0];
-  tensor[4] = t0[2][1];
-  tensor[5] = t0[2][0];
+    t_e[0] = t0[0][0];
+    t_e[1] = t0[1][1];
+    t_e[2] = t0[2][2];
+    t_e[3] = t0[1][0];
+    t_e[4] = t0[2][1];
+    t_e[5] = t0[2][0];
 
+  }
 }
 
 /*----------------------------------------------------------------------------
- * Compute the rotation of a third-order symmetric interleaved tensor
- * (18 components)
+ * Apply the rotation of third-order symmetric interleaved tensors
+ * (18 components) to a contiguous block.
  * TENSOR_ijk = M_ip M_jq M_kr TENSOR_pqr
  *
  * Warning: Rij stored as (11, 22, 33, 12, 23, 13)
@@ -282,49 +299,54 @@ _apply_sym_tensor_rotation(cs_real_t   matrix[3][4],
  * parameters:
  *   matrix[3][4]        --> transformation matrix in homogeneous coords.
  *                           last line = [0; 0; 0; 1] (Not used here)
- *   tensor              <-> incoming 3x3x3 tensor
+ *   n_elts              --> number of tensors in block
+ *   tensor              <-> interleaved 3x3x3 tensor values (block start)
  *                           (in fact 3x6 due to symmetry)
  *----------------------------------------------------------------------------*/
 
 static void
 _apply_tensor3sym_rotation(cs_real_t   matrix[3][4],
+                           cs_lnum_t   n_elts,
                            cs_real_t   *tensor)
 {
-  cs_lnum_t  i, j, k, p, q, r;
-
-  cs_real_t  t1[3][3][3], t2[3][3][3];
-
-  for (p = 0; p < 3; p++) {
-    for (q = 0; q < 3; q++) {
-      for (k = 0; k < 3; k++) {
-        t1[p][q][k] = 0.;
-        for (r = 0; r < 3; r++)
-          t1[p][q][k] += matrix[k][r] * tensor[3*_symt[p][q] + r];
+# pragma omp parallel for  if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {
+
+    cs_real_t *t_e = tensor + 18*e_id;
+    cs_real_t  t1[3][3][3], t2[3][3][3];
+
+    for (cs_lnum_t p = 0; p < 3; p++) {
+      for (cs_lnum_t q = 0; q < 3; q++) {
+        for (cs_lnum_t k = 0; k < 3; k++) {
+          t1[p][q][k] = 0.;
+          for (cs_lnum_t r = 0; r < 3; r++)
+            t1[p][q][k] += matrix[k][r] * t_e[3*_symt[p][q] + r];
+        }
       }
     }
-  }
 
-  for (i = 0; i < 3; i++) {
-    for (j = 0; j < 3; j++) {
-      for (k = 0; k < 3; k++) {
-        t2[i][j][k] = 0.;
-        for (p = 0; p < 3; p++) {
-          for (q = 0; q < 3; q++)
-            t2[i][j][k] += matrix[i][p] * matrix[j][q] * t1[p][q][k];
+    for (cs_lnum_t i = 0; i < 3; i++) {
+      for (cs_lnum_t j = 0; j < 3; j++) {
+        for (cs_lnum_t k = 0; k < 3; k++) {
+          t2[i][j][k] = 0.;
+          for (cs_lnum_t p = 0; p < 3; p++) {
+            for (cs_lnum_t q = 0; q < 3; q++)
+              t2[i][j][k] += matrix[i][p] * matrix[j][q] * t1[p][q][k];
+          }
         }
       }
     }
-  }
 
-  /* Output */
+    /* Output */
 
-  for (i = 0; i < 3; i++) {
-    for (j = 0; j < 3; j++) {
-      for (k = 0; k < 3; k++)
-        tensor[3*_symt[i][j] + k] = t2[i][j][k];
+    for (cs_lnum_t i = 0; i < 3; i++) {
+      for (cs_lnum_t j = 0; j < 3; j++) {
+        for (cs_lnum_t k = 0; k < 3; k++)
+          t_e[3*_symt[i][j] + k] = t2[i][j][k];
+      }
     }
-  }
 
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -443,7 +465,7 @@ cs_halo_perio_sync_var_vect(const cs_halo_t  *halo,
     return;
 
   int  rank_id, t_id;
-  cs_lnum_t  i, shift, start_std, end_std, start_ext, end_ext;
+  cs_lnum_t  shift, start_std, n_std, start_ext, n_ext;
 
   cs_real_t matrix[3][4];
 
@@ -471,18 +493,16 @@ cs_halo_perio_sync_var_vect(const cs_halo_t  *halo,
       for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
         start_std = n_elts + halo->perio_lst[shift + 4*rank_id];
-        end_std = start_std + halo->perio_lst[shift + 4*rank_id + 1];
+        n_std = halo->perio_lst[shift + 4*rank_id + 1];
 
-        for (i = start_std; i < end_std; i++)
-          _apply_vector_rotation(matrix, var + i*incvar);
+        _apply_vector_rotation(matrix, n_std, var + start_std*incvar);
 
         if (sync_mode == CS_HALO_EXTENDED) {
 
           start_ext = n_elts + halo->perio_lst[shift + 4*rank_id + 2];
-          end_ext = start_ext + halo->perio_lst[shift + 4*rank_id + 3];
+          n_ext = halo->perio_lst[shift + 4*rank_id + 3];
 
-          for (i = start_ext; i < end_ext; i++)
-            _apply_vector_rotation(matrix, var + i*incvar);
+          _apply_vector_rotation(matrix, n_ext, var + start_ext*incvar);
 
         }
 
@@ -513,7 +533,7 @@ cs_halo_perio_sync_var_tens(const cs_halo_t  *halo,
     return;
 
   int  rank_id, t_id;
-  cs_lnum_t  i, shift, start_std, end_std, start_ext, end_ext;
+  cs_lnum_t  shift, start_std, n_std, start_ext, n_ext;
 
   cs_real_t  matrix[3][4];
 
@@ -540,18 +560,16 @@ cs_halo_perio_sync_var_tens(const cs_halo_t  *halo,
       for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
         start_std = halo->perio_lst[shift + 4*rank_id];
-        end_std = start_std + halo->perio_lst[shift + 4*rank_id + 1];
+        n_std = halo->perio_lst[shift + 4*rank_id + 1];
 
-        for (i = start_std; i < end_std; i++)
-          _apply_tensor_rotation(matrix, var + 9*(n_elts+i));
+        _apply_tensor_rotation(matrix, n_std, var + 9*(n_elts+start_std));
 
         if (sync_mode == CS_HALO_EXTENDED) {
 
           start_ext = halo->perio_lst[shift + 4*rank_id + 2];
-          end_ext = start_ext + halo->perio_lst[shift + 4*rank_id + 3];
+          n_ext = halo->perio_lst[shift + 4*rank_id + 3];
 
-          for (i = start_ext; i < end_ext; i++)
-            _apply_tensor_rotation(matrix, var + 9*(n_elts+i));
+          _apply_tensor_rotation(matrix, n_ext, var + 9*(n_elts+start_ext));
 
         } /* End of the treatment of rotation */
 
@@ -583,7 +601,7 @@ cs_halo_perio_sync_var_sym_tens(const cs_halo_t  *halo,
     return;
 
   int  rank_id, t_id;
-  cs_lnum_t  i, shift, start_std, end_std, start_ext, end_ext;
+  cs_lnum_t  shift, start_std, n_std, start_ext, n_ext;
 
   cs_real_t  matrix[3][4];
 
@@ -610,18 +628,17 @@ cs_halo_perio_sync_var_sym_tens(const cs_halo_t  *halo,
       for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
         start_std = halo->perio_lst[shift + 4*rank_id];
-        end_std = start_std + halo->perio_lst[shift + 4*rank_id + 1];
+        n_std = halo->perio_lst[shift + 4*rank_id + 1];
 
-        for (i = start_std; i < end_std; i++)
-          _apply_sym_tensor_rotation(matrix, var + 6*(n_elts+i));
+        _apply_sym_tensor_rotation(matrix, n_std, var + 6*(n_elts+start_std));
 
         if (sync_mode == CS_HALO_EXTENDED) {
 
           start_ext = halo->perio_lst[shift + 4*rank_id + 2];
-          end_ext = start_ext + halo->perio_lst[shift + 4*rank_id + 3];
+          n_ext = halo->perio_lst[shift + 4*rank_id + 3];
 
-          for (i = start_ext; i < end_ext; i++)
-            _apply_sym_tensor_rotation(matrix, var + 6*(n_elts+i));
+          _apply_sym_tensor_rotation(matrix, n_ext,
+                                     var + 6*(n_elts+start_ext));
 
         } /* End of the treatment of rotation */
 
@@ -653,7 +670,7 @@ cs_halo_perio_sync_var_sym_tens_grad(const cs_halo_t  *halo,
     return;
 
   int  rank_id, t_id;
-  cs_lnum_t  i, shift, start_std, end_std, start_ext, end_ext;
+  cs_lnum_t  shift, start_std, n_std, start_ext, n_ext;
 
   cs_real_t  matrix[3][4];
 
@@ -679,19 +696,17 @@ cs_halo_perio_sync_var_sym_tens_grad(const cs_halo_t  *halo,
 
       for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
-        start_std =n_elts +  halo->perio_lst[shift + 4*rank_id];
-        end_std = start_std + halo->perio_lst[shift + 4*rank_id + 1];
+        start_std = n_elts + halo->perio_lst[shift + 4*rank_id];
+        n_std = halo->perio_lst[shift + 4*rank_id + 1];
 
-        for (i = start_std; i < end_std; i++)
-          _apply_tensor3sym_rotation(matrix, var + 18*i);
+        _apply_tensor3sym_rotation(matrix, n_std, var + 18*start_std);
 
         if (sync_mode == CS_HALO_EXTENDED) {
 
           start_ext = n_elts + halo->perio_lst[shift + 4*rank_id + 2];
-          end_ext = start_ext + halo->perio_lst[shift + 4*rank_id + 3];
+          n_ext = halo->perio_lst[shift + 4*rank_id + 3];
 
-          for (i = start_ext; i < end_ext; i++)
-            _apply_tensor3sym_rotation(matrix, var + 18*i);
+          _apply_tensor3sym_rotation(matrix, n_ext, var + 18*start_ext);
 
         } /* End of the treatment of rotation */
 
@@ -0,0 +1,92 @@
+#ifndef __CS_HIP_COMPAT_H__
+#define __CS_HIP_COMPAT_H__
+
+/*============================================================================
+ * CUDA runtime API compatibility mapping for HIP compilers.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*
+  When the device code paths are compiled with a HIP compiler (AMD ROCm),
+  map the subset of the CUDA runtime API they use to its HIP equivalents,
+  so that the same sources may be built for both vendor runtimes.
+
+  This header must be included before any header using CUDA runtime types,
+  and is a no-op when compiling with NVCC or a plain host compiler.
+*/
+
+#if defined(__HIP__) && !defined(__NVCC__)
+
+#include <hip/hip_runtime.h>
+
+/* Types and enums */
+
+#define cudaError_t                    hipError_t
+#define cudaSuccess                    hipSuccess
+#define cudaErrorNoDevice              hipErrorNoDevice
+#define cudaStream_t                   hipStream_t
+#define cudaDeviceProp                 hipDeviceProp_t
+#define cudaPointerAttributes          hipPointerAttribute_t
+#define cudaCpuDeviceId                hipCpuDeviceId
+#define cudaMemcpyHostToDevice         hipMemcpyHostToDevice
+#define cudaMemcpyDeviceToHost         hipMemcpyDeviceToHost
+#define cudaMemcpyDeviceToDevice       hipMemcpyDeviceToDevice
+#define cudaMemAdviseSetReadMostly     hipMemAdviseSetReadMostly
+#define cudaMemAdviseUnsetReadMostly   hipMemAdviseUnsetReadMostly
+
+/* Device and runtime management */
+
+#define cudaGetDevice                  hipGetDevice
+#define cudaSetDevice                  hipSetDevice
+#define cudaGetDeviceCount             hipGetDeviceCount
+#define cudaGetDeviceProperties        hipGetDeviceProperties
+#define cudaDriverGetVersion           hipDriverGetVersion
+#define cudaRuntimeGetVersion          hipRuntimeGetVersion
+#define cudaGetErrorString             hipGetErrorString
+#define cudaDeviceSynchronize          hipDeviceSynchronize
+
+/* Streams */
+
+#define cudaStreamCreate               hipStreamCreate
+#define cudaStreamDestroy              hipStreamDestroy
+#define cudaStreamSynchronize          hipStreamSynchronize
+
+/* Memory management */
+
+#define cudaMalloc                     hipMalloc
+#define cudaMallocHost                 hipHostMalloc
+#define cudaMallocManaged              hipMallocManaged
+#define cudaFree                       hipFree
+#define cudaFreeHost                   hipHostFree
+#define cudaMemcpy                     hipMemcpy
+#define cudaMemcpyAsync                hipMemcpyAsync
+#define cudaMemAdvise                  hipMemAdvise
+#define cudaMemPrefetchAsync           hipMemPrefetchAsync
+#define cudaPointerGetAttributes       hipPointerGetAttributes
+
+#endif /* defined(__HIP__) && !defined(__NVCC__) */
+
+/*----------------------------------------------------------------------------*/
+
+#endif /* __CS_HIP_COMPAT_H__ */
@@ -48,6 +48,14 @@
 #  endif
 #endif
 
+#if defined(HAVE_UNISTD_H) && !defined(WIN32) && !defined(_WIN32)
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define CS_IO_HAVE_MMAP 1
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -138,6 +146,10 @@ struct _cs_io_t {
 
   cs_file_t          *f;              /* Pointer to associated file */
 
+  unsigned char      *map_base;       /* Base of mapped file region in
+                                         zero-copy read mode, or NULL */
+  cs_file_off_t       map_size;       /* Size of mapped region */
+
   char                contents[64];   /* String describing file contents */
 
   cs_io_mode_t        mode;           /* File access mode */
@@ -200,6 +212,10 @@ static int _cs_io_map_size_max[2] = {0, 0};
 static cs_map_name_to_id_t  *_cs_io_map[2] = {NULL, NULL};
 static cs_io_log_t  *_cs_io_log[2] = {NULL, NULL};
 
+/* Use memory mapping for files opened in read mode when possible ? */
+
+static bool _cs_io_mapped_read = false;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -391,6 +407,9 @@ _cs_io_create(cs_io_mode_t   mode,
 
   cs_io->f  = NULL;
 
+  cs_io->map_base = NULL;
+  cs_io->map_size = 0;
+
   memset(cs_io->contents, 0, 64);
 
   cs_io->header_size = 0;
@@ -579,6 +598,48 @@ _update_index_and_shift(cs_io_t             *inp,
   idx->size += 1;
 }
 
+/*----------------------------------------------------------------------------
+ * Map the contents of a file opened in read mode to memory.
+ *
+ * If mapping is not possible, the map_base member simply remains NULL,
+ * and regular (copy-based) reads are used.
+ *
+ * parameters:
+ *   cs_io <-> kernel IO structure
+ *   name  <-- file name
+ *----------------------------------------------------------------------------*/
+
+static void
+_file_map(cs_io_t     *cs_io,
+          const char  *name)
+{
+#if defined(CS_IO_HAVE_MMAP)
+
+  int fd = open(name, O_RDONLY);
+
+  if (fd < 0)
+    return;
+
+  struct stat sb;
+
+  if (fstat(fd, &sb) == 0 && sb.st_size > 0) {
+    void  *p = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED) {
+      cs_io->map_base = p;
+      cs_io->map_size = sb.st_size;
+    }
+  }
+
+  close(fd);
+
+#else
+
+  CS_UNUSED(cs_io);
+  CS_UNUSED(name);
+
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Open the interface file descriptor and initialize the file by writing
  * or reading a "magic string" used to check the file content type.
@@ -684,6 +745,13 @@ _file_open(cs_io_t           *cs_io,
   cs_io->comm = comm;
 #endif
 
+  /* Optionally map file contents to memory for zero-copy reads */
+
+  if (   cs_io->mode == CS_IO_MODE_READ
+      && _cs_io_mapped_read
+      && cs_glob_n_ranks == 1)
+    _file_map(cs_io, name);
+
   /* Write or read a magic string */
   /*------------------------------*/
 
@@ -841,6 +909,14 @@ _file_reopen_read(cs_io_t           *inp,
 static void
 _file_close(cs_io_t  *cs_io)
 {
+#if defined(CS_IO_HAVE_MMAP)
+  if (cs_io->map_base != NULL) {
+    munmap(cs_io->map_base, cs_io->map_size);
+    cs_io->map_base = NULL;
+    cs_io->map_size = 0;
+  }
+#endif
+
   if (cs_io->f != NULL)
     cs_io->f = cs_file_free(cs_io->f);
 
@@ -1792,6 +1868,38 @@ _dump_index(const cs_io_sec_index_t  *idx)
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Set behavior for subsequently opened kernel IO files regarding
+ * memory mapping in read mode.
+ *
+ * When mapped reads are active, files opened in read mode in serial runs
+ * are also mapped to memory where supported, allowing zero-copy access to
+ * section bodies through cs_io_map_global.
+ *
+ * parameters:
+ *   use_mapped_read <-- true to enable, false to disable
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_mapped_read(bool  use_mapped_read)
+{
+  _cs_io_mapped_read = use_mapped_read;
+}
+
+/*----------------------------------------------------------------------------
+ * Indicate if mapped reads are active for subsequently opened
+ * kernel IO files.
+ *
+ * returns:
+ *   true if mapped reads are active, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_io_get_mapped_read(void)
+{
+  return _cs_io_mapped_read;
+}
+
 /*----------------------------------------------------------------------------
  * Initialize a kernel IO file structure.
  *
@@ -2545,6 +2653,91 @@ cs_io_read_global(const cs_io_sec_header_t  *header,
   return _cs_io_read_body(header, 0, 0, elts, cs_io);
 }
 
+/*----------------------------------------------------------------------------
+ * Access a section body directly in a memory-mapped file region.
+ *
+ * This zero-copy alternative to cs_io_read_global is only available when
+ * mapped reads are active (see cs_io_set_mapped_read) and neither a
+ * datatype conversion nor a byte swap is needed; character sections are
+ * also excluded, as regular reads add a null terminator. In all those
+ * cases, NULL is returned, and the caller should fall back to
+ * cs_io_read_global.
+ *
+ * The returned pointer is valid until the kernel IO structure is
+ * finalized, and must not be freed by the caller.
+ *
+ * parameters:
+ *   header <-- header structure
+ *   inp    --> input kernel IO structure
+ *
+ * returns:
+ *   pointer to section body in mapped region, or NULL
+ *----------------------------------------------------------------------------*/
+
+const void *
+cs_io_map_global(const cs_io_sec_header_t  *header,
+                 cs_io_t                   *inp)
+{
+  double t_start = 0.;
+  cs_io_log_t  *log = NULL;
+
+  cs_file_off_t  n_vals = inp->n_vals;
+
+  assert(header->n_vals == inp->n_vals);
+
+  if (   header->elt_type != header->type_read
+      || header->elt_type == CS_CHAR
+      || inp->f == NULL
+      || cs_file_get_swap_endian(inp->f) == 1)
+    return NULL;
+
+  /* If data is embedded in the header, it is already in memory */
+
+  if (inp->data != NULL) {
+    const void  *retval = inp->data;
+    inp->data = NULL;  /* Reset for next read */
+    return retval;
+  }
+
+  if (inp->map_base == NULL)
+    return NULL;
+
+  if (inp->log_id > -1) {
+    log = _cs_io_log[inp->mode] + inp->log_id;
+    t_start = cs_timer_wtime();
+  }
+
+  /* Position past body alignment padding, then simply point into the
+     mapped region, and skip the section body for subsequent reads */
+
+  cs_file_off_t offset = cs_file_tell(inp->f);
+
+  if (inp->body_align > 0) {
+    size_t ba = inp->body_align;
+    offset += (ba - (offset % ba)) % ba;
+  }
+
+  assert(  offset + n_vals*(cs_file_off_t)(inp->type_size)
+         <= inp->map_size);
+
+  cs_file_seek(inp->f,
+               offset + n_vals*inp->type_size,
+               CS_FILE_SEEK_SET);
+
+  if (log != NULL) {
+    double t_end = cs_timer_wtime();
+    log->wtimes[0] += t_end - t_start;
+    log->data_size[0] += n_vals*inp->type_size;
+  }
+
+  if (header->n_vals != 0 && inp->echo > CS_IO_ECHO_HEADERS)
+    _echo_data(inp->echo, n_vals, 0, 0,
+               header->elt_type,
+               inp->map_base + offset);
+
+  return inp->map_base + offset;
+}
+
 /*----------------------------------------------------------------------------
  * Read a section body, assigning a different block to each processor.
  *
@@ -94,6 +94,32 @@ extern int       cs_glob_io_hints;
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Set behavior for subsequently opened kernel IO files regarding
+ * memory mapping in read mode.
+ *
+ * When mapped reads are active, files opened in read mode in serial runs
+ * are also mapped to memory where supported, allowing zero-copy access to
+ * section bodies through cs_io_map_global.
+ *
+ * parameters:
+ *   use_mapped_read <-- true to enable, false to disable
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_mapped_read(bool  use_mapped_read);
+
+/*----------------------------------------------------------------------------
+ * Indicate if mapped reads are active for subsequently opened
+ * kernel IO files.
+ *
+ * returns:
+ *   true if mapped reads are active, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_io_get_mapped_read(void);
+
 /*----------------------------------------------------------------------------
  * Initialize a kernel IO file structure.
  *
@@ -371,6 +397,31 @@ cs_io_read_global(const cs_io_sec_header_t  *header,
                   void                      *elts,
                   cs_io_t                   *pp_io);
 
+/*----------------------------------------------------------------------------
+ * Access a section body directly in a memory-mapped file region.
+ *
+ * This zero-copy alternative to cs_io_read_global is only available when
+ * mapped reads are active (see cs_io_set_mapped_read) and neither a
+ * datatype conversion nor a byte swap is needed; character sections are
+ * also excluded, as regular reads add a null terminator. In all those
+ * cases, NULL is returned, and the caller should fall back to
+ * cs_io_read_global.
+ *
+ * The returned pointer is valid until the kernel IO structure is
+ * finalized, and must not be freed by the caller.
+ *
+ * parameters:
+ *   header <-- header structure
+ *   pp_io  --> input kernel IO structure
+ *
+ * returns:
+ *   pointer to section body in mapped region, or NULL
+ *----------------------------------------------------------------------------*/
+
+const void *
+cs_io_map_global(const cs_io_sec_header_t  *header,
+                 cs_io_t                   *pp_io);
+
 /*----------------------------------------------------------------------------
  * Read a message body, assigning a different block to each processor.
  *
@@ -119,6 +119,22 @@ typedef struct {
 
 } cs_log_clip_t;
 
+/* Deferred per-location info for field and function logging */
+/*-----------------------------------------------------------*/
+
+typedef struct {
+
+  int        loc_id;          /* Associated mesh location id */
+  int        s_id;            /* Start index in stats arrays */
+  int        count;           /* Number of stats values */
+  cs_lnum_t  have_weight;     /* Weighting available ? */
+  int        tw_reduce;       /* Total weight requires reduction ? */
+  double     total_weight;    /* Total weight (local before reduction) */
+  cs_gnum_t  n_g_elts;        /* Global number of elements */
+  size_t     max_name_width;  /* Padding width for names */
+
+} cs_log_loc_info_t;
+
 /*----------------------------------------------------------------------------
  * Prototypes for local static functions
  *----------------------------------------------------------------------------*/
@@ -644,14 +660,23 @@ _log_clip_info(const char        *prefix,
 static void
 _log_fields_and_functions(void)
 {
-  int log_count;
+  int log_count = 0;
 
   int log_count_max = 0;
   int fpe_flag = 0;
-  int *log_id = NULL, *moment_id = NULL, *f_location_id = NULL;
+  int *moment_id = NULL, *f_location_id = NULL;
   bool *location_log = NULL;
   double  *vmin = NULL, *vmax = NULL, *vsum = NULL, *wsum = NULL;
 
+  int n_log_locs = 0, log_locs_max = 0;
+  cs_log_loc_info_t *log_locs = NULL;
+
+  int n_batch = 0, batch_max = 0;
+  int *batch_pos = NULL;
+  bool *batch_w_use = NULL;
+  const cs_real_t **batch_v = NULL;
+  double *batch_stats = NULL;
+
   char tmp_s[5][64] =  {"", "", "", "", ""};
 
   const char _underline[] = "---------------------------------";
@@ -671,7 +696,6 @@ _log_fields_and_functions(void)
 
   log_count_max = n_fields + n_functions;
 
-  BFT_MALLOC(log_id, n_ff, int);
   BFT_MALLOC(vmin, log_count_max, double);
   BFT_MALLOC(vmax, log_count_max, double);
   BFT_MALLOC(vsum, log_count_max, double);
@@ -726,6 +750,7 @@ _log_fields_and_functions(void)
 
     size_t max_name_width = cs_log_strlen(_("field"));
     cs_lnum_t have_weight = 0;
+    int tw_reduce = 0;
     double total_weight = -1;
     cs_gnum_t n_g_elts = 0;
     cs_real_t *gather_array = NULL; /* only if CS_MESH_LOCATION_VERTICES */
@@ -749,7 +774,7 @@ _log_fields_and_functions(void)
         n_g_elts = m->n_g_i_faces;
         weight = mq->i_face_surf;
         cs_array_reduce_sum_l(_n_elts, 1, NULL, weight, &total_weight);
-        cs_parall_sum(1, CS_DOUBLE, &total_weight);
+        tw_reduce = 1;
         have_weight = 1;
         break;
 
@@ -757,7 +782,7 @@ _log_fields_and_functions(void)
         n_g_elts = m->n_g_b_faces;
         weight = mq->b_face_surf;
         cs_array_reduce_sum_l(_n_elts, 1, NULL, weight, &total_weight);
-        cs_parall_sum(1, CS_DOUBLE, &total_weight);
+        tw_reduce = 1;
         have_weight = 1;
         break;
 
@@ -798,7 +823,7 @@ _log_fields_and_functions(void)
 
           if (have_weight) {
             cs_array_reduce_sum_l(_n_elts, 1, elt_ids, weight, &total_weight);
-            cs_parall_sum(1, CS_DOUBLE, &total_weight);
+            tw_reduce = 1;
           }
         }
         break;
@@ -808,16 +833,14 @@ _log_fields_and_functions(void)
     if (n_g_elts == 0)
       continue;
 
-    log_count = 0;
+    const int loc_s_id = log_count;
 
     /* First loop on fields and functions */
 
     for (int f_id = 0; f_id < n_ff; f_id++) {
 
-      if (f_location_id[f_id] != loc_id) {
-        log_id[f_id] = -1;
+      if (f_location_id[f_id] != loc_id)
         continue;
-      }
 
       bool use_weight = false;
 
@@ -899,10 +922,6 @@ _log_fields_and_functions(void)
 
       max_name_width = CS_MAX(max_name_width, l_name_width);
 
-      /* Position in log */
-
-      log_id[f_id] = log_count;
-
       _dim = (f_dim == 3) ? 4 : f_dim;
 
       while (log_count + _dim > log_count_max) {
@@ -913,7 +932,24 @@ _log_fields_and_functions(void)
         BFT_REALLOC(wsum, log_count_max, double);
       }
 
-      if (use_weight) {
+      /* Scalar field arrays are batched so that their stats are
+         computed in a single sweep over the location */
+
+      if (f_id < n_fields && f_dim == 1
+          && loc_id != CS_MESH_LOCATION_VERTICES) {
+        if (n_batch >= batch_max) {
+          batch_max = (batch_max == 0) ? 16 : batch_max*2;
+          BFT_REALLOC(batch_v, batch_max, const cs_real_t *);
+          BFT_REALLOC(batch_w_use, batch_max, bool);
+          BFT_REALLOC(batch_pos, batch_max, int);
+        }
+        batch_v[n_batch] = f_val;
+        batch_w_use[n_batch] = use_weight;
+        batch_pos[n_batch] = log_count;
+        n_batch += 1;
+      }
+
+      else if (use_weight) {
         cs_array_reduce_simple_stats_l_w(_n_elts,
                                          f_dim,
                                          NULL,
@@ -961,10 +997,8 @@ _log_fields_and_functions(void)
                                        vmax + log_count,
                                        vsum + log_count);
 
-        if (have_weight) {
-          for (c_id = 0; c_id < _dim; c_id++)
-            wsum[log_count + c_id] = 0.;
-        }
+        for (c_id = 0; c_id < _dim; c_id++)
+          wsum[log_count + c_id] = 0.;
       }
 
       BFT_FREE(_f_val);
@@ -973,27 +1007,122 @@ _log_fields_and_functions(void)
 
     } /* End of first loop on fields */
 
+    /* Deferred single-sweep reduction for batched scalar fields */
+
+    if (n_batch > 0) {
+
+      BFT_REALLOC(batch_stats, n_batch*5, double);
+
+      double *b_vmin = batch_stats;
+      double *b_vmax = batch_stats + n_batch;
+      double *b_vsum = batch_stats + n_batch*2;
+      double *b_vssum = batch_stats + n_batch*3;
+      double *b_wsum = batch_stats + n_batch*4;
+
+      cs_array_reduce_simple_stats_l_n(_n_elts,
+                                       n_batch,
+                                       elt_ids,
+                                       batch_v,
+                                       (have_weight) ? weight : NULL,
+                                       batch_w_use,
+                                       b_vmin,
+                                       b_vmax,
+                                       b_vsum,
+                                       b_vssum,
+                                       b_wsum);
+
+      for (int i = 0; i < n_batch; i++) {
+        int k = batch_pos[i];
+        vmin[k] = b_vmin[i];
+        vmax[k] = b_vmax[i];
+        vsum[k] = b_vsum[i];
+        wsum[k] = (have_weight) ? b_wsum[i] : 0.;
+      }
+
+      n_batch = 0;
+
+    }
+
     if (gather_array != NULL)
       BFT_FREE(gather_array);
 
-    if (log_count < 1)
+    if (log_count - loc_s_id < 1)
       continue;
 
-    /* Group MPI operations if required */
+    /* Record location info; reductions and printing are deferred so
+       that a single pair of packed reductions covers all locations */
 
-    cs_parall_min(log_count, CS_DOUBLE, vmin);
-    cs_parall_max(log_count, CS_DOUBLE, vmax);
-    cs_parall_sum(log_count, CS_DOUBLE, vsum);
+    if (n_log_locs >= log_locs_max) {
+      log_locs_max = (log_locs_max == 0) ? 4 : log_locs_max*2;
+      BFT_REALLOC(log_locs, log_locs_max, cs_log_loc_info_t);
+    }
+
+    cs_log_loc_info_t  *li = log_locs + n_log_locs;
+    li->loc_id = loc_id;
+    li->s_id = loc_s_id;
+    li->count = log_count - loc_s_id;
+    li->have_weight = have_weight;
+    li->tw_reduce = tw_reduce;
+    li->total_weight = total_weight;
+    li->n_g_elts = n_g_elts;
+    li->max_name_width = max_name_width;
+    n_log_locs += 1;
+
+  } /* End of loop on mesh locations */
+
+  /* Group MPI operations for all locations: one max reduction for
+     min/max values, one sum reduction for sums, weight sums, and
+     total weights */
+
+  if (n_log_locs > 0) {
+
+    double *redbuf;
+    BFT_MALLOC(redbuf, log_count*2 + n_log_locs, double);
+
+    for (int i = 0; i < log_count; i++) {
+      redbuf[i] = -vmin[i];
+      redbuf[log_count + i] = vmax[i];
+    }
+    cs_parall_max(log_count*2, CS_DOUBLE, redbuf);
+    for (int i = 0; i < log_count; i++) {
+      vmin[i] = -redbuf[i];
+      vmax[i] = redbuf[log_count + i];
+    }
 
-#   if defined(HAVE_MPI)
-    cs_parall_counter_max(&have_weight, 1);
-    if (have_weight)
-      cs_parall_sum(log_count, CS_DOUBLE, wsum);
-#   endif
+    for (int i = 0; i < log_count; i++) {
+      redbuf[i] = vsum[i];
+      redbuf[log_count + i] = wsum[i];
+    }
+    for (int l_id = 0; l_id < n_log_locs; l_id++)
+      redbuf[log_count*2 + l_id] = (log_locs[l_id].tw_reduce) ?
+                                    log_locs[l_id].total_weight : 0.;
+    cs_parall_sum(log_count*2 + n_log_locs, CS_DOUBLE, redbuf);
+    for (int i = 0; i < log_count; i++) {
+      vsum[i] = redbuf[i];
+      wsum[i] = redbuf[log_count + i];
+    }
+    for (int l_id = 0; l_id < n_log_locs; l_id++) {
+      if (log_locs[l_id].tw_reduce)
+        log_locs[l_id].total_weight = redbuf[log_count*2 + l_id];
+    }
+
+    BFT_FREE(redbuf);
+  }
+
+  /* Print results, per location */
+
+  for (int l_id = 0; l_id < n_log_locs; l_id++) {
+
+    const cs_log_loc_info_t  *li = log_locs + l_id;
+
+    const int loc_id = li->loc_id;
+    const cs_lnum_t have_weight = li->have_weight;
+    const double total_weight = li->total_weight;
+    const cs_gnum_t n_g_elts = li->n_g_elts;
 
     /* Print headers */
 
-    max_name_width = CS_MIN(max_name_width, 63);
+    size_t max_name_width = CS_MIN(li->max_name_width, 63);
 
     const char *loc_name = _(cs_mesh_location_get_name(loc_id));
     size_t loc_name_w = cs_log_strlen(loc_name);
@@ -1042,11 +1171,11 @@ _log_fields_and_functions(void)
 
     /* Second loop on fields and functions */
 
-    log_count = 0;
+    log_count = li->s_id;
 
     for (int f_id = 0; f_id < n_ff; f_id++) {
 
-      if (log_id[f_id] < 0)
+      if (f_location_id[f_id] != loc_id)
         continue;
 
       const char *name;
@@ -1101,7 +1230,7 @@ _log_fields_and_functions(void)
 
     } /* End of loop on fields */
 
-  } /* End of loop on mesh locations */
+  } /* End of loop on logged locations */
 
   /* Check NaN and exit */
   if (fpe_flag == 1)
@@ -1109,11 +1238,15 @@ _log_fields_and_functions(void)
                 _("Invalid (not-a-number) values detected for a field."));
 
   BFT_FREE(moment_id);
+  BFT_FREE(batch_stats);
+  BFT_FREE(batch_pos);
+  BFT_FREE(batch_w_use);
+  BFT_FREE(batch_v);
+  BFT_FREE(log_locs);
   BFT_FREE(wsum);
   BFT_FREE(vsum);
   BFT_FREE(vmax);
   BFT_FREE(vmin);
-  BFT_FREE(log_id);
   BFT_FREE(f_location_id);
   BFT_FREE(location_log);
 
@@ -0,0 +1,663 @@
+/*============================================================================
+ * In-memory mesh redistribution for dynamic load balancing.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+#include "bft_printf.h"
+
+#include "cs_all_to_all.h"
+#include "cs_base.h"
+#include "cs_block_dist.h"
+#include "cs_boundary_conditions.h"
+#include "cs_boundary_zone.h"
+#include "cs_cell_to_vertex.h"
+#include "cs_field.h"
+#include "cs_gradient.h"
+#include "cs_halo.h"
+#include "cs_halo_perio.h"
+#include "cs_log.h"
+#include "cs_matrix_default.h"
+#include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_from_builder.h"
+#include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
+#include "cs_mesh_to_builder.h"
+#include "cs_parall.h"
+#include "cs_part_to_block.h"
+#include "cs_partition.h"
+#include "cs_preprocess.h"
+#include "cs_renumber.h"
+#include "cs_timer.h"
+#include "cs_timer_stats.h"
+#include "cs_vertex_to_cell.h"
+#include "cs_volume_zone.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_rebalance.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_mesh_rebalance.c
+        In-memory mesh redistribution for dynamic load balancing.
+
+  When the per-rank cell distribution becomes unbalanced during a
+  computation (for example following in-run mesh modification), the
+  main mesh may be repartitioned and redistributed in memory, without
+  going through a checkpoint/restart cycle: a new partition is computed
+  using the currently selected partitioning algorithm, the mesh is
+  passed through the mesh builder as done when reading it, halos and
+  dependent structures are rebuilt, and values of owner fields are
+  migrated to the new distribution using their global element numbers.
+
+  As the trigger criterion, the cell-based load imbalance
+  (max/mean - 1 of the per-rank cell count) is used, as it is
+  available at no cost and does not depend on the varying per-iteration
+  cost of non-mesh operations.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Number of base (non-subset) mesh locations handled */
+
+#define _N_BASE_LOCATIONS 4
+
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+/* Imbalance threshold above which rebalancing is triggered (<= 0: disabled) */
+
+static double  _imbalance_threshold = -1.;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return base location rank of a field, or -1 for other locations.
+ *
+ * parameters:
+ *   location_id <-- mesh location id
+ *
+ * returns:
+ *   0 for cells, 1 for interior faces, 2 for boundary faces,
+ *   3 for vertices, -1 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_base_location_rank(int  location_id)
+{
+  int retval = -1;
+
+  switch(location_id) {
+  case CS_MESH_LOCATION_CELLS:
+    retval = 0;
+    break;
+  case CS_MESH_LOCATION_INTERIOR_FACES:
+    retval = 1;
+    break;
+  case CS_MESH_LOCATION_BOUNDARY_FACES:
+    retval = 2;
+    break;
+  case CS_MESH_LOCATION_VERTICES:
+    retval = 3;
+    break;
+  default:
+    break;
+  }
+
+  return retval;
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Migrate arrays defined on a given mesh location from the previous to
+ * the new mesh distribution.
+ *
+ * Values are moved from the previous partition to a temporary block
+ * distribution, then from that block distribution to the new partition,
+ * matching elements by global number.
+ *
+ * parameters:
+ *   n_g_ents   <-- global number of entities of this location
+ *   n_old_ents <-- local number of entities in previous distribution
+ *   old_gnum   <-- global entity numbers in previous distribution
+ *   n_new_ents <-- local number of entities in new distribution
+ *   new_gnum   <-- global entity numbers in new distribution
+ *   n_arrays   <-- number of arrays to migrate
+ *   dim        <-- dimension (interleaved stride) of each array
+ *   old_vals   <-- array values in previous distribution
+ *   new_vals   --> array values in new distribution
+ *----------------------------------------------------------------------------*/
+
+static void
+_migrate_location_vals(cs_gnum_t         n_g_ents,
+                       cs_lnum_t         n_old_ents,
+                       const cs_gnum_t   old_gnum[],
+                       cs_lnum_t         n_new_ents,
+                       const cs_gnum_t   new_gnum[],
+                       int               n_arrays,
+                       const int         dim[],
+                       cs_real_t        *old_vals[],
+                       cs_real_t        *new_vals[])
+{
+  cs_block_dist_info_t  bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                         cs_glob_n_ranks,
+                                                         1,
+                                                         0,
+                                                         n_g_ents);
+
+  cs_lnum_t block_size = bi.gnum_range[1] - bi.gnum_range[0];
+
+  cs_part_to_block_t  *pbd
+    = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                      bi,
+                                      n_old_ents,
+                                      old_gnum);
+
+  cs_all_to_all_t  *bpd
+    = cs_all_to_all_create_from_block(n_new_ents,
+                                      CS_ALL_TO_ALL_USE_DEST_ID,
+                                      new_gnum,
+                                      bi,
+                                      cs_glob_mpi_comm);
+
+  int max_dim = 1;
+  for (int i = 0; i < n_arrays; i++)
+    max_dim = CS_MAX(max_dim, dim[i]);
+
+  cs_real_t *block_vals;
+  BFT_MALLOC(block_vals, (size_t)block_size*max_dim, cs_real_t);
+
+  for (int i = 0; i < n_arrays; i++) {
+
+    cs_part_to_block_copy_array(pbd,
+                                CS_REAL_TYPE,
+                                dim[i],
+                                old_vals[i],
+                                block_vals);
+
+    cs_all_to_all_copy_array(bpd,
+                             CS_REAL_TYPE,
+                             dim[i],
+                             true,  /* reverse */
+                             block_vals,
+                             new_vals[i]);
+
+  }
+
+  BFT_FREE(block_vals);
+
+  cs_all_to_all_destroy(&bpd);
+  cs_part_to_block_destroy(&pbd);
+}
+
+/*----------------------------------------------------------------------------
+ * Synchronize ghost values of a cell-based array.
+ *
+ * parameters:
+ *   m   <-- pointer to mesh structure
+ *   dim <-- dimension (interleaved stride) of array
+ *   val <-> array values
+ *----------------------------------------------------------------------------*/
+
+static void
+_sync_cell_vals(const cs_mesh_t  *m,
+                int               dim,
+                cs_real_t         val[])
+{
+  const cs_halo_t *halo = m->halo;
+
+  if (halo == NULL)
+    return;
+
+  if (dim == 1)
+    cs_halo_sync_var(halo, CS_HALO_EXTENDED, val);
+
+  else {
+
+    cs_halo_sync_var_strided(halo, CS_HALO_EXTENDED, val, dim);
+
+    if (m->n_init_perio > 0) {
+      switch(dim) {
+      case 9:
+        cs_halo_perio_sync_var_tens(halo, CS_HALO_EXTENDED, val);
+        break;
+      case 6:
+        cs_halo_perio_sync_var_sym_tens(halo, CS_HALO_EXTENDED, val);
+        break;
+      case 3:
+        cs_halo_perio_sync_var_vect(halo, CS_HALO_EXTENDED, val, 3);
+        break;
+      default:
+        break;
+      }
+    }
+
+  }
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the load imbalance threshold above which an in-run mesh
+ *        rebalance may be triggered.
+ *
+ * \param[in]  threshold  imbalance threshold (<= 0 to disable)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_rebalance_set_threshold(double  threshold)
+{
+  _imbalance_threshold = threshold;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the current load imbalance threshold for in-run
+ *        mesh rebalancing.
+ *
+ * \return  imbalance threshold (<= 0 if disabled)
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_mesh_rebalance_get_threshold(void)
+{
+  return _imbalance_threshold;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Evaluate the current cell-based load imbalance.
+ *
+ * The imbalance is defined as (n_max/n_mean - 1), where n_max and n_mean
+ * are respectively the maximum and mean number of cells per rank;
+ * 0 indicates a perfectly balanced distribution.
+ *
+ * \param[in]  m  pointer to mesh structure
+ *
+ * \return  cell-based load imbalance
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_mesh_rebalance_imbalance(const cs_mesh_t  *m)
+{
+  if (cs_glob_n_ranks < 2)
+    return 0.;
+
+  double n_max = m->n_cells;
+  cs_parall_max(1, CS_DOUBLE, &n_max);
+
+  double n_mean = (double)(m->n_g_cells) / cs_glob_n_ranks;
+
+  return (n_max/n_mean - 1.);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Repartition and redistribute the main mesh and associated
+ *        field values in memory.
+ *
+ * A new partition is computed using the currently selected partitioning
+ * algorithm (see \ref cs_partition), the mesh is redistributed through the
+ * mesh builder, halos and dependent mesh structures are rebuilt, and
+ * values of owner fields on cells, interior faces, boundary faces, and
+ * vertices are migrated to the new distribution.
+ *
+ * This function may be called inside the time step loop, but not while
+ * temporary arrays or structures based on the previous mesh distribution
+ * are in use.
+ *
+ * \param[in, out]  m  pointer to mesh structure (must be cs_glob_mesh)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_rebalance(cs_mesh_t  *m)
+{
+  assert(m == cs_glob_mesh);
+
+  if (cs_glob_n_ranks < 2)
+    return;
+
+#if defined(HAVE_MPI)
+
+  if (cs_field_pooled_allocation())
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: in-run mesh rebalancing is not compatible with\n"
+                "pooled field value allocation\n"
+                "(see cs_field_set_pooled_allocation)."),
+              __func__);
+
+  int t_stat_id = cs_timer_stats_id_by_name("mesh_processing");
+  int t_top_id = cs_timer_stats_switch(t_stat_id);
+
+  double t_start = cs_timer_wtime();
+
+  double imb_prev = cs_mesh_rebalance_imbalance(m);
+
+  const int n_fields = cs_field_n_fields();
+
+  /* Determine which locations carry field values to migrate */
+
+  bool loc_has_vals[_N_BASE_LOCATIONS] = {false, false, false, false};
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+    const cs_field_t *f = cs_field_by_id(f_id);
+    if (f->is_owner == false || f->val == NULL)
+      continue;
+    int l_rank = _base_location_rank(f->location_id);
+    if (l_rank < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: field \"%s\" is defined on mesh location %d (\"%s\"),\n"
+                  "whose elements cannot be matched across a change of\n"
+                  "mesh distribution."),
+                __func__, f->name, f->location_id,
+                cs_mesh_location_get_name(f->location_id));
+    loc_has_vals[l_rank] = true;
+  }
+
+  /* Save previous distribution info for concerned locations */
+
+  const cs_lnum_t n_old_ents[_N_BASE_LOCATIONS] = {m->n_cells,
+                                                   m->n_i_faces,
+                                                   m->n_b_faces,
+                                                   m->n_vertices};
+
+  const cs_gnum_t n_g_ents[_N_BASE_LOCATIONS] = {m->n_g_cells,
+                                                 m->n_g_i_faces,
+                                                 m->n_g_b_faces,
+                                                 m->n_g_vertices};
+
+  const cs_gnum_t *cur_gnum[_N_BASE_LOCATIONS] = {m->global_cell_num,
+                                                  m->global_i_face_num,
+                                                  m->global_b_face_num,
+                                                  m->global_vtx_num};
+
+  cs_gnum_t *old_gnum[_N_BASE_LOCATIONS] = {NULL, NULL, NULL, NULL};
+
+  for (int l_rank = 0; l_rank < _N_BASE_LOCATIONS; l_rank++) {
+    if (loc_has_vals[l_rank]) {
+      BFT_MALLOC(old_gnum[l_rank], n_old_ents[l_rank], cs_gnum_t);
+      memcpy(old_gnum[l_rank],
+             cur_gnum[l_rank],
+             n_old_ents[l_rank]*sizeof(cs_gnum_t));
+    }
+  }
+
+  /* Save field values, as the matching arrays will be resized
+     (and possibly moved) when the mesh is redistributed */
+
+  cs_real_t **f_save;
+  BFT_MALLOC(f_save, n_fields, cs_real_t *);
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+    const cs_field_t *f = cs_field_by_id(f_id);
+    f_save[f_id] = NULL;
+    if (f->is_owner == false || f->val == NULL)
+      continue;
+    int l_rank = _base_location_rank(f->location_id);
+    cs_lnum_t n = n_old_ents[l_rank] * (cs_lnum_t)(f->dim);
+    BFT_MALLOC(f_save[f_id], n*f->n_time_vals, cs_real_t);
+    for (int kk = 0; kk < f->n_time_vals; kk++)
+      memcpy(f_save[f_id] + kk*n, f->vals[kk], n*sizeof(cs_real_t));
+  }
+
+  /* Repartition and redistribute the mesh through the mesh builder,
+     as done when re-partitioning after in-memory mesh refinement */
+
+  cs_mesh_quantities_free_all(cs_glob_mesh_quantities);
+
+  cs_mesh_builder_destroy(&cs_glob_mesh_builder);
+  cs_glob_mesh_builder = cs_mesh_builder_create();
+  cs_mesh_to_builder(m, cs_glob_mesh_builder, true, NULL);
+
+  cs_partition(m, cs_glob_mesh_builder, CS_PARTITION_MAIN);
+
+  cs_mesh_from_builder(m, cs_glob_mesh_builder);
+  cs_mesh_init_halo(m, cs_glob_mesh_builder, m->halo_type, -1, true);
+  cs_mesh_update_auxiliary(m);
+
+  cs_mesh_builder_destroy(&cs_glob_mesh_builder);
+
+  /* Renumber for solver performance, as done at initialization
+     (global numbers are permuted along with all other mesh arrays) */
+
+  cs_renumber_cells(m);
+  cs_renumber_i_faces(m);
+  cs_renumber_b_faces(m);
+
+  m->n_b_faces_all = m->n_b_faces;
+  m->n_g_b_faces_all = m->n_g_b_faces;
+
+  /* Rebuild selectors, locations, and zones for the new distribution */
+
+  cs_mesh_init_selectors();
+  cs_mesh_location_build(m, -1);
+  cs_volume_zone_build_all(true);
+  cs_boundary_zone_build_all(true);
+
+  cs_boundary_conditions_invalidate_steady_bcs();
+
+  /* Resize field value arrays to the new location sizes */
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+    cs_field_t *f = cs_field_by_id(f_id);
+    if (f_save[f_id] != NULL)
+      cs_field_allocate_values(f);
+  }
+
+  /* Migrate field values location by location */
+
+  const cs_lnum_t n_new_ents[_N_BASE_LOCATIONS] = {m->n_cells,
+                                                   m->n_i_faces,
+                                                   m->n_b_faces,
+                                                   m->n_vertices};
+
+  const cs_gnum_t *new_gnum[_N_BASE_LOCATIONS] = {m->global_cell_num,
+                                                  m->global_i_face_num,
+                                                  m->global_b_face_num,
+                                                  m->global_vtx_num};
+
+  for (int l_rank = 0; l_rank < _N_BASE_LOCATIONS; l_rank++) {
+
+    if (loc_has_vals[l_rank] == false)
+      continue;
+
+    int n_arrays = 0;
+    for (int f_id = 0; f_id < n_fields; f_id++) {
+      const cs_field_t *f = cs_field_by_id(f_id);
+      if (   f_save[f_id] != NULL
+          && _base_location_rank(f->location_id) == l_rank)
+        n_arrays += f->n_time_vals;
+    }
+
+    int *a_dim;
+    cs_real_t **a_old_vals, **a_new_vals;
+    BFT_MALLOC(a_dim, n_arrays, int);
+    BFT_MALLOC(a_old_vals, n_arrays, cs_real_t *);
+    BFT_MALLOC(a_new_vals, n_arrays, cs_real_t *);
+
+    n_arrays = 0;
+    for (int f_id = 0; f_id < n_fields; f_id++) {
+      const cs_field_t *f = cs_field_by_id(f_id);
+      if (   f_save[f_id] == NULL
+          || _base_location_rank(f->location_id) != l_rank)
+        continue;
+      cs_lnum_t n = n_old_ents[l_rank] * (cs_lnum_t)(f->dim);
+      for (int kk = 0; kk < f->n_time_vals; kk++) {
+        a_dim[n_arrays] = f->dim;
+        a_old_vals[n_arrays] = f_save[f_id] + kk*n;
+        a_new_vals[n_arrays] = f->vals[kk];
+        n_arrays++;
+      }
+    }
+
+    _migrate_location_vals(n_g_ents[l_rank],
+                           n_old_ents[l_rank],
+                           old_gnum[l_rank],
+                           n_new_ents[l_rank],
+                           new_gnum[l_rank],
+                           n_arrays,
+                           a_dim,
+                           a_old_vals,
+                           a_new_vals);
+
+    BFT_FREE(a_new_vals);
+    BFT_FREE(a_old_vals);
+    BFT_FREE(a_dim);
+
+  }
+
+  /* Free saved values and previous global numbers */
+
+  for (int f_id = 0; f_id < n_fields; f_id++)
+    BFT_FREE(f_save[f_id]);
+  BFT_FREE(f_save);
+
+  for (int l_rank = 0; l_rank < _N_BASE_LOCATIONS; l_rank++)
+    BFT_FREE(old_gnum[l_rank]);
+
+  /* Update ghost values of cell-based fields */
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+    const cs_field_t *f = cs_field_by_id(f_id);
+    if (   f->is_owner == false || f->val == NULL
+        || f->location_id != CS_MESH_LOCATION_CELLS)
+      continue;
+    for (int kk = 0; kk < f->n_time_vals; kk++)
+      _sync_cell_vals(m, f->dim, f->vals[kk]);
+  }
+
+  /* Recompute geometric quantities and update dependent structures */
+
+  cs_mesh_quantities_compute(m, cs_glob_mesh_quantities);
+
+  cs_gradient_free_quantities();
+  cs_cell_to_vertex_free();
+  cs_vertex_to_cell_free();
+  cs_mesh_adjacencies_update_mesh();
+
+  cs_matrix_update_mesh();
+
+  /* Update Fortran mesh sizes and quantities */
+
+  cs_preprocess_mesh_update_fortran();
+
+  /* Update mapping for accelerated devices */
+
+#if defined(HAVE_ACCEL)
+  cs_preprocess_mesh_update_device();
+#endif
+
+  double t_end = cs_timer_wtime();
+
+  bft_printf
+    (_("\n"
+       "Mesh rebalancing:\n"
+       "  cell-based imbalance: %5.3f before, %5.3f after\n"
+       "  wall-clock time:      %.3g s\n"),
+     imb_prev, cs_mesh_rebalance_imbalance(m), t_end - t_start);
+
+  cs_timer_stats_switch(t_top_id);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Rebalance the main mesh if the cell-based load imbalance exceeds
+ *        the selected threshold.
+ *
+ * This is a no-op if no threshold has been set
+ * (see \ref cs_mesh_rebalance_set_threshold) or when not running
+ * in parallel.
+ *
+ * \return  true if the mesh was rebalanced, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_rebalance_if_needed(void)
+{
+  if (_imbalance_threshold <= 0. || cs_glob_n_ranks < 2)
+    return false;
+
+  if (cs_mesh_rebalance_imbalance(cs_glob_mesh) <= _imbalance_threshold)
+    return false;
+
+  cs_mesh_rebalance(cs_glob_mesh);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
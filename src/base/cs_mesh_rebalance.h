@@ -0,0 +1,136 @@
+#ifndef __CS_MESH_REBALANCE_H__
+#define __CS_MESH_REBALANCE_H__
+
+/*============================================================================
+ * In-memory mesh redistribution for dynamic load balancing.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+#include "cs_mesh.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the load imbalance threshold above which an in-run mesh
+ *        rebalance may be triggered.
+ *
+ * \param[in]  threshold  imbalance threshold (<= 0 to disable)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_rebalance_set_threshold(double  threshold);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the current load imbalance threshold for in-run
+ *        mesh rebalancing.
+ *
+ * \return  imbalance threshold (<= 0 if disabled)
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_mesh_rebalance_get_threshold(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Evaluate the current cell-based load imbalance.
+ *
+ * The imbalance is defined as (n_max/n_mean - 1), where n_max and n_mean
+ * are respectively the maximum and mean number of cells per rank;
+ * 0 indicates a perfectly balanced distribution.
+ *
+ * \param[in]  m  pointer to mesh structure
+ *
+ * \return  cell-based load imbalance
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_mesh_rebalance_imbalance(const cs_mesh_t  *m);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Repartition and redistribute the main mesh and associated
+ *        field values in memory.
+ *
+ * A new partition is computed using the currently selected partitioning
+ * algorithm (see \ref cs_partition), the mesh is redistributed through the
+ * mesh builder, halos and dependent mesh structures are rebuilt, and
+ * values of owner fields on cells, interior faces, boundary faces, and
+ * vertices are migrated to the new distribution.
+ *
+ * This function may be called inside the time step loop, but not while
+ * temporary arrays or structures based on the previous mesh distribution
+ * are in use.
+ *
+ * \param[in, out]  m  pointer to mesh structure (must be cs_glob_mesh)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_rebalance(cs_mesh_t  *m);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Rebalance the main mesh if the cell-based load imbalance exceeds
+ *        the selected threshold.
+ *
+ * This is a no-op if no threshold has been set
+ * (see \ref cs_mesh_rebalance_set_threshold) or when not running
+ * in parallel.
+ *
+ * \return  true if the mesh was rebalanced, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_rebalance_if_needed(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_REBALANCE_H__ */
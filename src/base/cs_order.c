@@ -41,6 +41,8 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_parall.h"
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -57,6 +59,13 @@ BEGIN_C_DECLS
  * Local structure definitions
  *============================================================================*/
 
+/* Above this size, scalar orderings use a threaded radix sort rather than
+   a serial heapsort; the radix sort is linear-time and its counting and
+   scatter passes are threaded, but it requires auxiliary storage
+   proportional to the input size */
+
+static const size_t _order_radix_threshold = 65536;
+
 /*=============================================================================
  * Private function definitions
  *============================================================================*/
@@ -109,6 +118,124 @@ _order_gnum_descend_tree(const cs_gnum_t   number[],
   order[level] = i_save;
 }
 
+/*----------------------------------------------------------------------------
+ * Order an array of global numbers using a multi-pass LSD radix sort.
+ *
+ * The sort is stable, and the counting and scatter passes of each digit
+ * are threaded, with each thread handling a fixed range of the input so
+ * that per-thread histograms may be combined into scatter offsets.
+ *
+ * parameters:
+ *   number   <-- array of entity numbers
+ *   order    --> pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_gnum_radix(const cs_gnum_t   number[],
+                  cs_lnum_t         order[],
+                  const size_t      nb_ent)
+{
+  /* Determine the number of 8-bit passes required from the maximum
+     key value, so that arrays of small numbers need fewer passes */
+
+  cs_gnum_t n_max = 0;
+
+# pragma omp parallel for reduction(max:n_max) if(nb_ent > CS_THR_MIN)
+  for (size_t i = 0; i < nb_ent; i++) {
+    if (number[i] > n_max)
+      n_max = number[i];
+  }
+
+  int n_passes = 1;
+  while ((n_max >>= 8) > 0)
+    n_passes += 1;
+
+  /* Ping-pong buffers for keys and matching initial positions; the
+     ordering array itself serves as one of the position buffers */
+
+  cs_gnum_t  *key[2];
+  cs_lnum_t  *ord[2];
+
+  BFT_MALLOC(key[0], nb_ent, cs_gnum_t);
+  BFT_MALLOC(key[1], nb_ent, cs_gnum_t);
+  BFT_MALLOC(ord[1], nb_ent, cs_lnum_t);
+  ord[0] = order;
+
+# pragma omp parallel for  if(nb_ent > CS_THR_MIN)
+  for (size_t i = 0; i < nb_ent; i++) {
+    key[0][i] = number[i];
+    order[i] = i;
+  }
+
+  size_t *h;
+  BFT_MALLOC(h, (size_t)cs_glob_n_threads*256, size_t);
+
+  int cur = 0;
+
+  for (int pass = 0; pass < n_passes; pass++) {
+
+    const int shift = pass*8;
+    const cs_gnum_t *k_src = key[cur];
+    const cs_lnum_t *o_src = ord[cur];
+    cs_gnum_t *k_dst = key[1-cur];
+    cs_lnum_t *o_dst = ord[1-cur];
+
+#   pragma omp parallel  if(nb_ent > CS_THR_MIN)
+    {
+      int n_t = 1, t_id = 0;
+#if defined(HAVE_OPENMP)
+      n_t = omp_get_num_threads();
+      t_id = omp_get_thread_num();
+#endif
+
+      cs_lnum_t s_id, e_id;
+      cs_parall_thread_range(nb_ent, sizeof(cs_gnum_t), &s_id, &e_id);
+
+      /* Per-thread digit histogram */
+
+      size_t *_h = h + (size_t)t_id*256;
+      for (int j = 0; j < 256; j++)
+        _h[j] = 0;
+      for (cs_lnum_t i = s_id; i < e_id; i++)
+        _h[(k_src[i] >> shift) & 0xff] += 1;
+
+#     pragma omp barrier
+
+      /* Transform histograms into scatter offsets, digit-major so
+         that the sort remains stable across thread ranges */
+
+#     pragma omp single
+      {
+        size_t sum = 0;
+        for (int j = 0; j < 256; j++) {
+          for (int t = 0; t < n_t; t++) {
+            size_t t_count = h[(size_t)t*256 + j];
+            h[(size_t)t*256 + j] = sum;
+            sum += t_count;
+          }
+        }
+      }  /* implicit barrier at end of single section */
+
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
+        size_t j = _h[(k_src[i] >> shift) & 0xff]++;
+        k_dst[j] = k_src[i];
+        o_dst[j] = o_src[i];
+      }
+    }
+
+    cur = 1 - cur;
+  }
+
+  if (cur != 0)
+    memcpy(order, ord[1], nb_ent*sizeof(cs_lnum_t));
+
+  BFT_FREE(h);
+  BFT_FREE(key[0]);
+  BFT_FREE(key[1]);
+  BFT_FREE(ord[1]);
+}
+
 /*----------------------------------------------------------------------------
  * Order an array of global numbers.
  *
@@ -127,6 +254,14 @@ _order_gnum(const cs_gnum_t   number[],
   size_t i;
   cs_lnum_t o_save;
 
+  /* Use the radix sort for large arrays, where its auxiliary storage
+     is worth the linear-time, threaded operation */
+
+  if (nb_ent >= _order_radix_threshold) {
+    _order_gnum_radix(number, order, nb_ent);
+    return;
+  }
+
   /* Initialize ordering array */
 
   for (i = 0 ; i < nb_ent ; i++)
@@ -520,6 +655,112 @@ _order_lnum_descend_tree(const cs_lnum_t   number[],
   order[level] = i_save;
 }
 
+/*----------------------------------------------------------------------------
+ * Order an array of local numbers using a multi-pass LSD radix sort.
+ *
+ * This is the cs_lnum_t counterpart of _order_gnum_radix, and assumes
+ * all values are non-negative (the caller should check for this).
+ *
+ * parameters:
+ *   number   <-- array of entity numbers
+ *   order    --> pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_lnum_radix(const cs_lnum_t   number[],
+                  cs_lnum_t         order[],
+                  const size_t      nb_ent)
+{
+  cs_lnum_t n_max = 0;
+
+# pragma omp parallel for reduction(max:n_max) if(nb_ent > CS_THR_MIN)
+  for (size_t i = 0; i < nb_ent; i++) {
+    if (number[i] > n_max)
+      n_max = number[i];
+  }
+
+  int n_passes = 1;
+  while ((n_max >>= 8) > 0)
+    n_passes += 1;
+
+  cs_lnum_t  *key[2];
+  cs_lnum_t  *ord[2];
+
+  BFT_MALLOC(key[0], nb_ent, cs_lnum_t);
+  BFT_MALLOC(key[1], nb_ent, cs_lnum_t);
+  BFT_MALLOC(ord[1], nb_ent, cs_lnum_t);
+  ord[0] = order;
+
+# pragma omp parallel for  if(nb_ent > CS_THR_MIN)
+  for (size_t i = 0; i < nb_ent; i++) {
+    key[0][i] = number[i];
+    order[i] = i;
+  }
+
+  size_t *h;
+  BFT_MALLOC(h, (size_t)cs_glob_n_threads*256, size_t);
+
+  int cur = 0;
+
+  for (int pass = 0; pass < n_passes; pass++) {
+
+    const int shift = pass*8;
+    const cs_lnum_t *k_src = key[cur];
+    const cs_lnum_t *o_src = ord[cur];
+    cs_lnum_t *k_dst = key[1-cur];
+    cs_lnum_t *o_dst = ord[1-cur];
+
+#   pragma omp parallel  if(nb_ent > CS_THR_MIN)
+    {
+      int n_t = 1, t_id = 0;
+#if defined(HAVE_OPENMP)
+      n_t = omp_get_num_threads();
+      t_id = omp_get_thread_num();
+#endif
+
+      cs_lnum_t s_id, e_id;
+      cs_parall_thread_range(nb_ent, sizeof(cs_lnum_t), &s_id, &e_id);
+
+      size_t *_h = h + (size_t)t_id*256;
+      for (int j = 0; j < 256; j++)
+        _h[j] = 0;
+      for (cs_lnum_t i = s_id; i < e_id; i++)
+        _h[(k_src[i] >> shift) & 0xff] += 1;
+
+#     pragma omp barrier
+
+#     pragma omp single
+      {
+        size_t sum = 0;
+        for (int j = 0; j < 256; j++) {
+          for (int t = 0; t < n_t; t++) {
+            size_t t_count = h[(size_t)t*256 + j];
+            h[(size_t)t*256 + j] = sum;
+            sum += t_count;
+          }
+        }
+      }  /* implicit barrier at end of single section */
+
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
+        size_t j = _h[(k_src[i] >> shift) & 0xff]++;
+        k_dst[j] = k_src[i];
+        o_dst[j] = o_src[i];
+      }
+    }
+
+    cur = 1 - cur;
+  }
+
+  if (cur != 0)
+    memcpy(order, ord[1], nb_ent*sizeof(cs_lnum_t));
+
+  BFT_FREE(h);
+  BFT_FREE(key[0]);
+  BFT_FREE(key[1]);
+  BFT_FREE(ord[1]);
+}
+
 /*----------------------------------------------------------------------------
  * Order an array of local numbers.
  *
@@ -538,6 +779,22 @@ _order_lnum(const cs_lnum_t   number[],
   size_t i;
   cs_lnum_t o_save;
 
+  /* Use the radix sort for large arrays of non-negative values
+     (negative values would not compare correctly digit by digit) */
+
+  if (nb_ent >= _order_radix_threshold) {
+    cs_lnum_t n_min = 0;
+#   pragma omp parallel for reduction(min:n_min) if(nb_ent > CS_THR_MIN)
+    for (i = 0; i < nb_ent; i++) {
+      if (number[i] < n_min)
+        n_min = number[i];
+    }
+    if (n_min >= 0) {
+      _order_lnum_radix(number, order, nb_ent);
+      return;
+    }
+  }
+
   /* Initialize ordering array */
 
   for (i = 0 ; i < nb_ent ; i++)
@@ -40,6 +40,7 @@
 
 #include "bft_error.h"
 #include "bft_mem.h"
+#include "cs_log.h"
 #include "cs_order.h"
 
 /*----------------------------------------------------------------------------
@@ -162,6 +163,10 @@ static size_t _cs_parall_min_coll_buf_size = 1024*1024;
 
 cs_e2n_sum_t cs_glob_e2n_sum_type = CS_E2N_SUM_SCATTER;
 
+/* The global reduction call counter and timer (cs_parall_n_reduce_calls,
+   cs_parall_reduce_timer) are defined in cs_timer.c, so that code using
+   only the core library links without this file. */
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -317,9 +322,15 @@ _cs_parall_allreduce(int             n,
 
   memcpy(locval, val, data_size);
 
+  cs_timer_t t0 = cs_timer_time();
+
   MPI_Allreduce(locval, val, n, cs_datatype_to_mpi[datatype], operation,
                 cs_glob_mpi_comm);
 
+  cs_timer_t t1 = cs_timer_time();
+  cs_parall_n_reduce_calls += 1;
+  cs_timer_counter_add_diff(&cs_parall_reduce_timer, &t0, &t1);
+
   if (locval != _locval)
     BFT_FREE(locval);
 }
@@ -1343,6 +1354,59 @@ cs_parall_set_min_coll_buf_size(size_t buffer_size)
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log performance information relative to global reductions.
+ *
+ * Time spent in the reduction wrappers is cumulated over the run;
+ * as reductions synchronize all ranks, the spread of this time across
+ * ranks reflects computational load imbalance ahead of the reductions.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_log_finalize(void)
+{
+#if defined(HAVE_MPI)
+
+  if (cs_parall_n_reduce_calls < 1 || cs_glob_n_ranks < 2)
+    return;
+
+  double wtime = cs_parall_reduce_timer.nsec*1e-9;
+  double wtime_mean = wtime, wtime_min = wtime, wtime_max = wtime;
+
+  MPI_Allreduce(&wtime, &wtime_mean, 1, MPI_DOUBLE, MPI_SUM,
+                cs_glob_mpi_comm);
+  MPI_Allreduce(&wtime, &wtime_min, 1, MPI_DOUBLE, MPI_MIN,
+                cs_glob_mpi_comm);
+  MPI_Allreduce(&wtime, &wtime_max, 1, MPI_DOUBLE, MPI_MAX,
+                cs_glob_mpi_comm);
+
+  wtime_mean /= cs_glob_n_ranks;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nGlobal reductions:\n\n"));
+
+  cs_log_printf
+    (CS_LOG_PERFORMANCE,
+     _("                             mean        minimum      maximum"
+       "     calls\n"
+       "  Wall time:         %12.5f s %12.5f %12.5f s   %llu\n"),
+     wtime_mean, wtime_min, wtime_max,
+     cs_parall_n_reduce_calls);
+
+  if (wtime_mean > 0)
+    cs_log_printf
+      (CS_LOG_PERFORMANCE,
+       _("  Imbalance ((max-mean)/mean): %.1f %%\n"),
+       (wtime_max - wtime_mean)/wtime_mean*100.);
+
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+  cs_log_separator(CS_LOG_PERFORMANCE);
+
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -32,6 +32,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_defs.h"
+#include "cs_timer.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -68,6 +69,16 @@ typedef enum {
 
 extern cs_e2n_sum_t cs_glob_e2n_sum_type;
 
+#if defined(HAVE_MPI)
+
+/* Call counter and timer for global reductions, cumulated by the
+   reduction wrappers below (see cs_parall_log_finalize) */
+
+extern unsigned long long  cs_parall_n_reduce_calls;
+extern cs_timer_counter_t  cs_parall_reduce_timer;
+
+#endif
+
 /*=============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -88,8 +99,12 @@ cs_parall_counter(cs_gnum_t   cpt[],
                   const int   n)
 {
   if (cs_glob_n_ranks > 1) {
+    cs_timer_t t0 = cs_timer_time();
     MPI_Allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_GNUM, MPI_SUM,
                   cs_glob_mpi_comm);
+    cs_timer_t t1 = cs_timer_time();
+    cs_parall_n_reduce_calls += 1;
+    cs_timer_counter_add_diff(&cs_parall_reduce_timer, &t0, &t1);
   }
 }
 
@@ -121,8 +136,12 @@ cs_parall_counter_max(cs_lnum_t   cpt[],
                       const int   n)
 {
   if (cs_glob_n_ranks > 1) {
+    cs_timer_t t0 = cs_timer_time();
     MPI_Allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_LNUM, MPI_MAX,
                   cs_glob_mpi_comm);
+    cs_timer_t t1 = cs_timer_time();
+    cs_parall_n_reduce_calls += 1;
+    cs_timer_counter_add_diff(&cs_parall_reduce_timer, &t0, &t1);
   }
 }
 
@@ -156,8 +175,12 @@ cs_parall_sum(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
+    cs_timer_t t0 = cs_timer_time();
     MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_SUM,
                   cs_glob_mpi_comm);
+    cs_timer_t t1 = cs_timer_time();
+    cs_parall_n_reduce_calls += 1;
+    cs_timer_counter_add_diff(&cs_parall_reduce_timer, &t0, &t1);
   }
 }
 
@@ -193,8 +216,12 @@ cs_parall_max(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
+    cs_timer_t t0 = cs_timer_time();
     MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_MAX,
                   cs_glob_mpi_comm);
+    cs_timer_t t1 = cs_timer_time();
+    cs_parall_n_reduce_calls += 1;
+    cs_timer_counter_add_diff(&cs_parall_reduce_timer, &t0, &t1);
   }
 }
 
@@ -230,8 +257,12 @@ cs_parall_min(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
+    cs_timer_t t0 = cs_timer_time();
     MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_MIN,
                   cs_glob_mpi_comm);
+    cs_timer_t t1 = cs_timer_time();
+    cs_parall_n_reduce_calls += 1;
+    cs_timer_counter_add_diff(&cs_parall_reduce_timer, &t0, &t1);
   }
 }
 
@@ -280,6 +311,19 @@ cs_parall_bcast(int             root_rank,
 
 #endif
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log performance information relative to global reductions.
+ *
+ * Time spent in the reduction wrappers above is cumulated over the run;
+ * as reductions synchronize all ranks, the spread of this time across
+ * ranks reflects computational load imbalance ahead of the reductions.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_log_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Build a global array from each local array in each domain.
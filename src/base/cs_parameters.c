@@ -1075,6 +1075,10 @@ cs_parameters_define_field_keys(void)
   cs_field_define_key_double("time_step_factor",
                              1., CS_FIELD_VARIABLE); /* cdtvar(ivar) */
 
+  /* Sub-cycling interval: fields with an interval n > 1 are only solved
+     every n time steps, with the accumulated time step */
+  cs_field_define_key_int("time_step_interval", 1, CS_FIELD_VARIABLE);
+
   cs_field_define_key_double("turbulent_schmidt",
                              1., CS_FIELD_VARIABLE); /* sigmas(iscal) */
   cs_field_define_key_int("turbulent_schmidt_id", -1, CS_FIELD_VARIABLE);
@@ -138,6 +138,17 @@ typedef void
                           const cs_real_t                    var2[],
                           cs_real_t                          val[]);
 
+typedef void
+(cs_phys_prop_coolprop_multi_t)(const char                        *coolprop_material,
+                                const char                        *coolprop_backend,
+                                cs_phys_prop_thermo_plane_type_t   thermo_plane,
+                                int                                n_props,
+                                const cs_phys_prop_type_t          properties[],
+                                const cs_lnum_t                    n_vals,
+                                const cs_real_t                    var1[],
+                                const cs_real_t                    var2[],
+                                cs_real_t                         *val[]);
+
 typedef void
 (cs_finalize_t)(void);
 
@@ -163,6 +174,7 @@ static cs_phys_prop_eos_t       *_cs_phys_prop_eos = NULL;
 
 static char                     *_cs_coolprop_backend = NULL;
 static cs_phys_prop_coolprop_t  *_cs_phys_prop_coolprop = NULL;
+static cs_phys_prop_coolprop_multi_t  *_cs_phys_prop_coolprop_multi = NULL;
 #if defined(HAVE_PLUGINS)
 static void                     *_cs_coolprop_dl_lib = NULL;
 #endif
@@ -336,10 +348,16 @@ cs_thermal_table_set(const char                        *material,
         cs_base_get_dl_function_pointer(_cs_coolprop_dl_lib,
                                         "cs_phys_prop_coolprop",
                                         true);
+      _cs_phys_prop_coolprop_multi = (cs_phys_prop_coolprop_multi_t *) (intptr_t)
+        cs_base_get_dl_function_pointer(_cs_coolprop_dl_lib,
+                                        "cs_phys_prop_coolprop_multi",
+                                        true);
     }
 #else
     _cs_phys_prop_coolprop = (cs_phys_prop_coolprop_t *)  (intptr_t)
       cs_phys_prop_coolprop;
+    _cs_phys_prop_coolprop_multi = (cs_phys_prop_coolprop_multi_t *) (intptr_t)
+      cs_phys_prop_coolprop_multi;
 #endif
 #endif
   }
@@ -422,6 +440,7 @@ cs_thermal_table_finalize(void)
       coolprop_finalize();
       cs_base_dlclose("cs_coolprop", _cs_coolprop_dl_lib);
       _cs_phys_prop_coolprop = NULL;
+      _cs_phys_prop_coolprop_multi = NULL;
     }
     BFT_FREE(_cs_coolprop_backend);
 #endif
@@ -508,38 +527,45 @@ cs_physical_properties_set_coolprop_backend(const char  *backend)
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief Compute a physical property.
+ * \brief Compute several physical properties from the same input plane.
+ *
+ * All properties are evaluated at the same thermodynamic states, so the
+ * input preparation (stride expansion, temperature scale conversion) is
+ * done once, and backends supporting it (CoolProp) deduce all properties
+ * from a single equation of state or property table evaluation per element.
  *
  * For values var1 and var2, we can use a stride so that accesses for a given
  * element with id i will be of the form: var[i*stride]; this allows regular
  * access with stride 1, and access to constant variables stored as a
  * single-valued array with a stride of 0.
  *
- * \param[in]   property      property queried
+ * \param[in]   n_props       number of properties queried
+ * \param[in]   properties    properties queried
  * \param[in]   n_vals        number of values
  * \param[in]   var1_stride   stride between successive values of var1
  * \param[in]   var2_stride   stride between successive values of var2
  * \param[in]   var1          values on first plane axis
  * \param[in]   var2          values on second plane axis
- * \param[out]  val           resulting property values
+ * \param[out]  vals          resulting property value arrays
  */
 /*----------------------------------------------------------------------------*/
 
 void
-cs_phys_prop_compute(cs_phys_prop_type_t          property,
-                     cs_lnum_t                    n_vals,
-                     cs_lnum_t                    var1_stride,
-                     cs_lnum_t                    var2_stride,
-                     const cs_real_t              var1[],
-                     const cs_real_t              var2[],
-                     cs_real_t                    val[])
+cs_phys_prop_compute_multi(int                          n_props,
+                           const cs_phys_prop_type_t    properties[],
+                           cs_lnum_t                    n_vals,
+                           cs_lnum_t                    var1_stride,
+                           cs_lnum_t                    var2_stride,
+                           const cs_real_t              var1[],
+                           const cs_real_t              var2[],
+                           cs_real_t                   *vals[])
 {
   cs_lnum_t        _n_vals = n_vals;
   cs_real_t         _var2_c_single[1];
   cs_real_t        *_var1_c = NULL, *_var2_c = NULL;
   const cs_real_t  *var1_c = var1, *var2_c = var2;
 
-  if (n_vals < 1)
+  if (n_vals < 1 || n_props < 1)
     return;
 
   /* Adapt to different strides to optimize for constant arrays */
@@ -584,24 +610,27 @@ cs_phys_prop_compute(cs_phys_prop_type_t          property,
 
 #if defined(HAVE_EOS) /* always a plugin */
   if (cs_glob_thermal_table->type == CS_PHYS_PROP_TABLE_EOS) {
-    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
-                      property,
-                      _n_vals,
-                      var1_c,
-                      var2_c,
-                      val);
+    /* The EOS interface is per-property, so loop here */
+    for (int i = 0; i < n_props; i++)
+      _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
+                        properties[i],
+                        _n_vals,
+                        var1_c,
+                        var2_c,
+                        vals[i]);
   }
 #endif
 #if defined(HAVE_COOLPROP)
   if (cs_glob_thermal_table->type == CS_PHYS_PROP_TABLE_COOLPROP) {
-    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
-                           _cs_coolprop_backend,
-                           cs_glob_thermal_table->thermo_plane,
-                           property,
-                           _n_vals,
-                           var1_c,
-                           var2_c,
-                           val);
+    _cs_phys_prop_coolprop_multi(cs_glob_thermal_table->material,
+                                 _cs_coolprop_backend,
+                                 cs_glob_thermal_table->thermo_plane,
+                                 n_props,
+                                 properties,
+                                 _n_vals,
+                                 var1_c,
+                                 var2_c,
+                                 vals);
   }
 #endif
 
@@ -614,12 +643,54 @@ cs_phys_prop_compute(cs_phys_prop_type_t          property,
   /* In case of single value, apply to all */
 
   if (_n_vals == 1) {
-    cs_real_t val_const = val[0];
-    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
-      val[ii] = val_const;
+    for (int i = 0; i < n_props; i++) {
+      cs_real_t val_const = vals[i][0];
+      for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+        vals[i][ii] = val_const;
+    }
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute a physical property.
+ *
+ * For values var1 and var2, we can use a stride so that accesses for a given
+ * element with id i will be of the form: var[i*stride]; this allows regular
+ * access with stride 1, and access to constant variables stored as a
+ * single-valued array with a stride of 0.
+ *
+ * \param[in]   property      property queried
+ * \param[in]   n_vals        number of values
+ * \param[in]   var1_stride   stride between successive values of var1
+ * \param[in]   var2_stride   stride between successive values of var2
+ * \param[in]   var1          values on first plane axis
+ * \param[in]   var2          values on second plane axis
+ * \param[out]  val           resulting property values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_phys_prop_compute(cs_phys_prop_type_t          property,
+                     cs_lnum_t                    n_vals,
+                     cs_lnum_t                    var1_stride,
+                     cs_lnum_t                    var2_stride,
+                     const cs_real_t              var1[],
+                     const cs_real_t              var2[],
+                     cs_real_t                    val[])
+{
+  cs_real_t *_val[1] = {val};
+
+  cs_phys_prop_compute_multi(1,
+                             &property,
+                             n_vals,
+                             var1_stride,
+                             var2_stride,
+                             var1,
+                             var2,
+                             _val);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Get reference value of a physical property
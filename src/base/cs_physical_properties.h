@@ -134,6 +134,40 @@ cs_physical_properties_get_coolprop_backend(void);
 void
 cs_physical_properties_set_coolprop_backend(const char  *backend);
 
+/*----------------------------------------------------------------------------
+ * Compute several physical properties from the same input plane.
+ *
+ * All properties are evaluated at the same thermodynamic states, so the
+ * input preparation is done once, and backends supporting it (CoolProp)
+ * deduce all properties from a single equation of state or property table
+ * evaluation per element.
+ *
+ * For values var1 and var2, we can use a stride so that accesses for a given
+ * element with id i will be of the form: var[i*stride]; this allows regular
+ * access with stride 1, and access to constant variables stored as a
+ * single-valued array with a stride of 0.
+ *
+ * parameters:
+ *   n_props      <-- number of properties queried
+ *   properties   <-- properties queried
+ *   n_vals       <-- number of values
+ *   var1_stride  <-- stride between successive values of var1
+ *   var2_stride  <-- stride between successive values of var2
+ *   var1         <-- values on first plane axis
+ *   var2         <-- values on second plane axis
+ *   vals         --> resulting property value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+cs_phys_prop_compute_multi(int                          n_props,
+                           const cs_phys_prop_type_t    properties[],
+                           cs_lnum_t                    n_vals,
+                           cs_lnum_t                    var1_stride,
+                           cs_lnum_t                    var2_stride,
+                           const cs_real_t              var1[],
+                           const cs_real_t              var2[],
+                           cs_real_t                   *vals[]);
+
 /*----------------------------------------------------------------------------
  * Compute a physical property.
  *
@@ -317,6 +317,18 @@ typedef struct {
   cs_lnum_t               n_i_faces;     /* N. associated interior faces */
   cs_lnum_t               n_b_faces;     /* N. associated boundary faces */
 
+  cs_lnum_t               prev_dims[4];  /* Main mesh dimensions (cells,
+                                            interior faces, boundary faces,
+                                            vertices) at the last nodal mesh
+                                            extraction, or first value -1 if
+                                            no extraction is cached */
+  cs_lnum_t               prev_n_elts[3]; /* Number of cells, interior faces,
+                                             and boundary faces selected at
+                                             the last extraction */
+  cs_lnum_t              *prev_elt_ids[3]; /* Matching (sorted) element
+                                              lists, or NULL for full or
+                                              empty ranges */
+
   double                  density;       /* Particles density in case
                                             of particle mesh */
 
@@ -353,6 +365,18 @@ fvm_writer_time_dep_t  _cs_post_mod_flag_min = FVM_WRITER_FIXED_MESH;
 
 static bool        _number_particles_by_coord = false;
 
+/* Shared buffers for particle attribute output; the extraction buffer is
+   grown to the largest attribute extracted so far and reused across the
+   successive per-attribute writes of an output pass, and the extracted
+   particle list is cached across those writes, as it only depends on the
+   associated mesh */
+
+static size_t             _particle_vals_size = 0;
+static unsigned char     *_particle_vals = NULL;
+
+static const fvm_nodal_t *_particle_list_mesh = NULL;
+static cs_lnum_t         *_particle_list = NULL;
+
 /* Array of exportable meshes associated with post-processing;
    free ids start under the last CS_POST_MESH_* definition,
    currently at -5) */
@@ -1191,6 +1215,13 @@ _predefine_mesh(int        mesh_id,
   post_mesh->n_i_faces = 0;
   post_mesh->n_b_faces = 0;
 
+  for (j = 0; j < 4; j++)
+    post_mesh->prev_dims[j] = -1;
+  for (j = 0; j < 3; j++) {
+    post_mesh->prev_n_elts[j] = 0;
+    post_mesh->prev_elt_ids[j] = NULL;
+  }
+
   post_mesh->density = 1.;
 
   post_mesh->exp_mesh = NULL;
@@ -1256,6 +1287,9 @@ _free_mesh(int _mesh_id)
   for (i = 0; i < 5; i++)
     BFT_FREE(post_mesh->criteria[i]);
 
+  for (i = 0; i < 3; i++)
+    BFT_FREE(post_mesh->prev_elt_ids[i]);
+
   BFT_FREE(post_mesh->name);
   BFT_FREE(post_mesh->a_field_info);
 
@@ -1497,6 +1531,11 @@ _define_particle_export_mesh(cs_post_mesh_t        *post_mesh,
 
   assert(ts != NULL);
 
+  /* Invalidate the particle list cached for attribute output, as it is
+     associated with the previously defined mesh */
+
+  _particle_list_mesh = NULL;
+
   /* Create associated structure */
 
   {
@@ -1647,23 +1686,27 @@ _define_particle_export_mesh(cs_post_mesh_t        *post_mesh,
 }
 
 /*----------------------------------------------------------------------------
- * Initialize a volume or surface post-processing mesh based on its
- * selection criteria or selection functions.
+ * Build the element lists of a volume or surface post-processing mesh,
+ * based on its mesh location, selection criteria, or selection functions.
+ *
+ * The returned lists should be freed by the caller (or have their
+ * ownership transferred through _save_mesh_selection).
  *
  * parameters:
- *   post_mesh <-> pointer to partially initialized post-processing mesh
- *   ts        <-- time step structure
+ *   post_mesh <-> pointer to post-processing mesh structure
+ *   n_sel     --> number of selected cells, interior and boundary faces
+ *   sel_ids   --> matching element lists, or NULL for full or empty ranges
  *----------------------------------------------------------------------------*/
 
 static void
-_define_regular_mesh(cs_post_mesh_t  *post_mesh)
+_define_regular_mesh_lists(cs_post_mesh_t  *post_mesh,
+                           cs_lnum_t        n_sel[3],
+                           cs_lnum_t       *sel_ids[3])
 {
   const cs_mesh_t *mesh = cs_glob_mesh;
 
   assert(post_mesh != NULL);
 
-  assert(post_mesh->exp_mesh == NULL);
-
   cs_lnum_t n_cells = 0, n_i_faces = 0, n_b_faces = 0;
   cs_lnum_t *cell_list = NULL, *i_face_list = NULL, *b_face_list = NULL;
 
@@ -1751,19 +1794,128 @@ _define_regular_mesh(cs_post_mesh_t  *post_mesh)
     sel_func(post_mesh->sel_input[2], &n_b_faces, &b_face_list);
   }
 
+  n_sel[0] = n_cells;
+  n_sel[1] = n_i_faces;
+  n_sel[2] = n_b_faces;
+
+  sel_ids[0] = cell_list;
+  sel_ids[1] = i_face_list;
+  sel_ids[2] = b_face_list;
+}
+
+/*----------------------------------------------------------------------------
+ * Save the element selection used for a post-processing mesh's last nodal
+ * mesh extraction, with the main mesh dimensions at that time.
+ *
+ * Ownership of the given element lists is transferred to the saved
+ * selection, so the caller should not free them.
+ *
+ * parameters:
+ *   post_mesh <-> pointer to post-processing mesh structure
+ *   n_sel     <-- number of selected cells, interior and boundary faces
+ *   sel_ids   <-> matching element lists, or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_save_mesh_selection(cs_post_mesh_t   *post_mesh,
+                     const cs_lnum_t   n_sel[3],
+                     cs_lnum_t        *sel_ids[3])
+{
+  const cs_mesh_t *mesh = cs_glob_mesh;
+
+  post_mesh->prev_dims[0] = mesh->n_cells;
+  post_mesh->prev_dims[1] = mesh->n_i_faces;
+  post_mesh->prev_dims[2] = mesh->n_b_faces;
+  post_mesh->prev_dims[3] = mesh->n_vertices;
+
+  for (int i = 0; i < 3; i++) {
+    post_mesh->prev_n_elts[i] = n_sel[i];
+    BFT_FREE(post_mesh->prev_elt_ids[i]);
+    post_mesh->prev_elt_ids[i] = sel_ids[i];
+    sel_ids[i] = NULL;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compare an element selection with the one saved at a post-processing
+ * mesh's last nodal mesh extraction.
+ *
+ * Only the local selection is checked here, so the result must be reduced
+ * over all ranks before being acted upon.
+ *
+ * parameters:
+ *   post_mesh <-- pointer to post-processing mesh structure
+ *   n_sel     <-- number of selected cells, interior and boundary faces
+ *   sel_ids   <-- matching element lists, or NULL
+ *
+ * returns:
+ *   true if a selection is saved and matches, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_mesh_selection_unchanged(const cs_post_mesh_t    *post_mesh,
+                          const cs_lnum_t          n_sel[3],
+                          cs_lnum_t  *const        sel_ids[3])
+{
+  const cs_mesh_t *mesh = cs_glob_mesh;
+
+  if (   post_mesh->prev_dims[0] != mesh->n_cells
+      || post_mesh->prev_dims[1] != mesh->n_i_faces
+      || post_mesh->prev_dims[2] != mesh->n_b_faces
+      || post_mesh->prev_dims[3] != mesh->n_vertices)
+    return false;
+
+  for (int i = 0; i < 3; i++) {
+    if (post_mesh->prev_n_elts[i] != n_sel[i])
+      return false;
+    const cs_lnum_t *p = post_mesh->prev_elt_ids[i];
+    const cs_lnum_t *q = sel_ids[i];
+    if ((p != NULL) != (q != NULL))
+      return false;
+    if (p != NULL) {
+      if (memcmp(p, q, n_sel[i]*sizeof(cs_lnum_t)) != 0)
+        return false;
+    }
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize a volume or surface post-processing mesh based on its
+ * selection criteria or selection functions.
+ *
+ * parameters:
+ *   post_mesh <-> pointer to partially initialized post-processing mesh
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_regular_mesh(cs_post_mesh_t  *post_mesh)
+{
+  assert(post_mesh != NULL);
+
+  assert(post_mesh->exp_mesh == NULL);
+
+  cs_lnum_t   n_sel[3];
+  cs_lnum_t  *sel_ids[3];
+
+  _define_regular_mesh_lists(post_mesh, n_sel, sel_ids);
+
   /* Define mesh based on current arguments */
 
   _define_export_mesh(post_mesh,
-                      n_cells,
-                      n_i_faces,
-                      n_b_faces,
-                      cell_list,
-                      i_face_list,
-                      b_face_list);
-
-  BFT_FREE(cell_list);
-  BFT_FREE(i_face_list);
-  BFT_FREE(b_face_list);
+                      n_sel[0],
+                      n_sel[1],
+                      n_sel[2],
+                      sel_ids[0],
+                      sel_ids[1],
+                      sel_ids[2]);
+
+  /* Keep the selection (sorted by _define_export_mesh), so that later
+     redefinitions of time-varying meshes may detect that the extraction
+     is still valid */
+
+  _save_mesh_selection(post_mesh, n_sel, sel_ids);
 }
 
 /*----------------------------------------------------------------------------
@@ -1945,6 +2097,52 @@ static void
 _redefine_mesh(cs_post_mesh_t        *post_mesh,
                const cs_time_step_t  *ts)
 {
+  /* For standard (non-particle, non-probe) meshes we own, first check
+     whether the selection actually changed since the last extraction:
+     with geometric selection criteria on a moving or adaptive mesh, most
+     time steps select the same elements, and the nodal mesh extraction
+     may then be kept as is. The decision must be consistent across
+     ranks, so the local comparison result is reduced globally. */
+
+  if (   post_mesh->exp_mesh != NULL && post_mesh->_exp_mesh != NULL
+      && post_mesh->ent_flag[3] == 0 && post_mesh->ent_flag[4] == 0
+      && post_mesh->edges_ref < 0
+      && post_mesh->prev_dims[0] > -1) {
+
+    cs_lnum_t   n_sel[3];
+    cs_lnum_t  *sel_ids[3];
+
+    _define_regular_mesh_lists(post_mesh, n_sel, sel_ids);
+
+    int changed
+      = _mesh_selection_unchanged(post_mesh, n_sel,
+                                  (cs_lnum_t *const *)sel_ids) ? 0 : 1;
+    cs_parall_max(1, CS_INT_TYPE, &changed);
+
+    if (changed == 0) {
+      for (int i = 0; i < 3; i++)
+        BFT_FREE(sel_ids[i]);
+      return;
+    }
+
+    /* Rebuild from the freshly computed selection */
+
+    post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
+    post_mesh->exp_mesh = NULL;
+
+    _define_export_mesh(post_mesh,
+                        n_sel[0],
+                        n_sel[1],
+                        n_sel[2],
+                        sel_ids[0],
+                        sel_ids[1],
+                        sel_ids[2]);
+
+    _save_mesh_selection(post_mesh, n_sel, sel_ids);
+
+    return;
+  }
+
   /* Remove previous base structure (return if we do not own the mesh) */
 
   if (post_mesh->exp_mesh != NULL) {
@@ -4151,6 +4349,9 @@ cs_f_post_write_var(int               mesh_id,
  *         pyramids), so that any post-processing tool can recognize them.
  * - \c \b separate_meshes to multiple meshes and associated fields to
  *         separate outputs.
+ * - \c \b keep_open to keep the output file open between field outputs,
+ *         closing it only when the writer is flushed (for \c \b MED);
+ *         this groups metadata updates when writing many fields.
  *
  * Note that the white-spaces in the beginning or in the end of the
  * character strings given as arguments here are suppressed automatically.
@@ -5940,6 +6141,44 @@ cs_post_get_writer(int  writer_id)
   return writer->writer;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum number of fields buffered for deferred output
+ *        for a specific writer or for all writers.
+ *
+ * When this limit is greater than 0, field values passed to a writer are
+ * snapshotted rather than output immediately, and the actual writes are
+ * grouped when the writer is flushed at the end of the current output
+ * stage; if the limit is reached beforehand, pending fields are output
+ * at that point. A limit of 0 (the default) restores direct output.
+ *
+ * \param[in]  writer_id     writer id, or 0 for all writers
+ * \param[in]  n_fields_max  maximum number of buffered fields,
+ *                           or 0 for direct output
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_set_writer_field_buffering(int  writer_id,
+                                   int  n_fields_max)
+{
+  if (writer_id != 0) {
+    int i = _cs_post_writer_id(writer_id);
+    cs_post_writer_t  *writer = _cs_post_writers + i;
+    if (writer->writer == NULL)
+      _init_writer(writer);
+    fvm_writer_set_buffered_fields(writer->writer, n_fields_max);
+  }
+  else {
+    for (int i = 0; i < _cs_post_n_writers; i++) {
+      cs_post_writer_t  *writer = _cs_post_writers + i;
+      if (writer->writer == NULL)
+        _init_writer(writer);
+      fvm_writer_set_buffered_fields(writer->writer, n_fields_max);
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return a pointer to the time control associated to a writer_id.
@@ -6895,18 +7134,29 @@ cs_post_write_particle_values(int                    mesh_id,
 
   assert(ts->nt_cur > -1);
 
-  /* Allocate work arrays */
+  /* Prepare work arrays; the extraction buffer and particle list are
+     shared across the successive per-attribute writes, bounding the
+     transient memory to a single attribute's values */
 
   n_pts = fvm_nodal_get_n_entities(post_mesh->exp_mesh, 0);
 
-  BFT_MALLOC(vals, n_pts*_length, unsigned char);
+  if ((size_t)n_pts*(size_t)_length > _particle_vals_size) {
+    _particle_vals_size = (size_t)n_pts*(size_t)_length;
+    BFT_REALLOC(_particle_vals, _particle_vals_size, unsigned char);
+  }
+  vals = _particle_vals;
 
   var_ptr[0] = vals;
 
   if (n_pts != n_particles) {
-    int parent_dim = (post_mesh->ent_flag[3] == 2) ? 1 : 0;
-    BFT_MALLOC(particle_list, n_particles, cs_lnum_t);
-    fvm_nodal_get_parent_num(post_mesh->exp_mesh, parent_dim, particle_list);
+    if (post_mesh->exp_mesh != _particle_list_mesh) {
+      int parent_dim = (post_mesh->ent_flag[3] == 2) ? 1 : 0;
+      BFT_REALLOC(_particle_list, n_particles, cs_lnum_t);
+      fvm_nodal_get_parent_num(post_mesh->exp_mesh, parent_dim,
+                               _particle_list);
+      _particle_list_mesh = post_mesh->exp_mesh;
+    }
+    particle_list = _particle_list;
   }
 
   /* Particle values */
@@ -6933,8 +7183,6 @@ cs_post_write_particle_values(int                    mesh_id,
                                   vals);
   }
 
-  BFT_FREE(particle_list);
-
   /* Effective output: loop on writers */
   /*-----------------------------------*/
 
@@ -6963,8 +7211,6 @@ cs_post_write_particle_values(int                    mesh_id,
     }
 
   }
-
-  BFT_FREE(vals);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -7028,7 +7274,7 @@ cs_post_write_probe_values(int                              mesh_id,
 
     cs_interpolate_from_location_t *_interpolate_func = interpolate_func;
 
-    cs_coord_t *point_coords = NULL;
+    const cs_real_3_t *point_coords = NULL;
 
     if (_interpolate_func == NULL)
       _interpolate_func = cs_interpolate_from_location_p0;
@@ -7037,24 +7283,18 @@ cs_post_write_probe_values(int                              mesh_id,
                n_points*cs_datatype_size[datatype]*var_dim,
                unsigned char);
 
-    if (_interpolate_func != cs_interpolate_from_location_p0) {
-      BFT_MALLOC(point_coords, n_points*3, cs_coord_t);
-      fvm_nodal_get_vertex_coords(post_mesh->exp_mesh,
-                                  CS_INTERLACE,
-                                  point_coords);
-    }
+    if (_interpolate_func != cs_interpolate_from_location_p0)
+      point_coords = cs_probe_set_get_loc_coords(pset);
 
     _interpolate_func(interpolate_input,
                       datatype,
                       var_dim,
                       n_points,
                       elt_ids,
-                      (const cs_real_3_t *)point_coords,
+                      point_coords,
                       vals,
                       _vals);
     var_ptr[0] = _vals;
-
-    BFT_FREE(point_coords);
   }
 
   /* Effective output: loop on writers */
@@ -7150,7 +7390,7 @@ cs_post_write_probe_function(int                              mesh_id,
   cs_post_mesh_t *post_mesh = _cs_post_meshes + _mesh_id;
   cs_probe_set_t *pset = (cs_probe_set_t *)post_mesh->sel_input[4];
 
-  cs_coord_t *point_coords = NULL;
+  const cs_real_3_t *point_coords = NULL;
 
   const void *var_ptr[1] = {NULL};
   unsigned char *_vals = NULL;
@@ -7181,12 +7421,8 @@ cs_post_write_probe_function(int                              mesh_id,
                unsigned char);
 
     if (   _interpolate_func != cs_interpolate_from_location_p0
-        || f->analytic_func != NULL) {
-      BFT_MALLOC(point_coords, n_points*3, cs_coord_t);
-      fvm_nodal_get_vertex_coords(post_mesh->exp_mesh,
-                                  CS_INTERLACE,
-                                  point_coords);
-    }
+        || f->analytic_func != NULL)
+      point_coords = cs_probe_set_get_loc_coords(pset);
 
     if (_interpolate_func != NULL) {
       const cs_lnum_t *n_p_elts = cs_mesh_location_get_n_elts(parent_location_id);
@@ -7205,7 +7441,7 @@ cs_post_write_probe_function(int                              mesh_id,
                         f->dim,
                         n_points,
                         elt_ids,
-                        (const cs_real_3_t *)point_coords,
+                        point_coords,
                         _p_vals,
                         _vals);
 
@@ -7216,7 +7452,7 @@ cs_post_write_probe_function(int                              mesh_id,
       f->analytic_func(ts->t_cur,
                        n_points,
                        elt_ids,
-                       (cs_real_t *)point_coords,
+                       (const cs_real_t *)point_coords,
                        true,
                        f->func_input,
                        (cs_real_t *)_vals);
@@ -7229,8 +7465,6 @@ cs_post_write_probe_function(int                              mesh_id,
                            _vals);
 
     var_ptr[0] = _vals;
-
-    BFT_FREE(point_coords);
   }
 
   /* Effective output: loop on writers */
@@ -7340,6 +7574,10 @@ cs_post_renum_cells(const cs_lnum_t  init_cell_num[])
                                    renum_ent_parent,
                                    3);
 
+        /* Saved extraction selections refer to the old numbering */
+
+        post_mesh->prev_dims[0] = -1;
+
       }
 
     }
@@ -7439,6 +7677,10 @@ cs_post_renum_faces(const cs_lnum_t  init_i_face_num[],
                                    renum_ent_parent,
                                    2);
 
+        /* Saved extraction selections refer to the old numbering */
+
+        post_mesh->prev_dims[0] = -1;
+
       }
 
     }
@@ -8085,7 +8327,34 @@ cs_post_time_step_end(void)
 {
   int t_top_id = cs_timer_stats_switch(_post_out_stat_id);
 
-  /* Flush writers if necessary */
+  /* Flush writers if necessary; writers whose flush only involves
+     rank-local operations (such as plot or histogram files) may proceed
+     concurrently, while flushes possibly involving communication are
+     handled by the master thread, as required with MPI_THREAD_FUNNELED. */
+
+#if defined(HAVE_OPENMP)
+
+  #pragma omp parallel if (_cs_post_n_writers > 1)
+  #pragma omp master
+  {
+    for (int i = 0; i < _cs_post_n_writers; i++) {
+      cs_post_writer_t  *writer = _cs_post_writers + i;
+      if (   writer->active == 1 && writer->writer != NULL
+          && fvm_writer_flush_is_local(writer->writer)) {
+        #pragma omp task firstprivate(writer)
+        fvm_writer_flush(writer->writer);
+      }
+    }
+
+    for (int i = 0; i < _cs_post_n_writers; i++) {
+      cs_post_writer_t  *writer = _cs_post_writers + i;
+      if (   writer->active == 1 && writer->writer != NULL
+          && fvm_writer_flush_is_local(writer->writer) == false)
+        fvm_writer_flush(writer->writer);
+    }
+  }
+
+#else
 
   for (int i = 0; i < _cs_post_n_writers; i++) {
     cs_post_writer_t  *writer = _cs_post_writers + i;
@@ -8095,6 +8364,8 @@ cs_post_time_step_end(void)
     }
   }
 
+#endif
+
   /* Free time-varying and Lagrangian meshes unless they
      are mapped to an existing mesh */
 
@@ -8109,6 +8380,13 @@ cs_post_time_step_end(void)
     }
   }
 
+  /* Free buffers shared by the particle attribute writes of this pass */
+
+  _particle_vals_size = 0;
+  BFT_FREE(_particle_vals);
+  _particle_list_mesh = NULL;
+  BFT_FREE(_particle_list);
+
   cs_timer_stats_switch(t_top_id);
 }
 
@@ -8230,6 +8508,13 @@ cs_post_finalize(void)
     BFT_FREE(_cs_post_i_output_mtp);
   }
 
+  /* Particle output buffers */
+
+  _particle_vals_size = 0;
+  BFT_FREE(_particle_vals);
+  _particle_list_mesh = NULL;
+  BFT_FREE(_particle_list);
+
   /* Options */
 
   BFT_FREE(_cs_post_default_format_options);
@@ -1066,6 +1066,27 @@ cs_post_enable_writer(int   writer_id);
 fvm_writer_t *
 cs_post_get_writer(int  writer_id);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Set the maximum number of fields buffered for deferred output
+ *        for a specific writer or for all writers.
+ *
+ * When this limit is greater than 0, field values passed to a writer are
+ * snapshotted rather than output immediately, and the actual writes are
+ * grouped when the writer is flushed at the end of the current output
+ * stage; if the limit is reached beforehand, pending fields are output
+ * at that point. A limit of 0 (the default) restores direct output.
+ *
+ * \param[in]  writer_id     writer id, or 0 for all writers
+ * \param[in]  n_fields_max  maximum number of buffered fields,
+ *                           or 0 for direct output
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_set_writer_field_buffering(int  writer_id,
+                                   int  n_fields_max);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief Return a pointer to the time control associated to a writer_id.
@@ -47,6 +47,7 @@
 
 #include "cs_boundary_zone.h"
 #include "cs_ext_neighborhood.h"
+#include "cs_file.h"
 #include "cs_gui.h"
 #include "cs_gui_mesh.h"
 #include "cs_internal_coupling.h"
@@ -105,6 +106,15 @@ BEGIN_C_DECLS
  * Static global variables
  *============================================================================*/
 
+/* Setup-artifact cache: when the CS_SETUP_CACHE environment variable
+   defines a directory, the post-preprocessing mesh is saved there under a
+   name keyed by a hash of the mesh inputs and topology-affecting options,
+   and substituted directly for the raw inputs by subsequent matching runs
+   (useful for parameter sweeps re-running an identical setup). */
+
+static char  *_setup_cache_dir = NULL;
+static char   _setup_cache_name[64] = "";
+
 /*============================================================================
  * Prototypes for Fortran functions used only through this program unit.
  *============================================================================*/
@@ -145,6 +155,117 @@ extern void cs_f_majgeo(const cs_lnum_t    *ncel,
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Fold a byte sequence into a setup-cache key (64-bit FNV-1a variant,
+ * matching the mesh input hash).
+ *
+ * parameters:
+ *   h    <-- current hash value
+ *   data <-- data to fold into hash
+ *   size <-- data size in bytes
+ *
+ * returns:
+ *   updated hash value
+ *----------------------------------------------------------------------------*/
+
+static inline cs_gnum_t
+_setup_cache_fold(cs_gnum_t    h,
+                  const void  *data,
+                  size_t       size)
+{
+  const unsigned char *p = (const unsigned char *)data;
+
+  for (size_t i = 0; i < size; i++) {
+    h ^= (cs_gnum_t)p[i];
+    h *= (cs_gnum_t)0x100000001b3;
+  }
+
+  return h;
+}
+
+/*----------------------------------------------------------------------------
+ * Check for a cached post-setup mesh matching the current run.
+ *
+ * If the CS_SETUP_CACHE environment variable does not define a directory,
+ * this function does nothing. Otherwise, a cache key is built from the
+ * identity of the mesh inputs and from topology-affecting preprocessing
+ * options (joinings, periodicities, warped face cutting). If a matching
+ * cache file is present, it replaces the defined mesh inputs and true is
+ * returned; if not, the cache file name is kept so the post-setup mesh
+ * may be saved under it once preprocessing is done.
+ *
+ * As with preprocessing restarts, user-defined mesh modifications are
+ * assumed identical across runs sharing the same key.
+ *
+ * returns:
+ *   true if a cached mesh was substituted for the inputs, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_setup_cache_check(void)
+{
+  const char *dir = getenv("CS_SETUP_CACHE");
+
+  if (dir == NULL || strlen(dir) == 0)
+    return false;
+
+  /* Internally-generated meshes are not keyed by input files,
+     so do not try to cache them */
+
+  if (cs_mesh_cartesian_need_build())
+    return false;
+
+  /* Fold topology-affecting options into the mesh input hash
+     (file contents are not read, so the key identifies inputs
+     rather than contents) */
+
+  cs_gnum_t h = cs_preprocessor_data_get_input_hash();
+
+  for (int i = 0; i < cs_glob_n_joinings; i++) {
+    const cs_join_t *join = cs_glob_join_array[i];
+    if (join->criteria != NULL)
+      h = _setup_cache_fold(h, join->criteria, strlen(join->criteria));
+    h = _setup_cache_fold(h, &(join->param.fraction), sizeof(float));
+    h = _setup_cache_fold(h, &(join->param.plane), sizeof(float));
+    h = _setup_cache_fold(h, &(join->param.perio_type), sizeof(int));
+    h = _setup_cache_fold(h, join->param.perio_matrix, 12*sizeof(double));
+  }
+
+  {
+    double  cwf_threshold = -1.0;
+    int  cwf_post = 0;
+    cs_mesh_warping_get_defaults(&cwf_threshold, &cwf_post);
+    h = _setup_cache_fold(h, &cwf_threshold, sizeof(double));
+  }
+
+  snprintf(_setup_cache_name, 64, "mesh_setup_%016llx.csm",
+           (unsigned long long)h);
+
+  BFT_MALLOC(_setup_cache_dir, strlen(dir) + 1, char);
+  strcpy(_setup_cache_dir, dir);
+
+  char *path;
+  BFT_MALLOC(path, strlen(dir) + strlen(_setup_cache_name) + 2, char);
+  sprintf(path, "%s/%s", dir, _setup_cache_name);
+
+  int hit = 0;
+  if (cs_glob_rank_id <= 0)
+    hit = cs_file_isreg(path) ? 1 : 0;
+
+  cs_parall_bcast(0, 1, CS_INT_TYPE, &hit);
+
+  if (hit) {
+    bft_printf(_("\n Using cached post-setup mesh:\n   %s\n"), path);
+    cs_preprocessor_data_replace_input(path);
+    _setup_cache_name[0] = '\0';
+    BFT_FREE(_setup_cache_dir);
+  }
+
+  BFT_FREE(path);
+
+  return (hit != 0) ? true : false;
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -244,6 +365,14 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
     cs_user_partition();
   }
 
+  /* Substitute a cached post-setup mesh for the raw inputs when a
+     matching setup-cache artifact is present (CS_SETUP_CACHE) */
+
+  if (allow_modify) {
+    if (_setup_cache_check())
+      allow_modify = false;
+  }
+
   /* Read Preprocessor output */
 
   cs_preprocessor_data_read_mesh(m,
@@ -341,6 +470,16 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
   else if (need_save)
     cs_mesh_save(m, NULL, NULL, "mesh_output.csm");
 
+  /* On the first run of a case family, save the post-setup mesh to the
+     setup cache so matching runs may skip joining and modification */
+
+  if (_setup_cache_dir != NULL) {
+    bft_printf(_("\n Saving post-setup mesh to cache:\n   %s/%s\n"),
+               _setup_cache_dir, _setup_cache_name);
+    cs_mesh_save(m, NULL, _setup_cache_dir, _setup_cache_name);
+    BFT_FREE(_setup_cache_dir);
+  }
+
   m->n_b_faces_all = m->n_b_faces;
   m->n_g_b_faces_all = m->n_g_b_faces;
 
@@ -357,6 +496,11 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
 
   cs_renumber_mesh(m);
 
+  /* Re-place main mesh arrays, built by serial code paths, for better
+     core/memory affinity of threaded kernels */
+
+  cs_mesh_first_touch(m);
+
   /* Initialize group classes */
 
   cs_mesh_init_group_classes(m);
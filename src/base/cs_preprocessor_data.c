@@ -37,6 +37,11 @@
 #include <stdio.h>
 #include <string.h>
 
+#if defined(HAVE_SYS_TYPES_H) && defined(HAVE_SYS_STAT_H)
+#include <sys/types.h>
+#include <sys/stat.h>
+#endif
+
 #if defined(HAVE_MPI)
 #include <mpi.h>
 #endif
@@ -126,6 +131,20 @@ typedef struct {
 
 } _mesh_reader_t;
 
+/* Read pass for mesh data sections, allowing staged reads */
+/* ------------------------------------------------------- */
+
+typedef enum {
+
+  _MESH_READ_SINGLE,     /* read all sections in a single pass */
+  _MESH_READ_CELL_FACE,  /* read cell and face based sections only
+                            (first pass of a staged read) */
+  _MESH_READ_VERTICES    /* read face-vertices connectivity and vertex
+                            based sections only (second pass of a
+                            staged read) */
+
+} _mesh_read_pass_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -156,6 +175,11 @@ static int _input_present = -1;  /* -1 if not set, >= 0 if present
 static  cs_preprocessor_data_restart_mode_t _restart_mode
   = CS_PREPROCESSOR_DATA_RESTART_ONLY;
 
+static int _n_mesh_read_passes = 0;  /* 0: automatic; 1: single pass;
+                                        2: staged read, with face-vertices
+                                        connectivity and vertex data read
+                                        only after partitioning */
+
 /*=============================================================================
  * Private function definitions
  *============================================================================*/
@@ -177,6 +201,33 @@ _align_size(size_t  min_size)
   return (min_size + (align-1) - ((min_size - 1) % align));
 }
 
+/*----------------------------------------------------------------------------
+ * Fold a byte sequence into a hash value (64-bit FNV-1a variant).
+ *
+ * parameters:
+ *   h    <-- current hash value
+ *   data <-- data to fold into hash
+ *   size <-- data size in bytes
+ *
+ * returns:
+ *   updated hash value
+ *----------------------------------------------------------------------------*/
+
+static inline cs_gnum_t
+_fold_hash(cs_gnum_t    h,
+           const void  *data,
+           size_t       size)
+{
+  const unsigned char *p = (const unsigned char *)data;
+
+  for (size_t i = 0; i < size; i++) {
+    h ^= (cs_gnum_t)p[i];
+    h *= (cs_gnum_t)0x100000001b3;
+  }
+
+  return h;
+}
+
 /*----------------------------------------------------------------------------
  * Check which inputs are present
  *
@@ -1545,6 +1596,41 @@ _transform_perio_matrix(const double  matrix[],
   _combine_tr_matrixes(_m, _tmp_m, perio_matrix);
 }
 
+/*----------------------------------------------------------------------------
+ * Check if a given data section should be handled by a given read pass.
+ *
+ * With a staged read, the face-vertices connectivity and vertex based
+ * sections (usually the largest) are deferred to a second pass, run
+ * only after partitioning.
+ *
+ * parameters:
+ *   sec_name <-- section name
+ *   pass     <-- current read pass
+ *
+ * returns:
+ *   true if the section should be read in this pass, false if skipped
+ *----------------------------------------------------------------------------*/
+
+static bool
+_section_in_read_pass(const char         *sec_name,
+                      _mesh_read_pass_t   pass)
+{
+  if (pass == _MESH_READ_SINGLE)
+    return true;
+
+  bool is_vtx
+    = (   strncmp(sec_name, "face_vertices_index", CS_IO_NAME_LEN) == 0
+       || strncmp(sec_name, "face_vertices", CS_IO_NAME_LEN) == 0
+       || strncmp(sec_name, "vertex_coords", CS_IO_NAME_LEN) == 0
+       || strncmp(sec_name, "vertex_refinement_generation",
+                  CS_IO_NAME_LEN) == 0);
+
+  if (pass == _MESH_READ_VERTICES)
+    return is_vtx;
+  else /* _MESH_READ_CELL_FACE */
+    return !is_vtx;
+}
+
 /*----------------------------------------------------------------------------
  * Read pre-processor mesh data for a given mesh and finalize input.
  *
@@ -1552,6 +1638,7 @@ _transform_perio_matrix(const double  matrix[],
  *   file_id <-- id of file handled by mesh builder
  *   mesh    <-> pointer to mesh structure
  *   mr      <-> pointer to mesh reader structure
+ *   pass    <-- current read pass for staged reads
  *   echo    <-- echo (verbosity) level
  *----------------------------------------------------------------------------*/
 
@@ -1560,6 +1647,7 @@ _read_data(int                 file_id,
            cs_mesh_t          *mesh,
            cs_mesh_builder_t  *mb,
            _mesh_reader_t     *mr,
+           _mesh_read_pass_t   pass,
            long                echo)
 {
   int  perio_id, perio_type;
@@ -1679,6 +1767,14 @@ _read_data(int                 file_id,
                   _("Section of type <%s> on <%s>\n"
                     "unexpected."), header.sec_name, cs_io_get_name(pp_in));
 
+      /* With a staged read, only handle sections matching the
+         current pass */
+
+      if (_section_in_read_pass(header.sec_name, pass) == false) {
+        cs_io_skip(&header, pp_in);
+        continue;
+      }
+
       /* Face-cells connectivity */
 
       if (strncmp(header.sec_name, "face_cells", CS_IO_NAME_LEN) == 0) {
@@ -2133,10 +2229,12 @@ _read_data(int                 file_id,
   mr->n_g_faces_connect_read += n_g_face_connect_size;
   mr->n_g_vertices_read += n_g_vertices;
 
-  /* Finalize pre-processor input */
-  /*------------------------------*/
+  /* Finalize pre-processor input;
+     with a staged read, the second pass restarts from the same offset */
+  /*-------------------------------------------------------------------*/
 
-  f->offset = 0;
+  if (pass != _MESH_READ_CELL_FACE)
+    f->offset = 0;
   cs_io_finalize(&pp_in);
 }
 
@@ -2226,6 +2324,50 @@ cs_preprocessor_data_set_restart_mode(cs_preprocessor_data_restart_mode_t  mode)
     _restart_mode = CS_PREPROCESSOR_DATA_RESTART_NONE;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the number of read passes for mesh input data.
+ *
+ * With 2 passes, the face-vertices connectivity and vertex based sections,
+ * which are usually the largest ones and are not needed for partitioning,
+ * are read only after the mesh has been partitioned, reducing peak memory
+ * use at the cost of re-traversing the input file.
+ *
+ * \param[in]  n_passes  1 for a single pass, 2 for a staged read,
+ *                       0 to revert to the automatic behavior
+ *                       (staged read in parallel)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_set_n_read_passes(int  n_passes)
+{
+  if (n_passes >= 0 && n_passes <= 2)
+    _n_mesh_read_passes = n_passes;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if a mesh input is available.
+ *
+ * This covers mesh files added through \ref cs_preprocessor_data_add_file
+ * as well as the default input file or directory, if present.
+ *
+ * \return  true if a mesh input is available, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_preprocessor_data_is_input_present(void)
+{
+  if (_n_mesh_files > 0)
+    return true;
+
+  _check_input_presense();
+
+  return (_input_present > 0);
+}
+
 /*----------------------------------------------------------------------------
  * Define input mesh file to read.
  *
@@ -2342,6 +2484,93 @@ cs_preprocessor_data_add_file(const char     *file_name,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Replace currently defined mesh inputs with a single file.
+ *
+ * All previously defined inputs, including the default input if present,
+ * are discarded. This is mainly useful to substitute an equivalent
+ * already-preprocessed mesh for the raw inputs.
+ *
+ * \param[in]  file_name  name of file to read
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_replace_input(const char  *file_name)
+{
+  for (int i = 0; i < _n_mesh_files; i++)
+    BFT_FREE(_mesh_file_info[i].data);
+
+  _n_mesh_files = 0;
+
+  cs_preprocessor_data_add_file(file_name, 0, NULL, NULL);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return a hash of the identity of currently defined mesh inputs.
+ *
+ * The hash folds, for each defined input (or the default input when no
+ * file was defined explicitely), the file's name, size, and modification
+ * time, as well as any associated coordinate transformation and group
+ * renaming info. File contents are not read, so the hash identifies
+ * inputs rather than contents.
+ *
+ * The returned value is identical on all ranks.
+ *
+ * \return  hash of currently defined mesh inputs
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_gnum_t
+cs_preprocessor_data_get_input_hash(void)
+{
+  cs_gnum_t h = (cs_gnum_t)0xcbf29ce484222325;  /* 64-bit FNV-1a basis */
+
+  _set_default_input_if_needed();
+
+  if (cs_glob_rank_id <= 0) {
+
+    h = _fold_hash(h, &_n_mesh_files, sizeof(int));
+
+    for (int i = 0; i < _n_mesh_files; i++) {
+
+      const _mesh_file_info_t  *f = _mesh_file_info + i;
+
+      h = _fold_hash(h, f->filename, strlen(f->filename));
+
+      cs_file_off_t f_size = cs_file_size(f->filename);
+      h = _fold_hash(h, &f_size, sizeof(cs_file_off_t));
+
+#if defined(HAVE_SYS_TYPES_H) && defined(HAVE_SYS_STAT_H)
+      struct stat s;
+      if (stat(f->filename, &s) == 0) {
+        long long f_mtime = (long long)s.st_mtime;
+        h = _fold_hash(h, &f_mtime, sizeof(long long));
+      }
+#endif
+
+      if (f->matrix != NULL)
+        h = _fold_hash(h, f->matrix, 12*sizeof(double));
+
+      for (size_t j = 0; j < f->n_group_renames; j++) {
+        h = _fold_hash(h, f->old_group_names[j],
+                       strlen(f->old_group_names[j]));
+        if (f->new_group_names[j] != NULL)
+          h = _fold_hash(h, f->new_group_names[j],
+                         strlen(f->new_group_names[j]));
+      }
+
+    }
+
+  }
+
+  cs_parall_bcast(0, 1, CS_GNUM_TYPE, &h);
+
+  return h;
+}
+
 /*----------------------------------------------------------------------------
  * Check for periodicity information in mesh meta-data.
  *
@@ -2478,6 +2707,8 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
   long  echo = CS_IO_ECHO_OPEN_CLOSE;
   _mesh_reader_t  *mr = _cs_glob_mesh_reader;
 
+  _mesh_read_pass_t read_pass = _MESH_READ_SINGLE;
+
   bool pre_partitioned = false;
 
   /* Check for existing partitioning and cell block info (set by
@@ -2520,8 +2751,20 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
     mesh->modified |= CS_MESH_MODIFIED;
   }
   else {
+
+    /* Use a staged read unless deactivated, so that the face-vertices
+       connectivity and vertex data (usually the largest sections, and
+       not needed for partitioning) are not resident in memory while
+       the partitioner runs */
+
+    int n_read_passes = _n_mesh_read_passes;
+    if (n_read_passes == 0)
+      n_read_passes = (cs_glob_n_ranks > 1 && ! pre_partitioned) ? 2 : 1;
+    if (n_read_passes > 1)
+      read_pass = _MESH_READ_CELL_FACE;
+
     for (file_id = 0; file_id < mr->n_files; file_id++)
-      _read_data(file_id, mesh, mesh_builder, mr, echo);
+      _read_data(file_id, mesh, mesh_builder, mr, read_pass, echo);
 
     if (mr->n_files > 1)
       mesh->modified |= CS_MESH_MODIFIED;
@@ -2532,6 +2775,16 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
   if (! pre_partitioned)
     cs_partition(mesh, mesh_builder, partition_stage);
 
+  /* Second pass of a staged read; face counters are reset, as they
+     progress per file again when reading the face-vertices index */
+
+  if (read_pass == _MESH_READ_CELL_FACE) {
+    mr->n_faces_read = 0;
+    mr->n_g_faces_read = 0;
+    for (file_id = 0; file_id < mr->n_files; file_id++)
+      _read_data(file_id, mesh, mesh_builder, mr, _MESH_READ_VERTICES, echo);
+  }
+
   bft_printf("\n");
 
   /* Now send data to the correct rank */
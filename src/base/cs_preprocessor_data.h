@@ -109,6 +109,40 @@ cs_preprocessor_data_add_file(const char     *file_name,
                               const char    **group_rename,
                               const double    transf_matrix[3][4]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Replace currently defined mesh inputs with a single file.
+ *
+ * All previously defined inputs, including the default input if present,
+ * are discarded. This is mainly useful to substitute an equivalent
+ * already-preprocessed mesh for the raw inputs.
+ *
+ * \param[in]  file_name  name of file to read
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_replace_input(const char  *file_name);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return a hash of the identity of currently defined mesh inputs.
+ *
+ * The hash folds, for each defined input (or the default input when no
+ * file was defined explicitely), the file's name, size, and modification
+ * time, as well as any associated coordinate transformation and group
+ * renaming info. File contents are not read, so the hash identifies
+ * inputs rather than contents.
+ *
+ * The returned value is identical on all ranks.
+ *
+ * \return  hash of currently defined mesh inputs
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_gnum_t
+cs_preprocessor_data_get_input_hash(void);
+
 /*----------------------------------------------------------------------------
  * Check for periodicity information in mesh meta-data.
  *
@@ -146,6 +180,38 @@ cs_preprocessor_data_get_restart_mode(void);
 void
 cs_preprocessor_data_set_restart_mode(cs_preprocessor_data_restart_mode_t  mode);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the number of read passes for mesh input data.
+ *
+ * With 2 passes, the face-vertices connectivity and vertex based sections,
+ * which are usually the largest ones and are not needed for partitioning,
+ * are read only after the mesh has been partitioned, reducing peak memory
+ * use at the cost of re-traversing the input file.
+ *
+ * \param[in]  n_passes  1 for a single pass, 2 for a staged read,
+ *                       0 to revert to the automatic behavior
+ *                       (staged read in parallel)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_set_n_read_passes(int  n_passes);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if a mesh input is available.
+ *
+ * This covers mesh files added through \ref cs_preprocessor_data_add_file
+ * as well as the default input file or directory, if present.
+ *
+ * \return  true if a mesh input is available, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_preprocessor_data_is_input_present(void);
+
 /*----------------------------------------------------------------------------
  * Read mesh meta-data.
  *
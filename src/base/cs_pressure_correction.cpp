@@ -3218,6 +3218,13 @@ _pressure_correction_cdo(cs_real_t              vel[restrict][3],
 
   cs_equation_t  *eq_dp = prcdo->pressure_incr;
 
+  /* The CDO pressure solver and its connectivity and quantity arrays are
+     host-resident, so use a host (threaded) dispatch context for the
+     update loops */
+
+  cs_dispatch_context ctx;
+  ctx.set_use_gpu(false);
+
   /* Allocate temporary arrays */
 
   cs_real_3_t  *wrk = NULL;
@@ -3277,11 +3284,11 @@ _pressure_correction_cdo(cs_real_t              vel[restrict][3],
 
   const cs_real_t arak = vp_param->arak;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
     for (cs_lnum_t j = 0; j < 3; j++)
       wrk[c_id][j] = vel[c_id][j] + arak*gradp[c_id][j]*dt[c_id]/crom[c_id];
-  }
+  });
+  ctx.wait();
 
   /* Sync for parallelism and periodicity */
 
@@ -3311,11 +3318,15 @@ _pressure_correction_cdo(cs_real_t              vel[restrict][3],
                  imasfl, bmasfl);
   }
 
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++)
+  ctx.parallel_for(n_i_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t f_id) {
     imasfl[f_id] += arak*ipotfl[f_id];
+  });
 
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++)
+  ctx.parallel_for(n_b_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t f_id) {
     bmasfl[f_id] += arak*bpotfl[f_id];
+  });
+
+  ctx.wait();
 
   /*
    * Solving
@@ -3335,8 +3346,10 @@ _pressure_correction_cdo(cs_real_t              vel[restrict][3],
                 bmasfl,
                 divu);
 
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
     divu[c_id] *= -1;
+  });
+  ctx.wait();
 
   /* Compute and set the right-hand side residual */
 
@@ -3364,53 +3377,68 @@ _pressure_correction_cdo(cs_real_t              vel[restrict][3],
                                      cs_glob_time_step->t_cur,
                                      diff_flux);
 
-  for (cs_lnum_t f_id = 0; f_id < quant->n_i_faces; f_id++) {
-    imasfl[f_id] += diff_flux[f_id];
-    ipotfl[f_id] += diff_flux[f_id];
-  }
+  const cs_lnum_t n_i_faces_q = quant->n_i_faces;
+  const cs_real_t *diff_flux_c = diff_flux;
 
-  for (cs_lnum_t f_id = 0; f_id < quant->n_b_faces; f_id++) {
-    bmasfl[f_id] += diff_flux[f_id + quant->n_i_faces];
-    bpotfl[f_id] += diff_flux[f_id + quant->n_i_faces];
-  }
+  ctx.parallel_for(n_i_faces_q, [=] CS_F_HOST_DEVICE (cs_lnum_t f_id) {
+    imasfl[f_id] += diff_flux_c[f_id];
+    ipotfl[f_id] += diff_flux_c[f_id];
+  });
+
+  ctx.parallel_for(quant->n_b_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t f_id) {
+    bmasfl[f_id] += diff_flux_c[f_id + n_i_faces_q];
+    bpotfl[f_id] += diff_flux_c[f_id + n_i_faces_q];
+  });
+
+  ctx.wait();
 
   /* Reconstruct the cell gradient
      ----------------------------- */
 
   cs_real_3_t  *grddp_c = (cs_real_3_t*) prcdo->pressure_incr_gradient->val;
 
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+  const cs_lnum_t  *c2f_idx = connect->c2f->idx;
+  const cs_lnum_t  *c2f_ids_a = connect->c2f->ids;
+  const short int  *c2f_sgn_a = connect->c2f->sgn;
+  const cs_real_t  *cell_centers = quant->cell_centers;
+  const cs_real_t  *i_face_center = quant->i_face_center;
+  const cs_real_t  *b_face_center = quant->b_face_center;
+  const cs_real_t  *cell_vol = quant->cell_vol;
 
-    const cs_lnum_t  s = connect->c2f->idx[c_id], e = connect->c2f->idx[c_id+1];
-    const cs_lnum_t  *c2f_ids = connect->c2f->ids + s;
-    const short int  *c2f_sgn = connect->c2f->sgn + s;
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+
+    const cs_lnum_t  s = c2f_idx[c_id], e = c2f_idx[c_id+1];
+    const cs_lnum_t  *c2f_ids = c2f_ids_a + s;
+    const short int  *c2f_sgn = c2f_sgn_a + s;
 
     const cs_lnum_t  n_fc = e - s;
-    const cs_real_t  *cell_center = quant->cell_centers + 3*c_id;
+    const cs_real_t  *cell_center = cell_centers + 3*c_id;
     cs_real_3_t  grddp_reco = {0.0, 0.0, 0.0};
 
     for (short int j = 0; j < n_fc; j++) {
 
       cs_lnum_t  f_id = c2f_ids[j];
 
-      const cs_real_t *face_center  = (f_id < quant->n_i_faces) ?
-        quant->i_face_center + 3*f_id :
-        quant->b_face_center + 3*(f_id - quant->n_i_faces);
+      const cs_real_t *face_center  = (f_id < n_i_faces_q) ?
+        i_face_center + 3*f_id :
+        b_face_center + 3*(f_id - n_i_faces_q);
 
       for (short int k = 0; k < 3; k++)
         grddp_reco[k] +=
-          - c2f_sgn[j] * diff_flux[f_id] * (face_center[k] - cell_center[k]);
+          - c2f_sgn[j] * diff_flux_c[f_id] * (face_center[k] - cell_center[k]);
 
     } /* Loop on cell faces */
 
-    const cs_real_t  ccoef = 1./(c_visc[c_id]*quant->cell_vol[c_id]);
+    const cs_real_t  ccoef = 1./(c_visc[c_id]*cell_vol[c_id]);
     for (short int k = 0; k < 3; k++) {
       const cs_real_t  incr_k = ccoef*grddp_reco[k];
       grddp_c[c_id][k] = incr_k;
       gradp[c_id][k] += incr_k;
     }
 
-  } /* Loop on cells */
+  }); /* Loop on cells */
+
+  ctx.wait();
 
   /*  Free memory */
 
@@ -3435,8 +3463,10 @@ _pressure_correction_cdo(cs_real_t              vel[restrict][3],
   /* Update the pressure field
      ------------------------- */
 
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
     cvar_pr[c_id] += phi[c_id];
+  });
+  ctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
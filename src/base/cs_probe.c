@@ -148,6 +148,10 @@ struct _cs_probe_set_t {
 
   char         *located;        /* 1 for located probes, 0 for unlocated */
 
+  cs_real_3_t  *loc_coords;     /* Cached coordinates of probes located on
+                                   the local domain (lazily built; same
+                                   ordering as elt_id) */
+
   int           interpolation;  /* 0: no interpolation;
                                    1: local gradient-based interpolation */
 
@@ -306,6 +310,7 @@ _probe_set_free(cs_probe_set_t   *pset)
   BFT_FREE(pset->elt_id);
   BFT_FREE(pset->vtx_id);
   BFT_FREE(pset->located);
+  BFT_FREE(pset->loc_coords);
 
   BFT_FREE(pset->_p_define_input);
 
@@ -394,6 +399,7 @@ _probe_set_create(const char    *name,
   pset->elt_id = NULL;
   pset->vtx_id = NULL;
   pset->located = NULL;
+  pset->loc_coords = NULL;
 
   pset->interpolation = 0;
 
@@ -1826,6 +1832,10 @@ cs_probe_set_locate(cs_probe_set_t     *pset,
     }
   }
 
+  /* Invalidate cached local coordinates (rebuilt on demand) */
+
+  BFT_FREE(pset->loc_coords);
+
   assert(n_loc_probes == pset->n_loc_probes);
 }
 
@@ -1927,6 +1937,11 @@ cs_probe_set_export_mesh(cs_probe_set_t   *pset,
     }
   }
 
+  /* Snap modes may have moved coordinates, so invalidate the
+     cached local coordinates (rebuilt on demand) */
+
+  BFT_FREE(pset->loc_coords);
+
   /* Update the probe set structure */
 
   fvm_nodal_define_vertex_list(exp_mesh, pset->n_loc_probes, NULL);
@@ -2248,6 +2263,39 @@ cs_probe_set_get_elt_ids(const cs_probe_set_t  *pset,
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the coordinates of a probe set's local probes.
+ *
+ * The coordinates are cached, in the same ordering as the element ids
+ * returned by \ref cs_probe_set_get_elt_ids, so repeated calls (such as
+ * once per output variable) do not require re-extraction. The cache is
+ * invalidated when probes are relocated.
+ *
+ * \param[in, out]  pset  pointer to a cs_probe_set_t structure
+ *
+ * \return NULL or the pointer to the probe coordinates array
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_real_3_t *
+cs_probe_set_get_loc_coords(cs_probe_set_t  *pset)
+{
+  if (pset == NULL)
+    return NULL;
+
+  if (pset->loc_coords == NULL && pset->n_loc_probes > 0) {
+    BFT_MALLOC(pset->loc_coords, pset->n_loc_probes, cs_real_3_t);
+    for (cs_lnum_t i = 0; i < pset->n_loc_probes; i++) {
+      cs_lnum_t j = pset->loc_id[i];
+      for (cs_lnum_t k = 0; k < 3; k++)
+        pset->loc_coords[i][k] = pset->coords[j][k];
+    }
+  }
+
+  return pset->loc_coords;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
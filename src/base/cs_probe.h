@@ -644,6 +644,24 @@ const cs_lnum_t *
 cs_probe_set_get_elt_ids(const cs_probe_set_t  *pset,
                          int                    mesh_location_id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the coordinates of a probe set's local probes.
+ *
+ * The coordinates are cached, in the same ordering as the element ids
+ * returned by \ref cs_probe_set_get_elt_ids, so repeated calls (such as
+ * once per output variable) do not require re-extraction. The cache is
+ * invalidated when probes are relocated.
+ *
+ * \param[in, out]  pset  pointer to a cs_probe_set_t structure
+ *
+ * \return NULL or the pointer to the probe coordinates array
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_real_3_t *
+cs_probe_set_get_loc_coords(cs_probe_set_t  *pset);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
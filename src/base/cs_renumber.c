@@ -3430,6 +3430,10 @@ _get_coord_extents(int               dim,
 /*----------------------------------------------------------------------------
  * Renumber cells based on local Morton encoding.
  *
+ * If cells adjacent to ghost cells have been placed last, only cells
+ * not adjacent to ghost cells are reordered, so as to maintain that
+ * classification.
+ *
  * parameters:
  *   mesh        <-- pointer to mesh structure
  *   new_to_old  --> new to old cell renumbering
@@ -3469,6 +3473,12 @@ _renum_cells_morton(const cs_mesh_t  *mesh,
 
   fvm_morton_local_order(n_cells, m_code, new_to_old);
 
+  /* Cells not reordered here keep their position, so that the
+     resulting array is always a full permutation */
+
+  for (cs_lnum_t i = n_cells; i < mesh->n_cells; i++)
+    new_to_old[i] = i;
+
   BFT_FREE(m_code);
 
   BFT_FREE(cell_center);
@@ -3480,6 +3490,10 @@ _renum_cells_morton(const cs_mesh_t  *mesh,
  * In the case that 2 entities have a same Hilbert code, their order
  * will be determined by lexicographical ordering of coordinates.
  *
+ * If cells adjacent to ghost cells have been placed last, only cells
+ * not adjacent to ghost cells are reordered, so as to maintain that
+ * classification.
+ *
  * parameters:
  *   mesh        <-- pointer to mesh structure
  *   new_to_old  --> new to old cell renumbering
@@ -3490,6 +3504,10 @@ _renum_cells_hilbert(const cs_mesh_t  *mesh,
                      cs_lnum_t         new_to_old[])
 {
   cs_coord_t extents[6];
+  cs_lnum_t n_cells = mesh->n_cells;
+
+  if (mesh->cell_numbering->n_no_adj_halo_elts > 0)
+    n_cells = mesh->cell_numbering->n_no_adj_halo_elts;
 
   cs_coord_t *cell_center;
 
@@ -3501,10 +3519,16 @@ _renum_cells_hilbert(const cs_mesh_t  *mesh,
 
   fvm_hilbert_local_order_coords(mesh->dim,
                                  extents,
-                                 mesh->n_cells,
+                                 n_cells,
                                  cell_center,
                                  new_to_old);
 
+  /* Cells not reordered here keep their position, so that the
+     resulting array is always a full permutation */
+
+  for (cs_lnum_t i = n_cells; i < mesh->n_cells; i++)
+    new_to_old[i] = i;
+
   BFT_FREE(cell_center);
 }
 
@@ -4943,6 +4967,7 @@ _renumber_i_faces(cs_mesh_t  *mesh)
   int  n_i_groups = 1, n_i_no_adj_halo_groups = 0;
   cs_lnum_t  max_group_size = 1014;       /* Default */
   cs_lnum_t  ii;
+  cs_lnum_t  n_no_adj_halo_i_faces = 0;
   cs_lnum_t  *new_to_old_i = NULL;
   cs_lnum_t  *i_group_index = NULL;
 
@@ -5004,7 +5029,7 @@ _renumber_i_faces(cs_mesh_t  *mesh)
 
   case CS_RENUMBER_I_FACES_SIMD:
     numbering_type = CS_NUMBERING_VECTORIZE;
-    _renumber_i_faces_by_cell_adjacency(mesh);
+    n_no_adj_halo_i_faces = _renumber_i_faces_by_cell_adjacency(mesh);
     retval = _renum_i_faces_for_vectorizing(mesh,
                                             _cs_renumber_vector_size,
                                             new_to_old_i);
@@ -5012,7 +5037,7 @@ _renumber_i_faces(cs_mesh_t  *mesh)
 
   case CS_RENUMBER_I_FACES_NONE:
   default:
-    _renumber_i_faces_by_cell_adjacency(mesh);
+    n_no_adj_halo_i_faces = _renumber_i_faces_by_cell_adjacency(mesh);
     retval = -1;
     break;
   }
@@ -5046,10 +5071,19 @@ _renumber_i_faces(cs_mesh_t  *mesh)
       = cs_numbering_create_vectorized(mesh->n_i_faces,
                                        _cs_renumber_vector_size);
   }
-  else
+  else {
     mesh->i_face_numbering
       = cs_numbering_create_default(mesh->n_i_faces);
 
+    /* When the cell-adjacency ordering was not modified by a subsequent
+       algorithm, faces adjacent to ghost cells are grouped last, so the
+       matching partition point may be saved for computation/communication
+       overlap. */
+
+    if (mesh->halo != NULL)
+      mesh->i_face_numbering->n_no_adj_halo_elts = n_no_adj_halo_i_faces;
+  }
+
   if (mesh->verbosity > 0)
     cs_numbering_log_info(CS_LOG_DEFAULT,
                           _("interior faces"),
@@ -5871,6 +5905,51 @@ cs_renumber_get_algorithm(bool                        *halo_adjacent_cells_last,
     *vertices_numbering = _vertices_algorithm;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the number of mesh elements not adjacent to ghost cells.
+ *
+ * When cells (resp. interior faces) adjacent to ghost cells have been
+ * placed last (see \ref cs_renumber_set_algorithm), cells
+ * [0, n_no_adj_halo_cells[ (resp. interior faces
+ * [0, n_no_adj_halo_i_faces[) reference no ghost value, so operations on
+ * those elements, such as a partial matrix.vector product
+ * (\ref cs_matrix_vector_multiply_partial), may proceed while a halo
+ * synchronization (\ref cs_halo_sync_wait) is pending.
+ *
+ * A returned count of 0 indicates the matching partition is not available
+ * (option not active, or ordering modified by a subsequent algorithm).
+ *
+ * Any argument may be passed NULL if this value is not queried.
+ *
+ * \param[in]   mesh                    pointer to mesh structure
+ * \param[out]  n_no_adj_halo_cells     number of cells not adjacent to
+ *                                      ghost cells, or NULL
+ * \param[out]  n_no_adj_halo_i_faces   number of interior faces not adjacent
+ *                                      to ghost cells, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_get_n_no_adj_halo_elts(const cs_mesh_t  *mesh,
+                                   cs_lnum_t        *n_no_adj_halo_cells,
+                                   cs_lnum_t        *n_no_adj_halo_i_faces)
+{
+  if (n_no_adj_halo_cells != NULL) {
+    if (mesh->cell_numbering != NULL)
+      *n_no_adj_halo_cells = mesh->cell_numbering->n_no_adj_halo_elts;
+    else
+      *n_no_adj_halo_cells = 0;
+  }
+
+  if (n_no_adj_halo_i_faces != NULL) {
+    if (mesh->i_face_numbering != NULL)
+      *n_no_adj_halo_i_faces = mesh->i_face_numbering->n_no_adj_halo_elts;
+    else
+      *n_no_adj_halo_i_faces = 0;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Renumber mesh elements for vectorization or threading depending on
@@ -212,6 +212,36 @@ cs_renumber_get_algorithm(bool                        *halo_adjacent_cells_last,
                           cs_renumber_b_faces_type_t  *b_faces_numbering,
                           cs_renumber_vertices_type_t *vertices_numbering);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the number of mesh elements not adjacent to ghost cells.
+ *
+ * When cells (resp. interior faces) adjacent to ghost cells have been
+ * placed last (see \ref cs_renumber_set_algorithm), cells
+ * [0, n_no_adj_halo_cells[ (resp. interior faces
+ * [0, n_no_adj_halo_i_faces[) reference no ghost value, so operations on
+ * those elements, such as a partial matrix.vector product
+ * (\ref cs_matrix_vector_multiply_partial), may proceed while a halo
+ * synchronization (\ref cs_halo_sync_wait) is pending.
+ *
+ * A returned count of 0 indicates the matching partition is not available
+ * (option not active, or ordering modified by a subsequent algorithm).
+ *
+ * Any argument may be passed NULL if this value is not queried.
+ *
+ * \param[in]   mesh                    pointer to mesh structure
+ * \param[out]  n_no_adj_halo_cells     number of cells not adjacent to
+ *                                      ghost cells, or NULL
+ * \param[out]  n_no_adj_halo_i_faces   number of interior faces not adjacent
+ *                                      to ghost cells, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_get_n_no_adj_halo_elts(const cs_mesh_t  *mesh,
+                                   cs_lnum_t        *n_no_adj_halo_cells,
+                                   cs_lnum_t        *n_no_adj_halo_i_faces);
+
 /*----------------------------------------------------------------------------
  * Renumber mesh elements for vectorization or threading depending on code
  * options and target machine.
@@ -60,10 +60,12 @@
 
 #include "cs_all_to_all.h"
 #include "cs_base.h"
+#include "cs_base_accel.h"
 #include "cs_block_dist.h"
 #include "cs_block_to_part.h"
 #include "cs_file.h"
 #include "cs_io.h"
+#include "cs_map.h"
 #include "cs_mesh.h"
 #include "cs_mesh_save.h"
 #include "cs_mesh_location.h"
@@ -115,6 +117,56 @@ typedef struct _location_t {
 
 } _location_t;
 
+typedef struct {
+
+  char                   *sec_name;         /* Section name */
+  int                     location_id;      /* Associated location id */
+  int                     n_location_vals;  /* Values per location entity */
+  cs_restart_val_type_t   val_type;         /* Value type */
+  cs_byte_t              *val;              /* Snapshot of section values */
+
+} _restart_staged_section_t;
+
+typedef struct {
+
+  char                   *sec_name;         /* Section name */
+  int                     location_id;      /* Associated location id */
+  int                     n_location_vals;  /* Values per location entity */
+  cs_restart_val_type_t   val_type;         /* Value type */
+  size_t                  n_bytes;          /* Size of local values */
+  cs_byte_t              *val;              /* Local section values */
+  size_t                  buddy_n_bytes;    /* Size of mirrored values */
+  cs_byte_t              *buddy_val;        /* Mirror copy of a buddy rank's
+                                               section values, or NULL */
+
+} _restart_shadow_section_t;
+
+typedef struct {
+
+  char        *name;         /* Location name */
+  cs_gnum_t    n_glob_ents;  /* Global number of entities */
+  cs_lnum_t    n_ents;       /* Local number of entities */
+
+} _restart_shadow_location_t;
+
+typedef struct {
+
+  char   *name;            /* Base name of the associated restart file */
+
+  int     n_checkpoints;   /* Number of checkpoints written so far */
+
+  int     buddy_rank;      /* Rank whose section values are mirrored
+                              here, or -1 */
+
+  int     n_locations;     /* Number of captured location definitions */
+  _restart_shadow_location_t  *locations;  /* Captured location definitions */
+
+  int     n_sections;      /* Number of stored sections */
+  int     n_sections_max;  /* Allocated sections */
+  _restart_shadow_section_t   *sections;   /* Stored section values */
+
+} _restart_shadow_image_t;
+
 struct _cs_restart_t {
 
   char              *name;           /* Name of restart file */
@@ -126,8 +178,27 @@ struct _cs_restart_t {
   size_t             n_locations;    /* Number of locations */
   _location_t       *location;       /* Location definition array */
 
+  cs_map_name_to_id_t  *sec_id_map;    /* Section name to map id
+                                          (read mode only), or NULL */
+  int                  *sec_first_rec; /* First file index record id for
+                                          each mapped section name */
+
   cs_restart_mode_t  mode;           /* Read or write */
 
+  bool               async_write;    /* Snapshot sections and defer
+                                        actual writes if true */
+
+  size_t             n_staged_sections;      /* Number of staged sections */
+  size_t             n_staged_sections_max;  /* Allocated staged sections */
+  _restart_staged_section_t  *staged_sections;  /* Staged section
+                                                   snapshots, or NULL */
+
+  bool               shadow;         /* Read from / write to an in-memory
+                                        shadow image instead of the
+                                        filesystem if true */
+  _restart_shadow_image_t  *shadow_image;  /* Associated shadow image,
+                                              or NULL */
+
 };
 
 typedef struct {
@@ -212,6 +283,25 @@ static double _checkpoint_wt_last = 0.;      /* wall-clock time of last
 
 static int    _restart_from_ncfd = 0;
 
+/* Asynchronous (deferred) checkpoint writes */
+
+static bool   _restart_async_write = false;
+
+/* In-memory shadow checkpointing: interval (in checkpoints of a given
+   file) at which shadow checkpoints are written through to disk;
+   0 means shadow checkpointing is inactive */
+
+static int    _restart_shadow_interval = 0;
+
+static int                        _n_shadow_images = 0;
+static _restart_shadow_image_t  **_shadow_images = NULL;
+
+/* Sections flagged for single-precision floating-point output
+   (array of section name prefixes) */
+
+static int     _n_sp_prefixes = 0;
+static char  **_sp_prefixes = NULL;
+
 /* Restart modification */
 
 static void                        *_restart_context = NULL;
@@ -265,6 +355,476 @@ _compute_n_ents(const cs_restart_t  *r,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Return size in bytes associated with a restart value type.
+ *
+ * parameters:
+ *   val_type <-- data type of section values
+ *
+ * returns:
+ *   size in bytes of a value of the given type
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_val_type_size(cs_restart_val_type_t  val_type)
+{
+  size_t  retval = 0;
+
+  switch (val_type) {
+  case CS_TYPE_char:
+    retval = 1;
+    break;
+  case CS_TYPE_int:
+    retval = sizeof(int);
+    break;
+  case CS_TYPE_cs_gnum_t:
+    retval = sizeof(cs_gnum_t);
+    break;
+  case CS_TYPE_cs_real_t:
+    retval = sizeof(cs_real_t);
+    break;
+  case CS_TYPE_float:
+    retval = sizeof(float);
+    break;
+  default:
+    assert(0);
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Indicate if a section is flagged for single-precision output.
+ *
+ * parameters:
+ *   sec_name <-- section name
+ *
+ * returns:
+ *   true if the section name matches a registered prefix, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_single_precision_output(const char  *sec_name)
+{
+  for (int i = 0; i < _n_sp_prefixes; i++) {
+    if (strncmp(sec_name, _sp_prefixes[i], strlen(_sp_prefixes[i])) == 0)
+      return true;
+  }
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Snapshot a section's data for deferred writing.
+ *
+ * The section values are copied to a staging buffer, so the caller may
+ * modify or free the original array immediately; the actual write occurs
+ * upon the next call to cs_restart_write_fence (or at the latest when the
+ * restart file is destroyed).
+ *
+ * parameters:
+ *   restart         <-> associated restart file pointer
+ *   sec_name        <-- section name
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values per location (interlaced)
+ *   val_type        <-- data type of section values
+ *   val             <-- array of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_stage_section(cs_restart_t           *restart,
+               const char             *sec_name,
+               int                     location_id,
+               int                     n_location_vals,
+               cs_restart_val_type_t   val_type,
+               const void             *val)
+{
+  size_t  n_loc_vals = n_location_vals;
+
+  if (location_id > 0) {
+    assert(location_id <= (int)(restart->n_locations));
+    n_loc_vals *= restart->location[location_id-1].n_ents;
+  }
+
+  if (restart->n_staged_sections >= restart->n_staged_sections_max) {
+    if (restart->n_staged_sections_max == 0)
+      restart->n_staged_sections_max = 8;
+    else
+      restart->n_staged_sections_max *= 2;
+    BFT_REALLOC(restart->staged_sections,
+                restart->n_staged_sections_max,
+                _restart_staged_section_t);
+  }
+
+  _restart_staged_section_t  *s
+    = restart->staged_sections + restart->n_staged_sections;
+
+  BFT_MALLOC(s->sec_name, strlen(sec_name) + 1, char);
+  strcpy(s->sec_name, sec_name);
+
+  s->location_id = location_id;
+  s->n_location_vals = n_location_vals;
+  s->val_type = val_type;
+
+  size_t  n_bytes = n_loc_vals * _val_type_size(val_type);
+
+  BFT_MALLOC(s->val, n_bytes, cs_byte_t);
+
+  /* Device-only buffers are copied straight into the staging snapshot,
+     with no intermediate host mirror */
+
+#if defined(HAVE_ACCEL)
+  if (cs_check_device_ptr(val) == CS_ALLOC_DEVICE)
+    cs_copy_d2h(s->val, val, n_bytes);
+  else
+#endif
+    memcpy(s->val, val, n_bytes);
+
+  restart->n_staged_sections += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Write all staged sections of a restart file and release staging buffers.
+ *
+ * parameters:
+ *   restart <-> associated restart file pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_flush_staged_sections(cs_restart_t  *restart)
+{
+  for (size_t i = 0; i < restart->n_staged_sections; i++) {
+
+    _restart_staged_section_t  *s = restart->staged_sections + i;
+
+    _write_section_f(restart,
+                     _restart_context,
+                     s->sec_name,
+                     s->location_id,
+                     s->n_location_vals,
+                     s->val_type,
+                     s->val);
+
+    BFT_FREE(s->val);
+    BFT_FREE(s->sec_name);
+
+  }
+
+  restart->n_staged_sections = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the in-memory shadow image associated with a restart base name.
+ *
+ * parameters:
+ *   name         <-- base restart file name
+ *   allow_create <-- if true, create the image when not present
+ *
+ * returns:
+ *   pointer to matching shadow image, or NULL
+ *----------------------------------------------------------------------------*/
+
+static _restart_shadow_image_t *
+_shadow_image_get(const char  *name,
+                  bool         allow_create)
+{
+  for (int i = 0; i < _n_shadow_images; i++) {
+    if (strcmp(_shadow_images[i]->name, name) == 0)
+      return _shadow_images[i];
+  }
+
+  if (!allow_create)
+    return NULL;
+
+  _restart_shadow_image_t  *im = NULL;
+
+  BFT_REALLOC(_shadow_images, _n_shadow_images + 1,
+              _restart_shadow_image_t *);
+  BFT_MALLOC(im, 1, _restart_shadow_image_t);
+
+  BFT_MALLOC(im->name, strlen(name) + 1, char);
+  strcpy(im->name, name);
+
+  im->n_checkpoints = 0;
+  im->buddy_rank = -1;
+
+  im->n_locations = 0;
+  im->locations = NULL;
+
+  im->n_sections = 0;
+  im->n_sections_max = 0;
+  im->sections = NULL;
+
+  _shadow_images[_n_shadow_images] = im;
+  _n_shadow_images += 1;
+
+  return im;
+}
+
+/*----------------------------------------------------------------------------
+ * Empty a shadow image, releasing its section and location buffers.
+ *
+ * The image itself, and its checkpoint counter, are kept.
+ *
+ * parameters:
+ *   im <-> shadow image
+ *----------------------------------------------------------------------------*/
+
+static void
+_shadow_image_clear(_restart_shadow_image_t  *im)
+{
+  for (int i = 0; i < im->n_sections; i++) {
+    BFT_FREE(im->sections[i].sec_name);
+    BFT_FREE(im->sections[i].val);
+    BFT_FREE(im->sections[i].buddy_val);
+  }
+  BFT_FREE(im->sections);
+  im->n_sections = 0;
+  im->n_sections_max = 0;
+
+  for (int i = 0; i < im->n_locations; i++)
+    BFT_FREE(im->locations[i].name);
+  BFT_FREE(im->locations);
+  im->n_locations = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Capture a restart file's location definitions in its shadow image,
+ * so that a later in-memory read may rebuild them.
+ *
+ * parameters:
+ *   im <-> shadow image
+ *   r  <-- associated restart file pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_shadow_capture_locations(_restart_shadow_image_t  *im,
+                          const cs_restart_t       *r)
+{
+  for (int i = 0; i < im->n_locations; i++)
+    BFT_FREE(im->locations[i].name);
+
+  BFT_REALLOC(im->locations, r->n_locations, _restart_shadow_location_t);
+
+  for (size_t i = 0; i < r->n_locations; i++) {
+    const _location_t  *loc = r->location + i;
+    BFT_MALLOC(im->locations[i].name, strlen(loc->name) + 1, char);
+    strcpy(im->locations[i].name, loc->name);
+    im->locations[i].n_glob_ents = loc->n_glob_ents;
+    im->locations[i].n_ents = loc->n_ents;
+  }
+
+  im->n_locations = (int)(r->n_locations);
+}
+
+/*----------------------------------------------------------------------------
+ * Rebuild a restart file's location definitions from its shadow image.
+ *
+ * This plays the role of _locations_from_index for in-memory reads;
+ * local entity counts and global numbers are set later by
+ * cs_restart_add_location, as in the file-based case.
+ *
+ * parameters:
+ *   r <-> associated restart file pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_shadow_restore_locations(cs_restart_t  *r)
+{
+  const _restart_shadow_image_t  *im = r->shadow_image;
+
+  BFT_REALLOC(r->location, im->n_locations, _location_t);
+
+  for (int i = 0; i < im->n_locations; i++) {
+    _location_t  *loc = r->location + i;
+    BFT_MALLOC(loc->name, strlen(im->locations[i].name) + 1, char);
+    strcpy(loc->name, im->locations[i].name);
+    loc->id = i + 1;
+    loc->n_ents = 0;
+    loc->n_glob_ents = 0;
+    loc->n_glob_ents_f = im->locations[i].n_glob_ents;
+    loc->ent_global_num = NULL;
+    loc->_ent_global_num = NULL;
+  }
+
+  r->n_locations = im->n_locations;
+}
+
+/*----------------------------------------------------------------------------
+ * Store a section's values in a restart file's shadow image.
+ *
+ * The local values are copied to image buffers, and a mirror copy of the
+ * matching values of a buddy rank is kept alongside them, so each rank's
+ * checkpoint state is held in the memory of two ranks.
+ *
+ * parameters:
+ *   restart         <-> associated restart file pointer
+ *   sec_name        <-- section name
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values per location (interlaced)
+ *   val_type        <-- data type of section values
+ *   val             <-- array of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_shadow_stage_section(cs_restart_t           *restart,
+                      const char             *sec_name,
+                      int                     location_id,
+                      int                     n_location_vals,
+                      cs_restart_val_type_t   val_type,
+                      const void             *val)
+{
+  _restart_shadow_image_t  *im = restart->shadow_image;
+
+  size_t  n_loc_vals = n_location_vals;
+
+  if (location_id > 0) {
+    assert(location_id <= (int)(restart->n_locations));
+    n_loc_vals *= restart->location[location_id-1].n_ents;
+  }
+
+  size_t  n_bytes = n_loc_vals * _val_type_size(val_type);
+
+  /* Find a previously stored section with the same name,
+     or append a new one */
+
+  _restart_shadow_section_t  *s = NULL;
+
+  for (int i = 0; i < im->n_sections; i++) {
+    if (   im->sections[i].location_id == location_id
+        && strcmp(im->sections[i].sec_name, sec_name) == 0) {
+      s = im->sections + i;
+      break;
+    }
+  }
+
+  if (s == NULL) {
+    if (im->n_sections >= im->n_sections_max) {
+      if (im->n_sections_max == 0)
+        im->n_sections_max = 8;
+      else
+        im->n_sections_max *= 2;
+      BFT_REALLOC(im->sections, im->n_sections_max,
+                  _restart_shadow_section_t);
+    }
+    s = im->sections + im->n_sections;
+    im->n_sections += 1;
+
+    BFT_MALLOC(s->sec_name, strlen(sec_name) + 1, char);
+    strcpy(s->sec_name, sec_name);
+    s->val = NULL;
+    s->buddy_val = NULL;
+  }
+
+  s->location_id = location_id;
+  s->n_location_vals = n_location_vals;
+  s->val_type = val_type;
+
+  s->n_bytes = n_bytes;
+  BFT_REALLOC(s->val, n_bytes, cs_byte_t);
+
+#if defined(HAVE_ACCEL)
+  if (cs_check_device_ptr(val) == CS_ALLOC_DEVICE)
+    cs_copy_d2h(s->val, val, n_bytes);
+  else
+#endif
+    memcpy(s->val, val, n_bytes);
+
+  s->buddy_n_bytes = 0;
+
+#if defined(HAVE_MPI)
+
+  /* Mirror the matching values of a buddy rank, so that a copy of each
+     rank's checkpoint state survives the loss of that rank's memory
+     (usable by an external fault-tolerance layer) */
+
+  if (cs_glob_n_ranks > 1) {
+
+    int n_ranks = cs_glob_n_ranks;
+    int send_rank = (cs_glob_rank_id + n_ranks/2) % n_ranks;
+    int recv_rank = (cs_glob_rank_id + n_ranks - n_ranks/2) % n_ranks;
+
+    im->buddy_rank = recv_rank;
+
+    cs_gnum_t send_size = n_bytes, recv_size = 0;
+
+    MPI_Sendrecv(&send_size, 1, CS_MPI_GNUM, send_rank, 0,
+                 &recv_size, 1, CS_MPI_GNUM, recv_rank, 0,
+                 cs_glob_mpi_comm, MPI_STATUS_IGNORE);
+
+    s->buddy_n_bytes = recv_size;
+    BFT_REALLOC(s->buddy_val, recv_size, cs_byte_t);
+
+    MPI_Sendrecv(s->val, (int)n_bytes, MPI_BYTE, send_rank, 1,
+                 s->buddy_val, (int)recv_size, MPI_BYTE, recv_rank, 1,
+                 cs_glob_mpi_comm, MPI_STATUS_IGNORE);
+
+  }
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Check for, and optionally read, a section of a restart shadow image.
+ *
+ * As in-memory reads imply restarting within the same run, on the same
+ * partitioning, values are returned as stored, with no redistribution.
+ *
+ * parameters:
+ *   restart         <-- associated restart file pointer
+ *   sec_name        <-- section name
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values per location (interlaced)
+ *   val_type        <-- data type of section values
+ *   val             --> array of values, or NULL to only check presence
+ *
+ * returns:
+ *   0 (CS_RESTART_SUCCESS) in case of success,
+ *   or error code (CS_RESTART_ERR_xxx) otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_shadow_read_section(cs_restart_t           *restart,
+                     const char             *sec_name,
+                     int                     location_id,
+                     int                     n_location_vals,
+                     cs_restart_val_type_t   val_type,
+                     void                   *val)
+{
+  const _restart_shadow_image_t  *im = restart->shadow_image;
+
+  const _restart_shadow_section_t  *s = NULL;
+
+  for (int i = 0; i < im->n_sections; i++) {
+    if (strcmp(im->sections[i].sec_name, sec_name) == 0) {
+      s = im->sections + i;
+      break;
+    }
+  }
+
+  if (s == NULL)
+    return CS_RESTART_ERR_EXISTS;
+
+  if (s->location_id != location_id)
+    return CS_RESTART_ERR_LOCATION;
+
+  if (s->val_type != val_type)
+    return CS_RESTART_ERR_VAL_TYPE;
+
+  size_t  n_loc_vals = n_location_vals;
+  if (location_id > 0)
+    n_loc_vals *= restart->location[location_id-1].n_ents;
+
+  if (   s->n_location_vals != n_location_vals
+      || s->n_bytes != n_loc_vals * _val_type_size(val_type))
+    return CS_RESTART_ERR_N_VALS;
+
+  if (val != NULL)
+    memcpy(val, s->val, s->n_bytes);
+
+  return CS_RESTART_SUCCESS;
+}
+
 /*----------------------------------------------------------------------------
  * Analyze the content of a restart file to build locations
  *
@@ -324,6 +884,79 @@ _locations_from_index(cs_restart_t  *r)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Build a section name to first record id map from a file index.
+ *
+ * This allows searching for sections by name in constant rather than
+ * linear time, which matters when restart files contain hundreds of
+ * sections. A section name may appear several times in the index (with
+ * different location ids), so the map points to the first matching
+ * record, from which a short forward scan may be done if needed.
+ *
+ * parameters:
+ *   r <-> associated restart file pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_section_index_map(cs_restart_t  *r)
+{
+  size_t index_size = cs_io_get_index_size(r->fh);
+
+  r->sec_id_map = cs_map_name_to_id_create();
+  BFT_MALLOC(r->sec_first_rec, index_size, int);
+
+  for (size_t rec_id = 0; rec_id < index_size; rec_id++) {
+
+    const char *sec_name = cs_io_get_indexed_sec_name(r->fh, rec_id);
+
+    int prev_size = cs_map_name_to_id_size(r->sec_id_map);
+    int map_id = cs_map_name_to_id(r->sec_id_map, sec_name);
+
+    if (map_id >= prev_size)  /* newly inserted name */
+      r->sec_first_rec[map_id] = rec_id;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Find the first record matching a section name in an indexed restart file.
+ *
+ * parameters:
+ *   restart  <-- associated restart file pointer
+ *   sec_name <-- section name
+ *
+ * returns:
+ *   id of the first matching record in the file index, or the index size
+ *   if the section is not present
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_first_rec_id(const cs_restart_t  *restart,
+              const char          *sec_name)
+{
+  size_t index_size = cs_io_get_index_size(restart->fh);
+
+  if (restart->sec_id_map != NULL) {
+    int map_id = cs_map_name_to_id_try(restart->sec_id_map, sec_name);
+    if (map_id > -1)
+      return restart->sec_first_rec[map_id];
+    else
+      return index_size;
+  }
+
+  /* Fallback if no map is available */
+
+  size_t rec_id;
+
+  for (rec_id = 0; rec_id < index_size; rec_id++) {
+    const char *cmp_name = cs_io_get_indexed_sec_name(restart->fh, rec_id);
+    if (strcmp(cmp_name, sec_name) == 0)
+      break;
+  }
+
+  return rec_id;
+}
+
 /*----------------------------------------------------------------------------
  * Initialize a checkpoint / restart file management structure;
  *
@@ -365,6 +998,7 @@ _add_file(cs_restart_t  *r)
                                           block_comm,
                                           comm);
       _locations_from_index(r);
+      _build_section_index_map(r);
     }
     else {
       cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
@@ -387,6 +1021,7 @@ _add_file(cs_restart_t  *r)
                                           method,
                                           echo);
       _locations_from_index(r);
+      _build_section_index_map(r);
     }
     else {
       cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
@@ -558,6 +1193,10 @@ _write_ent_values(const cs_restart_t     *r,
     elt_type =   (sizeof(cs_real_t) == cs_datatype_size[CS_DOUBLE])
                ? CS_DOUBLE : CS_FLOAT;
     break;
+  case CS_TYPE_float:
+    nbr_byte_ent = n_location_vals * sizeof(float);
+    elt_type = CS_FLOAT;
+    break;
   default:
     assert(0);
   }
@@ -825,6 +1464,23 @@ _restart_permute_write(cs_lnum_t               n_ents,
     }
     break;
 
+  case CS_TYPE_float:
+    {
+      float  *val_ord;
+      const float  *val_cur = (const float *)vals;
+
+      BFT_MALLOC(val_ord, n_ents * n_location_vals, float);
+
+      for (ent_id = 0; ent_id < n_ents; ent_id++) {
+        for (jj = 0; jj < n_location_vals; jj++)
+          val_ord[(ini_ent_num[ent_id] - 1) * n_location_vals + jj]
+            = val_cur[ii++];
+      }
+
+      return (cs_byte_t *)val_ord;
+    }
+    break;
+
   default:
     assert(0);
     return NULL;
@@ -885,11 +1541,7 @@ _restart_section_id(cs_restart_t     *restart,
 
   /* Search for the record in the index */
 
-  for (rec_id = 0; rec_id < (int)index_size; rec_id++) {
-    const char * cmp_name = cs_io_get_indexed_sec_name(restart->fh, rec_id);
-    if (strcmp(cmp_name, sec_name) == 0)
-      break;
-  }
+  rec_id = _first_rec_id(restart, sec_name);
 
   if (rec_id >= (int)index_size) {
     bft_printf(_("  %s: section \"%s\" not present.\n"),
@@ -1067,11 +1719,7 @@ _check_section(cs_restart_t           *restart,
 
   /* Search for the corresponding record in the index */
 
-  for (rec_id = 0; rec_id < index_size; rec_id++) {
-    const char * cmp_name = cs_io_get_indexed_sec_name(restart->fh, rec_id);
-    if (strcmp(cmp_name, sec_name) == 0)
-      break;
-  }
+  rec_id = _first_rec_id(restart, sec_name);
 
   /* If the record was not found */
 
@@ -1207,11 +1855,7 @@ _read_section(cs_restart_t           *restart,
 
   /* Search for the corresponding record in the index */
 
-  for (rec_id = 0; rec_id < index_size; rec_id++) {
-    const char * cmp_name = cs_io_get_indexed_sec_name(restart->fh, rec_id);
-    if (strcmp(cmp_name, sec_name) == 0)
-      break;
-  }
+  rec_id = _first_rec_id(restart, sec_name);
 
   /* If the record was not found */
 
@@ -1409,6 +2053,42 @@ _write_section(cs_restart_t           *restart,
     ent_global_num = (restart->location[location_id-1]).ent_global_num;
   }
 
+  /* The I/O layers operate on host memory, so device-only buffers are
+     staged through a temporary host copy, one section at a time. */
+
+  cs_byte_t  *val_h = NULL;
+
+#if defined(HAVE_ACCEL)
+  if (cs_check_device_ptr(val) == CS_ALLOC_DEVICE) {
+    size_t n_bytes = (size_t)n_ents * _n_location_vals
+                       * _val_type_size(val_type);
+    BFT_MALLOC(val_h, n_bytes, cs_byte_t);
+    cs_copy_d2h(val_h, val, n_bytes);
+    val = val_h;
+  }
+#endif
+
+  /* Convert flagged sections to single precision; matching sections are
+     read back as cs_real_t values transparently, as the cs_io layer
+     converts floating-point types on read. */
+
+  float *val_sp = NULL;
+
+  if (   val_type == CS_TYPE_cs_real_t
+      && sizeof(cs_real_t) == cs_datatype_size[CS_DOUBLE]
+      && _single_precision_output(sec_name)) {
+
+    const cs_real_t *val_r = (const cs_real_t *)val;
+    const cs_lnum_t  n_loc_vals = n_ents * _n_location_vals;
+
+    BFT_MALLOC(val_sp, n_loc_vals, float);
+    for (cs_lnum_t i = 0; i < n_loc_vals; i++)
+      val_sp[i] = val_r[i];
+
+    val = val_sp;
+    val_type = CS_TYPE_float;
+  }
+
   /* Set val_type */
 
   switch (val_type) {
@@ -1425,6 +2105,9 @@ _write_section(cs_restart_t           *restart,
     elt_type =   (sizeof(cs_real_t) == cs_datatype_size[CS_DOUBLE])
                ? CS_DOUBLE : CS_FLOAT;
     break;
+  case CS_TYPE_float:
+    elt_type = CS_FLOAT;
+    break;
   default:
     assert(0);
   }
@@ -1484,6 +2167,9 @@ _write_section(cs_restart_t           *restart,
                       (const cs_byte_t *)val);
 
 #endif /* #if defined(HAVE_MPI) */
+
+  BFT_FREE(val_sp);
+  BFT_FREE(val_h);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1978,6 +2664,124 @@ cs_restart_checkpoint_set_next_wt(double  wt_next)
   _checkpoint_wt_next = wt_next;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate or deactivate asynchronous checkpoint writing.
+ *
+ * When active, sections passed to \ref cs_restart_write_section for files
+ * opened in write mode after this call are snapshotted to staging buffers,
+ * and actually written upon the next call to \ref cs_restart_write_fence,
+ * or at the latest when the file is closed. The calling code may thus
+ * resume time stepping immediately after checkpoint sections are defined,
+ * and place the completion fence where it causes the least solver stall.
+ *
+ * \param[in]  enable  true to enable, false to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_async_write(bool  enable)
+{
+  _restart_async_write = enable;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate if asynchronous checkpoint writing is active.
+ *
+ * \return  true if asynchronous checkpoint writing is active,
+ *          false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_restart_get_async_write(void)
+{
+  return _restart_async_write;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate or deactivate in-memory shadow checkpointing.
+ *
+ * When active, checkpoint files opened in write mode are not written
+ * to the filesystem: their sections are stored in memory, with a mirror
+ * copy of each rank's values held on a buddy rank, and only every
+ * \c demote_interval-th checkpoint of a given file is actually written
+ * to disk. Reading a restart file for which a live in-memory checkpoint
+ * exists (i.e. restarting within the same run, on the same partitioning)
+ * uses the in-memory values; otherwise, the last checkpoint written to
+ * disk is used, as with standard checkpointing.
+ *
+ * This reduces the filesystem load of frequent defensive checkpoints;
+ * recovery after a full job failure remains limited to the checkpoints
+ * written through to disk.
+ *
+ * \param[in]  demote_interval  interval, in checkpoints of a given file,
+ *                              at which in-memory checkpoints are written
+ *                              through to disk; 0 to deactivate shadow
+ *                              checkpointing
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_shadow_checkpoint(int  demote_interval)
+{
+  if (demote_interval < 0)
+    demote_interval = 0;
+
+  _restart_shadow_interval = demote_interval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the interval at which in-memory shadow checkpoints are
+ *         written through to disk.
+ *
+ * \return  demotion interval, or 0 if shadow checkpointing is inactive
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_restart_get_shadow_checkpoint(void)
+{
+  return _restart_shadow_interval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Flag sections for single-precision checkpoint output.
+ *
+ * Floating-point values of sections whose name starts with the given
+ * prefix are converted to single precision when written, and converted
+ * back to cs_real_t values when read. The conversion is lossy, so this
+ * should only be used for fields whose exact restart values are not
+ * critical (such as post-processing accumulators), to reduce checkpoint
+ * size and write time. Registering a field's name as prefix flags all
+ * of that field's value sections.
+ *
+ * \param[in]  sec_name_prefix  section name prefix
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_add_single_precision_section(const char  *sec_name_prefix)
+{
+  if (sec_name_prefix == NULL)
+    return;
+
+  for (int i = 0; i < _n_sp_prefixes; i++) {
+    if (strcmp(_sp_prefixes[i], sec_name_prefix) == 0)
+      return;
+  }
+
+  BFT_REALLOC(_sp_prefixes, _n_sp_prefixes + 1, char *);
+  BFT_MALLOC(_sp_prefixes[_n_sp_prefixes], strlen(sec_name_prefix) + 1, char);
+  strcpy(_sp_prefixes[_n_sp_prefixes], sec_name_prefix);
+
+  _n_sp_prefixes += 1;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Check if checkpointing is recommended at a given time.
@@ -2170,9 +2974,37 @@ cs_restart_create(const char         *name,
       _path = _restart;
   }
 
+  /* Determine whether this file uses an in-memory shadow image
+     rather than the filesystem */
+
+  bool shadow = false;
+  _restart_shadow_image_t  *shadow_image = NULL;
+
+  if (_restart_shadow_interval > 0) {
+    if (mode == CS_RESTART_MODE_WRITE) {
+      shadow_image = _shadow_image_get(name, true);
+      shadow_image->n_checkpoints += 1;
+      /* Keep every n-th checkpoint on disk; others stay in memory only.
+         Either way, the previous image contents are superseded, so that
+         reads always use the most recent checkpoint. */
+      if (shadow_image->n_checkpoints % _restart_shadow_interval != 0)
+        shadow = true;
+      _shadow_image_clear(shadow_image);
+      if (!shadow)
+        shadow_image = NULL;
+    }
+    else {
+      shadow_image = _shadow_image_get(name, false);
+      if (shadow_image != NULL && shadow_image->n_sections > 0)
+        shadow = true;
+      else
+        shadow_image = NULL;
+    }
+  }
+
   /* Create 'checkpoint' directory or read from 'restart' directory */
 
-  if (cs_glob_rank_id < 1) {
+  if (cs_glob_rank_id < 1 && !shadow) {
     if (mode == CS_RESTART_MODE_WRITE) {
       if (cs_file_mkdir_default(_path) != 0)
         bft_error(__FILE__, __LINE__, 0,
@@ -2204,7 +3036,7 @@ cs_restart_create(const char         *name,
   /* Following the addition of an extension, we check for READ mode
    * if a file exists without the extension */
 
-  if (mode == CS_RESTART_MODE_READ) {
+  if (mode == CS_RESTART_MODE_READ && !shadow) {
 
     if (cs_file_isreg(_name) == 0 && cs_file_endswith(name, _extension)) {
       BFT_FREE(_name);
@@ -2218,7 +3050,7 @@ cs_restart_create(const char         *name,
       _name[ldir+lname-lext+1] = '\0';
     }
 
-  } else if (mode == CS_RESTART_MODE_WRITE) {
+  } else if (mode == CS_RESTART_MODE_WRITE && !shadow) {
 
     /* Check if file already exists, and if so rename and delete if needed */
     int writer_id = _add_restart_multiwriter(name, _name);
@@ -2290,9 +3122,30 @@ cs_restart_create(const char         *name,
   restart->n_locations = 0;
   restart->location = NULL;
 
-  /* Open associated file, and build an index of sections in read mode */
+  restart->sec_id_map = NULL;
+  restart->sec_first_rec = NULL;
+
+  /* Initialize deferred write data */
+
+  restart->async_write = false;
+  if (_restart_async_write && mode == CS_RESTART_MODE_WRITE)
+    restart->async_write = true;
 
-  _add_file(restart);
+  restart->n_staged_sections = 0;
+  restart->n_staged_sections_max = 0;
+  restart->staged_sections = NULL;
+
+  restart->shadow = shadow;
+  restart->shadow_image = shadow_image;
+
+  /* Open associated file, and build an index of sections in read mode;
+     when an in-memory shadow image is used, no file is opened, and
+     locations are rebuilt from the image in read mode */
+
+  if (!shadow)
+    _add_file(restart);
+  else if (mode == CS_RESTART_MODE_READ)
+    _shadow_restore_locations(restart);
 
   /* Add basic location definitions */
 
@@ -2338,6 +3191,18 @@ cs_restart_destroy(cs_restart_t  **restart)
 
   mode = r->mode;
 
+  /* Write sections whose output was deferred */
+
+  if (r->n_staged_sections > 0)
+    _flush_staged_sections(r);
+  BFT_FREE(r->staged_sections);
+
+  /* Capture location definitions in the shadow image, so a later
+     in-memory read may rebuild them */
+
+  if (r->shadow && mode == CS_RESTART_MODE_WRITE)
+    _shadow_capture_locations(r->shadow_image, r);
+
   if (r->fh != NULL)
     cs_io_finalize(&(r->fh));
 
@@ -2353,6 +3218,12 @@ cs_restart_destroy(cs_restart_t  **restart)
   if (r->location != NULL)
     BFT_FREE(r->location);
 
+  /* Free section index map */
+
+  if (r->sec_id_map != NULL)
+    cs_map_name_to_id_destroy(&(r->sec_id_map));
+  BFT_FREE(r->sec_first_rec);
+
   /* Free remaining memory */
 
   BFT_FREE(r->name);
@@ -2503,9 +3374,10 @@ cs_restart_add_location(cs_restart_t     *restart,
     (restart->location[restart->n_locations-1]).ent_global_num = ent_global_num;
     (restart->location[restart->n_locations-1])._ent_global_num = NULL;
 
-    cs_io_write_global(location_name, 1, restart->n_locations, 0, 0,
-                       gnum_type, &n_glob_ents,
-                       restart->fh);
+    if (restart->fh != NULL)
+      cs_io_write_global(location_name, 1, restart->n_locations, 0, 0,
+                         gnum_type, &n_glob_ents,
+                         restart->fh);
 
     timing[1] = cs_timer_wtime();
     _restart_wtime[restart->mode] += timing[1] - timing[0];
@@ -2745,7 +3617,8 @@ cs_restart_dump_index(const cs_restart_t  *restart)
 
   bft_printf(_("  General information associated with the restart file:\n"));
 
-  cs_io_dump(restart->fh);
+  if (restart->fh != NULL)
+    cs_io_dump(restart->fh);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2772,6 +3645,14 @@ cs_restart_check_section(cs_restart_t           *restart,
 {
   assert(restart != NULL);
 
+  if (restart->shadow)
+    return _shadow_read_section(restart,
+                                sec_name,
+                                location_id,
+                                n_location_vals,
+                                val_type,
+                                NULL);
+
   return _check_section_f(restart,
                           _restart_context,
                           sec_name,
@@ -2810,13 +3691,24 @@ cs_restart_read_section(cs_restart_t           *restart,
 
   assert(restart != NULL);
 
-  int retval = _read_section_f(restart,
-                               _restart_context,
-                               sec_name,
-                               location_id,
-                               n_location_vals,
-                               val_type,
-                               val);
+  int retval;
+
+  if (restart->shadow)
+    retval = _shadow_read_section(restart,
+                                  sec_name,
+                                  location_id,
+                                  n_location_vals,
+                                  val_type,
+                                  val);
+
+  else
+    retval = _read_section_f(restart,
+                             _restart_context,
+                             sec_name,
+                             location_id,
+                             n_location_vals,
+                             val_type,
+                             val);
 
   timing[1] = cs_timer_wtime();
   _restart_wtime[restart->mode] += timing[1] - timing[0];
@@ -2853,14 +3745,68 @@ cs_restart_write_section(cs_restart_t           *restart,
 
   assert(restart != NULL);
 
-  _write_section_f(restart,
-                   _restart_context,
+  if (restart->shadow)
+    _shadow_stage_section(restart,
+                          sec_name,
+                          location_id,
+                          n_location_vals,
+                          val_type,
+                          val);
+
+  else if (restart->async_write)
+    _stage_section(restart,
                    sec_name,
                    location_id,
                    n_location_vals,
                    val_type,
                    val);
 
+  else
+    _write_section_f(restart,
+                     _restart_context,
+                     sec_name,
+                     location_id,
+                     n_location_vals,
+                     val_type,
+                     val);
+
+  timing[1] = cs_timer_wtime();
+  _restart_wtime[restart->mode] += timing[1] - timing[0];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Ensure all sections written to a restart file have reached
+ *         the file layer.
+ *
+ * When asynchronous checkpoint writing is enabled
+ * (see \ref cs_restart_set_async_write), sections passed to
+ * \ref cs_restart_write_section are snapshotted to staging buffers and
+ * their output deferred, so the caller may continue time stepping and
+ * reuse the associated arrays immediately. This function acts as the
+ * matching completion fence: it writes all staged sections and releases
+ * the staging buffers. It is called automatically when the restart
+ * file is destroyed.
+ *
+ * When asynchronous checkpoint writing is disabled, this function has
+ * no effect.
+ *
+ * \param[in, out]  restart  associated restart file pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_write_fence(cs_restart_t  *restart)
+{
+  double timing[2];
+
+  timing[0] = cs_timer_wtime();
+
+  assert(restart != NULL);
+
+  if (restart->n_staged_sections > 0)
+    _flush_staged_sections(restart);
+
   timing[1] = cs_timer_wtime();
   _restart_wtime[restart->mode] += timing[1] - timing[0];
 }
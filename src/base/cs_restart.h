@@ -85,6 +85,7 @@ typedef enum {
   CS_TYPE_int,
   CS_TYPE_cs_gnum_t,
   CS_TYPE_cs_real_t,
+  CS_TYPE_float            /* single precision, for reduced-precision output */
 } cs_restart_val_type_t;
 
 /*
@@ -364,6 +365,94 @@ cs_restart_checkpoint_set_next_tv(double  t_next);
 void
 cs_restart_checkpoint_set_next_wt(double  wt_next);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate or deactivate asynchronous checkpoint writing.
+ *
+ * When active, sections passed to \ref cs_restart_write_section for files
+ * opened in write mode after this call are snapshotted to staging buffers,
+ * and actually written upon the next call to \ref cs_restart_write_fence,
+ * or at the latest when the file is closed. The calling code may thus
+ * resume time stepping immediately after checkpoint sections are defined,
+ * and place the completion fence where it causes the least solver stall.
+ *
+ * \param[in]  enable  true to enable, false to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_async_write(bool  enable);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate if asynchronous checkpoint writing is active.
+ *
+ * \return  true if asynchronous checkpoint writing is active,
+ *          false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_restart_get_async_write(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate or deactivate in-memory shadow checkpointing.
+ *
+ * When active, checkpoint files opened in write mode are not written
+ * to the filesystem: their sections are stored in memory, with a mirror
+ * copy of each rank's values held on a buddy rank, and only every
+ * \c demote_interval-th checkpoint of a given file is actually written
+ * to disk. Reading a restart file for which a live in-memory checkpoint
+ * exists (i.e. restarting within the same run, on the same partitioning)
+ * uses the in-memory values; otherwise, the last checkpoint written to
+ * disk is used, as with standard checkpointing.
+ *
+ * This reduces the filesystem load of frequent defensive checkpoints;
+ * recovery after a full job failure remains limited to the checkpoints
+ * written through to disk.
+ *
+ * \param[in]  demote_interval  interval, in checkpoints of a given file,
+ *                              at which in-memory checkpoints are written
+ *                              through to disk; 0 to deactivate shadow
+ *                              checkpointing
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_shadow_checkpoint(int  demote_interval);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the interval at which in-memory shadow checkpoints are
+ *         written through to disk.
+ *
+ * \return  demotion interval, or 0 if shadow checkpointing is inactive
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_restart_get_shadow_checkpoint(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Flag sections for single-precision checkpoint output.
+ *
+ * Floating-point values of sections whose name starts with the given
+ * prefix are converted to single precision when written, and converted
+ * back to cs_real_t values when read. The conversion is lossy, so this
+ * should only be used for fields whose exact restart values are not
+ * critical (such as post-processing accumulators), to reduce checkpoint
+ * size and write time. Registering a field's name as prefix flags all
+ * of that field's value sections.
+ *
+ * \param[in]  sec_name_prefix  section name prefix
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_add_single_precision_section(const char  *sec_name_prefix);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Check if checkpointing is recommended at a given time.
@@ -676,6 +765,24 @@ cs_restart_write_section(cs_restart_t           *restart,
                          cs_restart_val_type_t   val_type,
                          const void             *val);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Ensure all sections written to a restart file have reached
+ *         the file layer.
+ *
+ * This is the completion fence matching asynchronous checkpoint writing
+ * (see \ref cs_restart_set_async_write): it writes all staged sections
+ * and releases the associated staging buffers. It is called automatically
+ * when the restart file is destroyed, and has no effect when asynchronous
+ * checkpoint writing is disabled.
+ *
+ * \param[in, out]  restart  associated restart file pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_write_fence(cs_restart_t  *restart);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Read basic particles information from a restart file.
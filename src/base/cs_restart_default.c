@@ -1634,6 +1634,8 @@ _read_and_convert_turb_variables(cs_restart_t  *r,
         sem_in->volume_mode = 1;
         BFT_MALLOC(sem_in->position, sem_in->n_structures, cs_real_3_t);
         BFT_MALLOC(sem_in->energy, sem_in->n_structures, cs_real_3_t);
+        sem_in->geo_scale_min = NULL;
+        sem_in->n_geo_points = 0;
 
         /* Velocity fluctuations before modifications with Lund's method */
         cs_real_3_t  *fluctuations = NULL;
@@ -108,6 +108,14 @@ static  ple_locator_t  *_locator[4] = {NULL, NULL, NULL, NULL};
 
 fvm_nodal_t  *_nodal_src = NULL;
 
+/* Precomputed sparse interpolation operator at vertices (one row per
+   distant point of the vertices locator), allowing all fields read on
+   that location to share the same geometric factorization */
+
+static cs_lnum_t  *_vtx_interp_idx = NULL;
+static cs_lnum_t  *_vtx_interp_vtx_id = NULL;
+static cs_real_t  *_vtx_interp_weight = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -231,16 +239,44 @@ _interpolate_vtx(ple_locator_t          *locator,
   unsigned char  *send_var;
   BFT_MALLOC(send_var, n_dist*loc_size, unsigned char);
 
-  cs_assert(_nodal_src != NULL);
+  if (_vtx_interp_idx != NULL) {
+
+    /* Apply precomputed interpolation operator (sparse gather) */
+
+    const cs_lnum_t  _n_dist = n_dist;
+    const cs_lnum_t  dim = n_location_vals;
+    const cs_lnum_t  *w_idx = _vtx_interp_idx;
+    const cs_lnum_t  *w_vtx_id = _vtx_interp_vtx_id;
+    const cs_real_t  *weight = _vtx_interp_weight;
+    const cs_real_t  *src = (const cs_real_t *)val_src;
+    cs_real_t  *dest = (cs_real_t *)send_var;
+
+#   pragma omp parallel for if (_n_dist > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < _n_dist; i++) {
+      for (cs_lnum_t k = 0; k < dim; k++) {
+        cs_real_t s = 0;
+        for (cs_lnum_t j = w_idx[i]; j < w_idx[i+1]; j++)
+          s += weight[j] * src[w_vtx_id[j]*dim + k];
+        dest[i*dim + k] = s;
+      }
+    }
+
+  }
+
+  else {
+
+    cs_assert(_nodal_src != NULL);
 
-  fvm_interpolate_vtx_data(_nodal_src,
-                           3,                /* entity_dim */
-                           n_location_vals,  /* data_dim */
-                           n_dist,
-                           dist_loc,
-                           point_coords,
-                           (const cs_real_t *)val_src,
-                           (cs_real_t *)send_var);
+    fvm_interpolate_vtx_data(_nodal_src,
+                             3,                /* entity_dim */
+                             n_location_vals,  /* data_dim */
+                             n_dist,
+                             dist_loc,
+                             point_coords,
+                             (const cs_real_t *)val_src,
+                             (cs_real_t *)send_var);
+
+  }
 
   ple_locator_exchange_point_var_all(locator,
                                      send_var,
@@ -621,14 +657,50 @@ cs_restart_map_build(void)
 
   }
 
-  /* Nodal mesh may not be needed anymore */
+  /* Precompute interpolation weights at vertices, so that all fields
+     read on that location share the same geometric factorization and
+     may be interpolated by a simple sparse operator application */
 
   if (_need_locator[3]) {
-    _nodal_src = nm;
-    nm = NULL;
+
+    ple_locator_t  *locator = _locator[3];
+
+    cs_lnum_t  n_dist = ple_locator_get_n_dist_points(locator);
+    const cs_lnum_t  *dist_loc = ple_locator_get_dist_locations(locator);
+    const ple_coord_t  *dist_coords = ple_locator_get_dist_coords(locator);
+
+    BFT_MALLOC(_vtx_interp_idx, n_dist + 1, cs_lnum_t);
+
+    fvm_interpolate_vtx_data_weights(nm,
+                                     3, /* entity_dim */
+                                     n_dist,
+                                     dist_loc,
+                                     dist_coords,
+                                     _vtx_interp_idx,
+                                     NULL,
+                                     NULL);
+
+    _vtx_interp_idx[0] = 0;
+    for (cs_lnum_t i = 0; i < n_dist; i++)
+      _vtx_interp_idx[i+1] += _vtx_interp_idx[i];
+
+    BFT_MALLOC(_vtx_interp_vtx_id, _vtx_interp_idx[n_dist], cs_lnum_t);
+    BFT_MALLOC(_vtx_interp_weight, _vtx_interp_idx[n_dist], cs_real_t);
+
+    fvm_interpolate_vtx_data_weights(nm,
+                                     3, /* entity_dim */
+                                     n_dist,
+                                     dist_loc,
+                                     dist_coords,
+                                     _vtx_interp_idx,
+                                     _vtx_interp_vtx_id,
+                                     _vtx_interp_weight);
+
   }
-  else
-    nm = fvm_nodal_destroy(nm);
+
+  /* Nodal mesh is not needed anymore */
+
+  nm = fvm_nodal_destroy(nm);
 
   /* Set associated read function if not already set */
 
@@ -658,6 +730,10 @@ cs_restart_map_free(void)
   if (_nodal_src != NULL)
     _nodal_src = fvm_nodal_destroy(_nodal_src);
 
+  BFT_FREE(_vtx_interp_idx);
+  BFT_FREE(_vtx_interp_vtx_id);
+  BFT_FREE(_vtx_interp_weight);
+
   if (_read_section_f != NULL) {
     (void)cs_restart_set_read_section_func(_read_section_f);
     _read_section_f = NULL;
@@ -0,0 +1,279 @@
+/*============================================================================
+ * Reusable scratch work arrays.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(HAVE_OPENMP)
+#include <omp.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_base.h"
+#include "cs_log.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_scratch.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_scratch.c
+        Reusable scratch work arrays.
+
+  Many operators (balances, convection-diffusion schemes, ...) require
+  temporary work arrays whose size depends only on the mesh, and which
+  were historically allocated and freed at each call, leading to
+  significant allocator traffic inside the time loop. The functions of
+  this file provide such temporary arrays from a small pool of buffers
+  which are kept allocated between calls, so the allocator is only
+  called while the buffers grow towards their high-water size.
+
+  The pool is intentionally simple: buffers must be released in any
+  order but may not be obtained or released inside an OpenMP parallel
+  section, which matches the call sites (work arrays are obtained
+  before and released after the threaded loops which use them).
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Maximum number of scratch buffers in the pool */
+
+#define CS_SCRATCH_N_BUFFERS_MAX  16
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Scratch buffer descriptor */
+
+typedef struct {
+
+  void    *buf;      /* allocated buffer, or NULL */
+  size_t   size;     /* allocated size in bytes */
+  bool     in_use;   /* is the buffer currently lent to a caller ? */
+
+} cs_scratch_buffer_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static cs_scratch_buffer_t  _buffers[CS_SCRATCH_N_BUFFERS_MAX];
+
+static int   _n_buffers = 0;
+static bool  _initialized = false;
+
+/* Statistics */
+
+static int     _n_in_use = 0;
+static int     _n_in_use_max = 0;
+static size_t  _tot_size = 0;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Free all scratch buffers, logging pool statistics.
+ *
+ * Called at finalization stage.
+ *----------------------------------------------------------------------------*/
+
+static void
+_cs_scratch_finalize(void)
+{
+  assert(_n_in_use == 0);
+
+  for (int i = 0; i < _n_buffers; i++) {
+    BFT_FREE(_buffers[i].buf);
+    _buffers[i].size = 0;
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Scratch work arrays: %d buffers (%llu kB total), "
+                  "up to %d in use simultaneously\n"),
+                _n_buffers, (unsigned long long)(_tot_size/1024),
+                _n_in_use_max);
+
+  _n_buffers = 0;
+  _tot_size = 0;
+  _initialized = false;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Obtain a scratch work array of at least the given size.
+ *
+ * The returned buffer is taken from a small pool of reusable buffers,
+ * which are kept allocated between calls, so repeated use in the time
+ * loop does not lead to repeated allocator traffic once the buffers
+ * have reached their high-water size.
+ *
+ * This function is not thread-safe, so it must not be called inside an
+ * OpenMP parallel section.
+ *
+ * \param[in]  n_bytes  required buffer size in bytes
+ *
+ * \return  pointer to scratch buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_scratch_get(size_t  n_bytes)
+{
+#if defined(HAVE_OPENMP)
+  if (omp_in_parallel())
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s must not be called inside an OpenMP parallel section."),
+              __func__);
+#endif
+
+  if (_initialized == false) {
+    cs_base_at_finalize(_cs_scratch_finalize);
+    _initialized = true;
+  }
+
+  /* Prefer the smallest available buffer which is already large enough;
+     otherwise, remember the largest available buffer, so as to limit
+     the growth needed when all available buffers are too small. */
+
+  int  buf_id = -1;
+
+  for (int i = 0; i < _n_buffers; i++) {
+    if (_buffers[i].in_use)
+      continue;
+    if (_buffers[i].size >= n_bytes) {
+      if (buf_id < 0 || _buffers[i].size < _buffers[buf_id].size
+          || _buffers[buf_id].size < n_bytes)
+        buf_id = i;
+    }
+    else if (buf_id < 0 || _buffers[buf_id].size < _buffers[i].size)
+      buf_id = i;
+  }
+
+  if (buf_id < 0) { /* All buffers in use: add one to the pool */
+
+    if (_n_buffers >= CS_SCRATCH_N_BUFFERS_MAX)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: all %d scratch buffers are already in use."),
+                __func__, CS_SCRATCH_N_BUFFERS_MAX);
+
+    buf_id = _n_buffers;
+    _buffers[buf_id].buf = NULL;
+    _buffers[buf_id].size = 0;
+    _n_buffers += 1;
+
+  }
+
+  cs_scratch_buffer_t  *b = _buffers + buf_id;
+
+  if (b->size < n_bytes) {
+    unsigned char *p = b->buf;
+    BFT_REALLOC(p, n_bytes, unsigned char);
+    b->buf = p;
+    _tot_size += n_bytes - b->size;
+    b->size = n_bytes;
+  }
+
+  b->in_use = true;
+
+  _n_in_use += 1;
+  if (_n_in_use > _n_in_use_max)
+    _n_in_use_max = _n_in_use;
+
+  return b->buf;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Release a scratch work array obtained with \ref cs_scratch_get.
+ *
+ * The associated buffer is kept allocated, and simply marked as available
+ * for a subsequent call to \ref cs_scratch_get.
+ *
+ * If the given pointer is NULL, this function does nothing.
+ *
+ * \param[in]  ptr  pointer to scratch buffer, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_scratch_release(const void  *ptr)
+{
+  if (ptr == NULL)
+    return;
+
+  for (int i = 0; i < _n_buffers; i++) {
+    if (_buffers[i].buf == ptr) {
+      assert(_buffers[i].in_use);
+      _buffers[i].in_use = false;
+      _n_in_use -= 1;
+      return;
+    }
+  }
+
+  bft_error(__FILE__, __LINE__, 0,
+            _("%s: address [%p] does not match a scratch buffer."),
+            __func__, ptr);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,108 @@
+#ifndef __CS_SCRATCH_H__
+#define __CS_SCRATCH_H__
+
+/*============================================================================
+ * Reusable scratch work arrays.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*
+ * Obtain a scratch work array for _ni elements of type _type.
+ *
+ * This macro calls cs_scratch_get(), with the required size in bytes.
+ */
+
+#define CS_SCRATCH_GET(_ptr, _ni, _type) \
+_ptr = (_type *) cs_scratch_get((_ni) * sizeof(_type))
+
+/*
+ * Release a scratch work array obtained with CS_SCRATCH_GET.
+ *
+ * This macro calls cs_scratch_release(), and sets the pointer to NULL
+ * to avoid accidental reuse. A NULL pointer argument is ignored.
+ */
+
+#define CS_SCRATCH_RELEASE(_ptr) \
+cs_scratch_release(_ptr), _ptr = NULL
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Obtain a scratch work array of at least the given size.
+ *
+ * The returned buffer is taken from a small pool of reusable buffers,
+ * which are kept allocated between calls, so repeated use in the time
+ * loop does not lead to repeated allocator traffic once the buffers
+ * have reached their high-water size.
+ *
+ * This function is not thread-safe, so it must not be called inside an
+ * OpenMP parallel section.
+ *
+ * \param[in]  n_bytes  required buffer size in bytes
+ *
+ * \return  pointer to scratch buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_scratch_get(size_t  n_bytes);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Release a scratch work array obtained with \ref cs_scratch_get.
+ *
+ * The associated buffer is kept allocated, and simply marked as available
+ * for a subsequent call to \ref cs_scratch_get.
+ *
+ * If the given pointer is NULL, this function does nothing.
+ *
+ * \param[in]  ptr  pointer to scratch buffer, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_scratch_release(const void  *ptr);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_SCRATCH_H__ */
@@ -871,7 +871,14 @@ cs_solve_equation_scalar(cs_field_t        *f,
   cs_real_t *dtr = NULL;
   {
     const int keycdt = cs_field_key_id("time_step_factor");
-    const cs_real_t cdtvar = cs_field_get_key_double(f, keycdt);
+    const int keycdti = cs_field_key_id("time_step_interval");
+    cs_real_t cdtvar = cs_field_get_key_double(f, keycdt);
+
+    /* Sub-cycled fields advance with the time accumulated since their
+       previous solve (see cs_solve_transported_variables) */
+    const int ts_interval = cs_field_get_key_int(f, keycdti);
+    if (ts_interval > 1)
+      cdtvar *= ts_interval;
 
     if (fabs(cdtvar - 1.0) > cs_math_epzero) {
       BFT_MALLOC(dtr, n_cells_ext, cs_real_t);
@@ -1881,7 +1888,14 @@ cs_solve_equation_vector(cs_field_t       *f,
   cs_real_t *dtr = NULL;
   {
     const int keycdt = cs_field_key_id("time_step_factor");
-    const cs_real_t cdtvar = cs_field_get_key_double(f, keycdt);
+    const int keycdti = cs_field_key_id("time_step_interval");
+    cs_real_t cdtvar = cs_field_get_key_double(f, keycdt);
+
+    /* Sub-cycled fields advance with the time accumulated since their
+       previous solve (see cs_solve_transported_variables) */
+    const int ts_interval = cs_field_get_key_int(f, keycdti);
+    if (ts_interval > 1)
+      cdtvar *= ts_interval;
 
     if (fabs(cdtvar - 1.0) > cs_math_epzero) {
       BFT_MALLOC(dtr, n_cells_ext, cs_real_t);
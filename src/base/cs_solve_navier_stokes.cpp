@@ -2588,12 +2588,54 @@ _velocity_prediction(const cs_mesh_t             *m,
     BFT_FREE(grad_k);
   }
 
+  /* Face diffusivity and secondary viscosity for the velocity depend only
+     on quantities which are constant over the velocity-pressure
+     sub-iterations (only the mass flux changes), so they are saved at the
+     first sub-iteration of each time step and restored at the following
+     ones instead of being recomputed.
+     The cache is not used with transient turbomachinery, where the mesh
+     (so the matching face arrays) may be updated between sub-iterations.
+     TODO: pass this as an argument to the calling function to avoid
+     statics. */
+
+  static cs_lnum_t n_i_faces_save = -1;
+  static cs_real_t *viscf_save = NULL, *viscb_save = NULL;
+  static cs_real_t *viscfi_save = NULL, *viscbi_save = NULL;
+  static cs_real_t *secvif_save = NULL, *secvib_save = NULL;
+
+  const cs_lnum_t visc_f_size
+    = (eqp_u->idften & CS_ANISOTROPIC_LEFT_DIFFUSION) ?
+      9*n_i_faces : n_i_faces;
+
+  const bool use_visc_cache
+    = (   vp_param->nterup > 1
+       && cs_turbomachinery_get_model() != CS_TURBOMACHINERY_TRANSIENT);
+
+  const bool save_visc = (use_visc_cache && iappel == 1 && iterns == 1);
+
+  const bool restore_visc = (   use_visc_cache
+                             && !(iappel == 1 && iterns == 1)
+                             && n_i_faces_save == n_i_faces);
+
   /* Transpose of velocity gradient in the diffusion term
    * These terms are taken into account in cs_balance_vector.
    * We only compute here the secondary viscosity. */
 
-  if (vp_model->ivisse == 1)
-    cs_face_viscosity_secondary(secvif, secvib);
+  if (vp_model->ivisse == 1) {
+    if (restore_visc && secvif_save != NULL) {
+      cs_array_real_copy(n_i_faces, secvif_save, secvif);
+      cs_array_real_copy(n_b_faces, secvib_save, secvib);
+    }
+    else {
+      cs_face_viscosity_secondary(secvif, secvib);
+      if (save_visc) {
+        BFT_REALLOC(secvif_save, n_i_faces, cs_real_t);
+        BFT_REALLOC(secvib_save, n_b_faces, cs_real_t);
+        cs_array_real_copy(n_i_faces, secvif, secvif_save);
+        cs_array_real_copy(n_b_faces, secvib, secvib_save);
+      }
+    }
+  }
 
   /* Head losses
    * -----------
@@ -2778,7 +2820,33 @@ _velocity_prediction(const cs_mesh_t             *m,
   /* Face diffusivity for the velocity
      --------------------------------- */
 
-  _face_diff_vel(m, mq, eqp_u, viscf, viscb, viscfi, viscbi, viscce);
+  if (restore_visc && viscf_save != NULL) {
+    cs_array_real_copy(visc_f_size, viscf_save, viscf);
+    cs_array_real_copy(n_b_faces, viscb_save, viscb);
+    if (viscfi != viscf && viscfi_save != NULL)
+      cs_array_real_copy(visc_f_size, viscfi_save, viscfi);
+    if (viscbi != viscb && viscbi_save != NULL)
+      cs_array_real_copy(n_b_faces, viscbi_save, viscbi);
+  }
+  else {
+    _face_diff_vel(m, mq, eqp_u, viscf, viscb, viscfi, viscbi, viscce);
+
+    if (save_visc) {
+      BFT_REALLOC(viscf_save, visc_f_size, cs_real_t);
+      BFT_REALLOC(viscb_save, n_b_faces, cs_real_t);
+      cs_array_real_copy(visc_f_size, viscf, viscf_save);
+      cs_array_real_copy(n_b_faces, viscb, viscb_save);
+      if (viscfi != viscf) {
+        BFT_REALLOC(viscfi_save, visc_f_size, cs_real_t);
+        cs_array_real_copy(visc_f_size, viscfi, viscfi_save);
+      }
+      if (viscbi != viscb) {
+        BFT_REALLOC(viscbi_save, n_b_faces, cs_real_t);
+        cs_array_real_copy(n_b_faces, viscbi, viscbi_save);
+      }
+      n_i_faces_save = n_i_faces;
+    }
+  }
 
   BFT_FREE(viscce);
 
@@ -129,6 +129,26 @@ static bool _initialized = false;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Check if a field's solve should be skipped at the current time step.
+ *
+ * Fields with a "time_step_interval" keyword value n > 1 are sub-cycled:
+ * they are only advanced every n time steps, using the accumulated time
+ * step (see cs_solve_equation_scalar), with the latest mass flux.
+ *----------------------------------------------------------------------------*/
+
+static bool
+_sub_cycle_skip(const cs_field_t  *f)
+{
+  const int keycdti = cs_field_key_id("time_step_interval");
+  const int ts_interval = cs_field_get_key_int(f, keycdti);
+
+  if (ts_interval > 1)
+    return (cs_glob_time_step->nt_cur % ts_interval != 0);
+
+  return false;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -257,6 +277,8 @@ cs_solve_transported_variables(int iterns)
         continue;
       if (f_scal->type & CS_FIELD_USER)
         continue;
+      if (_sub_cycle_skip(f_scal))
+        continue;
 
       /* Compressible scheme without shock:
          ---> Special processing for density, temperature and energy
@@ -501,7 +523,14 @@ cs_solve_transported_variables(int iterns)
      if the particular physics model requires it.
   */
 
-  /* Loop on user-defined scalars */
+  /* Loop on user-defined scalars.
+
+     Note: solves for scalars not coupled through variances or source
+     terms are mutually independent, but are run sequentially here, as
+     the solver stack (halo synchronization, gradient and linear system
+     work arrays) is shared; each solve is parallel internally. Running
+     independent solves concurrently would require per-equation solver
+     contexts and communicators. */
 
   for (int ii = 0; ii < n_fields; ii++) {
 
@@ -513,6 +542,8 @@ cs_solve_transported_variables(int iterns)
       continue;
     if (!(f_scal->type & CS_FIELD_USER))
       continue;
+    if (_sub_cycle_skip(f_scal))
+      continue;
 
     /* Variances and scalars
 
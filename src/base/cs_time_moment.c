@@ -79,6 +79,15 @@ BEGIN_C_DECLS
 
   \brief Temporal moments management.
 
+  Memory usage of moments and weight accumulators is kept proportional
+  to the set of currently active accumulators: value arrays not hosted
+  by a field are only allocated when the associated starting time step
+  or time value is reached (see \ref _ensure_init_moment and
+  \ref _ensure_init_weight_accumulator), so defining moments whose
+  accumulation starts late in a computation does not increase resident
+  memory before that point. Once active, accumulators are updated at
+  every time step, so they remain memory-resident.
+
   \enum cs_time_moment_type_t
 
   \brief Moment type
@@ -1455,6 +1464,113 @@ _ensure_init_moment(cs_time_moment_t  *mt)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Update mean values over a range of elements.
+ *
+ * parameters:
+ *   dim       <-- moment dimension
+ *   s_id      <-- starting element id
+ *   e_id      <-- past-the-end element id
+ *   wa_stride <-- weight accumulator stride (0 or 1)
+ *   w         <-- current weight values
+ *   wa_sum    <-- accumulated weight values
+ *   x         <-- current source data values
+ *   val       <-> mean values
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_mean(cs_lnum_t                  dim,
+             cs_lnum_t                  s_id,
+             cs_lnum_t                  e_id,
+             cs_lnum_t                  wa_stride,
+             const cs_real_t *restrict  w,
+             const cs_real_t *restrict  wa_sum,
+             const cs_real_t *restrict  x,
+             cs_real_t *restrict        val)
+{
+  for (cs_lnum_t j = s_id*dim; j < e_id*dim; j++) {
+    const cs_lnum_t k = (j*wa_stride) / dim;
+    val[j] += (x[j] - val[j]) * (w[k] / (w[k] + wa_sum[k]));
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Update variance (and associated mean) values over a range of elements.
+ *
+ * parameters:
+ *   dim       <-- moment dimension (6 for variance-covariance matrix)
+ *   s_id      <-- starting element id
+ *   e_id      <-- past-the-end element id
+ *   wa_stride <-- weight accumulator stride (0 or 1)
+ *   w         <-- current weight values
+ *   wa_sum    <-- accumulated weight values
+ *   x         <-- current source data values
+ *   m         <-> associated mean values
+ *   val       <-> variance values
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_variance(cs_lnum_t                  dim,
+                 cs_lnum_t                  s_id,
+                 cs_lnum_t                  e_id,
+                 cs_lnum_t                  wa_stride,
+                 const cs_real_t *restrict  w,
+                 const cs_real_t *restrict  wa_sum,
+                 const cs_real_t *restrict  x,
+                 cs_real_t *restrict        m,
+                 cs_real_t *restrict        val)
+{
+  if (dim == 6) { /* variance-covariance matrix */
+
+    for (cs_lnum_t je = s_id; je < e_id; je++) {
+      double delta[3], delta_n[3], r[3], m_n[3];
+      const cs_lnum_t k = je*wa_stride;
+      const double wa_sum_n = w[k] + wa_sum[k];
+      for (cs_lnum_t l = 0; l < 3; l++) {
+        cs_lnum_t jl = je*6 + l, jml = je*3 + l;
+        delta[l]   = x[jml] - m[jml];
+        r[l] = delta[l] * (w[k] / wa_sum_n);
+        m_n[l] = m[jml] + r[l];
+        delta_n[l] = x[jml] - m_n[l];
+        val[jl] =   (val[jl]*wa_sum[k] + (w[k]*delta[l]*delta_n[l]))
+                  / wa_sum_n;
+      }
+      /* Covariance terms.
+         Note we could have a symmetric formula using
+           0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
+         instead of
+           delta[i]*delta_n[j]
+         but unit tests in cs_moment_test.c do not seem to favor
+         one variant over the other; we use the simplest one.
+      */
+      cs_lnum_t j3 = je*6 + 3, j4 = je*6 + 4, j5 = je*6 + 5;
+      val[j3] =   (val[j3]*wa_sum[k] + (w[k]*delta[0]*delta_n[1]))
+                / wa_sum_n;
+      val[j4] =   (val[j4]*wa_sum[k] + (w[k]*delta[1]*delta_n[2]))
+                / wa_sum_n;
+      val[j5] =   (val[j5]*wa_sum[k] + (w[k]*delta[0]*delta_n[2]))
+                / wa_sum_n;
+      for (cs_lnum_t l = 0; l < 3; l++)
+        m[je*3 + l] += r[l];
+    }
+
+  }
+
+  else { /* simple variance */
+
+    for (cs_lnum_t j = s_id*dim; j < e_id*dim; j++) {
+      const cs_lnum_t k = (j*wa_stride) / dim;
+      double wa_sum_n = w[k] + wa_sum[k];
+      double delta = x[j] - m[j];
+      double r = delta * (w[k] / wa_sum_n);
+      double m_n = m[j] + r;
+      val[j] = (val[j]*wa_sum[k] + (w[k]*delta*(x[j]-m_n))) / wa_sum_n;
+      m[j] += r;
+    }
+
+  }
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -2047,7 +2163,13 @@ cs_time_moment_update_all(void)
       wa_cur_data[i] = NULL;
   }
 
-  /* Loop on variances first */
+  /* Build ordered list of moments to update, variances first, so that
+     a variance update also updates the associated mean before that
+     mean could be updated separately. */
+
+  int n_upd = 0;
+  int *m_list;
+  BFT_MALLOC(m_list, _n_moments, int);
 
   for (int m_type = CS_TIME_MOMENT_VARIANCE;
        m_type >= (int)CS_TIME_MOMENT_MEAN;
@@ -2060,142 +2182,182 @@ cs_time_moment_update_all(void)
 
       if (   mt->nt_cur < ts->nt_cur
           && (int)(mt->type) == m_type
-          && (mwa->nt_start > -1 && mwa->nt_start <= ts->nt_cur)) {
+          && (mwa->nt_start > -1 && mwa->nt_start <= ts->nt_cur))
+        m_list[n_upd++] = i;
+
+    }
+
+  }
+
+  /* Loop on moments, grouping those sharing source data, so that the
+     data computation function is called only once per source, and the
+     associated accumulation sweeps are fused, processing elements by
+     blocks so the current source data block remains cache-resident
+     across sweeps. */
+
+  int *m_group;
+  BFT_MALLOC(m_group, n_upd, int);
+
+  for (int li = 0; li < n_upd; li++) {
+
+    cs_time_moment_t *mt = _moment + m_list[li];
+
+    if (mt->nt_cur >= ts->nt_cur) /* mean already updated with a variance */
+      continue;
+
+    int n_group = 0;
+    m_group[n_group++] = m_list[li];
+
+    for (int lj = li+1; lj < n_upd; lj++) {
+
+      cs_time_moment_t *mt_j = _moment + m_list[lj];
+
+      if (   mt_j->nt_cur >= ts->nt_cur
+          || mt_j->data_func != mt->data_func
+          || mt_j->data_input != mt->data_input
+          || mt_j->data_dim != mt->data_dim
+          || mt_j->location_id != mt->location_id)
+        continue;
+
+      /* A mean updated along with a variance of this group must not
+         be updated a second time */
+
+      bool is_group_mean = false;
+      for (int gj = 0; gj < n_group; gj++) {
+        cs_time_moment_t *mt_g = _moment + m_group[gj];
+        if (   mt_g->type == CS_TIME_MOMENT_VARIANCE
+            && mt_g->l_id == m_list[lj])
+          is_group_mean = true;
+      }
+
+      if (! is_group_mean)
+        m_group[n_group++] = m_list[lj];
+
+    }
+
+    /* Initialize group moments and compute current source values */
+
+    cs_lnum_t x_dim = 0;
+
+    for (int gj = 0; gj < n_group; gj++) {
+      cs_time_moment_t *mt_j = _moment + m_group[gj];
+      _ensure_init_moment(mt_j);
+      if (mt_j->type == CS_TIME_MOMENT_VARIANCE) {
+        assert(mt_j->l_id > -1);
+        assert(mt_j->dim != 6 || mt_j->data_dim == 3);
+        _ensure_init_moment(_moment + mt_j->l_id);
+      }
+      x_dim = CS_MAX(x_dim, (cs_lnum_t)(mt_j->dim));
+    }
+
+    const cs_lnum_t n_elts
+      = cs_mesh_location_get_n_elts(mt->location_id)[0];
+
+    cs_real_t *restrict x;
+    BFT_MALLOC(x, n_elts*x_dim, cs_real_t);
+
+    mt->data_func(mt->data_input, x);
+
+    /* Fused accumulation, by blocks of elements */
+
+    const cs_lnum_t block_size = 8192;
+
+    for (cs_lnum_t s_id = 0; s_id < n_elts; s_id += block_size) {
+
+      const cs_lnum_t e_id = CS_MIN(s_id + block_size, n_elts);
+
+      for (int gj = 0; gj < n_group; gj++) {
+
+        cs_time_moment_t *mt_j = _moment + m_group[gj];
+        cs_time_moment_wa_t *mwa_j = _moment_wa + mt_j->wa_id;
 
         /* Current and accumulated weight */
 
         cs_lnum_t  wa_stride;
-        cs_real_t *restrict wa_sum, *restrict x;
+        cs_real_t *restrict wa_sum;
 
-        cs_real_t *const restrict w = wa_cur_data[mt->wa_id];
+        cs_real_t *const restrict w = wa_cur_data[mt_j->wa_id];
 
-        if (mwa->location_id == CS_MESH_LOCATION_NONE) {
-          wa_sum = &(mwa->val0);
+        if (mwa_j->location_id == CS_MESH_LOCATION_NONE) {
+          wa_sum = &(mwa_j->val0);
           wa_stride = 0;
         }
         else {
-          wa_sum = mwa->val;
+          wa_sum = mwa_j->val;
           wa_stride = 1;
         }
 
-        /* Current value */
-
-        const cs_lnum_t n_elts
-          = cs_mesh_location_get_n_elts(mt->location_id)[0];
-        const cs_lnum_t nd = n_elts * mt->dim;
-
-        BFT_MALLOC(x, nd, cs_real_t);
-
-        mt->data_func(mt->data_input, x);
-
-        _ensure_init_moment(mt);
-
-        cs_real_t *restrict val = mt->val;
-        if (mt->f_id > -1) {
-          cs_field_t *f = cs_field_by_id(mt->f_id);
+        cs_real_t *restrict val = mt_j->val;
+        if (mt_j->f_id > -1) {
+          cs_field_t *f = cs_field_by_id(mt_j->f_id);
           val = f->val;
         }
 
-        if (mt->type == CS_TIME_MOMENT_VARIANCE) {
-
-          assert(mt->l_id > -1);
+        if (mt_j->type == CS_TIME_MOMENT_VARIANCE) {
 
-          cs_time_moment_t *mt_mean = _moment + mt->l_id;
+          cs_time_moment_t *mt_mean = _moment + mt_j->l_id;
 
-          _ensure_init_moment(mt_mean);
           cs_real_t *restrict m = mt_mean->val;
           if (mt_mean->f_id > -1) {
             cs_field_t *f_mean = cs_field_by_id(mt_mean->f_id);
             m = f_mean->val;
           }
 
-          if (mt->dim == 6) { /* variance-covariance matrix */
-            assert(mt->data_dim == 3);
-            for (cs_lnum_t je = 0; je < n_elts; je++) {
-              double delta[3], delta_n[3], r[3], m_n[3];
-              const cs_lnum_t k = je*wa_stride;
-              const double wa_sum_n = w[k] + wa_sum[k];
-              for (cs_lnum_t l = 0; l < 3; l++) {
-                cs_lnum_t jl = je*6 + l, jml = je*3 + l;
-                delta[l]   = x[jml] - m[jml];
-                r[l] = delta[l] * (w[k] / wa_sum_n);
-                m_n[l] = m[jml] + r[l];
-                delta_n[l] = x[jml] - m_n[l];
-                val[jl] =   (val[jl]*wa_sum[k] + (w[k]*delta[l]*delta_n[l]))
-                          / wa_sum_n;
-              }
-              /* Covariance terms.
-                 Note we could have a symmetric formula using
-                   0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
-                 instead of
-                   delta[i]*delta_n[j]
-                 but unit tests in cs_moment_test.c do not seem to favor
-                 one variant over the other; we use the simplest one.
-              */
-              cs_lnum_t j3 = je*6 + 3, j4 = je*6 + 4, j5 = je*6 + 5;
-              val[j3] =   (val[j3]*wa_sum[k] + (w[k]*delta[0]*delta_n[1]))
-                        / wa_sum_n;
-              val[j4] =   (val[j4]*wa_sum[k] + (w[k]*delta[1]*delta_n[2]))
-                        / wa_sum_n;
-              val[j5] =   (val[j5]*wa_sum[k] + (w[k]*delta[0]*delta_n[2]))
-                        / wa_sum_n;
-              for (cs_lnum_t l = 0; l < 3; l++)
-                m[je*3 + l] += r[l];
-            }
-          }
+          _update_variance(mt_j->dim, s_id, e_id, wa_stride,
+                           w, wa_sum, x, m, val);
 
-          else { /* simple variance */
-            for (cs_lnum_t j = 0; j < nd; j++) {
-              const cs_lnum_t k = (j*wa_stride) / mt->dim;
-              double wa_sum_n = w[k] + wa_sum[k];
-              double delta = x[j] - m[j];
-              double r = delta * (w[k] / wa_sum_n);
-              double m_n = m[j] + r;
-              val[j] = (val[j]*wa_sum[k] + (w[k]*delta*(x[j]-m_n))) / wa_sum_n;
-              m[j] += r;
-            }
-          }
-
-          mt_mean->nt_cur = ts->nt_cur;
         }
 
-        else if (mt->type == CS_TIME_MOMENT_MEAN) {
+        else if (mt_j->type == CS_TIME_MOMENT_MEAN)
+          _update_mean(mt_j->dim, s_id, e_id, wa_stride,
+                       w, wa_sum, x, val);
 
-          for (cs_lnum_t j = 0; j < nd; j++) {
-            const cs_lnum_t k = (j*wa_stride) / mt->dim;
-            val[j] += (x[j] - val[j]) * (w[k] / (w[k] + wa_sum[k]));
-          }
+      } /* End of loop on group moments */
 
-        }
+    } /* End of loop on blocks */
+
+    BFT_FREE(x);
+
+    for (int gj = 0; gj < n_group; gj++) {
+
+      cs_time_moment_t *mt_j = _moment + m_group[gj];
+
+      if (mt_j->type == CS_TIME_MOMENT_VARIANCE)
+        (_moment + mt_j->l_id)->nt_cur = ts->nt_cur;
 
-        mt->nt_cur = ts->nt_cur;
-
-        BFT_FREE(x);
-
-        /* Sync ghost cells so downstream use is safe */
-
-        if (mt->location_id == CS_MESH_LOCATION_CELLS) {
-          const cs_halo_t *halo = cs_glob_mesh->halo;
-          if (halo != NULL) {
-            if (mt->dim == 1)
-              cs_halo_sync_var(halo, CS_HALO_EXTENDED, val);
-            else {
-              cs_halo_sync_var_strided(halo, CS_HALO_EXTENDED, val, mt->dim);
-              if (halo->n_transforms > 0) {
-                if (mt->dim == 3)
-                  cs_halo_perio_sync_var_vect(halo, CS_HALO_EXTENDED, val, 3);
-                else if (mt->dim == 6)
-                  cs_halo_perio_sync_var_sym_tens(halo, CS_HALO_EXTENDED, val);
-              }
+      mt_j->nt_cur = ts->nt_cur;
+
+      cs_real_t *restrict val = mt_j->val;
+      if (mt_j->f_id > -1) {
+        cs_field_t *f = cs_field_by_id(mt_j->f_id);
+        val = f->val;
+      }
+
+      /* Sync ghost cells so downstream use is safe */
+
+      if (mt_j->location_id == CS_MESH_LOCATION_CELLS) {
+        const cs_halo_t *halo = cs_glob_mesh->halo;
+        if (halo != NULL) {
+          if (mt_j->dim == 1)
+            cs_halo_sync_var(halo, CS_HALO_EXTENDED, val);
+          else {
+            cs_halo_sync_var_strided(halo, CS_HALO_EXTENDED, val, mt_j->dim);
+            if (halo->n_transforms > 0) {
+              if (mt_j->dim == 3)
+                cs_halo_perio_sync_var_vect(halo, CS_HALO_EXTENDED, val, 3);
+              else if (mt_j->dim == 6)
+                cs_halo_perio_sync_var_sym_tens(halo, CS_HALO_EXTENDED, val);
             }
           }
         }
+      }
 
-      } /* End of test if moment is active */
+    } /* End of loop on group moments */
 
-    } /* End of loop on moments */
+  } /* End of loop on moments */
 
-  } /* End of loop on moment types */
+  BFT_FREE(m_group);
+  BFT_FREE(m_list);
 
   /* Update and free weight data */
 
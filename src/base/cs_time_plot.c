@@ -101,6 +101,14 @@ struct _cs_time_plot_t {
   size_t      buffer_end;       /* Current buffer end */
   char       *buffer;           /* Associated buffer if required */
 
+  size_t      vals_buffer_size; /* Binary staging buffer size */
+  size_t      vals_buffer_end;  /* Current binary staging buffer end */
+  cs_real_t  *vals_buffer;      /* Binary staging buffer for buffered
+                                   plots: samples are accumulated as raw
+                                   values and formatted only when the
+                                   buffer is written, so each sample costs
+                                   a memcpy rather than formatted output */
+
   struct _cs_time_plot_t  *prev;  /* Previous in flush list */
   struct _cs_time_plot_t  *next;  /* Next in flush list */
 
@@ -143,6 +151,103 @@ _ensure_buffer_size(cs_time_plot_t  *p,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Ensure binary staging buffer is large enough for upcoming data.
+ *
+ * The buffer is reallocated if necessary.
+ *
+ * parameters:
+ *   p        <-> time plot values file handler
+ *   min_size <-- minimum buffer size (in values)
+ *----------------------------------------------------------------------------*/
+
+static void
+_ensure_vals_buffer_size(cs_time_plot_t  *p,
+                         size_t           min_size)
+{
+  if (p->vals_buffer_size < min_size) {
+    p->vals_buffer_size = CS_MAX(64, p->vals_buffer_size);
+    while (p->vals_buffer_size < min_size)
+      p->vals_buffer_size *= 2;
+    BFT_REALLOC(p->vals_buffer, p->vals_buffer_size, cs_real_t);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Format samples accumulated in the binary staging buffer.
+ *
+ * Each staged sample is stored as {n_vals, time or time step, values},
+ * so samples with different numbers of values may share a buffer.
+ * The formatted text is appended to the plot's line buffer, and the
+ * staging buffer is emptied.
+ *
+ * parameters:
+ *   p <-> time plot values file handler
+ *----------------------------------------------------------------------------*/
+
+static void
+_format_buffered_vals(cs_time_plot_t  *p)
+{
+  size_t j = 0;
+
+  while (j < p->vals_buffer_end) {
+
+    int n_vals = (int)(p->vals_buffer[j]);
+    const cs_real_t *vals = p->vals_buffer + j + 2;
+
+    _ensure_buffer_size(p, p->buffer_end + 64);
+
+    switch (p->format) {
+
+    case CS_TIME_PLOT_DAT:
+
+      if (p->use_iteration)
+        p->buffer_end += sprintf(p->buffer + p->buffer_end, " %8d",
+                                 (int)(p->vals_buffer[j+1]));
+      else
+        p->buffer_end += sprintf(p->buffer + p->buffer_end, " %14.7e",
+                                 (double)(p->vals_buffer[j+1]));
+
+      for (int i = 0; i < n_vals; i++) {
+        _ensure_buffer_size(p, p->buffer_end + 64);
+        p->buffer_end += sprintf(p->buffer + p->buffer_end, " %14.7e",
+                                 (double)(vals[i]));
+      }
+
+      p->buffer_end += sprintf(p->buffer + p->buffer_end, "\n");
+
+      break;
+
+    case CS_TIME_PLOT_CSV:
+
+      if (p->use_iteration)
+        p->buffer_end += sprintf(p->buffer + p->buffer_end, "%8d",
+                                 (int)(p->vals_buffer[j+1]));
+      else
+        p->buffer_end += sprintf(p->buffer + p->buffer_end, "%14.7e",
+                                 (double)(p->vals_buffer[j+1]));
+
+      for (int i = 0; i < n_vals; i++) {
+        _ensure_buffer_size(p, p->buffer_end + 64);
+        p->buffer_end += sprintf(p->buffer + p->buffer_end, ", %14.7e",
+                                 (double)(vals[i]));
+      }
+
+      p->buffer_end += sprintf(p->buffer + p->buffer_end, "\n");
+
+      break;
+
+    default:
+      break;
+    }
+
+    j += (size_t)n_vals + 2;
+
+  }
+
+  p->vals_buffer_end = 0;
+}
+
 /*----------------------------------------------------------------------------
  * Write file header for xmgrace/qsplotlib readable .dat files
  *
@@ -670,6 +775,10 @@ _plot_file_create(const char             *plot_name,
 
   BFT_MALLOC(p->buffer, p->buffer_size, char);
 
+  p->vals_buffer_size = 0;
+  p->vals_buffer_end = 0;
+  p->vals_buffer = NULL;
+
   _time_plot_register(p);
 
   return p;
@@ -886,6 +995,9 @@ cs_time_plot_finalize(cs_time_plot_t  **p)
 
     _time_plot_unregister(_p);
 
+    if (_p->vals_buffer_end > 0)
+      _format_buffered_vals(_p);
+
     if (_p->buffer_steps[0] > 0)
       _p->buffer_steps[1] = _p->buffer_steps[0] + 1;
 
@@ -897,6 +1009,7 @@ cs_time_plot_finalize(cs_time_plot_t  **p)
                   _("Error closing file: \"%s\""), _p->file_name);
     }
 
+    BFT_FREE(_p->vals_buffer);
     BFT_FREE(_p->buffer);
     BFT_FREE(_p->file_name);
     BFT_FREE(_p->plot_name);
@@ -930,6 +1043,30 @@ cs_time_plot_vals_write(cs_time_plot_t  *p,
   if (p == NULL)
     return;
 
+  /* When buffering over multiple time steps, stage the raw sample and
+     defer formatting until the buffer is actually written */
+
+  if (p->buffer_steps[0] > 0) {
+
+    _ensure_vals_buffer_size(p, p->vals_buffer_end + (size_t)n_vals + 2);
+
+    cs_real_t *r = p->vals_buffer + p->vals_buffer_end;
+    r[0] = (cs_real_t)n_vals;
+    r[1] = (p->use_iteration) ? (cs_real_t)tn : (cs_real_t)t;
+    memcpy(r + 2, vals, n_vals*sizeof(cs_real_t));
+    p->vals_buffer_end += (size_t)n_vals + 2;
+
+    if (p->buffer_steps[1] < p->buffer_steps[0]) {
+      p->buffer_steps[1] += 1;
+      return;
+    }
+
+    _format_buffered_vals(p);
+    _plot_file_check_or_write(p);
+
+    return;
+  }
+
   /* Write data to line buffer */
 
   _ensure_buffer_size(p, p->buffer_end + 64);
@@ -991,6 +1128,9 @@ cs_time_plot_flush(cs_time_plot_t  *p)
 {
   /* Force buffered variant output */
 
+  if (p->vals_buffer_end > 0)
+    _format_buffered_vals(p);
+
   if (p->buffer_end > 0) {
     if (p->buffer_steps[0] > 0)
       p->buffer_steps[1] = p->buffer_steps[0];
@@ -212,6 +212,18 @@ static cs_timer_t  _cs_timer_cpu_start = {.sec = 0, .nsec = 0};
 
 int cs_glob_timer_kernels_flag = 0;
 
+#if defined(HAVE_MPI)
+
+/* Call counter and timer for global reductions, cumulated by the
+   reduction wrappers of cs_parall.h; defined here rather than in
+   cs_parall.c so that code using only the core library (such as unit
+   tests) links without it (see cs_parall_log_finalize) */
+
+unsigned long long  cs_parall_n_reduce_calls = 0;
+cs_timer_counter_t  cs_parall_reduce_timer = {0};
+
+#endif
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
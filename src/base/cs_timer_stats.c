@@ -24,6 +24,14 @@
 
 /*----------------------------------------------------------------------------*/
 
+/* On Linux, define _GNU_SOURCE so as to make the syscall() wrapper
+   available for perf_event_open; it must be defined before including
+   any headers, to ensure the correct feature macros are defined first. */
+
+#if defined(__linux__)
+#  define _GNU_SOURCE
+#endif
+
 #if defined(HAVE_CONFIG_H)
 #  include "cs_config.h"
 #endif
@@ -43,15 +51,25 @@
  *----------------------------------------------------------------------------*/
 
 #include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
 
 #include "bft_error.h"
 #include "bft_mem.h"
+#include "bft_printf.h"
 
 #include "cs_map.h"
 #include "cs_timer.h"
@@ -84,10 +102,26 @@ BEGIN_C_DECLS
   Timer statistics also allow for incrementing results from base timers
   (in addition to starting/stopping their own timers), so they may be used
   to assist logging and plotting of other timers.
+
+  On Linux, hardware counters (cycles, instructions, last-level cache
+  references and misses) may optionally be attached to the same statistic
+  tree, using the perf_event kernel interface (no external library needed).
+  Derived metrics (IPC, cache miss ratio, and an estimated memory bandwidth
+  based on last-level cache miss traffic) are then plotted per section to
+  a companion file of the main timer statistics plot. This is disabled by
+  default, and has no measurable overhead in that case.
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*-----------------------------------------------------------------------------
+ * Local macro definitions
+ *-----------------------------------------------------------------------------*/
+
+/* Number of hardware counters handled */
+
+#define CS_TIMER_STATS_N_HW_COUNTERS  4
+
 /*-----------------------------------------------------------------------------
  * Local type definitions
  *-----------------------------------------------------------------------------*/
@@ -108,6 +142,13 @@ typedef struct {
   cs_timer_counter_t   t_cur;           /* Counter since last output */
   cs_timer_counter_t   t_tot;           /* Total time counter */
 
+  /* Optional hardware counters (cycles, instructions, cache references,
+     cache misses); only updated when enabled */
+
+  uint64_t             hc_start[CS_TIMER_STATS_N_HW_COUNTERS];
+  uint64_t             hc_cur[CS_TIMER_STATS_N_HW_COUNTERS];
+  uint64_t             hc_tot[CS_TIMER_STATS_N_HW_COUNTERS];
+
 } cs_timer_stats_t;
 
 /*-------------------------------------------------------------------------------
@@ -132,6 +173,18 @@ static int  _n_roots = 0;
 static int  *_active_id = NULL;
 static cs_time_plot_t  *_time_plot = NULL;
 
+/* Hardware counter status */
+
+static bool  _hw_counters_enabled = false;  /* instrumentation requested */
+static bool  _hw_counters_active = false;   /* counters successfully opened */
+
+#if defined(__linux__)
+static int  _hw_counters_fd[CS_TIMER_STATS_N_HW_COUNTERS]
+  = {-1, -1, -1, -1};
+#endif
+
+static cs_time_plot_t  *_hw_time_plot = NULL;
+
 /* Field definitions */
 
 static int  _n_stats = 0;
@@ -211,6 +264,161 @@ _common_parent_id(int  id_0,
   return p0;
 }
 
+#if defined(__linux__)
+
+/*----------------------------------------------------------------------------
+ * Open a single perf_event hardware counter for the current process.
+ *
+ * The counter is inherited by threads created later, and read() returns
+ * the value aggregated over all of them, so OpenMP regions are counted
+ * provided the counters are opened before the first parallel region.
+ *
+ * parameters:
+ *   config  <-- generalized hardware event id
+ *
+ * return:
+ *   file descriptor of the opened counter, or -1 in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_hw_counter_open(uint64_t  config)
+{
+  struct perf_event_attr  attr;
+
+  memset(&attr, 0, sizeof(attr));
+
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.disabled = 0;
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+
+  return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Open hardware counters; set _hw_counters_active on success.
+ *
+ * In case of failure (counters not available on this machine or not
+ * allowed by the perf_event_paranoid setting), a warning is issued and
+ * the instrumentation is simply left inactive.
+ *----------------------------------------------------------------------------*/
+
+static void
+_hw_counters_open(void)
+{
+  const uint64_t  configs[CS_TIMER_STATS_N_HW_COUNTERS]
+    = {PERF_COUNT_HW_CPU_CYCLES,
+       PERF_COUNT_HW_INSTRUCTIONS,
+       PERF_COUNT_HW_CACHE_REFERENCES,
+       PERF_COUNT_HW_CACHE_MISSES};
+
+  _hw_counters_active = true;
+
+  for (int i = 0; i < CS_TIMER_STATS_N_HW_COUNTERS; i++) {
+    _hw_counters_fd[i] = _hw_counter_open(configs[i]);
+    if (_hw_counters_fd[i] < 0)
+      _hw_counters_active = false;
+  }
+
+  if (_hw_counters_active == false) {
+
+    for (int i = 0; i < CS_TIMER_STATS_N_HW_COUNTERS; i++) {
+      if (_hw_counters_fd[i] > -1) {
+        close(_hw_counters_fd[i]);
+        _hw_counters_fd[i] = -1;
+      }
+    }
+
+    bft_printf
+      (_("\nWarning: hardware counters for timer statistics not available\n"
+         "         (perf_event counters could not be opened);\n"
+         "         continuing with wall-clock timers only.\n"));
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Close hardware counters.
+ *----------------------------------------------------------------------------*/
+
+static void
+_hw_counters_close(void)
+{
+  for (int i = 0; i < CS_TIMER_STATS_N_HW_COUNTERS; i++) {
+    if (_hw_counters_fd[i] > -1) {
+      close(_hw_counters_fd[i]);
+      _hw_counters_fd[i] = -1;
+    }
+  }
+
+  _hw_counters_active = false;
+}
+
+/*----------------------------------------------------------------------------
+ * Read current hardware counter values.
+ *
+ * parameters:
+ *   hc  --> current counter values
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_hw_counters_read(uint64_t  hc[CS_TIMER_STATS_N_HW_COUNTERS])
+{
+  for (int i = 0; i < CS_TIMER_STATS_N_HW_COUNTERS; i++) {
+    if (read(_hw_counters_fd[i], hc + i, sizeof(uint64_t))
+        != sizeof(uint64_t))
+      hc[i] = 0;
+  }
+}
+
+#else /* ! defined(__linux__) */
+
+static void
+_hw_counters_open(void)
+{
+  _hw_counters_active = false;
+
+  bft_printf
+    (_("\nWarning: hardware counters for timer statistics are only\n"
+       "         available on Linux (perf_event interface);\n"
+       "         continuing with wall-clock timers only.\n"));
+}
+
+static void
+_hw_counters_close(void)
+{
+}
+
+static inline void
+_hw_counters_read(uint64_t  hc[CS_TIMER_STATS_N_HW_COUNTERS])
+{
+  for (int i = 0; i < CS_TIMER_STATS_N_HW_COUNTERS; i++)
+    hc[i] = 0;
+}
+
+#endif /* defined(__linux__) */
+
+/*----------------------------------------------------------------------------
+ * Add the difference between counter snapshots to a counter accumulator.
+ *
+ * parameters:
+ *   hc_cur    <-> accumulated counter values
+ *   hc_start  <-- counter values at start of range
+ *   hc_end    <-- counter values at end of range
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_hw_counters_add_diff(uint64_t        hc_cur[],
+                      const uint64_t  hc_start[],
+                      const uint64_t  hc_end[])
+{
+  for (int i = 0; i < CS_TIMER_STATS_N_HW_COUNTERS; i++)
+    hc_cur[i] += hc_end[i] - hc_start[i];
+}
+
 /*----------------------------------------------------------------------------
  * Create time plots
  *----------------------------------------------------------------------------*/
@@ -277,6 +485,103 @@ _output_time_plot(void)
   BFT_FREE(vals);
 }
 
+/*----------------------------------------------------------------------------
+ * Create hardware counter time plot
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_hw_time_plot(void)
+{
+  const char  *metric_names[] = {"IPC", "LLC miss ratio", "est. GB/s"};
+  const int  n_metrics = 3;
+
+  char  **metric_labels;
+  BFT_MALLOC(metric_labels, _n_stats*n_metrics, char *);
+
+  int metric_count = 0;
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    if (s->plot) {
+      for (int i = 0; i < n_metrics; i++) {
+        size_t l = strlen(s->label) + strlen(metric_names[i]) + 3;
+        BFT_MALLOC(metric_labels[metric_count], l, char);
+        snprintf(metric_labels[metric_count], l, "%s: %s",
+                 s->label, metric_names[i]);
+        metric_count++;
+      }
+    }
+  }
+
+  if (metric_count > 0) {
+    const char **labels;
+    BFT_MALLOC(labels, metric_count, const char *);
+    for (int i = 0; i < metric_count; i++)
+      labels[i] = metric_labels[i];
+    _hw_time_plot = cs_time_plot_init_probe("timer_stats_hw",
+                                            "",
+                                            _plot_format,
+                                            true,
+                                            _plot_flush_wtime,
+                                            _plot_buffer_steps,
+                                            metric_count,
+                                            NULL,
+                                            NULL,
+                                            labels);
+    BFT_FREE(labels);
+  }
+
+  for (int i = 0; i < metric_count; i++)
+    BFT_FREE(metric_labels[i]);
+  BFT_FREE(metric_labels);
+}
+
+/*----------------------------------------------------------------------------
+ * Output hardware counter time plot
+ *
+ * Per-section derived metrics are plotted rather than raw counts:
+ * instructions per cycle, last-level cache miss ratio, and an estimated
+ * memory bandwidth assuming each last-level cache miss moves one cache
+ * line from memory (a lower bound, as it ignores prefetch and write
+ * traffic, but proportional to the actual traffic in practice).
+ *----------------------------------------------------------------------------*/
+
+static void
+_output_hw_time_plot(void)
+{
+  cs_real_t *vals;
+  BFT_MALLOC(vals, _n_stats*3, cs_real_t);
+
+  int metric_count = 0;
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+
+    cs_timer_stats_t  *s = _stats + stats_id;
+    if (s->plot) {
+
+      double cycles = s->hc_cur[0];
+      double instructions = s->hc_cur[1];
+      double cache_refs = s->hc_cur[2];
+      double cache_misses = s->hc_cur[3];
+      double t = s->t_cur.nsec*1e-9;
+
+      vals[metric_count++] = (cycles > 0) ? instructions/cycles : 0;
+      vals[metric_count++] = (cache_refs > 0) ? cache_misses/cache_refs : 0;
+      vals[metric_count++] = (t > 0) ? cache_misses*CS_CL_SIZE/t*1e-9 : 0;
+
+    }
+
+  }
+
+  cs_time_plot_vals_write(_hw_time_plot,
+                          _time_id,
+                          -1.,
+                          metric_count,
+                          vals);
+
+  BFT_FREE(vals);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -306,6 +611,17 @@ cs_timer_stats_initialize(void)
 
   _name_map = cs_map_name_to_id_create();
 
+  /* Open hardware counters first, so that the root statistics
+     started below already snapshot them */
+
+  if (getenv("CS_TIMER_STATS_HW_COUNTERS") != NULL) {
+    if (atoi(getenv("CS_TIMER_STATS_HW_COUNTERS")) > 0)
+      _hw_counters_enabled = true;
+  }
+
+  if (_hw_counters_enabled && _hw_counters_active == false)
+    _hw_counters_open();
+
   id = cs_timer_stats_create(NULL, "operations", "total");
   cs_timer_stats_start(id);
 
@@ -329,6 +645,12 @@ cs_timer_stats_finalize(void)
   if (_time_plot != NULL)
     cs_time_plot_finalize(&_time_plot);
 
+  if (_hw_time_plot != NULL)
+    cs_time_plot_finalize(&_hw_time_plot);
+
+  if (_hw_counters_active)
+    _hw_counters_close();
+
   _time_id = -1;
 
   for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
@@ -396,6 +718,37 @@ cs_timer_stats_set_plot_options(cs_time_plot_format_t   format,
   _plot_flush_wtime = flush_wtime;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable hardware counter instrumentation of
+ *        timer statistics.
+ *
+ * When enabled, hardware counters (cycles, instructions, last-level cache
+ * references and misses) are attached to each timer statistic, and derived
+ * metrics (IPC, cache miss ratio, estimated memory bandwidth) are plotted
+ * per section alongside the main timer statistics plot.
+ *
+ * This requires the Linux perf_event interface, and may fail at run time
+ * depending on the kernel's perf_event_paranoid setting; in that case a
+ * warning is issued and only wall-clock timers remain active.
+ *
+ * This function should be called before \ref cs_timer_stats_initialize;
+ * instrumentation may also be enabled by setting the
+ * CS_TIMER_STATS_HW_COUNTERS environment variable to a positive value.
+ *
+ * \param[in]  enable  true to enable, false to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_hw_counters(bool  enable)
+{
+  _hw_counters_enabled = enable;
+
+  if (enable == false && _hw_counters_active)
+    _hw_counters_close();
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Increment time step for timer statistics.
@@ -407,6 +760,10 @@ cs_timer_stats_increment_time_step(void)
 {
   cs_timer_t t_incr = cs_timer_time();
 
+  uint64_t hc_incr[CS_TIMER_STATS_N_HW_COUNTERS];
+  if (_hw_counters_active)
+    _hw_counters_read(hc_incr);
+
   /* Update start and current time for active statistics
      (should be only root statistics if used properly) */
 
@@ -415,6 +772,10 @@ cs_timer_stats_increment_time_step(void)
     if (s->active) {
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_incr);
       s->t_start = t_incr;
+      if (_hw_counters_active) {
+        _hw_counters_add_diff(s->hc_cur, s->hc_start, hc_incr);
+        memcpy(s->hc_start, hc_incr, sizeof(hc_incr));
+      }
     }
   }
 
@@ -424,15 +785,26 @@ cs_timer_stats_increment_time_step(void)
       && cs_glob_rank_id < 1)
     _build_time_plot();
 
+  if (   _hw_time_plot == NULL && _time_id < _start_time_id + 1
+      && _hw_counters_active && cs_glob_rank_id < 1)
+    _build_hw_time_plot();
+
   if (_time_id % _plot_frequency == 0) {
 
     if (_time_plot != NULL)
       _output_time_plot();
 
+    if (_hw_time_plot != NULL)
+      _output_hw_time_plot();
+
     for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
       cs_timer_stats_t  *s = _stats + stats_id;
       CS_TIMER_COUNTER_ADD(s->t_tot, s->t_tot, s->t_cur);
       CS_TIMER_COUNTER_INIT(s->t_cur);
+      for (int i = 0; i < CS_TIMER_STATS_N_HW_COUNTERS; i++) {
+        s->hc_tot[i] += s->hc_cur[i];
+        s->hc_cur[i] = 0;
+      }
     }
 
   }
@@ -538,6 +910,12 @@ cs_timer_stats_create(const char  *parent_name,
   CS_TIMER_COUNTER_INIT(s->t_cur);
   CS_TIMER_COUNTER_INIT(s->t_tot);
 
+  for (int i = 0; i < CS_TIMER_STATS_N_HW_COUNTERS; i++) {
+    s->hc_start[i] = 0;
+    s->hc_cur[i] = 0;
+    s->hc_tot[i] = 0;
+  }
+
   return stats_id;
 }
 
@@ -629,6 +1007,10 @@ cs_timer_stats_start(int  id)
 
   cs_timer_t t_start = cs_timer_time();
 
+  uint64_t hc_start[CS_TIMER_STATS_N_HW_COUNTERS];
+  if (_hw_counters_active)
+    _hw_counters_read(hc_start);
+
   const int root_id = s->root_id;
 
   /* If a timer with the same root but different parents is active,
@@ -648,6 +1030,8 @@ cs_timer_stats_start(int  id)
     if (s->active == false) {
       s->active = true;
       s->t_start = t_start;
+      if (_hw_counters_active)
+        memcpy(s->hc_start, hc_start, sizeof(hc_start));
     }
 
   }
@@ -674,6 +1058,10 @@ cs_timer_stats_stop(int  id)
 
   cs_timer_t t_stop = cs_timer_time();
 
+  uint64_t hc_stop[CS_TIMER_STATS_N_HW_COUNTERS];
+  if (_hw_counters_active)
+    _hw_counters_read(hc_stop);
+
   /* Stop timer and active children */
 
   const int root_id = s->root_id;
@@ -686,6 +1074,8 @@ cs_timer_stats_stop(int  id)
       s->active = false;
       _active_id[root_id] = s->parent_id;
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_stop);
+      if (_hw_counters_active)
+        _hw_counters_add_diff(s->hc_cur, s->hc_start, hc_stop);
     }
 
   }
@@ -714,6 +1104,10 @@ cs_timer_stats_switch(int  id)
 
   cs_timer_t t_switch = cs_timer_time();
 
+  uint64_t hc_switch[CS_TIMER_STATS_N_HW_COUNTERS];
+  if (_hw_counters_active)
+    _hw_counters_read(hc_switch);
+
   const int root_id = s->root_id;
 
   retval = _active_id[root_id];
@@ -734,6 +1128,8 @@ cs_timer_stats_switch(int  id)
       s->active = false;
       _active_id[root_id] = s->parent_id;
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_switch);
+      if (_hw_counters_active)
+        _hw_counters_add_diff(s->hc_cur, s->hc_start, hc_switch);
     }
 
   }
@@ -748,6 +1144,8 @@ cs_timer_stats_switch(int  id)
     if (s->active == false) {
       s->active = true;
       s->t_start = t_switch;
+      if (_hw_counters_active)
+        memcpy(s->hc_start, hc_switch, sizeof(hc_switch));
     }
 
   }
@@ -105,6 +105,31 @@ cs_timer_stats_set_plot_options(cs_time_plot_format_t   format,
                                 int                     n_buffer_steps,
                                 double                  flush_wtime);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable hardware counter instrumentation of
+ *        timer statistics.
+ *
+ * When enabled, hardware counters (cycles, instructions, last-level cache
+ * references and misses) are attached to each timer statistic, and derived
+ * metrics (IPC, cache miss ratio, estimated memory bandwidth) are plotted
+ * per section alongside the main timer statistics plot.
+ *
+ * This requires the Linux perf_event interface, and may fail at run time
+ * depending on the kernel's perf_event_paranoid setting; in that case a
+ * warning is issued and only wall-clock timers remain active.
+ *
+ * This function should be called before \ref cs_timer_stats_initialize;
+ * instrumentation may also be enabled by setting the
+ * CS_TIMER_STATS_HW_COUNTERS environment variable to a positive value.
+ *
+ * \param[in]  enable  true to enable, false to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_hw_counters(bool  enable);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Increment time step for timer statistics.
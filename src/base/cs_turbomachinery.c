@@ -45,9 +45,11 @@
 #include "cs_interface.h"
 
 #include "cs_base.h"
+#include "cs_boundary_conditions.h"
 #include "cs_boundary_zone.h"
 #include "cs_coupling.h"
 #include "cs_cell_to_vertex.h"
+#include "cs_vertex_to_cell.h"
 #include "cs_ext_neighborhood.h"
 #include "cs_field.h"
 #include "cs_function.h"
@@ -1158,6 +1160,8 @@ _update_mesh(bool     restart_mode,
   cs_volume_zone_build_all(true);
   cs_boundary_zone_build_all(true);
 
+  cs_boundary_conditions_invalidate_steady_bcs();
+
   /* Check coherency if debugging */
 
 #if 0
@@ -1192,6 +1196,7 @@ _update_mesh(bool     restart_mode,
 
   cs_gradient_free_quantities();
   cs_cell_to_vertex_free();
+  cs_vertex_to_cell_free();
   cs_mesh_adjacencies_update_mesh();
 
   /* Update linear algebra APIs relative to mesh */
@@ -1548,6 +1553,14 @@ cs_turbomachinery_join_add(const char  *sel_criteria,
     if (_turbomachinery->model == CS_TURBOMACHINERY_TRANSIENT) {
       cs_glob_mesh->time_dep = CS_MESH_TRANSIENT_CONNECT;
       _turbomachinery->reference_mesh->time_dep = CS_MESH_TRANSIENT_CONNECT;
+
+      /* As the mesh joined at each time step is rebuilt from the (constant)
+         reference mesh, and the rotor/stator interface is a surface of
+         revolution around the rotation axis, the selected face list is the
+         same at each time step; cache it so as to avoid rebuilding the
+         selection structures at each joining. */
+
+      cs_join_set_stable_selection(cs_glob_n_joinings);
     }
   }
 
@@ -48,6 +48,7 @@
  * Local headers
  *----------------------------------------------------------------------------*/
 
+#include "bft_mem.h"
 #include "bft_printf.h"
 #include "cs_array.h"
 #include "cs_blas.h"
@@ -97,12 +98,18 @@ static cs_lnum_t n_wall = 0;
 static cs_wall_distance_options_t _wall_distance_options = {
   .need_compute = 0,
   .is_up_to_date = 0,
-  .method = 1
+  .method = 1,
+  .displ_update_tol = 0.
 };
 
 const cs_wall_distance_options_t *cs_glob_wall_distance_options
 = &_wall_distance_options;
 
+/* Mesh displacement at the last wall distance update, used to avoid
+   recomputing the wall distance when walls have barely moved (ALE) */
+
+static cs_real_3_t *_displ_upd = NULL;
+
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
 /*============================================================================
@@ -264,7 +271,9 @@ cs_wall_distance(int iterns)
     cs_parall_max(1, CS_INT_TYPE, &have_diff);
   }
 
-  /* Time evolving mesh: always update */
+  /* Time evolving mesh: update unless walls have barely moved since the
+     last update (optional, based on the cumulated displacement of wall
+     face vertices relative to the local wall distance) */
 
   else {
     for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
@@ -282,6 +291,34 @@ cs_wall_distance(int iterns)
         cs_boundary_conditions_set_neumann_scalar_hmg(f_id,
                                                       bc_coeffs_wd);
     }
+
+    const double displ_tol = _wall_distance_options.displ_update_tol;
+    const cs_field_t *f_displ = cs_field_by_name_try("mesh_displacement");
+
+    if (displ_tol > 0 && f_displ != NULL && _displ_upd != NULL) {
+
+      const cs_real_3_t *displ = (const cs_real_3_t *)f_displ->val;
+
+      cs_real_t max_ratio = 0.;
+
+      for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+        if (bc_type[f_id] != CS_SMOOTHWALL && bc_type[f_id] != CS_ROUGHWALL)
+          continue;
+        for (cs_lnum_t j = mesh->b_face_vtx_idx[f_id];
+             j < mesh->b_face_vtx_idx[f_id+1];
+             j++) {
+          cs_lnum_t vtx_id = mesh->b_face_vtx_lst[j];
+          cs_real_t delta = cs_math_3_distance(displ[vtx_id],
+                                               _displ_upd[vtx_id]);
+          max_ratio = cs_math_fmax(max_ratio, delta / b_dist[f_id]);
+        }
+      }
+
+      cs_parall_max(1, CS_REAL_TYPE, &max_ratio);
+
+      if (max_ratio < displ_tol)
+        have_diff = 0;
+    }
   }
 
   /* Immersed boundaries */
@@ -539,6 +576,18 @@ cs_wall_distance(int iterns)
   if (f_w_dist_aux_pre != NULL)
     cs_halo_sync_var(halo, CS_HALO_STANDARD, wall_dist_pre);
 
+  /* Save the mesh displacement associated with this update, for the
+     optional displacement-based update criterion */
+
+  if (_wall_distance_options.displ_update_tol > 0) {
+    const cs_field_t *f_displ = cs_field_by_name_try("mesh_displacement");
+    if (f_displ != NULL) {
+      if (_displ_upd == NULL)
+        BFT_MALLOC(_displ_upd, mesh->n_vertices, cs_real_3_t);
+      memcpy(_displ_upd, f_displ->val, sizeof(cs_real_3_t)*mesh->n_vertices);
+    }
+  }
+
   /* Compute distance to wall
      ------------------------ */
 
@@ -52,6 +52,12 @@ typedef struct {
 
   int method;        /* Computation method for the wall distance */
 
+  double displ_update_tol; /* For time-dependent meshes, relative wall
+                              displacement (cumulated since the last update,
+                              relative to the local wall distance) under
+                              which the wall distance is not recomputed
+                              (0: always recompute) */
+
 } cs_wall_distance_options_t;
 
 /*=============================================================================
@@ -407,6 +407,320 @@ cs_wall_functions_velocity(cs_wall_f_type_t  iwallf,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute friction velocity and \f$y^+\f$ / \f$u^+\f$ for a batch
+ *        of wall faces.
+ *
+ * This is the array variant of \ref cs_wall_functions_velocity: all
+ * input and output quantities are arrays indexed by the face batch.
+ * For the most common wall function types, the evaluation is done with
+ * branch-free blending between the viscous sublayer and log-layer
+ * expressions, and iterative solves are replaced by a fixed iteration
+ * count, so the face loop vectorizes; other types fall back to the
+ * per-face functions.
+ *
+ * Input arrays associated with quantities not used by the chosen wall
+ * function type may be NULL.
+ *
+ * \param[in]     iwallf        wall function type
+ * \param[in]     n_faces       number of faces in batch
+ * \param[in]     l_visc        kinematic viscosity
+ * \param[in]     t_visc        turbulent kinematic viscosity
+ * \param[in]     vel           wall projected cell center velocity
+ * \param[in]     y             wall distance
+ * \param[in]     rough_d       roughness length scale
+ *                              (not sand grain roughness)
+ * \param[in]     rnnb          \f$\vec{n}.(\tens{R}\vec{n})\f$
+ * \param[in]     kinetic_en    turbulent kinetic energy (cell center)
+ * \param[out]    iuntur        indicator: 0 in the viscous sublayer
+ * \param[in,out] nsubla        counter of cells in the viscous sublayer
+ * \param[in,out] nlogla        counter of cells in the log-layer
+ * \param[out]    ustar         friction velocity
+ * \param[out]    uk            friction velocity
+ * \param[out]    yplus         dimensionless distance to the wall
+ * \param[out]    ypup          yplus projected vel ratio
+ * \param[out]    cofimp        \f$\frac{|U_F|}{|U_I^p|}\f$ to ensure a good
+ *                              turbulence production
+ * \param[out]    dplus         dimensionless shift to the wall for scalable
+ *                              wall functions
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_wall_functions_velocity_vec(cs_wall_f_type_t  iwallf,
+                               cs_lnum_t         n_faces,
+                               const cs_real_t   l_visc[],
+                               const cs_real_t   t_visc[],
+                               const cs_real_t   vel[],
+                               const cs_real_t   y[],
+                               const cs_real_t   rough_d[],
+                               const cs_real_t   rnnb[],
+                               const cs_real_t   kinetic_en[],
+                               int               iuntur[],
+                               cs_gnum_t        *nsubla,
+                               cs_gnum_t        *nlogla,
+                               cs_real_t         ustar[],
+                               cs_real_t         uk[],
+                               cs_real_t         yplus[],
+                               cs_real_t         ypup[],
+                               cs_real_t         cofimp[],
+                               cs_real_t         dplus[])
+{
+  const double ypluli = cs_glob_wall_functions->ypluli;
+
+  cs_gnum_t n_sub = 0, n_log = 0;
+
+  switch (iwallf) {
+
+  case CS_WALL_F_DISABLED:
+
+#   pragma omp parallel for if (n_faces > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_faces; i++) {
+      ustar[i] = sqrt(vel[i] * l_visc[i] / y[i]);
+      yplus[i] = ustar[i] * y[i] / l_visc[i];
+      uk[i] = ustar[i];
+      ypup[i] = 1.;
+      cofimp[i] = 0.;
+      dplus[i] = 0.;
+      iuntur[i] = 0;
+    }
+
+    n_sub = n_faces;
+    break;
+
+  case CS_WALL_F_1SCALE_POWER:
+
+#   pragma omp parallel for reduction(+:n_sub, n_log) \
+      if (n_faces > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_faces; i++) {
+
+      const cs_real_t ydvisc = y[i] / l_visc[i];
+
+      /* Log-layer (power law) and viscous sublayer candidates */
+
+      const cs_real_t ustar_l = pow(vel[i] / (  cs_turb_apow
+                                              * pow(ydvisc, cs_turb_bpow)),
+                                    cs_turb_dpow);
+      const cs_real_t ustar_v = sqrt(vel[i] / ydvisc);
+
+      const int lg = (ustar_l * ydvisc > ypluli) ? 1 : 0;
+      const cs_real_t w = (cs_real_t)lg;
+
+      ustar[i] = w*ustar_l + (1.-w)*ustar_v;
+      uk[i] = ustar[i];
+      yplus[i] = ustar[i] * ydvisc;
+      ypup[i] =   w * pow(vel[i], 2. * cs_turb_dpow - 1.)
+                    / pow(cs_turb_apow, 2. * cs_turb_dpow)
+                + (1.-w);
+      cofimp[i] = w * (1. + cs_turb_bpow
+                            * pow(ustar_l,
+                                  cs_turb_bpow + 1. - 1./cs_turb_dpow)
+                            * (pow(2., cs_turb_bpow - 1.) - 2.));
+      dplus[i] = 0.;
+      iuntur[i] = lg;
+
+      n_log += lg;
+      n_sub += 1 - lg;
+    }
+    break;
+
+  case CS_WALL_F_1SCALE_LOG:
+    {
+      /* Fixed iteration count replacing the convergence test of
+         cs_wall_functions_1scale_log; the fixed-point iteration
+         converges well below the 1.e-3 tolerance of the scalar
+         version in this many iterations */
+
+      const int n_iter = 10;
+
+#     pragma omp parallel for reduction(+:n_sub, n_log) \
+        if (n_faces > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_faces; i++) {
+
+        const cs_real_t ydvisc = y[i] / l_visc[i];
+        const cs_real_t reynolds = vel[i] * ydvisc;
+
+        /* Log-layer solve, from the Werner initial value (or the
+           minimum ustar ensuring convergence) */
+
+        const cs_real_t ustarwer
+          = pow(fabs(vel[i]) / cs_turb_apow / pow(ydvisc, cs_turb_bpow),
+                cs_turb_dpow);
+        const cs_real_t ustarmin
+          = exp(-cs_turb_cstlog * cs_turb_xkappa) / ydvisc;
+
+        cs_real_t ustar_l = cs_math_fmax(ustarwer, ustarmin);
+
+        for (int it = 0; it < n_iter; it++) {
+          ustar_l = (cs_turb_xkappa * vel[i] + ustar_l)
+                  / (  log(ydvisc * ustar_l)
+                     + cs_turb_xkappa * cs_turb_cstlog + 1.);
+        }
+
+        const cs_real_t yplus_l = ustar_l * ydvisc;
+        const cs_real_t ypup_l
+          = yplus_l / (log(yplus_l) / cs_turb_xkappa + cs_turb_cstlog);
+
+        /* Viscous sublayer */
+
+        const cs_real_t ustar_v = sqrt(vel[i] / ydvisc);
+
+        const int lg = (reynolds > ypluli * ypluli) ? 1 : 0;
+        const cs_real_t w = (cs_real_t)lg;
+
+        ustar[i] = w*ustar_l + (1.-w)*ustar_v;
+        uk[i] = ustar[i];
+        yplus[i] = ustar[i] * ydvisc;
+        ypup[i] = w*ypup_l + (1.-w);
+        cofimp[i] = w * (1. - ypup_l / cs_turb_xkappa * 1.5 / yplus_l);
+        dplus[i] = 0.;
+        iuntur[i] = lg;
+
+        n_log += lg;
+        n_sub += 1 - lg;
+      }
+    }
+    break;
+
+  case CS_WALL_F_2SCALES_LOG:
+
+#   pragma omp parallel for reduction(+:n_sub, n_log) \
+      if (n_faces > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_faces; i++) {
+
+      /* Blending for very low values of k */
+      const cs_real_t re = sqrt(kinetic_en[i]) * y[i] / l_visc[i];
+      const cs_real_t g = exp(-re/11.);
+
+      const cs_real_t _uk
+        = sqrt(  (1.-g) * cs_turb_cmu025 * cs_turb_cmu025 * kinetic_en[i]
+               + g * l_visc[i] * vel[i] / y[i]);
+      const cs_real_t _yplus = _uk * y[i] / l_visc[i];
+
+      const int lg = (_yplus > ypluli) ? 1 : 0;
+
+      /* Log-layer values, evaluated at max(yplus, ypluli) so that
+         sublayer lanes stay in the log's domain of definition */
+
+      const cs_real_t yp_l = cs_math_fmax(_yplus, ypluli);
+      const cs_real_t uplus = log(yp_l) / cs_turb_xkappa + cs_turb_cstlog;
+      const cs_real_t ml_visc = cs_turb_xkappa * l_visc[i] * yp_l;
+      const cs_real_t rcprod
+        = cs_math_fmin(cs_turb_xkappa,
+                       cs_math_fmax(1., sqrt(ml_visc / t_visc[i])) / yp_l);
+
+      /* Viscous sublayer value */
+
+      const cs_real_t ustar_v = (_yplus > 1.e-12) ? fabs(vel[i]/_yplus) : 0.;
+
+      uk[i] = _uk;
+      yplus[i] = _yplus;
+      ustar[i] = (lg) ? vel[i] / uplus : ustar_v;
+      ypup[i] = (lg) ? _yplus / uplus : 1.;
+      cofimp[i] = (lg) ?
+        1. - _yplus / uplus / cs_turb_xkappa
+           * (2. * rcprod - 1. / (2. * _yplus)) : 0.;
+      dplus[i] = 0.;
+      iuntur[i] = lg;
+
+      n_log += lg;
+      n_sub += 1 - lg;
+    }
+    break;
+
+  case CS_WALL_F_2SCALES_SMOOTH_ROUGH:
+
+#   pragma omp parallel for reduction(+:n_sub, n_log) \
+      if (n_faces > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_faces; i++) {
+
+      const cs_real_t y0 = rough_d[i];
+
+      /* Blending for very low values of k */
+      const cs_real_t re = sqrt(kinetic_en[i]) * (y[i] + y0) / l_visc[i];
+      const cs_real_t g = exp(-re/11.);
+
+      const cs_real_t _uk
+        = sqrt(  (1.-g) * cs_turb_cmu025 * cs_turb_cmu025 * kinetic_en[i]
+               + g * l_visc[i] * vel[i] / (y[i] + y0));
+      const cs_real_t _yplus = _uk * y[i] / l_visc[i];
+
+      /* Shift of the velocity profile due to roughness */
+      const cs_real_t shift_vel
+        = -log(1. + y0 * exp(cs_turb_xkappa * cs_turb_cstlog)
+                       * _uk / l_visc[i])
+          / cs_turb_xkappa;
+
+      const int lg = (_yplus > ypluli) ? 1 : 0;
+
+      /* yplus is shifted by the roughness in the log layer, and as for
+         scalable wall functions in the viscous sublayer */
+
+      const cs_real_t _dplus = (lg) ?
+        _uk * y0 / l_visc[i] : ypluli - _yplus;
+
+      const cs_real_t uplus =   log(_yplus + _dplus) / cs_turb_xkappa
+                              + cs_turb_cstlog + shift_vel;
+
+      /* Mixing length viscosity, compatible with both regimes */
+      const cs_real_t ml_visc = cs_turb_xkappa * l_visc[i]
+                              * (_yplus + _dplus);
+      const cs_real_t rcprod
+        = cs_math_fmin(cs_turb_xkappa,
+                         cs_math_fmax(1., sqrt(ml_visc / t_visc[i]))
+                       / (_yplus + _dplus));
+
+      uk[i] = _uk;
+      yplus[i] = _yplus;
+      dplus[i] = _dplus;
+      ustar[i] = vel[i] / uplus;
+      ypup[i] = _yplus / uplus;
+      cofimp[i] = 1. - _yplus / (cs_turb_xkappa * uplus)
+                     * (2. * rcprod - 1. / (2. * _yplus + _dplus));
+      iuntur[i] = 1;
+
+      n_log += lg;
+      n_sub += 1 - lg;
+    }
+    break;
+
+  default:
+
+    /* Other wall function types: per-face evaluation */
+
+#   pragma omp parallel for reduction(+:n_sub, n_log) \
+      if (n_faces > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_faces; i++) {
+      cs_gnum_t _ns = 0, _nl = 0;
+      cs_wall_functions_velocity(iwallf,
+                                 l_visc[i],
+                                 (t_visc != NULL) ? t_visc[i] : 0.,
+                                 vel[i],
+                                 y[i],
+                                 (rough_d != NULL) ? rough_d[i] : 0.,
+                                 (rnnb != NULL) ? rnnb[i] : 0.,
+                                 (kinetic_en != NULL) ? kinetic_en[i] : 0.,
+                                 iuntur + i,
+                                 &_ns,
+                                 &_nl,
+                                 ustar + i,
+                                 uk + i,
+                                 yplus + i,
+                                 ypup + i,
+                                 cofimp + i,
+                                 dplus + i);
+      n_sub += _ns;
+      n_log += _nl;
+    }
+    break;
+
+  }
+
+  *nsubla += n_sub;
+  *nlogla += n_log;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  *  \brief Compute the correction of the exchange coefficient between the
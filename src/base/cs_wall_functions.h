@@ -1331,6 +1331,61 @@ cs_wall_functions_velocity(cs_wall_f_type_t  iwallf,
                            cs_real_t        *cofimp,
                            cs_real_t        *dplus);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute friction velocity and \f$y^+\f$ / \f$u^+\f$ for a batch
+ *         of wall faces.
+ *
+ * Array variant of \ref cs_wall_functions_velocity, vectorized for the
+ * most common wall function types; input arrays associated with
+ * quantities not used by the chosen type may be NULL.
+ *
+ * \param[in]     iwallf        wall function type
+ * \param[in]     n_faces       number of faces in batch
+ * \param[in]     l_visc        kinematic viscosity
+ * \param[in]     t_visc        turbulent kinematic viscosity
+ * \param[in]     vel           wall projected
+ *                              cell center velocity
+ * \param[in]     y             wall distance
+ * \param[in]     rough_d       roughness lenghth scale
+ * \param[in]     rnnb          \f$\vec{n}.(\tens{R}\vec{n})\f$
+ * \param[in]     kinetic_en    turbulent kinetic energy
+ * \param[out]    iuntur        indicator:
+ *                              0 in the viscous sublayer
+ * \param[in,out] nsubla        counter of cells in the viscous
+ *                              sublayer
+ * \param[in,out] nlogla        counter of cells in the log-layer
+ * \param[out]    ustar         friction velocity
+ * \param[out]    uk            friction velocity
+ * \param[out]    yplus         non-dimension wall distance
+ * \param[out]    ypup          yplus projected vel ratio
+ * \param[out]    cofimp        \f$\frac{|U_F|}{|U_I^p|}\f$ to ensure a good
+ *                              turbulence production
+ * \param[out]    dplus         dimensionless shift to the wall
+ *                              for scalable wall functions
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_wall_functions_velocity_vec(cs_wall_f_type_t  iwallf,
+                               cs_lnum_t         n_faces,
+                               const cs_real_t   l_visc[],
+                               const cs_real_t   t_visc[],
+                               const cs_real_t   vel[],
+                               const cs_real_t   y[],
+                               const cs_real_t   rough_d[],
+                               const cs_real_t   rnnb[],
+                               const cs_real_t   kinetic_en[],
+                               int               iuntur[],
+                               cs_gnum_t        *nsubla,
+                               cs_gnum_t        *nlogla,
+                               cs_real_t         ustar[],
+                               cs_real_t         uk[],
+                               cs_real_t         yplus[],
+                               cs_real_t         ypup[],
+                               cs_real_t         cofimp[],
+                               cs_real_t         dplus[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  *  \brief Compute the correction of the exchange coefficient between the
@@ -50,10 +50,15 @@
 #include <string.h>
 #include <stdlib.h>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 /*
  * Optional library and BFT headers
  */
 
+#include "bft_backtrace.h"
 #include "bft_error.h"
 #include "bft_mem_usage.h"
 #include "bft_mem.h"
@@ -190,6 +195,21 @@ static size_t  _bft_mem_global_n_allocs = 0;
 static size_t  _bft_mem_global_n_reallocs = 0;
 static size_t  _bft_mem_global_n_frees = 0;
 
+static int  _bft_mem_global_trace_mode = 0;
+
+static int  _bft_mem_global_huge_page_mode = 1;
+
+/* Huge page size assumed when requesting transparent huge page backing;
+   2 MB is the (base) huge page size on every x86-64 and most ARM systems */
+
+static const size_t  _bft_mem_huge_page_size = 2097152;
+
+/* Alignment used for blocks too small for huge page backing, matching
+   a cache line so that compilers may use aligned vector loads and
+   stores on mesh and field arrays */
+
+static const size_t  _bft_mem_simd_align = 64;
+
 static bft_error_handler_t  *_bft_mem_error_handler
                               = (_bft_mem_error_handler_default);
 
@@ -417,6 +437,39 @@ _bft_mem_block_info_error(const void  *p)
                  p);
 }
 
+/*
+ * Report a memory operation to stderr when allocation tracing is active.
+ *
+ * With a trace mode > 1, a call backtrace is also printed, so as to
+ * identify the code path responsible for allocations in sections which
+ * are expected to be allocation-free (such as the main time loop once
+ * work arrays have reached their high-water mark).
+ *
+ * parameters:
+ *   op_name:   <-- operation type name ("alloc", "realloc", or "free").
+ *   var_name:  <-- associated variable name string.
+ *   size:      <-- associated size in bytes.
+ *   file_name: <-- name of calling source file.
+ *   line_num:  <-- line number in calling source file.
+ */
+
+static void
+_bft_mem_trace_op(const char  *op_name,
+                  const char  *var_name,
+                  size_t       size,
+                  const char  *file_name,
+                  int          line_num)
+{
+  fprintf(stderr, "[mem trace] %s: %s (%lu bytes) at %s:%d\n",
+          op_name, var_name, (unsigned long)size,
+          _bft_mem_basename(file_name), line_num);
+
+  if (_bft_mem_global_trace_mode > 1)
+    bft_backtrace_print(3);
+
+  fflush(stderr);
+}
+
 /*
  * Fill a cs_mem_block_t structure for an allocated pointer.
  */
@@ -804,6 +857,70 @@ bft_mem_initialized(void)
   return (_bft_mem_global_init_mode > 0) ? 1 : 0;
 }
 
+/*!
+ * \brief Set the memory allocation trace mode.
+ *
+ * When the trace mode is > 0, each allocation, reallocation, or free
+ * handled by the bft_mem_...() functions is reported on stderr; with a
+ * trace mode > 1, a call backtrace is also printed when available.
+ *
+ * This is intended as a debugging aid, for example to check that a given
+ * section of the time loop is free of allocator traffic; it may be
+ * activated and deactivated at any point of the computation.
+ *
+ * \param [in] mode  0: no tracing; 1: report each memory operation;
+ *                   2: also print the associated call backtrace.
+ */
+
+void
+bft_mem_trace_mode_set(int  mode)
+{
+  _bft_mem_global_trace_mode = mode;
+}
+
+/*!
+ * \brief Return the current memory allocation trace mode.
+ *
+ * \returns current trace mode (see \ref bft_mem_trace_mode_set).
+ */
+
+int
+bft_mem_trace_mode(void)
+{
+  return _bft_mem_global_trace_mode;
+}
+
+/*!
+ * \brief Enable or disable huge page backing of large allocations.
+ *
+ * When enabled (the default), allocations done through
+ * \ref BFT_MALLOC_HP which are at least one huge page (2 MB) in size
+ * are aligned on a huge page boundary and the kernel is advised to back
+ * them with transparent huge pages, reducing TLB pressure for large
+ * mesh, matrix, and field arrays. This is only a hint, so it has no
+ * effect on systems where transparent huge pages are not available.
+ *
+ * \param [in] mode  0: disabled; 1: enabled.
+ */
+
+void
+bft_mem_huge_page_mode_set(int  mode)
+{
+  _bft_mem_global_huge_page_mode = mode;
+}
+
+/*!
+ * \brief Return the current huge page backing mode.
+ *
+ * \returns current mode (see \ref bft_mem_huge_page_mode_set).
+ */
+
+int
+bft_mem_huge_page_mode(void)
+{
+  return _bft_mem_global_huge_page_mode;
+}
+
 /*!
  * \brief Allocate memory for ni elements of size bytes.
  *
@@ -847,7 +964,11 @@ bft_mem_malloc(size_t       ni,
                    var_name, (unsigned long)alloc_size);
     return NULL;
   }
-  else if (_bft_mem_global_init_mode < 2)
+
+  if (_bft_mem_global_trace_mode > 0)
+    _bft_mem_trace_op("alloc", var_name, alloc_size, file_name, line_num);
+
+  if (_bft_mem_global_init_mode < 2)
     return p_new;
 
   cs_mem_block_t mib = _bft_mem_block_new(p_new, alloc_size);
@@ -864,6 +985,104 @@ bft_mem_malloc(size_t       ni,
   return p_new;
 }
 
+/*!
+ * \brief Allocate memory for ni elements of size bytes, preferring
+ *        huge page backing for large blocks.
+ *
+ * This function behaves as \ref bft_mem_malloc, except that blocks of
+ * at least one huge page (2 MB) are aligned on a huge page boundary,
+ * rounded up to a whole number of huge pages, and the kernel is advised
+ * (through madvise with MADV_HUGEPAGE) to back them with transparent
+ * huge pages. This reduces TLB pressure when accessing large mesh,
+ * matrix, or field arrays. Smaller blocks of at least one cache line,
+ * or all such blocks when huge page backing is disabled (see
+ * \ref bft_mem_huge_page_mode_set) or not available on the system, are
+ * aligned on a cache line boundary, allowing aligned vector loads and
+ * stores in loops over the corresponding arrays; blocks smaller than a
+ * cache line use the standard allocation path.
+ *
+ * Memory allocated this way may be reallocated and freed as usual;
+ * the huge page advice applies to the initial allocation only.
+ *
+ * \param [in] ni        number of elements.
+ * \param [in] size      element size.
+ * \param [in] var_name  allocated variable name string.
+ * \param [in] file_name name of calling source file.
+ * \param [in] line_num  line number in calling source file.
+ *
+ * \returns pointer to allocated memory.
+ */
+
+void *
+bft_mem_malloc_hp(size_t       ni,
+                  size_t       size,
+                  const char  *var_name,
+                  const char  *file_name,
+                  int          line_num)
+{
+#if    defined(__linux__) && defined(MADV_HUGEPAGE) \
+    && defined(HAVE_POSIX_MEMALIGN)
+
+  size_t alloc_size = ni * size;
+
+  size_t alignment = 0;
+
+  if (   _bft_mem_global_huge_page_mode != 0
+      && alloc_size >= _bft_mem_huge_page_size)
+    alignment = _bft_mem_huge_page_size;
+  else if (alloc_size >= _bft_mem_simd_align)
+    alignment = _bft_mem_simd_align;
+
+  if (alignment == 0)
+    return bft_mem_malloc(ni, size, var_name, file_name, line_num);
+
+  /* Round huge page backed allocations up to a whole number of huge
+     pages, so that the whole range is eligible for huge page backing */
+
+  if (alignment == _bft_mem_huge_page_size)
+    alloc_size =   (alloc_size + _bft_mem_huge_page_size - 1)
+                 / _bft_mem_huge_page_size * _bft_mem_huge_page_size;
+
+  void *p_new;
+  int retval = posix_memalign(&p_new, alignment, alloc_size);
+
+  if (retval != 0) {
+    _bft_mem_error(file_name, line_num, 0,
+                   _("Failure to allocate \"%s\" (%lu bytes)"),
+                   var_name, (unsigned long)alloc_size);
+    return NULL;
+  }
+
+  /* This is only a hint, so failure (for example when transparent huge
+     pages are disabled system-wide) is simply ignored */
+
+  if (alignment == _bft_mem_huge_page_size)
+    (void)madvise(p_new, alloc_size, MADV_HUGEPAGE);
+
+  if (_bft_mem_global_trace_mode > 0)
+    _bft_mem_trace_op("alloc", var_name, alloc_size, file_name, line_num);
+
+  if (_bft_mem_global_init_mode < 2)
+    return p_new;
+
+  cs_mem_block_t mib = _bft_mem_block_new(p_new, alloc_size);
+
+  if (file_name != nullptr)
+    bft_mem_update_block_info(var_name,
+                              file_name,
+                              line_num,
+                              nullptr,
+                              &mib);
+
+  return p_new;
+
+#else
+
+  return bft_mem_malloc(ni, size, var_name, file_name, line_num);
+
+#endif
+}
+
 /*!
  * \brief Reallocate memory for ni elements of size bytes.
  *
@@ -943,6 +1162,9 @@ bft_mem_realloc(void        *ptr,
 
   void *p_new = realloc(ptr, new_size);
 
+  if (_bft_mem_global_trace_mode > 0)
+    _bft_mem_trace_op("realloc", var_name, new_size, file_name, line_num);
+
   if (file_name != nullptr) {
     cs_mem_block_t mib_new = _bft_mem_block_new(p_new, new_size);
 
@@ -1001,6 +1223,9 @@ bft_mem_free(void        *ptr,
   }
 #endif
 
+  if (_bft_mem_global_trace_mode > 0)
+    _bft_mem_trace_op("free", var_name, mib_old.size, file_name, line_num);
+
   free(ptr);
   if (   mib_old.host_ptr != nullptr
       && file_name != nullptr)
@@ -1096,6 +1321,58 @@ bft_mem_memalign(size_t       alignment,
 #endif
 }
 
+/*
+ * Initialize newly-allocated memory in parallel.
+ *
+ * Under a first-touch page placement policy (the default on Linux),
+ * this distributes the pages of an array across the memory local to the
+ * cores which will later operate on it, rather than having all pages
+ * placed by the allocating (usually serial) code path.
+ *
+ * The array contents are zeroed, so this must be called right after
+ * allocation, before any useful data is written to the array.
+ *
+ * parameters:
+ *   ptr  <-> pointer to allocated memory.
+ *   size <-- array size in bytes.
+ */
+
+void
+bft_mem_first_touch(void    *ptr,
+                    size_t   size)
+{
+  if (ptr == NULL || size == 0)
+    return;
+
+#if defined(HAVE_OPENMP)
+
+  if (omp_get_max_threads() > 1 && !omp_in_parallel()) {
+
+    /* Use page-sized blocks with a static schedule, so that the
+       thread to page mapping matches that of similarly-scheduled
+       loops over the array in computational code */
+
+    char *p = static_cast<char *>(ptr);
+    const size_t block_size = 4096;
+    const long n_blocks = (size + block_size - 1) / block_size;
+
+#   pragma omp parallel for schedule(static)
+    for (long b = 0; b < n_blocks; b++) {
+      size_t start = (size_t)b * block_size;
+      size_t end = start + block_size;
+      if (end > size)
+        end = size;
+      memset(p + start, 0, end - start);
+    }
+
+    return;
+  }
+
+#endif
+
+  memset(ptr, 0, size);
+}
+
 /*!
  * \brief Return current theoretical dynamic memory allocated.
  *
@@ -98,6 +98,25 @@ typedef struct
 _ptr = (_type *) bft_mem_malloc(_ni, sizeof(_type), \
                                 #_ptr, __FILE__, __LINE__)
 
+/*
+ * Allocate memory for _ni items of type _type, preferring huge page
+ * backing for large blocks.
+ *
+ * This macro calls bft_mem_malloc_hp(), automatically setting the
+ * allocated variable name and source file name and line arguments.
+ * It is intended for the dominant, long-lived arrays of a computation
+ * (mesh connectivity, matrix coefficients, field values).
+ *
+ * parameters:
+ *   _ptr  --> pointer to allocated memory.
+ *   _ni   <-- number of items.
+ *   _type <-- element type.
+ */
+
+#define BFT_MALLOC_HP(_ptr, _ni, _type) \
+_ptr = (_type *) bft_mem_malloc_hp(_ni, sizeof(_type), \
+                                   #_ptr, __FILE__, __LINE__)
+
 /*
  * Reallocate memory for _ni items of type _type.
  *
@@ -295,6 +314,62 @@ bft_mem_end(void);
 int
 bft_mem_initialized(void);
 
+/*
+ * Set the memory allocation trace mode.
+ *
+ * When the trace mode is > 0, each allocation, reallocation, or free
+ * handled by the bft_mem_...() functions is reported on stderr; with a
+ * trace mode > 1, a call backtrace is also printed when available.
+ *
+ * This is intended as a debugging aid, for example to check that a given
+ * section of the time loop is free of allocator traffic; it may be
+ * activated and deactivated at any point of the computation.
+ *
+ * parameters:
+ *   mode <-- 0: no tracing; 1: report each memory operation;
+ *            2: also print the associated call backtrace.
+ */
+
+void
+bft_mem_trace_mode_set(int  mode);
+
+/*
+ * Return the current memory allocation trace mode.
+ *
+ * returns:
+ *   current trace mode (see bft_mem_trace_mode_set).
+ */
+
+int
+bft_mem_trace_mode(void);
+
+/*
+ * Enable or disable huge page backing of large allocations.
+ *
+ * When enabled (the default), allocations done through BFT_MALLOC_HP
+ * which are at least one huge page (2 MB) in size are aligned on a huge
+ * page boundary and the kernel is advised to back them with transparent
+ * huge pages, reducing TLB pressure for large mesh, matrix, and field
+ * arrays. This is only a hint, so it has no effect on systems where
+ * transparent huge pages are not available.
+ *
+ * parameters:
+ *   mode <-- 0: disabled; 1: enabled.
+ */
+
+void
+bft_mem_huge_page_mode_set(int  mode);
+
+/*
+ * Return the current huge page backing mode.
+ *
+ * returns:
+ *   current mode (see bft_mem_huge_page_mode_set).
+ */
+
+int
+bft_mem_huge_page_mode(void);
+
 /*
  * Allocate memory for ni items of size bytes.
  *
@@ -325,6 +400,36 @@ bft_mem_malloc(size_t       ni,
                const char  *file_name,
                int          line_num);
 
+/*
+ * Allocate memory for ni items of size bytes, preferring huge page
+ * backing for large blocks.
+ *
+ * This function behaves as bft_mem_malloc, except that blocks of at
+ * least one huge page (2 MB) are aligned on a huge page boundary,
+ * rounded up to a whole number of huge pages, and the kernel is advised
+ * to back them with transparent huge pages (see
+ * bft_mem_huge_page_mode_set). Memory allocated this way may be
+ * reallocated and freed as usual; the huge page advice applies to the
+ * initial allocation only.
+ *
+ * parameters:
+ *   ni        <-- number of items.
+ *   size      <-- element size.
+ *   var_name  <-- allocated variable name string.
+ *   file_name <-- name of calling source file.
+ *   line_num  <-- line number in calling source file.
+ *
+ * returns:
+ *   pointer to allocated memory.
+ */
+
+void *
+bft_mem_malloc_hp(size_t       ni,
+                  size_t       size,
+                  const char  *var_name,
+                  const char  *file_name,
+                  int          line_num);
+
 /*
  * Reallocate memory for ni items of size bytes.
  *
@@ -408,6 +513,26 @@ bft_mem_memalign(size_t       alignment,
                  const char  *file_name,
                  int          line_num);
 
+/*
+ * Initialize newly-allocated memory in parallel.
+ *
+ * Under a first-touch page placement policy (the default on Linux),
+ * this distributes the pages of an array across the memory local to the
+ * cores which will later operate on it, rather than having all pages
+ * placed by the allocating (usually serial) code path.
+ *
+ * The array contents are zeroed, so this must be called right after
+ * allocation, before any useful data is written to the array.
+ *
+ * parameters:
+ *   ptr  <-> pointer to allocated memory.
+ *   size <-- array size in bytes.
+ */
+
+void
+bft_mem_first_touch(void    *ptr,
+                    size_t   size);
+
 /*!
  * \brief Return current theoretical dynamic memory allocated.
  *
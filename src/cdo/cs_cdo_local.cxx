@@ -231,16 +231,46 @@ cs_cell_sys_create(int   n_max_dofbyc,
 
   BFT_MALLOC(csys, 1, cs_cell_sys_t);
 
+  /* All member arrays are laid out in a single contiguous allocation,
+     members with the largest alignment requirement first */
+
+  const int  n_rob_size = n_robin_parameters*CS_MAX(n_max_dofbyc, n_max_fbyc);
+
+  size_t  b_size =   sizeof(double)    * (6*n_max_dofbyc + n_rob_size)
+                   + sizeof(cs_lnum_t) * (n_max_dofbyc + n_max_fbyc)
+                   + sizeof(cs_flag_t) * (n_max_dofbyc + n_max_fbyc)
+                   + sizeof(short int) * n_max_fbyc
+                   + sizeof(bool)      * n_max_dofbyc;
+
+  char  *p = nullptr;
+  BFT_MALLOC(p, b_size, char);
+  csys->_buffer = p;
+
+  csys->rhs = (double *)p;            p += n_max_dofbyc*sizeof(double);
+  csys->source = (double *)p;         p += n_max_dofbyc*sizeof(double);
+  csys->val_n = (double *)p;          p += n_max_dofbyc*sizeof(double);
+  csys->val_nm1 = (double *)p;        p += n_max_dofbyc*sizeof(double);
+  csys->dir_values = (double *)p;     p += n_max_dofbyc*sizeof(double);
+  csys->neu_values = (double *)p;     p += n_max_dofbyc*sizeof(double);
+  csys->rob_values = (double *)p;     p += n_rob_size*sizeof(double);
+
+  csys->dof_ids = (cs_lnum_t *)p;     p += n_max_dofbyc*sizeof(cs_lnum_t);
+  csys->bf_ids = (cs_lnum_t *)p;      p += n_max_fbyc*sizeof(cs_lnum_t);
+
+  csys->dof_flag = (cs_flag_t *)p;    p += n_max_dofbyc*sizeof(cs_flag_t);
+  csys->bf_flag = (cs_flag_t *)p;     p += n_max_fbyc*sizeof(cs_flag_t);
+
+  csys->_f_ids = (short int *)p;      p += n_max_fbyc*sizeof(short int);
+
+  csys->dof_is_forced = (bool *)p;    p += n_max_dofbyc*sizeof(bool);
+
+  assert(p == (char *)csys->_buffer + b_size);
+
   /* Metadata about DoFs */
 
   csys->n_dofs = 0;
 
-  csys->dof_flag = nullptr;
-  BFT_MALLOC(csys->dof_flag, n_max_dofbyc, cs_flag_t);
   memset(csys->dof_flag, 0, sizeof(cs_flag_t)*n_max_dofbyc);
-
-  csys->dof_ids = nullptr;
-  BFT_MALLOC(csys->dof_ids, n_max_dofbyc, cs_lnum_t);
   memset(csys->dof_ids, 0, sizeof(cs_lnum_t)*n_max_dofbyc);
 
   /* Cell-wise view of the system and its DoF values */
@@ -274,66 +304,37 @@ cs_cell_sys_create(int   n_max_dofbyc,
 
   }
 
-  csys->rhs = nullptr;
-  BFT_MALLOC(csys->rhs, n_max_dofbyc, double);
   memset(csys->rhs, 0, s);
-
-  csys->source = nullptr;
-  BFT_MALLOC(csys->source, n_max_dofbyc, double);
   memset(csys->source, 0, s);
-
-  csys->val_n = nullptr;
-  BFT_MALLOC(csys->val_n, n_max_dofbyc, double);
   memset(csys->val_n, 0, s);
-
-  csys->val_nm1 = nullptr;
-  BFT_MALLOC(csys->val_nm1, n_max_dofbyc, double);
   memset(csys->val_nm1, 0, s);
 
   /* Internal enforcement */
 
   csys->has_internal_enforcement = false;
 
-  csys->dof_is_forced = nullptr;
-  BFT_MALLOC(csys->dof_is_forced, n_max_dofbyc, bool);
-
   /* Boundary conditions */
   /* ------------------- */
 
   csys->n_bc_faces = 0;
 
-  csys->bf_flag = nullptr;
-  BFT_MALLOC(csys->bf_flag, n_max_fbyc, cs_flag_t);
   memset(csys->bf_flag, 0, sizeof(cs_flag_t)*n_max_fbyc);
-
-  csys->_f_ids = nullptr;
-  BFT_MALLOC(csys->_f_ids, n_max_fbyc, short int);
   memset(csys->_f_ids, 0, sizeof(short int)*n_max_fbyc);
-
-  csys->bf_ids = nullptr;
-  BFT_MALLOC(csys->bf_ids, n_max_fbyc, cs_lnum_t);
   memset(csys->bf_ids, 0, sizeof(cs_lnum_t)*n_max_fbyc);
 
-  /* Dirichlet */
+  /* Dirichlet (warning: values on DoFs) */
 
   csys->has_dirichlet = false;
-  csys->dir_values    = nullptr; /* Warning: values on DoFs */
-  BFT_MALLOC(csys->dir_values, n_max_dofbyc, double);
   memset(csys->dir_values, 0, s);
 
   /* Neumann */
 
   csys->has_nhmg_neumann = false;
-  csys->neu_values       = nullptr;
-  BFT_MALLOC(csys->neu_values, n_max_dofbyc, double);
   memset(csys->neu_values, 0, s);
 
   /* Robin */
 
-  int  n_rob_size = n_robin_parameters*CS_MAX(n_max_dofbyc, n_max_fbyc);
   csys->has_robin = false;
-  csys->rob_values = nullptr;
-  BFT_MALLOC(csys->rob_values, n_rob_size, double);
   memset(csys->rob_values, 0, n_rob_size*sizeof(cs_real_t));
 
   /* Sliding (only for vector-valued system) */
@@ -401,24 +402,9 @@ cs_cell_sys_free(cs_cell_sys_t     **p_csys)
   if (csys == nullptr)
     return;
 
-  BFT_FREE(csys->dof_ids);
-  BFT_FREE(csys->dof_flag);
-
   csys->mat = cs_sdm_free(csys->mat);
 
-  BFT_FREE(csys->rhs);
-  BFT_FREE(csys->source);
-  BFT_FREE(csys->val_n);
-  BFT_FREE(csys->val_nm1);
-
-  BFT_FREE(csys->_f_ids);
-  BFT_FREE(csys->bf_ids);
-  BFT_FREE(csys->bf_flag);
-  BFT_FREE(csys->dir_values);
-  BFT_FREE(csys->neu_values);
-  BFT_FREE(csys->rob_values);
-
-  BFT_FREE(csys->dof_is_forced);
+  BFT_FREE(csys->_buffer);  /* All member arrays point into this buffer */
 
   BFT_FREE(csys);
   *p_csys = nullptr;
@@ -577,50 +563,58 @@ cs_cell_mesh_create(const cs_cdo_connect_t   *connect)
   cm->n_ec = 0;
   cm->n_fc = 0;
 
-  /* Vertex information */
-
-  BFT_MALLOC(cm->v_ids, cm->n_max_vbyc, cs_lnum_t);
-  BFT_MALLOC(cm->wvc, cm->n_max_vbyc, double);
-  BFT_MALLOC(cm->xv, 3*cm->n_max_vbyc, double);
+  /* All member arrays are laid out in a single contiguous allocation,
+     members with the largest alignment requirement first, so that the
+     cell-wise scratch data stays compact in memory */
 
-  /* Edge information */
-
-  BFT_MALLOC(cm->e_ids, cm->n_max_ebyc, cs_lnum_t);
-  BFT_MALLOC(cm->e2v_sgn, cm->n_max_ebyc, short int);
-  BFT_MALLOC(cm->edge, cm->n_max_ebyc, cs_quant_t);
-  BFT_MALLOC(cm->dface, cm->n_max_ebyc, cs_nvec3_t);
-  BFT_MALLOC(cm->pvol_e, cm->n_max_ebyc, double);
+  const short int  nv = cm->n_max_vbyc;
+  const short int  ne = cm->n_max_ebyc;
+  const short int  nf = cm->n_max_fbyc;
 
-  /* Face information */
+  size_t  b_size =   sizeof(double)     * (4*nv + 3*ne + 3*nf)
+                   + sizeof(cs_quant_t) * (ne + nf)
+                   + sizeof(cs_nvec3_t) * (3*ne + nf)
+                   + sizeof(cs_lnum_t)  * (nv + ne + nf)
+                   + sizeof(short int)  * (11*ne + 3*nf + 2);
 
-  BFT_MALLOC(cm->f_ids, cm->n_max_fbyc, cs_lnum_t);
-  BFT_MALLOC(cm->f_sgn, cm->n_max_fbyc, short int);
-  BFT_MALLOC(cm->f_diam, cm->n_max_fbyc, double);
-  BFT_MALLOC(cm->face, cm->n_max_fbyc, cs_quant_t);
-  BFT_MALLOC(cm->dedge, cm->n_max_fbyc, cs_nvec3_t);
-  BFT_MALLOC(cm->hfc, cm->n_max_fbyc, double);
-  BFT_MALLOC(cm->pvol_f, cm->n_max_fbyc, double);
+  char  *p = nullptr;
+  BFT_MALLOC(p, b_size, char);
+  cm->_buffer = p;
 
-  /* face --> vertices connectivity */
+  /* Double-precision members */
 
-  BFT_MALLOC(cm->f2v_idx, cm->n_max_fbyc + 1, short int);
-  BFT_MALLOC(cm->f2v_ids, 2*cm->n_max_ebyc, short int);
+  cm->wvc = (double *)p;          p += nv*sizeof(double);
+  cm->xv = (double *)p;           p += 3*nv*sizeof(double);
+  cm->pvol_e = (double *)p;       p += ne*sizeof(double);
+  cm->f_diam = (double *)p;       p += nf*sizeof(double);
+  cm->hfc = (double *)p;          p += nf*sizeof(double);
+  cm->pvol_f = (double *)p;       p += nf*sizeof(double);
+  cm->tef = (double *)p;          p += 2*ne*sizeof(double);
 
-  /* face --> edges connectivity */
+  cm->edge = (cs_quant_t *)p;     p += ne*sizeof(cs_quant_t);
+  cm->face = (cs_quant_t *)p;     p += nf*sizeof(cs_quant_t);
 
-  BFT_MALLOC(cm->f2e_idx, cm->n_max_fbyc + 1, short int);
-  BFT_MALLOC(cm->f2e_ids, 2*cm->n_max_ebyc, short int);
-  BFT_MALLOC(cm->f2e_sgn, 2*cm->n_max_ebyc, short int);
-  BFT_MALLOC(cm->tef, 2*cm->n_max_ebyc, double);
-  BFT_MALLOC(cm->sefc, 2*cm->n_max_ebyc, cs_nvec3_t);
+  cm->dface = (cs_nvec3_t *)p;    p += ne*sizeof(cs_nvec3_t);
+  cm->dedge = (cs_nvec3_t *)p;    p += nf*sizeof(cs_nvec3_t);
+  cm->sefc = (cs_nvec3_t *)p;     p += 2*ne*sizeof(cs_nvec3_t);
 
-  /* edge --> vertices connectivity */
+  /* Integer members */
 
-  BFT_MALLOC(cm->e2v_ids, 2*cm->n_max_ebyc, short int);
+  cm->v_ids = (cs_lnum_t *)p;     p += nv*sizeof(cs_lnum_t);
+  cm->e_ids = (cs_lnum_t *)p;     p += ne*sizeof(cs_lnum_t);
+  cm->f_ids = (cs_lnum_t *)p;     p += nf*sizeof(cs_lnum_t);
 
-  /* edge --> face connectivity */
+  cm->e2v_sgn = (short int *)p;   p += ne*sizeof(short int);
+  cm->f_sgn = (short int *)p;     p += nf*sizeof(short int);
+  cm->f2v_idx = (short int *)p;   p += (nf + 1)*sizeof(short int);
+  cm->f2v_ids = (short int *)p;   p += 2*ne*sizeof(short int);
+  cm->f2e_idx = (short int *)p;   p += (nf + 1)*sizeof(short int);
+  cm->f2e_ids = (short int *)p;   p += 2*ne*sizeof(short int);
+  cm->f2e_sgn = (short int *)p;   p += 2*ne*sizeof(short int);
+  cm->e2v_ids = (short int *)p;   p += 2*ne*sizeof(short int);
+  cm->e2f_ids = (short int *)p;   p += 2*ne*sizeof(short int);
 
-  BFT_MALLOC(cm->e2f_ids, 2*cm->n_max_ebyc, short int);
+  assert(p == (char *)cm->_buffer + b_size);
 
   cs_cell_mesh_reset(cm);
 
@@ -884,45 +878,28 @@ cs_cell_mesh_free(cs_cell_mesh_t     **p_cm)
   if (cm == nullptr)
     return;
 
-  BFT_FREE(cm->v_ids);
-  BFT_FREE(cm->wvc);
-  BFT_FREE(cm->xv);
-
-  BFT_FREE(cm->e_ids);
-  BFT_FREE(cm->edge);
-  BFT_FREE(cm->dface);
-  BFT_FREE(cm->pvol_e);
-
-  BFT_FREE(cm->f_ids);
-  BFT_FREE(cm->f_sgn);
-  BFT_FREE(cm->f_diam);
-  BFT_FREE(cm->hfc);
-  BFT_FREE(cm->pvol_f);
-  BFT_FREE(cm->face);
-  BFT_FREE(cm->dedge);
-
-  BFT_FREE(cm->e2v_ids);
-  BFT_FREE(cm->e2v_sgn);
-
-  BFT_FREE(cm->f2v_idx);
-  BFT_FREE(cm->f2v_ids);
-
-  BFT_FREE(cm->f2e_idx);
-  BFT_FREE(cm->f2e_ids);
-  BFT_FREE(cm->f2e_sgn);
-  BFT_FREE(cm->tef);
-
-  BFT_FREE(cm->e2f_ids);
-  BFT_FREE(cm->sefc);
+  BFT_FREE(cm->_buffer);  /* All member arrays point into this buffer */
 
   BFT_FREE(cm);
   *p_cm = nullptr;
 }
 
+/* The following kernel is templated on the cell connectivity sizes so
+   that loops have compile-time trip counts for the most common cell types;
+   it is thus defined outside of the "extern C" region */
+
+END_C_DECLS
+
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief  Define a cs_cell_mesh_t structure for a given cell id. According
- *         to the requested level, some quantities may not be defined;
+ * \brief  Define a cs_cell_mesh_t structure for a given cell id (see
+ *         \ref cs_cell_mesh_build).
+ *
+ * The template parameters give the number of vertices, edges and faces of
+ * the cell when these counts are known at compile time (dominant cell
+ * shapes), so that the short loops on cell adjacencies have compile-time
+ * trip counts and can be fully unrolled; a parameter equal to 0 means the
+ * corresponding bound remains a runtime value (generic case).
  *
  * \param[in]       c_id        cell id
  * \param[in]       build_flag  indicate which members are really built
@@ -932,16 +909,14 @@ cs_cell_mesh_free(cs_cell_mesh_t     **p_cm)
  */
 /*----------------------------------------------------------------------------*/
 
-void
-cs_cell_mesh_build(cs_lnum_t                    c_id,
-                   cs_eflag_t                   build_flag,
-                   const cs_cdo_connect_t      *connect,
-                   const cs_cdo_quantities_t   *quant,
-                   cs_cell_mesh_t              *cm)
+template <int N_VC, int N_EC, int N_FC>
+static void
+_cell_mesh_build(cs_lnum_t                    c_id,
+                 cs_eflag_t                   build_flag,
+                 const cs_cdo_connect_t      *connect,
+                 const cs_cdo_quantities_t   *quant,
+                 cs_cell_mesh_t              *cm)
 {
-  if (cm == nullptr)
-    return;
-
   cm->flag = build_flag;
   cm->type = connect->cell_type[c_id];
 
@@ -962,6 +937,8 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
   assert(cm->n_fc > 3); /* A tetrahedron has at least 4 faces */
 
+  const int  n_fc = (N_FC > 0) ? N_FC : cm->n_fc;
+
   if (build_flag == 0)
     return;
 
@@ -976,7 +953,9 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
     assert(cm->n_vc > 3); /* A tetrahedron has at least 4 vertices */
 
-    for (short int v = 0; v < cm->n_vc; v++) {
+    const int  n_vc = (N_VC > 0) ? N_VC : cm->n_vc;
+
+    for (short int v = 0; v < n_vc; v++) {
       const cs_lnum_t  v_id = c2v_ids[v];
       cm->v_ids[v] = v_id;
       for (int k = 0; k < 3; k++)
@@ -989,7 +968,7 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
       const double  *wvc = quant->pvol_vc + c2v_idx[0];
       const double  invvol = 1/cm->vol_c;
-      for (short int v = 0; v < cm->n_vc; v++)
+      for (short int v = 0; v < n_vc; v++)
         cm->wvc[v] = invvol * wvc[v];
 
     }
@@ -1005,7 +984,9 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
     cm->n_ec = c2e_idx[1] - c2e_idx[0];
 
-    for (short int e = 0; e < cm->n_ec; e++)
+    const int  n_ec = (N_EC > 0) ? N_EC : cm->n_ec;
+
+    for (short int e = 0; e < n_ec; e++)
       cm->e_ids[e] = c2e_ids[e];
 
     if (build_flag & cs_flag_need_peq) {
@@ -1014,7 +995,7 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
       /* Primal edge quantities */
 
-      for (short int e = 0; e < cm->n_ec; e++) {
+      for (short int e = 0; e < n_ec; e++) {
 
         const cs_lnum_t  e_id = cm->e_ids[e];
         const cs_nvec3_t  nv = cs_quant_set_edge_nvec(e_id, quant);
@@ -1038,7 +1019,7 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
       const cs_real_t  *dface = quant->dface_normal + 3*c2e_idx[0];
 
-      for (short int e = 0; e < cm->n_ec; e++) {
+      for (short int e = 0; e < n_ec; e++) {
 
         cs_nvec3_t  df_nvect;
         cs_nvec3(dface + 3*e, &df_nvect);
@@ -1054,7 +1035,7 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
       assert(quant->pvol_ec != nullptr);
       const cs_real_t  *_pvol = quant->pvol_ec + c2e_idx[0];
-      for (short int e = 0; e < cm->n_ec; e++)
+      for (short int e = 0; e < n_ec; e++)
         cm->pvol_e[e] = _pvol[e];
 
     }
@@ -1068,7 +1049,7 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
     const cs_lnum_t  *c2f_ids = connect->c2f->ids + c2f_idx[0];
     const short int  *c2f_sgn = connect->c2f->sgn + c2f_idx[0];
 
-    for (short int f = 0; f < cm->n_fc; f++) {
+    for (short int f = 0; f < n_fc; f++) {
       cm->f_ids[f] = c2f_ids[f];
       cm->f_sgn[f] = c2f_sgn[f];
     }
@@ -1077,7 +1058,7 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
     if (build_flag & cs_flag_need_pfq) {
 
-      for (short int f = 0; f < cm->n_fc; f++) {
+      for (short int f = 0; f < n_fc; f++) {
 
         const cs_quant_t  pfq = cs_quant_set_face(cm->f_ids[f], quant);
 
@@ -1093,7 +1074,7 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
     if (build_flag & cs_flag_need_deq) {
 
-      for (short int f = 0; f < cm->n_fc; f++) {
+      for (short int f = 0; f < n_fc; f++) {
 
         const cs_nvec3_t  de_nvect = cs_quant_set_dedge_nvec(c2f_idx[0]+f,
                                                              quant);
@@ -1113,13 +1094,13 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
       if (quant->pvol_fc != nullptr) {
 
         const cs_real_t *_pvol = quant->pvol_fc + c2f_idx[0];
-        for (short int f = 0; f < cm->n_fc; f++)
+        for (short int f = 0; f < n_fc; f++)
           cm->pvol_f[f] = _pvol[f];
       }
       else {
 
         assert(cs_eflag_test(build_flag, CS_FLAG_COMP_PFQ | CS_FLAG_COMP_DEQ));
-        for (short int f = 0; f < cm->n_fc; f++) {
+        for (short int f = 0; f < n_fc; f++) {
           cm->pvol_f[f] = _dp3(cm->face[f].unitv, cm->dedge[f].unitv);
           cm->pvol_f[f] *= cs_math_1ov3 * cm->face[f].meas * cm->dedge[f].meas;
         }
@@ -1131,7 +1112,7 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
       /* Compute the height of the pyramid of base f whose apex is
          the cell center */
 
-      for (short int f = 0; f < cm->n_fc; f++)
+      for (short int f = 0; f < n_fc; f++)
         cm->hfc[f] = 3 * cm->pvol_f[f] / cm->face[f].meas;
 
     } /* Quantities related to the pyramid of base f */
@@ -1140,19 +1121,22 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
   if (build_flag & CS_FLAG_COMP_EV || build_flag & CS_FLAG_COMP_FV) {
 
+    const int  n_vc = (N_VC > 0) ? N_VC : cm->n_vc;
+    const int  n_ec = (N_EC > 0) ? N_EC : cm->n_ec;
+
     short int *kbuf = cs_cdo_local_kbuf[cs_get_thread_id()];
 
     /* Store in a compact way ids for vertices: mesh --> cell mesh */
 
     cs_lnum_t v_shift = cm->v_ids[0];
-    for (short int v = 1; v < cm->n_vc; v++)
+    for (short int v = 1; v < n_vc; v++)
       if (cm->v_ids[v] < v_shift)
         v_shift = cm->v_ids[v];
-    for (short int v = 0; v < cm->n_vc; v++)
+    for (short int v = 0; v < n_vc; v++)
       kbuf[cm->v_ids[v] - v_shift] = v;
 
     if (build_flag & CS_FLAG_COMP_EV) {
-      for (short int e = 0; e < cm->n_ec; e++) {
+      for (short int e = 0; e < n_ec; e++) {
 
         const cs_lnum_t e_id = cm->e_ids[e];
 
@@ -1173,7 +1157,7 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
        * numbering */
 
       cm->f2v_idx[0] = 0;
-      for (short int f = 0; f < cm->n_fc; f++) {
+      for (short int f = 0; f < n_fc; f++) {
 
         const cs_lnum_t f_id = cm->f_ids[f];
         if (f_id < cm->bface_shift) { /* Interior face */
@@ -1204,7 +1188,7 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
       } /* Loop on cell faces */
 
-      assert(cm->f2v_idx[cm->n_fc] == 2 * cm->n_ec);
+      assert(cm->f2v_idx[n_fc] == 2 * n_ec);
 
     } /* face --> vertices connectivity */
 
@@ -1212,15 +1196,17 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
   if (build_flag & cs_flag_need_fe) {
 
+    const int  n_ec = (N_EC > 0) ? N_EC : cm->n_ec;
+
     short int *kbuf = cs_cdo_local_kbuf[cs_get_thread_id()];
 
     /* Store in compact way: mesh --> cell mesh ids for edges */
 
     cs_lnum_t shift = cm->e_ids[0];
-    for (short int e = 1; e < cm->n_ec; e++)
+    for (short int e = 1; e < n_ec; e++)
       if (cm->e_ids[e] < shift)
         shift = cm->e_ids[e];
-    for (short int e = 0; e < cm->n_ec; e++)
+    for (short int e = 0; e < n_ec; e++)
       kbuf[cm->e_ids[e] - shift] = e;
 
     const cs_adjacency_t *f2e = connect->f2e;
@@ -1228,7 +1214,7 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
     cm->f2e_idx[0] = 0;
     if (build_flag & CS_FLAG_COMP_FES) {
 
-      for (short int f = 0; f < cm->n_fc; f++) {
+      for (short int f = 0; f < n_fc; f++) {
 
         const cs_lnum_t *idx  = f2e->idx + cm->f_ids[f];
         const cs_lnum_t *ids  = f2e->ids + idx[0];
@@ -1248,7 +1234,7 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
     }
     else {
 
-      for (short int f = 0; f < cm->n_fc; f++) {
+      for (short int f = 0; f < n_fc; f++) {
 
         const cs_lnum_t *idx  = f2e->idx + cm->f_ids[f];
         const cs_lnum_t *ids  = f2e->ids + idx[0];
@@ -1267,19 +1253,19 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 #if defined(DEBUG) && !defined(NDEBUG)
     /* Sanity check */
     if (quant->remove_boundary_faces == false)
-      if (cm->f2e_idx[cm->n_fc] != 2 * cm->n_ec)
+      if (cm->f2e_idx[n_fc] != 2 * n_ec)
         bft_error(__FILE__, __LINE__, 0,
                   " %s: Inconsistency detected in f2e_idx for c_id = %d\n"
                   " cm->f2e_idx[cm->n_fc] = %d and 2*cm->n_ec = %d\n",
                   __func__,
                   cm->c_id,
-                  cm->f2e_idx[cm->n_fc],
-                  2 * cm->n_ec);
+                  cm->f2e_idx[n_fc],
+                  2 * n_ec);
 #endif
 
     if (build_flag & CS_FLAG_COMP_FEQ) {
 
-      for (short int f = 0; f < cm->n_fc; f++) {
+      for (short int f = 0; f < n_fc; f++) {
         for (int ie = cm->f2e_idx[f]; ie < cm->f2e_idx[f + 1]; ie++)
           cm->tef[ie] = cs_compute_area_from_quant(cm->edge[cm->f2e_ids[ie]],
                                                    cm->face[f].center);
@@ -1289,7 +1275,7 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
     if (build_flag & CS_FLAG_COMP_SEF) { /* Build cm->sefc */
 
-      for (short int f = 0; f < cm->n_fc; f++) {
+      for (short int f = 0; f < n_fc; f++) {
 
         const cs_quant_t pfq     = cm->face[f];
         const cs_nvec3_t deq     = cm->dedge[f];
@@ -1330,12 +1316,14 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
   if (build_flag & cs_flag_need_ef) {
 
+    const int  n_ec = (N_EC > 0) ? N_EC : cm->n_ec;
+
     /* Build the e2f connectivity */
 
-    for (short int i = 0; i < 2 * cm->n_ec; i++)
+    for (short int i = 0; i < 2 * n_ec; i++)
       cm->e2f_ids[i] = -1;
 
-    for (short int f = 0; f < cm->n_fc; f++) {
+    for (short int f = 0; f < n_fc; f++) {
       for (short int ie = cm->f2e_idx[f]; ie < cm->f2e_idx[f + 1]; ie++) {
 
         short int *ids = cm->e2f_ids + 2 * cm->f2e_ids[ie];
@@ -1353,12 +1341,12 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
   if (build_flag & CS_FLAG_COMP_DIAM) {
 
-    if (cm->n_fc == 4) { /* Tetrahedron */
+    if (n_fc == 4) { /* Tetrahedron */
 
       assert(cs_flag_test(build_flag, CS_FLAG_COMP_PEQ | CS_FLAG_COMP_FE));
 
       cs_real_t perim_surf = 0.;
-      for (short int f = 0; f < cm->n_fc; f++) {
+      for (short int f = 0; f < n_fc; f++) {
 
         cs_real_t perim = 0.;
         for (int j = cm->f2e_idx[f]; j < cm->f2e_idx[f + 1]; j++) {
@@ -1379,10 +1367,12 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
       assert(cs_flag_test(build_flag, CS_FLAG_COMP_EV | CS_FLAG_COMP_FE));
 
+      const int  n_vc = (N_VC > 0) ? N_VC : cm->n_vc;
+
       double cbox[6]
         = { cm->xv[0], cm->xv[1], cm->xv[2], cm->xv[0], cm->xv[1], cm->xv[2] };
 
-      for (int v = 1; v < cm->n_vc; v++) {
+      for (int v = 1; v < n_vc; v++) {
         const double *xv = cm->xv + 3 * v;
         if (xv[0] < cbox[0]) cbox[0] = xv[0];
         if (xv[1] < cbox[1]) cbox[1] = xv[1];
@@ -1397,14 +1387,14 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
 
       short int *vtag = cs_cdo_local_kbuf[cs_get_thread_id()];
 
-      for (short int f = 0; f < cm->n_fc; f++) {
+      for (short int f = 0; f < n_fc; f++) {
 
         double fbox[6]
           = { DBL_MAX, DBL_MAX, DBL_MAX, -DBL_MAX, -DBL_MAX, -DBL_MAX };
 
         /* Reset vtag */
 
-        for (short int v = 0; v < cm->n_vc; v++)
+        for (short int v = 0; v < n_vc; v++)
           vtag[v] = -1;
 
         /* Tag face vertices */
@@ -1447,6 +1437,52 @@ cs_cell_mesh_build(cs_lnum_t                    c_id,
   } /* Compute diameters */
 }
 
+
+BEGIN_C_DECLS
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define a cs_cell_mesh_t structure for a given cell id. According
+ *         to the requested level, some quantities may not be defined;
+ *
+ * \param[in]       c_id        cell id
+ * \param[in]       build_flag  indicate which members are really built
+ * \param[in]       connect     pointer to a cs_cdo_connect_t structure
+ * \param[in]       quant       pointer to a cs_cdo_quantities_t structure
+ * \param[in, out]  cm          pointer to a cs_cell_mesh_t structure to set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cell_mesh_build(cs_lnum_t                    c_id,
+                   cs_eflag_t                   build_flag,
+                   const cs_cdo_connect_t      *connect,
+                   const cs_cdo_quantities_t   *quant,
+                   cs_cell_mesh_t              *cm)
+{
+  if (cm == nullptr)
+    return;
+
+  /* Use specialized instantiations with compile-time connectivity sizes
+     for the dominant cell shapes (see _get_cell_type, which only sets
+     these types when the vertex/edge/face counts match exactly) */
+
+  switch (connect->cell_type[c_id]) {
+
+  case FVM_CELL_TETRA:
+    _cell_mesh_build<4, 6, 4>(c_id, build_flag, connect, quant, cm);
+    break;
+
+  case FVM_CELL_HEXA:
+    _cell_mesh_build<8, 12, 6>(c_id, build_flag, connect, quant, cm);
+    break;
+
+  default:
+    _cell_mesh_build<0, 0, 0>(c_id, build_flag, connect, quant, cm);
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Allocate a cs_face_mesh_t structure
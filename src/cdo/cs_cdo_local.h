@@ -186,6 +186,8 @@ typedef struct {
    * @}
    */
 
+  void       *_buffer;  /*!< single allocation the member arrays point into */
+
 } cs_cell_sys_t;
 
 /*! \struct cs_cell_mesh_t
@@ -267,6 +269,8 @@ typedef struct {
   short int   *e2f_ids;  /*!< cell-wise edge -> faces connectivity */
   cs_nvec3_t  *sefc;     /*!< portion of dual faces (2 triangles by edge) */
 
+  void        *_buffer;  /*!< single allocation the member arrays point into */
+
 } cs_cell_mesh_t;
 
 /*! \struct cs_face_mesh_t
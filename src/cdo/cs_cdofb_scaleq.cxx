@@ -1311,6 +1311,21 @@ cs_cdofb_scaleq_interpolate(const cs_mesh_t            *mesh,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  /* When all source terms are constant or cell-based arrays, pre-evaluate
+     their contribution once for all cells rather than going through the
+     cellwise function pointers inside the assembly loop */
+
+  cs_real_t  *st_pre = nullptr;
+  if (cs_equation_param_has_sourceterm(eqp) &&
+      cs_source_term_fcb_batchable(eqp->n_source_terms,
+                                   (cs_xdef_t *const *)eqp->source_terms,
+                                   eqb->source_mask)) {
+    BFT_MALLOC(st_pre, quant->n_cells, cs_real_t);
+    cs_source_term_fcb_compute_at_cells(eqp->n_source_terms,
+                                        (cs_xdef_t *const *)eqp->source_terms,
+                                        st_pre);
+  }
+
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
     const int  t_id = cs_get_thread_id();
@@ -1382,15 +1397,18 @@ cs_cdofb_scaleq_interpolate(const cs_mesh_t            *mesh,
            If the equation is steady, the source term has already been computed
            and is added to the right-hand side during its initialization. */
 
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+        if (st_pre != nullptr)
+          csys->source[cm->n_fc] = st_pre[c_id];
+        else
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (cs_xdef_t *const *)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          cb->t_st_eval,
+                                          mass_hodge,
+                                          cb,
+                                          csys->source);
 
         csys->rhs[cm->n_fc] += csys->source[cm->n_fc];
 
@@ -1459,6 +1477,8 @@ cs_cdofb_scaleq_interpolate(const cs_mesh_t            *mesh,
 
   /* Free temporary buffers and structures */
 
+  BFT_FREE(st_pre);
+
   cs_cdo_system_helper_finalize_assembly(sh);
   cs_equation_builder_reset(eqb);
 
@@ -1549,6 +1569,21 @@ cs_cdofb_scaleq_solve_steady_state(bool                        cur2prev,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  /* When all source terms are constant or cell-based arrays, pre-evaluate
+     their contribution once for all cells rather than going through the
+     cellwise function pointers inside the assembly loop */
+
+  cs_real_t  *st_pre = nullptr;
+  if (cs_equation_param_has_sourceterm(eqp) &&
+      cs_source_term_fcb_batchable(eqp->n_source_terms,
+                                   (cs_xdef_t *const *)eqp->source_terms,
+                                   eqb->source_mask)) {
+    BFT_MALLOC(st_pre, quant->n_cells, cs_real_t);
+    cs_source_term_fcb_compute_at_cells(eqp->n_source_terms,
+                                        (cs_xdef_t *const *)eqp->source_terms,
+                                        st_pre);
+  }
+
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
     const int  t_id = cs_get_thread_id();
@@ -1620,15 +1655,18 @@ cs_cdofb_scaleq_solve_steady_state(bool                        cur2prev,
            If the equation is steady, the source term has already been computed
            and is added to the right-hand side during its initialization. */
 
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+        if (st_pre != nullptr)
+          csys->source[cm->n_fc] = st_pre[c_id];
+        else
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (cs_xdef_t *const *)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          cb->t_st_eval,
+                                          mass_hodge,
+                                          cb,
+                                          csys->source);
 
         csys->rhs[cm->n_fc] += csys->source[cm->n_fc];
 
@@ -1683,6 +1721,8 @@ cs_cdofb_scaleq_solve_steady_state(bool                        cur2prev,
 
   /* Free temporary buffers and structures */
 
+  BFT_FREE(st_pre);
+
   cs_cdo_system_helper_finalize_assembly(sh);
   cs_equation_builder_reset(eqb);
 
@@ -1780,6 +1820,21 @@ cs_cdofb_scaleq_solve_implicit(bool                        cur2prev,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  /* When all source terms are constant or cell-based arrays, pre-evaluate
+     their contribution once for all cells rather than going through the
+     cellwise function pointers inside the assembly loop */
+
+  cs_real_t  *st_pre = nullptr;
+  if (cs_equation_param_has_sourceterm(eqp) &&
+      cs_source_term_fcb_batchable(eqp->n_source_terms,
+                                   (cs_xdef_t *const *)eqp->source_terms,
+                                   eqb->source_mask)) {
+    BFT_MALLOC(st_pre, quant->n_cells, cs_real_t);
+    cs_source_term_fcb_compute_at_cells(eqp->n_source_terms,
+                                        (cs_xdef_t *const *)eqp->source_terms,
+                                        st_pre);
+  }
+
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
     const int  t_id = cs_get_thread_id();
@@ -1859,15 +1914,18 @@ cs_cdofb_scaleq_solve_implicit(bool                        cur2prev,
            If the equation is steady, the source term has already been computed
            and is added to the right-hand side during its initialization. */
 
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        time_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+        if (st_pre != nullptr)
+          csys->source[cm->n_fc] = st_pre[c_id];
+        else
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (cs_xdef_t *const *)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          time_eval,
+                                          mass_hodge,
+                                          cb,
+                                          csys->source);
 
         csys->rhs[cm->n_fc] += csys->source[cm->n_fc];
 
@@ -1970,6 +2028,8 @@ cs_cdofb_scaleq_solve_implicit(bool                        cur2prev,
 
   /* Free temporary buffers and structures */
 
+  BFT_FREE(st_pre);
+
   cs_cdo_system_helper_finalize_assembly(sh);
   cs_equation_builder_reset(eqb);
 
@@ -2080,6 +2140,23 @@ cs_cdofb_scaleq_solve_theta(bool                        cur2prev,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  /* When all source terms are constant or cell-based arrays, pre-evaluate
+     their contribution once for all cells rather than going through the
+     cellwise function pointers inside the assembly loop. The batchable
+     definitions do not depend on the evaluation time, so the same array
+     is valid at t_cur and at t_st_eval */
+
+  cs_real_t  *st_pre = nullptr;
+  if (cs_equation_param_has_sourceterm(eqp) &&
+      cs_source_term_fcb_batchable(eqp->n_source_terms,
+                                   (cs_xdef_t *const *)eqp->source_terms,
+                                   eqb->source_mask)) {
+    BFT_MALLOC(st_pre, quant->n_cells, cs_real_t);
+    cs_source_term_fcb_compute_at_cells(eqp->n_source_terms,
+                                        (cs_xdef_t *const *)eqp->source_terms,
+                                        st_pre);
+  }
+
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
     const int  t_id = cs_get_thread_id();
@@ -2159,15 +2236,18 @@ cs_cdofb_scaleq_solve_theta(bool                        cur2prev,
 
           memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
-          cs_source_term_compute_cellwise(eqp->n_source_terms,
-                      (cs_xdef_t *const *)eqp->source_terms,
-                                          cm,
-                                          eqb->source_mask,
-                                          eqb->compute_source,
-                                          t_cur,
-                                          mass_hodge,
-                                          cb,
-                                          csys->source);
+          if (st_pre != nullptr)
+            csys->source[cm->n_fc] = st_pre[c_id];
+          else
+            cs_source_term_compute_cellwise(eqp->n_source_terms,
+                        (cs_xdef_t *const *)eqp->source_terms,
+                                            cm,
+                                            eqb->source_mask,
+                                            eqb->compute_source,
+                                            t_cur,
+                                            mass_hodge,
+                                            cb,
+                                            csys->source);
 
           csys->rhs[cm->n_fc] += tcoef * csys->source[cm->n_fc];
 
@@ -2186,15 +2266,18 @@ cs_cdofb_scaleq_solve_theta(bool                        cur2prev,
            If the equation is steady, the source term has already been computed
            and is added to the right-hand side during its initialization. */
 
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+        if (st_pre != nullptr)
+          csys->source[cm->n_fc] = st_pre[c_id];
+        else
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (cs_xdef_t *const *)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          cb->t_st_eval,
+                                          mass_hodge,
+                                          cb,
+                                          csys->source);
 
         csys->rhs[cm->n_fc] += eqp->theta * csys->source[cm->n_fc];
 
@@ -2316,6 +2399,8 @@ cs_cdofb_scaleq_solve_theta(bool                        cur2prev,
 
   /* Free temporary buffers and structures */
 
+  BFT_FREE(st_pre);
+
   cs_cdo_system_helper_finalize_assembly(sh);
   cs_equation_builder_reset(eqb);
 
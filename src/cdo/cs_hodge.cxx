@@ -262,11 +262,21 @@ _tensor_norm_l1(const cs_real_t   tensor[3][3])
   return _norm;
 }
 
+/* The following kernels are templated on the number of cell entities so
+   that loops have compile-time trip counts for the most common cell types;
+   they are thus defined outside of the "extern C" region */
+
+END_C_DECLS
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Perform a part of a matrix-vector product
  *
- * \param[in]      n_ent   size of the matrix
+ * The template parameter gives the size of the matrix when this size is
+ * known at compile time (a common cell type), so loops have compile-time
+ * trip counts and can be fully unrolled/vectorized; N = 0 is the generic,
+ * runtime-sized case.
+ *
  * \param[in]      i       starting index
  * \param[in]      dq_pq   matrix values
  * \param[in]      vec     vector
@@ -274,6 +284,7 @@ _tensor_norm_l1(const cs_real_t   tensor[3][3])
  */
 /*----------------------------------------------------------------------------*/
 
+template <int N>
 inline static void
 _partial_matvec(const int         i,
                 const cs_sdm_t   *dq_pq,
@@ -281,7 +292,7 @@ _partial_matvec(const int         i,
                 double           *mvec)
 
 {
-  const int n_ent = dq_pq->n_rows;
+  const int n_ent = (N > 0) ? N : dq_pq->n_rows;
 
   for (int irow = i; irow < n_ent; irow++) {
     const double  *restrict m_i = dq_pq->val + irow*n_ent;
@@ -697,6 +708,10 @@ _compute_cost_quant(const int               n_ent,
  * \brief  Compute the discrete EpFd Hodge operator (the upper right part).
  *         Co+St algo. in case of isotropic material property.
  *
+ * The template parameter gives the number of local entities when it is
+ * known at compile time (a common cell type); N = 0 is the generic,
+ * runtime-sized case (see \ref _partial_matvec).
+ *
  * \param[in]      n_ent    number of local entities
  * \param[in]      dbeta2   space dim * squared value of the stabilization coef.
  * \param[in]      ovc      reciprocal of the cell volume
@@ -708,16 +723,19 @@ _compute_cost_quant(const int               n_ent,
  */
 /*----------------------------------------------------------------------------*/
 
+template <int N>
 static void
-_compute_iso_hodge_ur(const int               n_ent,
-                      const double            dbeta2,
-                      const double            ovc,
-                      const cs_real_t         pty,
-                      const cs_real_3_t      *pq,
-                      const cs_real_3_t      *dq,
-                      cs_cell_builder_t      *cb,
-                      cs_sdm_t               *hmat)
+_compute_iso_hodge_ur_t(const int               n_ent_,
+                        const double            dbeta2,
+                        const double            ovc,
+                        const cs_real_t         pty,
+                        const cs_real_3_t      *pq,
+                        const cs_real_3_t      *dq,
+                        cs_cell_builder_t      *cb,
+                        cs_sdm_t               *hmat)
 {
+  const int  n_ent = (N > 0) ? N : n_ent_;
+
   const double  ptyc = pty*ovc;
 
   double  *kappa = cb->values;                /* size = n_ent */
@@ -762,7 +780,7 @@ _compute_iso_hodge_ur(const int               n_ent,
     for (int k = 0; k < n_ent;k++)
       kappa_pq_dqi[k] = kappa[k] * dqi_pq[k];
 
-    _partial_matvec(i, cb->aux, kappa_pq_dqi, stab);
+    _partial_matvec<N>(i, cb->aux, kappa_pq_dqi, stab);
 
     double  *hi = hmat->val + i*n_ent;
 
@@ -781,11 +799,59 @@ _compute_iso_hodge_ur(const int               n_ent,
   } /* Loop on rows (entities i) */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the discrete EpFd Hodge operator (the upper right part).
+ *         Co+St algo. in case of isotropic material property.
+ *
+ * Dispatch to a kernel specialized for the most common numbers of cell
+ * edges (tetrahedra and hexahedra), so the compiler may unroll and
+ * vectorize with compile-time trip counts, or to the generic kernel
+ * otherwise.
+ *
+ * \param[in]      n_ent    number of local entities
+ * \param[in]      dbeta2   space dim * squared value of the stabilization coef.
+ * \param[in]      ovc      reciprocal of the cell volume
+ * \param[in]      pty      values of the the material pty in this cell
+ * \param[in]      pq       pointer to the first set of quantities
+ * \param[in]      dq       pointer to the second set of quantities
+ * \param[in, out] cb       temporary buffers
+ * \param[in, out] hmat     pointer to a cs_sdm_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_compute_iso_hodge_ur(const int               n_ent,
+                      const double            dbeta2,
+                      const double            ovc,
+                      const cs_real_t         pty,
+                      const cs_real_3_t      *pq,
+                      const cs_real_3_t      *dq,
+                      cs_cell_builder_t      *cb,
+                      cs_sdm_t               *hmat)
+{
+  switch (n_ent) {
+  case 6:  /* Tetrahedron */
+    _compute_iso_hodge_ur_t<6>(n_ent, dbeta2, ovc, pty, pq, dq, cb, hmat);
+    break;
+  case 12: /* Hexahedron */
+    _compute_iso_hodge_ur_t<12>(n_ent, dbeta2, ovc, pty, pq, dq, cb, hmat);
+    break;
+  default:
+    _compute_iso_hodge_ur_t<0>(n_ent, dbeta2, ovc, pty, pq, dq, cb, hmat);
+    break;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the discrete EpFd Hodge operator (the upper right part).
  *         Co+St algo. in case of anisotropic material property.
  *
+ * The template parameter gives the number of local entities when it is
+ * known at compile time (a common cell type); N = 0 is the generic,
+ * runtime-sized case (see \ref _partial_matvec).
+ *
  * \param[in]      n_ent    number of local entities
  * \param[in]      dbeta2   space dim * squared value of the stabilization coef.
  * \param[in]      vol_c    cell volume
@@ -797,16 +863,19 @@ _compute_iso_hodge_ur(const int               n_ent,
  */
 /*----------------------------------------------------------------------------*/
 
+template <int N>
 static void
-_compute_aniso_hodge_ur(const int               n_ent,
-                        const double            dbeta2,
-                        const double            ovc,
-                        const cs_real_t         pty[3][3],
-                        const cs_real_3_t      *pq,
-                        const cs_real_3_t      *dq,
-                        cs_cell_builder_t      *cb,
-                        cs_sdm_t               *hmat)
+_compute_aniso_hodge_ur_t(const int               n_ent_,
+                          const double            dbeta2,
+                          const double            ovc,
+                          const cs_real_t         pty[3][3],
+                          const cs_real_3_t      *pq,
+                          const cs_real_3_t      *dq,
+                          cs_cell_builder_t      *cb,
+                          cs_sdm_t               *hmat)
 {
+  const int  n_ent = (N > 0) ? N : n_ent_;
+
   double  *kappa = cb->values;                /* size = n_ent */
   double  *kappa_pq_dqi = cb->values + n_ent; /* size = n_ent */
   double  *stab = cb->values + 2*n_ent;       /* size = n_ent */
@@ -855,7 +924,7 @@ _compute_aniso_hodge_ur(const int               n_ent,
     for (int k = 0; k < n_ent; k++)
       kappa_pq_dqi[k] = kappa[k] * dqi_pq[k];
 
-    _partial_matvec(i, cb->aux, kappa_pq_dqi, stab);
+    _partial_matvec<N>(i, cb->aux, kappa_pq_dqi, stab);
 
     double  *hi = hmat->val + i*n_ent;
 
@@ -874,6 +943,52 @@ _compute_aniso_hodge_ur(const int               n_ent,
   } /* Loop on rows (entities i) */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the discrete EpFd Hodge operator (the upper right part).
+ *         Co+St algo. in case of anisotropic material property.
+ *
+ * Dispatch to a kernel specialized for the most common numbers of cell
+ * edges (tetrahedra and hexahedra), so the compiler may unroll and
+ * vectorize with compile-time trip counts, or to the generic kernel
+ * otherwise.
+ *
+ * \param[in]      n_ent    number of local entities
+ * \param[in]      dbeta2   space dim * squared value of the stabilization coef.
+ * \param[in]      ovc      reciprocal of the cell volume
+ * \param[in]      pty      values of the tensor related to the material pty
+ * \param[in]      pq       pointer to the first set of quantities
+ * \param[in]      dq       pointer to the second set of quantities
+ * \param[in, out] cb       temporary buffers
+ * \param[in, out] hmat     pointer to a cs_sdm_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_compute_aniso_hodge_ur(const int               n_ent,
+                        const double            dbeta2,
+                        const double            ovc,
+                        const cs_real_t         pty[3][3],
+                        const cs_real_3_t      *pq,
+                        const cs_real_3_t      *dq,
+                        cs_cell_builder_t      *cb,
+                        cs_sdm_t               *hmat)
+{
+  switch (n_ent) {
+  case 6:  /* Tetrahedron */
+    _compute_aniso_hodge_ur_t<6>(n_ent, dbeta2, ovc, pty, pq, dq, cb, hmat);
+    break;
+  case 12: /* Hexahedron */
+    _compute_aniso_hodge_ur_t<12>(n_ent, dbeta2, ovc, pty, pq, dq, cb, hmat);
+    break;
+  default:
+    _compute_aniso_hodge_ur_t<0>(n_ent, dbeta2, ovc, pty, pq, dq, cb, hmat);
+    break;
+  }
+}
+
+BEGIN_C_DECLS
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the discrete Hodge operator (the upper right part).
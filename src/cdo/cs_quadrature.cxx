@@ -598,6 +598,210 @@ cs_quadrature_tet_15pts(const cs_real_3_t   v1,
   weights[14] = vol * _tetr_quad15w4;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the quadrature points and weights for a batch of triangles
+ *
+ *         The rule matching the given quadrature type is applied to all
+ *         triangles in a single call, avoiding one indirect function call
+ *         per triangle and enabling vectorization of the coordinate
+ *         computations. Gauss points are stored contiguously, triangle by
+ *         triangle, so that the whole batch can be handed to a single
+ *         evaluation of a \ref cs_analytic_func_t for instance.
+ *
+ * \param[in]      qtype    quadrature type
+ * \param[in]      n_trias  number of triangles in the batch
+ * \param[in]      v1       array of first vertices
+ * \param[in]      v2       array of second vertices
+ * \param[in]      v3       array of third vertices
+ * \param[in]      area     array of triangle areas
+ * \param[in, out] gpts     Gauss points (size: n_trias * number of points)
+ * \param[in, out] weights  weights (size: n_trias * number of points)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_quadrature_tria_batch(cs_quadrature_type_t  qtype,
+                         cs_lnum_t             n_trias,
+                         const cs_real_3_t     v1[],
+                         const cs_real_3_t     v2[],
+                         const cs_real_3_t     v3[],
+                         const cs_real_t       area[],
+                         cs_real_3_t           gpts[],
+                         double                weights[])
+{
+  switch (qtype) {
+
+  case CS_QUADRATURE_BARY:
+  case CS_QUADRATURE_BARY_SUBDIV:
+#   pragma omp simd
+    for (cs_lnum_t t = 0; t < n_trias; t++) {
+      gpts[t][0] = _quad_over3*(v1[t][0] + v2[t][0] + v3[t][0]);
+      gpts[t][1] = _quad_over3*(v1[t][1] + v2[t][1] + v3[t][1]);
+      gpts[t][2] = _quad_over3*(v1[t][2] + v2[t][2] + v3[t][2]);
+      weights[t] = area[t];
+    }
+    break;
+
+  case CS_QUADRATURE_HIGHER:  /* 4 Gauss points per triangle */
+    for (cs_lnum_t t = 0; t < n_trias; t++) {
+
+      cs_real_t  *g = (cs_real_t *)(gpts + 4*t);
+      double  *w = weights + 4*t;
+
+      for (int k = 0; k < 3; k++) {
+        g[    k] = _quad_over3*( v1[t][k] + v2[t][k] + v3[t][k] );
+        g[3 + k] = 0.2*( v1[t][k] + v2[t][k] ) + 0.6*v3[t][k];
+        g[6 + k] = 0.2*( v1[t][k] + v3[t][k] ) + 0.6*v2[t][k];
+        g[9 + k] = 0.2*( v2[t][k] + v3[t][k] ) + 0.6*v1[t][k];
+      }
+
+      w[0] = -_quad_9ov16 * area[t];
+      w[1] = w[2] = w[3] = _quad_25ov48 * area[t];
+
+    }
+    break;
+
+  case CS_QUADRATURE_HIGHEST:  /* 7 Gauss points per triangle */
+    {
+      const double  c1 = _tria_quad7c1, c11 = 1 - 2*_tria_quad7c1;
+      const double  c2 = _tria_quad7c2, c21 = 1 - 2*_tria_quad7c2;
+
+      for (cs_lnum_t t = 0; t < n_trias; t++) {
+
+        cs_real_t  *g = (cs_real_t *)(gpts + 7*t);
+        double  *w = weights + 7*t;
+
+        for (int k = 0; k < 3; k++) {
+          g[     k] = _quad_over3*( v1[t][k] + v2[t][k] + v3[t][k] );
+          g[ 3 + k] = c1*(v1[t][k] + v2[t][k]) + c11*v3[t][k];
+          g[ 6 + k] = c1*(v3[t][k] + v1[t][k]) + c11*v2[t][k];
+          g[ 9 + k] = c1*(v2[t][k] + v3[t][k]) + c11*v1[t][k];
+          g[12 + k] = c2*(v1[t][k] + v2[t][k]) + c21*v3[t][k];
+          g[15 + k] = c2*(v3[t][k] + v1[t][k]) + c21*v2[t][k];
+          g[18 + k] = c2*(v2[t][k] + v3[t][k]) + c21*v1[t][k];
+        }
+
+        w[0] = _quad_9ov40 * area[t];
+        w[1] = w[2] = w[3] = _tria_quad7c3 * area[t];
+        w[4] = w[5] = w[6] = _tria_quad7c4 * area[t];
+
+      }
+    }
+    break;
+
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Invalid quadrature type\n", __func__);
+
+  } /* Switch on quadrature type */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the quadrature points and weights for a batch of
+ *         tetrahedra
+ *
+ *         The rule matching the given quadrature type is applied to all
+ *         tetrahedra in a single call, avoiding one indirect function call
+ *         per tetrahedron and enabling vectorization of the coordinate
+ *         computations. Gauss points are stored contiguously, tetrahedron
+ *         by tetrahedron, so that the whole batch can be handed to a single
+ *         evaluation of a \ref cs_analytic_func_t for instance.
+ *
+ * \param[in]      qtype    quadrature type
+ * \param[in]      n_tets   number of tetrahedra in the batch
+ * \param[in]      v1       array of first vertices
+ * \param[in]      v2       array of second vertices
+ * \param[in]      v3       array of third vertices
+ * \param[in]      v4       array of fourth vertices
+ * \param[in]      vol      array of tetrahedron volumes
+ * \param[in, out] gpts     Gauss points (size: n_tets * number of points)
+ * \param[in, out] weights  weights (size: n_tets * number of points)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_quadrature_tet_batch(cs_quadrature_type_t  qtype,
+                        cs_lnum_t             n_tets,
+                        const cs_real_3_t     v1[],
+                        const cs_real_3_t     v2[],
+                        const cs_real_3_t     v3[],
+                        const cs_real_3_t     v4[],
+                        const cs_real_t       vol[],
+                        cs_real_3_t           gpts[],
+                        double                weights[])
+{
+  switch (qtype) {
+
+  case CS_QUADRATURE_BARY:
+  case CS_QUADRATURE_BARY_SUBDIV:
+#   pragma omp simd
+    for (cs_lnum_t t = 0; t < n_tets; t++) {
+      gpts[t][0] = 0.25*(v1[t][0] + v2[t][0] + v3[t][0] + v4[t][0]);
+      gpts[t][1] = 0.25*(v1[t][1] + v2[t][1] + v3[t][1] + v4[t][1]);
+      gpts[t][2] = 0.25*(v1[t][2] + v2[t][2] + v3[t][2] + v4[t][2]);
+      weights[t] = vol[t];
+    }
+    break;
+
+  case CS_QUADRATURE_HIGHER:  /* 4 Gauss points per tetrahedron */
+    {
+      const double  c1 = _tetr_quad4c1, c2 = _tetr_quad4c2;
+
+      for (cs_lnum_t t = 0; t < n_tets; t++) {
+
+        cs_real_t  *g = (cs_real_t *)(gpts + 4*t);
+        double  *w = weights + 4*t;
+
+        for (int k = 0; k < 3; k++) {
+
+          const double v12 = v1[t][k] + v2[t][k], v34 = v3[t][k] + v4[t][k];
+
+          g[    k] = c1*(v3[t][k] + v12) + c2*v4[t][k];
+          g[3 + k] = c1*(v2[t][k] + v34) + c2*v1[t][k];
+          g[6 + k] = c1*(v1[t][k] + v34) + c2*v2[t][k];
+          g[9 + k] = c1*(v4[t][k] + v12) + c2*v3[t][k];
+
+        }
+
+        w[0] = w[1] = w[2] = w[3] = 0.25*vol[t];
+
+      }
+    }
+    break;
+
+  case CS_QUADRATURE_HIGHEST:  /* 5 Gauss points per tetrahedron */
+    for (cs_lnum_t t = 0; t < n_tets; t++) {
+
+      cs_real_t  *g = (cs_real_t *)(gpts + 5*t);
+      double  *w = weights + 5*t;
+
+      for (int k = 0; k < 3; k++) {
+
+        const double v12 = v1[t][k] + v2[t][k], v34 = v3[t][k] + v4[t][k];
+
+        g[     k] = _quad_over6*(v12 + v3[t][k]) + 0.5*v4[t][k];
+        g[ 3 + k] = _quad_over6*(v34 + v2[t][k]) + 0.5*v1[t][k];
+        g[ 6 + k] = _quad_over6*(v34 + v1[t][k]) + 0.5*v2[t][k];
+        g[ 9 + k] = _quad_over6*(v12 + v4[t][k]) + 0.5*v3[t][k];
+        g[12 + k] = 0.25*(v12 + v34);
+
+      }
+
+      w[0] = w[1] = w[2] = w[3] = 0.45*vol[t];
+      w[4] = -0.8*vol[t];
+
+    }
+    break;
+
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Invalid quadrature type\n", __func__);
+
+  } /* Switch on quadrature type */
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Get the flags adapted to the given quadrature type \p qtype and the
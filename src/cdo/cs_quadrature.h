@@ -626,6 +626,131 @@ cs_quadrature_tet_15pts(const cs_real_3_t   v1,
                         cs_real_3_t         gpts[],
                         double              weights[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the number of Gauss points per triangle for a given
+ *         quadrature type (as used by the batched evaluation)
+ *
+ * \param[in]  qtype   quadrature type
+ *
+ * \return the number of Gauss points (0 if not handled)
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline int
+cs_quadrature_tria_n_gpts(cs_quadrature_type_t  qtype)
+{
+  switch (qtype) {
+
+  case CS_QUADRATURE_BARY:
+  case CS_QUADRATURE_BARY_SUBDIV:
+    return 1;
+  case CS_QUADRATURE_HIGHER:
+    return 4;
+  case CS_QUADRATURE_HIGHEST:
+    return 7;
+
+  default:
+    return 0;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the number of Gauss points per tetrahedron for a given
+ *         quadrature type (as used by the batched evaluation)
+ *
+ * \param[in]  qtype   quadrature type
+ *
+ * \return the number of Gauss points (0 if not handled)
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline int
+cs_quadrature_tet_n_gpts(cs_quadrature_type_t  qtype)
+{
+  switch (qtype) {
+
+  case CS_QUADRATURE_BARY:
+  case CS_QUADRATURE_BARY_SUBDIV:
+    return 1;
+  case CS_QUADRATURE_HIGHER:
+    return 4;
+  case CS_QUADRATURE_HIGHEST:
+    return 5;
+
+  default:
+    return 0;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the quadrature points and weights for a batch of triangles
+ *
+ *         The rule matching the given quadrature type is applied to all
+ *         triangles in a single call, avoiding one indirect function call
+ *         per triangle and enabling vectorization of the coordinate
+ *         computations. Gauss points are stored contiguously, triangle by
+ *         triangle, so that the whole batch can be handed to a single
+ *         evaluation of a \ref cs_analytic_func_t for instance.
+ *
+ * \param[in]      qtype    quadrature type
+ * \param[in]      n_trias  number of triangles in the batch
+ * \param[in]      v1       array of first vertices
+ * \param[in]      v2       array of second vertices
+ * \param[in]      v3       array of third vertices
+ * \param[in]      area     array of triangle areas
+ * \param[in, out] gpts     Gauss points (size: n_trias * number of points)
+ * \param[in, out] weights  weights (size: n_trias * number of points)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_quadrature_tria_batch(cs_quadrature_type_t  qtype,
+                         cs_lnum_t             n_trias,
+                         const cs_real_3_t     v1[],
+                         const cs_real_3_t     v2[],
+                         const cs_real_3_t     v3[],
+                         const cs_real_t       area[],
+                         cs_real_3_t           gpts[],
+                         double                weights[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the quadrature points and weights for a batch of
+ *         tetrahedra
+ *
+ *         The rule matching the given quadrature type is applied to all
+ *         tetrahedra in a single call, avoiding one indirect function call
+ *         per tetrahedron and enabling vectorization of the coordinate
+ *         computations. Gauss points are stored contiguously, tetrahedron
+ *         by tetrahedron, so that the whole batch can be handed to a single
+ *         evaluation of a \ref cs_analytic_func_t for instance.
+ *
+ * \param[in]      qtype    quadrature type
+ * \param[in]      n_tets   number of tetrahedra in the batch
+ * \param[in]      v1       array of first vertices
+ * \param[in]      v2       array of second vertices
+ * \param[in]      v3       array of third vertices
+ * \param[in]      v4       array of fourth vertices
+ * \param[in]      vol      array of tetrahedron volumes
+ * \param[in, out] gpts     Gauss points (size: n_tets * number of points)
+ * \param[in, out] weights  weights (size: n_tets * number of points)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_quadrature_tet_batch(cs_quadrature_type_t  qtype,
+                        cs_lnum_t             n_tets,
+                        const cs_real_3_t     v1[],
+                        const cs_real_3_t     v2[],
+                        const cs_real_3_t     v3[],
+                        const cs_real_3_t     v4[],
+                        const cs_real_t       vol[],
+                        cs_real_3_t           gpts[],
+                        double                weights[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the integral over an edge with the mid-point rule and add
@@ -51,6 +51,40 @@
 
 #include "cs_sdm.h"
 
+/*============================================================================
+ * Local compile-time sized kernels
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Add the product of two square matrices of compile-time size to a
+ *         third one (c += a.b), so the loops are fully unrolled and
+ *         vectorized
+ *
+ * \param[in]      av   values of the first matrix
+ * \param[in]      bv   values of the second matrix
+ * \param[in, out] cv   values of the matrix storing the product
+ */
+/*----------------------------------------------------------------------------*/
+
+template <short int n>
+static inline void
+_multiply_nn(const cs_real_t  *restrict av,
+             const cs_real_t  *restrict bv,
+             cs_real_t        *restrict cv)
+{
+  for (short int i = 0; i < n; i++) {
+    const cs_real_t  *av_i = av + i*n;
+    cs_real_t  *cv_i = cv + i*n;
+    for (short int j = 0; j < n; j++) {
+      cs_real_t  p = 0.0;
+      for (short int k = 0; k < n; k++)
+        p += av_i[k] * bv[k*n + j];
+      cv_i[j] += p;
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 BEGIN_C_DECLS
 
@@ -589,6 +623,25 @@ cs_sdm_multiply(const cs_sdm_t   *a,
          a->n_rows == c->n_rows &&
          c->n_cols == b->n_cols);
 
+  /* Dispatch the most common square block sizes to compile-time sized
+     kernels */
+
+  if (a->n_rows == a->n_cols && b->n_cols == a->n_cols) {
+    switch (a->n_rows) {
+    case 3:
+      _multiply_nn<3>(a->val, b->val, c->val);
+      return;
+    case 4:
+      _multiply_nn<4>(a->val, b->val, c->val);
+      return;
+    case 6:
+      _multiply_nn<6>(a->val, b->val, c->val);
+      return;
+    default:
+      break;
+    }
+  }
+
   const cs_real_t *bv = b->val;
 
   for (short int i = 0; i < a->n_rows; i++) {
@@ -1760,9 +1813,9 @@ cs_sdm_66_ldlt_compute(const cs_sdm_t   *m,
   const cs_real_t  l32 = facto[ 8] =
     (m->val[15] - l30*d0l20 - l31*d1l21) * facto[5];
   const cs_real_t  l42 = facto[12] =
-    (m->val[16] - l30*d0l20 - l31*d1l21) * facto[5];
+    (m->val[16] - l40*d0l20 - l41*d1l21) * facto[5];
   const cs_real_t  l52 = facto[17] =
-    (m->val[17] - l30*d0l20 - l31*d1l21) * facto[5];
+    (m->val[17] - l50*d0l20 - l51*d1l21) * facto[5];
 
   /* j=3: row 4 */
 
@@ -1827,6 +1880,23 @@ cs_sdm_ldlt_compute(const cs_sdm_t     *m,
     return;
   }
 
+  /* Dispatch the most common sizes to the fixed-size kernels (the
+     factorization layout is the same; dkk is not needed there) */
+
+  switch (n) {
+  case 3:
+    cs_sdm_33_ldlt_compute(m, facto);
+    return;
+  case 4:
+    cs_sdm_44_ldlt_compute(m, facto);
+    return;
+  case 6:
+    cs_sdm_66_ldlt_compute(m, facto);
+    return;
+  default:
+    break;
+  }
+
   int  rowj_idx = 0;
 
   /* Factorization (column-major algorithm) */
@@ -2041,6 +2111,22 @@ cs_sdm_ldlt_solve(int                n_rows,
     return;
   }
 
+  /* Dispatch the most common sizes to the fixed-size kernels */
+
+  switch (n_rows) {
+  case 3:
+    cs_sdm_33_ldlt_solve(facto, rhs, sol);
+    return;
+  case 4:
+    cs_sdm_44_ldlt_solve(facto, rhs, sol);
+    return;
+  case 6:
+    cs_sdm_66_ldlt_solve(facto, rhs, sol);
+    return;
+  default:
+    break;
+  }
+
   /* 1 - Solving Lz = b with forward substitution :
    *     z_i = b_i - \sum_{k=0}^{i-1} l_ik * z_k
    */
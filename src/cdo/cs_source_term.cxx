@@ -1079,6 +1079,108 @@ cs_source_term_compute_cellwise(const int                  n_source_terms,
   } /* Source terms are defined on the whole domain or not ? */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check if all source terms of a scalar-valued cell-based density
+ *          can be evaluated in a batched way over all cells (i.e. without
+ *          going through the cellwise function pointers inside the assembly
+ *          loop)
+ *
+ * \param[in]  n_source_terms  number of source terms
+ * \param[in]  source_terms    pointer to the definitions of source terms
+ * \param[in]  source_mask     mask built when some terms are defined on a
+ *                             selection of cells, or null
+ *
+ * \return true if \ref cs_source_term_fcb_compute_at_cells can be used
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_source_term_fcb_batchable(const int           n_source_terms,
+                             cs_xdef_t   *const *source_terms,
+                             const cs_mask_t    *source_mask)
+{
+  if (n_source_terms < 1 || source_mask != nullptr)
+    return false;
+
+  for (int st_id = 0; st_id < n_source_terms; st_id++) {
+
+    const cs_xdef_t  *def = source_terms[st_id];
+    assert(def != nullptr);
+
+    if (def->type == CS_XDEF_BY_VALUE)
+      continue;
+
+    else if (def->type == CS_XDEF_BY_ARRAY) {
+
+      const cs_xdef_array_context_t *cx
+        = (const cs_xdef_array_context_t *)def->context;
+
+      if (!cs_flag_test(cx->value_location, cs_flag_primal_cell))
+        return false;
+
+    }
+    else
+      return false;
+
+  } /* Loop on source terms */
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Evaluate the cell contribution of all source terms of a
+ *          scalar-valued cell-based density over all cells, in a batched
+ *          way. One assumes that \ref cs_source_term_fcb_batchable returned
+ *          true for the same set of definitions.
+ *
+ * \param[in]      n_source_terms  number of source terms
+ * \param[in]      source_terms    pointer to the definitions of source terms
+ * \param[in, out] values          resulting contributions (size: n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_source_term_fcb_compute_at_cells(const int           n_source_terms,
+                                    cs_xdef_t   *const *source_terms,
+                                    cs_real_t          *values)
+{
+  const cs_lnum_t  n_cells = cs_cdo_quant->n_cells;
+
+  memset(values, 0, n_cells*sizeof(cs_real_t));
+
+  for (int st_id = 0; st_id < n_source_terms; st_id++) {
+
+    const cs_xdef_t  *def = source_terms[st_id];
+
+    if (def->type == CS_XDEF_BY_VALUE) {
+
+      const cs_real_t  density = ((const cs_real_t *)def->context)[0];
+      const cs_real_t  *cell_vol = cs_cdo_quant->cell_vol;
+
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+        values[c_id] += density * cell_vol[c_id];
+
+    }
+    else { /* CS_XDEF_BY_ARRAY: values already integrated over the cell */
+
+      assert(def->type == CS_XDEF_BY_ARRAY);
+
+      const cs_xdef_array_context_t *cx
+        = (const cs_xdef_array_context_t *)def->context;
+      const cs_real_t  *st_values = cx->values;
+
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+        values[c_id] += st_values[c_id];
+
+    }
+
+  } /* Loop on source terms */
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the contribution for a cell related to a source term and
@@ -187,6 +187,45 @@ cs_source_term_compute_cellwise(const int                    n_source_terms,
                                 cs_cell_builder_t           *cb,
                                 cs_real_t                   *result);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check if all source terms of a scalar-valued cell-based density
+ *          can be evaluated in a batched way over all cells (i.e. without
+ *          going through the cellwise function pointers inside the assembly
+ *          loop)
+ *
+ * \param[in]  n_source_terms  number of source terms
+ * \param[in]  source_terms    pointer to the definitions of source terms
+ * \param[in]  source_mask     mask built when some terms are defined on a
+ *                             selection of cells, or null
+ *
+ * \return true if \ref cs_source_term_fcb_compute_at_cells can be used
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_source_term_fcb_batchable(const int           n_source_terms,
+                             cs_xdef_t   *const *source_terms,
+                             const cs_mask_t    *source_mask);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Evaluate the cell contribution of all source terms of a
+ *          scalar-valued cell-based density over all cells, in a batched
+ *          way. One assumes that \ref cs_source_term_fcb_batchable returned
+ *          true for the same set of definitions.
+ *
+ * \param[in]      n_source_terms  number of source terms
+ * \param[in]      source_terms    pointer to the definitions of source terms
+ * \param[in, out] values          resulting contributions (size: n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_source_term_fcb_compute_at_cells(const int           n_source_terms,
+                                    cs_xdef_t   *const *source_terms,
+                                    cs_real_t          *values);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the contribution for a cell related to a source term and
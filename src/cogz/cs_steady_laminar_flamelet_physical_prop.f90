@@ -362,6 +362,56 @@ end subroutine
 ! Function:
 ! ---------
 
+!> \file cs_steady_laminar_flamelet_physical_prop.f90
+!>
+!> \brief Specific physic subroutine: diffusion flame.
+!>
+!> Bracketing of a value along a 1-d library coordinate axis:
+!> returns the upper bracket index and the associated interpolation
+!> weight, clamping at both ends of the axis
+!-------------------------------------------------------------------------------
+
+subroutine flamelet_interp_bracket(n, xData, x0, idx, weight)
+
+implicit none
+
+integer :: n, idx
+double precision :: xData(n), x0, weight
+
+integer :: il, ih, im
+
+if (n.eq.1 .or. xData(n).le.x0) then
+  idx = n
+  weight = 1.d0
+elseif (xData(1).ge.x0) then
+  idx = 2
+  weight = 0.d0
+else
+
+  ! Binary search for the first index such that xData(idx) >= x0
+  ! (axes are sorted in increasing order in the library)
+
+  il = 1
+  ih = n
+  do while (ih - il .gt. 1)
+    im = (il + ih) / 2
+    if (xData(im).lt.x0) then
+      il = im
+    else
+      ih = im
+    endif
+  enddo
+
+  idx = ih
+  weight = (x0 - xData(idx-1))/(xData(idx)-xData(idx-1))
+endif
+
+end subroutine
+
+!===============================================================================
+! Function:
+! ---------
+
 !> \file cs_steady_laminar_flamelet_physical_prop.f90
 !>
 !> \brief Specific physic subroutine: diffusion flame.
@@ -382,163 +432,124 @@ use radiat
 
 implicit none
 
-integer :: dataIndex
+integer :: i_zm, i_zvar, i_kim, i_xrm
+integer :: ii, jj, kk, ll, iz, jz, kz, lz
 
 double precision :: zm0, zvar0, kim0, xrm0, phim(nlibvar)
-double precision :: weight_zm, weight_zvar, weight_kim, weight_xrm
+double precision :: weight, wgt
+double precision :: w_zm(2), w_zvar(2), w_kim(2), w_xrm(2)
 
-double precision, dimension(:,:,:,:), allocatable :: phi_4
-double precision, dimension(:,:,:), allocatable :: phi_3
-double precision, dimension(:,:), allocatable :: phi_2
 double precision, dimension(:), allocatable :: xData
 
-! Work arrays for radiation
-double precision, dimension(:,:,:,:,:), allocatable :: rad_work4
-double precision, dimension(:,:,:,:), allocatable  :: rad_work3
-double precision, dimension(:,:,:), allocatable    :: rad_work2
 double precision  rad_work(2, nwsgg)
 
 logical  update_rad
 
-allocate(phi_4(nlibvar,nxr,nki,nzvar))
-allocate(phi_3(nlibvar,nxr,nki))
-allocate(phi_2(nlibvar,nxr))
-
-if (update_rad.eqv..TRUE.) then
-  allocate(rad_work4(2,nwsgg,nxr,nki,nzvar))
-  allocate(rad_work3(2,nwsgg,nxr,nki))
-  allocate(rad_work2(2,nwsgg,nxr))
-endif
+! Bracket the cell state along each direction of the library,
+! interpolating only the axis coordinates actually needed: each axis
+! is evaluated at the brackets found for the previous directions, so
+! no intermediate sub-table needs to be blended.
 
 ! Start with z_m
 allocate(xData(nzm))
 xData(:) = flamelet_library(FLAMELET_ZM,1,1,1,:)
 
-if(xData(1).ge.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(:,:,:,:,1)
-  if (update_rad.eqv..TRUE.) rad_work4(:,:,:,:,:) = radiation_library(:,:,:,:,:,1)
-elseif(xData(size(xData)).le.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(:,:,:,:,nzm)
-  if (update_rad.eqv..TRUE.) rad_work4(:,:,:,:,:) = radiation_library(:,:,:,:,:,nzm)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  if(dataIndex .gt.1 ) then
-    weight_zm = (zm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_4(:,:,:,:) = (1.0-weight_zm)*flamelet_library(:,:,:,:,dataIndex-1) &
-      + weight_zm*flamelet_library(:,:,:,:,dataIndex)
-
-    ! Interpolation grandeurs radiatives
-    if (update_rad.eqv..TRUE.) then
-      rad_work4(:,:,:,:,:) = (1.0-weight_zm)*radiation_library(:,:,:,:,:,dataIndex-1) &
-        + weight_zm*radiation_library(:,:,:,:,:,dataIndex)
-    endif
-  endif
-endif
+call flamelet_interp_bracket(nzm, xData, zm0, i_zm, weight)
+w_zm(1) = 1.d0 - weight
+w_zm(2) = weight
 
 deallocate(xData)
 
-! Then interpolate over z_var
+! Then bracket over z_var
 allocate(xData(nzvar))
-xData(:) = phi_4(FLAMELET_ZVAR,1,1,:)
-
-if(xData(1).ge.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,1)
-  if (update_rad.eqv..TRUE.) rad_work3(:,:,:,:) = rad_work4(:,:,:,:,1)
-elseif(xData(size(xData)).le.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,nzvar)
-  if (update_rad.eqv..TRUE.) rad_work3(:,:,:,:) = rad_work4(:,:,:,:,nzvar)
-else
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zvar0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
+do jj = 1, nzvar
+  xData(jj) = 0.d0
+  do ii = 1, 2
+    if (w_zm(ii).ne.0.d0) then
+      xData(jj) = xData(jj) &
+        + w_zm(ii)*flamelet_library(FLAMELET_ZVAR,1,1,jj,i_zm-2+ii)
+    endif
   enddo
+enddo
 
-  if(dataIndex .gt. 1) then
-    weight_zvar = (zvar0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_3(:,:,:) = (1.0-weight_zvar)*phi_4(:,:,:,dataIndex-1) &
-      + weight_zvar*phi_4(:,:,:,dataIndex)
-    ! Interpolation grandeurs radiatives
-    if (update_rad.eqv..TRUE.) then
-      rad_work3(:,:,:,:) = (1.0-weight_zvar)*rad_work4(:,:,:,:,dataIndex-1) &
-        + weight_zvar*rad_work4(:,:,:,:,dataIndex)
-    endif
-  endif
-endif
+call flamelet_interp_bracket(nzvar, xData, zvar0, i_zvar, weight)
+w_zvar(1) = 1.d0 - weight
+w_zvar(2) = weight
 
 deallocate(xData)
 
-! Then interpolate over Ki_m
+! Then bracket over Ki_m
 allocate(xData(nki))
-xData(:) = phi_3(FLAMELET_KI,1,:)
-
-if(xData(1).ge.kim0) then
-  phi_2(:,:) = phi_3(:,:,1)
-  if (update_rad.eqv..TRUE.) rad_work2(:,:,:) = rad_work3(:,:,:,1)
-elseif(xData(size(xData)).le.kim0) then
-  phi_2(:,:) = phi_3(:,:,nki)
-  if (update_rad.eqv..TRUE.) rad_work2(:,:,:) = rad_work3(:,:,:,nki)
-else
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt. kim0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
+do kk = 1, nki
+  xData(kk) = 0.d0
+  do jj = 1, 2
+    do ii = 1, 2
+      wgt = w_zvar(jj)*w_zm(ii)
+      if (wgt.ne.0.d0) then
+        xData(kk) = xData(kk) &
+          + wgt*flamelet_library(FLAMELET_KI,1,kk,i_zvar-2+jj,i_zm-2+ii)
+      endif
+    enddo
   enddo
+enddo
 
-  if(dataIndex .gt. 1) then
-    weight_kim = (kim0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_2(:,:) = (1.0-weight_kim)*phi_3(:,:,dataIndex-1) &
-      + weight_kim*phi_3(:,:,dataIndex)
-    ! Interpolation grandeurs radiatives
-    if (update_rad.eqv..TRUE.) then
-      rad_work2(:,:,:) = (1.0-weight_kim)*rad_work3(:,:,:,dataIndex-1) &
-        + weight_kim*rad_work3(:,:,:,dataIndex)
-    endif
-  endif
-endif
+call flamelet_interp_bracket(nki, xData, kim0, i_kim, weight)
+w_kim(1) = 1.d0 - weight
+w_kim(2) = weight
 
 deallocate(xData)
 
-! Then interpolate over XR_m
+! Then bracket over XR_m
 allocate(xData(nxr))
-xData(:) = phi_2(FLAMELET_XR,:)
-
-if(xData(1).ge.xrm0) then
-  phim(:) = phi_2(:,1)
-  if (update_rad.eqv..TRUE.) rad_work(:,:) = rad_work2(:,:,1)
-elseif(xData(size(xData)).le.xrm0) then
-  phim(:) = phi_2(:,nxr)
-  if (update_rad.eqv..TRUE.) rad_work(:,:) = rad_work2(:,:,nxr)
-else
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt. xrm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
+do ll = 1, nxr
+  xData(ll) = 0.d0
+  do kk = 1, 2
+    do jj = 1, 2
+      do ii = 1, 2
+        wgt = w_kim(kk)*w_zvar(jj)*w_zm(ii)
+        if (wgt.ne.0.d0) then
+          xData(ll) = xData(ll) &
+            + wgt*flamelet_library(FLAMELET_XR,ll,i_kim-2+kk,i_zvar-2+jj,i_zm-2+ii)
+        endif
+      enddo
+    enddo
   enddo
+enddo
 
-  if(dataIndex.gt.1) then
-    weight_xrm = (xrm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phim(:) = (1.0-weight_xrm)*phi_2(:,dataIndex-1) &
-      + weight_xrm*phi_2(:,dataIndex)
-    if (update_rad.eqv..TRUE.) then
-      rad_work(:,:) = (1.0-weight_xrm)*rad_work2(:,:,dataIndex-1) &
-        + weight_xrm*rad_work2(:,:,dataIndex)
-    endif
-  endif
-endif
+call flamelet_interp_bracket(nxr, xData, xrm0, i_xrm, weight)
+w_xrm(1) = 1.d0 - weight
+w_xrm(2) = weight
 
 deallocate(xData)
-deallocate(phi_4,phi_3,phi_2)
-if (update_rad.eqv..TRUE.) deallocate(rad_work4, rad_work3, rad_work2)
+
+! Multilinear combination of the 16 bracketing library points
+
+phim(:) = 0.d0
+if (update_rad.eqv..TRUE.) rad_work(:,:) = 0.d0
+
+do ii = 1, 2
+  iz = i_zm - 2 + ii
+  do jj = 1, 2
+    jz = i_zvar - 2 + jj
+    do kk = 1, 2
+      kz = i_kim - 2 + kk
+      do ll = 1, 2
+        lz = i_xrm - 2 + ll
+        wgt = w_zm(ii)*w_zvar(jj)*w_kim(kk)*w_xrm(ll)
+        if (wgt.ne.0.d0) then
+          phim(:) = phim(:) + wgt*flamelet_library(:,lz,kz,jz,iz)
+          ! Interpolation grandeurs radiatives
+          if (update_rad.eqv..TRUE.) then
+            rad_work(:,:) = rad_work(:,:) + wgt*radiation_library(:,:,lz,kz,jz,iz)
+          endif
+        endif
+      enddo
+    enddo
+  enddo
+enddo
 
 end subroutine
 
@@ -565,123 +576,106 @@ use coincl
 implicit none
 
 double precision :: zm0, zvar0, kim0, xrm0, rhom
-double precision :: weight_zm, weight_zvar, weight_kim, weight_xrm
+double precision :: weight, wgt
+double precision :: w_zm(2), w_zvar(2), w_kim(2), w_xrm(2)
 
-double precision, dimension(:,:,:,:), allocatable :: phi_4
-double precision, dimension(:,:,:), allocatable :: phi_3
-double precision, dimension(:,:), allocatable :: phi_2
 double precision, dimension(:), allocatable :: xData
 
-integer :: dataIndex, n_var_local = 5
-integer :: var_sel(5)
-
-var_sel = (/FLAMELET_ZM, FLAMELET_ZVAR, FLAMELET_XR,          &
-            FLAMELET_RHO, FLAMELET_KI/)
-
-allocate(phi_4(n_var_local,nxr,nki,nzvar))
-allocate(phi_3(n_var_local,nxr,nki))
-allocate(phi_2(n_var_local,nxr))
+integer :: i_zm, i_zvar, i_kim, i_xrm
+integer :: ii, jj, kk, ll
 
 ! Start with z_m
 allocate(xData(nzm))
 xData(:) = flamelet_library(FLAMELET_ZM,1,1,1,:)
 
-if(xData(1).ge.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(var_sel,:,:,:,1)
-elseif(xData(size(xData)).le.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(var_sel,:,:,:,nzm)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  if(dataIndex .gt.1 ) then
-    weight_zm = (zm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_4(:,:,:,:) = (1.0-weight_zm)*flamelet_library(var_sel,:,:,:,dataIndex-1) &
-      + weight_zm*flamelet_library(var_sel,:,:,:,dataIndex)
-  endif
-endif
+call flamelet_interp_bracket(nzm, xData, zm0, i_zm, weight)
+w_zm(1) = 1.d0 - weight
+w_zm(2) = weight
 
 deallocate(xData)
 
-! Then interpolate over z_var
+! Then bracket over z_var
 allocate(xData(nzvar))
-xData(:) = phi_4(2,1,1,:)
 
-if(xData(1).ge.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,1)
-elseif(xData(size(xData)).le.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,nzvar)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zvar0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
+do jj = 1, nzvar
+  xData(jj) = 0.d0
+  do ii = 1, 2
+    if (w_zm(ii).ne.0.d0) then
+      xData(jj) = xData(jj) &
+        + w_zm(ii)*flamelet_library(FLAMELET_ZVAR,1,1,jj,i_zm-2+ii)
+    endif
   enddo
+enddo
 
-  if(dataIndex .gt. 1) then
-    weight_zvar = (zvar0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_3(:,:,:) = (1.0-weight_zvar)*phi_4(:,:,:,dataIndex-1) &
-      + weight_zvar*phi_4(:,:,:,dataIndex)
-  endif
-endif
+call flamelet_interp_bracket(nzvar, xData, zvar0, i_zvar, weight)
+w_zvar(1) = 1.d0 - weight
+w_zvar(2) = weight
 
 deallocate(xData)
 
-! Then interpolate over Ki_m
+! Then bracket over Ki_m
 allocate(xData(nki))
-xData(:) = phi_3(5,1,:)
-
-if(xData(1).ge.kim0) then
-  phi_2(:,:) = phi_3(:,:,1)
-elseif(xData(size(xData)).le.kim0) then
-  phi_2(:,:) = phi_3(:,:,nki)
-else
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt. kim0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
+do kk = 1, nki
+  xData(kk) = 0.d0
+  do jj = 1, 2
+    do ii = 1, 2
+      wgt = w_zvar(jj)*w_zm(ii)
+      if (wgt.ne.0.d0) then
+        xData(kk) = xData(kk) &
+          + wgt*flamelet_library(FLAMELET_KI,1,kk,i_zvar-2+jj,i_zm-2+ii)
+      endif
+    enddo
   enddo
+enddo
 
-  if(dataIndex .gt. 1) then
-    weight_kim = (kim0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_2(:,:) = (1.0-weight_kim)*phi_3(:,:,dataIndex-1) &
-      + weight_kim*phi_3(:,:,dataIndex)
-  endif
-endif
+call flamelet_interp_bracket(nki, xData, kim0, i_kim, weight)
+w_kim(1) = 1.d0 - weight
+w_kim(2) = weight
 
 deallocate(xData)
 
-! Then interpolate over XR_m
+! Then bracket over XR_m
 allocate(xData(nxr))
-xData(:) = phi_2(3,:)
 
-if(xData(1).ge.xrm0) then
-  rhom = phi_2(4,1)
-elseif(xData(size(xData)).le.xrm0) then
-  rhom = phi_2(4,nxr)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt. xrm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
+do ll = 1, nxr
+  xData(ll) = 0.d0
+  do kk = 1, 2
+    do jj = 1, 2
+      do ii = 1, 2
+        wgt = w_kim(kk)*w_zvar(jj)*w_zm(ii)
+        if (wgt.ne.0.d0) then
+          xData(ll) = xData(ll) &
+            + wgt*flamelet_library(FLAMELET_XR,ll,i_kim-2+kk,i_zvar-2+jj,i_zm-2+ii)
+        endif
+      enddo
+    enddo
   enddo
+enddo
 
-  if(dataIndex.gt.1) then
-    weight_xrm = (xrm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    rhom = (1.0-weight_xrm)*phi_2(4,dataIndex-1) &
-      + weight_xrm*phi_2(4,dataIndex)
-  endif
-endif
+call flamelet_interp_bracket(nxr, xData, xrm0, i_xrm, weight)
+w_xrm(1) = 1.d0 - weight
+w_xrm(2) = weight
 
 deallocate(xData)
-deallocate(phi_4,phi_3,phi_2)
+
+! Multilinear combination of the 16 bracketing library points
+
+rhom = 0.d0
+
+do ii = 1, 2
+  do jj = 1, 2
+    do kk = 1, 2
+      do ll = 1, 2
+        wgt = w_zm(ii)*w_zvar(jj)*w_kim(kk)*w_xrm(ll)
+        if (wgt.ne.0.d0) then
+          rhom = rhom + wgt*flamelet_library(FLAMELET_RHO, i_xrm-2+ll, &
+                                             i_kim-2+kk, i_zvar-2+jj, i_zm-2+ii)
+        endif
+      enddo
+    enddo
+  enddo
+enddo
 
 end subroutine
 
@@ -709,173 +703,136 @@ use radiat
 
 implicit none
 
-integer :: dataIndex, i_ki
+integer :: i_ki, i_zm, i_zvar, i_cm
+integer :: ii, jj, kk, ll, iz, jz, kz, lz
+integer :: i_xrm(nki)
 
 double precision :: zm0, zvar0, cm0, xrm0, phim(nlibvar)
-double precision :: weight_zm, weight_zvar, weight_cm, weight_xrm(nki)
+double precision :: weight, wgt
+double precision :: w_zm(2), w_zvar(2), w_cm(2)
+double precision :: w_xrm(2,nki)
 
-double precision, dimension(:,:,:,:), allocatable :: phi_4
-double precision, dimension(:,:,:), allocatable :: phi_3
-double precision, dimension(:,:), allocatable :: phi_2, xData2D
 double precision, dimension(:), allocatable :: xData
 
-! Work arrays for radiation
-double precision, dimension(:,:,:,:,:), allocatable :: rad_work4
-double precision, dimension(:,:,:,:), allocatable  :: rad_work3
-double precision, dimension(:,:,:), allocatable    :: rad_work2
 double precision  rad_work(2, nwsgg)
 
-logical update_rad
-
-allocate(phi_4(nlibvar,nki,nxr,nzvar))
-allocate(phi_3(nlibvar,nki,nxr))
-allocate(phi_2(nlibvar,nki))
-
-if (update_rad.eqv..TRUE.) then
-  allocate(rad_work4(2,nwsgg,nki,nxr,nzvar))
-  allocate(rad_work3(2,nwsgg,nki,nxr))
-  allocate(rad_work2(2,nwsgg,nki))
-endif
+logical update_rad, c_clipped
 
 ! Start with z_m
 allocate(xData(nzm))
 xData(:) = flamelet_library(FLAMELET_ZM,1,1,1,:)
 
-if(xData(1).ge.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(:,:,:,:,1)
-  if (update_rad.eqv..TRUE.) rad_work4(:,:,:,:,:) = radiation_library(:,:,:,:,:,1)
-elseif(xData(size(xData)).le.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(:,:,:,:,nzm)
-  if (update_rad.eqv..TRUE.) rad_work4(:,:,:,:,:) = radiation_library(:,:,:,:,:,nzm)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  weight_zm = 0.d0
-  if(dataIndex .gt.1 ) then
-    weight_zm = (zm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_4(:,:,:,:) = (1.0d0-weight_zm)*flamelet_library(:,:,:,:,dataIndex-1) &
-      + weight_zm*flamelet_library(:,:,:,:,dataIndex)
-
-    ! Interpolation grandeurs radiatives
-    if (update_rad.eqv..TRUE.) then
-      rad_work4(:,:,:,:,:) = (1.0d0-weight_zm)*radiation_library(:,:,:,:,:,dataIndex-1) &
-        + weight_zm*radiation_library(:,:,:,:,:,dataIndex)
-    endif
-  endif
-endif
+call flamelet_interp_bracket(nzm, xData, zm0, i_zm, weight)
+w_zm(1) = 1.d0 - weight
+w_zm(2) = weight
 
 deallocate(xData)
 
-! Then interpolate over z_var
+! Then bracket over z_var
 allocate(xData(nzvar))
-xData(:) = phi_4(FLAMELET_ZVAR,1,1,:)
-
-if(xData(1).ge.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,1)
-  if (update_rad.eqv..TRUE.) rad_work3(:,:,:,:) = rad_work4(:,:,:,:,1)
-elseif(xData(size(xData)).le.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,nzvar)
-  if (update_rad.eqv..TRUE.) rad_work3(:,:,:,:) = rad_work4(:,:,:,:,nzvar)
-else
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zvar0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
+do jj = 1, nzvar
+  xData(jj) = 0.d0
+  do ii = 1, 2
+    if (w_zm(ii).ne.0.d0) then
+      xData(jj) = xData(jj) &
+        + w_zm(ii)*flamelet_library(FLAMELET_ZVAR,1,1,jj,i_zm-2+ii)
+    endif
   enddo
+enddo
 
-  weight_zvar = 0.d0
-  if(dataIndex .gt. 1) then
-    weight_zvar = (zvar0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_3(:,:,:) = (1.0d0-weight_zvar)*phi_4(:,:,:,dataIndex-1) &
-      + weight_zvar*phi_4(:,:,:,dataIndex)
-
-    ! Interpolation grandeurs radiatives
-    if (update_rad.eqv..TRUE.) then
-      rad_work3(:,:,:,:) = (1.0d0-weight_zvar)*rad_work4(:,:,:,:,dataIndex-1) &
-        + weight_zvar*rad_work4(:,:,:,:,dataIndex)
-    endif
-  endif
-endif
+call flamelet_interp_bracket(nzvar, xData, zvar0, i_zvar, weight)
+w_zvar(1) = 1.d0 - weight
+w_zvar(2) = weight
 
 deallocate(xData)
 
-! Then interpolate over XR_m
-allocate(xData2D(nki,nxr))
-xData2D(:,:) = phi_3(4,:,:)
+! Then bracket over XR_m, whose coordinate (4th library variable here)
+! depends on the flamelet index, so that one bracket is needed per
+! flamelet level
 
-do i_ki = 1, nki
+allocate(xData(nxr))
 
-  if(xData2D(i_ki,1).ge.xrm0) then
-    phi_2(:,i_ki) = phi_3(:,i_ki,1)
-    if (update_rad.eqv..TRUE.) rad_work2(:,:,i_ki) = rad_work3(:,:,i_ki,1)
-  elseif(xData2D(i_ki,nxr).le. xrm0) then
-    phi_2(:,i_ki) = phi_3(:,i_ki,nxr)
-    if (update_rad.eqv..TRUE.) rad_work2(:,:,i_ki) = rad_work3(:,:,i_ki,nxr)
-  else
+do i_ki = 1, nki
 
-    dataIndex = 1
-    do while(xData2D(i_ki,dataIndex) .lt. xrm0 &
-        .and. dataIndex .lt. nxr)
-      dataIndex = dataIndex + 1
+  do ll = 1, nxr
+    xData(ll) = 0.d0
+    do jj = 1, 2
+      do ii = 1, 2
+        wgt = w_zvar(jj)*w_zm(ii)
+        if (wgt.ne.0.d0) then
+          xData(ll) = xData(ll) &
+            + wgt*flamelet_library(4,i_ki,ll,i_zvar-2+jj,i_zm-2+ii)
+        endif
+      enddo
     enddo
+  enddo
 
-    if(dataIndex .gt. 1) then
-      weight_xrm(i_ki) = (xrm0-xData2D(i_ki,dataIndex-1))/ &
-        (xData2D(i_ki,dataIndex)-xData2D(i_ki,dataIndex-1))
-      phi_2(:,i_ki) = (1.d0-weight_xrm(i_ki))*phi_3(:,i_ki,dataIndex-1) &
-        + weight_xrm(i_ki)*phi_3(:,i_ki,dataIndex)
-      if (update_rad.eqv..TRUE.) then
-        rad_work2(:,:,i_ki) = (1.0d0-weight_xrm(i_ki))*rad_work3(:,:,i_ki,dataIndex-1) &
-          + weight_xrm(i_ki)*rad_work3(:,:,i_ki,dataIndex)
-      endif
-    endif
-  endif
+  call flamelet_interp_bracket(nxr, xData, xrm0, i_xrm(i_ki), weight)
+  w_xrm(1,i_ki) = 1.d0 - weight
+  w_xrm(2,i_ki) = weight
 
 enddo
 
-deallocate(xData2D)
+deallocate(xData)
 
-! Then interpolate over c_m
+! Then bracket over c_m
 allocate(xData(nki))
-xData(:) = phi_2(FLAMELET_C,:)
-
-if(xData(1).ge.cm0) then
-  phim(:) = phi_2(:,1)
-  if (update_rad.eqv..TRUE.) rad_work(:,:) = rad_work2(:,:,1)
-elseif(xData(size(xData)).le.cm0) then
-  phim(:) = phi_2(:,nki)
-  phim(FLAMELET_OMG_C) = 0.0d0
-  if (update_rad.eqv..TRUE.) rad_work(:,:) = rad_work2(:,:,nki)
-else
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt. cm0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
+do kk = 1, nki
+  xData(kk) = 0.d0
+  do ll = 1, 2
+    do jj = 1, 2
+      do ii = 1, 2
+        wgt = w_xrm(ll,kk)*w_zvar(jj)*w_zm(ii)
+        if (wgt.ne.0.d0) then
+          xData(kk) = xData(kk) &
+            + wgt*flamelet_library(FLAMELET_C,kk,i_xrm(kk)-2+ll, &
+                                   i_zvar-2+jj,i_zm-2+ii)
+        endif
+      enddo
+    enddo
   enddo
+enddo
 
-  weight_cm = 0.d0
-  if(dataIndex .gt. 1) then
-    weight_cm = (cm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phim(:) = (1.0d0-weight_cm)*phi_2(:,dataIndex-1) &
-      + weight_cm*phi_2(:,dataIndex)
-    if (update_rad.eqv..TRUE.) then
-      rad_work(:,:) = (1.0d0-weight_cm)*rad_work2(:,:,dataIndex-1) &
-        + weight_cm*rad_work2(:,:,dataIndex)
-    endif
-  endif
-endif
+c_clipped = (xData(1).lt.cm0 .and. xData(nki).le.cm0)
+
+call flamelet_interp_bracket(nki, xData, cm0, i_cm, weight)
+w_cm(1) = 1.d0 - weight
+w_cm(2) = weight
 
 deallocate(xData)
 
-deallocate(phi_4,phi_3,phi_2)
-if (update_rad.eqv..TRUE.) deallocate(rad_work4, rad_work3, rad_work2)
+! Multilinear combination of the 16 bracketing library points
+
+phim(:) = 0.d0
+if (update_rad.eqv..TRUE.) rad_work(:,:) = 0.d0
+
+do kk = 1, 2
+  if (w_cm(kk).eq.0.d0) cycle
+  kz = i_cm - 2 + kk
+  do ll = 1, 2
+    lz = i_xrm(kz) - 2 + ll
+    do jj = 1, 2
+      jz = i_zvar - 2 + jj
+      do ii = 1, 2
+        iz = i_zm - 2 + ii
+        wgt = w_cm(kk)*w_xrm(ll,kz)*w_zvar(jj)*w_zm(ii)
+        if (wgt.ne.0.d0) then
+          phim(:) = phim(:) + wgt*flamelet_library(:,kz,lz,jz,iz)
+          ! Interpolation grandeurs radiatives
+          if (update_rad.eqv..TRUE.) then
+            rad_work(:,:) = rad_work(:,:) + wgt*radiation_library(:,:,kz,lz,jz,iz)
+          endif
+        endif
+      enddo
+    enddo
+  enddo
+enddo
+
+! No source term for the progress variable beyond the end of the table
+
+if (c_clipped) phim(FLAMELET_OMG_C) = 0.0d0
 
 end subroutine
 
@@ -904,127 +861,115 @@ implicit none
 double precision, dimension(:), allocatable :: xData
 double precision :: zm0, zvar0, cm0, xrm0, rhom
 
-double precision, dimension(:,:,:,:), allocatable :: phi_4
-double precision, dimension(:,:,:), allocatable :: phi_3
-double precision, dimension(:,:), allocatable :: phi_2, xData2D
-double precision :: weight_zm, weight_zvar, weight_cm, weight_xrm(nki)
-
-integer :: dataIndex, i_ki, n_var_local = 5
-integer :: var_sel(5)
+double precision :: weight, wgt
+double precision :: w_zm(2), w_zvar(2), w_cm(2)
+double precision :: w_xrm(2,nki)
 
-var_sel = (/FLAMELET_ZM, FLAMELET_ZVAR, FLAMELET_XR,          &
-            FLAMELET_RHO, FLAMELET_KI/)
-
-allocate(phi_4(n_var_local,nki,nxr,nzvar))
-allocate(phi_3(n_var_local,nki,nxr))
-allocate(phi_2(n_var_local,nki))
+integer :: i_ki, i_zm, i_zvar, i_cm
+integer :: ii, jj, kk, ll, kz, lz
+integer :: i_xrm(nki)
 
 ! Start with z_m
 allocate(xData(nzm))
 xData(:) = flamelet_library(FLAMELET_ZM,1,1,1,:)
 
-if(xData(1).ge.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(var_sel,:,:,:,1)
-elseif(xData(size(xData)).le.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(var_sel,:,:,:,nzm)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  weight_zm = 0.d0
-  if(dataIndex .gt.1 ) then
-    weight_zm = (zm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_4(:,:,:,:) = (1.0d0-weight_zm)*flamelet_library(var_sel,:,:,:,dataIndex-1) &
-      + weight_zm*flamelet_library(var_sel,:,:,:,dataIndex)
-  endif
-endif
+call flamelet_interp_bracket(nzm, xData, zm0, i_zm, weight)
+w_zm(1) = 1.d0 - weight
+w_zm(2) = weight
 
 deallocate(xData)
 
-! Then interpolate over z_var
+! Then bracket over z_var
 allocate(xData(nzvar))
-xData(:) = phi_4(2,1,1,:)
 
-if(xData(1).ge.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,1)
-elseif(xData(size(xData)).le.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,nzvar)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zvar0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
+do jj = 1, nzvar
+  xData(jj) = 0.d0
+  do ii = 1, 2
+    if (w_zm(ii).ne.0.d0) then
+      xData(jj) = xData(jj) &
+        + w_zm(ii)*flamelet_library(FLAMELET_ZVAR,1,1,jj,i_zm-2+ii)
+    endif
   enddo
+enddo
 
-  weight_zvar = 0.d0
-  if(dataIndex .gt. 1) then
-    weight_zvar = (zvar0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_3(:,:,:) = (1.0d0-weight_zvar)*phi_4(:,:,:,dataIndex-1) &
-      + weight_zvar*phi_4(:,:,:,dataIndex)
-  endif
-endif
+call flamelet_interp_bracket(nzvar, xData, zvar0, i_zvar, weight)
+w_zvar(1) = 1.d0 - weight
+w_zvar(2) = weight
 
 deallocate(xData)
 
-! Then interpolate over XR_m
-allocate(xData2D(nki,nxr))
-xData2D(:,:) = phi_3(3,:,:)
-do i_ki = 1, nki
+! Then bracket over XR_m, one bracket per flamelet level
 
-  if(xData2D(i_ki,1).ge.xrm0) then
-    phi_2(:,i_ki) = phi_3(:,i_ki,1)
-  elseif(xData2D(i_ki,nxr).le. xrm0) then
-    phi_2(:,i_ki) = phi_3(:,i_ki,nxr)
-  else
+allocate(xData(nxr))
 
-    dataIndex = 1
-    do while(xData2D(i_ki,dataIndex) .lt. xrm0 &
-        .and. dataIndex .lt. nxr)
-      dataIndex = dataIndex + 1
+do i_ki = 1, nki
+
+  do ll = 1, nxr
+    xData(ll) = 0.d0
+    do jj = 1, 2
+      do ii = 1, 2
+        wgt = w_zvar(jj)*w_zm(ii)
+        if (wgt.ne.0.d0) then
+          xData(ll) = xData(ll) &
+            + wgt*flamelet_library(FLAMELET_XR,i_ki,ll,i_zvar-2+jj,i_zm-2+ii)
+        endif
+      enddo
     enddo
+  enddo
 
-    if(dataIndex .gt. 1) then
-      weight_xrm(i_ki) = (xrm0-xData2D(i_ki,dataIndex-1))/ &
-        (xData2D(i_ki,dataIndex)-xData2D(i_ki,dataIndex-1))
-      phi_2(:,i_ki) = (1.d0-weight_xrm(i_ki))*phi_3(:,i_ki,dataIndex-1) &
-        + weight_xrm(i_ki)*phi_3(:,i_ki,dataIndex)
-    endif
-  endif
+  call flamelet_interp_bracket(nxr, xData, xrm0, i_xrm(i_ki), weight)
+  w_xrm(1,i_ki) = 1.d0 - weight
+  w_xrm(2,i_ki) = weight
 
 enddo
-deallocate(xData2D)
 
-! Then interpolate over c_m
-allocate(xData(nki))
-xData(:) = phi_2(5,:)
+deallocate(xData)
 
-if(xData(1).ge.cm0) then
-  rhom = phi_2(4,1)
-elseif(xData(size(xData)).le.cm0) then
-  rhom = phi_2(4,nki)
-else
+! Then bracket over c_m
+allocate(xData(nki))
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt. cm0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
+do kk = 1, nki
+  xData(kk) = 0.d0
+  do ll = 1, 2
+    do jj = 1, 2
+      do ii = 1, 2
+        wgt = w_xrm(ll,kk)*w_zvar(jj)*w_zm(ii)
+        if (wgt.ne.0.d0) then
+          xData(kk) = xData(kk) &
+            + wgt*flamelet_library(FLAMELET_KI,kk,i_xrm(kk)-2+ll, &
+                                   i_zvar-2+jj,i_zm-2+ii)
+        endif
+      enddo
+    enddo
   enddo
+enddo
 
-  if(dataIndex .gt. 1) then
-    weight_cm = (cm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    rhom = (1.0d0-weight_cm)*phi_2(4,dataIndex-1) &
-      + weight_cm*phi_2(4,dataIndex)
-  endif
-endif
+call flamelet_interp_bracket(nki, xData, cm0, i_cm, weight)
+w_cm(1) = 1.d0 - weight
+w_cm(2) = weight
 
 deallocate(xData)
 
-deallocate(phi_4,phi_3,phi_2)
+! Multilinear combination of the 16 bracketing library points
+
+rhom = 0.d0
+
+do kk = 1, 2
+  if (w_cm(kk).eq.0.d0) cycle
+  kz = i_cm - 2 + kk
+  do ll = 1, 2
+    lz = i_xrm(kz) - 2 + ll
+    do jj = 1, 2
+      do ii = 1, 2
+        wgt = w_cm(kk)*w_xrm(ll,kz)*w_zvar(jj)*w_zm(ii)
+        if (wgt.ne.0.d0) then
+          rhom = rhom + wgt*flamelet_library(FLAMELET_RHO,kz,lz, &
+                                             i_zvar-2+jj,i_zm-2+ii)
+        endif
+      enddo
+    enddo
+  enddo
+enddo
 
 end subroutine
 
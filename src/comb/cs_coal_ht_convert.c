@@ -168,12 +168,76 @@ cs_coal_ht_convert_h_to_t_gas(int              location_id,
     cvar_f2m[icha] = cs_field_by_id(cm->if2m[icha])->val;
   }
 
+  const int n_coals = cm->n_coals;
+  const int n_tab_points = cm->n_tab_points;
+
+  /* Precompute tabulated data independent of the current element:
+     per-coal weights for the light and heavy volatile pseudo-species,
+     their per-point enthalpy contributions, and a compact layout of the
+     gas species enthalpy table (avoiding scattered accesses to ehgaze
+     in the loop on elements below). */
+
+  const int n_gas_sp = 12;
+
+  cs_real_t w1[CS_COMBUSTION_MAX_COALS];
+  cs_real_t w2[CS_COMBUSTION_MAX_COALS];
+
+  cs_real_t g1[CS_COMBUSTION_COAL_MAX_TABULATION_POINTS]
+              [CS_COMBUSTION_MAX_COALS];
+  cs_real_t g2[CS_COMBUSTION_COAL_MAX_TABULATION_POINTS]
+              [CS_COMBUSTION_MAX_COALS];
+  cs_real_t eg[CS_COMBUSTION_COAL_MAX_TABULATION_POINTS][12];
+
+  for (int icha = 0; icha < n_coals; icha++) {
+
+    int ichx1c_icha = cm->ichx1c[icha] -1;
+    int ichx2c_icha = cm->ichx2c[icha] -1;
+
+    cs_real_t den1 = 1. / (  cm->a1[icha]*cm->wmole[ichx1c_icha]
+                           + cm->b1[icha]*cm->wmole[ico]
+                           + cm->c1[icha]*cm->wmole[ih2o]
+                           + cm->d1[icha]*cm->wmole[ih2s]
+                           + cm->e1[icha]*cm->wmole[ihcn]
+                           + cm->f1[icha]*cm->wmole[inh3]);
+
+    cs_real_t den2 = 1. / (  cm->a2[icha]*cm->wmole[ichx2c_icha]
+                           + cm->b2[icha]*cm->wmole[ico]
+                           + cm->c2[icha]*cm->wmole[ih2o]
+                           + cm->d2[icha]*cm->wmole[ih2s]
+                           + cm->e2[icha]*cm->wmole[ihcn]
+                           + cm->f2[icha]*cm->wmole[inh3]);
+
+    w1[icha] = den1 * cm->a1[icha]*cm->wmole[ichx1c_icha];
+    w2[icha] = den2 * cm->a2[icha]*cm->wmole[ichx2c_icha];
+
+    for (int i = 0; i < n_tab_points; i++) {
+      g1[i][icha] = w1[icha] * cm->ehgaze[i][ichx1c_icha];
+      g2[i][icha] = w2[icha] * cm->ehgaze[i][ichx2c_icha];
+    }
+
+  }
+
+  for (int i = 0; i < n_tab_points; i++) {
+    eg[i][0]  = cm->ehgaze[i][ichx1];
+    eg[i][1]  = cm->ehgaze[i][ichx2];
+    eg[i][2]  = cm->ehgaze[i][ico];
+    eg[i][3]  = cm->ehgaze[i][ih2s];
+    eg[i][4]  = cm->ehgaze[i][ihy];
+    eg[i][5]  = cm->ehgaze[i][ihcn];
+    eg[i][6]  = cm->ehgaze[i][inh3];
+    eg[i][7]  = cm->ehgaze[i][io2];
+    eg[i][8]  = cm->ehgaze[i][ico2];
+    eg[i][9]  = cm->ehgaze[i][ih2o];
+    eg[i][10] = cm->ehgaze[i][iso2];
+    eg[i][11] = cm->ehgaze[i][in2];
+  }
+
   # pragma omp parallel for if (n_elts > CS_THR_MIN)
   for (cs_lnum_t elt_idx = 0; elt_idx < n_elts; elt_idx++) {
 
     cs_real_t f1mc[CS_COMBUSTION_MAX_COALS];
     cs_real_t f2mc[CS_COMBUSTION_MAX_COALS];
-    cs_real_t xesp[CS_COMBUSTION_COAL_MAX_ELEMENTARY_COMPONENTS];
+    cs_real_t xg[12];
 
     cs_lnum_t elt_id = elt_idx;
     if (location_id == CS_MESH_LOCATION_BOUNDARY_FACES)
@@ -181,28 +245,77 @@ cs_coal_ht_convert_h_to_t_gas(int              location_id,
 
     /* Precompute quantities independent of interpolation point */
 
-    xesp[ichx1] = fuel1[elt_id];
-    xesp[ichx2] = fuel2[elt_id];
-    xesp[ico]   = fuel3[elt_id];
-    xesp[ih2s]  = fuel4[elt_id];
-    xesp[ihy]   = fuel5[elt_id];
-    xesp[ihcn]  = fuel6[elt_id];
-    xesp[inh3]  = fuel7[elt_id];
-    xesp[io2]   = oxyd[elt_id];
-    xesp[ico2]  = prod1[elt_id];
-    xesp[ih2o]  = prod2[elt_id];
-    xesp[iso2]  = prod3[elt_id];
-    xesp[in2]   = xiner[elt_id];
-
-    for (int icha = 0; icha < cm->n_coals; icha++) {
+    xg[0]  = fuel1[elt_id];
+    xg[1]  = fuel2[elt_id];
+    xg[2]  = fuel3[elt_id];
+    xg[3]  = fuel4[elt_id];
+    xg[4]  = fuel5[elt_id];
+    xg[5]  = fuel6[elt_id];
+    xg[6]  = fuel7[elt_id];
+    xg[7]  = oxyd[elt_id];
+    xg[8]  = prod1[elt_id];
+    xg[9]  = prod2[elt_id];
+    xg[10] = prod3[elt_id];
+    xg[11] = xiner[elt_id];
+
+    cs_real_t ychx10 = 0, ychx20 = 0;
+
+    for (int icha = 0; icha < n_coals; icha++) {
       f1mc[icha] = cvar_f1m[icha][elt_id] / x1[elt_id];
       f2mc[icha] = cvar_f2m[icha][elt_id] / x1[elt_id];
+      ychx10 += f1mc[icha]*w1[icha];
+      ychx20 += f2mc[icha]*w2[icha];
     }
 
     /* Now interpolate values */
 
-    tp[elt_idx]
-      = cs_coal_ht_convert_h_to_t_gas_by_yi_f1f2(eh[elt_idx], xesp, f1mc, f2mc);
+    cs_real_t eh_e = eh[elt_idx];
+    cs_real_t tp_e = -HUGE_VAL;
+    cs_real_t eh0 = -HUGE_VAL;
+
+    for (int i = 0; i < n_tab_points && tp_e <= -HUGE_VAL; i++) {
+
+      cs_real_t ehchx1 = 0, ehchx2 = 0;
+
+      if (ychx10 > cs_math_epzero) {
+        for (int icha = 0; icha < n_coals; icha++)
+          ehchx1 += f1mc[icha]*g1[i][icha];
+        ehchx1 /= ychx10;
+      }
+      else
+        ehchx1 = eg[i][0];
+
+      if (ychx20 > cs_math_epzero) {
+        for (int icha = 0; icha < n_coals; icha++)
+          ehchx2 += f2mc[icha]*g2[i][icha];
+        ehchx2 /= ychx20;
+      }
+      else
+        ehchx2 = eg[i][1];
+
+      cs_real_t eh1 = xg[0]*ehchx1 + xg[1]*ehchx2;
+      for (int k = 2; k < n_gas_sp; k++)
+        eh1 += xg[k]*eg[i][k];
+
+      /* Interpolate, with clipping at bounds */
+
+      if (eh_e <= eh1) {
+        if (i == 0)
+          tp_e = cm->th[0];
+        else {
+          assert(eh_e >= eh0);
+          tp_e = cm->th[i-1] + (eh_e-eh0) * (cm->th[i]-cm->th[i-1]) / (eh1-eh0);
+        }
+      }
+      else if (i == n_tab_points-1) {
+        tp_e = cm->th[i];
+      }
+
+      eh0 = eh1;
+
+    } /* loop on interpolation points */
+
+    tp[elt_idx] = tp_e;
 
   } /* Loop on cells */
 }
@@ -917,6 +1030,18 @@ cs_coal_ht_convert_h_to_t_particles(void)
     const cs_real_t *cvar_h2cl = cs_field_by_id(cm->ih2[icla])->val;
     cs_real_t *cpro_temp2 = cs_field_by_id(cm->itemp2[icla])->val;
 
+    /* Compact layout of the solid enthalpy table columns used by
+       this class, to avoid scattered accesses in the loop on cells */
+
+    cs_real_t es[CS_COMBUSTION_COAL_MAX_TABULATION_POINTS][4];
+
+    for (int i = 0; i < cm->npoc; i++) {
+      es[i][0] = cm->ehsoli[i][ich_icha];
+      es[i][1] = cm->ehsoli[i][ick_icha];
+      es[i][2] = cm->ehsoli[i][iash_icha];
+      es[i][3] = cm->ehsoli[i][iwat_icha];
+    }
+
 #   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
 
@@ -941,10 +1066,10 @@ cs_coal_ht_convert_h_to_t_particles(void)
 
         for (int i = 0; i < cm->npoc && t2 <= -HUGE_VAL; i++) {
 
-          cs_real_t eh1 =   xch_d_x2  * cm->ehsoli[i][ich_icha]
-                          + xck_d_x2  * cm->ehsoli[i][ick_icha]
-                          + xash_d_x2 * cm->ehsoli[i][iash_icha]
-                          + xwat_d_x2 * cm->ehsoli[i][iwat_icha];
+          cs_real_t eh1 =   xch_d_x2  * es[i][0]
+                          + xck_d_x2  * es[i][1]
+                          + xash_d_x2 * es[i][2]
+                          + xwat_d_x2 * es[i][3];
 
           /* Interpolate, with clipping at bounds */
 
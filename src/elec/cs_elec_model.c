@@ -46,6 +46,7 @@
 #include "bft_error.h"
 #include "bft_printf.h"
 
+#include "cs_array_reduce.h"
 #include "cs_field.h"
 #include "cs_field_default.h"
 #include "cs_file.h"
@@ -1465,34 +1466,36 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
                              1,    /* inc */
                              grad);
 
-    /* compute electric field E = - grad (potR) */
-    for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-      cpro_elefl[iel][0] = grad[iel][0];
-      cpro_elefl[iel][1] = grad[iel][1];
-      cpro_elefl[iel][2] = grad[iel][2];
-    }
-
-    /* compute current density j = sig E */
     int diff_id = cs_field_get_key_int(CS_F_(potr), kivisl);
     cs_field_t *c_prop = NULL;
     if (diff_id > -1)
       c_prop = cs_field_by_id(diff_id);
 
-    if (ieljou > 0 || ielarc > 0) {
-      cs_real_3_t *cpro_curre = (cs_real_3_t *)(CS_F_(curre)->val);
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-        cpro_curre[iel][0] = -c_prop->val[iel] * grad[iel][0];
-        cpro_curre[iel][1] = -c_prop->val[iel] * grad[iel][1];
-        cpro_curre[iel][2] = -c_prop->val[iel] * grad[iel][2];
-      }
-    }
+    cs_real_3_t *cpro_curre = NULL;
+    if (ieljou > 0 || ielarc > 0)
+      cpro_curre = (cs_real_3_t *)(CS_F_(curre)->val);
 
-    /* compute joule effect : j . E */
+    cs_real_t *cpro_joulp = CS_F_(joulp)->val;
+    const cs_real_t *sig = c_prop->val;
+
+    /* In a single cell pass, compute:
+       - electric field E = - grad (potR)
+       - current density j = sig E
+       - joule effect : j . E */
+
+#   pragma omp parallel for  if (n_cells > CS_THR_MIN)
     for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-      CS_F_(joulp)->val[iel] =  c_prop->val[iel] *
-                               (grad[iel][0] * grad[iel][0] +
-                                grad[iel][1] * grad[iel][1] +
-                                grad[iel][2] * grad[iel][2]);
+      cpro_elefl[iel][0] = grad[iel][0];
+      cpro_elefl[iel][1] = grad[iel][1];
+      cpro_elefl[iel][2] = grad[iel][2];
+
+      if (cpro_curre != NULL) {
+        cpro_curre[iel][0] = -sig[iel] * grad[iel][0];
+        cpro_curre[iel][1] = -sig[iel] * grad[iel][1];
+        cpro_curre[iel][2] = -sig[iel] * grad[iel][2];
+      }
+
+      cpro_joulp[iel] = sig[iel] * cs_math_3_square_norm(grad[iel]);
     }
 
     /* compute min max for E and J */
@@ -1502,19 +1505,10 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
                  "-----------------------------------------\n");
 
       /* Grad PotR = -E */
-      double vrmin[3], vrmax[3];
+      double vrmin[4], vrmax[4];
 
-      for (int i = 0; i < 3; i++) {
-        vrmin[i] = HUGE_VAL;
-        vrmax[i] = -HUGE_VAL;
-      }
-
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-        for (int i = 0; i < 3; i++) {
-          vrmin[i] = CS_MIN(vrmin[i], grad[iel][i]);
-          vrmax[i] = CS_MAX(vrmax[i], grad[iel][i]);
-        }
-      }
+      cs_array_reduce_minmax_l(n_cells, 3, NULL, (const cs_real_t *)grad,
+                               vrmin, vrmax);
 
       cs_parall_min(3, CS_DOUBLE, vrmin);
       cs_parall_max(3, CS_DOUBLE, vrmax);
@@ -1526,15 +1520,22 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
       }
 
       /* current real */
-      for (int i = 0; i < 3; i++) {
-        vrmin[i] = HUGE_VAL;
-        vrmax[i] = -HUGE_VAL;
-      }
+      if (cpro_curre != NULL)
+        cs_array_reduce_minmax_l(n_cells, 3, NULL,
+                                 (const cs_real_t *)cpro_curre,
+                                 vrmin, vrmax);
 
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+      else {
         for (int i = 0; i < 3; i++) {
-          vrmin[i] = CS_MIN(vrmin[i], -c_prop->val[iel] * grad[iel][i]);
-          vrmax[i] = CS_MAX(vrmax[i], -c_prop->val[iel] * grad[iel][i]);
+          vrmin[i] = HUGE_VAL;
+          vrmax[i] = -HUGE_VAL;
+        }
+
+        for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+          for (int i = 0; i < 3; i++) {
+            vrmin[i] = CS_MIN(vrmin[i], -sig[iel] * grad[iel][i]);
+            vrmax[i] = CS_MAX(vrmax[i], -sig[iel] * grad[iel][i]);
+          }
         }
       }
 
@@ -1565,39 +1566,35 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
       if (diff_id_i > -1)
         c_propi = cs_field_by_id(diff_id_i);
 
-      if (ieljou == 4) {
-        cs_real_3_t *cpro_curim = (cs_real_3_t *)(CS_F_(curim)->val);
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-          cpro_curim[iel][0] = -c_propi->val[iel] * grad[iel][0];
-          cpro_curim[iel][1] = -c_propi->val[iel] * grad[iel][1];
-          cpro_curim[iel][2] = -c_propi->val[iel] * grad[iel][2];
-        }
-      }
+      cs_real_3_t *cpro_curim = NULL;
+      if (ieljou == 4)
+        cpro_curim = (cs_real_3_t *)(CS_F_(curim)->val);
+
+      const cs_real_t *sigi = c_propi->val;
 
-      /* compute joule effect : j . E */
+      /* compute imaginary current density and joule effect (j . E)
+         contribution in the same pass */
+
+#     pragma omp parallel for  if (n_cells > CS_THR_MIN)
       for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-        CS_F_(joulp)->val[iel] +=   c_propi->val[iel]
-                                  * cs_math_3_square_norm(grad[iel]);
+        if (cpro_curim != NULL) {
+          cpro_curim[iel][0] = -sigi[iel] * grad[iel][0];
+          cpro_curim[iel][1] = -sigi[iel] * grad[iel][1];
+          cpro_curim[iel][2] = -sigi[iel] * grad[iel][2];
+        }
+
+        cpro_joulp[iel] += sigi[iel] * cs_math_3_square_norm(grad[iel]);
       }
 
       /* compute min max for E and J */
       if (log_active) {
 
-        double vrmin[3], vrmax[3];
+        double vrmin[4], vrmax[4];
 
-        /* Grad PotR = -Ei */
+        /* Grad PotI = -Ei */
 
-        for (int i = 0; i < 3; i++) {
-          vrmin[i] = HUGE_VAL;
-          vrmax[i] = -HUGE_VAL;
-        }
-
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-          for (int i = 0; i < 3; i++) {
-            vrmin[i] = CS_MIN(vrmin[i], grad[iel][0]);
-            vrmax[i] = CS_MAX(vrmax[i], grad[iel][0]);
-          }
-        }
+        cs_array_reduce_minmax_l(n_cells, 3, NULL, (const cs_real_t *)grad,
+                                 vrmin, vrmax);
 
         cs_parall_min(3, CS_DOUBLE, vrmin);
         cs_parall_max(3, CS_DOUBLE, vrmax);
@@ -1610,15 +1607,22 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
 
         /* Imaginary current */
 
-        for (int i = 0; i < 3; i++) {
-          vrmin[i] = HUGE_VAL;
-          vrmax[i] = -HUGE_VAL;
-        }
+        if (cpro_curim != NULL)
+          cs_array_reduce_minmax_l(n_cells, 3, NULL,
+                                   (const cs_real_t *)cpro_curim,
+                                   vrmin, vrmax);
 
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+        else {
           for (int i = 0; i < 3; i++) {
-            vrmin[i] = CS_MIN(vrmin[i], -c_propi->val[iel] * grad[iel][i]);
-            vrmax[i] = CS_MAX(vrmax[i], -c_propi->val[iel] * grad[iel][i]);
+            vrmin[i] = HUGE_VAL;
+            vrmax[i] = -HUGE_VAL;
+          }
+
+          for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+            for (int i = 0; i < 3; i++) {
+              vrmin[i] = CS_MIN(vrmin[i], -sigi[iel] * grad[iel][i]);
+              vrmax[i] = CS_MAX(vrmax[i], -sigi[iel] * grad[iel][i]);
+            }
           }
         }
 
@@ -1654,6 +1658,7 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
                                1,    /* inc */
                                gradv);
 
+#     pragma omp parallel for  if (n_cells > CS_THR_MIN)
       for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
         cpro_magfl[iel][0] = -gradv[iel][1][2]+gradv[iel][2][1];
         cpro_magfl[iel][1] =  gradv[iel][0][2]-gradv[iel][2][0];
@@ -1669,6 +1674,7 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
     /* compute laplace effect j x B */
     cs_real_3_t *cpro_laplf = (cs_real_3_t *)(CS_F_(laplf)->val);
     cs_real_3_t *cpro_curre = (cs_real_3_t *)(CS_F_(curre)->val);
+#   pragma omp parallel for  if (n_cells > CS_THR_MIN)
     for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
       cpro_laplf[iel][0] =    cpro_curre[iel][1] * cpro_magfl[iel][2]
                             - cpro_curre[iel][2] * cpro_magfl[iel][1];
@@ -1680,20 +1686,11 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
 
     /* compute min max for B */
     if (ielarc > 1 && log_active) {
-      /* Grad PotR = -E */
-      double vrmin[3], vrmax[3];
+      double vrmin[4], vrmax[4];
 
-      for (int i = 0; i < 3; i++) {
-        vrmin[i] = HUGE_VAL;
-        vrmax[i] = -HUGE_VAL;
-      }
-
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-        for (int i = 0; i < 3; i++) {
-          vrmin[i] = CS_MIN(vrmin[i], cpro_magfl[iel][i]);
-          vrmax[i] = CS_MAX(vrmax[i], cpro_magfl[iel][i]);
-        }
-      }
+      cs_array_reduce_minmax_l(n_cells, 3, NULL,
+                               (const cs_real_t *)cpro_magfl,
+                               vrmin, vrmax);
 
       cs_parall_min(3, CS_DOUBLE, vrmin);
       cs_parall_max(3, CS_DOUBLE, vrmax);
@@ -1738,25 +1735,26 @@ cs_elec_source_terms(const cs_mesh_t             *mesh,
       bft_printf("compute source terms for variable : %s\n", name);
 
     if (cs_glob_time_step->nt_cur > 2) {
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-        w1[iel] = CS_F_(joulp)->val[iel] * volume[iel];
+      const cs_real_t *cpro_joulp = CS_F_(joulp)->val;
+      const cs_real_t *cpro_radsc = NULL;
 
       if (ielarc >= 1)
         if (cs_glob_elec_option->ixkabe == 2)
-          for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-            w1[iel] -= CS_F_(radsc)->val[iel] * volume[iel];
+          cpro_radsc = CS_F_(radsc)->val;
 
-      for (cs_lnum_t iel = 0; iel < n_cells; iel++)
-        smbrs[iel] += w1[iel];
+#     pragma omp parallel for  if (n_cells > CS_THR_MIN)
+      for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+        cs_real_t w = cpro_joulp[iel] * volume[iel];
+        if (cpro_radsc != NULL)
+          w -= cpro_radsc[iel] * volume[iel];
+        w1[iel] = w;
+        smbrs[iel] += w;
+      }
 
       if (eqp->verbosity > 0) {
-        double valmin = w1[0];
-        double valmax = w1[0];
+        double valmin, valmax;
 
-        for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
-          valmin = CS_MIN(valmin, w1[iel]);
-          valmax = CS_MAX(valmax, w1[iel]);
-        }
+        cs_array_reduce_minmax_l(n_cells, 1, NULL, w1, &valmin, &valmax);
 
         cs_parall_min(1, CS_DOUBLE, &valmin);
         cs_parall_max(1, CS_DOUBLE, &valmax);
@@ -1796,6 +1794,7 @@ cs_elec_source_terms_v(const cs_mesh_t             *mesh,
     if (eqp->verbosity > 0)
       bft_printf("compute source terms for variable: %s\n", f->name);
 
+#   pragma omp parallel for  if (n_cells > CS_THR_MIN)
     for (cs_lnum_t iel = 0; iel < n_cells; iel++)
       for (int isou = 0; isou < 3; isou++)
         smbrv[iel][isou] += cs_elec_permvi * cpro_curre[iel][isou] * volume[iel];
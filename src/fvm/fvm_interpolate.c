@@ -79,6 +79,147 @@ BEGIN_C_DECLS
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Group points by the section containing them.
+ *
+ * Element ids are also converted to section-relative ids, so per-section
+ * loops need not repeat the section search done here.
+ *
+ * parameters:
+ *   this_nodal <-- pointer to nodal mesh representation structure
+ *   entity_dim <-- 3 for location on cells, 2 for faces, 1 for edges,
+ *                  and 0 for vertices
+ *   n_points   <-- number of points to locate
+ *   location_id <-- id of element (with concatenated sections)
+ *                   in which each point is located
+ *   sec_idx    --> start of each section's points (size: n_sections + 1)
+ *   point_ids  --> point ids, grouped by section (size: n_points)
+ *   rel_elt_id --> section-relative element id per point (size: n_points)
+ *----------------------------------------------------------------------------*/
+
+static void
+_section_point_lists(const fvm_nodal_t  *this_nodal,
+                     int                 entity_dim,
+                     cs_lnum_t           n_points,
+                     const cs_lnum_t     location_id[],
+                     cs_lnum_t           sec_idx[],
+                     cs_lnum_t           point_ids[],
+                     cs_lnum_t           rel_elt_id[])
+{
+  const int n_sections = this_nodal->n_sections;
+
+  for (int i = 0; i < n_sections + 1; i++)
+    sec_idx[i] = 0;
+
+  for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
+
+    cs_lnum_t elt_id = location_id[p_id];
+
+    rel_elt_id[p_id] = -1;
+
+    if (elt_id < 0)  /* Unlocated point */
+      continue;
+
+    for (int sec_id = 0; sec_id < n_sections; sec_id++) {
+
+      const fvm_nodal_section_t  *section = this_nodal->sections[sec_id];
+
+      if (section->entity_dim != entity_dim)
+        continue;
+
+      if (section->n_elements < elt_id) {
+        elt_id -= section->n_elements;
+        continue;
+      }
+
+      rel_elt_id[p_id] = elt_id;
+      sec_idx[sec_id + 1] += 1;
+      break;
+
+    }
+
+  }
+
+  for (int i = 0; i < n_sections; i++)
+    sec_idx[i+1] += sec_idx[i];
+
+  cs_lnum_t *shift;
+  BFT_MALLOC(shift, n_sections, cs_lnum_t);
+  for (int i = 0; i < n_sections; i++)
+    shift[i] = sec_idx[i];
+
+  for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
+
+    cs_lnum_t elt_id = location_id[p_id];
+
+    if (elt_id < 0 || rel_elt_id[p_id] < 0)
+      continue;
+
+    for (int sec_id = 0; sec_id < n_sections; sec_id++) {
+
+      const fvm_nodal_section_t  *section = this_nodal->sections[sec_id];
+
+      if (section->entity_dim != entity_dim)
+        continue;
+
+      if (section->n_elements < elt_id) {
+        elt_id -= section->n_elements;
+        continue;
+      }
+
+      point_ids[shift[sec_id]] = p_id;
+      shift[sec_id] += 1;
+      break;
+
+    }
+
+  }
+
+  BFT_FREE(shift);
+}
+
+/*----------------------------------------------------------------------------
+ * Add the contribution of one vertex to a point's least-squares system.
+ *
+ * parameters:
+ *   v_coo    <-- vertex coordinates
+ *   p_coo    <-- point coordinates
+ *   s_var    <-- source data associated with the vertex
+ *   data_dim <-- data dimension
+ *   a        <-> lower-triangular part of the symmetric system matrix
+ *   r        <-> right-hand sides
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_lsq_add_vtx(const cs_coord_t   v_coo[3],
+             const cs_coord_t   p_coo[3],
+             const cs_real_t   *s_var,
+             int                data_dim,
+             cs_real_t          a[10],
+             cs_real_t          r[9][4])
+{
+  cs_real_t r_coo[3]
+    = {v_coo[0]-p_coo[0], v_coo[1]-p_coo[1], v_coo[2]-p_coo[2]};
+
+  a[0] += r_coo[0] * r_coo[0]; // a00
+  a[1] += r_coo[1] * r_coo[0]; // a10
+  a[2] += r_coo[1] * r_coo[1]; // a11
+  a[3] += r_coo[2] * r_coo[0]; // a20
+  a[4] += r_coo[2] * r_coo[1]; // a21
+  a[5] += r_coo[2] * r_coo[2]; // a22
+  a[6] += r_coo[0];            // a30
+  a[7] += r_coo[1];            // a31
+  a[8] += r_coo[2];            // a32
+  a[9] += 1;                   // a33
+
+  for (int k = 0; k < data_dim; k++) {
+    r[k][0] += r_coo[0] * s_var[k];
+    r[k][1] += r_coo[1] * s_var[k];
+    r[k][2] += r_coo[2] * s_var[k];
+    r[k][3] += s_var[k];
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -121,12 +262,301 @@ fvm_interpolate_vtx_data(const fvm_nodal_t       *this_nodal,
          && src_data != NULL && dest_data != NULL);
   assert(this_nodal->dim == 3);
 
+  if (this_nodal->dim != 3)
+    return;
+
+  cs_assert(data_dim <= 9);
+
+  const cs_coord_t  *vtx_coords = this_nodal->vertex_coords;
+  const cs_lnum_t   *parent_vertex_id = this_nodal->parent_vertex_id;
+
+  const int n_sections = this_nodal->n_sections;
+
+  /* Group points by section, so that each section's points are handled
+     by a uniform (branch-free) loop below */
+
+  cs_lnum_t  *sec_idx, *point_ids, *rel_elt_id;
+  BFT_MALLOC(sec_idx, n_sections + 1, cs_lnum_t);
+  BFT_MALLOC(point_ids, n_points, cs_lnum_t);
+  BFT_MALLOC(rel_elt_id, n_points, cs_lnum_t);
+
+  _section_point_lists(this_nodal,
+                       entity_dim,
+                       n_points,
+                       location_id,
+                       sec_idx,
+                       point_ids,
+                       rel_elt_id);
+
+  /* Loop on sections */
+
+  for (int sec_id = 0; sec_id < n_sections; sec_id++) {
+
+    const fvm_nodal_section_t  *section = this_nodal->sections[sec_id];
+
+    const cs_lnum_t s_id = sec_idx[sec_id], e_id = sec_idx[sec_id + 1];
+
+    if (e_id <= s_id)
+      continue;
+
+    if (section->type == FVM_CELL_POLY) {
+
+#     pragma omp parallel for if (e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
+
+        const cs_lnum_t p_id = point_ids[i];
+        const cs_lnum_t elt_id = rel_elt_id[p_id];
+
+        cs_real_t  a[10] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+        cs_real_t  r[9][4];
+
+        for (int l = 0; l < data_dim; l++) {
+          r[l][0] = 0;
+          r[l][1] = 0;
+          r[l][2] = 0;
+          r[l][3] = 0;
+        }
+
+        const cs_coord_t  *p_coo = point_coords + 3*p_id;
+
+        for (cs_lnum_t j = section->face_index[elt_id];
+             j < section->face_index[elt_id + 1]; j++) {
+
+          cs_lnum_t  f_id = CS_ABS(section->face_num[j]) - 1;
+          for (cs_lnum_t k = section->vertex_index[f_id];
+               k < section->vertex_index[f_id + 1]; k++) {
+
+            cs_lnum_t  v_id = section->vertex_num[k] - 1;
+            if (parent_vertex_id != NULL)
+              v_id = parent_vertex_id[v_id];
+
+            _lsq_add_vtx(vtx_coords + 3*v_id,
+                         p_coo,
+                         src_data + data_dim*v_id,
+                         data_dim,
+                         a,
+                         r);
+
+          }
+
+        }
+
+        cs_math_sym_44_factor_ldlt(a);
+
+        for (cs_lnum_t k = 0; k < data_dim; k++) {
+          dest_data[p_id*data_dim + k] = cs_math_sym_44_partial_solve_ldlt(a, r[k]);
+        }
+
+      }
+
+    }
+
+    else if (section->type == FVM_FACE_POLY) {
+
+#     pragma omp parallel for if (e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
+
+        const cs_lnum_t p_id = point_ids[i];
+        const cs_lnum_t elt_id = rel_elt_id[p_id];
+
+        cs_real_t  a[10] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+        cs_real_t  r[9][4];
+
+        for (int l = 0; l < data_dim; l++) {
+          r[l][0] = 0;
+          r[l][1] = 0;
+          r[l][2] = 0;
+          r[l][3] = 0;
+        }
+
+        const cs_coord_t  *p_coo = point_coords + 3*p_id;
+
+        for (cs_lnum_t j = section->vertex_index[elt_id];
+             j < section->vertex_index[elt_id+1]; j++) {
+
+          cs_lnum_t  v_id = section->vertex_num[j] - 1;
+          if (parent_vertex_id != NULL)
+            v_id = parent_vertex_id[v_id];
+
+          _lsq_add_vtx(vtx_coords + 3*v_id,
+                       p_coo,
+                       src_data + data_dim*v_id,
+                       data_dim,
+                       a,
+                       r);
+
+        }
+
+        cs_math_sym_44_factor_ldlt(a);
+
+        for (cs_lnum_t k = 0; k < data_dim; k++) {
+          dest_data[p_id*data_dim + k] = cs_math_sym_44_partial_solve_ldlt(a, r[k]);
+        }
+
+      }
+
+    }
+
+    else { /* Regular (strided) elements; the vertex count is uniform,
+              so the inner loop has a known, constant trip count */
+
+      const cs_lnum_t  stride = section->stride;
+
+#     pragma omp parallel for if (e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
+
+        const cs_lnum_t p_id = point_ids[i];
+        const cs_lnum_t elt_id = rel_elt_id[p_id];
+
+        cs_real_t  a[10] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+        cs_real_t  r[9][4];
+
+        for (int l = 0; l < data_dim; l++) {
+          r[l][0] = 0;
+          r[l][1] = 0;
+          r[l][2] = 0;
+          r[l][3] = 0;
+        }
+
+        const cs_coord_t  *p_coo = point_coords + 3*p_id;
+
+        for (cs_lnum_t j = elt_id*stride; j < (elt_id+1)*stride; j++) {
+
+          cs_lnum_t  v_id = section->vertex_num[j] - 1;
+          if (parent_vertex_id != NULL)
+            v_id = parent_vertex_id[v_id];
+
+          _lsq_add_vtx(vtx_coords + 3*v_id,
+                       p_coo,
+                       src_data + data_dim*v_id,
+                       data_dim,
+                       a,
+                       r);
+
+        }
+
+        cs_math_sym_44_factor_ldlt(a);
+
+        for (cs_lnum_t k = 0; k < data_dim; k++) {
+          dest_data[p_id*data_dim + k] = cs_math_sym_44_partial_solve_ldlt(a, r[k]);
+        }
+
+      }
+
+    } /* Section type */
+
+  } /* Loop on sections */
+
+  BFT_FREE(rel_elt_id);
+  BFT_FREE(point_ids);
+  BFT_FREE(sec_idx);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute sparse interpolation weights equivalent to
+ * fvm_interpolate_vtx_data, so that interpolation of multiple data arrays
+ * may reuse the same geometric factorization.
+ *
+ * The operator has one row per point, whose entries map to source mesh
+ * vertices; interpolated values are then obtained as
+ * dest[p] = sum(weights[j]*src_data[vtx_id[j]]) over the entries of
+ * each row.
+ *
+ * When vtx_id and weights are NULL, only the number of entries per row is
+ * computed, in weights_idx[p_id + 1] (weights_idx[0] being left untouched,
+ * so that the caller may transform counts to an index); otherwise,
+ * weights_idx is expected to contain the previously computed row index,
+ * and vtx_id and weights are filled.
+ *
+ * parameters:
+ *   this_nodal         <-- pointer to nodal mesh representation structure
+ *   entity_dim         <-- 3 for location on cells, 2 for faces, 1 for edges,
+ *                          and 0 for vertices
+ *   n_points           <-- number of points to locate
+ *   location_id        <-- id of element (with concatenated sections)
+ *                          in which each point is located
+ *   point_coords       <-- point coordinates
+ *   weights_idx        <-> index of entries per point (size: n_points + 1)
+ *   vtx_id             --> source vertex id per entry, or NULL
+ *   weights            --> weight per entry, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_interpolate_vtx_data_weights(const fvm_nodal_t  *this_nodal,
+                                 int                 entity_dim,
+                                 cs_lnum_t           n_points,
+                                 const cs_lnum_t     location_id[],
+                                 const cs_coord_t    point_coords[],
+                                 cs_lnum_t           weights_idx[],
+                                 cs_lnum_t           vtx_id[],
+                                 cs_real_t           weights[])
+{
+  if (this_nodal == NULL || n_points == 0)
+    return;
+
+  /* Sanity checks */
+  assert(   point_coords != NULL && location_id != NULL
+         && weights_idx != NULL);
+  assert(this_nodal->dim == 3);
+
   if (this_nodal->dim != 3)
     return;
 
   const cs_coord_t  *vtx_coords = this_nodal->vertex_coords;
 
-  /* Loop on points */
+  /* Counting pass */
+  /*---------------*/
+
+  if (vtx_id == NULL || weights == NULL) {
+
+#   pragma omp parallel for if (n_points > CS_THR_MIN)
+    for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
+
+      cs_lnum_t elt_id = location_id[p_id];
+
+      weights_idx[p_id + 1] = 0;
+
+      if (elt_id < 0)  /* Unlocated point */
+        continue;
+
+      for (int sec_id = 0; sec_id < this_nodal->n_sections; sec_id++) {
+
+        const fvm_nodal_section_t  *section = this_nodal->sections[sec_id];
+
+        if (section->entity_dim != entity_dim)
+          continue;
+
+        if (section->n_elements < elt_id) {
+          elt_id -= section->n_elements;
+          continue;
+        }
+
+        if (section->type == FVM_CELL_POLY) {
+          cs_lnum_t n_ent_vtx = 0;
+          for (cs_lnum_t j = section->face_index[elt_id];
+               j < section->face_index[elt_id + 1]; j++) {
+            cs_lnum_t  f_id = CS_ABS(section->face_num[j]) - 1;
+            n_ent_vtx +=   section->vertex_index[f_id + 1]
+                         - section->vertex_index[f_id];
+          }
+          weights_idx[p_id + 1] = n_ent_vtx;
+        }
+        else if (section->type == FVM_FACE_POLY)
+          weights_idx[p_id + 1] =   section->vertex_index[elt_id + 1]
+                                  - section->vertex_index[elt_id];
+        else
+          weights_idx[p_id + 1] = section->stride;
+
+      } /* Loop on sections */
+
+    } /* Loop on points */
+
+    return;
+
+  }
+
+  /* Assignment pass */
+  /*-----------------*/
 
 # pragma omp parallel for if (n_points > CS_THR_MIN)
   for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
@@ -150,21 +580,13 @@ fvm_interpolate_vtx_data(const fvm_nodal_t       *this_nodal,
 
       /* Location is now given by elt_id relative to current section */
 
-      if (section->type == FVM_CELL_POLY) {
+      cs_real_t  a[10] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
 
-        cs_assert(data_dim <= 9);
-
-        cs_real_t  a[10] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-        cs_real_t  r[9][4];
+      const cs_coord_t  *p_coo = point_coords + 3*p_id;
 
-        for (int i = 0; i < data_dim; i++) {
-          r[i][0] = 0;
-          r[i][1] = 0;
-          r[i][2] = 0;
-          r[i][3] = 0;
-        }
+      cs_lnum_t w_idx = weights_idx[p_id];
 
-        const cs_coord_t  *p_coo = point_coords + 3*p_id;
+      if (section->type == FVM_CELL_POLY) {
 
         for (cs_lnum_t j = section->face_index[elt_id];
              j < section->face_index[elt_id + 1]; j++) {
@@ -192,24 +614,13 @@ fvm_interpolate_vtx_data(const fvm_nodal_t       *this_nodal,
             a[8] += r_coo[2];            // a32
             a[9] += 1;                   // a33
 
-            const cs_real_t *s_var = src_data + data_dim*v_id;
-            for (cs_lnum_t l = 0; l < data_dim; l++) {
-              r[l][0] += r_coo[0] * s_var[l];
-              r[l][1] += r_coo[1] * s_var[l];
-              r[l][2] += r_coo[2] * s_var[l];
-              r[l][3] += s_var[l];
-            }
+            vtx_id[w_idx] = v_id;
+            w_idx += 1;
 
           }
 
         }
 
-        cs_math_sym_44_factor_ldlt(a);
-
-        for (cs_lnum_t k = 0; k < data_dim; k++) {
-          dest_data[p_id*data_dim + k] = cs_math_sym_44_partial_solve_ldlt(a, r[k]);
-        }
-
       }
 
       else { /* Polygonal or regular elements */
@@ -226,20 +637,6 @@ fvm_interpolate_vtx_data(const fvm_nodal_t       *this_nodal,
           v_e_id = (elt_id+1) * stride;
         }
 
-        cs_assert(data_dim <= 9);
-
-        cs_real_t  a[10] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-        cs_real_t  r[9][4];
-
-        for (int i = 0; i < data_dim; i++) {
-          r[i][0] = 0;
-          r[i][1] = 0;
-          r[i][2] = 0;
-          r[i][3] = 0;
-        }
-
-        const cs_coord_t  *p_coo = point_coords + 3*p_id;
-
         for (cs_lnum_t j = v_s_id; j < v_e_id; j++) {
 
           cs_lnum_t  v_id = section->vertex_num[j] - 1;
@@ -262,23 +659,32 @@ fvm_interpolate_vtx_data(const fvm_nodal_t       *this_nodal,
           a[8] += r_coo[2];            // a32
           a[9] += 1;                   // a33
 
-          const double *s_var = src_data + data_dim*v_id;
-          for (cs_lnum_t k = 0; k < data_dim; k++) {
-            r[k][0] += r_coo[0] * s_var[k];
-            r[k][1] += r_coo[1] * s_var[k];
-            r[k][2] += r_coo[2] * s_var[k];
-            r[k][3] += s_var[k];
-          }
+          vtx_id[w_idx] = v_id;
+          w_idx += 1;
 
         }
 
-        cs_math_sym_44_factor_ldlt(a);
+      } /* Section type */
 
-        for (cs_lnum_t k = 0; k < data_dim; k++) {
-          dest_data[p_id*data_dim + k] = cs_math_sym_44_partial_solve_ldlt(a, r[k]);
-        }
+      /* As interpolation is linear relative to the source data, the
+         weight of each entry is obtained by applying the factored
+         system to that vertex's own contribution to the right-hand
+         side. */
 
-      } /* Section type */
+      cs_math_sym_44_factor_ldlt(a);
+
+      for (cs_lnum_t j = weights_idx[p_id]; j < w_idx; j++) {
+
+        const cs_coord_t  *v_coo = vtx_coords + 3*vtx_id[j];
+
+        cs_real_t b[4] = {v_coo[0]-p_coo[0],
+                          v_coo[1]-p_coo[1],
+                          v_coo[2]-p_coo[2],
+                          1.};
+
+        weights[j] = cs_math_sym_44_partial_solve_ldlt(a, b);
+
+      }
 
     } /* Loop on sections */
 
@@ -84,6 +84,45 @@ fvm_interpolate_vtx_data(const fvm_nodal_t       *this_nodal,
                          const cs_real_t          src_data[],
                          cs_real_t                dest_data[]);
 
+/*----------------------------------------------------------------------------
+ * Compute sparse interpolation weights equivalent to
+ * fvm_interpolate_vtx_data, so that interpolation of multiple data arrays
+ * may reuse the same geometric factorization.
+ *
+ * The operator has one row per point, whose entries map to source mesh
+ * vertices; interpolated values are then obtained as
+ * dest[p] = sum(weights[j]*src_data[vtx_id[j]]) over the entries of
+ * each row.
+ *
+ * When vtx_id and weights are NULL, only the number of entries per row is
+ * computed, in weights_idx[p_id + 1] (weights_idx[0] being left untouched,
+ * so that the caller may transform counts to an index); otherwise,
+ * weights_idx is expected to contain the previously computed row index,
+ * and vtx_id and weights are filled.
+ *
+ * parameters:
+ *   this_nodal         <-- pointer to nodal mesh representation structure
+ *   entity_dim         <-- 3 for location on cells, 2 for faces, 1 for edges,
+ *                          and 0 for vertices
+ *   n_points           <-- number of points to locate
+ *   location_id        <-- id of element (with concatenated sections)
+ *                          in which each point is located
+ *   point_coords       <-- point coordinates
+ *   weights_idx        <-> index of entries per point (size: n_points + 1)
+ *   vtx_id             --> source vertex id per entry, or NULL
+ *   weights            --> weight per entry, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_interpolate_vtx_data_weights(const fvm_nodal_t  *this_nodal,
+                                 int                 entity_dim,
+                                 cs_lnum_t           n_points,
+                                 const cs_lnum_t     location_id[],
+                                 const cs_coord_t    point_coords[],
+                                 cs_lnum_t           weights_idx[],
+                                 cs_lnum_t           vtx_id[],
+                                 cs_real_t           weights[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -632,6 +632,40 @@ _fvm_io_num_global_max_unordered(const fvm_io_num_t  *const this_io_num,
   return global_max;
 }
 
+/*----------------------------------------------------------------------------
+ * Check if a strided array of global number sets is already ordered.
+ *
+ * When entities are already clustered by increasing global number (the
+ * common case when the parent numbering derives from a previous ordering,
+ * as in block-distributed mesh builder data), the data received by each
+ * block is already sorted, and the block sort may be skipped entirely.
+ *
+ * parameters:
+ *   number <-- array of global number sets (size: n_ent*stride)
+ *   stride <-- values per entity
+ *   n_ent  <-- number of entities
+ *
+ * returns:
+ *   true if the array is lexicographically ordered, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_is_ordered_gnum_s(const cs_gnum_t  number[],
+                   size_t           stride,
+                   cs_lnum_t        n_ent)
+{
+  for (cs_lnum_t i = 1; i < n_ent; i++) {
+    for (size_t j = 0; j < stride; j++) {
+      if (number[i*stride + j] > number[(i-1)*stride + j])
+        break;
+      else if (number[i*stride + j] < number[(i-1)*stride + j])
+        return false;
+    }
+  }
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Global ordering associated with an I/O numbering structure.
  *
@@ -725,15 +759,6 @@ _fvm_io_num_global_order(fvm_io_num_t       *this_io_num,
 
   if (b_size > 0) {
 
-    cs_lnum_t *b_order;
-
-    BFT_MALLOC(b_order, b_size, cs_lnum_t);
-
-    cs_order_gnum_allocated(NULL,
-                            b_gnum,
-                            b_order,
-                            b_size);
-
     /* Determine global order; requires ordering to loop through buffer by
        increasing number (blocks associated with each process are
        already sorted, but the whole "gathered" block is not).
@@ -741,38 +766,89 @@ _fvm_io_num_global_order(fvm_io_num_t       *this_io_num,
        such that for each block, the global number of an entity is equal to
        the cumulative number of sub-entities */
 
-    if (have_sub_glob > 0) {
+    if (_is_ordered_gnum_s(b_gnum, 1, b_size)) {
 
-      current_gnum = b_nsub[b_order[0]];
-      num_prev = b_gnum[b_order[0]];
-      b_gnum[b_order[0]] = current_gnum;
+      /* If the block's data is already ordered, which is the common
+         case when the parent numbering is itself based on a previous
+         ordering, the sort may be skipped */
+
+      if (have_sub_glob > 0) {
+
+        current_gnum = b_nsub[0];
+        num_prev = b_gnum[0];
+        b_gnum[0] = current_gnum;
+
+        for (cs_lnum_t i = 1; i < b_size; i++) {
+          num_cur = b_gnum[i];
+          if (num_cur > num_prev)
+            current_gnum += b_nsub[i];
+          b_gnum[i] = current_gnum;
+          num_prev = num_cur;
+        }
+
+      }
+      else { /* if (have_sub_glob == 0) */
+
+        current_gnum = 1;
+        num_prev = b_gnum[0];
+        b_gnum[0] = current_gnum;
+
+        for (cs_lnum_t i = 1; i < b_size; i++) {
+          num_cur = b_gnum[i];
+          if (num_cur > num_prev)
+            current_gnum += 1;
+          b_gnum[i] = current_gnum;
+          num_prev = num_cur;
+        }
 
-      for (cs_lnum_t i = 1; i < b_size; i++) {
-        num_cur = b_gnum[b_order[i]];
-        if (num_cur > num_prev)
-          current_gnum += b_nsub[b_order[i]];
-        b_gnum[b_order[i]] = current_gnum;
-        num_prev = num_cur;
       }
 
     }
-    else { /* if (have_sub_glob == 0) */
+    else { /* General case: sort the block's data */
 
-      current_gnum = 1;
-      num_prev = b_gnum[b_order[0]];
-      b_gnum[b_order[0]] = current_gnum;
+      cs_lnum_t *b_order;
+
+      BFT_MALLOC(b_order, b_size, cs_lnum_t);
+
+      cs_order_gnum_allocated(NULL,
+                              b_gnum,
+                              b_order,
+                              b_size);
+
+      if (have_sub_glob > 0) {
+
+        current_gnum = b_nsub[b_order[0]];
+        num_prev = b_gnum[b_order[0]];
+        b_gnum[b_order[0]] = current_gnum;
+
+        for (cs_lnum_t i = 1; i < b_size; i++) {
+          num_cur = b_gnum[b_order[i]];
+          if (num_cur > num_prev)
+            current_gnum += b_nsub[b_order[i]];
+          b_gnum[b_order[i]] = current_gnum;
+          num_prev = num_cur;
+        }
 
-      for (cs_lnum_t i = 1; i < b_size; i++) {
-        num_cur = b_gnum[b_order[i]];
-        if (num_cur > num_prev)
-          current_gnum += 1;
-        b_gnum[b_order[i]] = current_gnum;
-        num_prev = num_cur;
       }
+      else { /* if (have_sub_glob == 0) */
+
+        current_gnum = 1;
+        num_prev = b_gnum[b_order[0]];
+        b_gnum[b_order[0]] = current_gnum;
+
+        for (cs_lnum_t i = 1; i < b_size; i++) {
+          num_cur = b_gnum[b_order[i]];
+          if (num_cur > num_prev)
+            current_gnum += 1;
+          b_gnum[b_order[i]] = current_gnum;
+          num_prev = num_cur;
+        }
 
-    }
+      }
 
-    BFT_FREE(b_order);
+      BFT_FREE(b_order);
+
+    }
 
   }
 
@@ -904,42 +980,69 @@ _fvm_io_num_global_order_s(fvm_io_num_t       *this_io_num,
 
   if (b_size > 0) {
 
-    cs_lnum_t *b_order = NULL;
-
     BFT_MALLOC(r_gnum, b_size, cs_gnum_t);
-    BFT_MALLOC(b_order, b_size, cs_lnum_t);
 
-    cs_order_gnum_allocated_s(NULL,
-                              b_gnum,
-                              stride,
-                              b_order,
-                              b_size);
+    const cs_lnum_t _stride = stride;
 
     /* We build an initial global order based on the initial global numbering,
        such that for each block, the global number of an entity is equal to
        the cumulative number of sub-entities */
 
-    current_gnum = 1;
-    cs_lnum_t prev_id = b_order[0];
-    r_gnum[b_order[0]] = current_gnum;
+    if (_is_ordered_gnum_s(b_gnum, stride, b_size)) {
 
-    const cs_lnum_t _stride = stride;
+      /* If the block's data is already ordered, which is the common
+         case when the parent numbering is itself based on a previous
+         ordering, the sort may be skipped */
+
+      current_gnum = 1;
+      r_gnum[0] = current_gnum;
 
-    for (cs_lnum_t i = 1; i < b_size; i++) {
-      bool greater_than_prev = false;
-      cs_lnum_t cur_id = b_order[i];
-      for (cs_lnum_t j = 0; j < _stride; j++) {
-        if (  b_gnum[cur_id*_stride + j]
-            > b_gnum[prev_id*_stride + j])
-          greater_than_prev = true;
+      for (cs_lnum_t i = 1; i < b_size; i++) {
+        bool greater_than_prev = false;
+        for (cs_lnum_t j = 0; j < _stride; j++) {
+          if (  b_gnum[i*_stride + j]
+              > b_gnum[(i-1)*_stride + j])
+            greater_than_prev = true;
+        }
+        if (greater_than_prev)
+          current_gnum += 1;
+        r_gnum[i] = current_gnum;
       }
-      if (greater_than_prev)
-        current_gnum += 1;
-      r_gnum[b_order[i]] = current_gnum;
-      prev_id = cur_id;
+
     }
+    else { /* General case: sort the block's data */
 
-    BFT_FREE(b_order);
+      cs_lnum_t *b_order = NULL;
+
+      BFT_MALLOC(b_order, b_size, cs_lnum_t);
+
+      cs_order_gnum_allocated_s(NULL,
+                                b_gnum,
+                                stride,
+                                b_order,
+                                b_size);
+
+      current_gnum = 1;
+      cs_lnum_t prev_id = b_order[0];
+      r_gnum[b_order[0]] = current_gnum;
+
+      for (cs_lnum_t i = 1; i < b_size; i++) {
+        bool greater_than_prev = false;
+        cs_lnum_t cur_id = b_order[i];
+        for (cs_lnum_t j = 0; j < _stride; j++) {
+          if (  b_gnum[cur_id*_stride + j]
+              > b_gnum[prev_id*_stride + j])
+            greater_than_prev = true;
+        }
+        if (greater_than_prev)
+          current_gnum += 1;
+        r_gnum[b_order[i]] = current_gnum;
+        prev_id = cur_id;
+      }
+
+      BFT_FREE(b_order);
+
+    }
 
   }
 
@@ -2678,6 +2678,175 @@ _polygons_section_locate_3d(const fvm_nodal_section_t   *this_section,
   state = fvm_triangulate_state_destroy(state);
 }
 
+/*----------------------------------------------------------------------------
+ * Find elements in a range of a strided section containing 3d points:
+ * updates the location[] and distance[] arrays associated with a set of
+ * points for points that are in an element of this section, or closer to one
+ * than to previously encountered elements.
+ *
+ * This function may be called by multiple threads over disjoint element
+ * ranges, provided each thread works on private copies of the location
+ * and distance arrays and of the query buffer.
+ *
+ * parameters:
+ *   this_section      <-- pointer to mesh section representation structure
+ *   parent_vertex_id  <-- pointer to parent vertex ids (or NULL)
+ *   vertex_coords     <-- pointer to vertex coordinates
+ *   tolerance         <-- addition to local extents of each element:
+ *                         extent =   base_extent * (1 + tolerance[1])
+ *                                  + tolerance[0]
+ *   base_element_num  <-- < 0 for location relative to parent element numbers,
+ *                         number of elements in preceding sections of same
+ *                         element dimension + 1 otherwise
+ *   point_tag         <-- optional point tag (size: n_points)
+ *   point_coords      <-- point coordinates
+ *   octree            <-- point octree
+ *   elt_s_id          <-- starting element id in section
+ *   elt_e_id          <-- past-the-end element id in section
+ *   points_in_extents <-- array for query of ids of points in extents
+ *                         (size: octree->n_points, less usually needed)
+ *   location          <-> number of element containing or closest to each
+ *                         point (size: n_points)
+ *   distance          <-> distance from point to element indicated by
+ *                         location[]: < 0 if unlocated; 0 - 1 if inside,
+ *                         and > 1 if outside a volume element, or absolute
+ *                         distance to a surface element (size: n_points)
+ *----------------------------------------------------------------------------*/
+
+static void
+_strided_section_locate_3d(const fvm_nodal_section_t  *this_section,
+                           const cs_lnum_t            *parent_vertex_id,
+                           const cs_coord_t            vertex_coords[],
+                           const double                tolerance[2],
+                           cs_lnum_t                   base_element_num,
+                           const int                  *point_tag,
+                           const cs_coord_t            point_coords[],
+                           _octree_t                  *octree,
+                           cs_lnum_t                   elt_s_id,
+                           cs_lnum_t                   elt_e_id,
+                           cs_lnum_t                   points_in_extents[],
+                           cs_lnum_t                   location[],
+                           float                       distance[])
+{
+  cs_lnum_t   i, j, vertex_id, elt_num, triangle_vertices[6];
+  int n_triangles;
+  double elt_extents[6];
+
+  cs_lnum_t n_points_in_extents = 0;
+
+  for (i = elt_s_id; i < elt_e_id; i++) {
+
+    bool elt_initialized = false;
+
+    if (base_element_num < 0) {
+      if (this_section->parent_element_id != NULL)
+        elt_num = this_section->parent_element_id[i] + 1;
+      else
+        elt_num = i + 1;
+    }
+    else
+      elt_num = base_element_num + i;
+
+    for (j = 0; j < this_section->stride; j++) {
+
+      vertex_id = this_section->vertex_num[i*this_section->stride + j] - 1;
+
+      _update_elt_extents(3,
+                          vertex_id,
+                          parent_vertex_id,
+                          vertex_coords,
+                          elt_extents,
+                          &elt_initialized);
+
+    }
+
+    _elt_extents_finalize(3,
+                          this_section->entity_dim,
+                          tolerance,
+                          elt_extents);
+
+    _query_octree(elt_extents,
+                  point_coords,
+                  octree,
+                  &n_points_in_extents,
+                  points_in_extents);
+
+    if (this_section->tag != NULL && point_tag != NULL)
+      _ignore_same_tag(this_section->tag[i],
+                       point_tag,
+                       &n_points_in_extents,
+                       points_in_extents);
+
+    if (this_section->entity_dim == 3)
+
+      _locate_in_cell_3d(elt_num,
+                         this_section->type,
+                         this_section->vertex_num + i*this_section->stride,
+                         parent_vertex_id,
+                         vertex_coords,
+                         point_coords,
+                         n_points_in_extents,
+                         points_in_extents,
+                         tolerance[1],
+                         location,
+                         distance);
+
+    else if (this_section->entity_dim == 2) {
+
+      if (this_section->type == FVM_FACE_QUAD)
+
+        n_triangles = fvm_triangulate_quadrangle(3,
+                                                 1,
+                                                 vertex_coords,
+                                                 parent_vertex_id,
+                                                 (  this_section->vertex_num
+                                                  + i*this_section->stride),
+                                                 triangle_vertices);
+
+      else {
+
+        assert(this_section->type == FVM_FACE_TRIA);
+
+        n_triangles = 1;
+        for (j = 0; j < 3; j++)
+          triangle_vertices[j]
+            = this_section->vertex_num[i*this_section->stride + j];
+
+
+      }
+
+      _locate_on_triangles_3d(elt_num,
+                              n_triangles,
+                              triangle_vertices,
+                              parent_vertex_id,
+                              vertex_coords,
+                              point_coords,
+                              n_points_in_extents,
+                              points_in_extents,
+                              tolerance[1],
+                              location,
+                              distance);
+    }
+
+    else if (this_section->entity_dim == 1) {
+
+      assert(this_section->type == FVM_EDGE);
+
+      _locate_on_edge_3d(elt_num,
+                         this_section->vertex_num + i*this_section->stride,
+                         parent_vertex_id,
+                         vertex_coords,
+                         point_coords,
+                         n_points_in_extents,
+                         points_in_extents,
+                         tolerance[1],
+                         location,
+                         distance);
+
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Find elements in a given section containing 3d points: updates the
  * location[] and distance[] arrays associated with a set of points
@@ -2720,12 +2889,6 @@ _nodal_section_locate_3d(const fvm_nodal_section_t  *this_section,
                          cs_lnum_t                   location[],
                          float                       distance[])
 {
-  cs_lnum_t   i, j, vertex_id, elt_num, triangle_vertices[6];
-  int n_triangles;
-  double elt_extents[6];
-
-  cs_lnum_t n_points_in_extents = 0;
-
   /* If section contains polyhedra */
 
   if (this_section->type == FVM_CELL_POLY)
@@ -2762,118 +2925,100 @@ _nodal_section_locate_3d(const fvm_nodal_section_t  *this_section,
 
   else {
 
-    for (i = 0; i < this_section->n_elements; i++) {
+    const cs_lnum_t n_elements = this_section->n_elements;
+    const cs_lnum_t n_points = octree->n_points;
 
-      bool elt_initialized = false;
+    int n_loc_threads = 1;
 
-      if (base_element_num < 0) {
-        if (this_section->parent_element_id != NULL)
-          elt_num = this_section->parent_element_id[i] + 1;
-        else
-          elt_num = i + 1;
-      }
-      else
-        elt_num = base_element_num + i;
+#if defined(HAVE_OPENMP)
+    if (n_elements > CS_THR_MIN && n_points > 0)
+      n_loc_threads = cs_glob_n_threads;
+#endif
 
-      for (j = 0; j < this_section->stride; j++) {
+    if (n_loc_threads > 1) {
 
-        vertex_id = this_section->vertex_num[i*this_section->stride + j] - 1;
+      /* Each thread handles a separate range of elements, with private
+         copies of the location, distance, and query buffers; as element
+         updates use a strictly-smaller-distance criterion and per-thread
+         ranges are in ascending element order, merging thread results
+         in thread order reproduces the serial result exactly. */
 
-        _update_elt_extents(3,
-                            vertex_id,
-                            parent_vertex_id,
-                            vertex_coords,
-                            elt_extents,
-                            &elt_initialized);
+      cs_lnum_t *location_t, *pie_t;
+      float *distance_t;
 
-      }
+      BFT_MALLOC(location_t, (size_t)n_points*n_loc_threads, cs_lnum_t);
+      BFT_MALLOC(distance_t, (size_t)n_points*n_loc_threads, float);
+      BFT_MALLOC(pie_t, (size_t)n_points*n_loc_threads, cs_lnum_t);
 
-      _elt_extents_finalize(3,
-                            this_section->entity_dim,
-                            tolerance,
-                            elt_extents);
+      const cs_lnum_t b_size = (n_elements + n_loc_threads - 1)/n_loc_threads;
 
-      _query_octree(elt_extents,
-                    point_coords,
-                    octree,
-                    &n_points_in_extents,
-                    points_in_extents);
-
-      if (this_section->tag != NULL && point_tag != NULL)
-        _ignore_same_tag(this_section->tag[i],
-                         point_tag,
-                         &n_points_in_extents,
-                         points_in_extents);
+#     pragma omp parallel for num_threads(n_loc_threads) schedule(static, 1)
+      for (int t_id = 0; t_id < n_loc_threads; t_id++) {
 
-      if (this_section->entity_dim == 3)
-
-        _locate_in_cell_3d(elt_num,
-                           this_section->type,
-                           this_section->vertex_num + i*this_section->stride,
-                           parent_vertex_id,
-                           vertex_coords,
-                           point_coords,
-                           n_points_in_extents,
-                           points_in_extents,
-                           tolerance[1],
-                           location,
-                           distance);
+        cs_lnum_t *t_location = location_t + (size_t)t_id*n_points;
+        float *t_distance = distance_t + (size_t)t_id*n_points;
 
-      else if (this_section->entity_dim == 2) {
+        memcpy(t_location, location, sizeof(cs_lnum_t)*n_points);
+        memcpy(t_distance, distance, sizeof(float)*n_points);
 
-        if (this_section->type == FVM_FACE_QUAD)
+        const cs_lnum_t elt_s_id = b_size*t_id;
+        const cs_lnum_t elt_e_id = CS_MIN(elt_s_id + b_size, n_elements);
 
-          n_triangles = fvm_triangulate_quadrangle(3,
-                                                   1,
-                                                   vertex_coords,
-                                                   parent_vertex_id,
-                                                   (  this_section->vertex_num
-                                                    + i*this_section->stride),
-                                                   triangle_vertices);
+        _strided_section_locate_3d(this_section,
+                                   parent_vertex_id,
+                                   vertex_coords,
+                                   tolerance,
+                                   base_element_num,
+                                   point_tag,
+                                   point_coords,
+                                   octree,
+                                   elt_s_id,
+                                   elt_e_id,
+                                   pie_t + (size_t)t_id*n_points,
+                                   t_location,
+                                   t_distance);
 
-        else {
+      }
 
-          assert(this_section->type == FVM_FACE_TRIA);
+      /* Merge thread results */
 
-          n_triangles = 1;
-          for (j = 0; j < 3; j++)
-            triangle_vertices[j]
-              = this_section->vertex_num[i*this_section->stride + j];
+      for (int t_id = 0; t_id < n_loc_threads; t_id++) {
 
+        const cs_lnum_t *t_location = location_t + (size_t)t_id*n_points;
+        const float *t_distance = distance_t + (size_t)t_id*n_points;
 
+#       pragma omp parallel for if (n_points > CS_THR_MIN)
+        for (cs_lnum_t j = 0; j < n_points; j++) {
+          if (   t_distance[j] >= 0
+              && (t_distance[j] < distance[j] || distance[j] < 0)) {
+            location[j] = t_location[j];
+            distance[j] = t_distance[j];
+          }
         }
 
-        _locate_on_triangles_3d(elt_num,
-                                n_triangles,
-                                triangle_vertices,
-                                parent_vertex_id,
-                                vertex_coords,
-                                point_coords,
-                                n_points_in_extents,
-                                points_in_extents,
-                                tolerance[1],
-                                location,
-                                distance);
       }
 
-      else if (this_section->entity_dim == 1) {
-
-        assert(this_section->type == FVM_EDGE);
-
-        _locate_on_edge_3d(elt_num,
-                           this_section->vertex_num + i*this_section->stride,
-                           parent_vertex_id,
-                           vertex_coords,
-                           point_coords,
-                           n_points_in_extents,
-                           points_in_extents,
-                           tolerance[1],
-                           location,
-                           distance);
+      BFT_FREE(pie_t);
+      BFT_FREE(distance_t);
+      BFT_FREE(location_t);
 
-      }
     }
 
+    else
+      _strided_section_locate_3d(this_section,
+                                 parent_vertex_id,
+                                 vertex_coords,
+                                 tolerance,
+                                 base_element_num,
+                                 point_tag,
+                                 point_coords,
+                                 octree,
+                                 0,
+                                 n_elements,
+                                 points_in_extents,
+                                 location,
+                                 distance);
+
   }
 }
 
@@ -92,6 +92,12 @@ typedef struct {
                                           for each operation */
   int   **group_class_set;             /* Array of group class lists
                                           for each operation */
+
+  cs_lnum_t  *n_cached_elements;       /* Number of cached selected elements
+                                          for operations with geometric tests
+                                          (-1 if not evaluated yet) */
+  cs_lnum_t **cached_elements;         /* Cached selected element lists
+                                          (0-based), or NULL */
 } _operation_list_t;
 
 /*----------------------------------------------------------------------------
@@ -507,11 +513,16 @@ _operation_list_allocate(void)
   BFT_MALLOC(ops->n_group_classes, ops->n_max_operations, int);
   BFT_MALLOC(ops->group_class_set, ops->n_max_operations, int *);
 
+  BFT_MALLOC(ops->n_cached_elements, ops->n_max_operations, cs_lnum_t);
+  BFT_MALLOC(ops->cached_elements, ops->n_max_operations, cs_lnum_t *);
+
   for (i = 0; i < ops->n_max_operations; i++) {
     ops->postfix[i] = NULL;
     ops->group_class_set[i] = NULL;
     ops->n_calls[i] = 0;
     ops->n_group_classes[i] = 0;
+    ops->n_cached_elements[i] = -1;
+    ops->cached_elements[i] = NULL;
   }
 
   return ops;
@@ -547,11 +558,16 @@ _operation_list_reallocate(_operation_list_t  *ops)
   BFT_REALLOC(ops->n_group_classes, ops->n_max_operations, int);
   BFT_REALLOC(ops->group_class_set, ops->n_max_operations, int *);
 
+  BFT_REALLOC(ops->n_cached_elements, ops->n_max_operations, cs_lnum_t);
+  BFT_REALLOC(ops->cached_elements, ops->n_max_operations, cs_lnum_t *);
+
   for (i = old_size; i < ops->n_max_operations; i++) {
     ops->postfix[i] = NULL;
     ops->group_class_set[i] = NULL;
     ops->n_calls[i] = 0;
     ops->n_group_classes[i] = 0;
+    ops->n_cached_elements[i] = -1;
+    ops->cached_elements[i] = NULL;
   }
 }
 
@@ -578,9 +594,13 @@ _operation_list_free(_operation_list_t  *ops)
         BFT_FREE(ops->group_class_set[i]);
       if (ops->postfix[i] != NULL)
         fvm_selector_postfix_destroy(ops->postfix + i);
+      if (ops->cached_elements[i] != NULL)
+        BFT_FREE(ops->cached_elements[i]);
     }
     BFT_FREE(ops->postfix);
     BFT_FREE(ops->group_class_set);
+    BFT_FREE(ops->n_cached_elements);
+    BFT_FREE(ops->cached_elements);
     BFT_FREE(ops);
   }
 
@@ -981,8 +1001,23 @@ fvm_selector_get_list(fvm_selector_t  *this_selector,
 
   }
 
-  /* Case with geometrical test:
-     evaluation of the postfix expression for each element */
+  /* Case with geometrical test: reuse the memoized element list if this
+     criteria has already been evaluated (the selector, owned by the mesh,
+     is rebuilt upon mesh modification, so cached lists cannot go stale) */
+
+  else if (ts->_operations->n_cached_elements[c_id] > -1) {
+
+    const cs_lnum_t n = ts->_operations->n_cached_elements[c_id];
+    const cs_lnum_t *cached = ts->_operations->cached_elements[c_id];
+
+    for (i = 0; i < n; i++)
+      selected_elements[i] = cached[i] + elt_id_base;
+
+    *n_selected_elements = n;
+
+  }
+
+  /* Otherwise, evaluation of the postfix expression for each element */
 
   else if (ts->n_elements > 0) {
 
@@ -1030,6 +1065,17 @@ fvm_selector_get_list(fvm_selector_t  *this_selector,
         selected_elements[(*n_selected_elements)++] = i + elt_id_base;
 
     }
+
+    /* Memoize the selected list (0-based) for subsequent calls */
+
+    BFT_MALLOC(ts->_operations->cached_elements[c_id],
+               *n_selected_elements,
+               cs_lnum_t);
+    for (i = 0; i < *n_selected_elements; i++)
+      ts->_operations->cached_elements[c_id][i]
+        = selected_elements[i] - elt_id_base;
+    ts->_operations->n_cached_elements[c_id] = *n_selected_elements;
+
   }
 
   ts->n_evals += 1;
@@ -862,17 +862,16 @@ _tesselate_polygons(fvm_tesselation_t  *this_tesselation,
                     cs_lnum_t          *error_count)
 {
   int type_id;
-  cs_lnum_t n_vertices, n_triangles, n_quads, n_elements;
+  cs_lnum_t n_vertices, n_elements;
   cs_lnum_t n_vertices_max, n_triangles_max;
-  cs_lnum_t i, j, k, vertex_id, encoding_id;
-  fvm_tesselation_encoding_t encoding_sub[3];
+  cs_lnum_t i;
 
   cs_gnum_t n_g_elements_tot[2] = {0, 0}; /* Global new elements count */
   cs_lnum_t n_elements_tot[2] = {0, 0}; /* New triangles/quadrangles */
   cs_lnum_t n_g_elements_max[2] = {0, 0}; /* Global max triangles/quadrangles */
   cs_lnum_t n_elements_max[2] = {0, 0}; /* Max triangles/quadrangles */
   cs_lnum_t *triangle_vertices = NULL;
-  fvm_triangulate_state_t *state = NULL;
+  fvm_triangulate_state_t **state = NULL;
 
   fvm_tesselation_t *ts = this_tesselation;
 
@@ -922,118 +921,164 @@ _tesselate_polygons(fvm_tesselation_t  *this_tesselation,
   if (ts->_encoding != NULL)
     BFT_FREE(ts->_encoding);
 
-  /* Allocate memory and state variables */
-  /*-------------------------------------*/
+  /* Allocate memory and state variables; triangulation scratch and state
+     are pooled per thread, and reused across all elements of the thread's
+     range rather than reallocated */
+  /*--------------------------------------------------------------------*/
+
+  int n_loc_threads = 1;
+
+#if defined(HAVE_OPENMP)
+  if (n_elements > CS_THR_MIN)
+    n_loc_threads = cs_glob_n_threads;
+#endif
 
   if (n_vertices_max > 4) {
     BFT_MALLOC(ts->_encoding,
                ts->vertex_index[n_elements] - n_elements*2,
                fvm_tesselation_encoding_t);
     ts->encoding = ts->_encoding;
-    BFT_MALLOC(triangle_vertices, (n_vertices_max - 2) * 3, cs_lnum_t);
-    state = fvm_triangulate_state_create(n_vertices_max);
+    BFT_MALLOC(triangle_vertices,
+               (size_t)(n_vertices_max - 2)*3*n_loc_threads,
+               cs_lnum_t);
+    BFT_MALLOC(state, n_loc_threads, fvm_triangulate_state_t *);
+    for (int t_id = 0; t_id < n_loc_threads; t_id++)
+      state[t_id] = fvm_triangulate_state_create(n_vertices_max);
   }
 
   n_elements_tot[0] = 0; n_elements_tot[1] = 0; /* reset */
 
-  /* Main loop on section face elements */
-  /*------------------------------------*/
+  /* Main loop on section face elements; each thread handles a contiguous
+     range of elements, whose encoding ranges are disjoint */
+  /*--------------------------------------------------------------------*/
 
-  for (i = 0 ; i < n_elements ; i++) {
+  cs_lnum_t n_tria_tot = 0, n_quad_tot = 0;
+  cs_lnum_t n_tria_max = 0, n_quad_max = 0;
+  cs_lnum_t n_errors = 0;
 
-    n_triangles = 0;
-    n_quads = 0;
-    n_vertices = ts->vertex_index[i+1] - ts->vertex_index[i];
-    vertex_id = ts->vertex_index[i];
+# pragma omp parallel for num_threads(n_loc_threads) schedule(static, 1) \
+    reduction(+: n_tria_tot, n_quad_tot, n_errors)                       \
+    reduction(max: n_tria_max, n_quad_max)
+  for (int t_id = 0; t_id < n_loc_threads; t_id++) {
 
-    /* We calculate the encoding index base from the polygon's
-       connectivity index base, knowing that for a polygon
-       with n vertices, we have at most n-2 triangles
-       (exactly n-2 when no error occurs) */
+    cs_lnum_t s_id = ((cs_lnum_t)t_id * n_elements) / n_loc_threads;
+    cs_lnum_t e_id = ((cs_lnum_t)(t_id+1) * n_elements) / n_loc_threads;
 
-    encoding_id = ts->vertex_index[i] - (i*2);
+    cs_lnum_t *triangle_vertices_t = NULL;
+    fvm_triangulate_state_t *state_t = NULL;
 
-    if (n_vertices == 4)
-      type_id = 1;
-    else
-      type_id = 0;
+    if (n_vertices_max > 4) {
+      triangle_vertices_t
+        = triangle_vertices + (size_t)(n_vertices_max - 2)*3*t_id;
+      state_t = state[t_id];
+    }
 
-    /* If face must be subdivided */
+    for (cs_lnum_t e_i = s_id; e_i < e_id; e_i++) {
 
-    if (n_vertices > 4) {
+      cs_lnum_t j, k;
+      fvm_tesselation_encoding_t encoding_sub[3];
 
-      n_triangles = fvm_triangulate_polygon(dim,
-                                            1,
-                                            n_vertices,
-                                            vertex_coords,
-                                            parent_vertex_id,
-                                            (  ts->vertex_num
-                                             + vertex_id),
-                                            FVM_TRIANGULATE_ELT_DEF,
-                                            triangle_vertices,
-                                            state);
+      cs_lnum_t n_triangles = 0;
+      cs_lnum_t n_quads = 0;
+      cs_lnum_t _n_vertices = ts->vertex_index[e_i+1] - ts->vertex_index[e_i];
+      cs_lnum_t vertex_id = ts->vertex_index[e_i];
 
-      if (n_triangles != (n_vertices - 2) && error_count != NULL)
-        *error_count += 1;
+      /* We calculate the encoding index base from the polygon's
+         connectivity index base, knowing that for a polygon
+         with n vertices, we have at most n-2 triangles
+         (exactly n-2 when no error occurs) */
 
-      /* Encode local triangle connectivity */
+      cs_lnum_t encoding_id = ts->vertex_index[e_i] - (e_i*2);
 
-      for (j = 0; j < n_triangles; j++) {
+      /* If face must be subdivided */
 
-        for (k = 0; k < 3; k++)
-          encoding_sub[k]
-            = (   ((fvm_tesselation_encoding_t)(triangle_vertices[j*3 + k] - 1))
-               << (_ENCODING_BITS * k));
+      if (_n_vertices > 4) {
 
-        ts->_encoding[encoding_id + j]
-          = encoding_sub[0] | encoding_sub[1] | encoding_sub[2];
+        n_triangles = fvm_triangulate_polygon(dim,
+                                              1,
+                                              _n_vertices,
+                                              vertex_coords,
+                                              parent_vertex_id,
+                                              (  ts->vertex_num
+                                               + vertex_id),
+                                              FVM_TRIANGULATE_ELT_DEF,
+                                              triangle_vertices_t,
+                                              state_t);
 
-      }
+        if (n_triangles != (_n_vertices - 2))
+          n_errors += 1;
 
-      /* In case of incomplete tesselation due to errors,
-         blank unused encoding values */
+        /* Encode local triangle connectivity */
 
-      for (j = n_triangles; j < (n_vertices - 2); j++)
-        ts->_encoding[encoding_id + j] = 0;
+        for (j = 0; j < n_triangles; j++) {
 
-      n_elements_tot[0] += n_triangles;
+          for (k = 0; k < 3; k++)
+            encoding_sub[k]
+              = (   ((fvm_tesselation_encoding_t)
+                     (triangle_vertices_t[j*3 + k] - 1))
+                 << (_ENCODING_BITS * k));
 
-    }
+          ts->_encoding[encoding_id + j]
+            = encoding_sub[0] | encoding_sub[1] | encoding_sub[2];
 
-    /* Otherwise, tesselation trivial or not necessary for this face */
+        }
 
-    else {
+        /* In case of incomplete tesselation due to errors,
+           blank unused encoding values */
 
-      if (ts->_encoding != NULL) {
-        for (j = 0; j < (n_vertices - 2); j++)
+        for (j = n_triangles; j < (_n_vertices - 2); j++)
           ts->_encoding[encoding_id + j] = 0;
-      }
 
-      if (n_vertices == 4) {
-        n_elements_tot[1] += 1;
-        n_quads = 1;
+        n_tria_tot += n_triangles;
+
       }
 
-      else if (n_vertices == 3) {
-        n_elements_tot[0] += 1;
-        n_triangles = 1;
+      /* Otherwise, tesselation trivial or not necessary for this face */
+
+      else {
+
+        if (ts->_encoding != NULL) {
+          for (j = 0; j < (_n_vertices - 2); j++)
+            ts->_encoding[encoding_id + j] = 0;
+        }
+
+        if (_n_vertices == 4) {
+          n_quad_tot += 1;
+          n_quads = 1;
+        }
+
+        else if (_n_vertices == 3) {
+          n_tria_tot += 1;
+          n_triangles = 1;
+        }
+
       }
 
-    }
+      if (n_triangles > n_tria_max)
+        n_tria_max = n_triangles;
+
+      if (n_quads > n_quad_max)
+        n_quad_max = n_quads;
+
+    } /* End of loop on elements */
 
-    if (n_triangles > n_elements_max[0])
-      n_elements_max[0] = n_triangles;
+  } /* End of loop on threads */
 
-    if (n_quads > n_elements_max[1])
-      n_elements_max[1] = n_triangles;
+  n_elements_tot[0] = n_tria_tot;
+  n_elements_tot[1] = n_quad_tot;
+  n_elements_max[0] = n_tria_max;
+  n_elements_max[1] = n_quad_max;
 
-  } /* End of loop on elements */
+  if (error_count != NULL)
+    *error_count = n_errors;
 
   /* Free memory and state variables */
 
   if (n_vertices_max > 4) {
     BFT_FREE(triangle_vertices);
-    state = fvm_triangulate_state_destroy(state);
+    for (int t_id = 0; t_id < n_loc_threads; t_id++)
+      state[t_id] = fvm_triangulate_state_destroy(state[t_id]);
+    BFT_FREE(state);
   }
 
   /* Update tesselation structure info */
@@ -1076,8 +1121,8 @@ _count_and_index_sub_polygons(fvm_tesselation_t  *this_tesselation,
                               bool                global_count)
 {
   int sub_type_id, type_id;
-  cs_lnum_t n_vertices, n_triangles, n_elements;
-  cs_lnum_t i, j, encoding_id;
+  cs_lnum_t n_elements;
+  cs_lnum_t i;
 
   cs_lnum_t *n_sub_elements[2] = {NULL, NULL};
 
@@ -1125,31 +1170,32 @@ _count_and_index_sub_polygons(fvm_tesselation_t  *this_tesselation,
      Note that each n_sub_elements[] array has been initialized with zeroes,
      as it is mapped to a ts->sub_elt_index[] thus initialized. */
 
-  for (i = 0 ; i < n_elements ; i++) {
+# pragma omp parallel for if (n_elements > CS_THR_MIN)
+  for (cs_lnum_t e_i = 0; e_i < n_elements; e_i++) {
 
-    n_vertices = ts->vertex_index[i+1] - ts->vertex_index[i];
-    n_triangles = 0;
+    cs_lnum_t _n_vertices = ts->vertex_index[e_i+1] - ts->vertex_index[e_i];
+    cs_lnum_t _n_triangles = 0;
 
-    if (n_vertices == 3) {
-      n_sub_elements[0][i] = 1;
-      n_triangles += 1;
+    if (_n_vertices == 3) {
+      n_sub_elements[0][e_i] = 1;
+      _n_triangles += 1;
     }
 
-    else { /* if (n_vertices > 3) */
+    else { /* if (_n_vertices > 3) */
 
-      encoding_id = ts->vertex_index[i] - (i*2);
+      cs_lnum_t _encoding_id = ts->vertex_index[e_i] - (e_i*2);
 
-      for (j = 0; j < (n_vertices - 2); j++) {
+      for (cs_lnum_t j_i = 0; j_i < (_n_vertices - 2); j_i++) {
         if (ts->encoding != NULL) {
-          if (ts->encoding[encoding_id + j] != 0)
-            n_triangles += 1;
+          if (ts->encoding[_encoding_id + j_i] != 0)
+            _n_triangles += 1;
         }
       }
-      if (n_triangles > 0)
-        n_sub_elements[0][i] = n_triangles;
-      else if (n_vertices == 4)
-        n_sub_elements[1][i] = 1;
-      assert(n_triangles > 0 || n_vertices == 4);
+      if (_n_triangles > 0)
+        n_sub_elements[0][e_i] = _n_triangles;
+      else if (_n_vertices == 4)
+        n_sub_elements[1][e_i] = 1;
+      assert(_n_triangles > 0 || _n_vertices == 4);
     }
 
   }
@@ -1207,9 +1253,8 @@ _count_and_index_sub_polyhedra(fvm_tesselation_t  *this_tesselation,
                                bool                global_count)
 {
   int sub_type_id, type_id;
-  cs_lnum_t n_vertices, n_triangles, n_elements;
-  cs_lnum_t n_tetras, n_pyrams;
-  cs_lnum_t i, j, k, face_id, encoding_id;
+  cs_lnum_t n_elements;
+  cs_lnum_t i;
 
   cs_gnum_t n_g_elements_tot[2] = {0, 0}; /* Global new elements count */
   cs_lnum_t n_elements_tot[2] = {0, 0}; /* New tetrahedra/pyramids */
@@ -1265,64 +1310,82 @@ _count_and_index_sub_polyhedra(fvm_tesselation_t  *this_tesselation,
   /* Counting loop on polyhedra elements */
   /*-------------------------------------*/
 
-  for (i = 0 ; i < n_elements ; i++) {
+  cs_lnum_t n_tetras_tot = 0, n_pyrams_tot = 0;
+  cs_lnum_t n_tetras_max = 0, n_pyrams_max = 0;
+  cs_lnum_t n_errors = 0;
 
-    n_tetras = 0;
-    n_pyrams = 0;
+# pragma omp parallel for if (n_elements > CS_THR_MIN)          \
+    reduction(+: n_tetras_tot, n_pyrams_tot, n_errors)          \
+    reduction(max: n_tetras_max, n_pyrams_max)
+  for (cs_lnum_t e_i = 0; e_i < n_elements; e_i++) {
 
-    for (j = ts->face_index[i];     /* Loop on element faces */
-         j < ts->face_index[i+1];
-         j++) {
+    cs_lnum_t n_tetras = 0;
+    cs_lnum_t n_pyrams = 0;
 
-      face_id = CS_ABS(ts->face_num[j]) - 1;
+    for (cs_lnum_t j_i = ts->face_index[e_i];    /* Loop on element faces */
+         j_i < ts->face_index[e_i+1];
+         j_i++) {
 
-      n_vertices = ts->vertex_index[face_id+1] - ts->vertex_index[face_id];
+      cs_lnum_t face_id = CS_ABS(ts->face_num[j_i]) - 1;
+
+      cs_lnum_t _n_vertices
+        = ts->vertex_index[face_id+1] - ts->vertex_index[face_id];
 
-      if (n_vertices == 3)
+      if (_n_vertices == 3)
         n_tetras += 1;
 
-      else { /* if (n_vertices > 3) */
+      else { /* if (_n_vertices > 3) */
 
-        n_triangles = 0;
+        cs_lnum_t _n_triangles = 0;
 
-        encoding_id = ts->vertex_index[face_id] - (face_id*2);
+        cs_lnum_t _encoding_id = ts->vertex_index[face_id] - (face_id*2);
 
-        for (k = encoding_id; k < (encoding_id + n_vertices - 2); k++) {
+        for (cs_lnum_t k_i = _encoding_id;
+             k_i < (_encoding_id + _n_vertices - 2);
+             k_i++) {
           if (ts->encoding != NULL) {
-            if (ts->encoding[k] != 0)
-              n_triangles += 1;
+            if (ts->encoding[k_i] != 0)
+              _n_triangles += 1;
           }
         }
 
-        if (error_count != NULL && n_triangles < n_vertices - 2)
-          *error_count += 1;
+        if (_n_triangles < _n_vertices - 2)
+          n_errors += 1;
 
-        if (n_triangles > 0)
-          n_tetras += n_triangles;
-        else if (n_vertices == 4)
+        if (_n_triangles > 0)
+          n_tetras += _n_triangles;
+        else if (_n_vertices == 4)
           n_pyrams += 1;
 
       }
 
     } /* End of loop on element faces */
 
-    n_elements_tot[0] += n_tetras;
-    n_elements_tot[1] += n_pyrams;
+    n_tetras_tot += n_tetras;
+    n_pyrams_tot += n_pyrams;
 
-    if (n_tetras > n_elements_max[0])
-      n_elements_max[0] = n_tetras;
+    if (n_tetras > n_tetras_max)
+      n_tetras_max = n_tetras;
 
-    if (n_pyrams > n_elements_max[1])
-      n_elements_max[1] = n_pyrams;
+    if (n_pyrams > n_pyrams_max)
+      n_pyrams_max = n_pyrams;
 
     if (n_sub_elements[0] != NULL)
-      n_sub_elements[0][i] = n_tetras;
+      n_sub_elements[0][e_i] = n_tetras;
 
     if (n_sub_elements[1] != NULL)
-      n_sub_elements[1][i] = n_pyrams;
+      n_sub_elements[1][e_i] = n_pyrams;
 
   }  /* End of loop on elements */
 
+  n_elements_tot[0] = n_tetras_tot;
+  n_elements_tot[1] = n_pyrams_tot;
+  n_elements_max[0] = n_tetras_max;
+  n_elements_max[1] = n_pyrams_max;
+
+  if (error_count != NULL)
+    *error_count = n_errors;
+
   /* Update tesselation structure info */
 
   for (type_id = 0; type_id < 2; type_id++) {
@@ -46,6 +46,10 @@
 
 #include <cgnslib.h>
 
+#if defined(HAVE_CGNS_MPI)
+#include <pcgnslib.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -185,6 +189,11 @@ struct _fvm_to_cgns_writer_t {
 
   bool         preserve_precision; /* Preserve double precison variable type */
 
+  bool         parallel_io;        /* Use parallel (collective) CGNS I/O;
+                                      when set, metadata operations are
+                                      collective, and each rank writes its
+                                      own data block */
+
   int          rank;               /* Rank of current process in communicator */
   int          n_ranks;            /* Number of processes in communicator */
 
@@ -340,6 +349,8 @@ _create_writer(const char             *name,
 
   w->preserve_precision = false;
 
+  w->parallel_io = false;
+
   w->rank = 0;
   w->n_ranks = 1;
 
@@ -357,6 +368,7 @@ _create_writer(const char             *name,
     w->discard_polyhedra = reference->discard_polyhedra;
     w->divide_polyhedra = reference->divide_polyhedra;
     w->preserve_precision = reference->preserve_precision;
+    w->parallel_io = reference->parallel_io;
     w->rank = reference->rank;
     w->n_ranks = reference->n_ranks;
 #if defined(HAVE_MPI)
@@ -401,6 +413,31 @@ _open_file(fvm_to_cgns_writer_t   *writer)
 
   writer->index = -1;
 
+#if defined(HAVE_CGNS_MPI)
+
+  /* Open collectively for parallel I/O */
+
+  if (writer->parallel_io) {
+
+    if (cgp_mpi_comm(writer->comm) != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("cgp_mpi_comm() failed for file \"%s\" : \n%s"),
+                writer->filename, cg_get_error());
+
+    if (cgp_open(writer->filename, CG_MODE_WRITE, &fn) != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("cgp_open() failed to open file \"%s\" : \n%s"),
+                writer->filename, cg_get_error());
+
+    writer->index = fn;
+    writer->is_open = true;
+
+    return;
+
+  }
+
+#endif
+
   if (writer->rank == 0) {
 
     if (cg_open(writer->filename, CG_MODE_WRITE, &fn) != CG_OK)
@@ -432,6 +469,24 @@ _close_file(fvm_to_cgns_writer_t   *writer)
 {
   if (writer->is_open == true) {
 
+#if defined(HAVE_CGNS_MPI)
+
+    if (writer->parallel_io) {
+
+      if (cgp_close(writer->index) != CG_OK)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("cgp_close() failed to close file \"%s\" :\n%s"),
+                  writer->filename, cg_get_error());
+
+      writer->index = -1;
+      writer->is_open = false;
+
+      return;
+
+    }
+
+#endif
+
     if (writer->rank == 0) {
 
       if (cg_close(writer->index) != CG_OK)
@@ -581,7 +636,10 @@ _add_base(fvm_to_cgns_writer_t  *writer,
   writer->bases[i]->n_sols = 0;
   writer->bases[i]->solutions = NULL;
 
-  if (rank == 0) {
+  /* With parallel I/O, metadata operations are collective,
+     so all ranks participate */
+
+  if (rank == 0 || writer->parallel_io) {
     retval = cg_base_write(writer->index,
                            base_name,
                            entity_dim,
@@ -596,7 +654,7 @@ _add_base(fvm_to_cgns_writer_t  *writer,
   }
 
 #if defined(HAVE_MPI)
-  if (writer->n_ranks > 1)
+  if (writer->n_ranks > 1 && writer->parallel_io == false)
     MPI_Bcast(&base_index, 1, MPI_INT, 0, writer->comm);
 #endif
 
@@ -654,7 +712,7 @@ _write_zone_link(fvm_to_cgns_writer_t      *writer,
                  const char                *nodename,
                  const char                *filename)
 {
-  if (writer->rank == 0) {
+  if (writer->rank == 0 || writer->parallel_io) {
 
     /* Simply add link */
 
@@ -756,7 +814,7 @@ _add_solution(fvm_to_cgns_writer_t        *writer,
   strncpy(base->solutions[sol_id]->name, sol_name, sol_length + 1);
   base->solutions[sol_id]->name[sol_length] = '\0';
 
-  if (rank == 0) {
+  if (rank == 0 || writer->parallel_io) {
     retval = cg_sol_write(writer->index,
                           base->index,
                           zone_index,
@@ -777,7 +835,7 @@ _add_solution(fvm_to_cgns_writer_t        *writer,
   }
 
 #if defined(HAVE_MPI)
-  if (writer->n_ranks > 1)
+  if (writer->n_ranks > 1 && writer->parallel_io == false)
     MPI_Bcast(&sol_index, 1, MPI_INT, 0, writer->comm);
 #endif
 
@@ -900,7 +958,7 @@ _add_zone(const fvm_nodal_t           *mesh,
 
   assert(writer != NULL);
 
-  if (writer->rank != 0)
+  if (writer->rank != 0 && writer->parallel_io == false)
     return;
 
   /* Compute global number of vertices in this zone */
@@ -1138,9 +1196,72 @@ _coord_output(const fvm_to_cgns_writer_t  *w,
 
   const int   zone_index = 1; /* We always use zone index = 1 */
 
-  /* Output in parallel case */
+  /* Output using parallel CGNS */
+
+#if defined(HAVE_CGNS_MPI)
+
+  if (w->parallel_io) {
+
+    /* Fixed mesh */
+
+    if (grid_index < 2) {
+
+      /* Node creation is collective */
+
+      int retval = cgp_coord_write(w->index,
+                                   base->index,
+                                   zone_index,
+                                   cgns_datatype,
+                                   coord_name,
+                                   &coord_index);
+
+      if (retval != CG_OK)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("%s() failed to write coords:\n"
+                    "Associated writer: \"%s\"\n"
+                    "Associated base: \"%s\"\n"
+                    "CGNS error:%s"),
+                  "cgp_coord_write",
+                  w->name, base->name, cg_get_error());
+
+      /* Each rank then writes its own block, which may be empty */
+
+      cgsize_t range_min = block_start;
+      cgsize_t range_max = block_end - 1;
+
+      retval = cgp_coord_write_data(w->index,
+                                    base->index,
+                                    zone_index,
+                                    coord_index,
+                                    &range_min,
+                                    &range_max,
+                                    (block_end > block_start) ? buffer : NULL);
+
+      if (retval != CG_OK)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("%s() failed to write coords:\n"
+                    "Associated writer: \"%s\"\n"
+                    "Associated base: \"%s\"\n"
+                    "CGNS error:%s"),
+                  "cgp_coord_write_data",
+                  w->name, base->name, cg_get_error());
+
+    }
+
+    /* Deforming mesh */
+
+    else {
+
+      /* TODO */
+
+    }
+
+    return;
+  }
+
+#endif /* defined(HAVE_CGNS_MPI) */
 
-  /* TODO: add variant for parallel CGNS */
+  /* Output in parallel case, non-parallel IO */
 
 #if defined(HAVE_MPI)
 
@@ -1276,18 +1397,51 @@ _bcs_output(void           *context,
 
   const fvm_to_cgns_writer_t  *w = c->writer;
 
+  const fvm_group_class_set_t   *gc_set = c->mesh->gc_set;
+
+  if (gc_set == NULL)
+    return;
+
+  int *bcast_gc_id = NULL;
+
   /* Array should be gathered to rank 0 due to CGNS API limitation
      when using serial CGNS API */
 
-  if (w->rank > 0) {
+#if defined(HAVE_CGNS_MPI)
+
+  /* With parallel I/O, boundary condition (metadata) writes must be
+     collective with identical arguments, so broadcast the gathered
+     group class ids to all ranks. */
+
+  if (w->parallel_io) {
+
+    cs_gnum_t n_g_elts = block_end - block_start;
+    MPI_Bcast(&n_g_elts, 1, CS_MPI_GNUM, 0, w->comm);
+
+    if (w->rank > 0) {
+      assert(block_start >= block_end);
+      BFT_MALLOC(bcast_gc_id, n_g_elts, int);
+      buffer = bcast_gc_id;
+      block_start = 1;
+      block_end = n_g_elts + 1;
+    }
+
+    MPI_Bcast(buffer, n_g_elts, MPI_INT, 0, w->comm);
+
+  }
+  else if (w->rank > 0) {
     assert(block_start >= block_end);
     return;
   }
 
-  const fvm_group_class_set_t   *gc_set = c->mesh->gc_set;
+#else
 
-  if (gc_set == NULL)
+  if (w->rank > 0) {
+    assert(block_start >= block_end);
     return;
+  }
+
+#endif
 
   cgsize_t    n_elts = block_end - block_start;
   int        *f_gc_id = buffer;
@@ -1527,6 +1681,8 @@ _bcs_output(void           *context,
   BFT_FREE(g_idx);
   BFT_FREE(g_elts);
 
+  BFT_FREE(bcast_gc_id);
+
   cs_map_name_to_id_destroy(&group_names);
 }
 
@@ -1588,9 +1744,62 @@ _field_output(void           *context,
     assert(0);
   }
 
-  /* Output in parallel case */
+  /* Output using parallel CGNS */
+
+#if defined(HAVE_CGNS_MPI)
+
+  if (w->parallel_io) {
+
+    /* Node creation is collective */
+
+    int retval = cgp_field_write(w->index,
+                                 c->base->index,
+                                 zone_index,
+                                 c->solution_index,
+                                 cgns_datatype,
+                                 field_c_label,
+                                 &field_index);
+
+    if (retval != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s() failed to write "
+                  "field values:\n\"%s\"\n"
+                  "Associated writer: \"%s\"\n"
+                  "Associated base: \"%s\"\n%s"),
+                "cgp_field_write",
+                field_c_label, w->name, c->base->name,
+                cg_get_error());
+
+    /* Each rank then writes its own block, which may be empty */
+
+    cgsize_t range_min = block_start;
+    cgsize_t range_max = block_end - 1;
+
+    retval = cgp_field_write_data(w->index,
+                                  c->base->index,
+                                  zone_index,
+                                  c->solution_index,
+                                  field_index,
+                                  &range_min,
+                                  &range_max,
+                                  (block_end > block_start) ? buffer : NULL);
+
+    if (retval != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s() failed to write "
+                  "field values:\n\"%s\"\n"
+                  "Associated writer: \"%s\"\n"
+                  "Associated base: \"%s\"\n%s"),
+                "cgp_field_write_data",
+                field_c_label, w->name, c->base->name,
+                cg_get_error());
+
+    return;
+  }
+
+#endif /* defined(HAVE_CGNS_MPI) */
 
-  /* TODO: add variant for parallel CGNS */
+  /* Output in parallel case, non-parallel IO */
 
 #if defined(HAVE_MPI)
 
@@ -1982,7 +2191,65 @@ _write_block_connect_s_g(const fvm_writer_section_t  *current_section,
 
   _define_section(current_section, section_id, section_name, &cgns_elt_type);
 
-  /* TODO add parallel version of the API */
+#if defined(HAVE_CGNS_MPI)
+
+  if (writer->parallel_io) {
+
+    /* Determine global section size for (collective) section creation */
+
+    cs_gnum_t _block_size = num_end - num_start, n_g_elts = 0;
+    MPI_Allreduce(&_block_size, &n_g_elts, 1, CS_MPI_GNUM, MPI_SUM,
+                  writer->comm);
+
+    cgsize_t  s_start = *global_counter + 1;
+    cgsize_t  s_end   = *global_counter + n_g_elts;
+
+    retval = cgp_section_write(writer->index,
+                               base->index,
+                               zone_index,
+                               section_name,
+                               cgns_elt_type,
+                               s_start,
+                               s_end,
+                               0, /* unsorted boundary elements */
+                               &section_index);
+    if (retval != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("cgp_section_write() failed to write elements:\n"
+                  "Associated writer: \"%s\"\n"
+                  "Associated base: \"%s\"\n"
+                  "Associated section name: \"%s\"\n%s"),
+                writer->name, base->name, section_name, cg_get_error());
+
+    /* Each rank then writes its own block, which may be empty */
+
+    cgsize_t  b_start = *global_counter + num_start;
+    cgsize_t  b_end   = *global_counter + num_end - 1;
+
+    retval = cgp_elements_write_data(writer->index,
+                                     base->index,
+                                     zone_index,
+                                     section_index,
+                                     b_start,
+                                     b_end,
+                                     (num_end > num_start) ?
+                                       block_connect : NULL);
+    if (retval != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("cgp_elements_write_data() failed to write elements:\n"
+                  "Associated writer: \"%s\"\n"
+                  "Associated base: \"%s\"\n"
+                  "Associated section name: \"%s\"\n"
+                  "Associated range: [%llu, %llu]\n%s\n"),
+                writer->name, base->name, section_name,
+                (unsigned long long) b_start,
+                (unsigned long long) b_end,
+                cg_get_error());
+
+    return;
+  }
+
+#endif /* defined(HAVE_CGNS_MPI) */
 
   /* For non-parallel IO, use serializer */
 
@@ -2584,6 +2851,97 @@ _write_block_connect_i_g(const fvm_writer_section_t  *current_section,
 
   _define_section(current_section, section_id, section_name, &cgns_elt_type);
 
+#if defined(HAVE_CGNS_MPI) && (CGNS_VERSION >= 4200)
+
+  if (writer->parallel_io) {
+
+    cs_lnum_t n_b_elts = num_end - num_start;
+
+    /* Unpack interleaved size/connectivity stream into
+       connectivity and offsets arrays */
+
+    cgsize_t *_connect = NULL, *_offsets = NULL;
+    BFT_MALLOC(_offsets, n_b_elts + 1, cgsize_t);
+    BFT_MALLOC(_connect, block_size - n_b_elts, cgsize_t);
+
+    cs_lnum_t k = 0, l = 0;
+    _offsets[0] = 0;
+    for (cs_lnum_t i = 0; i < n_b_elts; i++) {
+      cs_lnum_t elt_size = block_connect[k++];
+      for (cs_lnum_t j = 0; j < elt_size; j++)
+        _connect[l++] = block_connect[k++];
+      _offsets[i+1] = l;
+    }
+
+    /* Global sizes for (collective) section creation,
+       and shift to global offsets */
+
+    cs_gnum_t counts[2] = {(cs_gnum_t)n_b_elts, (cs_gnum_t)l};
+    cs_gnum_t g_counts[2] = {0, 0};
+    MPI_Allreduce(counts, g_counts, 2, CS_MPI_GNUM, MPI_SUM, writer->comm);
+
+    cs_gnum_t l_size = l, offset_shift = 0;
+    MPI_Exscan(&l_size, &offset_shift, 1, CS_MPI_GNUM, MPI_SUM, writer->comm);
+    if (writer->rank == 0)
+      offset_shift = 0;
+
+    for (cs_lnum_t i = 0; i < n_b_elts + 1; i++)
+      _offsets[i] += offset_shift;
+
+    cgsize_t  s_start = *global_counter + 1;
+    cgsize_t  s_end   = *global_counter + g_counts[0];
+
+    retval = cgp_poly_section_write(writer->index,
+                                    base->index,
+                                    zone_index,
+                                    section_name,
+                                    cgns_elt_type,
+                                    s_start,
+                                    s_end,
+                                    g_counts[1],
+                                    0, /* unsorted boundary elements */
+                                    &section_index);
+    if (retval != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("cgp_poly_section_write() failed to write elements:\n"
+                  "Associated writer: \"%s\"\n"
+                  "Associated base: \"%s\"\n"
+                  "Associated section name: \"%s\"\n%s"),
+                writer->name, base->name, section_name, cg_get_error());
+
+    /* Each rank then writes its own block, which may be empty */
+
+    cgsize_t  b_start = *global_counter + num_start;
+    cgsize_t  b_end   = *global_counter + num_end - 1;
+
+    retval = cgp_poly_elements_write_data(writer->index,
+                                          base->index,
+                                          zone_index,
+                                          section_index,
+                                          b_start,
+                                          b_end,
+                                          (n_b_elts > 0) ? _connect : NULL,
+                                          (n_b_elts > 0) ? _offsets : NULL);
+    if (retval != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("cgp_poly_elements_write_data() failed to write elements:\n"
+                  "Associated writer: \"%s\"\n"
+                  "Associated base: \"%s\"\n"
+                  "Associated section name: \"%s\"\n"
+                  "Associated range: [%llu, %llu]\n%s\n"),
+                writer->name, base->name, section_name,
+                (unsigned long long) b_start,
+                (unsigned long long) b_end,
+                cg_get_error());
+
+    BFT_FREE(_offsets);
+    BFT_FREE(_connect);
+
+    return;
+  }
+
+#endif /* defined(HAVE_CGNS_MPI) && (CGNS_VERSION >= 4200) */
+
   /* For non-parallel IO, use serializer */
 
   {
@@ -3470,6 +3828,7 @@ fvm_to_cgns_version_string(int string_index,
  *   adf                 use ADF file type
  *   hdf5                use HDF5 file type (default if available)
  *   links               split output to separate files using links
+ *   serial_io           force serial IO even when parallel IO is available
  *
  * As CGNS does not handle polyhedral elements in a simple manner,
  * polyhedra are automatically tesselated with tetrahedra and pyramids
@@ -3500,7 +3859,7 @@ fvm_to_cgns_init_writer(const char             *name,
                         fvm_writer_time_dep_t   time_dependency)
 #endif
 {
-  bool force_adf = false, force_hdf5 = false;
+  bool force_adf = false, force_hdf5 = false, force_serial_io = false;
 
   fvm_to_cgns_writer_t  *writer = _create_writer(name,
                                                  NULL,
@@ -3577,6 +3936,10 @@ fvm_to_cgns_init_writer(const char             *name,
                && (strncmp(options + i1, "links", l_opt) == 0))
         use_links = true;
 
+      else if (   (l_opt == 9)
+               && (strncmp(options + i1, "serial_io", l_opt) == 0))
+        force_serial_io = true;
+
       for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
     }
   }
@@ -3594,6 +3957,18 @@ fvm_to_cgns_init_writer(const char             *name,
   if (force_hdf5 == true)
     cg_set_file_type(CG_FILE_HDF5);
 
+  /* Use parallel (collective) IO when available; this requires
+     HDF5-based files, and CGNS 4.2 or above for polygon support */
+
+#if defined(HAVE_CGNS_MPI) && (CGNS_VERSION >= 4200)
+  if (   writer->n_ranks > 1
+      && force_serial_io == false
+      && force_adf == false)
+    writer->parallel_io = true;
+#else
+  CS_UNUSED(force_serial_io);
+#endif
+
   /* Additional writers for linked files */
 
   if (   use_links
@@ -3626,11 +4001,13 @@ fvm_to_cgns_finalize_writer(void  *this_writer_p)
   if (writer->mesh_writer != NULL)
     writer->mesh_writer = fvm_to_cgns_finalize_writer(writer->mesh_writer);
 
-  if (writer->rank == 0 && writer->index > -1) {
+  if (   (writer->rank == 0 || writer->parallel_io)
+      && writer->index > -1) {
 
     if (writer->bases != NULL) {
 
-      /* Create index for time-dependent data */
+      /* Create index for time-dependent data
+         (collective with parallel IO) */
 
       _create_timedependent_data(writer);
 
@@ -4198,10 +4575,12 @@ fvm_to_cgns_export_field(void                   *this_writer_p,
     = writer->bases[base_index - 1]->solutions[sol_index - 1];
   assert(solution->location == cgns_location);
 
-  /* Field_Name adaptation if necessary */
+  /* Field_Name adaptation if necessary
+     (labels are needed on all ranks with parallel IO, as
+     field node creation is then collective) */
   /*-----------------------------------*/
 
-  if (rank == 0) {
+  if (rank == 0 || writer->parallel_io) {
 
     int        i, shift, pos;
     char      *tmp;
@@ -4352,8 +4731,7 @@ fvm_to_cgns_export_field(void                   *this_writer_p,
 
   BFT_FREE(export_list);
 
-  if (rank == 0)
-    BFT_FREE(field_label);
+  BFT_FREE(field_label);
 }
 
 /*----------------------------------------------------------------------------
@@ -108,6 +108,7 @@ fvm_to_cgns_version_string(int string_index,
  *   adf                 use ADF file type
  *   hdf5                use HDF5 file type (default if available)
  *   links               split output to separate files using links
+ *   serial_io           force serial IO even when parallel IO is available
  *
  * As CGNS does not handle polyhedral elements in a simple manner,
  * polyhedra are automatically tesselated with tetrahedra and pyramids
@@ -88,6 +88,10 @@ typedef struct {
   bool         swap_endian;        /* true if binary file endianness must
                                       be changed */
 
+  bool         serial_io;          /* Option to force serialized (rank 0)
+                                      I/O even when parallel I/O is
+                                      available */
+
   bool         discard_polygons;   /* Option to discard polygonal elements */
   bool         discard_polyhedra;  /* Option to discard polyhedral elements */
 
@@ -99,6 +103,8 @@ typedef struct {
 #if defined(HAVE_MPI)
   int          min_rank_step;      /* Minimum rank step */
   int          min_block_size;     /* Minimum block buffer size */
+  bool         own_block_comm;     /* true if block communicator is owned
+                                      by this writer and must be freed */
   MPI_Comm     block_comm;         /* Associated MPI block communicator */
   MPI_Comm     comm;               /* Associated MPI communicator */
 #endif
@@ -187,6 +193,10 @@ _open_ensight_file(const fvm_to_ensight_writer_t  *this_writer,
 
     MPI_Info hints;
     cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+    if (this_writer->serial_io) {
+      method = CS_FILE_STDIO_SERIAL;
+      hints = MPI_INFO_NULL;
+    }
     f.bf = cs_file_open(filename,
                         mode,
                         method,
@@ -2531,6 +2541,7 @@ _export_field_values_el(const fvm_writer_section_t      *export_section,
  *   divide_polygons     tesselate polygons with triangles
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
+ *   serial_io           force serial IO even when parallel IO is available
  *
  * parameters:
  *   name           <-- base output case name.
@@ -2568,6 +2579,7 @@ fvm_to_ensight_init_writer(const char             *name,
 
   this_writer->text_mode = false;
   this_writer->swap_endian = false;
+  this_writer->serial_io = false;
   this_writer->discard_polygons = false;
   this_writer->discard_polyhedra = false;
   this_writer->divide_polygons = false;
@@ -2579,9 +2591,11 @@ fvm_to_ensight_init_writer(const char             *name,
 #if defined(HAVE_MPI)
   {
     int mpi_flag, rank, n_ranks;
+    int w_rank_step = 1;
     MPI_Comm w_block_comm, w_comm;
     this_writer->min_rank_step = 1;
     this_writer->min_block_size = 0;
+    this_writer->own_block_comm = false;
     this_writer->block_comm = MPI_COMM_NULL;
     this_writer->comm = MPI_COMM_NULL;
     MPI_Initialized(&mpi_flag);
@@ -2592,10 +2606,19 @@ fvm_to_ensight_init_writer(const char             *name,
       MPI_Comm_size(this_writer->comm, &n_ranks);
       this_writer->rank = rank;
       this_writer->n_ranks = n_ranks;
-      cs_file_get_default_comm(NULL, &w_block_comm, &w_comm);
-      if (comm == w_comm) {
-        this_writer->min_block_size = min_block_size;
+      cs_file_get_default_comm(&w_rank_step, &w_block_comm, &w_comm);
+      this_writer->min_block_size = min_block_size;
+      this_writer->min_rank_step = w_rank_step;
+      if (comm == w_comm)
         this_writer->block_comm = w_block_comm;
+      else if (n_ranks > 1) {
+        /* Writer on a sub-communicator (such as a co-processing
+           output communicator): build a matching rank-stepped block
+           communicator so collective writes are aggregated the same
+           way as with the default communicator. */
+        this_writer->block_comm = cs_file_block_comm(w_rank_step, comm);
+        if (this_writer->block_comm != MPI_COMM_NULL)
+          this_writer->own_block_comm = true;
       }
       this_writer->comm = comm;
     }
@@ -2644,6 +2667,19 @@ fvm_to_ensight_init_writer(const char             *name,
                && (strncmp(options + i1, "divide_polyhedra", l_opt) == 0))
         this_writer->divide_polyhedra = true;
 
+      else if (   (l_opt == 9)
+               && (strncmp(options + i1, "serial_io", l_opt) == 0)) {
+        this_writer->serial_io = true;
+#if defined(HAVE_MPI)
+        this_writer->min_rank_step = this_writer->n_ranks;
+        if (this_writer->own_block_comm) {
+          MPI_Comm_free(&(this_writer->block_comm));
+          this_writer->own_block_comm = false;
+        }
+        this_writer->block_comm = MPI_COMM_NULL;
+#endif
+      }
+
       for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
 
     }
@@ -2679,6 +2715,11 @@ fvm_to_ensight_finalize_writer(void  *this_writer_p)
 
   fvm_to_ensight_case_destroy(this_writer->case_info);
 
+#if defined(HAVE_MPI)
+  if (this_writer->own_block_comm)
+    MPI_Comm_free(&(this_writer->block_comm));
+#endif
+
   BFT_FREE(this_writer);
 
   return NULL;
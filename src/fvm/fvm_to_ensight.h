@@ -66,6 +66,7 @@ BEGIN_C_DECLS
  *   divide_polygons     tesselate polygons with triangles
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
+ *   serial_io           force serial IO even when parallel IO is available
  *
  * parameters:
  *   name           <-- base output case name.
@@ -39,6 +39,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(HAVE_OPENMP)
+#include <omp.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -368,8 +372,7 @@ _histogram(cs_lnum_t                    n_vals,
            fvm_to_histogram_writer_t   *w,
            char                        *var_name)
 {
-  cs_lnum_t  i;
-  int        j, k;
+  int        j;
 
   cs_real_t  step;
   cs_real_t  max, min, _max, _min;
@@ -392,11 +395,16 @@ _histogram(cs_lnum_t                    n_vals,
 #if defined(HAVE_MPI)
 
   if (w->n_ranks > 1) {
-    MPI_Allreduce(&_min, &min, 1, CS_MPI_REAL, MPI_MIN,
-                  w->comm);
 
-    MPI_Allreduce(&_max, &max, 1, CS_MPI_REAL, MPI_MAX,
+    /* Single reduction for both bounds */
+
+    cs_real_t inv_minmax[2] = {-_min, _max}, g_inv_minmax[2];
+
+    MPI_Allreduce(inv_minmax, g_inv_minmax, 2, CS_MPI_REAL, MPI_MAX,
                   w->comm);
+
+    min = -g_inv_minmax[0];
+    max = g_inv_minmax[1];
   }
 
 #endif
@@ -408,22 +416,62 @@ _histogram(cs_lnum_t                    n_vals,
 
   if (CS_ABS(max - min) > 0.) {
 
-    step = CS_ABS(max - min) / w->n_sub;
+    const int n_sub = w->n_sub;
+
+    step = CS_ABS(max - min) / n_sub;
+
+    const cs_real_t step_mult = n_sub / CS_ABS(max - min);
+
+    /* Loop on values, with per-thread local bins; the subdivision is
+       obtained directly from the value, with a possible adjustment by one
+       position so ties at subdivision bounds are handled exactly as with
+       the previous linear search */
 
-    /* Loop on values */
+    const int n_threads = cs_glob_n_threads;
 
-    for (i = 0; i < n_vals; i++) {
+    cs_gnum_t *t_count = NULL;
+    BFT_MALLOC(t_count, (size_t)n_threads*n_sub, cs_gnum_t);
 
-      /* Associated subdivision */
+    for (j = 0; j < n_threads*n_sub; j++)
+      t_count[j] = 0;
+
+#   pragma omp parallel if(n_vals > CS_THR_MIN)
+    {
+#if defined(HAVE_OPENMP)
+      const int t_id = omp_get_thread_num();
+#else
+      const int t_id = 0;
+#endif
+      cs_gnum_t *l_count = t_count + (size_t)t_id*n_sub;
+
+#     pragma omp for
+      for (cs_lnum_t i = 0; i < n_vals; i++) {
+
+        /* Associated subdivision */
+
+        int l = (int)((var[i] - min)*step_mult);
+        if (l < 0)
+          l = 0;
+        else if (l > n_sub - 1)
+          l = n_sub - 1;
+
+        while (l > 0 && var[i] < min + l*step)
+          l--;
+        while (l < n_sub - 1 && var[i] >= min + (l+1)*step)
+          l++;
+
+        l_count[l] += 1;
 
-      for (j = 0, k = 1; k < w->n_sub; j++, k++) {
-        if (var[i] < min + k*step)
-          break;
       }
-      count[j] += 1;
+    }
 
+    for (int t_id = 0; t_id < n_threads; t_id++) {
+      for (j = 0; j < n_sub; j++)
+        count[j] += t_count[(size_t)t_id*n_sub + j];
     }
 
+    BFT_FREE(t_count);
+
   }
 
   _display_histograms(min, max, count, display_func, w, var_name);
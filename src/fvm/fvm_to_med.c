@@ -148,6 +148,10 @@ typedef struct {
   bool        divide_polygons;    /* Option to tesselate polygonal elements */
   bool        divide_polyhedra;   /* Option to tesselate polyhedral elements */
 
+  bool        keep_open;          /* Option to keep file open between field
+                                     outputs, and close it only when flushing
+                                     (grouping metadata updates) */
+
   int         rank;            /* Rank of current process in communicator */
   int         n_ranks;         /* Number of processes in communicator */
   int         min_rank_step;   /* Minimum rank step for parallel IO */
@@ -4216,6 +4220,8 @@ fvm_to_med_init_writer(const char                   *name,
   writer->divide_polygons = false;
   writer->divide_polyhedra = false;
 
+  writer->keep_open = false;
+
   if (options != NULL) {
 
     int i1, i2, l_opt;
@@ -4251,6 +4257,10 @@ fvm_to_med_init_writer(const char                   *name,
 #endif
       }
 
+      else if (   (l_opt == 9)
+               && (strncmp(options + i1, "keep_open", l_opt) == 0))
+        writer->keep_open = true;
+
       else if (   (l_opt == 6)
                && (strncmp(options + i1, "update", l_opt) == 0))
         writer->allow_update = true;
@@ -4935,10 +4945,32 @@ fvm_to_med_export_field(void                            *this_writer,
 
   BFT_FREE(export_list);
 
-  /* Close MED file (to force its update) */
-  /*--------------------------------------*/
+  /* Close MED file (to force its update), unless consecutive field
+     outputs are grouped, in which case the file is closed when the
+     writer is flushed */
+  /*---------------------------------------------------------------*/
+
+  if (writer->keep_open == false)
+    _med_file_close(writer);
+}
+
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * When field outputs are grouped using the "keep_open" option, this
+ * closes the MED file, committing all pending metadata updates at once.
+ *
+ * parameters:
+ *   this_writer  <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
 
-  _med_file_close(writer);
+void
+fvm_to_med_flush(void  *this_writer)
+{
+  fvm_to_med_writer_t  *writer = (fvm_to_med_writer_t *)this_writer;
+
+  if (writer->is_open == true)
+    _med_file_close(writer);
 }
 
 /*----------------------------------------------------------------------------*/
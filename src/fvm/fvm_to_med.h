@@ -108,6 +108,9 @@ fvm_to_med_version_string(int string_index,
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
  *   serial_io           force serial IO even when parallel IO is available
+ *   keep_open           keep file open between field outputs, closing it
+ *                       only when the writer is flushed; this groups
+ *                       metadata updates when writing many fields
  *
  * parameters:
  *   name           <-- base output case name.
@@ -250,6 +253,19 @@ fvm_to_med_export_field(void                      *const this_writer,
                         const double                     time_value,
                         const void                *const field_values[]);
 
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * When field outputs are grouped using the "keep_open" option, this
+ * closes the MED file, committing all pending metadata updates at once.
+ *
+ * parameters:
+ *   this_writer  <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_med_flush(void  *this_writer);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -48,6 +48,7 @@
 #include "bft_error.h"
 #include "bft_printf.h"
 
+#include "fvm_convert_array.h"
 #include "fvm_nodal.h"
 #include "fvm_nodal_priv.h"
 
@@ -91,6 +92,31 @@ BEGIN_C_DECLS
  * Local Type Definitions
  *============================================================================*/
 
+/* Buffered (deferred) field output; values are snapshotted in interlaced
+   form and local entity order, so that the caller's arrays may be reused
+   immediately, and output is grouped at flush time */
+
+struct _fvm_writer_field_buffer_t {
+
+  struct _fvm_writer_field_buffer_t  *next;  /* Next in pending list */
+
+  void                  *format_writer;  /* Associated format-specific
+                                            writer */
+  const fvm_nodal_t     *mesh;           /* Associated mesh; must not be
+                                            modified or destroyed before
+                                            the next flush */
+  char                  *name;           /* Variable name */
+  fvm_writer_var_loc_t   location;       /* Variable definition location */
+  int                    dimension;      /* Variable dimension */
+  cs_datatype_t          datatype;       /* Datatype of buffered values */
+  int                    time_step;      /* Associated time step */
+  double                 time_value;     /* Associated time value */
+
+  unsigned char         *values;         /* Interlaced values, in local
+                                            entity order */
+
+};
+
 /*============================================================================
  * Local macro definitions
  *============================================================================*/
@@ -156,7 +182,7 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     fvm_to_med_needs_tesselation,      /* needs_tesselation_func */
     fvm_to_med_export_nodal,           /* export_nodal_func */
     fvm_to_med_export_field,           /* export_field_func */
-    NULL                               /* flush_func */
+    fvm_to_med_flush                   /* flush_func */
 #else
     NULL,
     NULL,
@@ -345,7 +371,8 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     (  FVM_WRITER_FORMAT_HAS_POLYGON
      | FVM_WRITER_FORMAT_HAS_POLYHEDRON
      | FVM_WRITER_FORMAT_SEPARATE_MESHES
-     | FVM_WRITER_FORMAT_NAME_IS_OPTIONAL),
+     | FVM_WRITER_FORMAT_NAME_IS_OPTIONAL
+     | FVM_WRITER_FORMAT_LOCAL_FLUSH),
        FVM_WRITER_TRANSIENT_CONNECT,
     0,                                 /* dynamic library count */
     0,                                 /* dynamic library flags */
@@ -370,7 +397,8 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     (  FVM_WRITER_FORMAT_HAS_POLYGON
      | FVM_WRITER_FORMAT_HAS_POLYHEDRON
      | FVM_WRITER_FORMAT_SEPARATE_MESHES
-     | FVM_WRITER_FORMAT_NAME_IS_OPTIONAL),
+     | FVM_WRITER_FORMAT_NAME_IS_OPTIONAL
+     | FVM_WRITER_FORMAT_LOCAL_FLUSH),
     FVM_WRITER_TRANSIENT_CONNECT,
     0,                                 /* dynamic library count */
     0,                                 /* dynamic library flags */
@@ -826,6 +854,210 @@ _find_or_add_format_writer(fvm_writer_t        *this_writer,
   return format_writer;
 }
 
+/*----------------------------------------------------------------------------
+ * Buffer a field for deferred output if possible.
+ *
+ * Values are snapshotted to an interlaced copy in local entity order
+ * (resolving any parent list indirection), so the caller's arrays may be
+ * modified or freed once this function returns.
+ *
+ * parameters:
+ *   this_writer      <-- pointer to mesh and field output writer
+ *   format_writer    <-- format-specific writer associated with the mesh
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- indicates if variable values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   time_step        <-- number of the current time step
+ *   time_value       <-- associated time value
+ *   field_values     <-- array of associated field value arrays
+ *
+ * returns:
+ *   true if the field could be buffered, false if it must be output
+ *   directly
+ *----------------------------------------------------------------------------*/
+
+static bool
+_buffer_field(fvm_writer_t                 *this_writer,
+              void                         *format_writer,
+              const fvm_nodal_t            *mesh,
+              const char                   *name,
+              fvm_writer_var_loc_t          location,
+              int                           dimension,
+              cs_interlace_t                interlace,
+              int                           n_parent_lists,
+              const cs_lnum_t               parent_num_shift[],
+              cs_datatype_t                 datatype,
+              int                           time_step,
+              double                        time_value,
+              const void             *const field_values[])
+{
+  int  ent_dim = 0;
+
+  if (name == NULL)
+    return false;
+
+  /* Only datatypes handled by fvm_convert_array() may be buffered,
+     and integer types may not be multidimensional */
+
+  switch (datatype) {
+  case CS_FLOAT:
+  case CS_DOUBLE:
+    break;
+  case CS_INT32:
+  case CS_INT64:
+  case CS_UINT32:
+  case CS_UINT64:
+    if (dimension > 1)
+      return false;
+    break;
+  default:
+    return false;
+  }
+
+  cs_lnum_t  n_ents = 0;
+
+  if (location == FVM_WRITER_PER_NODE)
+    n_ents = fvm_nodal_get_n_entities(mesh, 0);
+
+  else {
+
+    ent_dim = fvm_nodal_get_max_entity_dim(mesh);
+    n_ents = fvm_nodal_get_n_entities(mesh, ent_dim);
+
+    /* The local entity order is only simple to reproduce when all
+       elements are of the same dimension (always the case for
+       meshes built by the main postprocessing layer) */
+
+    for (int i = 1; i < ent_dim; i++) {
+      if (fvm_nodal_get_n_entities(mesh, i) > 0)
+        return false;
+    }
+
+  }
+
+  int dim = (dimension > 0) ? dimension : 1;
+
+  fvm_writer_field_buffer_t  *b = NULL;
+
+  BFT_MALLOC(b, 1, fvm_writer_field_buffer_t);
+
+  b->next = NULL;
+  b->format_writer = format_writer;
+  b->mesh = mesh;
+  BFT_MALLOC(b->name, strlen(name) + 1, char);
+  strcpy(b->name, name);
+  b->location = location;
+  b->dimension = dimension;
+  b->datatype = datatype;
+  b->time_step = time_step;
+  b->time_value = time_value;
+
+  BFT_MALLOC(b->values,
+             (size_t)n_ents * dim * cs_datatype_size[datatype],
+             unsigned char);
+
+  cs_lnum_t  *parent_id = NULL;
+
+  if (n_parent_lists > 0) {
+    BFT_MALLOC(parent_id, n_ents, cs_lnum_t);
+    fvm_nodal_get_parent_num(mesh, ent_dim, parent_id);
+    for (cs_lnum_t j = 0; j < n_ents; j++)
+      parent_id[j] -= 1;
+  }
+
+  fvm_convert_array(dim,
+                    0,
+                    dim,
+                    0,
+                    n_ents,
+                    interlace,
+                    datatype,
+                    datatype,
+                    n_parent_lists,
+                    parent_num_shift,
+                    parent_id,
+                    field_values,
+                    b->values);
+
+  BFT_FREE(parent_id);
+
+  /* Append to pending list, maintaining output order */
+
+  if (this_writer->buffered_fields == NULL)
+    this_writer->buffered_fields = b;
+  else {
+    fvm_writer_field_buffer_t  *e = this_writer->buffered_fields;
+    while (e->next != NULL)
+      e = e->next;
+    e->next = b;
+  }
+
+  this_writer->n_buffered_fields += 1;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Output and free all buffered fields associated with a writer.
+ *
+ * Buffered values are already in interlaced, local entity order, so no
+ * parent list indirection is needed at this stage.
+ *
+ * Floating-point exception traps should be disabled by the caller when
+ * calling this function.
+ *
+ * parameters:
+ *   this_writer <-- pointer to mesh and field output writer
+ *----------------------------------------------------------------------------*/
+
+static void
+_output_buffered_fields(fvm_writer_t  *this_writer)
+{
+  fvm_writer_export_field_t  *export_field_func
+    = this_writer->format->export_field_func;
+
+  fvm_writer_field_buffer_t  *b = this_writer->buffered_fields;
+
+  while (b != NULL) {
+
+    fvm_writer_field_buffer_t  *next = b->next;
+
+    if (export_field_func != NULL) {
+      cs_lnum_t  parent_num_shift[1] = {0};
+      const void  *var_ptr[1] = {b->values};
+      export_field_func(b->format_writer,
+                        b->mesh,
+                        b->name,
+                        b->location,
+                        b->dimension,
+                        CS_INTERLACE,
+                        0, /* n_parent_lists */
+                        parent_num_shift,
+                        b->datatype,
+                        b->time_step,
+                        b->time_value,
+                        var_ptr);
+    }
+
+    BFT_FREE(b->values);
+    BFT_FREE(b->name);
+    BFT_FREE(b);
+
+    b = next;
+  }
+
+  this_writer->buffered_fields = NULL;
+  this_writer->n_buffered_fields = 0;
+}
+
 /*============================================================================
  * Semi-private function definitions (prototypes in fvm_writer_priv.h)
  *============================================================================*/
@@ -1109,6 +1341,7 @@ fvm_writer_filter_option(char        *format_options,
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
  *   separate_meshes     use a different writer for each mesh
+ *   serial_io           force serial IO even when parallel IO is available
  *
  * parameters:
  *   name            <-- base name of output
@@ -1246,6 +1479,10 @@ fvm_writer_init(const char             *name,
 
   this_writer->mesh_names = NULL;
 
+  this_writer->n_buffered_fields_max = 0;
+  this_writer->n_buffered_fields = 0;
+  this_writer->buffered_fields = NULL;
+
   /* Initialize format-specific writer */
 
   if  (this_writer->n_format_writers > 0) {
@@ -1279,6 +1516,14 @@ fvm_writer_finalize(fvm_writer_t  *this_writer)
   assert(this_writer != NULL);
   assert(this_writer->format != NULL);
 
+  /* Output fields pending deferred output first */
+
+  if (this_writer->n_buffered_fields > 0) {
+    cs_fp_exception_disable_trap();
+    _output_buffered_fields(this_writer);
+    cs_fp_exception_restore_trap();
+  }
+
   BFT_FREE(this_writer->name);
   BFT_FREE(this_writer->path);
   BFT_FREE(this_writer->options);
@@ -1399,6 +1644,86 @@ fvm_writer_get_time_dep(const fvm_writer_t  *this_writer)
   return this_writer->time_dep;
 }
 
+/*----------------------------------------------------------------------------
+ * Set the maximum number of fields buffered for deferred output.
+ *
+ * When this limit is greater than 0, field values passed to
+ * fvm_writer_export_field() are snapshotted (in local entity order) rather
+ * than output immediately, and the actual writes are grouped at the next
+ * call to fvm_writer_flush(); if the limit is reached beforehand, pending
+ * fields are output at that point. A limit of 0 (the default) restores
+ * direct output.
+ *
+ * As buffered outputs reference their associated mesh, the writer must be
+ * flushed before an associated mesh is modified or destroyed.
+ *
+ * parameters:
+ *   this_writer  <-- pointer to mesh and field output writer
+ *   n_fields_max <-- maximum number of buffered fields, or 0 for
+ *                    direct output
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_writer_set_buffered_fields(fvm_writer_t  *this_writer,
+                               int            n_fields_max)
+{
+  assert(this_writer != NULL);
+
+  this_writer->n_buffered_fields_max = n_fields_max;
+
+  if (this_writer->n_buffered_fields > n_fields_max) {
+    cs_fp_exception_disable_trap();
+    _output_buffered_fields(this_writer);
+    cs_fp_exception_restore_trap();
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Return the maximum number of fields buffered for deferred output.
+ *
+ * parameters:
+ *   this_writer <-- pointer to mesh and field output writer
+ *
+ * returns:
+ *   maximum number of buffered fields (0 for direct output)
+ *----------------------------------------------------------------------------*/
+
+int
+fvm_writer_get_buffered_fields(const fvm_writer_t  *this_writer)
+{
+  return this_writer->n_buffered_fields_max;
+}
+
+/*----------------------------------------------------------------------------
+ * Indicate if flushing a writer only involves rank-local operations.
+ *
+ * This is the case for formats flagged as such when the writer has no
+ * pending buffered fields (as deferred field output may involve
+ * communication); such flushes may overlap with those of other writers.
+ *
+ * parameters:
+ *   this_writer <-- pointer to mesh and field output writer
+ *
+ * returns:
+ *   true if flushing this writer involves no communication
+ *----------------------------------------------------------------------------*/
+
+bool
+fvm_writer_flush_is_local(const fvm_writer_t  *this_writer)
+{
+  assert(this_writer != NULL);
+  assert(this_writer->format != NULL);
+
+  if (this_writer->n_buffered_fields > 0)
+    return false;
+
+  if (this_writer->format->flush_func == NULL)
+    return true;
+
+  return (this_writer->format->info_mask & FVM_WRITER_FORMAT_LOCAL_FLUSH)
+    ? true : false;
+}
+
 /*----------------------------------------------------------------------------
  * Associate new time step with a mesh.
  *
@@ -1552,21 +1877,56 @@ fvm_writer_export_field(fvm_writer_t                 *this_writer,
   export_field_func = this_writer->format->export_field_func;
 
   if (export_field_func != NULL) {
-    cs_fp_exception_disable_trap();
-    export_field_func(format_writer,
-                      mesh,
-                      name,
-                      location,
-                      dimension,
-                      interlace,
-                      n_parent_lists,
-                      parent_num_shift,
-                      datatype,
-                      time_step,
-                      time_value,
-                      field_values);
 
-    cs_fp_exception_restore_trap();
+    bool direct = true;
+
+    /* In buffered mode, snapshot values for deferred output when possible,
+       so as to group actual writes at flush time; if the pending limit
+       is reached, output pending fields first (back-pressure) */
+
+    if (this_writer->n_buffered_fields_max > 0) {
+
+      if (   this_writer->n_buffered_fields
+          >= this_writer->n_buffered_fields_max) {
+        cs_fp_exception_disable_trap();
+        _output_buffered_fields(this_writer);
+        cs_fp_exception_restore_trap();
+      }
+
+      direct = ! _buffer_field(this_writer,
+                               format_writer,
+                               mesh,
+                               name,
+                               location,
+                               dimension,
+                               interlace,
+                               n_parent_lists,
+                               parent_num_shift,
+                               datatype,
+                               time_step,
+                               time_value,
+                               field_values);
+
+    }
+
+    if (direct) {
+      cs_fp_exception_disable_trap();
+      export_field_func(format_writer,
+                        mesh,
+                        name,
+                        location,
+                        dimension,
+                        interlace,
+                        n_parent_lists,
+                        parent_num_shift,
+                        datatype,
+                        time_step,
+                        time_value,
+                        field_values);
+
+      cs_fp_exception_restore_trap();
+    }
+
   }
 
   t1 = cs_timer_time();
@@ -1592,7 +1952,7 @@ fvm_writer_flush(fvm_writer_t  *this_writer)
 
   flush_func = this_writer->format->flush_func;
 
-  if (flush_func != NULL) {
+  if (flush_func != NULL || this_writer->n_buffered_fields > 0) {
 
     cs_timer_t  t0, t1;
 
@@ -1600,8 +1960,13 @@ fvm_writer_flush(fvm_writer_t  *this_writer)
 
     cs_fp_exception_disable_trap();
 
-    for (int i = 0; i < this_writer->n_format_writers; i++)
-      flush_func(this_writer->format_writer[i]);
+    if (this_writer->n_buffered_fields > 0)
+      _output_buffered_fields(this_writer);
+
+    if (flush_func != NULL) {
+      for (int i = 0; i < this_writer->n_format_writers; i++)
+        flush_func(this_writer->format_writer[i]);
+    }
 
     cs_fp_exception_restore_trap();
 
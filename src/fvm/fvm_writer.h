@@ -318,6 +318,59 @@ fvm_writer_get_path(const fvm_writer_t  *this_writer);
 fvm_writer_time_dep_t
 fvm_writer_get_time_dep(const fvm_writer_t  *this_writer);
 
+/*----------------------------------------------------------------------------
+ * Set the maximum number of fields buffered for deferred output.
+ *
+ * When this limit is greater than 0, field values passed to
+ * fvm_writer_export_field() are snapshotted (in local entity order) rather
+ * than output immediately, and the actual writes are grouped at the next
+ * call to fvm_writer_flush(); if the limit is reached beforehand, pending
+ * fields are output at that point. A limit of 0 (the default) restores
+ * direct output.
+ *
+ * As buffered outputs reference their associated mesh, the writer must be
+ * flushed before an associated mesh is modified or destroyed.
+ *
+ * parameters:
+ *   this_writer  <-- pointer to mesh and field output writer
+ *   n_fields_max <-- maximum number of buffered fields, or 0 for
+ *                    direct output
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_writer_set_buffered_fields(fvm_writer_t  *this_writer,
+                               int            n_fields_max);
+
+/*----------------------------------------------------------------------------
+ * Return the maximum number of fields buffered for deferred output.
+ *
+ * parameters:
+ *   this_writer <-- pointer to mesh and field output writer
+ *
+ * returns:
+ *   maximum number of buffered fields (0 for direct output)
+ *----------------------------------------------------------------------------*/
+
+int
+fvm_writer_get_buffered_fields(const fvm_writer_t  *this_writer);
+
+/*----------------------------------------------------------------------------
+ * Indicate if flushing a writer only involves rank-local operations.
+ *
+ * This is the case for formats flagged as such when the writer has no
+ * pending buffered fields (as deferred field output may involve
+ * communication); such flushes may overlap with those of other writers.
+ *
+ * parameters:
+ *   this_writer <-- pointer to mesh and field output writer
+ *
+ * returns:
+ *   true if flushing this writer involves no communication
+ *----------------------------------------------------------------------------*/
+
+bool
+fvm_writer_flush_is_local(const fvm_writer_t  *this_writer);
+
 /*----------------------------------------------------------------------------
  * Associate new time step with a mesh.
  *
@@ -61,6 +61,10 @@ BEGIN_C_DECLS
 
 #define FVM_WRITER_FORMAT_NAME_IS_OPTIONAL     (1 << 5)
 
+/* Flushing only involves rank-local operations (no MPI communication),
+   so flushes of such writers may overlap with those of other writers */
+#define FVM_WRITER_FORMAT_LOCAL_FLUSH          (1 << 6)
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -167,6 +171,13 @@ typedef struct {
 
 } fvm_writer_format_t;
 
+/*----------------------------------------------------------------------------
+ * Structure defining a buffered (deferred) field output
+ * (opaque; defined in fvm_writer.c)
+ *----------------------------------------------------------------------------*/
+
+typedef struct _fvm_writer_field_buffer_t  fvm_writer_field_buffer_t;
+
 /*----------------------------------------------------------------------------
  * Structure defining a writer definition
  *----------------------------------------------------------------------------*/
@@ -183,6 +194,13 @@ struct _fvm_writer_t {
   char                  **mesh_names;        /* List of mesh names if one
                                                 writer per mesh is required */
 
+  int                     n_buffered_fields_max;  /* Maximum number of pending
+                                                     buffered field outputs
+                                                     (0: direct output) */
+  int                     n_buffered_fields;      /* Current number of pending
+                                                     buffered field outputs */
+  fvm_writer_field_buffer_t  *buffered_fields;    /* Pending field outputs */
+
   cs_timer_counter_t      mesh_time;         /* Meshes output timer */
   cs_timer_counter_t      field_time;        /* Fields output timer */
   cs_timer_counter_t      flush_time;        /* output "completion" timer */
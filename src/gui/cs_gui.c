@@ -4187,6 +4187,13 @@ cs_gui_physical_properties(void)
 
   cs_vof_parameters_t *vof_param = cs_get_glob_vof_parameters();
 
+  /* Reference values deduced from the thermal table are grouped in a
+     single call, sharing the equation of state evaluation */
+
+  cs_phys_prop_type_t  ref_props[3];
+  cs_real_t           *ref_vals[3];
+  int n_ref_props = 0;
+
   if (_thermal_table_needed("density") == 0) {
     cs_gui_properties_value("density", &phys_pp->ro0);
     if (vof_param->vof_model & CS_VOF_ENABLED) {
@@ -4195,13 +4202,9 @@ cs_gui_physical_properties(void)
     }
   }
   else {
-    cs_phys_prop_compute(CS_PHYS_PROP_DENSITY,
-                         1,
-                         0,
-                         0,
-                         &phys_pp->p0,
-                         &phys_pp->t0,
-                         &phys_pp->ro0);
+    ref_props[n_ref_props] = CS_PHYS_PROP_DENSITY;
+    ref_vals[n_ref_props] = &phys_pp->ro0;
+    n_ref_props += 1;
   }
 
   const char *mv_name = "molecular_viscosity";
@@ -4213,13 +4216,9 @@ cs_gui_physical_properties(void)
     }
   }
   else {
-    cs_phys_prop_compute(CS_PHYS_PROP_DYNAMIC_VISCOSITY,
-                         1,
-                         0,
-                         0,
-                         &phys_pp->p0,
-                         &phys_pp->t0,
-                         &phys_pp->viscl0);
+    ref_props[n_ref_props] = CS_PHYS_PROP_DYNAMIC_VISCOSITY;
+    ref_vals[n_ref_props] = &phys_pp->viscl0;
+    n_ref_props += 1;
   }
 
   if (vof_param->vof_model & CS_VOF_ENABLED) {
@@ -4229,14 +4228,21 @@ cs_gui_physical_properties(void)
 
   if (_thermal_table_needed("specific_heat") == 0)
     cs_gui_properties_value("specific_heat", &phys_pp->cp0);
-  else
-    cs_phys_prop_compute(CS_PHYS_PROP_ISOBARIC_HEAT_CAPACITY,
-                         1,
-                         0,
-                         0,
-                         &phys_pp->p0,
-                         &phys_pp->t0,
-                         &phys_pp->cp0);
+  else {
+    ref_props[n_ref_props] = CS_PHYS_PROP_ISOBARIC_HEAT_CAPACITY;
+    ref_vals[n_ref_props] = &phys_pp->cp0;
+    n_ref_props += 1;
+  }
+
+  if (n_ref_props > 0)
+    cs_phys_prop_compute_multi(n_ref_props,
+                               ref_props,
+                               1,
+                               0,
+                               0,
+                               &phys_pp->p0,
+                               &phys_pp->t0,
+                               ref_vals);
 
   if (cs_glob_physical_model_flag[CS_COMPRESSIBLE] > -1) {
     cs_gui_properties_value("volume_viscosity", &phys_pp->viscv0);
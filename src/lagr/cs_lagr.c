@@ -105,6 +105,7 @@
 #include "cs_lagr_prototypes.h"
 #include "cs_lagr_agglo.h"
 #include "cs_lagr_fragmentation.h"
+#include "cs_lagr_population.h"
 
 #include "cs_random.h"
 
@@ -267,6 +268,16 @@ static cs_lagr_fragmentation_model_t _cs_glob_lagr_fragmentation_model
 cs_lagr_fragmentation_model_t *cs_glob_lagr_fragmentation_model
   = &_cs_glob_lagr_fragmentation_model;
 
+/* lagr population control structure and associated pointer */
+static cs_lagr_population_model_t _cs_glob_lagr_population_model
+  = {
+    .n_cell_budget = 0,
+    .max_stat_weight = 0.,
+    .split_stat_weight = 0.};
+
+cs_lagr_population_model_t *cs_glob_lagr_population_model
+  = &_cs_glob_lagr_population_model;
+
 /* lagr consolidation model structure and associated pointer */
 static cs_lagr_consolidation_model_t _cs_glob_lagr_consolidation_model
   = {0, 0, 0, 0};
@@ -1038,8 +1049,12 @@ cs_lagr_finalize(void)
 
   cs_lagr_tracking_finalize();
 
+  cs_lagr_agglo_finalize();
+
   cs_lagr_finalize_zone_conditions();
 
+  cs_lagr_injection_finalize();
+
   /* Fluid gradients */
   cs_lagr_extra_module_t *extra = cs_glob_lagr_extra_module;
   BFT_FREE(extra->grad_pr);
@@ -1402,6 +1417,18 @@ cs_get_lagr_agglomeration_model(void)
   return &_cs_glob_lagr_agglomeration_model;
 }
 
+/*----------------------------------------------------------------------------
+ * Provide access to cs_lagr_population_model_t
+ *
+ * needed to initialize structure with GUI
+ *----------------------------------------------------------------------------*/
+
+cs_lagr_population_model_t *
+cs_get_lagr_population_model(void)
+{
+  return &_cs_glob_lagr_population_model;
+}
+
 /*----------------------------------------------------------------------------
  * Provide access to cs_lagr_consolidation_model_t
  *
@@ -2402,6 +2429,16 @@ cs_lagr_solve_time_step(const int         itypfb[],
           && cs_glob_lagr_time_step->nor == cs_glob_lagr_time_scheme->t_order)
         cs_lagr_coupling(taup, tempct, tsfext, cpgd1, cpgd2, cpght);
 
+      /* Population control: merge/split parcels based on per-cell
+         budget and statistical weights (after coupling, so arrays
+         sized on the prior particle count are no longer indexed;
+         avoid second pass if second order scheme is used) */
+
+      if (   cs_glob_lagr_time_step->nor == 1
+          && (   cs_glob_lagr_population_model->n_cell_budget > 0
+              || cs_glob_lagr_population_model->split_stat_weight > 0))
+        cs_lagr_population_control(p_set);
+
       /* Deallocate arrays whose size is based on p_set->n_particles
          (which may change next) */
 
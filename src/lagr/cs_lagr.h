@@ -533,6 +533,22 @@ typedef struct {
 
 } cs_lagr_fragmentation_model_t;
 
+/*! Parameters of the particle population (merge/split) control */
+/* ------------------------------------------------------------ */
+
+typedef struct {
+
+  /*! maximum number of parcels per cell (0: no merging) */
+  cs_lnum_t          n_cell_budget;
+
+  /*! maximum statistical weight of a merged parcel (<= 0: no limit) */
+  cs_real_t          max_stat_weight;
+
+  /*! statistical weight above which a parcel is split (<= 0: no splitting) */
+  cs_real_t          split_stat_weight;
+
+} cs_lagr_population_model_t;
+
 /*! Parameters of the particle consolidation model */
 /* ----------------------------------------------- */
 
@@ -1030,6 +1046,7 @@ extern cs_lagr_shape_model_t                 *cs_glob_lagr_shape_model;
 
 extern cs_lagr_agglomeration_model_t         *cs_glob_lagr_agglomeration_model;
 extern cs_lagr_fragmentation_model_t         *cs_glob_lagr_fragmentation_model;
+extern cs_lagr_population_model_t            *cs_glob_lagr_population_model;
 
 extern cs_lagr_consolidation_model_t         *cs_glob_lagr_consolidation_model;
 extern cs_lagr_time_step_t                   *cs_glob_lagr_time_step;
@@ -1171,6 +1188,15 @@ cs_get_lagr_shape_model(void);
 cs_lagr_agglomeration_model_t *
 cs_get_lagr_agglomeration_model(void);
 
+/*----------------------------------------------------------------------------
+ * Provide access to cs_lagr_population_model_t
+ *
+ * needed to initialize structure with GUI
+ *----------------------------------------------------------------------------*/
+
+cs_lagr_population_model_t *
+cs_get_lagr_population_model(void);
+
 /*----------------------------------------------------------------------------
  * Provide access to cs_lagr_consolidation_model_t
  *
@@ -82,6 +82,20 @@ BEGIN_C_DECLS
  * Local structure declarations
  *============================================================================*/
 
+/* Cached EDL coefficients: for a given set of physico-chemical parameters,
+   these depend only on the fluid temperature, which is constant across the
+   many evaluations needed for each particle. */
+
+typedef struct {
+
+  cs_real_t  tempf;       /* fluid temperature (cache key; < 0 if unset) */
+  cs_real_t  ldebye;      /* Debye length */
+  cs_real_t  lphi_p;      /* reduced zeta potential of the particle */
+  cs_real_t  lphi_s;      /* reduced zeta potential of the surface */
+  cs_real_t  prefactor;   /* 2 pi eps0 eps (kT/e)^2 */
+
+} _edl_coeffs_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -98,12 +112,64 @@ static const cs_real_t _free_space_permit = 8.854e-12;
 /* Faraday constant */
 static const cs_real_t _faraday_cst = 9.648e4;
 
+/* Cached EDL coefficients */
+static _edl_coeffs_t _edl_coeffs = {-1.0, 0.0, 0.0, 0.0, 0.0};
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/* Update cached EDL coefficients for the given temperature                   */
+/*----------------------------------------------------------------------------*/
+
+static void
+_update_edl_coeffs(cs_real_t  tempf)
+{
+  if (_edl_coeffs.tempf == tempf)
+    return;
+
+  cs_lagr_physico_chemical_t *lag_pc = cs_glob_lagr_physico_chemical;
+
+  const cs_real_t charge = 1.6e-19;
+
+  _edl_coeffs.ldebye
+    = pow(  2000.0 * cs_math_pow2(_faraday_cst) * lag_pc->fion
+          / (  lag_pc->epseau * _free_space_permit
+             * cs_physical_constants_r * tempf), -0.5);
+
+  /* Reduced zeta potentials */
+
+  _edl_coeffs.lphi_p =   lag_pc->valen * charge * lag_pc->phi_p
+                       / _k_boltz / tempf;
+  _edl_coeffs.lphi_s =   lag_pc->valen * charge * lag_pc->phi_s
+                       / _k_boltz / tempf;
+
+  _edl_coeffs.prefactor =   2.0 * cs_math_pi * lag_pc->epseau
+                          * _free_space_permit
+                          * cs_math_pow2(_k_boltz * tempf / charge);
+
+  _edl_coeffs.tempf = tempf;
+}
+
+/*----------------------------------------------------------------------------*/
+/* Extended reduced zeta potential of a sphere                                */
+/*  (following the work from Ohshima et al, 1982, JCIS, 90, 17-26)            */
+/*----------------------------------------------------------------------------*/
+
+static cs_real_t
+_ext_zeta_potential(cs_real_t  lphi,
+                    cs_real_t  tau)
+{
+  cs_real_t th = tanh(lphi / 4.0);
+
+  return   8.0 * th
+         / (1.0 + sqrt(1.0 -   (2.0 * tau + 1.0) / cs_math_pow2(tau + 1.0)
+                             * cs_math_pow2(th)));
+}
+
 /*----------------------------------------------------------------------------*/
 /* VDW interaction between a sphere and a plate                               */
 /*----------------------------------------------------------------------------*/
@@ -117,16 +183,16 @@ _vdwsp(cs_real_t  cstham,
 {
   if (*distp < lambda_vdw / 2.0 / cs_math_pi)
     *var = - cstham * *rpart / (6.0 * *distp)
-           * (1.0 / (1.0 + 14.0 * *distp / lambda_vdw + 5.0 * cs_math_pi / 4.9 * pow (*distp, 3.0)
-                   / lambda_vdw / pow (*rpart, 2.0)));
+           * (1.0 / (1.0 + 14.0 * *distp / lambda_vdw + 5.0 * cs_math_pi / 4.9 * cs_math_pow3(*distp)
+                   / lambda_vdw / cs_math_pow2(*rpart)));
   else
     *var = cstham * (2.45 / 60.0 / cs_math_pi * lambda_vdw
-                     * (  (*distp - *rpart) / pow (*distp, 2)
-                        - (*distp + 3.0 * *rpart) / pow ((*distp + 2.0 * *rpart), 2.0))
-                     - 2.17 / 720.0 / pow (cs_math_pi, 2) * pow (lambda_vdw, 2.0)
-                       * ((*distp - 2.0* *rpart) / pow (*distp, 3.0) - (*distp + 4.0 * *rpart) / pow ((*distp + 2.0 * *rpart), 3.0))
-                     + 0.59 / 5040.0 / pow (cs_math_pi, 3.0) * pow (lambda_vdw, 3.0)
-                       * ((*distp - 3.0 * *rpart) / pow (*distp, 4.0) - (*distp + 5.0 * *rpart) / pow ((*distp + 2.0 * *rpart), 4.0)));
+                     * (  (*distp - *rpart) / cs_math_pow2(*distp)
+                        - (*distp + 3.0 * *rpart) / cs_math_pow2(*distp + 2.0 * *rpart))
+                     - 2.17 / 720.0 / cs_math_pow2(cs_math_pi) * cs_math_pow2(lambda_vdw)
+                       * ((*distp - 2.0* *rpart) / cs_math_pow3(*distp) - (*distp + 4.0 * *rpart) / cs_math_pow3(*distp + 2.0 * *rpart))
+                     + 0.59 / 5040.0 / cs_math_pow3(cs_math_pi) * cs_math_pow3(lambda_vdw)
+                       * ((*distp - 3.0 * *rpart) / cs_math_pow4(*distp) - (*distp + 5.0 * *rpart) / cs_math_pow4(*distp + 2.0 * *rpart)));
 
 }
 
@@ -157,45 +223,35 @@ _vdwss(cs_real_t  cstham,
 static void
 _edlsp(cs_real_t *distp,
        cs_real_t *rpart,
-       cs_real_t  phi_p,
-       cs_real_t  phi_s,
-       cs_real_t  tempf,
        cs_real_t *var)
 {
-  cs_lagr_physico_chemical_t *lag_pc = cs_glob_lagr_physico_chemical;
-  cs_real_t charge  = 1.6e-19;
+  /* Temperature-dependent coefficients are cached
+     (see _update_edl_coeffs) */
 
-  cs_real_t ldebye = pow(   2000.0 * pow (_faraday_cst,2) * lag_pc->fion
-                / (lag_pc->epseau * _free_space_permit * cs_physical_constants_r * tempf), -0.5);
-
-  /* Reduced zeta potential    */
-  cs_real_t lphi1  = lag_pc->valen * charge * phi_p / _k_boltz / tempf;
-  cs_real_t lphi2  = lag_pc->valen * charge * phi_s / _k_boltz / tempf;
+  cs_real_t ldebye = _edl_coeffs.ldebye;
 
   /* xtended reduced zeta potential */
   /*  (following the work from Ohshima et al, 1982, JCIS, 90, 17-26)   */
   /* or the particle */
 
   cs_real_t tau    = *rpart / ldebye;
-  lphi1  =   8.0 * tanh (lphi1 / 4.0)
-           / (1.0 + sqrt (1.0 - (2.0 * tau + 1.0) / pow(tau + 1.0, 2.0) * pow(tanh(lphi1 / 4.0), 2.0)));
+  cs_real_t lphi1  = _ext_zeta_potential(_edl_coeffs.lphi_p, tau);
 
   /* For the plate   */
 
-  lphi2  = 4.0 * tanh (lphi2 / 4.0);
+  cs_real_t lphi2  = 4.0 * tanh (_edl_coeffs.lphi_s / 4.0);
 
   /* alculation for the EDL force   */
 
   cs_real_t alpha = sqrt ((*distp + *rpart) / *rpart) + sqrt (*rpart / (*distp + *rpart));
 
-  cs_real_t omega1 = pow (lphi1, 2.0) + pow (lphi2, 2.0) + alpha * lphi1 * lphi2;
+  cs_real_t omega1 = cs_math_pow2(lphi1) + cs_math_pow2(lphi2) + alpha * lphi1 * lphi2;
 
-  cs_real_t omega2 = pow (lphi1, 2.0) + pow (lphi2, 2.0) - alpha * lphi1 * lphi2;
+  cs_real_t omega2 = cs_math_pow2(lphi1) + cs_math_pow2(lphi2) - alpha * lphi1 * lphi2;
 
   cs_real_t gamma  = sqrt (*rpart / (*distp + *rpart)) * exp ( -1.0 / ldebye * *distp);
 
-  *var   =  2.0 * cs_math_pi * lag_pc->epseau * _free_space_permit
-          * pow(_k_boltz * tempf / charge, 2.0) * *rpart
+  *var   =  _edl_coeffs.prefactor * *rpart
           * (*distp + *rpart) / (*distp + 2.0 * *rpart)
           * (omega1 * log (1.0 + gamma) + omega2 * log (1.0 - gamma));
 
@@ -208,52 +264,40 @@ static void
 _edlss(cs_real_t *distcc,
        cs_real_t *rpart1,
        cs_real_t *rpart2,
-       cs_real_t  phi1,
-       cs_real_t  phi2,
-       cs_real_t  tempf,
+       cs_real_t  lphi1_r,
+       cs_real_t  lphi2_r,
        cs_real_t *var)
 {
-  cs_lagr_physico_chemical_t *lag_pc = cs_glob_lagr_physico_chemical;
-  cs_real_t charge = 1.6e-19;
+  /* Temperature-dependent coefficients are cached, and reduced zeta
+     potentials are passed by the caller (see _update_edl_coeffs) */
 
-  cs_real_t ldebye = pow(   2000.0 * pow (_faraday_cst,2) * lag_pc->fion
-                / (lag_pc->epseau * _free_space_permit * cs_physical_constants_r * tempf), -0.5);
-
-  /* Reduced zeta potential    */
-
-  cs_real_t lphi1  = lag_pc->valen * charge * phi1 / _k_boltz / tempf;
-  cs_real_t lphi2  = lag_pc->valen * charge * phi2 / _k_boltz / tempf;
+  cs_real_t ldebye = _edl_coeffs.ldebye;
 
   /* xtended reduced zeta potential */
   /*  (following the work from Ohshima et al, 1982, JCIS, 90, 17-26)   */
   /* For the first particle    */
 
-  cs_real_t tau = *rpart1 / ldebye;
-  lphi1 =   8.0 * tanh (lphi1 / 4.0)
-           / (1.0 + sqrt (1.0 - (2.0 * tau + 1.0) / pow(tau + 1, 2.0) * pow(tanh(lphi1 / 4.0), 2.0)));
+  cs_real_t lphi1 = _ext_zeta_potential(lphi1_r, *rpart1 / ldebye);
 
   /* For the second particle   */
 
-  tau = *rpart2 / ldebye;
-  lphi2 =  8.0 * tanh (lphi2 / 4.0)
-         / (1.0 + sqrt (1.0 - (2.0 * tau + 1.0) / pow ((tau + 1.0), 2.0) * pow (tanh (lphi2 / 4.0), 2.0)));
+  cs_real_t lphi2 = _ext_zeta_potential(lphi2_r, *rpart2 / ldebye);
 
   /* Calculation of the EDL force   */
 
   cs_real_t alpha  =  sqrt(*rpart2 * (*distcc - *rpart2) / (*rpart1 * (*distcc - *rpart1)))
                     + sqrt(*rpart1 * (*distcc - *rpart1) / (*rpart2 * (*distcc - *rpart2)));
 
-  cs_real_t omega1 = pow (lphi1, 2.0) + pow (lphi2, 2.0) + alpha * lphi1 * lphi2;
+  cs_real_t omega1 = cs_math_pow2(lphi1) + cs_math_pow2(lphi2) + alpha * lphi1 * lphi2;
 
-  cs_real_t omega2 = pow (lphi1, 2.0) + pow (lphi2, 2.0) - alpha * lphi1 * lphi2;
+  cs_real_t omega2 = cs_math_pow2(lphi1) + cs_math_pow2(lphi2) - alpha * lphi1 * lphi2;
 
   cs_real_t gamma  =  sqrt (*rpart1 * *rpart2 / (*distcc - *rpart1) / (*distcc - *rpart2))
                     * exp (1.0 / ldebye * (*rpart1 + *rpart2 - *distcc));
 
-  *var =  2.0 * cs_math_pi * lag_pc->epseau * _free_space_permit
-        * pow ((_k_boltz * tempf / charge), 2.0) * *rpart1 * *rpart2
+  *var =  _edl_coeffs.prefactor * *rpart1 * *rpart2
         * (*distcc - *rpart1) * (*distcc - *rpart2)
-        / (*distcc * (*distcc * (*rpart1 + *rpart2) - pow (*rpart1, 2.0) - pow (*rpart2, 2.0)))
+        / (*distcc * (*distcc * (*rpart1 + *rpart2) - cs_math_pow2(*rpart1) - cs_math_pow2(*rpart2)))
         * (omega1 * log (1.0 + gamma) + omega2 * log (1.0 - gamma));
 }
 
@@ -295,8 +339,10 @@ cs_lagr_adh(cs_lnum_t   ip,
   cs_real_t modyeq = cs_glob_lagr_reentrained_model->modyeq;
 
   cs_real_t step = 1e-11;
-  cs_real_t scovap = denasp * cs_math_pi * pow (rayasp, 2);
-  cs_real_t scovag = cs_math_pi * pow (rayasg, 2) / pow (espasg, 2);
+  cs_real_t scovap = denasp * cs_math_pi * cs_math_pow2(rayasp);
+  cs_real_t scovag = cs_math_pi * cs_math_pow2(rayasg) / cs_math_pow2(espasg);
+
+  _update_edl_coeffs(tempf);
 
   cs_real_t dismin;
   /* ================================================================  */
@@ -342,7 +388,7 @@ cs_lagr_adh(cs_lnum_t   ip,
 
     nmoyag =  1.0
             +  2.0 * _d_cut_off * (2.0 * rpart + 2.0 * rayasg + 4.0 * _d_cut_off)
-             / pow (rayasg, 2) * scovag;
+             / cs_math_pow2(rayasg) * scovag;
 
     if (nmoyag > 600.0) {
 
@@ -410,7 +456,7 @@ cs_lagr_adh(cs_lnum_t   ip,
 
       nmoyap =  1
               +  2.0 * _d_cut_off * (2.0 * rpart + 2.0 * rayasp + 4.0 * _d_cut_off)
-               / pow (rayasp, 2) * scovap;
+               / cs_math_pow2(rayasp) * scovap;
 
       if (nmoyap > 600.0) {
 
@@ -451,7 +497,7 @@ cs_lagr_adh(cs_lnum_t   ip,
   else {
 
     cs_real_t paramh = 0.5 * (2.0 * rpart + rayasp) * rayasp / (rpart + rayasg);
-    cs_real_t nmoyap = paramh * (2 * rayasg - paramh) / pow (rayasp, 2) * scovap;
+    cs_real_t nmoyap = paramh * (2 * rayasg - paramh) / cs_math_pow2(rayasp) * scovap;
 
     if (nmoyap > 600.0) {
 
@@ -480,7 +526,7 @@ cs_lagr_adh(cs_lnum_t   ip,
 
       paramh =  0.5 * (2.0 * rpart + 2 * rayasp + 4.0 * _d_cut_off)
               * 2.0 * _d_cut_off / (rpart + rayasg + rayasp + _d_cut_off);
-      nmoyap = 1 + paramh * (2 * rayasg - paramh) / pow (rayasp, 2) * scovap;
+      nmoyap = 1 + paramh * (2 * rayasg - paramh) / cs_math_pow2(rayasp) * scovap;
 
       if (nmoyap > 600.0) {
 
@@ -530,7 +576,7 @@ cs_lagr_adh(cs_lnum_t   ip,
 
     cs_real_t uvdwsp, uedlsp;
     _vdwsp(lag_pc->cstham, lag_pc->lambda_vdw, &distp, &rpart, &uvdwsp);
-    _edlsp(&distp, &rpart, lag_pc->phi_p, lag_pc->phi_s, tempf, &uedlsp);
+    _edlsp(&distp, &rpart, &uedlsp);
 
     udlvor[np] = (uvdwsp + uedlsp) * (1 - scovag - scovap);
 
@@ -550,7 +596,8 @@ cs_lagr_adh(cs_lnum_t   ip,
     cs_real_t uvdwss, uedlss;
 
     _vdwss(lag_pc->cstham, lag_pc->lambda_vdw, &distcc, &rpart, &rayasp, &uvdwss);
-    _edlss(&distcc, &rpart, &rayasp, lag_pc->phi_p, lag_pc->phi_s, tempf, &uedlss);
+    _edlss(&distcc, &rpart, &rayasp,
+           _edl_coeffs.lphi_p, _edl_coeffs.lphi_s, &uedlss);
 
     udlvor[np] = uvdwss + uedlss;
 
@@ -575,7 +622,8 @@ cs_lagr_adh(cs_lnum_t   ip,
     cs_real_t uvdwss, uedlss;
 
     _vdwss(lag_pc->cstham, lag_pc->lambda_vdw, &distcc, &rpart, &rayasg, &uvdwss);
-    _edlss(&distcc, &rpart, &rayasg, lag_pc->phi_p, lag_pc->phi_s, tempf, &uedlss);
+    _edlss(&distcc, &rpart, &rayasg,
+           _edl_coeffs.lphi_p, _edl_coeffs.lphi_s, &uedlss);
 
     udlvor[np] = uvdwss + uedlss;
 
@@ -614,8 +662,8 @@ cs_lagr_adh(cs_lnum_t   ip,
     /* In the sphere-plate case, we use the deformation given by the DMT theory,
      * which is close to our approach  */
 
-    cs_real_t omsurf = lag_pc->cstham / (24.0 * cs_math_pi * pow (_d_cut_off, 2));
-    dismom = pow ((4.0 * cs_math_pi * omsurf * (pow (rpart, 2.0)) / modyeq), (1.0 / 3.0));
+    cs_real_t omsurf = lag_pc->cstham / (24.0 * cs_math_pi * cs_math_pow2(_d_cut_off));
+    dismom = pow ((4.0 * cs_math_pi * omsurf * cs_math_pow2(rpart) / modyeq), (1.0 / 3.0));
     /* dismom = (12.0d0 * cs_math_pi * omsurf * (rpart**2)/modyeq)**(1.0d0/3.0d0) */
 
   }
@@ -663,6 +711,8 @@ cs_lagr_adh_pp(cs_real_t   dpart,
 
   cs_real_t rpart = 0.5 * dpart;
 
+  _update_edl_coeffs(tempf);
+
   /* Sum of {particle-plane} and {particle-asperity} energies     */
 
   cs_real_t udlvor[2];
@@ -678,7 +728,8 @@ cs_lagr_adh_pp(cs_real_t   dpart,
     cs_real_t uvdwss, uedlss;
 
     _vdwss(lag_cm->csthpp, lag_pc->lambda_vdw, &distcc, &rpart, &rpart, &uvdwss);
-    _edlss(&distcc, &rpart, &rpart, lag_pc->phi_p, lag_pc->phi_p, tempf, &uedlss);
+    _edlss(&distcc, &rpart, &rpart,
+           _edl_coeffs.lphi_p, _edl_coeffs.lphi_p, &uedlss);
 
     udlvor[np] = uvdwss + uedlss;
 
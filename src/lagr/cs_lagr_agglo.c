@@ -97,6 +97,22 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Bucket index of newly created parcels, keyed by agglomeration class:
+   for each class, the index of the newest parcel created during the
+   current call to cs_lagr_agglomeration, so that further agglomeration
+   events of that class may merge into it without scanning all created
+   parcels. The arrays are kept across calls (and cells) and entries are
+   validated using a call id tag, so no per-cell clearing is needed. */
+
+static cs_lnum_t   _new_parcel_idx_size = 0;
+static cs_lnum_t  *_new_parcel_idx = NULL;
+static cs_lnum_t  *_new_parcel_tag = NULL;
+static cs_lnum_t   _new_parcel_call_id = 0;
+
 /*=============================================================================
  * Private function definitions
  *============================================================================*/
@@ -415,11 +431,27 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
     return 0;
   }
 
+  /* Make sure the bucket index covers all possible classes, and
+     invalidate entries left over from previous calls (tag mismatch) */
+
+  cs_lnum_t n_max_classes = cs_glob_lagr_agglomeration_model->n_max_classes;
+
+  if (_new_parcel_idx_size < n_max_classes + 1) {
+    BFT_REALLOC(_new_parcel_idx, n_max_classes + 1, cs_lnum_t);
+    BFT_REALLOC(_new_parcel_tag, n_max_classes + 1, cs_lnum_t);
+    for (cs_lnum_t i = _new_parcel_idx_size; i < n_max_classes + 1; i++)
+      _new_parcel_tag[i] = -1;
+    _new_parcel_idx_size = n_max_classes + 1;
+  }
+
+  _new_parcel_call_id += 1;
+
   /* Create local array (containing the class and particle index) */
   cs_lnum_2_t *interf;
 
   BFT_MALLOC(interf, lnum_particles, cs_lnum_2_t);
 
+# pragma omp parallel for  if(lnum_particles > CS_THR_MIN)
   for (cs_lnum_t i = start_particle; i < end_particle; ++i) {
     interf[i-start_particle][0]
       = cs_lagr_particles_get_lnum(p_set, i, CS_LAGR_AGGLO_CLASS_ID);
@@ -560,25 +592,21 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
         }
       }
 
-      /* Else, find new aggregated particles with the same class
-         (to merge with it) */
+      /* Else, merge with the newest created parcel of the same class
+         if it has room left (O(1) bucket index lookup, rather than a
+         linear scan of all created parcels) */
 
       cs_lnum_t add_to_end = 1;
 
-      for (cs_lnum_t indx = p_set->n_particles;
-          indx < p_set->n_particles + newpart;
-          indx++) {
-        cs_lnum_t stat_class
-          = cs_lagr_particles_get_lnum(p_set, indx, CS_LAGR_AGGLO_CLASS_ID);
+      if (_new_parcel_tag[n_classes_new] == _new_parcel_call_id) {
+        cs_lnum_t indx = _new_parcel_idx[n_classes_new];
         cs_real_t stat_weight
           = cs_lagr_particles_get_real(p_set, indx, CS_LAGR_STAT_WEIGHT);
-        if (   (stat_class == n_classes_new)
-            && (stat_weight + vp <= agglo_max_weight)) {
+        if (stat_weight + vp <= agglo_max_weight) {
           cs_lagr_particles_set_real(p_set, indx, CS_LAGR_STAT_WEIGHT,
                                      round(stat_weight)+vp);
 
           add_to_end = 0;
-          break;
         }
       }
 
@@ -623,6 +651,12 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
         cs_lagr_particles_set_lnum(p_set, inserted_parts-1,
                                    CS_LAGR_AGGLO_CLASS_ID, n_classes_new);
 
+        /* Reference the new parcel in the bucket index, so that further
+           events of the same class may merge into it */
+
+        _new_parcel_idx[n_classes_new] = inserted_parts-1;
+        _new_parcel_tag[n_classes_new] = _new_parcel_call_id;
+
         /* Set particle velocity */
 
         cs_real_t * inserted_vel
@@ -797,6 +831,21 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
   return ret_val;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free arrays used by the agglomeration algorithm.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_finalize(void)
+{
+  BFT_FREE(_new_parcel_idx);
+  BFT_FREE(_new_parcel_tag);
+  _new_parcel_idx_size = 0;
+  _new_parcel_call_id = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -108,6 +108,15 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
                       cs_lnum_t  start_particle,
                       cs_lnum_t  end_particle);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free arrays used by the agglomeration algorithm.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -52,6 +52,7 @@
 
 #include "cs_base.h"
 #include "cs_interface.h"
+#include "cs_math.h"
 #include "cs_mesh.h"
 #include "cs_mesh_quantities.h"
 #include "cs_parall.h"
@@ -105,6 +106,86 @@ static const cs_real_t _faraday_cst = 9.648e4;
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Extended reduced zeta potential of a sphere
+ * (following the work from Ohshima et al, 1982, JCIS, 90, 17-26)
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t
+_extended_reduced_zeta(cs_real_t  lphi,
+                       cs_real_t  tau)
+{
+  cs_real_t th = tanh(lphi / 4.);
+
+  return 8. * th
+         / (1. + sqrt(1. -   (2. * tau + 1.) / cs_math_pow2(tau + 1.)
+                           * cs_math_pow2(th)));
+}
+
+/*----------------------------------------------------------------------------
+ * EDL interaction between a sphere and a plane, given precomputed extended
+ * reduced zeta potentials and prefactor (which are independent of the
+ * separation distance, so they may be hoisted out of scanning loops).
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t
+_edl_sphere_plane(cs_real_t  distp,
+                  cs_real_t  rpart,
+                  cs_real_t  lphi1,
+                  cs_real_t  lphi2,
+                  cs_real_t  debye_length,
+                  cs_real_t  prefactor)
+{
+  cs_real_t alpha =   sqrt((distp + rpart) / rpart)
+                    + sqrt(rpart / (distp + rpart));
+  cs_real_t omega1 = cs_math_pow2(lphi1) + cs_math_pow2(lphi2)
+                     + alpha * lphi1 * lphi2;
+  cs_real_t omega2 = cs_math_pow2(lphi1) + cs_math_pow2(lphi2)
+                     - alpha * lphi1 * lphi2;
+  cs_real_t gamma = sqrt(rpart / (distp + rpart)) * exp(-1./debye_length * distp);
+
+  return prefactor * rpart * (distp + rpart) / (distp + 2 * rpart)
+         * (omega1 * log(1 + gamma) + omega2 * log(1 - gamma));
+}
+
+/*----------------------------------------------------------------------------
+ * EDL interaction between two spheres, given precomputed extended reduced
+ * zeta potentials and prefactor.
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t
+_edl_sphere_sphere(cs_real_t  distcc,
+                   cs_real_t  rpart1,
+                   cs_real_t  rpart2,
+                   cs_real_t  lphi1,
+                   cs_real_t  lphi2,
+                   cs_real_t  debye_length,
+                   cs_real_t  prefactor)
+{
+  cs_real_t alpha =    sqrt(rpart2 * (distcc - rpart2)
+                    / (rpart1 * (distcc - rpart1)))
+                     + sqrt(rpart1 * (distcc - rpart1)
+                    / (rpart2 * (distcc - rpart2)));
+
+  cs_real_t omega1 = cs_math_pow2(lphi1) + cs_math_pow2(lphi2)
+                     + alpha * lphi1 * lphi2;
+
+  cs_real_t omega2 = cs_math_pow2(lphi1) + cs_math_pow2(lphi2)
+                     - alpha * lphi1 * lphi2;
+
+  cs_real_t gamma = sqrt(rpart1 * rpart2 / (distcc-rpart1) / (distcc-rpart2))
+                    *exp(1. / debye_length * (rpart1 + rpart2 - distcc));
+
+  return prefactor * rpart1 * rpart2 * (distcc - rpart1) * (distcc - rpart2)
+         / (distcc * (  distcc * (rpart1  + rpart2)
+                      - cs_math_pow2(rpart1) - cs_math_pow2(rpart2)))
+         * (omega1 * log(1 + gamma) + omega2 * log(1 - gamma));
+}
+
 /*============================================================================
  * Public function prototypes for Fortran API
  *============================================================================*/
@@ -212,12 +293,32 @@ cs_lagr_barrier(const void                     *particle,
   cs_real_t barr = 0.;
   cs_real_t distp = 0.;
 
+  const cs_real_t temp = cs_lagr_dlvo_param.temperature[iel];
+  const cs_real_t debye_length = cs_lagr_dlvo_param.debye_length[iel];
+  const cs_real_t step = debye_length / 30.0;
+
+  /* Extended reduced zeta potentials and EDL prefactor do not depend
+     on the separation distance, so they are computed only once. */
+
+  const cs_real_t charge = 1.6e-19;
+
+  cs_real_t lphi1 =  cs_lagr_dlvo_param.valen * charge
+                   * cs_lagr_dlvo_param.phi_p / _k_boltzmann / temp;
+  cs_real_t lphi2 =  cs_lagr_dlvo_param.valen * charge
+                   * cs_lagr_dlvo_param.phi_s / _k_boltzmann / temp;
+
+  lphi1 = _extended_reduced_zeta(lphi1, rpart / debye_length);
+  lphi2 = 4. * tanh(lphi2 / 4.);
+
+  const cs_real_t prefactor
+    = 2 * _pi * _free_space_permit * cs_lagr_dlvo_param.water_permit
+      * cs_math_pow2(  _k_boltzmann * temp
+                     / (1. * cs_lagr_dlvo_param.valen) / charge);
+
   /* Computation of the energy barrier */
 
   for (i = 0; i < 1001; i++) {
 
-    cs_real_t  step = cs_lagr_dlvo_param.debye_length[iel]/30.0;
-
     /* Interaction between the sphere and the plate */
 
     distp = _d_cut_off + i * step;
@@ -229,14 +330,8 @@ cs_lagr_barrier(const void                     *particle,
                                            cs_lagr_dlvo_param.cstham);
 
     cs_real_t var2
-      = cs_lagr_edl_sphere_plane(distp,
-                                 rpart,
-                                 cs_lagr_dlvo_param.valen,
-                                 cs_lagr_dlvo_param.phi_p,
-                                 cs_lagr_dlvo_param.phi_s,
-                                 cs_lagr_dlvo_param.temperature[iel],
-                                 cs_lagr_dlvo_param.debye_length[iel],
-                                 cs_lagr_dlvo_param.water_permit);
+      = _edl_sphere_plane(distp, rpart, lphi1, lphi2,
+                          debye_length, prefactor);
 
     barr = (var1 + var2);
 
@@ -262,12 +357,28 @@ cs_lagr_barrier_pp(cs_real_t                       dpart,
 
   *energy_barrier = 0.;
 
+  const cs_real_t temp = cs_lagr_dlvo_param.temperature[iel];
+  const cs_real_t debye_length = cs_lagr_dlvo_param.debye_length[iel];
+  const cs_real_t step = debye_length / 30.0;
+
+  /* Extended reduced zeta potential and EDL prefactor do not depend
+     on the separation distance, so they are computed only once. */
+
+  const cs_real_t charge = 1.6e-19;
+
+  cs_real_t lphi =  cs_lagr_dlvo_param.valen * charge
+                  * cs_lagr_dlvo_param.phi_p / _k_boltzmann / temp;
+
+  lphi = _extended_reduced_zeta(lphi, rpart / debye_length);
+
+  const cs_real_t prefactor
+    = 2 * _pi * _free_space_permit * cs_lagr_dlvo_param.water_permit
+      * cs_math_pow2(_k_boltzmann * temp / charge);
+
   /* Computation of the energy barrier */
 
   for (int i = 0; i < 1001; i++) {
 
-    cs_real_t step = cs_lagr_dlvo_param.debye_length[iel] / 30.0;
-
     /* Interaction between two spheres */
 
     cs_real_t distcc = _d_cut_off + i * step + 2.0 * rpart;
@@ -280,15 +391,8 @@ cs_lagr_barrier_pp(cs_real_t                       dpart,
                                             cs_lagr_dlvo_param.csthpp);
 
     cs_real_t var2
-      = cs_lagr_edl_sphere_sphere(distcc,
-                                  rpart,
-                                  rpart,
-                                  cs_lagr_dlvo_param.valen,
-                                  cs_lagr_dlvo_param.phi_p,
-                                  cs_lagr_dlvo_param.phi_p,
-                                  cs_lagr_dlvo_param.temperature[iel],
-                                  cs_lagr_dlvo_param.debye_length[iel],
-                                  cs_lagr_dlvo_param.water_permit);
+      = _edl_sphere_sphere(distcc, rpart, rpart, lphi, lphi,
+                           debye_length, prefactor);
 
     cs_real_t barr = (var1 + var2);
 
@@ -318,18 +422,18 @@ cs_lagr_van_der_waals_sphere_plane (cs_real_t distp,
   if (distp < (lambda_vdw / 2 / _pi)) {
     var = -cstham * rpart / (6 * distp)
           * (1 / (1 + 14 * distp / lambda_vdw + 5 * _pi/4.9
-          *  pow(distp,3) / lambda_vdw / pow(rpart,2)));
+          *  cs_math_pow3(distp) / lambda_vdw / cs_math_pow2(rpart)));
   }
   else {
     var = cstham
       * ((2.45 * lambda_vdw ) /(60. * _pi)
-         * (  (distp - rpart) / pow(distp,2)
-            - (distp + 3. * rpart) / pow(distp + 2. * rpart,2))
-            - 2.17 / 720. / pow(_pi,2) * pow(lambda_vdw,2) * ((distp - 2. * rpart)
-            / pow(distp,3) - (distp + 4. * rpart) / pow(distp + 2. * rpart,3))
-            + 0.59 / 5040. / pow(_pi,3) * pow(lambda_vdw,3)
-            * ((distp - 3. * rpart) /  pow(distp,4) - (distp + 5. * rpart)
-            / pow(distp + 2. * rpart,4)));
+         * (  (distp - rpart) / cs_math_pow2(distp)
+            - (distp + 3. * rpart) / cs_math_pow2(distp + 2. * rpart))
+            - 2.17 / 720. / cs_math_pow2(_pi) * cs_math_pow2(lambda_vdw) * ((distp - 2. * rpart)
+            / cs_math_pow3(distp) - (distp + 4. * rpart) / cs_math_pow3(distp + 2. * rpart))
+            + 0.59 / 5040. / cs_math_pow3(_pi) * cs_math_pow3(lambda_vdw)
+            * ((distp - 3. * rpart) /  cs_math_pow4(distp) - (distp + 5. * rpart)
+            / cs_math_pow4(distp + 2. * rpart)));
   }
 
   return var;
@@ -376,29 +480,18 @@ cs_lagr_edl_sphere_plane(cs_real_t  distp,
   cs_real_t lphi1 =  valen * charge * phi1 /  _k_boltzmann / temp;
   cs_real_t lphi2 =  valen * charge * phi2 /  _k_boltzmann / temp;
 
-  cs_real_t tau = rpart / debye_length;
-
   /* Extended reduced zeta potential */
   /* (following the work from Ohshima et al, 1982, JCIS, 90, 17-26) */
 
-  lphi1 = 8. * tanh(lphi1 / 4.) /
-         ( 1. + pow(1. - (2. * tau + 1.) / (pow(tau + 1,2))
-         * pow(tanh(lphi1 / 4.),2),0.5));
+  lphi1 = _extended_reduced_zeta(lphi1, rpart / debye_length);
 
   lphi2 = 4. * tanh(lphi2 / 4.) ;
 
-  cs_real_t alpha =   sqrt((distp + rpart) / rpart)
-                    + sqrt(rpart / (distp + rpart));
-  cs_real_t omega1 = pow(lphi1,2) + pow(lphi2,2) + alpha * lphi1 * lphi2;
-  cs_real_t omega2 = pow(lphi1,2) + pow(lphi2,2) - alpha * lphi1 * lphi2;
-  cs_real_t gamma = sqrt(rpart / (distp + rpart)) * exp(-1./debye_length * distp);
-
-  cs_real_t var = 2 * _pi * _free_space_permit * water_permit
-    * pow((_k_boltzmann * temp / (1. * valen) / charge),2)
-                  * rpart * (distp + rpart) / (distp + 2 * rpart)
-                  * (omega1 * log(1 + gamma) + omega2 * log(1 - gamma));
+  cs_real_t prefactor = 2 * _pi * _free_space_permit * water_permit
+    * cs_math_pow2(_k_boltzmann * temp / (1. * valen) / charge);
 
-  return var;
+  return _edl_sphere_plane(distp, rpart, lphi1, lphi2,
+                           debye_length, prefactor);
 }
 
 /*----------------------------------------------------------------------------
@@ -424,40 +517,17 @@ cs_lagr_edl_sphere_sphere(cs_real_t  distcc,
   cs_real_t lphi1 =  valen * charge * phi1 /  _k_boltzmann / temp;
   cs_real_t lphi2 =  valen * charge * phi2 /  _k_boltzmann / temp;
 
-
   /* Extended reduced zeta potential */
   /* (following the work from Ohshima et al, 1982, JCIS, 90, 17-26) */
 
-  cs_real_t tau1 = rpart1 / debye_length;
-  lphi1 = 8. * tanh(lphi1 / 4.) /
-    ( 1. + pow(1. - (2. * tau1 + 1.) / (pow(tau1 + 1,2))
-               * pow(tanh(lphi1 / 4.),2),0.5));
+  lphi1 = _extended_reduced_zeta(lphi1, rpart1 / debye_length);
+  lphi2 = _extended_reduced_zeta(lphi2, rpart2 / debye_length);
 
-  cs_real_t tau2 = rpart2 / debye_length;
-  lphi2 = 8. * tanh(lphi2 / 4.) /
-         ( 1. + pow(1. - (2. * tau2 + 1.) / (pow(tau2 + 1,2))
-          * pow(tanh(lphi2 / 4.),2),0.5));
+  cs_real_t prefactor = 2 * _pi * _free_space_permit * water_permit
+                        * cs_math_pow2(_k_boltzmann * temp / charge);
 
-  cs_real_t alpha =    sqrt(rpart2 * (distcc - rpart2)
-                    / (rpart1 * (distcc - rpart1)))
-                     + sqrt(rpart1 * (distcc - rpart1)
-                    / (rpart2 * (distcc - rpart2)));
-
-  cs_real_t omega1 = pow(lphi1,2) + pow(lphi2,2) + alpha * lphi1 * lphi2;
-
-  cs_real_t omega2 = pow(lphi1,2) + pow(lphi2,2) - alpha * lphi1 * lphi2;
-
-  cs_real_t gamma = sqrt(rpart1 * rpart2 / (distcc-rpart1) / (distcc-rpart2))
-                    *exp(1. / debye_length * (rpart1 + rpart2 - distcc));
-
-  cs_real_t var = 2 * _pi * _free_space_permit * water_permit
-                  * pow((_k_boltzmann * temp / charge),2)
-                  * rpart1 * rpart2 * (distcc - rpart1) * (distcc - rpart2)
-                  / (distcc * (  distcc * (rpart1  + rpart2)
-                               - pow(rpart1,2) - pow(rpart2,2)))
-                  * (omega1 * log(1 + gamma) + omega2 * log(1 - gamma));
-
-  return var;
+  return _edl_sphere_sphere(distcc, rpart1, rpart2, lphi1, lphi2,
+                            debye_length, prefactor);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -153,6 +153,13 @@ static cs_lagr_event_attribute_map_t  *_e_attr_map = NULL;
 static int   _n_mapped_part_attr = 0;
 static int  *_mapped_part_attr = NULL;
 
+/* Precomputed copy plan for mapped attributes, so that copying particle
+   data to an event requires no displacement lookups */
+
+static size_t  *_mapped_part_attr_p_displ = NULL;
+static size_t  *_mapped_part_attr_e_displ = NULL;
+static size_t  *_mapped_part_attr_size = NULL;
+
 static cs_lagr_event_set_t  *_boundary_events = NULL;
 
 /*============================================================================
@@ -505,6 +512,19 @@ cs_lagr_event_initialize(void)
      then built) */
 
   _e_attr_map = _create_attr_map(attr_keys);
+
+  /* Precompute copy plan for mapped particle attributes */
+
+  BFT_REALLOC(_mapped_part_attr_p_displ, _n_mapped_part_attr, size_t);
+  BFT_REALLOC(_mapped_part_attr_e_displ, _n_mapped_part_attr, size_t);
+  BFT_REALLOC(_mapped_part_attr_size, _n_mapped_part_attr, size_t);
+
+  for (i = 0; i < _n_mapped_part_attr; i++) {
+    int attr = _mapped_part_attr[i];
+    _mapped_part_attr_p_displ[i] = p_am->displ[0][attr];
+    _mapped_part_attr_e_displ[i] = _e_attr_map->displ[attr];
+    _mapped_part_attr_size[i] = p_am->size[attr];
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -520,6 +540,9 @@ cs_lagr_event_finalize(void)
     cs_lagr_event_set_destroy(&_boundary_events);
 
   BFT_FREE(_mapped_part_attr);
+  BFT_FREE(_mapped_part_attr_p_displ);
+  BFT_FREE(_mapped_part_attr_e_displ);
+  BFT_FREE(_mapped_part_attr_size);
   _n_mapped_part_attr = 0;
 
   _destroy_attr_map(&_e_attr_map);
@@ -734,26 +757,19 @@ cs_lagr_event_init_from_particle(cs_lagr_event_set_t     *events,
                                  cs_lnum_t                event_id,
                                  cs_lnum_t                particle_id)
 {
-  memset(events->e_buffer + events->e_am->extents*event_id,
-         0,
-         events->e_am->extents);
-
-  for (cs_lnum_t i = 0; i < _n_mapped_part_attr; i++) {
-    int attr = _mapped_part_attr[i];
+  unsigned char *e_buf = events->e_buffer + events->e_am->extents*event_id;
+  const unsigned char *p_buf =   (const unsigned char *)particles->p_buffer
+                               + particles->p_am->extents*particle_id;
 
-    const unsigned char *p_attr = cs_lagr_particles_attr(particles,
-                                                         particle_id,
-                                                         attr);
+  memset(e_buf, 0, events->e_am->extents);
 
-    unsigned char *e_attr = cs_lagr_events_attr(events,
-                                                event_id,
-                                                attr);
+  /* Use copy plan precomputed at initialization, to avoid per-attribute
+     displacement lookups on each event */
 
-    size_t size = particles->p_am->size[attr];
-
-    for (size_t j = 0; j < size; j++)
-      e_attr[j] = p_attr[j];
-  }
+  for (cs_lnum_t i = 0; i < _n_mapped_part_attr; i++)
+    memcpy(e_buf + _mapped_part_attr_e_displ[i],
+           p_buf + _mapped_part_attr_p_displ[i],
+           _mapped_part_attr_size[i]);
 
   cs_lnum_t cell_id = cs_lagr_particles_get_lnum(particles, particle_id,
                                                  CS_LAGR_CELL_ID);
@@ -88,6 +88,46 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Pre-generated injection distribution for a given zone and injection set.
+
+   When the zone element list, the associated weights, and the injection
+   profile cannot vary in time, the cumulative weight distributions built
+   by _distribute_particles are identical from one injection step to the
+   next, so they are built once and cached here; only the random draws
+   against those distributions remain per-step work. */
+
+typedef struct {
+
+  int         loc_id;          /* 0: boundary; 1: volume */
+  int         zone_id;         /* associated zone id */
+  int         set_id;          /* associated injection set id */
+
+  cs_lnum_t   n_elts;          /* local number of zone elements when built,
+                                  or -1 if not built yet */
+  cs_real_t  *elt_cm_weight;   /* cumulative element weights, normalized
+                                  to [0, 1] */
+
+#if defined(HAVE_MPI)
+  double     *rank_cm_weight;  /* cumulative rank weights, normalized to
+                                  [0, 1]; root rank only, NULL if the
+                                  total zone weight is zero */
+#endif
+
+} _injection_dist_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Cached injection distributions */
+
+static int                 _n_dist_caches = 0;
+static _injection_dist_t  *_dist_caches = NULL;
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -133,6 +173,50 @@ _segment_binary_search(cs_lnum_t     n,
   return mid_id;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the cached injection distribution associated with a given
+ *        zone and injection set, creating it empty if not present yet.
+ *
+ * \param[in]  loc_id   0 for boundary injection, 1 for volume injection
+ * \param[in]  zone_id  associated zone id
+ * \param[in]  set_id   associated injection set id
+ *
+ * \return  pointer to cached injection distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+static _injection_dist_t *
+_get_dist_cache(int  loc_id,
+                int  zone_id,
+                int  set_id)
+{
+  for (int i = 0; i < _n_dist_caches; i++) {
+    _injection_dist_t *dist = _dist_caches + i;
+    if (   dist->loc_id == loc_id
+        && dist->zone_id == zone_id
+        && dist->set_id == set_id)
+      return dist;
+  }
+
+  BFT_REALLOC(_dist_caches, _n_dist_caches + 1, _injection_dist_t);
+
+  _injection_dist_t *dist = _dist_caches + _n_dist_caches;
+  _n_dist_caches += 1;
+
+  dist->loc_id = loc_id;
+  dist->zone_id = zone_id;
+  dist->set_id = set_id;
+
+  dist->n_elts = -1;
+  dist->elt_cm_weight = NULL;
+#if defined(HAVE_MPI)
+  dist->rank_cm_weight = NULL;
+#endif
+
+  return dist;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Distribute new particles in a given region.
@@ -143,6 +227,8 @@ _segment_binary_search(cs_lnum_t     n,
  * \param[in]   elt_weight        parent element weights
  *                                (i.e. all local surfaces or volumes)
  * \param[in]   elt_profile       optional profile values for elements (or NULL)
+ * \param[in,out]  dist           cached distribution for this zone and
+ *                                injection set, or NULL
  * \param[out]  elt_particle_idx  start index of added particles for each
  *                                element (size: n_elts + 1)
  *
@@ -151,56 +237,73 @@ _segment_binary_search(cs_lnum_t     n,
 /*----------------------------------------------------------------------------*/
 
 static cs_lnum_t
-_distribute_particles(cs_gnum_t         n_g_particles,
-                      cs_lnum_t         n_elts,
-                      const cs_lnum_t   elt_id[],
-                      const cs_real_t   elt_weight[],
-                      const cs_real_t  *elt_profile,
-                      cs_lnum_t         elt_particle_idx[])
+_distribute_particles(cs_gnum_t           n_g_particles,
+                      cs_lnum_t           n_elts,
+                      const cs_lnum_t     elt_id[],
+                      const cs_real_t     elt_weight[],
+                      const cs_real_t    *elt_profile,
+                      _injection_dist_t  *dist,
+                      cs_lnum_t           elt_particle_idx[])
 {
   cs_lnum_t n_particles = (cs_glob_n_ranks > 1) ? 0 : n_g_particles;
 
-  /* Compute local element weight */
+  bool build = (dist == NULL || dist->n_elts != n_elts);
+
+  /* Compute local element weight, unless a valid cached
+     distribution is available (on all ranks) */
 
   cs_real_t *elt_cm_weight = NULL;
+  double l_weight = 0;
 
-  BFT_MALLOC(elt_cm_weight, n_elts, cs_real_t);
+  if (build) {
 
-  if (elt_id != NULL) {
-    if (elt_profile != NULL) {
-      for (cs_lnum_t i = 0; i < n_elts; i++)
-        elt_cm_weight[i] = elt_weight[elt_id[i]]*elt_profile[i];
-    }
-    else {
-      for (cs_lnum_t i = 0; i < n_elts; i++)
-        elt_cm_weight[i] = elt_weight[elt_id[i]];
+    if (dist != NULL) {
+      BFT_FREE(dist->elt_cm_weight);
+#if defined(HAVE_MPI)
+      BFT_FREE(dist->rank_cm_weight);
+#endif
     }
-  }
-  else {
-    if (elt_profile != NULL) {
-      for (cs_lnum_t i = 0; i < n_elts; i++)
-        elt_cm_weight[i] = elt_weight[i]*elt_profile[i];
+
+    BFT_MALLOC(elt_cm_weight, n_elts, cs_real_t);
+
+    if (elt_id != NULL) {
+      if (elt_profile != NULL) {
+        for (cs_lnum_t i = 0; i < n_elts; i++)
+          elt_cm_weight[i] = elt_weight[elt_id[i]]*elt_profile[i];
+      }
+      else {
+        for (cs_lnum_t i = 0; i < n_elts; i++)
+          elt_cm_weight[i] = elt_weight[elt_id[i]];
+      }
     }
     else {
-      for (cs_lnum_t i = 0; i < n_elts; i++)
-        elt_cm_weight[i] = elt_weight[i];
+      if (elt_profile != NULL) {
+        for (cs_lnum_t i = 0; i < n_elts; i++)
+          elt_cm_weight[i] = elt_weight[i]*elt_profile[i];
+      }
+      else {
+        for (cs_lnum_t i = 0; i < n_elts; i++)
+          elt_cm_weight[i] = elt_weight[i];
+      }
     }
-  }
 
-  /* Transform to cumulative weight using Kahan summation */
+    /* Transform to cumulative weight using Kahan summation */
 
-  double l_weight = 0;
-  {
-    double d = 0., c = 0.;
-    for (cs_lnum_t i = 0; i < n_elts; i++) {
-      double z = elt_cm_weight[i] - c;
-      double t = d + z;
-      c = (t - d) - z;
-      d = t;
-      elt_cm_weight[i] = d;
+    {
+      double d = 0., c = 0.;
+      for (cs_lnum_t i = 0; i < n_elts; i++) {
+        double z = elt_cm_weight[i] - c;
+        double t = d + z;
+        c = (t - d) - z;
+        d = t;
+        elt_cm_weight[i] = d;
+      }
+      l_weight = d;
     }
-    l_weight = d;
+
   }
+  else
+    elt_cm_weight = dist->elt_cm_weight;
 
 #if defined(HAVE_MPI)
 
@@ -222,42 +325,53 @@ _distribute_particles(cs_gnum_t         n_g_particles,
     if (l_rank == r_rank) {
 
       BFT_MALLOC(n_rank_particles, n_ranks, cs_lnum_t);
-      BFT_MALLOC(cm_weight, n_ranks, double);
 
       for (int i = 0; i < n_ranks; i++)
         n_rank_particles[i] = 0;
 
     }
 
-    MPI_Gather(&l_weight, 1, MPI_DOUBLE, cm_weight, 1, MPI_DOUBLE,
-               r_rank, cs_glob_mpi_comm);
+    if (build) {
 
-    if (l_rank == r_rank) {
+      if (l_rank == r_rank)
+        BFT_MALLOC(cm_weight, n_ranks, double);
 
-      /* Scan (cumulative sum) operation */
-      for (int i = 1; i < n_ranks; i++)
-        cm_weight[i] += cm_weight[i-1];
+      MPI_Gather(&l_weight, 1, MPI_DOUBLE, cm_weight, 1, MPI_DOUBLE,
+                 r_rank, cs_glob_mpi_comm);
 
-      /* Scale to [0, 1] */
-      double tot_weight = cm_weight[n_ranks-1];
+      if (l_rank == r_rank) {
 
-      if (tot_weight > 0.) {
+        /* Scan (cumulative sum) operation */
+        for (int i = 1; i < n_ranks; i++)
+          cm_weight[i] += cm_weight[i-1];
 
-        for (int i = 0; i < n_ranks; i++)
-          cm_weight[i] /= tot_weight;
+        /* Scale to [0, 1] */
+        double tot_weight = cm_weight[n_ranks-1];
 
-        /* Compute distribution */
-
-        for (cs_gnum_t i = 0; i < n_g_particles; i++) {
-          cs_real_t r;
-          cs_random_uniform(1, &r);
-          int r_id = _segment_binary_search(n_ranks, r, cm_weight);
-          n_rank_particles[r_id] += 1;
+        if (tot_weight > 0.) {
+          for (int i = 0; i < n_ranks; i++)
+            cm_weight[i] /= tot_weight;
         }
+        else
+          BFT_FREE(cm_weight); /* mark zero total weight */
+
+      }
+
+    }
+    else
+      cm_weight = dist->rank_cm_weight; /* root rank only */
+
+    /* Compute distribution */
+
+    if (l_rank == r_rank && cm_weight != NULL) {
 
+      for (cs_gnum_t i = 0; i < n_g_particles; i++) {
+        cs_real_t r;
+        cs_random_uniform(1, &r);
+        int r_id = _segment_binary_search(n_ranks, r, cm_weight);
+        n_rank_particles[r_id] += 1;
       }
 
-      BFT_FREE(cm_weight);
     }
 
     MPI_Scatter(n_rank_particles, 1, CS_MPI_LNUM,
@@ -265,6 +379,14 @@ _distribute_particles(cs_gnum_t         n_g_particles,
                 r_rank, cs_glob_mpi_comm);
 
     BFT_FREE(n_rank_particles);
+
+    if (build) {
+      if (dist != NULL)
+        dist->rank_cm_weight = cm_weight;
+      else
+        BFT_FREE(cm_weight);
+    }
+
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -280,8 +402,10 @@ _distribute_particles(cs_gnum_t         n_g_particles,
     elt_particle_idx[i] = 0;
   elt_particle_idx[n_elts] = 0;
 
-  for (cs_lnum_t i = 0; i < n_elts; i++)
-    elt_cm_weight[i] /= l_weight;
+  if (build) {
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      elt_cm_weight[i] /= l_weight;
+  }
 
   /* Compute distribution */
 
@@ -292,7 +416,12 @@ _distribute_particles(cs_gnum_t         n_g_particles,
     elt_particle_idx[e_id+1] += 1;
   }
 
-  BFT_FREE(elt_cm_weight);
+  if (dist != NULL) {
+    dist->n_elts = n_elts;
+    dist->elt_cm_weight = elt_cm_weight;
+  }
+  else
+    BFT_FREE(elt_cm_weight);
 
   /* transform count to index */
 
@@ -1486,16 +1615,19 @@ cs_lagr_injection(int        time_id,
 
       cs_lnum_t         n_z_elts = 0;
       const cs_lnum_t  *z_elt_ids = NULL;
+      bool              z_time_varying = false;
 
       if (i_loc == 0) {
         const cs_zone_t  *z = cs_boundary_zone_by_id(z_id);
         n_z_elts = z->n_elts;
         z_elt_ids = z->elt_ids;
+        z_time_varying = z->time_varying;
       }
       else {
         const cs_zone_t  *z = cs_volume_zone_by_id(z_id);
         n_z_elts = z->n_elts;
         z_elt_ids = z->elt_ids;
+        z_time_varying = z->time_varying;
       }
 
       for (int set_id = 0;
@@ -1531,11 +1663,23 @@ cs_lagr_injection(int        time_id,
                                       elt_profile);
         }
 
+        /* The injection distribution may be pre-generated and reused
+           over time steps when it cannot vary in time; as collective
+           operations depend on it, the same choice must be made on
+           all ranks. */
+
+        _injection_dist_t *dist = NULL;
+        if (   elt_profile == NULL
+            && z_time_varying == false
+            && mesh->time_dep == CS_MESH_FIXED)
+          dist = _get_dist_cache(i_loc, z_id, set_id);
+
         cs_lnum_t n_inject = _distribute_particles(zis->n_inject,
                                                    n_z_elts,
                                                    z_elt_ids,
                                                    elt_weight,
                                                    elt_profile,
+                                                   dist,
                                                    elt_particle_idx);
 
         BFT_FREE(elt_profile);
@@ -1559,8 +1703,6 @@ cs_lagr_injection(int        time_id,
                         z_elt_ids,
                         elt_particle_idx);
 
-        BFT_FREE(elt_profile);
-
         /* Initialize other particle attributes */
 
         _init_particles(p_set,
@@ -1765,6 +1907,26 @@ cs_lagr_injection(int        time_id,
   pc->n_g_total += pc->n_g_new;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free pre-generated particle injection distributions.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_injection_finalize(void)
+{
+  for (int i = 0; i < _n_dist_caches; i++) {
+    BFT_FREE(_dist_caches[i].elt_cm_weight);
+#if defined(HAVE_MPI)
+    BFT_FREE(_dist_caches[i].rank_cm_weight);
+#endif
+  }
+
+  BFT_FREE(_dist_caches);
+  _n_dist_caches = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
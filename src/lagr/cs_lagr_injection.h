@@ -59,6 +59,15 @@ cs_lagr_injection(int        time_id,
                   const int  itypfb[],
                   cs_real_t  visc_length[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free pre-generated particle injection distributions.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_injection_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
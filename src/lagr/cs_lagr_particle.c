@@ -1206,6 +1206,150 @@ cs_lagr_particle_set_resize(cs_lnum_t  n_min_particles)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a structure-of-arrays mirror for a given particle set.
+ *
+ * Attribute arrays are allocated upon the first call to
+ * \ref cs_lagr_particle_soa_gather.
+ *
+ * \param[in]  particles  associated particle set
+ *
+ * \return  pointer to new structure-of-arrays particle data mirror
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lagr_particle_soa_t *
+cs_lagr_particle_soa_create(const cs_lagr_particle_set_t  *particles)
+{
+  cs_lagr_particle_soa_t  *soa = NULL;
+
+  BFT_MALLOC(soa, 1, cs_lagr_particle_soa_t);
+
+  soa->n_particles = 0;
+  soa->n_particles_max = 0;
+
+  soa->p_am = particles->p_am;
+
+  for (int attr = 0; attr < CS_LAGR_N_ATTRIBUTES; attr++)
+    soa->val[attr] = NULL;
+
+  return soa;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a structure-of-arrays particle data mirror.
+ *
+ * \param[in, out]  soa  pointer to structure-of-arrays mirror pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_soa_destroy(cs_lagr_particle_soa_t  **soa)
+{
+  if (soa != NULL && *soa != NULL) {
+
+    cs_lagr_particle_soa_t  *_soa = *soa;
+
+    for (int attr = 0; attr < CS_LAGR_N_ATTRIBUTES; attr++)
+      BFT_FREE(_soa->val[attr]);
+
+    BFT_FREE(*soa);
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy current particle data to a structure-of-arrays mirror.
+ *
+ * Attribute arrays are resized if needed.
+ *
+ * \param[in]       particles  associated particle set
+ * \param[in, out]  soa        structure-of-arrays mirror
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_soa_gather(const cs_lagr_particle_set_t  *particles,
+                            cs_lagr_particle_soa_t        *soa)
+{
+  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
+  const cs_lnum_t n_particles = particles->n_particles;
+
+  assert(soa->p_am == p_am);
+
+  if (soa->n_particles_max < n_particles) {
+    soa->n_particles_max = n_particles;
+    for (int attr = 0; attr < CS_LAGR_N_ATTRIBUTES; attr++) {
+      if (p_am->count[0][attr] > 0)
+        BFT_REALLOC(soa->val[attr],
+                    n_particles * p_am->size[attr],
+                    unsigned char);
+    }
+  }
+
+  soa->n_particles = n_particles;
+
+  for (int attr = 0; attr < CS_LAGR_N_ATTRIBUTES; attr++) {
+
+    if (p_am->count[0][attr] < 1)
+      continue;
+
+    const size_t  extents = p_am->extents;
+    const size_t  size = p_am->size[attr];
+    const ptrdiff_t  displ = p_am->displ[0][attr];
+
+    const unsigned char  *src = particles->p_buffer;
+    unsigned char  *dest = soa->val[attr];
+
+#   pragma omp parallel for if (n_particles > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_particles; i++)
+      memcpy(dest + size*i, src + extents*i + displ, size);
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy data from a structure-of-arrays mirror back to the
+ *        associated particle set.
+ *
+ * \param[in]       soa        structure-of-arrays mirror
+ * \param[in, out]  particles  associated particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_soa_scatter(const cs_lagr_particle_soa_t  *soa,
+                             cs_lagr_particle_set_t        *particles)
+{
+  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
+  const cs_lnum_t n_particles = soa->n_particles;
+
+  assert(soa->p_am == p_am);
+  assert(n_particles <= particles->n_particles_max);
+
+  for (int attr = 0; attr < CS_LAGR_N_ATTRIBUTES; attr++) {
+
+    if (p_am->count[0][attr] < 1)
+      continue;
+
+    const size_t  extents = p_am->extents;
+    const size_t  size = p_am->size[attr];
+    const ptrdiff_t  displ = p_am->displ[0][attr];
+
+    const unsigned char  *src = soa->val[attr];
+    unsigned char  *dest = particles->p_buffer;
+
+#   pragma omp parallel for if (n_particles > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_particles; i++)
+      memcpy(dest + extents*i + displ, src + size*i, size);
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set reallocation factor for particle sets.
@@ -247,6 +247,30 @@ typedef struct {
 
 } cs_lagr_particle_set_t;
 
+/* Structure-of-arrays particle data mirror */
+/* ---------------------------------------- */
+
+/* In the main particle set, attributes are interleaved (one record of
+   p_am->extents bytes per particle), which is convenient for particle
+   exchange and reordering but unfavorable for vectorization of kernels
+   accessing only a few attributes. This structure provides an optional
+   structure-of-arrays mirror of the current (time n) particle data, where
+   each attribute occupies its own contiguous array. */
+
+typedef struct {
+
+  cs_lnum_t  n_particles;                     /* number of mirrored
+                                                 particles */
+  cs_lnum_t  n_particles_max;                 /* allocated particles */
+
+  const cs_lagr_attribute_map_t  *p_am;       /* associated attributes map */
+
+  unsigned char  *val[CS_LAGR_N_ATTRIBUTES];  /* per-attribute contiguous
+                                                 arrays, or NULL for absent
+                                                 attributes */
+
+} cs_lagr_particle_soa_t;
+
 /*=============================================================================
  * Global variables
  *============================================================================*/
@@ -396,6 +420,104 @@ cs_lagr_particle_attr_in_range(int  attr);
 cs_lagr_particle_set_t  *
 cs_lagr_get_particle_set(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a structure-of-arrays mirror for a given particle set.
+ *
+ * Attribute arrays are allocated upon the first call to
+ * \ref cs_lagr_particle_soa_gather.
+ *
+ * \param[in]  particles  associated particle set
+ *
+ * \return  pointer to new structure-of-arrays particle data mirror
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lagr_particle_soa_t *
+cs_lagr_particle_soa_create(const cs_lagr_particle_set_t  *particles);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a structure-of-arrays particle data mirror.
+ *
+ * \param[in, out]  soa  pointer to structure-of-arrays mirror pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_soa_destroy(cs_lagr_particle_soa_t  **soa);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy current particle data to a structure-of-arrays mirror.
+ *
+ * Attribute arrays are resized if needed.
+ *
+ * \param[in]       particles  associated particle set
+ * \param[in, out]  soa        structure-of-arrays mirror
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_soa_gather(const cs_lagr_particle_set_t  *particles,
+                            cs_lagr_particle_soa_t        *soa);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy data from a structure-of-arrays mirror back to the
+ *        associated particle set.
+ *
+ * \param[in]       soa        structure-of-arrays mirror
+ * \param[in, out]  particles  associated particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_soa_scatter(const cs_lagr_particle_soa_t  *soa,
+                             cs_lagr_particle_set_t        *particles);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get pointer to the contiguous array associated with a given
+ *        attribute in a structure-of-arrays mirror.
+ *
+ * \param[in]  soa   structure-of-arrays mirror
+ * \param[in]  attr  requested attribute id
+ *
+ * \return  pointer to contiguous attribute data
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static void *
+cs_lagr_particle_soa_attr(cs_lagr_particle_soa_t  *soa,
+                          cs_lagr_attribute_t      attr)
+{
+  assert(soa->p_am->count[0][attr] > 0);
+
+  return soa->val[attr];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get const pointer to the contiguous array associated with a given
+ *        attribute in a structure-of-arrays mirror.
+ *
+ * \param[in]  soa   structure-of-arrays mirror
+ * \param[in]  attr  requested attribute id
+ *
+ * \return  const pointer to contiguous attribute data
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static const void *
+cs_lagr_particle_soa_attr_const(const cs_lagr_particle_soa_t  *soa,
+                                cs_lagr_attribute_t            attr)
+{
+  assert(soa->p_am->count[0][attr] > 0);
+
+  return soa->val[attr];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Get pointer to a current attribute of a given particle in a set.
@@ -0,0 +1,447 @@
+/*============================================================================
+ * Methods for particle population (merge/split) control
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <float.h>
+#include <assert.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+
+#include "cs_math.h"
+
+#include "cs_lagr.h"
+#include "cs_lagr_particle.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_lagr_population.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Structure Definitions
+ *============================================================================*/
+
+/* Sorting key used to cluster parcels with similar diameters */
+
+typedef struct {
+
+  cs_real_t  diam;   /* parcel diameter */
+  cs_lnum_t  id;     /* particle id in main set */
+
+} _merge_key_t;
+
+/*=============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compare two merge keys by diameter (for qsort).
+ *
+ * \param[in]  a  pointer to first key
+ * \param[in]  b  pointer to second key
+ *
+ * \return -1, 0, or 1 if a is less than, equal to, or greater than b
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_compare_merge_keys(const void  *a,
+                    const void  *b)
+{
+  const _merge_key_t *ka = a;
+  const _merge_key_t *kb = b;
+
+  if (ka->diam < kb->diam)
+    return -1;
+  else if (ka->diam > kb->diam)
+    return 1;
+  else
+    return (ka->id < kb->id) ? -1 : 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Merge a source parcel into a destination parcel.
+ *
+ * The number of physical particles (statistical weight), their total
+ * mass and momentum, and the total volume of physical particles are
+ * conserved; the merged position is the mass-weighted mean position.
+ * Other attributes keep the values of the destination parcel.
+ *
+ * The source parcel is flagged for deletion.
+ *
+ * \param[in, out]  p_set  pointer to particle set
+ * \param[in]       dest   id of destination parcel
+ * \param[in]       src    id of source parcel
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_merge_parcels(cs_lagr_particle_set_t  *p_set,
+               cs_lnum_t                dest,
+               cs_lnum_t                src)
+{
+  const cs_real_t w_d
+    = cs_lagr_particles_get_real(p_set, dest, CS_LAGR_STAT_WEIGHT);
+  const cs_real_t w_s
+    = cs_lagr_particles_get_real(p_set, src, CS_LAGR_STAT_WEIGHT);
+
+  const cs_real_t m_d = cs_lagr_particles_get_real(p_set, dest, CS_LAGR_MASS);
+  const cs_real_t m_s = cs_lagr_particles_get_real(p_set, src, CS_LAGR_MASS);
+
+  const cs_real_t d_d
+    = cs_lagr_particles_get_real(p_set, dest, CS_LAGR_DIAMETER);
+  const cs_real_t d_s
+    = cs_lagr_particles_get_real(p_set, src, CS_LAGR_DIAMETER);
+
+  const cs_real_t w = w_d + w_s;
+  const cs_real_t wm = w_d*m_d + w_s*m_s;
+
+  assert(w > 0);
+
+  /* Mass and diameter: conserve total mass and volume of
+     physical particles */
+
+  cs_lagr_particles_set_real(p_set, dest, CS_LAGR_MASS, wm / w);
+
+  cs_lagr_particles_set_real
+    (p_set, dest, CS_LAGR_DIAMETER,
+     cbrt((w_d*cs_math_pow3(d_d) + w_s*cs_math_pow3(d_s)) / w));
+
+  /* Velocities and position: conserve momentum, using mass-weighted
+     means (weight-based means if parcel masses are not positive) */
+
+  const cs_real_t c_d = (wm > 0) ? w_d*m_d / wm : w_d / w;
+  const cs_real_t c_s = (wm > 0) ? w_s*m_s / wm : w_s / w;
+
+  static const cs_lagr_attribute_t v_attrs[3] = {CS_LAGR_COORDS,
+                                                 CS_LAGR_VELOCITY,
+                                                 CS_LAGR_VELOCITY_SEEN};
+
+  for (int a_id = 0; a_id < 3; a_id++) {
+    cs_real_t *v_d = cs_lagr_particles_attr(p_set, dest, v_attrs[a_id]);
+    const cs_real_t *v_s
+      = cs_lagr_particles_attr_const(p_set, src, v_attrs[a_id]);
+    for (int i = 0; i < 3; i++)
+      v_d[i] = c_d*v_d[i] + c_s*v_s[i];
+  }
+
+  /* Residence time: weight-based mean */
+
+  const cs_real_t t_d
+    = cs_lagr_particles_get_real(p_set, dest, CS_LAGR_RESIDENCE_TIME);
+  const cs_real_t t_s
+    = cs_lagr_particles_get_real(p_set, src, CS_LAGR_RESIDENCE_TIME);
+
+  cs_lagr_particles_set_real(p_set, dest, CS_LAGR_RESIDENCE_TIME,
+                             (w_d*t_d + w_s*t_s) / w);
+
+  cs_lagr_particles_set_real(p_set, dest, CS_LAGR_STAT_WEIGHT, w);
+
+  /* As for agglomeration, zero the weight of the removed parcel so
+     weight-based accumulations ignore it until it is deleted by the
+     next tracking pass */
+
+  cs_lagr_particles_set_real(p_set, src, CS_LAGR_STAT_WEIGHT, 0);
+  cs_lagr_particles_set_flag(p_set, src, CS_LAGR_PART_TO_DELETE);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Merge parcels in a cell until its parcel count matches the budget.
+ *
+ * Parcels are sorted by diameter, and each parcel is merged into the
+ * current accumulator parcel while the maximum statistical weight is not
+ * exceeded, so only parcels of similar size are combined.
+ *
+ * \param[in, out]  p_set       pointer to particle set
+ * \param[in]       s_id        id of first particle in cell
+ * \param[in]       e_id        id after last particle in cell
+ * \param[in]       n_budget    maximum number of parcels in cell
+ * \param[in]       max_weight  maximum statistical weight of a merged
+ *                              parcel (<= 0: no limit)
+ *
+ * \return  number of merged (removed) parcels
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_merge_cell(cs_lagr_particle_set_t  *p_set,
+            cs_lnum_t                s_id,
+            cs_lnum_t                e_id,
+            cs_lnum_t                n_budget,
+            cs_real_t                max_weight,
+            _merge_key_t             keys[])
+{
+  cs_lnum_t n_alive = 0;
+
+  for (cs_lnum_t p_id = s_id; p_id < e_id; p_id++) {
+    if (cs_lagr_particles_get_flag(p_set, p_id, CS_LAGR_PART_TO_DELETE))
+      continue;
+    keys[n_alive].diam
+      = cs_lagr_particles_get_real(p_set, p_id, CS_LAGR_DIAMETER);
+    keys[n_alive].id = p_id;
+    n_alive++;
+  }
+
+  if (n_alive <= n_budget)
+    return 0;
+
+  qsort(keys, n_alive, sizeof(_merge_key_t), _compare_merge_keys);
+
+  const cs_lnum_t n_to_remove = n_alive - n_budget;
+  cs_lnum_t n_removed = 0;
+
+  cs_lnum_t acc = keys[0].id;
+
+  for (cs_lnum_t k = 1; k < n_alive && n_removed < n_to_remove; k++) {
+
+    cs_lnum_t p_id = keys[k].id;
+
+    if (max_weight > 0) {
+      cs_real_t w =   cs_lagr_particles_get_real(p_set, acc,
+                                                 CS_LAGR_STAT_WEIGHT)
+                    + cs_lagr_particles_get_real(p_set, p_id,
+                                                 CS_LAGR_STAT_WEIGHT);
+      if (w > max_weight) {
+        acc = p_id;  /* start a new cluster */
+        continue;
+      }
+    }
+
+    _merge_parcels(p_set, acc, p_id);
+    n_removed++;
+
+  }
+
+  return n_removed;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply statistical-weight-based particle population control.
+ *
+ * In cells where the number of parcels exceeds the configured budget,
+ * parcels with similar diameters are merged into weighted parcels,
+ * conserving the number of physical particles, their total mass, and
+ * their momentum. Parcels whose statistical weight exceeds the
+ * configured splitting weight are split, for variance control.
+ *
+ * Cell sub-lists are built from runs of particles with the same cell id,
+ * so population control is most effective when particles in the same
+ * cell are contiguous in the particle list (as assumed for
+ * agglomeration); with a partially sorted list, merging simply degrades
+ * to operating on each contiguous run.
+ *
+ * Settings are defined in \ref cs_glob_lagr_population_model.
+ *
+ * \param[in, out]  p_set  pointer to particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_population_control(cs_lagr_particle_set_t  *p_set)
+{
+  const cs_lagr_population_model_t *pm = cs_glob_lagr_population_model;
+
+  const cs_lnum_t n_budget = pm->n_cell_budget;
+  const cs_real_t max_weight = pm->max_stat_weight;
+  const cs_real_t split_weight = pm->split_stat_weight;
+
+  if (n_budget < 1 && split_weight <= 0)
+    return;
+
+  const cs_lnum_t n_particles = p_set->n_particles;
+
+  if (n_particles < 1)
+    return;
+
+  /* Build ranges of particles sharing the same cell */
+
+  cs_lnum_t n_ranges = 1;
+
+  {
+    cs_lnum_t prev_cell_id
+      = cs_lagr_particles_get_lnum(p_set, 0, CS_LAGR_CELL_ID);
+    for (cs_lnum_t p_id = 1; p_id < n_particles; p_id++) {
+      cs_lnum_t cell_id
+        = cs_lagr_particles_get_lnum(p_set, p_id, CS_LAGR_CELL_ID);
+      if (cell_id != prev_cell_id)
+        n_ranges++;
+      prev_cell_id = cell_id;
+    }
+  }
+
+  cs_lnum_t *range_index;
+  BFT_MALLOC(range_index, n_ranges+1, cs_lnum_t);
+
+  {
+    cs_lnum_t r_id = 0;
+    range_index[0] = 0;
+    cs_lnum_t prev_cell_id
+      = cs_lagr_particles_get_lnum(p_set, 0, CS_LAGR_CELL_ID);
+    for (cs_lnum_t p_id = 1; p_id < n_particles; p_id++) {
+      cs_lnum_t cell_id
+        = cs_lagr_particles_get_lnum(p_set, p_id, CS_LAGR_CELL_ID);
+      if (cell_id != prev_cell_id) {
+        r_id++;
+        range_index[r_id] = p_id;
+      }
+      prev_cell_id = cell_id;
+    }
+    range_index[n_ranges] = n_particles;
+  }
+
+  /* Merge parcels where the cell budget is exceeded; ranges are
+     independent (each range only modifies its own particles), so
+     they may be handled in parallel */
+
+  if (n_budget >= 1) {
+
+#   pragma omp parallel if (n_ranges > 1)
+    {
+      cs_lnum_t max_range_size = 0;
+      _merge_key_t *keys = NULL;
+
+#     pragma omp for schedule(dynamic, 32)
+      for (cs_lnum_t r_id = 0; r_id < n_ranges; r_id++) {
+
+        cs_lnum_t s_id = range_index[r_id];
+        cs_lnum_t e_id = range_index[r_id+1];
+
+        if (e_id - s_id <= n_budget)
+          continue;
+
+        if (e_id - s_id > max_range_size) {
+          max_range_size = e_id - s_id;
+          BFT_REALLOC(keys, max_range_size, _merge_key_t);
+        }
+
+        _merge_cell(p_set, s_id, e_id, n_budget, max_weight, keys);
+
+      }
+
+      BFT_FREE(keys);
+    }
+
+  }
+
+  /* Split parcels with large statistical weights; new parcels are
+     appended to the set, so this pass remains serial */
+
+  if (split_weight > 0) {
+
+    cs_lnum_t n_new = 0;
+
+    for (cs_lnum_t r_id = 0; r_id < n_ranges; r_id++) {
+
+      cs_lnum_t s_id = range_index[r_id];
+      cs_lnum_t e_id = range_index[r_id+1];
+
+      cs_lnum_t n_in_cell = 0;
+      for (cs_lnum_t p_id = s_id; p_id < e_id; p_id++) {
+        if (! cs_lagr_particles_get_flag(p_set, p_id,
+                                         CS_LAGR_PART_TO_DELETE))
+          n_in_cell++;
+      }
+
+      for (cs_lnum_t p_id = s_id; p_id < e_id; p_id++) {
+
+        if (cs_lagr_particles_get_flag(p_set, p_id, CS_LAGR_PART_TO_DELETE))
+          continue;
+
+        cs_real_t w
+          = cs_lagr_particles_get_real(p_set, p_id, CS_LAGR_STAT_WEIGHT);
+
+        if (w <= split_weight)
+          continue;
+
+        /* Number of added parcels, so that children weights do not
+           exceed the splitting weight, while respecting the remaining
+           cell budget */
+
+        cs_lnum_t n_add = (cs_lnum_t)(w / split_weight);
+        if (n_budget >= 1 && n_add > n_budget - n_in_cell)
+          n_add = n_budget - n_in_cell;
+
+        if (n_add < 1)
+          continue;
+
+        cs_real_t w_child = w / (n_add + 1);
+
+        cs_lagr_particle_set_resize(p_set->n_particles + n_new + n_add);
+
+        for (cs_lnum_t i = 0; i < n_add; i++) {
+          cs_lagr_part_copy(p_set->n_particles + n_new + i, p_id);
+          cs_lagr_particles_set_real(p_set, p_set->n_particles + n_new + i,
+                                     CS_LAGR_STAT_WEIGHT, w_child);
+        }
+
+        cs_lagr_particles_set_real(p_set, p_id, CS_LAGR_STAT_WEIGHT, w_child);
+
+        n_new += n_add;
+        n_in_cell += n_add;
+
+      }
+
+    }
+
+    p_set->n_particles += n_new;
+
+  }
+
+  BFT_FREE(range_index);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
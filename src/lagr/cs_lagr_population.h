@@ -0,0 +1,69 @@
+#ifndef __CS_LAGR_POPULATION_H__
+#define __CS_LAGR_POPULATION_H__
+
+/*============================================================================
+ * Methods for particle population (merge/split) control
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_lagr_particle.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply statistical-weight-based particle population control.
+ *
+ * In cells where the number of parcels exceeds the configured budget,
+ * parcels with similar diameters are merged into weighted parcels,
+ * conserving the number of physical particles, their total mass, and
+ * their momentum. Parcels whose statistical weight exceeds the
+ * configured splitting weight are split, for variance control.
+ *
+ * Settings are defined in \ref cs_glob_lagr_population_model.
+ *
+ * \param[in, out]  p_set  pointer to particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_population_control(cs_lagr_particle_set_t  *p_set);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_LAGR_POPULATION_H__ */
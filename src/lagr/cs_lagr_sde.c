@@ -144,6 +144,233 @@ _add_resuspension_event(cs_lagr_event_set_t     *events,
   events->n_events += 1;
 }
 
+/*----------------------------------------------------------------------------*/
+/*! \brief Integration of SDEs by 1st order time scheme, in the global
+ *         reference frame, over blocks of particles.
+ *
+ * This is a batched variant of the generic 1st order integration, usable
+ * when no change of reference frame, Brownian motion, or T_lag gradient
+ * term is needed. Cell-based fluid quantities are gathered once per block,
+ * and the characteristic-time exponentials are computed over contiguous
+ * arrays so that those loops may be vectorized.
+ *
+ * \param[in]  dtp      time step
+ * \param[in]  taup     dynamic characteristic time
+ * \param[in]  tlag     lagrangian fluid characteristic time
+ * \param[in]  piil     term in integration of UP SDEs
+ * \param[in]  bx       caracteristiques de la turbulence
+ * \param[in]  vagaus   gaussian random variables
+ * \param[in]  force_p  taup times forces on particles (m/s)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_lages1_no_frame_change(cs_real_t           dtp,
+                        const cs_real_t     taup[],
+                        const cs_real_3_t   tlag[],
+                        const cs_real_3_t   piil[],
+                        const cs_real_33_t  bx[],
+                        const cs_real_33_t  vagaus[],
+                        const cs_real_3_t   force_p[])
+{
+  /* Particles management */
+  cs_lagr_particle_set_t  *p_set = cs_glob_lagr_particle_set;
+  const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
+
+  cs_lagr_extra_module_t *extra = cs_get_lagr_extra_module();
+
+  cs_lnum_t nor = cs_glob_lagr_time_step->nor;
+  const int _prev_id = (extra->vel->n_time_vals > 1) ? 1 : 0;
+
+  const cs_real_3_t *cvar_vel
+    = (const cs_real_3_t *)(extra->vel->vals[_prev_id]);
+
+  const cs_lnum_t block_size = 64;
+
+  cs_lnum_t n_particles_prev = p_set->n_particles - p_set->n_part_new;
+
+# pragma omp parallel for if(n_particles_prev > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_particles_prev; s_id += block_size) {
+
+    cs_lnum_t e_id = CS_MIN(s_id + block_size, n_particles_prev);
+    cs_lnum_t b_size = e_id - s_id;
+
+    bool       b_active[64];
+    cs_real_t  b_tci[64][3];
+    cs_real_t  b_aux1[64][3];
+    cs_real_t  b_aux2[64][3];
+
+    /* Gather cell-based fluid quantities for the block */
+
+    for (cs_lnum_t i = 0; i < b_size; i++) {
+      cs_lnum_t ip = s_id + i;
+      cs_lnum_t cell_id = cs_lagr_particles_get_lnum(p_set, ip,
+                                                     CS_LAGR_CELL_ID);
+      if (   cell_id < 0
+          || cs_lagr_particles_get_flag(p_set, ip, CS_LAGR_PART_FIXED)) {
+        b_active[i] = false;
+        continue;
+      }
+      b_active[i] = true;
+      for (cs_lnum_t id = 0; id < 3; id++)
+        b_tci[i][id] = piil[cell_id][id]*tlag[ip][id] + cvar_vel[cell_id][id];
+    }
+
+    /* Characteristic-time exponentials, over contiguous arrays */
+
+    for (cs_lnum_t i = 0; i < b_size; i++) {
+      cs_lnum_t ip = s_id + i;
+      for (cs_lnum_t id = 0; id < 3; id++) {
+        b_aux1[i][id] = exp(-dtp / taup[ip]);
+        b_aux2[i][id] = exp(-dtp / tlag[ip][id]);
+      }
+    }
+
+    /* Remaining terms and update, per particle */
+
+    for (cs_lnum_t i = 0; i < b_size; i++) {
+
+      if (b_active[i] == false)
+        continue;
+
+      cs_lnum_t ip = s_id + i;
+
+      unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
+
+      cs_real_t *old_part_vel
+        = cs_lagr_particle_attr_n(particle, p_am, 1, CS_LAGR_VELOCITY);
+      cs_real_t *old_part_vel_seen
+        = cs_lagr_particle_attr_n(particle, p_am, 1, CS_LAGR_VELOCITY_SEEN);
+      cs_real_t *old_part_coords
+        = cs_lagr_particle_attr_n(particle, p_am, 1, CS_LAGR_COORDS);
+      cs_real_t *part_vel
+        = cs_lagr_particle_attr(particle, p_am, CS_LAGR_VELOCITY);
+      cs_real_t *part_vel_seen
+        = cs_lagr_particle_attr(particle, p_am, CS_LAGR_VELOCITY_SEEN);
+      cs_real_t *part_coords
+        = cs_lagr_particle_attr(particle, p_am, CS_LAGR_COORDS);
+
+      for (cs_lnum_t id = 0; id < 3; id++) {
+
+        cs_real_t taup_r = taup[ip];
+        cs_real_t tlag_r = tlag[ip][id];
+
+        cs_real_t tci = b_tci[i][id];
+        cs_real_t force = force_p[ip][id];
+
+        /* Deterministic coefficients/terms */
+
+        cs_real_t aux1 = b_aux1[i][id];
+        cs_real_t aux2 = b_aux2[i][id];
+        cs_real_t aux3 = tlag_r / (tlag_r - taup_r);
+        cs_real_t aux4 = tlag_r / (tlag_r + taup_r);
+        cs_real_t aux5 = tlag_r * (1.0 - aux2);
+        cs_real_t aux6 = cs_math_pow2(bx[ip][id][nor-1]) * tlag_r;
+        cs_real_t aux7 = tlag_r - taup_r;
+        cs_real_t aux8 =   cs_math_pow2(bx[ip][id][nor-1])
+                         * cs_math_pow2(aux3); //FIXME when taup = TL
+
+        /* --> trajectory terms */
+        cs_real_t aa = taup_r * (1.0 - aux1);
+        cs_real_t bb = (aux5 - aa) * aux3;
+        cs_real_t cc = dtp - aa - bb;
+
+        cs_real_t ter1x = aa * old_part_vel[id];
+        cs_real_t ter2x = bb * old_part_vel_seen[id];
+        cs_real_t ter3x = cc * tci;
+        cs_real_t ter4x = (dtp - aa) * force;
+
+        /* Flow-seen velocity terms */
+        cs_real_t ter1f = old_part_vel_seen[id] * aux2;
+        cs_real_t ter2f = tci * (1.0 - aux2);
+
+        /* Terms for particle velocity */
+        cs_real_t dd = aux3 * (aux2 - aux1); //FIXME DL when small
+        cs_real_t ee = 1.0 - aux1;
+
+        cs_real_t ter1p = old_part_vel[id] * aux1;
+        cs_real_t ter2p = old_part_vel_seen[id] * dd;
+        cs_real_t ter3p = tci * (ee - dd);
+        cs_real_t ter4p = force * ee;
+
+        /* Integral on flow velocity seen */
+        cs_real_t gama2 = 0.5 * (1.0 - aux2 * aux2);
+        cs_real_t p11   = sqrt(gama2 * aux6);
+        cs_real_t ter3f = p11 * vagaus[ip][id][0];
+
+        /* Integral for the particles velocity */
+        cs_real_t aux9  = 0.5 * tlag_r * (1.0 - aux2 * aux2);
+        cs_real_t aux10 = 0.5 * taup_r * (1.0 - aux1 * aux1);
+        cs_real_t aux11 =   taup_r * tlag_r
+                          * (1.0 - aux1 * aux2)
+                          / (taup_r + tlag_r);
+
+        cs_real_t grga2 = (aux9 - 2.0 * aux11 + aux10) * aux8;
+        cs_real_t gagam = (aux9 - aux11) * (aux8 / aux3);
+
+        cs_real_t p21, p22;
+        if (CS_ABS(p11) > cs_math_epzero) {
+          p21 = gagam / p11;
+          p22 = grga2 - cs_math_pow2(p21);
+          p22 = sqrt(CS_MAX(0.0, p22));
+        }
+        else {
+          p21 = 0.0;
+          p22 = 0.0;
+        }
+
+        cs_real_t ter5p = p21 * vagaus[ip][id][0] + p22 * vagaus[ip][id][1];
+
+        /* Compute coefficients for stochastic integrals */
+        /* integral on the particle position */
+        cs_real_t gaome = ( (tlag_r - taup_r) * (aux5 - aa)
+                            - tlag_r * aux9
+                            - taup_r * aux10
+                            + (tlag_r + taup_r) * aux11)
+                          * aux8;
+        cs_real_t omegam = aux3 * (  (tlag_r - taup_r) * (1.0 - aux2)
+                                   - 0.5 * tlag_r * (1.0 - aux2 * aux2)
+                                   + cs_math_pow2(taup_r) / (tlag_r + taup_r)
+                                   * (1.0 - aux1 * aux2)) * aux6;
+        cs_real_t omega2 =   aux7 * (  aux7 * dtp
+                                     - 2.0 * (tlag_r * aux5 - taup_r * aa))
+                           + 0.5 * tlag_r * tlag_r * aux5 * (1.0 + aux2)
+                           + 0.5 * taup_r * taup_r * aa * (1.0 + aux1)
+                           - 2.0 * aux4 * tlag_r * taup_r * taup_r
+                                 * (1.0 - aux1 * aux2);
+        omega2 = aux8 * omega2;
+
+        cs_real_t p31, p32;
+        if (p11 > cs_math_epzero)
+          p31 = omegam / p11;
+        else
+          p31 = 0.0;
+
+        if (p22 > cs_math_epzero)
+          p32 = (gaome - p31 * p21) / p22;
+        else
+          p32 = 0.0;
+
+        cs_real_t p33 = omega2 - cs_math_pow2(p31) - cs_math_pow2(p32);
+        p33 = sqrt(CS_MAX(0.0, p33));
+        cs_real_t ter5x =   p31 * vagaus[ip][id][0]
+                          + p32 * vagaus[ip][id][1]
+                          + p33 * vagaus[ip][id][2];
+
+        /* Finalize increments */
+
+        part_coords[id] =   old_part_coords[id]
+                          + ter1x + ter2x + ter3x + ter4x + ter5x;
+        part_vel[id] = ter1p + ter2p + ter3p + ter4p + ter5p;
+        part_vel_seen[id] = ter1f + ter2f + ter3f;
+
+      }
+
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*! \brief Integration of SDEs by 1st order time scheme
  *
@@ -223,6 +450,17 @@ _lages1(cs_real_t           dtp,
                                        0, -1);
   }
 
+  /* Batched fast path when no change of reference frame is needed and
+     neither Brownian motion nor T_lag gradient terms are active */
+
+  if (   local_reference_frame == false
+      && beta == NULL
+      && cs_glob_lagr_brownian->lamvbr == 0
+      && cs_glob_lagr_time_scheme->interpol_field != 1) {
+    _lages1_no_frame_change(dtp, taup, tlag, piil, bx, vagaus, force_p);
+    return;
+  }
+
   /* Integrate SDE's over particles
    * Note: new particles will be integrated at the next time step, otherwise
    * positions might be overwritten */
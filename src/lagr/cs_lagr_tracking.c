@@ -180,6 +180,12 @@ typedef struct {
   cs_lnum_t  *recv_count;     /* number of particles to receive from
                                  each communicating rank */
 
+  cs_lnum_t  *send_count_pack; /* number of particles already packed into
+                                  the send buffer for each communicating
+                                  rank; send_count itself may not be
+                                  modified while the (nonblocking) counter
+                                  exchange it is part of is in flight */
+
   cs_lnum_t  *send_shift;
   cs_lnum_t  *recv_shift;
 
@@ -188,6 +194,9 @@ typedef struct {
 #if defined(HAVE_MPI)
   MPI_Request  *request;
   MPI_Status   *status;
+
+  int          counter_request_count;  /* number of requests of the
+                                          in-flight counter exchange */
 #endif
 
 } cs_lagr_halo_t;
@@ -490,6 +499,8 @@ _create_lagr_halo(size_t  extents)
   BFT_MALLOC(lagr_halo->recv_shift, halo->n_c_domains, cs_lnum_t);
   BFT_MALLOC(lagr_halo->recv_count, halo->n_c_domains, cs_lnum_t);
 
+  BFT_MALLOC(lagr_halo->send_count_pack, halo->n_c_domains, cs_lnum_t);
+
   lagr_halo->send_buf_size = CS_LAGR_MIN_COMM_BUF_SIZE;
 
   BFT_MALLOC(lagr_halo->send_buf,
@@ -504,6 +515,8 @@ _create_lagr_halo(size_t  extents)
     BFT_MALLOC(lagr_halo->request, request_size, MPI_Request);
     BFT_MALLOC(lagr_halo->status,  request_size, MPI_Status);
 
+    lagr_halo->counter_request_count = 0;
+
   }
 #endif
 
@@ -601,6 +614,8 @@ _delete_lagr_halo(cs_lagr_halo_t   **halo)
     BFT_FREE(h->recv_shift);
     BFT_FREE(h->recv_count);
 
+    BFT_FREE(h->send_count_pack);
+
 #if defined(HAVE_MPI)
     if (cs_glob_n_ranks > 1) {
       BFT_FREE(h->request);
@@ -2255,7 +2270,13 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
 }
 
 /*----------------------------------------------------------------------------
- * Exchange counters on the number of particles to send and to receive
+ * Start the exchange of counters on the number of particles to send and
+ * to receive.
+ *
+ * The counter exchange is nonblocking, so the local send buffer packing
+ * may proceed while counters are in transit; it must be completed by
+ * _exchange_counter_finish before the received counts are used, and
+ * lag_halo->send_count may not be modified in the meantime.
  *
  * parameters:
  *  halo        <--  pointer to a cs_halo_t structure
@@ -2263,11 +2284,9 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
  *----------------------------------------------------------------------------*/
 
 static void
-_exchange_counter(const cs_halo_t  *halo,
-                  cs_lagr_halo_t   *lag_halo)
+_exchange_counter_start(const cs_halo_t  *halo,
+                        cs_lagr_halo_t   *lag_halo)
 {
-  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
-
 #if defined(HAVE_MPI)
   if (cs_glob_n_ranks > 1) {
 
@@ -2287,18 +2306,9 @@ _exchange_counter(const cs_halo_t  *halo,
                   halo->c_domain_rank[rank],
                   cs_glob_mpi_comm,
                   &(lag_halo->request[request_count++]));
-      else
-        local_rank_id = rank;
 
     }
 
-    /* We wait for posting all receives
-       (often recommended in the past, apparently not anymore) */
-
-#if 0
-    MPI_Barrier(cs_glob_mpi_comm)
-#endif
-
     /* Send data to distant ranks */
 
     for (rank = 0; rank < halo->n_c_domains; rank++) {
@@ -2316,9 +2326,43 @@ _exchange_counter(const cs_halo_t  *halo,
 
     }
 
+    lag_halo->counter_request_count = request_count;
+
+  }
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Complete the exchange of counters on the number of particles to send
+ * and to receive, started by _exchange_counter_start.
+ *
+ * parameters:
+ *  halo        <--  pointer to a cs_halo_t structure
+ *  lag_halo    <--  pointer to a cs_lagr_halo_t structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_counter_finish(const cs_halo_t  *halo,
+                         cs_lagr_halo_t   *lag_halo)
+{
+  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+
+    const int  local_rank = cs_glob_rank_id;
+
     /* Wait for all exchanges */
 
-    MPI_Waitall(request_count, lag_halo->request, lag_halo->status);
+    MPI_Waitall(lag_halo->counter_request_count,
+                lag_halo->request, lag_halo->status);
+
+    lag_halo->counter_request_count = 0;
+
+    for (int rank = 0; rank < halo->n_c_domains; rank++) {
+      if (halo->c_domain_rank[rank] == local_rank)
+        local_rank_id = rank;
+    }
 
   }
 #endif /* defined(HAVE_MPI) */
@@ -2487,7 +2531,7 @@ _lagr_halo_count(const cs_mesh_t               *mesh,
 {
   cs_lnum_t  i, ghost_id;
 
-  cs_lnum_t  n_recv_particles = 0, n_send_particles = 0;
+  cs_lnum_t  n_send_particles = 0;
 
   const cs_halo_t  *halo = mesh->halo;
 
@@ -2514,46 +2558,83 @@ _lagr_halo_count(const cs_mesh_t               *mesh,
 
   } /* End of loop on particles */
 
-  /* Exchange counters */
+  /* Start counter exchange; received counts are only needed once the send
+     buffer has been packed, so the exchange overlaps the packing loop. */
 
-  _exchange_counter(halo, lag_halo);
+  _exchange_counter_start(halo, lag_halo);
 
-  for (i = 0; i < halo->n_c_domains; i++) {
-    n_recv_particles += lag_halo->recv_count[i];
+  for (i = 0; i < halo->n_c_domains; i++)
     n_send_particles += lag_halo->send_count[i];
-  }
 
   lag_halo->send_shift[0] = 0;
-  lag_halo->recv_shift[0] = 0;
-
-  for (i = 1; i < halo->n_c_domains; i++) {
 
+  for (i = 1; i < halo->n_c_domains; i++)
     lag_halo->send_shift[i] =  lag_halo->send_shift[i-1]
                              + lag_halo->send_count[i-1];
 
+  /* Resize halo's send buffer only if needed */
+
+  _resize_lagr_halo(lag_halo, n_send_particles);
+}
+
+/*----------------------------------------------------------------------------
+ * Complete the counter update for particle halo synchronization, and
+ * resize the particle set so received particles may be appended.
+ *
+ * parameters:
+ *   mesh      <-- pointer to associated mesh
+ *   lag_halo  <-> pointer to particle halo structure to update
+ *   particles <-- set of particles to update
+ *----------------------------------------------------------------------------*/
+
+static void
+_lagr_halo_count_finish(const cs_mesh_t               *mesh,
+                        cs_lagr_halo_t                *lag_halo,
+                        const cs_lagr_particle_set_t  *particles)
+{
+  cs_lnum_t  i;
+
+  cs_lnum_t  n_recv_particles = 0;
+
+  const cs_halo_t  *halo = mesh->halo;
+
+  _exchange_counter_finish(halo, lag_halo);
+
+  for (i = 0; i < halo->n_c_domains; i++)
+    n_recv_particles += lag_halo->recv_count[i];
+
+  lag_halo->recv_shift[0] = 0;
+
+  for (i = 1; i < halo->n_c_domains; i++)
     lag_halo->recv_shift[i] =  lag_halo->recv_shift[i-1]
                              + lag_halo->recv_count[i-1];
 
-  }
-
-  /* Resize particle set and/or halo only if needed */
+  /* Resize particle set only if needed */
 
   cs_lagr_particle_set_resize(particles->n_particles + n_recv_particles);
-  _resize_lagr_halo(lag_halo, n_send_particles);
 }
 
 /*----------------------------------------------------------------------------
  * Update particle sets, including halo synchronization.
  *
+ * As particles remaining on the local domain are compacted at the head of
+ * the set and particles received from other ranks (the only ones still
+ * requiring displacement) are appended behind them, the index of the first
+ * particle which may need another displacement step is also returned, so
+ * the caller may restrict the next propagation pass to that range.
+ *
  * parameters:
- *   particles <-> set of particles to update
+ *   particles     <-> set of particles to update
+ *   first_sync_id --> lowest id of particles which may still need
+ *                     displacement
  *
  * returns:
  *   1 if displacement needs to continue, 0 if finished
  *----------------------------------------------------------------------------*/
 
 static int
-_sync_particle_set(cs_lagr_particle_set_t  *particles)
+_sync_particle_set(cs_lagr_particle_set_t  *particles,
+                   cs_lnum_t               *first_sync_id)
 {
   cs_lnum_t  i, k, tr_id, rank, shift, ghost_id;
   cs_real_t matrix[3][4];
@@ -2588,7 +2669,7 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
     _lagr_halo_count(mesh, lag_halo, particles);
 
     for (i = 0; i < halo->n_c_domains; i++) {
-      lag_halo->send_count[i] = 0;
+      lag_halo->send_count_pack[i] = 0;
     }
   }
 
@@ -2617,7 +2698,7 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
       cs_lagr_particles_set_lnum(particles, i, CS_LAGR_CELL_ID,
                                  lag_halo->dist_cell_id[ghost_id]);
 
-      shift = lag_halo->send_shift[rank] + lag_halo->send_count[rank];
+      shift = lag_halo->send_shift[rank] + lag_halo->send_count_pack[rank];
 
       /* Update if needed last_face_num */
 
@@ -2740,7 +2821,7 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
              particles->p_buffer + extents*i,
              extents);
 
-      lag_halo->send_count[rank] += 1;
+      lag_halo->send_count_pack[rank] += 1;
 
       /* Remove the particle from the local set (do not copy it) */
 
@@ -2783,6 +2864,11 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
   particles->n_particles = particle_count;
   particles->weight = tot_weight;
 
+  /* Particles received below are appended after the compacted local
+     particles, and are the only ones which may need further displacement */
+
+  *first_sync_id = particle_count;
+
   particles->n_part_out += n_exit_particles;
   particles->weight_out += exit_weight;
 
@@ -2792,13 +2878,39 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
   particles->n_part_merged += n_merged_particles;
   particles->weight_merged += merged_weight;
 
-  /* Exchange particles, then update set */
+  /* Exchange particles, then update set.
+
+     The global check on whether displacement needs to continue is
+     reduced in nonblocking mode when possible, so its latency is
+     overlapped with the particle payload exchange; ranks with no
+     crossing particles thus only pay for the reduction itself. */
+
+  if (halo != NULL)
+    _lagr_halo_count_finish(mesh, lag_halo, particles);
+
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+
+  MPI_Request  request = MPI_REQUEST_NULL;
+
+  if (cs_glob_n_ranks > 1)
+    MPI_Iallreduce(MPI_IN_PLACE, &continue_displacement, 1, MPI_INT, MPI_MAX,
+                   cs_glob_mpi_comm, &request);
+
+  if (halo != NULL)
+    _exchange_particles(halo, lag_halo, particles);
+
+  if (cs_glob_n_ranks > 1)
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+#else
 
   if (halo != NULL)
     _exchange_particles(halo, lag_halo, particles);
 
   cs_parall_max(1, CS_INT_TYPE, &continue_displacement);
 
+#endif
+
   return continue_displacement;
 }
 
@@ -3081,11 +3193,15 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
   /* Main loop on particles: global propagation */
 
+  cs_lnum_t first_sync_id = 0;
+
   while (continue_displacement) {
 
-    /* Local propagation */
+    /* Local propagation; on subsequent passes, only particles received
+       from other ranks may still need displacement, and are grouped
+       after those already handled */
 
-    for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
+    for (cs_lnum_t i = first_sync_id; i < particles->n_particles; i++) {
 
       /* Local copies of the current and previous particles state vectors
          to be used in case of the first pass of _local_propagation fails */
@@ -3115,7 +3231,7 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
     /* Update of the particle set structure. Delete exited particles,
        update for particles which change domain. */
 
-    continue_displacement = _sync_particle_set(particles);
+    continue_displacement = _sync_particle_set(particles, &first_sync_id);
 
 #if 0
     bft_printf("\n Particle set after sync\n");
@@ -162,44 +162,81 @@ static void
 _select_entities(cs_join_t   *this_join,
                  cs_mesh_t   *mesh)
 {
-  cs_real_t  *b_face_cog = NULL, *b_face_normal = NULL;
   cs_join_param_t   param = this_join->param;
 
   const char   *selection_criteria = this_join->criteria;
 
-  cs_mesh_init_group_classes(mesh);
+  /* If the selection is known to be stable (i.e. the pre-join mesh is
+     rebuilt identically before each joining, as for sliding-mesh
+     computations), reuse the face list cached by a previous call and
+     avoid rebuilding group classes, boundary face quantities, and the
+     associated selector. */
 
-  cs_mesh_quantities_b_faces(mesh, &b_face_cog, &b_face_normal);
+  if (this_join->stable_selection && this_join->n_cached_faces > -1) {
 
-  cs_glob_mesh->select_b_faces = fvm_selector_create(mesh->dim,
-                                                     mesh->n_b_faces,
-                                                     mesh->class_defs,
-                                                     mesh->b_face_family,
-                                                     1,
-                                                     b_face_cog,
-                                                     b_face_normal);
+    this_join->selection = cs_join_select_create(selection_criteria,
+                                                 param.perio_type,
+                                                 this_join->n_cached_faces,
+                                                 this_join->cached_faces,
+                                                 param.verbosity);
+
+  }
+  else {
 
-  /* Get selected faces for this joining and define the related
-     cs_join_face_select_t structure.
-     - Compute the global number of selected faces
-     - Get the adjacent faces, ... */
+    cs_real_t  *b_face_cog = NULL, *b_face_normal = NULL;
 
-  this_join->selection = cs_join_select_create(selection_criteria,
-                                               param.perio_type,
-                                               param.verbosity);
+    cs_mesh_init_group_classes(mesh);
 
-  /* Free arrays and structures needed for selection */
+    cs_mesh_quantities_b_faces(mesh, &b_face_cog, &b_face_normal);
 
-  BFT_FREE(b_face_cog);
-  BFT_FREE(b_face_normal);
+    cs_glob_mesh->select_b_faces = fvm_selector_create(mesh->dim,
+                                                       mesh->n_b_faces,
+                                                       mesh->class_defs,
+                                                       mesh->b_face_family,
+                                                       1,
+                                                       b_face_cog,
+                                                       b_face_normal);
+
+    /* Get selected faces for this joining and define the related
+       cs_join_face_select_t structure.
+       - Compute the global number of selected faces
+       - Get the adjacent faces, ... */
+
+    this_join->selection = cs_join_select_create(selection_criteria,
+                                                 param.perio_type,
+                                                 0,
+                                                 NULL,
+                                                 param.verbosity);
 
-  mesh->class_defs = fvm_group_class_set_destroy(mesh->class_defs);
+    /* Free arrays and structures needed for selection */
+
+    BFT_FREE(b_face_cog);
+    BFT_FREE(b_face_normal);
 
-  if (mesh->select_b_faces != NULL)
-    mesh->select_b_faces = fvm_selector_destroy(mesh->select_b_faces);
-  if (mesh->class_defs != NULL)
     mesh->class_defs = fvm_group_class_set_destroy(mesh->class_defs);
 
+    if (mesh->select_b_faces != NULL)
+      mesh->select_b_faces = fvm_selector_destroy(mesh->select_b_faces);
+    if (mesh->class_defs != NULL)
+      mesh->class_defs = fvm_group_class_set_destroy(mesh->class_defs);
+
+    /* Cache the selected face list (0-based) for later joinings
+       of the same (rebuilt) mesh. */
+
+    if (this_join->stable_selection) {
+
+      const cs_join_select_t  *selection = this_join->selection;
+
+      this_join->n_cached_faces = selection->n_faces;
+      BFT_REALLOC(this_join->cached_faces, selection->n_faces, cs_lnum_t);
+
+      for (cs_lnum_t i = 0; i < selection->n_faces; i++)
+        this_join->cached_faces[i] = selection->faces[i] - 1;
+
+    }
+
+  }
+
   /* Return selection struct. */
 
   if (mesh->verbosity > 0) {
@@ -1730,6 +1767,52 @@ cs_join_set_advanced_param(int      join_num,
                       tmr_distrib);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate that the face selection of a joining operation is stable.
+ *
+ * When a joining is applied repeatedly to a mesh rebuilt identically before
+ * each call (such as the rotor/stator interface of a sliding-mesh
+ * computation, where rotation is applied to vertex coordinates only), the
+ * set of selected faces is the same at each call. In this case, the face
+ * list determined at the first call may be cached and reused, avoiding the
+ * rebuild of group classes, boundary face quantities, and the associated
+ * selector at each subsequent call.
+ *
+ * This must not be used if the selection criteria depend on geometry
+ * (coordinate or normal based criteria) which changes between calls.
+ *
+ * \param[in]  join_num  joining operation number
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_join_set_stable_selection(int  join_num)
+{
+  int  i, join_id = -1;
+  cs_join_t  *join = NULL;
+
+  /* Search for the joining structure related to join_num */
+
+  for (i = 0; i < cs_glob_n_joinings; i++) {
+
+    join = cs_glob_join_array[i];
+    if (join_num == join->param.num) {
+      join_id = i;
+      break;
+    }
+
+  }
+
+  if (join_id < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("  Joining number %d is not defined.\n"), join_num);
+
+  assert(join != NULL);
+
+  join->stable_selection = true;
+}
+
 /*----------------------------------------------------------------------------
  * Apply all the defined joining operations.
  *
@@ -106,6 +106,23 @@ cs_join_set_advanced_param(int      join_num,
                            double   tmr,
                            double   tmr_distrib);
 
+/*----------------------------------------------------------------------------
+ * Indicate that the face selection of a joining operation is stable.
+ *
+ * When a joining is applied repeatedly to a mesh rebuilt identically before
+ * each call, the face list determined at the first call may be cached and
+ * reused, avoiding the rebuild of selection structures at each call.
+ *
+ * This must not be used if the selection criteria depend on geometry
+ * which changes between calls.
+ *
+ * parameters:
+ *   join_num <-- joining operation number
+ *---------------------------------------------------------------------------*/
+
+void
+cs_join_set_stable_selection(int  join_num);
+
 /*----------------------------------------------------------------------------
  * Apply all the defined joining operations.
  *
@@ -391,6 +391,7 @@ _check_equiv(const cs_join_edges_t  *edges,
     cs_lnum_t  v1e2_id = edges->def[2*e2_id]-1;
     cs_lnum_t  v2e2_id = edges->def[2*e2_id+1]-1;
 
+#   pragma omp atomic
     _n_inter_tolerance_warnings++;
 
     if (verbosity > 3) {
@@ -3457,11 +3458,9 @@ cs_join_intersect_edges(cs_join_param_t         param,
                         cs_join_eset_t        **vtx_eset,
                         cs_join_inter_set_t   **inter_set)
 {
-  cs_lnum_t  i, j, k;
-  double  abs_e1[2], abs_e2[2];
+  cs_lnum_t  i;
 
   cs_join_type_t  join_type = CS_JOIN_TYPE_CONFORMING;
-  cs_lnum_t  n_inter = 0;
   cs_lnum_t  n_inter_detected = 0, n_real_inter = 0, n_trivial_inter = 0;
   cs_gnum_t  n_g_inter[3] = {0, 0, 0};
   cs_join_inter_set_t  *_inter_set = NULL;
@@ -3491,105 +3490,203 @@ cs_join_intersect_edges(cs_join_param_t         param,
   _inter_set = cs_join_inter_set_create(50);
   _vtx_eset = cs_join_eset_create(30);
 
-  /* Loop on edges */
+  /* Loop on edges, using one thread per contiguous range of visibility
+     entries, with per-thread result buffers; as ranges are in ascending
+     order, concatenating per-thread results in thread order preserves
+     the serial ordering. Detailed logging of the intersection kernels
+     requires the serial path. */
+
+  int n_e_threads = 1;
+
+#if defined(HAVE_OPENMP)
+  if (param.verbosity < 4)
+    n_e_threads = cs_glob_n_threads;
+#endif
+
+  cs_join_eset_t  **vtx_eset_t = NULL;
+  cs_join_inter_set_t  **inter_set_t = NULL;
+
+  BFT_MALLOC(vtx_eset_t, n_e_threads, cs_join_eset_t *);
+  BFT_MALLOC(inter_set_t, n_e_threads, cs_join_inter_set_t *);
+
+  vtx_eset_t[0] = _vtx_eset;
+  inter_set_t[0] = _inter_set;
+
+  for (int t_id = 1; t_id < n_e_threads; t_id++) {
+    vtx_eset_t[t_id] = cs_join_eset_create(30);
+    inter_set_t[t_id] = cs_join_inter_set_create(50);
+  }
+
+  const cs_lnum_t n_vis_elts = edge_edge_vis->n_elts;
+  const cs_lnum_t t_b_size = (n_vis_elts + n_e_threads - 1) / n_e_threads;
+
+# pragma omp parallel for num_threads(n_e_threads) schedule(static, 1)
+  for (int t_id = 0; t_id < n_e_threads; t_id++) {
 
-  for (i = 0; i < edge_edge_vis->n_elts; i++) {
+    cs_lnum_t  n_inter = 0;
+    cs_lnum_t  t_n_inter_detected = 0, t_n_trivial_inter = 0;
+    cs_join_type_t  t_join_type = CS_JOIN_TYPE_CONFORMING;
+    double  abs_e1[2], abs_e2[2];
 
-    int  e1 = edge_edge_vis->g_elts[i]; /* This is a local number */
+    cs_join_eset_t  *t_vtx_eset = vtx_eset_t[t_id];
+    cs_join_inter_set_t  *t_inter_set = inter_set_t[t_id];
 
-    for (j = edge_edge_vis->index[i]; j < edge_edge_vis->index[i+1]; j++) {
+    const cs_lnum_t t_s_id = t_b_size*t_id;
+    const cs_lnum_t t_e_id = CS_MIN(t_s_id + t_b_size, n_vis_elts);
 
-      int  e2 = edge_edge_vis->g_list[j]; /* This is a local number */
-      int  e1_id = (e1 < e2 ? e1 - 1 : e2 - 1);
-      int  e2_id = (e1 < e2 ? e2 - 1 : e1 - 1);
+    for (cs_lnum_t t_i = t_s_id; t_i < t_e_id; t_i++) {
 
-      assert(e1 != e2);
+      int  e1 = edge_edge_vis->g_elts[t_i]; /* This is a local number */
 
-      /* Get edge-edge intersection */
+      for (cs_lnum_t t_j = edge_edge_vis->index[t_i];
+           t_j < edge_edge_vis->index[t_i+1];
+           t_j++) {
 
-      if (param.icm == 1)
-        _edge_edge_3d_inter(mesh,
-                            edges,
-                            param.fraction,
-                            e1_id, abs_e1,
-                            e2_id, abs_e2,
-                            parall_eps2,
-                            param.verbosity,
-                            logfile,
-                            &n_inter);
+        int  e2 = edge_edge_vis->g_list[t_j]; /* This is a local number */
+        int  e1_id = (e1 < e2 ? e1 - 1 : e2 - 1);
+        int  e2_id = (e1 < e2 ? e2 - 1 : e1 - 1);
 
-      else if (param.icm == 2)
-        _new_edge_edge_3d_inter(mesh,
-                                edges,
-                                param.fraction,
-                                e1_id, abs_e1,
-                                e2_id, abs_e2,
-                                parall_eps2,
-                                param.verbosity,
-                                logfile,
-                                &n_inter);
+        assert(e1 != e2);
 
-      n_inter_detected += n_inter;
+        /* Get edge-edge intersection */
+
+        if (param.icm == 1)
+          _edge_edge_3d_inter(mesh,
+                              edges,
+                              param.fraction,
+                              e1_id, abs_e1,
+                              e2_id, abs_e2,
+                              parall_eps2,
+                              param.verbosity,
+                              logfile,
+                              &n_inter);
+
+        else if (param.icm == 2)
+          _new_edge_edge_3d_inter(mesh,
+                                  edges,
+                                  param.fraction,
+                                  e1_id, abs_e1,
+                                  e2_id, abs_e2,
+                                  parall_eps2,
+                                  param.verbosity,
+                                  logfile,
+                                  &n_inter);
+
+        t_n_inter_detected += n_inter;
 
 #if 0 && defined(DEBUG) && !defined(NDEBUG)
-      if (param.verbosity > 3 && n_inter > 0) {
+        if (param.verbosity > 3 && n_inter > 0) {
 
-        cs_lnum_t  v1e1 = edges->def[2*e1_id] - 1;
-        cs_lnum_t  v2e1 = edges->def[2*e1_id+1] - 1;
-        cs_lnum_t  v1e2 = edges->def[2*e2_id] - 1;
-        cs_lnum_t  v2e2 = edges->def[2*e2_id+1] - 1;
+          cs_lnum_t  v1e1 = edges->def[2*e1_id] - 1;
+          cs_lnum_t  v2e1 = edges->def[2*e1_id+1] - 1;
+          cs_lnum_t  v1e2 = edges->def[2*e2_id] - 1;
+          cs_lnum_t  v2e2 = edges->def[2*e2_id+1] - 1;
 
-        fprintf(logfile,
-                "\n Intersection: "
-                "E1 (%llu) [%llu - %llu] / E2 (%llu) [%llu - %llu]\n",
-                (unsigned long long)edges->gnum[e1_id],
-                (unsigned long long)mesh->vertices[v1e1].gnum,
-                (unsigned long long)mesh->vertices[v2e1].gnum,
-                (unsigned long long)edges->gnum[e2_id],
-                (unsigned long long)mesh->vertices[v1e2].gnum,
-                (unsigned long long)mesh->vertices[v2e2].gnum);
-        fprintf(logfile, "  n_inter: %d ", n_inter);
-        for (k = 0; k < n_inter; k++)
           fprintf(logfile,
-                  " (%d) - s_e1 = %g, s_e2 = %g", k, abs_e1[k], abs_e2[k]);
-        fflush(logfile);
-      }
+                  "\n Intersection: "
+                  "E1 (%llu) [%llu - %llu] / E2 (%llu) [%llu - %llu]\n",
+                  (unsigned long long)edges->gnum[e1_id],
+                  (unsigned long long)mesh->vertices[v1e1].gnum,
+                  (unsigned long long)mesh->vertices[v2e1].gnum,
+                  (unsigned long long)edges->gnum[e2_id],
+                  (unsigned long long)mesh->vertices[v1e2].gnum,
+                  (unsigned long long)mesh->vertices[v2e2].gnum);
+          fprintf(logfile, "  n_inter: %d ", n_inter);
+          for (cs_lnum_t k = 0; k < n_inter; k++)
+            fprintf(logfile,
+                    " (%d) - s_e1 = %g, s_e2 = %g", (int)k,
+                    abs_e1[k], abs_e2[k]);
+          fflush(logfile);
+        }
 #endif
 
-      for (k = 0; k < n_inter; k++) {
+        for (cs_lnum_t k = 0; k < n_inter; k++) {
 
-        bool  trivial = false;
+          bool  trivial = false;
 
-        if (abs_e1[k] <= merge_limit || abs_e1[k] >= 1.0 - merge_limit)
-          if (abs_e2[k] <= merge_limit || abs_e2[k] >= 1.0 - merge_limit)
-            trivial = true;
+          if (abs_e1[k] <= merge_limit || abs_e1[k] >= 1.0 - merge_limit)
+            if (abs_e2[k] <= merge_limit || abs_e2[k] >= 1.0 - merge_limit)
+              trivial = true;
 
-        if (trivial) {
+          if (trivial) {
 
-          _add_trivial_equiv(e1_id,
-                             e2_id,
-                             abs_e1[k],
-                             abs_e2[k],
-                             edges,
-                             _vtx_eset);
+            _add_trivial_equiv(e1_id,
+                               e2_id,
+                               abs_e1[k],
+                               abs_e2[k],
+                               edges,
+                               t_vtx_eset);
 
-          n_trivial_inter += 1;
+            t_n_trivial_inter += 1;
 
-        }
-        else {
+          }
+          else {
 
-          if (join_type == CS_JOIN_TYPE_CONFORMING)
-            join_type = CS_JOIN_TYPE_NON_CONFORMING;
+            if (t_join_type == CS_JOIN_TYPE_CONFORMING)
+              t_join_type = CS_JOIN_TYPE_NON_CONFORMING;
 
-          _add_inter(e1_id, e2_id, abs_e1[k], abs_e2[k], _inter_set);
+            _add_inter(e1_id, e2_id, abs_e1[k], abs_e2[k], t_inter_set);
 
-        }
+          }
+
+        } /* End of loop on detected edge_edge_vis */
+
+      } /* End of loop on entities intersecting elements */
+
+    } /* End of loop on elements in intersection list */
+
+#   pragma omp critical
+    {
+      n_inter_detected += t_n_inter_detected;
+      n_trivial_inter += t_n_trivial_inter;
+      if ((int)t_join_type > (int)join_type)
+        join_type = t_join_type;
+    }
+
+  } /* End of loop on threads */
 
-      } /* End of loop on detected edge_edge_vis */
+  /* Concatenate per-thread results in thread order */
 
-    } /* End of loop on entities intersecting elements */
+  for (int t_id = 1; t_id < n_e_threads; t_id++) {
+
+    cs_join_eset_t  *t_vtx_eset = vtx_eset_t[t_id];
+    cs_join_inter_set_t  *t_inter_set = inter_set_t[t_id];
+
+    if (t_vtx_eset->n_equiv > 0) {
+      cs_lnum_t shift = _vtx_eset->n_equiv;
+      if (shift + t_vtx_eset->n_equiv > _vtx_eset->n_max_equiv) {
+        _vtx_eset->n_max_equiv = shift + t_vtx_eset->n_equiv;
+        BFT_REALLOC(_vtx_eset->equiv_couple,
+                    2*_vtx_eset->n_max_equiv,
+                    cs_lnum_t);
+      }
+      memcpy(_vtx_eset->equiv_couple + 2*shift,
+             t_vtx_eset->equiv_couple,
+             sizeof(cs_lnum_t)*2*t_vtx_eset->n_equiv);
+      _vtx_eset->n_equiv += t_vtx_eset->n_equiv;
+    }
+
+    if (t_inter_set->n_inter > 0) {
+      cs_lnum_t shift = _inter_set->n_inter;
+      if (shift + t_inter_set->n_inter > _inter_set->n_max_inter) {
+        _inter_set->n_max_inter = shift + t_inter_set->n_inter;
+        BFT_REALLOC(_inter_set->inter_lst,
+                    2*_inter_set->n_max_inter,
+                    cs_join_inter_t);
+      }
+      memcpy(_inter_set->inter_lst + 2*shift,
+             t_inter_set->inter_lst,
+             sizeof(cs_join_inter_t)*2*t_inter_set->n_inter);
+      _inter_set->n_inter += t_inter_set->n_inter;
+    }
+
+    cs_join_eset_destroy(&t_vtx_eset);
+    cs_join_inter_set_destroy(&t_inter_set);
+
+  }
 
-  } /* End of loop on elements in intersection list */
+  BFT_FREE(vtx_eset_t);
+  BFT_FREE(inter_set_t);
 
   n_real_inter = n_inter_detected - n_trivial_inter;
 
@@ -338,8 +338,10 @@ cs_join_rset_resize(cs_join_rset_t  **set,
       if (_set->n_max_elts == 0)
         _set->n_max_elts = test_size;
       else if (test_size >= _set->n_max_elts) {
+        /* Grow by a factor 1.5, to limit the memory overshoot of
+           large resizable buffers during the merge phase */
         while (test_size >= _set->n_max_elts)
-          _set->n_max_elts *= 2; /* Double the list size */
+          _set->n_max_elts += _set->n_max_elts/2 + 1;
       }
 
       BFT_REALLOC(_set->array, _set->n_max_elts, cs_lnum_t);
@@ -403,7 +405,11 @@ cs_join_eset_check_size(cs_lnum_t         request_size,
     if (eset->n_max_equiv == 0)
       eset->n_max_equiv = 2;
 
-    eset->n_max_equiv *= 2;
+    /* Grow by a factor 1.5 rather than doubling, to limit the
+       memory overshoot on large joins */
+
+    while (request_size + 1 > eset->n_max_equiv)
+      eset->n_max_equiv += eset->n_max_equiv/2 + 1;
 
     BFT_REALLOC(eset->equiv_couple, 2*eset->n_max_equiv, cs_lnum_t);
 
@@ -433,7 +439,8 @@ cs_join_eset_destroy(cs_join_eset_t  **equiv_set)
 /*----------------------------------------------------------------------------
  * Clean a cs_join_eset_t structure.
  *
- * If necessary, create a new cs_join_eset_t structure with no redundancy.
+ * Equivalences are ordered and redundancies are removed in place, so that
+ * no temporary copy of the couples array is needed.
  *
  * parameters:
  *   eset <-- pointer to pointer to the cs_join_eset_t structure to clean
@@ -444,99 +451,87 @@ cs_join_eset_clean(cs_join_eset_t  **eset)
 {
   assert(eset != NULL);
 
-  int  i;
-  cs_lnum_t  prev, current;
+  cs_lnum_t  i;
 
   cs_lnum_t  count = 0;
-  cs_lnum_t  *order = NULL;
-  cs_join_eset_t  *new_eset = NULL;
   cs_join_eset_t  *_eset = *eset;
 
   if (_eset == NULL)
     return;
 
-  if (_eset->n_equiv == 1)
+  if (_eset->n_equiv < 2)
     return;
 
-  BFT_MALLOC(order, _eset->n_equiv, cs_lnum_t);
+  cs_lnum_t  n_equiv = _eset->n_equiv;
+  cs_lnum_t  *equiv_couple = _eset->equiv_couple;
 
-  if (_order_local_test_s2(_eset->equiv_couple,
-                           _eset->n_equiv) == false) {
+  if (_order_local_test_s2(equiv_couple, n_equiv) == false) {
+
+    cs_lnum_t  *order = NULL;
+
+    BFT_MALLOC(order, n_equiv, cs_lnum_t);
 
     /* Order equiv_lst */
 
-    _order_local_s2(_eset->equiv_couple,
-                    order,
-                    _eset->n_equiv);
+    _order_local_s2(equiv_couple, order, n_equiv);
 
-  }
-  else
-    for (i = 0; i < _eset->n_equiv; i++)
-      order[i] = i;
+    /* Apply the ordering in place, following permutation cycles;
+       order is modified to mark positions already handled */
 
-  /* Count the number of redundancies */
+    for (i = 0; i < n_equiv; i++) {
 
-  count = 0;
+      cs_lnum_t  j = order[i];
 
-  for (i = 1; i < _eset->n_equiv; i++) {
+      if (j < 0 || j == i)
+        continue;
 
-    prev = order[i-1];
-    current = order[i];
+      cs_lnum_t  c0 = equiv_couple[2*i];
+      cs_lnum_t  c1 = equiv_couple[2*i+1];
+      cs_lnum_t  k = i;
 
-    if (_eset->equiv_couple[2*prev] == _eset->equiv_couple[2*current])
-      if (_eset->equiv_couple[2*prev+1] == _eset->equiv_couple[2*current+1])
-        count++;
+      while (j != i) {
+        equiv_couple[2*k] = equiv_couple[2*j];
+        equiv_couple[2*k+1] = equiv_couple[2*j+1];
+        k = j;
+        j = order[k];
+        order[k] = -1;
+      }
 
-  } /* End of loop on equivalences */
+      equiv_couple[2*k] = c0;
+      equiv_couple[2*k+1] = c1;
 
-  new_eset = cs_join_eset_create(_eset->n_equiv - count);
+    }
 
-  new_eset->n_equiv =  _eset->n_equiv - count;
+    BFT_FREE(order);
 
-  if (new_eset->n_equiv > new_eset->n_max_equiv) {
-    new_eset->n_max_equiv = new_eset->n_equiv;
-    BFT_REALLOC(new_eset->equiv_couple, 2*new_eset->n_max_equiv, cs_lnum_t);
   }
 
-  if (new_eset->n_equiv > 0) {
+  /* Remove redundancies; couples are now ordered, so each couple only
+     needs to be compared to the last one kept */
 
-    new_eset->equiv_couple[0] = _eset->equiv_couple[2*order[0]];
-    new_eset->equiv_couple[1] = _eset->equiv_couple[2*order[0]+1];
-    count = 1;
+  count = 1;
 
-    for (i = 1; i < _eset->n_equiv; i++) {
+  for (i = 1; i < n_equiv; i++) {
 
-      prev = order[i-1];
-      current = order[i];
+    if (   equiv_couple[2*i] != equiv_couple[2*(count-1)]
+        || equiv_couple[2*i+1] != equiv_couple[2*(count-1)+1]) {
 
-      if (_eset->equiv_couple[2*prev] != _eset->equiv_couple[2*current]) {
-        new_eset->equiv_couple[2*count] = _eset->equiv_couple[2*current];
-        new_eset->equiv_couple[2*count+1] = _eset->equiv_couple[2*current+1];
-        count++;
+      if (count < i) {
+        equiv_couple[2*count] = equiv_couple[2*i];
+        equiv_couple[2*count+1] = equiv_couple[2*i+1];
       }
-      else {
-
-        if (_eset->equiv_couple[2*prev+1] != _eset->equiv_couple[2*current+1]) {
-          new_eset->equiv_couple[2*count] = _eset->equiv_couple[2*current];
-          new_eset->equiv_couple[2*count+1] = _eset->equiv_couple[2*current+1];
-          count++;
-        }
+      count++;
 
-      }
+    }
 
-    } /* End of loop on equivalences */
+  } /* End of loop on equivalences */
 
-    assert(count == new_eset->n_equiv);
+  _eset->n_equiv = count;
 
+  if (count < _eset->n_max_equiv) {
+    _eset->n_max_equiv = count;
+    BFT_REALLOC(_eset->equiv_couple, 2*_eset->n_max_equiv, cs_lnum_t);
   }
-
-  *eset = new_eset;
-
-  /* Free memory */
-
-  cs_join_eset_destroy(&_eset);
-
-  BFT_FREE(order);
 }
 
 /*----------------------------------------------------------------------------
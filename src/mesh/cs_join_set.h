@@ -164,7 +164,7 @@ cs_join_eset_destroy(cs_join_eset_t  **equiv_set);
 /*----------------------------------------------------------------------------
  * Clean a cs_join_eset_t structure.
  *
- * If necessary, create a new cs_join_eset_t structure with no redundancy.
+ * Equivalences are ordered and redundancies are removed in place.
  *
  * parameters:
  *   eset <-- pointer to pointer to the cs_join_eset_t structure to clean
@@ -2144,6 +2144,10 @@ cs_join_create(int                      join_number,
 
   join->log_name = NULL;
 
+  join->stable_selection = false;
+  join->n_cached_faces = -1;
+  join->cached_faces = NULL;
+
   /* Copy the selection criteria for future use */
 
   l = strlen(sel_criteria);
@@ -2196,6 +2200,7 @@ cs_join_destroy(cs_join_t  **join)
 
     BFT_FREE(_join->log_name);
     BFT_FREE(_join->criteria);
+    BFT_FREE(_join->cached_faces);
 
     BFT_FREE(_join);
     *join = NULL;
@@ -2206,10 +2211,17 @@ cs_join_destroy(cs_join_t  **join)
 /*----------------------------------------------------------------------------
  * Create and initialize a cs_join_select_t structure.
  *
+ * If preselected_faces is non-null, the given face list (0-based) is used
+ * directly instead of evaluating the selection criteria. This allows reusing
+ * a face selection cached from a previous joining of an identical mesh.
+ *
  * parameters:
- *   selection_criteria <-- pointer to a cs_mesh_select_t structure
- *   perio_type         <-- periodicity type (FVM_PERIODICITY_NULL if none)
- *   verbosity          <-- level of verbosity required
+ *   selection_criteria  <-- pointer to a cs_mesh_select_t structure
+ *   perio_type          <-- periodicity type (FVM_PERIODICITY_NULL if none)
+ *   n_preselected_faces <-- number of preselected faces (ignored if
+ *                           preselected_faces is null)
+ *   preselected_faces   <-- preselected border face ids, or null
+ *   verbosity           <-- level of verbosity required
  *
  * returns:
  *   pointer to a newly created cs_join_select_t structure
@@ -2218,6 +2230,8 @@ cs_join_destroy(cs_join_t  **join)
 cs_join_select_t *
 cs_join_select_create(const char              *selection_criteria,
                       fvm_periodicity_type_t   perio_type,
+                      cs_lnum_t                n_preselected_faces,
+                      const cs_lnum_t         *preselected_faces,
                       int                      verbosity)
 {
   cs_lnum_t  *vtx_tag = NULL;
@@ -2278,9 +2292,16 @@ cs_join_select_create(const char              *selection_criteria,
 
   BFT_MALLOC(selection->faces, mesh->n_b_faces, cs_lnum_t);
 
-  cs_selector_get_b_face_list(selection_criteria,
-                              &(selection->n_faces),
-                              selection->faces);
+  if (preselected_faces != NULL) {
+    selection->n_faces = n_preselected_faces;
+    memcpy(selection->faces,
+           preselected_faces,
+           n_preselected_faces*sizeof(cs_lnum_t));
+  }
+  else
+    cs_selector_get_b_face_list(selection_criteria,
+                                &(selection->n_faces),
+                                selection->faces);
 
   /* In case of periodicity, ensure no isolated faces are
      selected */
@@ -307,6 +307,17 @@ typedef struct {
 
   char              *log_name;   /* Optional log file name */
 
+  bool               stable_selection;  /* If true, the face selection is
+                                           assumed identical for repeated
+                                           joinings of an unchanged pre-join
+                                           mesh, and may be cached */
+
+  cs_lnum_t          n_cached_faces;    /* Number of cached selected faces
+                                           (< 0 if cache not filled) */
+
+  cs_lnum_t         *cached_faces;      /* Cached selected border face ids
+                                           (0-based) */
+
 } cs_join_t;
 
 /*=============================================================================
@@ -367,10 +378,16 @@ cs_join_destroy(cs_join_t  **join);
 /*----------------------------------------------------------------------------
  * Create and initialize a cs_join_select_t structure.
  *
+ * If preselected_faces is non-null, the given face list (0-based) is used
+ * directly instead of evaluating the selection criteria.
+ *
  * parameters:
- *   selection_criteria <-- pointer to a cs_mesh_select_t structure
- *   perio_type         <-- periodicity type (FVM_PERIODICITY_NULL if none)
- *   verbosity          <-- level of verbosity required
+ *   selection_criteria  <-- pointer to a cs_mesh_select_t structure
+ *   perio_type          <-- periodicity type (FVM_PERIODICITY_NULL if none)
+ *   n_preselected_faces <-- number of preselected faces (ignored if
+ *                           preselected_faces is null)
+ *   preselected_faces   <-- preselected border face ids, or null
+ *   verbosity           <-- level of verbosity required
  *
  * returns:
  *   pointer to a newly created cs_join_select_t structure
@@ -379,6 +396,8 @@ cs_join_destroy(cs_join_t  **join);
 cs_join_select_t *
 cs_join_select_create(const char              *selection_criteria,
                       fvm_periodicity_type_t   perio_type,
+                      cs_lnum_t                n_preselected_faces,
+                      const cs_lnum_t         *preselected_faces,
                       int                      verbosity);
 
 /*----------------------------------------------------------------------------
@@ -2663,6 +2663,46 @@ cs_mesh_update_b_cells(cs_mesh_t  *mesh)
   BFT_FREE(flag);
 }
 
+/*----------------------------------------------------------------------------
+ * Re-place an array in memory using a parallel copy.
+ *
+ * A new array is allocated and filled by an OpenMP loop, so that under a
+ * first-touch page placement policy, its pages are distributed across the
+ * cores operating on it rather than all placed by the (serial) code path
+ * which built the original array; the original array is then freed.
+ *
+ * parameters:
+ *   array <-> pointer to array pointer
+ *   size  <-- array size in bytes
+ *----------------------------------------------------------------------------*/
+
+static void
+_first_touch_remap(void    **array,
+                   size_t    size)
+{
+  if (*array == NULL || size == 0)
+    return;
+
+  unsigned char *copy, *orig = (unsigned char *)(*array);
+
+  BFT_MALLOC(copy, size, unsigned char);
+
+  const size_t block_size = 4096;
+  const long n_blocks = (size + block_size - 1) / block_size;
+
+# pragma omp parallel for schedule(static)
+  for (long b = 0; b < n_blocks; b++) {
+    size_t start = (size_t)b * block_size;
+    size_t end = start + block_size;
+    if (end > size)
+      end = size;
+    memcpy(copy + start, orig + start, end - start);
+  }
+
+  BFT_FREE(*array);
+  *array = copy;
+}
+
 /*----------------------------------------------------------------------------
  * Compute or update mesh structure members that depend on other members,
  * but whose results may be reused, such as global number of elements
@@ -2759,6 +2799,60 @@ cs_mesh_update_auxiliary(cs_mesh_t  *mesh)
   cs_mesh_update_b_cells(mesh);
 }
 
+/*----------------------------------------------------------------------------
+ * Re-place main mesh connectivity and coordinate arrays in memory
+ * for better core/memory affinity.
+ *
+ * The main arrays are built by serial code paths (preprocessing,
+ * renumbering), so under a first-touch page placement policy all their
+ * pages are local to the memory node of the building thread, penalizing
+ * threaded kernels running on other nodes. Each array is copied in
+ * parallel to a new allocation, distributing its pages, and the
+ * original is freed.
+ *
+ * This is only useful when using multiple threads, and is a no-op
+ * otherwise.
+ *
+ * parameters:
+ *   mesh <-> pointer to mesh structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_first_touch(cs_mesh_t  *mesh)
+{
+  if (cs_glob_n_threads < 2)
+    return;
+
+  const size_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const size_t n_i_faces = mesh->n_i_faces;
+  const size_t n_b_faces = mesh->n_b_faces;
+  const size_t n_vertices = mesh->n_vertices;
+
+  _first_touch_remap((void **)(&mesh->vtx_coord),
+                     n_vertices*mesh->dim*sizeof(cs_real_t));
+
+  _first_touch_remap((void **)(&mesh->i_face_cells),
+                     n_i_faces*sizeof(cs_lnum_2_t));
+  _first_touch_remap((void **)(&mesh->b_face_cells),
+                     n_b_faces*sizeof(cs_lnum_t));
+
+  _first_touch_remap((void **)(&mesh->i_face_vtx_idx),
+                     (n_i_faces+1)*sizeof(cs_lnum_t));
+  _first_touch_remap((void **)(&mesh->i_face_vtx_lst),
+                     mesh->i_face_vtx_connect_size*sizeof(cs_lnum_t));
+  _first_touch_remap((void **)(&mesh->b_face_vtx_idx),
+                     (n_b_faces+1)*sizeof(cs_lnum_t));
+  _first_touch_remap((void **)(&mesh->b_face_vtx_lst),
+                     mesh->b_face_vtx_connect_size*sizeof(cs_lnum_t));
+
+  _first_touch_remap((void **)(&mesh->cell_family),
+                     n_cells_ext*sizeof(int));
+  _first_touch_remap((void **)(&mesh->i_face_family),
+                     n_i_faces*sizeof(int));
+  _first_touch_remap((void **)(&mesh->b_face_family),
+                     n_b_faces*sizeof(int));
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * Creation and initialization of halo structures.
@@ -456,6 +456,24 @@ cs_mesh_update_b_cells(cs_mesh_t  *mesh);
 void
 cs_mesh_update_auxiliary(cs_mesh_t  *mesh);
 
+/*----------------------------------------------------------------------------
+ * Re-place main mesh connectivity and coordinate arrays in memory
+ * for better core/memory affinity.
+ *
+ * Each array is copied in parallel to a new allocation, so that under a
+ * first-touch page placement policy its pages are distributed across the
+ * cores operating on it, and the original is freed.
+ *
+ * This is only useful when using multiple threads, and is a no-op
+ * otherwise.
+ *
+ * parameters:
+ *   mesh  <->  pointer to a cs_mesh_t structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_first_touch(cs_mesh_t  *mesh);
+
 /*----------------------------------------------------------------------------
  * Creation and initialization of mesh face and vertex interfaces.
  *
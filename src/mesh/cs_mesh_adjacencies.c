@@ -289,6 +289,51 @@ _update_cell_i_faces(cs_mesh_adjacencies_t  *ma)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Update packed cell -> interior faces connectivity
+ *
+ * The (plain) cell -> interior faces connectivity must be up to date.
+ *
+ * parameters:
+ *   ma <-> mesh adjacecies structure to update
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_cell_i_faces_pck(cs_mesh_adjacencies_t  *ma)
+{
+  assert(ma->cell_i_faces != NULL);
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_elts = ma->cell_cells_idx[n_cells];
+
+  if ((unsigned long long)(m->n_i_faces) > 0x7fffffffULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: too many interior faces (%llu) for the packed\n"
+                "32-bit cell to interior faces adjacency."),
+              __func__, (unsigned long long)(m->n_i_faces));
+
+  /* Allocate and map */
+
+  cs_alloc_mode_t alloc_mode = cs_check_device_ptr(ma->cell_i_faces_pck);
+
+  CS_FREE(ma->cell_i_faces_pck);
+  CS_MALLOC_HD(ma->cell_i_faces_pck, n_elts, int32_t, alloc_mode);
+  cs_mem_advise_set_read_mostly(ma->cell_i_faces_pck);
+
+  const cs_lnum_t *c2i = ma->cell_i_faces;
+  const short int *sgn = ma->cell_i_faces_sgn;
+  int32_t *c2i_pck = ma->cell_i_faces_pck;
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    uint32_t e = (uint32_t)c2i[i];
+    if (sgn[i] < 0)
+      e |= ((uint32_t)1 << 31);
+    c2i_pck[i] = (int32_t)e;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Update cells -> boundary faces connectivity
  *
@@ -678,6 +723,7 @@ cs_mesh_adjacencies_initialize(void)
 
   ma->cell_i_faces = NULL;
   ma->cell_i_faces_sgn = NULL;
+  ma->cell_i_faces_pck = NULL;
 
   ma->cell_b_faces_idx = NULL;
   ma->cell_b_faces = NULL;
@@ -710,6 +756,7 @@ cs_mesh_adjacencies_finalize(void)
 
   BFT_FREE(ma->cell_i_faces);
   BFT_FREE(ma->cell_i_faces_sgn);
+  BFT_FREE(ma->cell_i_faces_pck);
 
   BFT_FREE(ma->cell_b_faces_idx);
   BFT_FREE(ma->cell_b_faces);
@@ -797,6 +844,31 @@ cs_mesh_adjacencies_update_cell_i_faces(void)
     _update_cell_i_faces(ma);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Ensure presence of the compact (packed) cell -> interior face
+ *         connectivity in the mesh adjacencies helper API.
+ *
+ * Each entry combines the interior face id (lower 31 bits) and the
+ * orientation of the face relative to the cell (top bit), so cell-based
+ * loops need to read a single, smaller array; entries may be decoded
+ * using \ref cs_mesh_adjacencies_c2f_packed_id and
+ * \ref cs_mesh_adjacencies_c2f_packed_sgn.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adjacencies_update_cell_i_faces_packed(void)
+{
+  cs_mesh_adjacencies_t *ma = &_cs_glob_mesh_adjacencies;
+
+  if (ma->cell_i_faces == NULL)
+    _update_cell_i_faces(ma);
+
+  if (ma->cell_i_faces_pck == NULL)
+    _update_cell_i_faces_pck(ma);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Map some global mesh adjacency arrays for use on device.
@@ -844,6 +916,11 @@ cs_mesh_adjacencies_update_device(cs_alloc_mode_t  alloc_mode)
                   alloc_mode);
     cs_mem_advise_set_read_mostly(ma->cell_i_faces_sgn);
   }
+  if (ma->cell_i_faces_pck != NULL) {
+    CS_REALLOC_HD(ma->cell_i_faces_pck, ma->cell_cells_idx[n_cells], int32_t,
+                  alloc_mode);
+    cs_mem_advise_set_read_mostly(ma->cell_i_faces_pck);
+  }
 
   {
     CS_REALLOC_HD(ma->cell_b_faces_idx, n_cells+1, cs_lnum_t, alloc_mode);
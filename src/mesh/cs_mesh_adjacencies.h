@@ -102,6 +102,11 @@ typedef struct {
   cs_lnum_t  *cell_i_faces;            /*!< cells to interior faces adjacency */
   short int  *cell_i_faces_sgn;        /*!< cells to interior faces orientation */
 
+  int32_t    *cell_i_faces_pck;        /*!< cells to interior faces adjacency,
+                                         with the orientation sign packed into
+                                         the top bit (compact, optional
+                                         variant) */
+
   /* cells -> boundary faces connectivity */
 
   cs_lnum_t        *cell_b_faces_idx;  /*!< cells to boundary faces index */
@@ -140,6 +145,45 @@ typedef struct {
 
 extern const cs_mesh_adjacencies_t  *cs_glob_mesh_adjacencies;
 
+/*============================================================================
+ * Inline static function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the interior face id associated with a packed
+ *         cell -> interior faces adjacency entry.
+ *
+ * \param[in]  e  packed adjacency entry
+ *
+ * \return  associated interior face id
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+cs_mesh_adjacencies_c2f_packed_id(int32_t  e)
+{
+  return (cs_lnum_t)(e & 0x7fffffff);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the orientation associated with a packed
+ *         cell -> interior faces adjacency entry.
+ *
+ * \param[in]  e  packed adjacency entry
+ *
+ * \return  -1 or 1 according to the orientation of the face relative
+ *          to the cell
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline short int
+cs_mesh_adjacencies_c2f_packed_sgn(int32_t  e)
+{
+  return (e < 0) ? -1 : 1;
+}
+
 /*=============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -200,6 +244,22 @@ cs_mesh_adjacencies_update_cell_cells_e(void);
 void
 cs_mesh_adjacencies_update_cell_i_faces(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Ensure presence of the compact (packed) cell -> interior face
+ *         connectivity in the mesh adjacencies helper API.
+ *
+ * Each entry combines the interior face id (lower 31 bits) and the
+ * orientation of the face relative to the cell (top bit), so cell-based
+ * loops need to read a single, smaller array; entries may be decoded
+ * using \ref cs_mesh_adjacencies_c2f_packed_id and
+ * \ref cs_mesh_adjacencies_c2f_packed_sgn.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adjacencies_update_cell_i_faces_packed(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Map some global mesh adjacency arrays for use on device.
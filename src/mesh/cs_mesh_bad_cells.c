@@ -98,22 +98,29 @@ static int  _call_type_visualize = 0;
  *============================================================================*/
 
 /*----------------------------------------------------------------------------
- * Evaluate cell's non-orthogonality.
+ * Evaluate face-based cell criteria in a single sweep.
  *
- * Compute orthogonal normal using the distance between two consecutive
- * cell centers and the surface vector orthogonal to the face.
- * Evaluates a level of non-orthogonality and tags identified bad cells.
+ * Compute the cell's non-orthogonality, center offsetting, and volume
+ * ratio criteria, and tag identified bad cells.
+ *
+ * Fusing the criteria allows sharing the face -> cell indirections and
+ * cell center accesses, and requires a single halo exchange instead of
+ * one per criterion.
  *
  * parameters:
  *   mesh                 <-- pointer to associated mesh structure.
  *   mesh_quantities      <-- pointer to associated mesh quantities structure
+ *   type_flag            <-- criteria to evaluate (mask of
+ *                            CS_BAD_CELL_ORTHO_NORM, CS_BAD_CELL_OFFSET,
+ *                            and CS_BAD_CELL_RATIO)
  *   bad_cell_flag        <-- array of bad cell flags for various uses
  *----------------------------------------------------------------------------*/
 
 static void
-_compute_ortho_norm(const cs_mesh_t             *mesh,
-                    const cs_mesh_quantities_t  *mesh_quantities,
-                    unsigned                     bad_cell_flag[])
+_compute_face_criteria(const cs_mesh_t             *mesh,
+                       const cs_mesh_quantities_t  *mesh_quantities,
+                       int                          type_flag,
+                       unsigned                     bad_cell_flag[])
 {
   cs_lnum_t  i, face_id, cell1, cell2;
 
@@ -121,9 +128,14 @@ _compute_ortho_norm(const cs_mesh_t             *mesh,
   cs_real_t  face_center[3];
   cs_real_t  face_normal[3], vect[3];
 
-  double  cos_alpha, i_face_ortho, b_face_ortho;
+  double  cos_alpha;
 
   const cs_lnum_t  dim = 3;
+  const cs_real_t  *volume = mesh_quantities->cell_vol;
+
+  const bool compute_ortho = (type_flag & CS_BAD_CELL_ORTHO_NORM) ? true : false;
+  const bool compute_offset = (type_flag & CS_BAD_CELL_OFFSET) ? true : false;
+  const bool compute_ratio = (type_flag & CS_BAD_CELL_RATIO) ? true : false;
 
   /* Loop on interior faces */
   /*------------------------*/
@@ -133,132 +145,118 @@ _compute_ortho_norm(const cs_mesh_t             *mesh,
     cell1 = mesh->i_face_cells[face_id][0];
     cell2 = mesh->i_face_cells[face_id][1];
 
-    /* Get information on mesh quantities */
+    /* Evaluate the non-orthogonality, using the distance between the
+       two adjacent cell centers and the surface vector */
 
-    for (i = 0; i < dim; i++) {
+    if (compute_ortho) {
 
-      /* Center of gravity for each cell */
-      cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
-      cell_center2[i] = mesh_quantities->cell_cen[cell2*dim + i];
+      for (i = 0; i < dim; i++) {
 
-      /* Surface vector (orthogonal to the face) */
-      face_normal[i] = mesh_quantities->i_face_normal[face_id*dim + i];
+        /* Center of gravity for each cell */
+        cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
+        cell_center2[i] = mesh_quantities->cell_cen[cell2*dim + i];
 
-    }
+        /* Surface vector (orthogonal to the face) */
+        face_normal[i] = mesh_quantities->i_face_normal[face_id*dim + i];
 
-    /* Evaluate the non-orthogonality. */
+      }
 
-    for (i = 0; i < dim; i++)
-      vect[i] = cell_center2[i] - cell_center1[i];
+      for (i = 0; i < dim; i++)
+        vect[i] = cell_center2[i] - cell_center1[i];
 
-    cs_real_t v1[3], v2[3];
+      cs_real_t v1[3], v2[3];
 
-    cs_math_3_normalize(vect, v1);
-    cs_math_3_normalize(face_normal, v2);
+      cs_math_3_normalize(vect, v1);
+      cs_math_3_normalize(face_normal, v2);
 
-    cos_alpha = cs_math_3_dot_product(v1, v2);
+      cos_alpha = cs_math_3_dot_product(v1, v2);
 
-    i_face_ortho = cos_alpha;
+      if (cos_alpha < 0.1) {
+        bad_cell_flag[cell1] |= CS_BAD_CELL_ORTHO_NORM;
+        bad_cell_flag[cell2] |= CS_BAD_CELL_ORTHO_NORM;
+      }
 
-    if (i_face_ortho < 0.1) {
-      bad_cell_flag[cell1] |= CS_BAD_CELL_ORTHO_NORM;
-      bad_cell_flag[cell2] |= CS_BAD_CELL_ORTHO_NORM;
     }
-  }
 
-  /* Loop on boundary faces */
-  /*------------------------*/
+    /* Compute center offsetting coefficient,
+       in a manner consistent with iterative gradient reconstruction */
 
-  for (face_id = 0; face_id < mesh->n_b_faces; face_id++) {
+    if (compute_offset) {
 
-    cell1 = mesh->b_face_cells[face_id];
+      const cs_real_t *v_of = &(mesh_quantities->dofij[face_id*3]);
+      const cs_real_t *v_n = &(mesh_quantities->i_face_normal[face_id*3]);
+      double of_n = cs_math_3_norm(v_of) * cs_math_3_norm(v_n);
 
-    /* Get information on mesh quantities */
+      double off_1 = 1 - pow(of_n / volume[cell1], 1/3.);
+      double off_2 = 1 - pow(of_n / volume[cell2], 1/3.);
 
-    for (i = 0; i < dim; i++) {
+      if (off_1 < 0.1)
+        bad_cell_flag[cell1] |= CS_BAD_CELL_OFFSET;
+      if (off_2 < 0.1)
+        bad_cell_flag[cell2] |= CS_BAD_CELL_OFFSET;
 
-      /* Center of gravity of the cell */
-      cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
+    }
 
-      /* Face center coordinates */
-      face_center[i] = mesh_quantities->b_face_cog[face_id*dim + i];
+    /* Evaluate the cell's geometric continuity, based on the
+       adjacent cell volume ratio */
 
-      /* Surface vector (orthogonal to the face) */
-      face_normal[i] = mesh_quantities->b_face_normal[face_id*dim + i];
+    if (compute_ratio) {
 
-    }
+      double vol_ratio = fmin(volume[cell1] / volume[cell2],
+                              volume[cell2] / volume[cell1]);
 
-    /* Evaluate the non-orthogonality. */
-    for (i = 0; i < dim; i++)
-      vect[i] = face_center[i] - cell_center1[i];
+      if (vol_ratio < 0.1*0.1) {
+        bad_cell_flag[cell1] |= CS_BAD_CELL_RATIO;
+        bad_cell_flag[cell2] |= CS_BAD_CELL_RATIO;
+      }
 
-    cs_real_t v1[3], v2[3];
+    }
 
-    cs_math_3_normalize(vect, v1);
-    cs_math_3_normalize(face_normal, v2);
+  }
 
-    cos_alpha = cs_math_3_dot_product(v1, v2);
+  /* Loop on boundary faces (non-orthogonality criterion only) */
+  /*-----------------------------------------------------------*/
 
-    b_face_ortho = cos_alpha;
+  if (compute_ortho) {
 
-    if (b_face_ortho < 0.1)
-      bad_cell_flag[cell1] |= CS_BAD_CELL_ORTHO_NORM;
-  }
+    for (face_id = 0; face_id < mesh->n_b_faces; face_id++) {
 
-  if (mesh->halo != NULL)
-    cs_halo_sync_untyped(mesh->halo,
-                         CS_HALO_EXTENDED,
-                         sizeof(unsigned),
-                         bad_cell_flag);
-}
+      cell1 = mesh->b_face_cells[face_id];
 
-/*----------------------------------------------------------------------------
- * Evaluate cell's center offsetting.
- *
- * Compute center offsetting coefficient for interior faces.
- * Evaluates a non-matching level (offset) and tags identified bad cells.
- *
- * parameters:
- *   mesh                   <-- pointer to associated mesh structure
- *   mesh_quantities        <-- pointer to associated mesh quantities
- *                              structure
- *   bad_cell_flag          <-- array of bad cell flags for various uses
- *----------------------------------------------------------------------------*/
+      /* Get information on mesh quantities */
 
-static void
-_compute_offsetting(const cs_mesh_t             *mesh,
-                    const cs_mesh_quantities_t  *mesh_quantities,
-                    unsigned                     bad_cell_flag[])
-{
-  cs_lnum_t  face_id, cell1, cell2;
-  double  of_n, off_1, off_2;
+      for (i = 0; i < dim; i++) {
 
-  const cs_real_t *v_of, *v_n;
+        /* Center of gravity of the cell */
+        cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
 
-  /* Loop on interior faces */
+        /* Face center coordinates */
+        face_center[i] = mesh_quantities->b_face_cog[face_id*dim + i];
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+        /* Surface vector (orthogonal to the face) */
+        face_normal[i] = mesh_quantities->b_face_normal[face_id*dim + i];
 
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
+      }
 
-    /* Compute center offsetting coefficient,
-       in a manner consistent with iterative gradient reconstruction */
+      /* Evaluate the non-orthogonality. */
+      for (i = 0; i < dim; i++)
+        vect[i] = face_center[i] - cell_center1[i];
 
-    v_of = &(mesh_quantities->dofij[face_id*3]);
-    v_n = &(mesh_quantities->i_face_normal[face_id*3]);
-    of_n = cs_math_3_norm(v_of) * cs_math_3_norm(v_n);
+      cs_real_t v1[3], v2[3];
 
-    off_1 = 1 - pow(of_n / mesh_quantities->cell_vol[cell1], 1/3.);
-    off_2 = 1 - pow(of_n / mesh_quantities->cell_vol[cell2], 1/3.);
+      cs_math_3_normalize(vect, v1);
+      cs_math_3_normalize(face_normal, v2);
 
-    if (off_1 < 0.1)
-      bad_cell_flag[cell1] |= CS_BAD_CELL_OFFSET;
-    if (off_2 < 0.1)
-      bad_cell_flag[cell2] |= CS_BAD_CELL_OFFSET;
+      cos_alpha = cs_math_3_dot_product(v1, v2);
+
+      if (cos_alpha < 0.1)
+        bad_cell_flag[cell1] |= CS_BAD_CELL_ORTHO_NORM;
+    }
 
   }
 
+  /* Single halo exchange for all fused criteria */
+
   if (mesh->halo != NULL)
     cs_halo_sync_untyped(mesh->halo,
                          CS_HALO_EXTENDED,
@@ -284,7 +282,6 @@ _compute_least_squares(const cs_mesh_t             *mesh,
                        const cs_mesh_quantities_t  *mesh_quantities,
                        unsigned                     bad_cell_flag[])
 {
-  cs_real_t lsq;
   const cs_lnum_t  dim = mesh->dim;
   const cs_lnum_t  n_cells = mesh->n_cells;
   const cs_lnum_t  n_cells_wghosts = mesh->n_cells_with_ghosts;
@@ -292,12 +289,8 @@ _compute_least_squares(const cs_mesh_t             *mesh,
   const cs_real_3_t *b_face_normal
     = (const cs_real_3_t *)mesh_quantities->b_face_normal;
 
-  cs_lnum_t     i, k, face_id, cell1, cell2, cell_id;
-  cs_real_3_t   cell_center1, cell_center2, vect, dij, eigenvalues;
-  cs_real_33_t  w2;
-
-  double min_diag, max_diag;
-  double xam, q, p, r, phi;
+  cs_lnum_t     i, face_id, cell1, cell2;
+  cs_real_3_t   cell_center1, cell_center2, vect, dij;
 
   cs_real_t *w1 = NULL;
 
@@ -366,7 +359,18 @@ _compute_least_squares(const cs_mesh_t             *mesh,
     w1[cell1 + 5 * n_cells_wghosts] += dij[1] * dij[2];
   }
 
-  for (cell_id = 0; cell_id < n_cells; cell_id++) {
+  /* The per-cell eigenvalue computation is independent from one cell
+     to the next, so it may be threaded */
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+
+    cs_lnum_t     ii, kk;
+    cs_real_3_t   eigenvalues;
+    cs_real_33_t  w2;
+
+    double min_diag, max_diag;
+    double xam, q, p, r, phi;
 
     w2[0][0] = w1[cell_id];
     w2[1][1] = w1[cell_id + n_cells_wghosts];
@@ -384,8 +388,8 @@ _compute_least_squares(const cs_mesh_t             *mesh,
 
     /* First check if the matrix is diagonal */
     if (xam <= 0.) {
-      for (i = 0; i < 3; i++)
-        eigenvalues[i] = w2[i][i];
+      for (ii = 0; ii < 3; ii++)
+        eigenvalues[ii] = w2[ii][ii];
     }
 
     /* If the matrix is not diagonal, we get the eigenvalues from a
@@ -399,12 +403,12 @@ _compute_least_squares(const cs_mesh_t             *mesh,
 
       p = sqrt(p / 6.);
 
-      for (i = 0; i < 3; i++) {
-        for (k = 0; k < 3; k++) {
-          if (i == k)
-            w2[i][k] = (1. / p) * (w2[i][k] - q);
+      for (ii = 0; ii < 3; ii++) {
+        for (kk = 0; kk < 3; kk++) {
+          if (ii == kk)
+            w2[ii][kk] = (1. / p) * (w2[ii][kk] - q);
           else
-            w2[i][k] = (1. / p) * (w2[i][k]);
+            w2[ii][kk] = (1. / p) * (w2[ii][kk]);
         }
       }
 
@@ -436,12 +440,12 @@ _compute_least_squares(const cs_mesh_t             *mesh,
     min_diag = 1.e15;
     max_diag = 0.;
 
-    for (i = 0; i < 3; i++) {
-      min_diag = fmin(min_diag, fabs(eigenvalues[i]));
-      max_diag = fmax(max_diag, fabs(eigenvalues[i]));
+    for (ii = 0; ii < 3; ii++) {
+      min_diag = fmin(min_diag, fabs(eigenvalues[ii]));
+      max_diag = fmax(max_diag, fabs(eigenvalues[ii]));
     }
 
-    lsq = min_diag / max_diag;
+    cs_real_t lsq = min_diag / max_diag;
 
     if (lsq < 0.1)
       bad_cell_flag[cell_id] |= CS_BAD_CELL_LSQ_GRAD;
@@ -456,53 +460,6 @@ _compute_least_squares(const cs_mesh_t             *mesh,
                          bad_cell_flag);
 }
 
-/*----------------------------------------------------------------------------
- * Evaluate cell's volume ratio.
- *
- * Compute Volume Ratio coefficient for cells.
- * Evaluates a the cell's geometric continuity (based on volume ratio) and
- * tags identified bad cells.
- *
- * parameters:
- *   mesh                <-- pointer to associated mesh structure
- *   mesh_quantities     <-- pointer to associated mesh quantities structure
- *   bad_cell_flag       --> array of bad cell flags for various uses
- *----------------------------------------------------------------------------*/
-
-static void
-_compute_volume_ratio(const cs_mesh_t             *mesh,
-                      const cs_mesh_quantities_t  *mesh_quantities,
-                      unsigned                     bad_cell_flag[])
-{
-  double vol_ratio;
-  cs_real_t *volume = mesh_quantities->cell_vol;
-
-  cs_lnum_t   face_id, cell1, cell2;
-
-  /* Loop on interior faces */
-  /*------------------------*/
-
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
-
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
-
-    vol_ratio = fmin(volume[cell1] / volume[cell2],
-                     volume[cell2] / volume[cell1]);
-
-    if (vol_ratio < 0.1*0.1) {
-      bad_cell_flag[cell1] |= CS_BAD_CELL_RATIO;
-      bad_cell_flag[cell2] |= CS_BAD_CELL_RATIO;
-    }
-  }
-
-  if (mesh->halo != NULL)
-    cs_halo_sync_untyped(mesh->halo,
-                         CS_HALO_EXTENDED,
-                         sizeof(unsigned),
-                         bad_cell_flag);
-}
-
 /*----------------------------------------------------------------------------
  * Post-process bad cell quality indicators.
  *
@@ -854,6 +811,15 @@ cs_mesh_bad_cells_detect(const cs_mesh_t       *mesh,
   if (_type_flag_compute[call_type] == 0)
     return;
 
+  /* For per time step calls, if the vertex coordinates cannot change,
+     the geometric criteria evaluated at the previous call are still
+     valid, so the previously computed flags may simply be kept */
+
+  if (   call_type == 1
+      && mesh_quantities->bad_cell_flag != NULL
+      && mesh->time_dep < CS_MESH_TRANSIENT_COORDS)
+    return;
+
   /* Check input data */
 
   assert(mesh_quantities->i_face_normal != NULL || mesh->n_i_faces == 0);
@@ -881,14 +847,27 @@ cs_mesh_bad_cells_detect(const cs_mesh_t       *mesh,
   /* Evaluate mesh quality criteria */
   /*--------------------------------*/
 
-  /* Condition 1: Orthogonal Normal */
-  /*--------------------------------*/
+  /* Face-based criteria (conditions 1, 2, and 4) are fused in a
+     single sweep over faces, with a single halo exchange */
+
+  {
+    int face_criteria_flag
+      = _type_flag_compute[call_type] & (  CS_BAD_CELL_ORTHO_NORM
+                                         | CS_BAD_CELL_OFFSET
+                                         | CS_BAD_CELL_RATIO);
 
-  if (_type_flag_compute[call_type] & CS_BAD_CELL_ORTHO_NORM)
-    _compute_ortho_norm(mesh,
-                        mesh_quantities,
-                        bad_cell_flag);
+    if (cs_glob_mesh_quantities->min_vol < 0.)
+      face_criteria_flag &= ~CS_BAD_CELL_OFFSET;
 
+    if (face_criteria_flag != 0)
+      _compute_face_criteria(mesh,
+                             mesh_quantities,
+                             face_criteria_flag,
+                             bad_cell_flag);
+  }
+
+  /* Condition 1: Orthogonal Normal */
+  /*--------------------------------*/
 
   if (_type_flag_compute[call_type_log] & CS_BAD_CELL_ORTHO_NORM) {
 
@@ -916,12 +895,6 @@ cs_mesh_bad_cells_detect(const cs_mesh_t       *mesh,
   /* Condition 2: Orthogonal A-Frame */
   /*---------------------------------*/
 
-  if (   _type_flag_compute[call_type] & CS_BAD_CELL_OFFSET
-      && cs_glob_mesh_quantities->min_vol >= 0.)
-    _compute_offsetting(mesh,
-                        mesh_quantities,
-                        bad_cell_flag);
-
   if (   _type_flag_compute[call_type_log] & CS_BAD_CELL_OFFSET
       && cs_glob_mesh_quantities->min_vol >= 0.) {
 
@@ -980,11 +953,6 @@ cs_mesh_bad_cells_detect(const cs_mesh_t       *mesh,
   /* Condition 4: Volume Ratio */
   /*---------------------------*/
 
-  if (_type_flag_compute[call_type] & CS_BAD_CELL_RATIO)
-    _compute_volume_ratio(mesh,
-                          mesh_quantities,
-                          bad_cell_flag);
-
   if (_type_flag_compute[call_type_log] & CS_BAD_CELL_RATIO) {
 
     ibad = 0;
@@ -360,6 +360,120 @@ _expand_limit(const cs_mesh_t  *m,
   return count;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select cells in a band around flagged vertices.
+ *
+ * The band is grown by the given number of cell layers, exchanging
+ * vertex flags at parallel boundaries for each layer.
+ *
+ * \param[in]   m          mesh
+ * \param[in]   vtx_flag   vertex flag (0 for unflagged)
+ * \param[in]   n_layers   number of cell layers in band
+ * \param[out]  cell_flag  cell selection flag (size: m->n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_select_cells_near_vertices(const cs_mesh_t  *m,
+                            const char       *vtx_flag,
+                            int               n_layers,
+                            char             *cell_flag)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_lnum_t n_vertices = m->n_vertices;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_flag[i] = 0;
+
+  char *_vtx_flag;
+  BFT_MALLOC(_vtx_flag, n_vertices, char);
+  memcpy(_vtx_flag, vtx_flag, n_vertices);
+
+  for (int layer = 0; layer < n_layers; layer++) {
+
+    /* Flag cells adjacent to flagged vertices */
+
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+      bool flag_cells = false;
+      cs_lnum_t s_id = m->i_face_vtx_idx[f_id];
+      cs_lnum_t e_id = m->i_face_vtx_idx[f_id+1];
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
+        if (_vtx_flag[m->i_face_vtx_lst[i]] != 0)
+          flag_cells = true;
+      }
+      if (flag_cells) {
+        cs_lnum_t c_id0 = m->i_face_cells[f_id][0];
+        cs_lnum_t c_id1 = m->i_face_cells[f_id][1];
+        if (c_id0 > -1 && c_id0 < n_cells)
+          cell_flag[c_id0] = 1;
+        if (c_id1 > -1 && c_id1 < n_cells)
+          cell_flag[c_id1] = 1;
+      }
+    }
+
+    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+      bool flag_cells = false;
+      cs_lnum_t s_id = m->b_face_vtx_idx[f_id];
+      cs_lnum_t e_id = m->b_face_vtx_idx[f_id+1];
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
+        if (_vtx_flag[m->b_face_vtx_lst[i]] != 0)
+          flag_cells = true;
+      }
+      if (flag_cells) {
+        cs_lnum_t c_id0 = m->b_face_cells[f_id];
+        if (c_id0 > -1 && c_id0 < n_cells)
+          cell_flag[c_id0] = 1;
+      }
+    }
+
+    if (layer == n_layers - 1)
+      break;
+
+    /* Flag vertices of selected cells so as to grow the band */
+
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+      bool flag_vertices = false;
+      cs_lnum_t c_id0 = m->i_face_cells[f_id][0];
+      cs_lnum_t c_id1 = m->i_face_cells[f_id][1];
+      if (c_id0 > -1 && c_id0 < n_cells && cell_flag[c_id0] != 0)
+        flag_vertices = true;
+      if (c_id1 > -1 && c_id1 < n_cells && cell_flag[c_id1] != 0)
+        flag_vertices = true;
+      if (flag_vertices) {
+        cs_lnum_t s_id = m->i_face_vtx_idx[f_id];
+        cs_lnum_t e_id = m->i_face_vtx_idx[f_id+1];
+        for (cs_lnum_t i = s_id; i < e_id; i++)
+          _vtx_flag[m->i_face_vtx_lst[i]] = 1;
+      }
+    }
+
+    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+      cs_lnum_t c_id0 = m->b_face_cells[f_id];
+      if (c_id0 > -1 && c_id0 < n_cells && cell_flag[c_id0] != 0) {
+        cs_lnum_t s_id = m->b_face_vtx_idx[f_id];
+        cs_lnum_t e_id = m->b_face_vtx_idx[f_id+1];
+        for (cs_lnum_t i = s_id; i < e_id; i++)
+          _vtx_flag[m->b_face_vtx_lst[i]] = 1;
+      }
+    }
+
+    if (m->vtx_interfaces != NULL) {
+      cs_interface_set_max(m->vtx_interfaces,
+                           n_vertices,
+                           1,    /* stride */
+                           true, /* interlace */
+                           CS_CHAR,
+                           _vtx_flag);
+    }
+
+  }
+
+  BFT_FREE(_vtx_flag);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Prescribe displacements based on extrusion vector definitions.
@@ -506,6 +620,21 @@ cs_mesh_boundary_layer_insert(cs_mesh_t                  *m,
   const cs_lnum_t n_cells_ini = m->n_cells;
   const cs_real_t *cell_vol_ref = mq->cell_vol;
 
+  /* Work arrays for the displacement limiter; on retries following a
+     limiter pass, only a band of cells around the vertices at which
+     insertion was reduced is rechecked, and the full mesh is rechecked
+     once before a displacement is accepted. */
+
+  cs_real_t *cell_vol_cmp = NULL;
+  char *cell_sel_flag = NULL, *vtx_flag = NULL;
+  bool full_check = true;
+
+  if (min_volume_factor > 0 && min_volume_factor < 1) {
+    BFT_MALLOC(cell_vol_cmp, n_cells_ini, cs_real_t);
+    BFT_MALLOC(cell_sel_flag, n_cells_ini, char);
+    BFT_MALLOC(vtx_flag, m->n_vertices, char);
+  }
+
   bool compute_displacement = true;
 
   while (compute_displacement) {
@@ -535,53 +664,80 @@ cs_mesh_boundary_layer_insert(cs_mesh_t                  *m,
 
       cs_gnum_t  counts[4] = {0, 0, 0, 0};
 
-      cs_real_t *cell_vol_cmp = cs_mesh_quantities_cell_volume(m);
+      bool local_check = (full_check == false);
 
-      for (cs_lnum_t i = 0; i < n_cells_ini; i++) {
-        if (cell_vol_cmp[i] <= 0) {
-          cell_vol_cmp[i] = -3;
-          counts[0] += 1;
+      while (true) {
+
+        for (int i = 0; i < 4; i++)
+          counts[i] = 0;
+
+        if (local_check)
+          _select_cells_near_vertices(m, vtx_flag, 3, cell_sel_flag);
+        else {
+          for (cs_lnum_t i = 0; i < n_cells_ini; i++)
+            cell_sel_flag[i] = 1;
         }
-        else if (cell_vol_cmp[i] < cell_vol_ref[i]*min_volume_factor) {
-          cell_vol_cmp[i] = -2;
-          counts[1] += 1;
+
+        /* Cells outside the checked band were verified at the previous
+           pass; reset their comparative volume to the (acceptable)
+           reference volume so limiter marks do not linger */
+
+        for (cs_lnum_t i = 0; i < n_cells_ini; i++) {
+          if (cell_sel_flag[i] == 0)
+            cell_vol_cmp[i] = cell_vol_ref[i];
         }
-      }
 
-      const cs_lnum_t n_vertices = m->n_vertices;
+        cs_mesh_quantities_cell_volume_selected(m, cell_sel_flag, cell_vol_cmp);
 
-      char *vtx_flag;
-      BFT_MALLOC(vtx_flag, n_vertices, char);
+        for (cs_lnum_t i = 0; i < n_cells_ini; i++) {
+          if (cell_sel_flag[i] == 0)
+            continue;
+          if (cell_vol_cmp[i] <= 0) {
+            cell_vol_cmp[i] = -3;
+            counts[0] += 1;
+          }
+          else if (cell_vol_cmp[i] < cell_vol_ref[i]*min_volume_factor) {
+            cell_vol_cmp[i] = -2;
+            counts[1] += 1;
+          }
+        }
 
-      /* Flag vertices adjacent to cells with bad volumes */
+        /* Flag vertices adjacent to cells with bad volumes */
 
-      _flag_vertices_for_limiter(m,
-                                 cell_vol_cmp,
-                                 vtx_flag);
+        _flag_vertices_for_limiter(m,
+                                   cell_vol_cmp,
+                                   vtx_flag);
 
-      /* Now adjust extrusion vectors structure,
-         removing a layer at flagged vertices */
+        /* Now adjust extrusion vectors structure,
+           removing a layer at flagged vertices */
 
-      counts[2] = _extrude_vector_limit(vtx_flag, e);
+        counts[2] = _extrude_vector_limit(vtx_flag, e);
 
-      cs_parall_sum(3, CS_GNUM_TYPE, counts);
+        cs_parall_sum(3, CS_GNUM_TYPE, counts);
 
-      /* If bad volumes are present but not adjacent to a boundary
-         layer insertion zone, propagate to neighboring volumes */
+        /* If bad volumes are present but not adjacent to a boundary
+           layer insertion zone, propagate to neighboring volumes */
 
-      const int max_propagation_iter = 30;
-      for (int p_iter = 0;
-           counts[0] > 0 && counts[2] == 0 && p_iter < max_propagation_iter;
-           p_iter++) {
-        counts[3] = _expand_limit(m, cell_vol_cmp, vtx_flag);
-        _flag_vertices_for_limiter(m, cell_vol_cmp, vtx_flag);
-        counts[2] = _extrude_vector_limit(vtx_flag, e);
-        cs_parall_sum(2, CS_GNUM_TYPE, counts+2); /* do not change initial
-                                                     cell counts */
-      }
+        const int max_propagation_iter = 30;
+        for (int p_iter = 0;
+             counts[0] > 0 && counts[2] == 0 && p_iter < max_propagation_iter;
+             p_iter++) {
+          counts[3] = _expand_limit(m, cell_vol_cmp, vtx_flag);
+          _flag_vertices_for_limiter(m, cell_vol_cmp, vtx_flag);
+          counts[2] = _extrude_vector_limit(vtx_flag, e);
+          cs_parall_sum(2, CS_GNUM_TYPE, counts+2); /* do not change initial
+                                                       cell counts */
+        }
+
+        if (counts[0] > 0 || counts[2] > 0 || local_check == false)
+          break;
 
-      BFT_FREE(vtx_flag);
-      BFT_FREE(cell_vol_cmp);
+        /* Band check passed: run the deferred full check before
+           accepting the displacement */
+
+        local_check = false;
+
+      }
 
       if (counts[2] > 0) {
 
@@ -595,6 +751,7 @@ cs_mesh_boundary_layer_insert(cs_mesh_t                  *m,
            min_volume_factor);
 
         compute_displacement = true;
+        full_check = false;
 
       }
 
@@ -624,6 +781,10 @@ cs_mesh_boundary_layer_insert(cs_mesh_t                  *m,
 
   }
 
+  BFT_FREE(cell_vol_cmp);
+  BFT_FREE(cell_sel_flag);
+  BFT_FREE(vtx_flag);
+
   cs_mesh_deform_finalize();
 
   cell_vol_ref = NULL;
@@ -284,8 +284,8 @@ _extract_face_cell(cs_mesh_t         *mesh,
 
   /* Allocate arrays */
 
-  BFT_MALLOC(mesh->i_face_cells, mesh->n_i_faces, cs_lnum_2_t);
-  BFT_MALLOC(mesh->b_face_cells, mesh->n_b_faces, cs_lnum_t);
+  BFT_MALLOC_HP(mesh->i_face_cells, mesh->n_i_faces, cs_lnum_2_t);
+  BFT_MALLOC_HP(mesh->b_face_cells, mesh->n_b_faces, cs_lnum_t);
 
   /* Now copy face -> cell connectivity */
 
@@ -345,16 +345,16 @@ _extract_face_vertices(cs_mesh_t         *mesh,
 
   /* Allocate and initialize */
 
-  BFT_MALLOC(mesh->i_face_vtx_idx, mesh->n_i_faces+1, cs_lnum_t);
-  BFT_MALLOC(mesh->i_face_vtx_lst, mesh->i_face_vtx_connect_size, cs_lnum_t);
+  BFT_MALLOC_HP(mesh->i_face_vtx_idx, mesh->n_i_faces+1, cs_lnum_t);
+  BFT_MALLOC_HP(mesh->i_face_vtx_lst, mesh->i_face_vtx_connect_size, cs_lnum_t);
 
   mesh->i_face_vtx_idx[0] = 0;
 
-  BFT_MALLOC(mesh->b_face_vtx_idx, mesh->n_b_faces+1, cs_lnum_t);
+  BFT_MALLOC_HP(mesh->b_face_vtx_idx, mesh->n_b_faces+1, cs_lnum_t);
   mesh->b_face_vtx_idx[0] = 0;
 
   if (mesh->n_b_faces > 0)
-    BFT_MALLOC(mesh->b_face_vtx_lst, mesh->b_face_vtx_connect_size, cs_lnum_t);
+    BFT_MALLOC_HP(mesh->b_face_vtx_lst, mesh->b_face_vtx_connect_size, cs_lnum_t);
 
   /* Now copy face -> vertices connectivity */
 
@@ -3094,6 +3094,296 @@ cs_mesh_halo_define(cs_mesh_t           *mesh,
 #endif
 }
 
+/*----------------------------------------------------------------------------
+ * Update halo structures incrementally after a local mesh modification.
+ *
+ * This avoids the full vertex-matching halo construction when the mesh
+ * has been modified in place (such as by refinement or coarsening),
+ * provided the communicating rank neighborhood is unchanged and the
+ * caller provides the old-to-new cell mapping.
+ *
+ * The mapping is given in indexed form: for each previous local cell,
+ * the new cells replacing it (its sub-cells in case of refinement, or
+ * the merged cell in case of coarsening, which may be referenced by
+ * several old cells; only its first occurrence in a given halo section
+ * is kept). An old cell mapped to no new cell is removed from the halo.
+ *
+ * Note that when a halo cell is replaced by several new cells, all of
+ * those cells are kept in the halo, so the updated halo may be slightly
+ * larger than a fully rebuilt one.
+ *
+ * Not available for meshes with periodicity, where the full rebuild
+ * is required.
+ *
+ * parameters:
+ *   mesh        <-> pointer to mesh structure
+ *   o2n_idx     <-- old-to-new cell index (size: old n_cells + 1)
+ *   o2n         <-- new cell ids (size: o2n_idx[old n_cells])
+ *   p_g_o2n_idx --> if non-NULL, pointer to old-to-new ghost cell index
+ *                   (size: old n_ghost_cells + 1); new ghost cell ids
+ *                   are implicit, as mesh->n_cells + position in the
+ *                   indexed range
+ *---------------------------------------------------------------------------*/
+
+void
+cs_mesh_halo_update(cs_mesh_t        *mesh,
+                    const cs_lnum_t   o2n_idx[],
+                    const cs_lnum_t   o2n[],
+                    cs_lnum_t       **p_g_o2n_idx)
+{
+  cs_halo_t  *halo = mesh->halo;
+
+  if (halo == NULL)
+    return;
+
+  if (mesh->n_init_perio > 0 || halo->n_transforms > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: incremental halo update is not available for meshes\n"
+                "with periodicity; a full halo rebuild is required."),
+              __func__);
+
+  const cs_lnum_t n_c_domains = halo->n_c_domains;
+  const cs_lnum_t n_sections = 2*n_c_domains;
+  const cs_lnum_t local_rank = (cs_glob_rank_id == -1) ? 0:cs_glob_rank_id;
+
+  const cs_lnum_t n_old_send_elts = halo->send_index[n_sections];
+  const cs_lnum_t n_old_ghost_elts = halo->index[n_sections];
+
+#if defined(HAVE_MPI)
+  MPI_Request _request[128];
+  MPI_Request *request = _request;
+  MPI_Status _status[128];
+  MPI_Status *status = _status;
+  int request_count = 0;
+
+  if (n_c_domains*2 > 128) {
+    BFT_MALLOC(request, n_c_domains*2, MPI_Request);
+    BFT_MALLOC(status, n_c_domains*2, MPI_Status);
+  }
+#endif
+
+  /* Build new send list, replacing each element by its new matches */
+  /* -------------------------------------------------------------- */
+
+  cs_lnum_t *entry_count, *flag;
+  BFT_MALLOC(entry_count, n_old_send_elts, cs_lnum_t);
+  BFT_MALLOC(flag, mesh->n_cells, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < mesh->n_cells; i++)
+    flag[i] = -1;
+
+  cs_lnum_t new_size_max = 0;
+  for (cs_lnum_t i = 0; i < n_old_send_elts; i++) {
+    cs_lnum_t c_id = halo->send_list[i];
+    new_size_max += o2n_idx[c_id+1] - o2n_idx[c_id];
+  }
+
+  cs_lnum_t *new_send_list;
+  CS_MALLOC_HD(new_send_list, new_size_max, cs_lnum_t,
+               cs_halo_get_buffer_alloc_mode());
+
+  /* Save old send index, as entry counts are exchanged relative to the
+     old send positions */
+
+  cs_lnum_t *old_send_index;
+  BFT_MALLOC(old_send_index, n_sections + 1, cs_lnum_t);
+  memcpy(old_send_index, halo->send_index,
+         (n_sections + 1)*sizeof(cs_lnum_t));
+
+  cs_lnum_t shift = 0;
+
+  for (cs_lnum_t s = 0; s < n_sections; s++) {
+
+    cs_lnum_t s_id = old_send_index[s];
+    cs_lnum_t e_id = old_send_index[s+1];
+
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      cs_lnum_t c_id = halo->send_list[i];
+      cs_lnum_t n_sub = 0;
+      for (cs_lnum_t j = o2n_idx[c_id]; j < o2n_idx[c_id+1]; j++) {
+        cs_lnum_t n_id = o2n[j];
+        if (flag[n_id] != s) {
+          flag[n_id] = s;
+          new_send_list[shift++] = n_id;
+          n_sub += 1;
+        }
+      }
+      entry_count[i] = n_sub;
+    }
+
+    halo->send_index[s+1] = shift;
+
+  }
+
+  BFT_FREE(flag);
+
+  CS_REALLOC_HD(new_send_list, shift, cs_lnum_t,
+                cs_halo_get_buffer_alloc_mode());
+  CS_FREE_HD(halo->send_list);
+  halo->send_list = new_send_list;
+
+  halo->n_send_elts[CS_HALO_STANDARD] = 0;
+  for (cs_lnum_t i = 0; i < n_c_domains; i++)
+    halo->n_send_elts[CS_HALO_STANDARD] +=   halo->send_index[2*i+1]
+                                           - halo->send_index[2*i];
+  halo->n_send_elts[CS_HALO_EXTENDED] = shift;
+
+  /* Exchange per-element counts so each rank may rebuild its
+     receive index and ghost cell mapping */
+  /*------------------------------------------------------------*/
+
+  cs_lnum_t *ghost_count;
+  BFT_MALLOC(ghost_count, n_old_ghost_elts, cs_lnum_t);
+
+#if defined(HAVE_MPI)
+
+  /* Receive counts from distant ranks (the old receive index is
+     still intact at this stage) */
+
+  for (cs_lnum_t rank_id = 0; rank_id < n_c_domains; rank_id++) {
+
+    if (halo->c_domain_rank[rank_id] != local_rank) {
+
+      cs_lnum_t start = halo->index[2*rank_id];
+      cs_lnum_t length =   halo->index[2*rank_id+2]
+                         - halo->index[2*rank_id];
+
+      if (length > 0)
+        MPI_Irecv(ghost_count + start,
+                  length,
+                  CS_MPI_LNUM,
+                  halo->c_domain_rank[rank_id],
+                  halo->c_domain_rank[rank_id],
+                  cs_glob_mpi_comm,
+                  &(request[request_count++]));
+
+    }
+
+  }
+
+  /* Send counts to distant ranks */
+
+  for (cs_lnum_t rank_id = 0; rank_id < n_c_domains; rank_id++) {
+
+    if (halo->c_domain_rank[rank_id] != local_rank) {
+
+      cs_lnum_t start = old_send_index[2*rank_id];
+      cs_lnum_t length =   old_send_index[2*rank_id+2]
+                         - old_send_index[2*rank_id];
+
+      if (length > 0)
+        MPI_Isend(entry_count + start,
+                  length,
+                  CS_MPI_LNUM,
+                  halo->c_domain_rank[rank_id],
+                  local_rank,
+                  cs_glob_mpi_comm,
+                  &(request[request_count++]));
+
+    }
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Local copy if present */
+
+  for (cs_lnum_t rank_id = 0; rank_id < n_c_domains; rank_id++) {
+
+    if (halo->c_domain_rank[rank_id] == local_rank) {
+
+      cs_lnum_t r_start = halo->index[2*rank_id];
+      cs_lnum_t s_start = old_send_index[2*rank_id];
+      cs_lnum_t length =   halo->index[2*rank_id+2]
+                         - halo->index[2*rank_id];
+
+      for (cs_lnum_t i = 0; i < length; i++)
+        ghost_count[r_start + i] = entry_count[s_start + i];
+
+    }
+
+  }
+
+#if defined(HAVE_MPI)
+
+  if (request_count > 0) {
+    MPI_Waitall(request_count, request, status);
+    request_count = 0;
+  }
+
+  if (request != _request) {
+    BFT_FREE(request);
+    BFT_FREE(status);
+  }
+
+#endif
+
+  BFT_FREE(old_send_index);
+  BFT_FREE(entry_count);
+
+  /* Rebuild receive index and update mesh ghost metadata */
+  /*------------------------------------------------------*/
+
+  cs_lnum_t *s_count;
+  BFT_MALLOC(s_count, n_sections, cs_lnum_t);
+
+  for (cs_lnum_t s = 0; s < n_sections; s++) {
+    cs_lnum_t count = 0;
+    for (cs_lnum_t i = halo->index[s]; i < halo->index[s+1]; i++)
+      count += ghost_count[i];
+    s_count[s] = count;
+  }
+
+  if (p_g_o2n_idx != NULL) {
+    cs_lnum_t *g_o2n_idx;
+    BFT_MALLOC(g_o2n_idx, n_old_ghost_elts + 1, cs_lnum_t);
+    g_o2n_idx[0] = 0;
+    for (cs_lnum_t i = 0; i < n_old_ghost_elts; i++)
+      g_o2n_idx[i+1] = g_o2n_idx[i] + ghost_count[i];
+    *p_g_o2n_idx = g_o2n_idx;
+  }
+
+  BFT_FREE(ghost_count);
+
+  for (cs_lnum_t s = 0; s < n_sections; s++)
+    halo->index[s+1] = halo->index[s] + s_count[s];
+
+  BFT_FREE(s_count);
+
+  halo->n_elts[CS_HALO_STANDARD] = 0;
+  for (cs_lnum_t i = 0; i < n_c_domains; i++)
+    halo->n_elts[CS_HALO_STANDARD] +=   halo->index[2*i+1]
+                                      - halo->index[2*i];
+  halo->n_elts[CS_HALO_EXTENDED] = halo->index[n_sections];
+
+  halo->n_local_elts = mesh->n_cells;
+
+  mesh->n_ghost_cells = halo->n_elts[CS_HALO_EXTENDED];
+  mesh->n_cells_with_ghosts = mesh->n_cells + mesh->n_ghost_cells;
+
+  if (mesh->n_ghost_cells > 0)
+    BFT_REALLOC(mesh->cell_family, mesh->n_cells_with_ghosts, int);
+
+  /* Invalidate cached state matching the previous halo contents,
+     then rebuild the derived (device, one-sided, blocked send)
+     structures */
+
+  cs_halo_drop_state(halo);
+
+  CS_FREE_HD(halo->std_send_blocks);
+  halo->n_std_send_blocks = 0;
+
+#if defined(HAVE_MPI)
+  if (halo->c_domain_group != MPI_GROUP_NULL) {
+    MPI_Group_free(&(halo->c_domain_group));
+    halo->c_domain_group = MPI_GROUP_NULL;
+  }
+  BFT_FREE(halo->c_domain_s_shift);
+#endif
+
+  cs_halo_create_complete(halo);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -61,6 +61,35 @@ cs_mesh_halo_define(cs_mesh_t           *mesh,
                     cs_lnum_t           *p_gcell_vtx_idx[],
                     cs_lnum_t           *p_gcell_vtx_lst[]);
 
+/*----------------------------------------------------------------------------
+ * Update halo structures incrementally after a local mesh modification.
+ *
+ * This avoids the full vertex-matching halo construction when the mesh
+ * has been modified in place (such as by refinement or coarsening),
+ * provided the communicating rank neighborhood is unchanged and the
+ * caller provides the old-to-new cell mapping.
+ *
+ * The mapping is given in indexed form: for each previous local cell,
+ * the new cells replacing it. An old cell mapped to no new cell is
+ * removed from the halo. Not available for meshes with periodicity,
+ * where the full rebuild is required.
+ *
+ * parameters:
+ *   mesh        <-> pointer to mesh structure
+ *   o2n_idx     <-- old-to-new cell index (size: old n_cells + 1)
+ *   o2n         <-- new cell ids (size: o2n_idx[old n_cells])
+ *   p_g_o2n_idx --> if non-NULL, pointer to old-to-new ghost cell index
+ *                   (size: old n_ghost_cells + 1); new ghost cell ids
+ *                   are implicit, as mesh->n_cells + position in the
+ *                   indexed range
+ *---------------------------------------------------------------------------*/
+
+void
+cs_mesh_halo_update(cs_mesh_t        *mesh,
+                    const cs_lnum_t   o2n_idx[],
+                    const cs_lnum_t   o2n[],
+                    cs_lnum_t       **p_g_o2n_idx);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
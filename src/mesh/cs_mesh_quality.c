@@ -355,26 +355,30 @@ _compute_weighting_offsetting(const cs_mesh_t             *mesh,
                               cs_real_t                    weighting[],
                               cs_real_t                    offsetting[])
 {
-  cs_lnum_t  i, face_id, cell1, cell2;
-  cs_real_t  cell_center1[3], cell_center2[3];
-  cs_real_t  face_center[3], face_normal[3];
-  cs_real_t  v0[3], v1[3], v2[3];
-
-  double  coef0 = 0, coef1 = 0, coef2 = 0;
-
   const cs_lnum_t  dim = mesh->dim;
+  const cs_lnum_t  n_i_faces = mesh->n_i_faces;
 
-  /* Compute weighting coefficient */
-  /*-------------------------------*/
+  cs_real_t  *f_offset = NULL;
+  BFT_MALLOC(f_offset, 2*n_i_faces, cs_real_t);
+
+  /* Compute weighting coefficient and per-face offsetting contributions;
+     costly operations are face-local, so this first sweep may be threaded */
+  /*-----------------------------------------------------------------------*/
 
   /* Loop on internal faces */
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+# pragma omp parallel for if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+
+    cs_lnum_t  i;
+    cs_real_t  cell_center1[3], cell_center2[3];
+    cs_real_t  face_center[3], face_normal[3];
+    cs_real_t  v0[3], v1[3], v2[3];
 
     /* Get local number of the cells in contact with the face */
 
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
+    cs_lnum_t cell1 = mesh->i_face_cells[face_id][0];
+    cs_lnum_t cell2 = mesh->i_face_cells[face_id][1];
 
     /* Get information on mesh quantities */
 
@@ -405,14 +409,14 @@ _compute_weighting_offsetting(const cs_mesh_t             *mesh,
 
     }
 
-    coef0 = _DOT_PRODUCT_3D(v0, face_normal);
-    coef1 = _DOT_PRODUCT_3D(v1, face_normal)/coef0;
-    coef2 = _DOT_PRODUCT_3D(v2, face_normal)/coef0;
+    double coef0 = _DOT_PRODUCT_3D(v0, face_normal);
+    double coef1 = _DOT_PRODUCT_3D(v1, face_normal)/coef0;
+    double coef2 = _DOT_PRODUCT_3D(v2, face_normal)/coef0;
 
     weighting[face_id] = CS_MAX(coef1, coef2);
 
-    /* Compute center offsetting coefficient */
-    /*---------------------------------------*/
+    /* Compute center offsetting contribution for adjacent cells */
+    /*-----------------------------------------------------------*/
 
     for (i = 0; i < dim; i++) {
       v1[i] = mesh_quantities->dofij[face_id*3 + i];
@@ -420,13 +424,26 @@ _compute_weighting_offsetting(const cs_mesh_t             *mesh,
     }
     double of_s = _MODULE_3D(v1) * _MODULE_3D(v2);
 
-    offsetting[cell1] = CS_MIN(offsetting[cell1],
-        1. - pow(of_s / fabs(mesh_quantities->cell_vol[cell1]), 1./3.));
-    offsetting[cell2] = CS_MIN(offsetting[cell2],
-        1. - pow(of_s / fabs(mesh_quantities->cell_vol[cell2]), 1./3.));
+    f_offset[face_id*2]
+      = 1. - pow(of_s / fabs(mesh_quantities->cell_vol[cell1]), 1./3.);
+    f_offset[face_id*2 + 1]
+      = 1. - pow(of_s / fabs(mesh_quantities->cell_vol[cell2]), 1./3.);
 
   } /* End of loop on faces */
 
+  /* Serial face -> cell min reduction for the offsetting coefficient */
+
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+
+    cs_lnum_t cell1 = mesh->i_face_cells[face_id][0];
+    cs_lnum_t cell2 = mesh->i_face_cells[face_id][1];
+
+    offsetting[cell1] = CS_MIN(offsetting[cell1], f_offset[face_id*2]);
+    offsetting[cell2] = CS_MIN(offsetting[cell2], f_offset[face_id*2 + 1]);
+
+  }
+
+  BFT_FREE(f_offset);
 }
 
 /*----------------------------------------------------------------------------
@@ -446,24 +463,26 @@ _compute_orthogonality(const cs_mesh_t             *mesh,
                        cs_real_t                    i_face_ortho[],
                        cs_real_t                    b_face_ortho[])
 {
-  cs_lnum_t  i, face_id, cell1, cell2;
-  double  cos_alpha;
-  cs_real_t  cell_center1[3], cell_center2[3];
-  cs_real_t  face_center[3];
-  cs_real_t  face_normal[3], vect[3];
-
   const double  rad_to_deg = 180. / acos(-1.);
   const cs_lnum_t  dim = mesh->dim;
+  const cs_lnum_t  n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t  n_b_faces = mesh->n_b_faces;
 
   /* Loop on internal faces */
   /*------------------------*/
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+# pragma omp parallel for if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+
+    cs_lnum_t  i;
+    double  cos_alpha;
+    cs_real_t  cell_center1[3], cell_center2[3];
+    cs_real_t  face_normal[3], vect[3];
 
     /* Get local number of the cells beside the face */
 
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
+    cs_lnum_t cell1 = mesh->i_face_cells[face_id][0];
+    cs_lnum_t cell2 = mesh->i_face_cells[face_id][1];
 
     /* Get information on mesh quantities */
 
@@ -499,11 +518,18 @@ _compute_orthogonality(const cs_mesh_t             *mesh,
   /* Loop on border faces */
   /*----------------------*/
 
-  for (face_id = 0; face_id < mesh->n_b_faces; face_id++) {
+# pragma omp parallel for if (n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+
+    cs_lnum_t  i;
+    double  cos_alpha;
+    cs_real_t  cell_center1[3];
+    cs_real_t  face_center[3];
+    cs_real_t  face_normal[3], vect[3];
 
     /* Get local number of the cell beside the face */
 
-    cell1 = mesh->b_face_cells[face_id];
+    cs_lnum_t cell1 = mesh->b_face_cells[face_id];
 
     /* Get information on mesh quantities */
 
@@ -730,7 +756,10 @@ _compute_warp_error(const cs_mesh_t              *mesh,
   /* Build cell -> face connectivity */
   _build_c2f(mesh, &c2f_idx, &c2f_ids);
 
-  for (cs_lnum_t c_id = 0; c_id < mesh->n_cells; c_id++) {
+  const cs_lnum_t n_cells = mesh->n_cells;
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
 
     const cs_real_t  invvol_c = 1/vol[c_id];
     const cs_real_t  *xc = mesh_quantities->cell_cen + 3*c_id;
@@ -807,10 +836,8 @@ cs_mesh_quality_compute_warping(const cs_mesh_t    *mesh,
                                 cs_real_t           i_face_warping[],
                                 cs_real_t           b_face_warping[])
 {
-  cs_lnum_t  i, face_id, idx_start, idx_end;
-  cs_real_t  this_face_normal[3];
-
   const cs_lnum_t  dim = mesh->dim;
+  const cs_lnum_t  n_i_faces = mesh->n_i_faces;
   const cs_lnum_t  *i_face_vtx_idx = mesh->i_face_vtx_idx;
 
   assert(dim == 3);
@@ -818,7 +845,11 @@ cs_mesh_quality_compute_warping(const cs_mesh_t    *mesh,
   /* Compute warping for internal faces */
   /*------------------------------------*/
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+# pragma omp parallel for if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+
+    cs_lnum_t  i;
+    cs_real_t  this_face_normal[3];
 
     /* Get normal to the face */
 
@@ -827,8 +858,8 @@ cs_mesh_quality_compute_warping(const cs_mesh_t    *mesh,
 
     /* Evaluate warping for each edge of face. Keep the max. */
 
-    idx_start = i_face_vtx_idx[face_id];
-    idx_end = i_face_vtx_idx[face_id + 1];
+    cs_lnum_t idx_start = i_face_vtx_idx[face_id];
+    cs_lnum_t idx_end = i_face_vtx_idx[face_id + 1];
 
     _get_face_warping(idx_start,
                       idx_end,
@@ -863,11 +894,13 @@ cs_mesh_quality_compute_b_face_warping(const cs_mesh_t  *mesh,
                                        cs_real_t         b_face_warping[])
 {
   const cs_lnum_t  dim = mesh->dim;
+  const cs_lnum_t  n_b_faces = mesh->n_b_faces;
   const cs_lnum_t  *b_face_vtx_idx = mesh->b_face_vtx_idx;
 
   assert(dim == 3);
 
-  for (cs_lnum_t face_id = 0; face_id < mesh->n_b_faces; face_id++) {
+# pragma omp parallel for if (n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
 
     /* Evaluate warping for each edge */
 
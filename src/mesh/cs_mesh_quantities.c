@@ -2862,6 +2862,71 @@ _post_plane_ib(const cs_lnum_t      n_ib_cells,
   BFT_FREE(edge);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute the base bounding box of each cell (no tolerance applied).
+ *
+ * parameters:
+ *   m    <-- pointer to mesh structure
+ *   bbox --> cell bounding boxes (size: m->n_cells_with_ghosts)
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_cell_extents(const cs_mesh_t  *m,
+                      cs_real_6_t      *bbox)
+{
+  for (cs_lnum_t i = 0; i < m->n_cells_with_ghosts; i++) {
+    bbox[i][0] = HUGE_VAL;
+    bbox[i][1] = HUGE_VAL;
+    bbox[i][2] = HUGE_VAL;
+    bbox[i][3] = -HUGE_VAL;
+    bbox[i][4] = -HUGE_VAL;
+    bbox[i][5] = -HUGE_VAL;
+  }
+
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+
+  for (cs_lnum_t i = 0; i < n_i_faces; i++) {
+    cs_lnum_t c_id_0 = m->i_face_cells[i][0];
+    cs_lnum_t c_id_1 = m->i_face_cells[i][1];
+    cs_lnum_t s_id = m->i_face_vtx_idx[i];
+    cs_lnum_t e_id = m->i_face_vtx_idx[i+1];
+    for (cs_lnum_t j = s_id; j < e_id; j++) {
+      cs_lnum_t vtx_id = m->i_face_vtx_lst[j];
+      const cs_real_t *coo = m->vtx_coord + vtx_id*3;
+      if (c_id_0 > -1) {
+        for (cs_lnum_t k = 0; k < 3; k++) {
+          bbox[c_id_0][k] = CS_MIN(bbox[c_id_0][k], coo[k]);
+          bbox[c_id_0][k+3] = CS_MAX(bbox[c_id_0][k+3], coo[k]);
+        }
+      }
+      if (c_id_1 > -1) {
+        for (cs_lnum_t k = 0; k < 3; k++) {
+          bbox[c_id_1][k] = CS_MIN(bbox[c_id_1][k], coo[k]);
+          bbox[c_id_1][k+3] = CS_MAX(bbox[c_id_1][k+3], coo[k]);
+        }
+      }
+    }
+  }
+
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  for (cs_lnum_t i = 0; i < n_b_faces; i++) {
+    cs_lnum_t c_id = m->b_face_cells[i];
+    cs_lnum_t s_id = m->b_face_vtx_idx[i];
+    cs_lnum_t e_id = m->b_face_vtx_idx[i+1];
+    for (cs_lnum_t j = s_id; j < e_id; j++) {
+      cs_lnum_t vtx_id = m->b_face_vtx_lst[j];
+      const cs_real_t *coo = m->vtx_coord + vtx_id*3;
+      if (c_id > -1) {
+        for (cs_lnum_t k = 0; k < 3; k++) {
+          bbox[c_id][k] = CS_MIN(bbox[c_id][k], coo[k]);
+          bbox[c_id][k+3] = CS_MAX(bbox[c_id][k+3], coo[k]);
+        }
+      }
+    }
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -2986,6 +3051,7 @@ cs_mesh_quantities_create(void)
   mesh_quantities->has_disable_flag = 0;
   mesh_quantities->c_disable_flag = NULL;
   mesh_quantities->bad_cell_flag = NULL;
+  mesh_quantities->cell_extents = NULL;
 
   return (mesh_quantities);
 }
@@ -3065,6 +3131,7 @@ cs_mesh_quantities_free_all(cs_mesh_quantities_t  *mq)
   CS_FREE_HD(mq->b_sym_flag);
   CS_FREE_HD(mq->c_disable_flag);
   BFT_FREE(mq->bad_cell_flag);
+  BFT_FREE(mq->cell_extents);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -4498,6 +4565,9 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
 
   _n_computations++;
 
+  /* Cached cell extents are stale once the geometry changes */
+  BFT_FREE(mq->cell_extents);
+
   cs_mesh_quantities_compute_preprocess(m, mq);
 
   /* Fluid surfaces and volumes: point to standard quantities and
@@ -5094,6 +5164,170 @@ cs_mesh_quantities_cell_volume(const cs_mesh_t  *mesh)
   return cell_vol;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute cell volumes for a selection of cells.
+ *
+ * Face quantities are only computed for faces adjacent to the selected
+ * cells, so the cost of this function is proportional to the size of the
+ * selection, not to the mesh size; entries of cell_vol associated to
+ * unselected cells are not modified.
+ *
+ * parameters:
+ *   mesh      <-- pointer to a cs_mesh_t structure
+ *   cell_flag <-- per cell selection flag (0: ignore; size: n_cells)
+ *   cell_vol  <-> cell volumes (size: n_cells)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_cell_volume_selected(const cs_mesh_t  *mesh,
+                                        const char        cell_flag[],
+                                        cs_real_t         cell_vol[])
+{
+  const cs_lnum_t  n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t  n_b_faces = CS_MAX(mesh->n_b_faces, mesh->n_b_faces_all);
+  const cs_lnum_t  n_cells = mesh->n_cells;
+  const cs_lnum_2_t  *i_face_cells
+    = (const cs_lnum_2_t *)(mesh->i_face_cells);
+  const cs_lnum_t  *b_face_cells = mesh->b_face_cells;
+  const cs_real_3_t  *vtx_coord = (const cs_real_3_t *)(mesh->vtx_coord);
+
+  /* Compute face quantities only for faces adjacent to a selected cell;
+     other entries remain uninitialized, and are not accessed below. */
+
+  cs_real_3_t  *i_face_cog = NULL, *i_face_norm = NULL;
+  cs_real_3_t  *b_face_cog = NULL, *b_face_norm = NULL;
+
+  BFT_MALLOC(i_face_cog, n_i_faces, cs_real_3_t);
+  BFT_MALLOC(i_face_norm, n_i_faces, cs_real_3_t);
+  BFT_MALLOC(b_face_cog, n_b_faces, cs_real_3_t);
+  BFT_MALLOC(b_face_norm, n_b_faces, cs_real_3_t);
+
+# pragma omp parallel for  if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t c_id1 = i_face_cells[f_id][0];
+    cs_lnum_t c_id2 = i_face_cells[f_id][1];
+    bool selected = false;
+    if (c_id1 > -1 && c_id1 < n_cells && cell_flag[c_id1] != 0)
+      selected = true;
+    if (c_id2 > -1 && c_id2 < n_cells && cell_flag[c_id2] != 0)
+      selected = true;
+    if (selected)
+      _compute_face_quantities(1,
+                               vtx_coord,
+                               mesh->i_face_vtx_idx + f_id,
+                               mesh->i_face_vtx_lst,
+                               i_face_cog + f_id,
+                               i_face_norm + f_id);
+  }
+
+# pragma omp parallel for  if (n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    cs_lnum_t c_id1 = b_face_cells[f_id];
+    if (c_id1 > -1 && cell_flag[c_id1] != 0)
+      _compute_face_quantities(1,
+                               vtx_coord,
+                               mesh->b_face_vtx_idx + f_id,
+                               mesh->b_face_vtx_lst,
+                               b_face_cog + f_id,
+                               b_face_norm + f_id);
+  }
+
+  /* Compute approximate cell centers of selected cells using face
+     centers, as in cs_mesh_quantities_cell_faces_cog */
+
+  cs_real_3_t  *a_cell_cen = NULL;
+  cs_real_t  *cell_area = NULL;
+
+  BFT_MALLOC(a_cell_cen, n_cells, cs_real_3_t);
+  BFT_MALLOC(cell_area, n_cells, cs_real_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (cell_flag[c_id] != 0) {
+      cell_area[c_id] = 0.;
+      for (cs_lnum_t i = 0; i < 3; i++)
+        a_cell_cen[c_id][i] = 0.;
+    }
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    for (cs_lnum_t j = 0; j < 2; j++) {
+      cs_lnum_t c_id = i_face_cells[f_id][j];
+      if (c_id > -1 && c_id < n_cells && cell_flag[c_id] != 0) {
+        cs_real_t area = cs_math_3_norm(i_face_norm[f_id]);
+        cell_area[c_id] += area;
+        for (cs_lnum_t i = 0; i < 3; i++)
+          a_cell_cen[c_id][i] += i_face_cog[f_id][i]*area;
+      }
+    }
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    cs_lnum_t c_id = b_face_cells[f_id];
+    if (c_id > -1 && cell_flag[c_id] != 0) {
+      cs_real_t area = cs_math_3_norm(b_face_norm[f_id]);
+      cell_area[c_id] += area;
+      for (cs_lnum_t i = 0; i < 3; i++)
+        a_cell_cen[c_id][i] += b_face_cog[f_id][i]*area;
+    }
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (cell_flag[c_id] != 0) {
+      for (cs_lnum_t i = 0; i < 3; i++)
+        a_cell_cen[c_id][i] /= cell_area[c_id];
+    }
+  }
+
+  BFT_FREE(cell_area);
+
+  /* Now compute volumes of selected cells, using the same implicit
+     subdivision into face vertices-cell-center pyramids as
+     _compute_cell_quantities */
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (cell_flag[c_id] != 0)
+      cell_vol[c_id] = 0.;
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+
+    cs_lnum_t c_id1 = i_face_cells[f_id][0];
+    cs_lnum_t c_id2 = i_face_cells[f_id][1];
+
+    if (c_id1 > -1 && c_id1 < n_cells && cell_flag[c_id1] != 0)
+      cell_vol[c_id1] += cs_math_3_distance_dot_product(a_cell_cen[c_id1],
+                                                        i_face_cog[f_id],
+                                                        i_face_norm[f_id]);
+    if (c_id2 > -1 && c_id2 < n_cells && cell_flag[c_id2] != 0)
+      cell_vol[c_id2] += cs_math_3_distance_dot_product(i_face_cog[f_id],
+                                                        a_cell_cen[c_id2],
+                                                        i_face_norm[f_id]);
+
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+
+    cs_lnum_t c_id1 = b_face_cells[f_id];
+
+    if (c_id1 > -1 && cell_flag[c_id1] != 0)
+      cell_vol[c_id1] += cs_math_3_distance_dot_product(a_cell_cen[c_id1],
+                                                        b_face_cog[f_id],
+                                                        b_face_norm[f_id]);
+
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (cell_flag[c_id] != 0)
+      cell_vol[c_id] /= 3.0;
+  }
+
+  BFT_FREE(a_cell_cen);
+  BFT_FREE(b_face_norm);
+  BFT_FREE(b_face_cog);
+  BFT_FREE(i_face_norm);
+  BFT_FREE(i_face_cog);
+}
+
 /*----------------------------------------------------------------------------
  * Check that no negative volumes are present, and exit on error otherwise.
  *
@@ -5169,57 +5403,16 @@ cs_mesh_quantities_cell_extents(const cs_mesh_t  *m,
 
   BFT_MALLOC(bbox, m->n_cells_with_ghosts, cs_real_6_t);
 
-  for (cs_lnum_t i = 0; i < m->n_cells_with_ghosts; i++) {
-    bbox[i][0] = HUGE_VAL;
-    bbox[i][1] = HUGE_VAL;
-    bbox[i][2] = HUGE_VAL;
-    bbox[i][3] = -HUGE_VAL;
-    bbox[i][4] = -HUGE_VAL;
-    bbox[i][5] = -HUGE_VAL;
-  }
+  /* Reuse the cached base extents when available, so repeated
+     geometry queries do not recompute the face/vertex scatter. */
 
-  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
 
-  for (cs_lnum_t i = 0; i < n_i_faces; i++) {
-    cs_lnum_t c_id_0 = m->i_face_cells[i][0];
-    cs_lnum_t c_id_1 = m->i_face_cells[i][1];
-    cs_lnum_t s_id = m->i_face_vtx_idx[i];
-    cs_lnum_t e_id = m->i_face_vtx_idx[i+1];
-    for (cs_lnum_t j = s_id; j < e_id; j++) {
-      cs_lnum_t vtx_id = m->i_face_vtx_lst[j];
-      const cs_real_t *coo = m->vtx_coord + vtx_id*3;
-      if (c_id_0 > -1) {
-        for (cs_lnum_t k = 0; k < 3; k++) {
-          bbox[c_id_0][k] = CS_MIN(bbox[c_id_0][k], coo[k]);
-          bbox[c_id_0][k+3] = CS_MAX(bbox[c_id_0][k+3], coo[k]);
-        }
-      }
-      if (c_id_1 > -1) {
-        for (cs_lnum_t k = 0; k < 3; k++) {
-          bbox[c_id_1][k] = CS_MIN(bbox[c_id_1][k], coo[k]);
-          bbox[c_id_1][k+3] = CS_MAX(bbox[c_id_1][k+3], coo[k]);
-        }
-      }
-    }
-  }
-
-  const cs_lnum_t n_b_faces = m->n_b_faces;
-
-  for (cs_lnum_t i = 0; i < n_b_faces; i++) {
-    cs_lnum_t c_id = m->b_face_cells[i];
-    cs_lnum_t s_id = m->b_face_vtx_idx[i];
-    cs_lnum_t e_id = m->b_face_vtx_idx[i+1];
-    for (cs_lnum_t j = s_id; j < e_id; j++) {
-      cs_lnum_t vtx_id = m->b_face_vtx_lst[j];
-      const cs_real_t *coo = m->vtx_coord + vtx_id*3;
-      if (c_id > -1) {
-        for (cs_lnum_t k = 0; k < 3; k++) {
-          bbox[c_id][k] = CS_MIN(bbox[c_id][k], coo[k]);
-          bbox[c_id][k+3] = CS_MAX(bbox[c_id][k+3], coo[k]);
-        }
-      }
-    }
-  }
+  if (m == cs_glob_mesh && mq != NULL && mq->cell_extents != NULL)
+    memcpy(bbox, mq->cell_extents,
+           sizeof(cs_real_6_t)*m->n_cells_with_ghosts);
+  else
+    _compute_cell_extents(m, bbox);
 
   {
     const cs_lnum_t n_cells = m->n_cells;
@@ -5242,6 +5435,33 @@ cs_mesh_quantities_cell_extents(const cs_mesh_t  *m,
   return bbox;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the shared (cached) base bounding box for cells.
+ *
+ * The returned array has no tolerance applied; it is computed on the
+ * first call after each (re)computation of mesh quantities, then kept
+ * up to date by the mesh quantities structure, which owns it.
+ *
+ * \param[in]       m   pointer to mesh structure
+ * \param[in, out]  mq  pointer to mesh quantities structure
+ *
+ * \return  pointer to cell extents array, of size m->n_cells_with_ghosts
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_real_6_t *
+cs_mesh_quantities_cell_extents_shared(const cs_mesh_t       *m,
+                                       cs_mesh_quantities_t  *mq)
+{
+  if (mq->cell_extents == NULL) {
+    BFT_MALLOC(mq->cell_extents, m->n_cells_with_ghosts, cs_real_6_t);
+    _compute_cell_extents(m, mq->cell_extents);
+  }
+
+  return mq->cell_extents;
+}
+
 /*----------------------------------------------------------------------------
  * Return the number of times mesh quantities have been computed.
  *
@@ -165,6 +165,10 @@ typedef struct {
                                        used for fluid solid and porous models */
   unsigned     *bad_cell_flag;      /* Flag (mask) for bad cells detected */
 
+  cs_real_6_t  *cell_extents;       /* Cached cell bounding boxes, with no
+                                       tolerance applied (NULL if not
+                                       computed yet) */
+
 } cs_mesh_quantities_t ;
 
 /*============================================================================
@@ -450,6 +454,25 @@ cs_mesh_quantities_cell_faces_cog(const cs_mesh_t  *mesh,
 cs_real_t *
 cs_mesh_quantities_cell_volume(const cs_mesh_t  *mesh);
 
+/*----------------------------------------------------------------------------
+ * Compute cell volumes for a selection of cells.
+ *
+ * Face quantities are only computed for faces adjacent to the selected
+ * cells, so the cost of this function is proportional to the size of the
+ * selection, not to the mesh size; entries of cell_vol associated to
+ * unselected cells are not modified.
+ *
+ * parameters:
+ *   mesh      <-- pointer to a cs_mesh_t structure
+ *   cell_flag <-- per cell selection flag (0: ignore; size: n_cells)
+ *   cell_vol  <-> cell volumes (size: n_cells)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_cell_volume_selected(const cs_mesh_t  *mesh,
+                                        const char        cell_flag[],
+                                        cs_real_t         cell_vol[]);
+
 /*----------------------------------------------------------------------------
  * Check that no negative volumes are present, and exit on error otherwise.
  *
@@ -483,6 +506,25 @@ cs_real_6_t *
 cs_mesh_quantities_cell_extents(const cs_mesh_t  *m,
                                 cs_real_t         tolerance);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the shared (cached) base bounding box for cells.
+ *
+ * The returned array has no tolerance applied; it is computed on the
+ * first call after each (re)computation of mesh quantities, then kept
+ * up to date by the mesh quantities structure, which owns it.
+ *
+ * \param[in]       m   pointer to mesh structure
+ * \param[in, out]  mq  pointer to mesh quantities structure
+ *
+ * \return  pointer to cell extents array, of size m->n_cells_with_ghosts
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_real_6_t *
+cs_mesh_quantities_cell_extents_shared(const cs_mesh_t       *m,
+                                       cs_mesh_quantities_t  *mq);
+
 /*----------------------------------------------------------------------------
  * Return the number of times mesh quantities have been computed.
  *
@@ -1148,7 +1148,8 @@ _cell_r_types(const cs_mesh_t              *m,
               cs_mesh_refine_type_t         c_r_flag[],
               const cs_mesh_refine_type_t   f_r_flag[])
 {
-# pragma omp for schedule(dynamic, CS_CL_SIZE)
+# pragma omp parallel for schedule(dynamic, CS_CL_SIZE)  \
+                          if(m->n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++) {
 
     cs_lnum_t e_id = c2f->idx[c_id+1];
@@ -1232,7 +1233,8 @@ _new_cells_i_faces_count(const cs_mesh_t             *m,
 
   /* Now loop on faces to determine counts */
 
-# pragma omp for schedule(dynamic, CS_CL_SIZE)
+# pragma omp parallel for schedule(dynamic, CS_CL_SIZE)  \
+                          if(n_cells > CS_THR_MIN)
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
     const cs_mesh_refine_type_t rf = c_r_flag[cell_id];
 
@@ -4325,7 +4327,12 @@ _subdivide_cells(const cs_mesh_t              *m,
   c_r_func[CS_REFINE_HEXA] = _subdivide_cell_hexa;
   c_r_func[CS_REFINE_POLYHEDRON] = _subdivide_cell_polyhedron;
 
-# pragma omp for schedule(dynamic, CS_CL_SIZE)
+  /* Each cell only updates its own sub-entity ranges and, for sub-faces
+     of shared faces, the i_face_cells column matching its orientation,
+     so cells may be subdivided independently. */
+
+# pragma omp parallel for schedule(dynamic, CS_CL_SIZE)  \
+                          if(n_c_ini > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < n_c_ini; c_id++) {
 
     subdivide_cell_t  *_c_r_func = c_r_func[c_r_flag[c_id]];
@@ -87,6 +87,11 @@ BEGIN_C_DECLS
  * Static global variables
  *============================================================================*/
 
+/* Optional re-bucketing of cell blocks along a space-filling curve */
+
+static bool              _cell_sfc_order = false;
+static fvm_io_num_sfc_t  _cell_sfc_type = FVM_IO_NUM_SFC_MORTON_BOX;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -95,6 +100,121 @@ BEGIN_C_DECLS
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Estimate cell centers as the mean of adjacent face centers, themselves
+ * estimated as the mean of face vertices.
+ *
+ * This is precise enough for space-filling curve bucketing, and avoids
+ * requiring mesh quantities, which may not be built when saving.
+ *
+ * parameters:
+ *   mesh     <-- pointer to mesh structure
+ *   cell_cen --> cell center estimate (size: mesh->n_cells * 3)
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_center_estimate(const cs_mesh_t  *mesh,
+                      cs_coord_t        cell_cen[])
+{
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_real_t *vtx_coord = mesh->vtx_coord;
+
+  int *n_cell_faces;
+  BFT_MALLOC(n_cell_faces, n_cells, int);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    n_cell_faces[c_id] = 0;
+    for (cs_lnum_t k = 0; k < 3; k++)
+      cell_cen[c_id*3 + k] = 0.;
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+
+    cs_coord_t f_cen[3] = {0., 0., 0.};
+    cs_lnum_t s_id = mesh->i_face_vtx_idx[f_id];
+    cs_lnum_t e_id = mesh->i_face_vtx_idx[f_id+1];
+
+    for (cs_lnum_t j = s_id; j < e_id; j++) {
+      const cs_real_t *v = vtx_coord + mesh->i_face_vtx_lst[j]*3;
+      for (cs_lnum_t k = 0; k < 3; k++)
+        f_cen[k] += v[k];
+    }
+    for (cs_lnum_t k = 0; k < 3; k++)
+      f_cen[k] /= (e_id - s_id);
+
+    for (cs_lnum_t i = 0; i < 2; i++) {
+      cs_lnum_t c_id = mesh->i_face_cells[f_id][i];
+      if (c_id > -1 && c_id < n_cells) {
+        for (cs_lnum_t k = 0; k < 3; k++)
+          cell_cen[c_id*3 + k] += f_cen[k];
+        n_cell_faces[c_id] += 1;
+      }
+    }
+
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_b_faces; f_id++) {
+
+    cs_coord_t f_cen[3] = {0., 0., 0.};
+    cs_lnum_t s_id = mesh->b_face_vtx_idx[f_id];
+    cs_lnum_t e_id = mesh->b_face_vtx_idx[f_id+1];
+
+    for (cs_lnum_t j = s_id; j < e_id; j++) {
+      const cs_real_t *v = vtx_coord + mesh->b_face_vtx_lst[j]*3;
+      for (cs_lnum_t k = 0; k < 3; k++)
+        f_cen[k] += v[k];
+    }
+    for (cs_lnum_t k = 0; k < 3; k++)
+      f_cen[k] /= (e_id - s_id);
+
+    cs_lnum_t c_id = mesh->b_face_cells[f_id];
+    for (cs_lnum_t k = 0; k < 3; k++)
+      cell_cen[c_id*3 + k] += f_cen[k];
+    n_cell_faces[c_id] += 1;
+
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (n_cell_faces[c_id] > 0) {
+      for (cs_lnum_t k = 0; k < 3; k++)
+        cell_cen[c_id*3 + k] /= n_cell_faces[c_id];
+    }
+  }
+
+  BFT_FREE(n_cell_faces);
+}
+
+/*----------------------------------------------------------------------------
+ * Build a global cell numbering ordered along a space-filling curve.
+ *
+ * parameters:
+ *   mesh <-- pointer to mesh structure
+ *
+ * returns:
+ *   global cell numbers in SFC order (size: mesh->n_cells)
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t *
+_cell_sfc_num(const cs_mesh_t  *mesh)
+{
+  cs_coord_t *cell_cen;
+  BFT_MALLOC(cell_cen, mesh->n_cells*3, cs_coord_t);
+
+  _cell_center_estimate(mesh, cell_cen);
+
+  fvm_io_num_t *io_num = fvm_io_num_create_from_sfc(cell_cen,
+                                                    3,
+                                                    mesh->n_cells,
+                                                    _cell_sfc_type);
+
+  BFT_FREE(cell_cen);
+
+  cs_gnum_t *cell_num = fvm_io_num_transfer_global_num(io_num);
+  io_num = fvm_io_num_destroy(io_num);
+
+  return cell_num;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -213,6 +333,23 @@ cs_mesh_save(cs_mesh_t          *mesh,
 
   BFT_FREE(_name);
 
+  /* If requested, re-bucket cells along a space-filling curve by
+     substituting an SFC-ordered global numbering for the duration of
+     the save: cell blocks in the output file then follow that curve,
+     and a later read partitioned with the same curve assigns each rank
+     a partition closely matching the blocks it reads.
+     Faces and vertices keep their numbering; face -> cell connectivity
+     is written in terms of the substituted numbering, so the saved
+     mesh is simply a cell-permuted equivalent of the current one. */
+
+  cs_gnum_t  *prev_cell_num = mesh->global_cell_num;
+  bool cell_num_subst = false;
+
+  if (_cell_sfc_order && transfer == false) {
+    mesh->global_cell_num = _cell_sfc_num(mesh);
+    cell_num_subst = true;
+  }
+
   /* Write data */
   /*------------*/
 
@@ -220,6 +357,11 @@ cs_mesh_save(cs_mesh_t          *mesh,
 
   cs_mesh_to_builder(mesh, _mb, transfer, pp_out);
 
+  if (cell_num_subst) {
+    BFT_FREE(mesh->global_cell_num);
+    mesh->global_cell_num = prev_cell_num;
+  }
+
   if (mb == NULL)
     cs_mesh_builder_destroy(&_mb);
 
@@ -228,6 +370,33 @@ cs_mesh_save(cs_mesh_t          *mesh,
   cs_io_finalize(&pp_out);
 }
 
+/*----------------------------------------------------------------------------
+ * Set re-bucketing of cell blocks along a space-filling curve when saving
+ * a mesh.
+ *
+ * When enabled, cells are renumbered globally by increasing space-filling
+ * curve index before being distributed to blocks, so cell-based data in
+ * the output file is bucketed along that curve independently of the
+ * number of blocks. When the saved mesh is later read and partitioned
+ * using the same space-filling curve type, each rank's partition closely
+ * matches the blocks it reads, minimizing redistribution.
+ *
+ * This option only applies when no mesh builder structure is transferred
+ * (i.e. for standalone saves).
+ *
+ * parameters:
+ *   enable   <-- enable or disable cell re-bucketing
+ *   sfc_type <-- type of space-filling curve to use when enabled
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_save_set_cell_sfc_order(bool              enable,
+                                fvm_io_num_sfc_t  sfc_type)
+{
+  _cell_sfc_order = enable;
+  _cell_sfc_type = sfc_type;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
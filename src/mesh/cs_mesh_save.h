@@ -35,6 +35,8 @@
  *  Local headers
  *----------------------------------------------------------------------------*/
 
+#include "fvm_io_num.h"
+
 #include "cs_base.h"
 #include "cs_mesh.h"
 
@@ -63,6 +65,29 @@ cs_mesh_save(cs_mesh_t          *mesh,
              const char         *path,
              const char         *filename);
 
+/*----------------------------------------------------------------------------
+ * Set re-bucketing of cell blocks along a space-filling curve when saving
+ * a mesh.
+ *
+ * When enabled, cells are renumbered globally by increasing space-filling
+ * curve index before being distributed to blocks, so cell-based data in
+ * the output file is bucketed along that curve independently of the
+ * number of blocks. When the saved mesh is later read and partitioned
+ * using the same space-filling curve type, each rank's partition closely
+ * matches the blocks it reads, minimizing redistribution.
+ *
+ * This option only applies when no mesh builder structure is transferred
+ * (i.e. for standalone saves).
+ *
+ * parameters:
+ *   enable   <-- enable or disable cell re-bucketing
+ *   sfc_type <-- type of space-filling curve to use when enabled
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_save_set_cell_sfc_order(bool              enable,
+                                fvm_io_num_sfc_t  sfc_type);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
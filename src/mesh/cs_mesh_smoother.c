@@ -348,15 +348,84 @@ _move_vertices(cs_mesh_t  *mesh,
                cs_real_t  *vtx_mvt,
                const int   vtx_is_fixed[])
 {
-  int i, k;
-  for (i = 0; i < mesh->n_vertices; i++) {
+  const cs_lnum_t n_vertices = mesh->n_vertices;
+
+# pragma omp parallel for if(n_vertices > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
     if (vtx_is_fixed[i] == 0) {
-      for (k = 0; k < 3; k++)
+      for (cs_lnum_t k = 0; k < 3; k++)
         mesh->vtx_coord[3*i + k] += vtx_mvt[3*i + k];
     }
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Build a "vertex -> face" connectivity index.
+ *
+ * The optional face selection flag array allows ignoring some faces
+ * (such as interior faces whose contribution is handled by another rank).
+ *
+ * parameters:
+ *   n_faces      <-- number of faces
+ *   n_vertices   <-- number of vertices
+ *   face_vtx_idx <-- "face -> vertex" connectivity index
+ *   face_vtx_lst <-- "face -> vertex" connectivity list
+ *   face_select  <-- optional face selection flag (1: used), or NULL
+ *   v2f_idx      --> "vertex -> face" connectivity index
+ *   v2f_lst      --> "vertex -> face" connectivity list
+ *---------------------------------------------------------------------------*/
+
+static void
+_build_vtx_face_index(cs_lnum_t          n_faces,
+                      cs_lnum_t          n_vertices,
+                      const cs_lnum_t    face_vtx_idx[],
+                      const cs_lnum_t    face_vtx_lst[],
+                      const char         face_select[],
+                      cs_lnum_t        **v2f_idx,
+                      cs_lnum_t        **v2f_lst)
+{
+  cs_lnum_t  i, face_id;
+
+  cs_lnum_t  *_v2f_idx = NULL, *_v2f_lst = NULL;
+  cs_lnum_t  *count = NULL;
+
+  BFT_MALLOC(_v2f_idx, n_vertices + 1, cs_lnum_t);
+
+  for (i = 0; i < n_vertices + 1; i++)
+    _v2f_idx[i] = 0;
+
+  for (face_id = 0; face_id < n_faces; face_id++) {
+    if (face_select != NULL && face_select[face_id] == 0)
+      continue;
+    for (i = face_vtx_idx[face_id]; i < face_vtx_idx[face_id+1]; i++)
+      _v2f_idx[face_vtx_lst[i] + 1] += 1;
+  }
+
+  for (i = 0; i < n_vertices; i++)
+    _v2f_idx[i+1] += _v2f_idx[i];
+
+  BFT_MALLOC(_v2f_lst, _v2f_idx[n_vertices], cs_lnum_t);
+  BFT_MALLOC(count, n_vertices, cs_lnum_t);
+
+  for (i = 0; i < n_vertices; i++)
+    count[i] = 0;
+
+  for (face_id = 0; face_id < n_faces; face_id++) {
+    if (face_select != NULL && face_select[face_id] == 0)
+      continue;
+    for (i = face_vtx_idx[face_id]; i < face_vtx_idx[face_id+1]; i++) {
+      cs_lnum_t vtx_id = face_vtx_lst[i];
+      _v2f_lst[_v2f_idx[vtx_id] + count[vtx_id]] = face_id;
+      count[vtx_id] += 1;
+    }
+  }
+
+  BFT_FREE(count);
+
+  *v2f_idx = _v2f_idx;
+  *v2f_lst = _v2f_lst;
+}
+
 /*----------------------------------------------------------------------------
  * Compute tolerance
  * tolerance = shortest edge length * fraction
@@ -584,8 +653,17 @@ _get_tolerance(cs_mesh_t   *mesh,
 /*----------------------------------------------------------------------------
  * Unwarping algorithm, called by _unwarping
  *
+ * The vertex displacement is computed as a gather over the faces adjacent
+ * to each vertex, using "vertex -> face" connectivities built once per
+ * smoothing (the mesh connectivity does not change between sweeps), so
+ * the main loop may be threaded without write conflicts.
+ *
  * parameters:
  *   mesh                <--  pointer to a cs_mesh_t structure
+ *   v2b_idx             <--  "vertex -> border face" connectivity index
+ *   v2b_lst             <--  "vertex -> border face" connectivity list
+ *   v2i_idx             <--  "vertex -> interior face" connectivity index
+ *   v2i_lst             <--  "vertex -> interior face" connectivity list
  *   i_face_norm         <--  surface normal of interior faces
  *   b_face_norm         <--  surface normal of border faces
  *   i_face_cog          <--  center of gravity of interior faces
@@ -602,6 +680,10 @@ _get_tolerance(cs_mesh_t   *mesh,
 
 static cs_real_t
 _unwarping_mvt(cs_mesh_t            *mesh,
+               const cs_lnum_t       v2b_idx[],
+               const cs_lnum_t       v2b_lst[],
+               const cs_lnum_t       v2i_idx[],
+               const cs_lnum_t       v2i_lst[],
                cs_real_t            *i_face_norm,
                cs_real_t            *b_face_norm,
                cs_real_t            *i_face_cog,
@@ -613,12 +695,11 @@ _unwarping_mvt(cs_mesh_t            *mesh,
                double                frac)
 {
   cs_lnum_t face_id, i;
-  int coord_id;
-  cs_lnum_t start_id, end_id, vtx;
-  cs_real_t lambda;
   cs_real_t max_vtxtol = 0.;
   cs_real_t maxwarp = 0.;
 
+  const cs_lnum_t n_vertices = mesh->n_vertices;
+
   for (face_id = 0; face_id < mesh->n_i_faces; face_id++)
     if (maxwarp < i_face_warp[face_id])
       maxwarp = i_face_warp[face_id];
@@ -626,9 +707,7 @@ _unwarping_mvt(cs_mesh_t            *mesh,
     if (maxwarp < b_face_warp[face_id])
       maxwarp = b_face_warp[face_id];
 
-  for (i = 0; i < mesh->n_vertices*3; i++)
-    loc_vtx_mvt[i] = 0.0;
-  for (i = 0; i < mesh->n_vertices; i++)
+  for (i = 0; i < n_vertices; i++)
     if (vtx_tolerance[i] > max_vtxtol)
       max_vtxtol = vtx_tolerance[i];
 
@@ -647,47 +726,45 @@ _unwarping_mvt(cs_mesh_t            *mesh,
   }
 #endif
 
-  for (face_id = 0; face_id < mesh->n_b_faces; face_id++) {
-    start_id = mesh->b_face_vtx_idx[face_id];
-    end_id = mesh->b_face_vtx_idx[face_id + 1];
-    for (i = start_id; i < end_id; i++) {
-      vtx = mesh->b_face_vtx_lst[i];
+# pragma omp parallel for if(n_vertices > CS_THR_MIN)
+  for (cs_lnum_t vtx = 0; vtx < n_vertices; vtx++) {
+
+    int coord_id;
+    cs_lnum_t j;
+    cs_real_t lambda;
+    cs_real_t mvt[3] = {0., 0., 0.};
+
+    const cs_real_t *vtx_coord = mesh->vtx_coord + 3*vtx;
+    const cs_real_t t_mult = UNWARPING_MVT * vtx_tolerance[vtx]
+                                           / (max_vtxtol*frac);
+
+    for (j = v2b_idx[vtx]; j < v2b_idx[vtx+1]; j++) {
+      cs_lnum_t f_id = v2b_lst[j];
       lambda = 0.0;
       for (coord_id = 0; coord_id < 3; coord_id++)
-        lambda +=  (mesh->vtx_coord[3*vtx + coord_id]
-                    - b_face_cog[3*face_id + coord_id])
-                    * b_face_norm[3*face_id + coord_id];
+        lambda +=  (vtx_coord[coord_id] - b_face_cog[3*f_id + coord_id])
+                    * b_face_norm[3*f_id + coord_id];
 
-      for (coord_id = 0; coord_id < 3; coord_id++) {
-        loc_vtx_mvt[vtx*3 + coord_id] -=
-          lambda * b_face_norm[3*face_id + coord_id]
-                 * UNWARPING_MVT * (b_face_warp[face_id]/maxwarp)
-                 * (vtx_tolerance[vtx]/(max_vtxtol*frac));
-      }
+      for (coord_id = 0; coord_id < 3; coord_id++)
+        mvt[coord_id] -=   lambda * b_face_norm[3*f_id + coord_id]
+                         * (b_face_warp[f_id]/maxwarp) * t_mult;
     }
-  }
 
+    for (j = v2i_idx[vtx]; j < v2i_idx[vtx+1]; j++) {
+      cs_lnum_t f_id = v2i_lst[j];
+      lambda = 0.0;
+      for (coord_id = 0; coord_id < 3; coord_id++)
+        lambda += (vtx_coord[coord_id] - i_face_cog[3*f_id + coord_id])
+                   * i_face_norm[3*f_id + coord_id];
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
-    if (mesh->i_face_cells[face_id][0] < mesh->n_cells) {
-      start_id = mesh->i_face_vtx_idx[face_id];
-      end_id = mesh->i_face_vtx_idx[face_id + 1];
-      for (i = start_id; i < end_id; i++) {
-        vtx = mesh->i_face_vtx_lst[i];
-        lambda = 0.0;
-        for (coord_id = 0; coord_id < 3; coord_id++)
-          lambda += (mesh->vtx_coord[3*vtx + coord_id]
-                     - i_face_cog[3*face_id + coord_id])
-                     * i_face_norm[3*face_id + coord_id];
-
-        for (coord_id = 0; coord_id < 3; coord_id++) {
-          loc_vtx_mvt[vtx*3 + coord_id] -=
-            lambda * i_face_norm[3*face_id + coord_id]
-                   * UNWARPING_MVT * (i_face_warp[face_id]/maxwarp)
-                   * (vtx_tolerance[vtx]/(max_vtxtol*frac));
-        }
-      }
+      for (coord_id = 0; coord_id < 3; coord_id++)
+        mvt[coord_id] -=   lambda * i_face_norm[3*f_id + coord_id]
+                         * (i_face_warp[f_id]/maxwarp) * t_mult;
     }
+
+    for (coord_id = 0; coord_id < 3; coord_id++)
+      loc_vtx_mvt[3*vtx + coord_id] = mvt[coord_id];
+
   }
 
   if (mesh->vtx_interfaces != NULL) { /* Parallel or periodic treatment */
@@ -699,10 +776,12 @@ _unwarping_mvt(cs_mesh_t            *mesh,
                          loc_vtx_mvt);
   }
 
-  for (i = 0; i < mesh->n_vertices; i++)
-    for (coord_id = 0; coord_id < 3; coord_id++)
-      loc_vtx_mvt[3*i + coord_id] = CS_MIN(loc_vtx_mvt[3*i + coord_id],
-                                           vtx_tolerance[i]);
+# pragma omp parallel for if(n_vertices > CS_THR_MIN)
+  for (cs_lnum_t vtx = 0; vtx < n_vertices; vtx++) {
+    for (int coord_id = 0; coord_id < 3; coord_id++)
+      loc_vtx_mvt[3*vtx + coord_id] = CS_MIN(loc_vtx_mvt[3*vtx + coord_id],
+                                             vtx_tolerance[vtx]);
+  }
 
   return maxwarp;
 }
@@ -723,7 +802,6 @@ _compute_vtx_normals(cs_mesh_t           *mesh,
 {
   int coord_id;
   cs_lnum_t i, j;
-  cs_real_t norm;
 
   for (i = 0; i < mesh->n_vertices*3; i++)
     b_vtx_norm[i] = 0.;
@@ -750,15 +828,16 @@ _compute_vtx_normals(cs_mesh_t           *mesh,
                          b_vtx_norm);
 
   /* normalizing */
-  for (i = 0; i < mesh->n_vertices; i++) {
-    norm = sqrt(  b_vtx_norm[i*3    ]*b_vtx_norm[i*3    ]
-                + b_vtx_norm[i*3 + 1]*b_vtx_norm[i*3 + 1]
-                + b_vtx_norm[i*3 + 2]*b_vtx_norm[i*3 + 2]);
+# pragma omp parallel for if(mesh->n_vertices > CS_THR_MIN)
+  for (cs_lnum_t vtx = 0; vtx < mesh->n_vertices; vtx++) {
+    cs_real_t norm = sqrt(  b_vtx_norm[vtx*3    ]*b_vtx_norm[vtx*3    ]
+                          + b_vtx_norm[vtx*3 + 1]*b_vtx_norm[vtx*3 + 1]
+                          + b_vtx_norm[vtx*3 + 2]*b_vtx_norm[vtx*3 + 2]);
 
     if (norm > DBL_MIN) {
-      b_vtx_norm[i*3    ] /= norm;
-      b_vtx_norm[i*3 + 1] /= norm;
-      b_vtx_norm[i*3 + 2] /= norm;
+      b_vtx_norm[vtx*3    ] /= norm;
+      b_vtx_norm[vtx*3 + 1] /= norm;
+      b_vtx_norm[vtx*3 + 2] /= norm;
     }
   }
 }
@@ -886,9 +965,7 @@ void
 cs_mesh_smoother_unwarp(cs_mesh_t  *mesh,
                         const int   vtx_is_fixed[])
 {
-  int face;
   cs_real_t maxwarp, minhist_i, minhist_b, maxhist_i, maxhist_b;
-  cs_real_t rnorm_b, rnorm_i;
   bool conv = false;
   int iter = 0;
   int max_iter = UNWARPING_MAX_LOOPS;
@@ -916,6 +993,39 @@ cs_mesh_smoother_unwarp(cs_mesh_t  *mesh,
   BFT_MALLOC(vtx_tolerance, mesh->n_vertices, cs_real_t);
   BFT_MALLOC(loc_vtx_mvt, 3*(mesh->n_vertices), cs_real_t);
 
+  /* Build "vertex -> face" connectivities, used to apply the unwarping
+     displacement as a gather over vertices; the mesh connectivity does
+     not change between sweeps, so this is done only once */
+
+  cs_lnum_t *v2b_idx = NULL, *v2b_lst = NULL;
+  cs_lnum_t *v2i_idx = NULL, *v2i_lst = NULL;
+
+  {
+    char *i_face_select = NULL;
+    BFT_MALLOC(i_face_select, mesh->n_i_faces, char);
+    for (cs_lnum_t f_id = 0; f_id < mesh->n_i_faces; f_id++)
+      i_face_select[f_id] = (mesh->i_face_cells[f_id][0] < mesh->n_cells)
+                            ? 1 : 0;
+
+    _build_vtx_face_index(mesh->n_b_faces,
+                          mesh->n_vertices,
+                          mesh->b_face_vtx_idx,
+                          mesh->b_face_vtx_lst,
+                          NULL,
+                          &v2b_idx,
+                          &v2b_lst);
+
+    _build_vtx_face_index(mesh->n_i_faces,
+                          mesh->n_vertices,
+                          mesh->i_face_vtx_idx,
+                          mesh->i_face_vtx_lst,
+                          i_face_select,
+                          &v2i_idx,
+                          &v2i_lst);
+
+    BFT_FREE(i_face_select);
+  }
+
   while (!conv) {
 
     cs_mesh_quantities_i_faces(mesh,
@@ -936,27 +1046,35 @@ cs_mesh_smoother_unwarp(cs_mesh_t  *mesh,
                    vtx_tolerance,
                    frac);
 
-    for (face = 0; face < mesh->n_i_faces; face++) {
-      rnorm_i = sqrt (  i_face_norm[3*face]*i_face_norm[3*face]
-                      + i_face_norm[3*face + 1]*i_face_norm[3*face + 1]
-                      + i_face_norm[3*face + 2]*i_face_norm[3*face + 2]);
+#   pragma omp parallel for if(mesh->n_i_faces > CS_THR_MIN)
+    for (cs_lnum_t f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+      cs_real_t rnorm_i
+        = sqrt (  i_face_norm[3*f_id]*i_face_norm[3*f_id]
+                + i_face_norm[3*f_id + 1]*i_face_norm[3*f_id + 1]
+                + i_face_norm[3*f_id + 2]*i_face_norm[3*f_id + 2]);
 
-      i_face_norm[3*face   ] /= rnorm_i;
-      i_face_norm[3*face +1] /= rnorm_i;
-      i_face_norm[3*face +2] /= rnorm_i;
+      i_face_norm[3*f_id   ] /= rnorm_i;
+      i_face_norm[3*f_id +1] /= rnorm_i;
+      i_face_norm[3*f_id +2] /= rnorm_i;
     }
 
-    for (face = 0; face < mesh->n_b_faces; face++) {
-      rnorm_b = sqrt(  b_face_norm[3*face]*b_face_norm[3*face]
-                     + b_face_norm[3*face + 1]*b_face_norm[3*face + 1]
-                     + b_face_norm[3*face + 2]*b_face_norm[3*face + 2]);
+#   pragma omp parallel for if(mesh->n_b_faces > CS_THR_MIN)
+    for (cs_lnum_t f_id = 0; f_id < mesh->n_b_faces; f_id++) {
+      cs_real_t rnorm_b
+        = sqrt(  b_face_norm[3*f_id]*b_face_norm[3*f_id]
+               + b_face_norm[3*f_id + 1]*b_face_norm[3*f_id + 1]
+               + b_face_norm[3*f_id + 2]*b_face_norm[3*f_id + 2]);
 
-      b_face_norm[3*face   ] /= rnorm_b;
-      b_face_norm[3*face +1] /= rnorm_b;
-      b_face_norm[3*face +2] /= rnorm_b;
+      b_face_norm[3*f_id   ] /= rnorm_b;
+      b_face_norm[3*f_id +1] /= rnorm_b;
+      b_face_norm[3*f_id +2] /= rnorm_b;
     }
 
     maxwarp = _unwarping_mvt(mesh,
+                             v2b_idx,
+                             v2b_lst,
+                             v2i_idx,
+                             v2i_lst,
                              i_face_norm,
                              b_face_norm,
                              i_face_cog,
@@ -1061,6 +1179,11 @@ cs_mesh_smoother_unwarp(cs_mesh_t  *mesh,
                         max_i);
   }
 
+  BFT_FREE(v2b_idx);
+  BFT_FREE(v2b_lst);
+  BFT_FREE(v2i_idx);
+  BFT_FREE(v2i_lst);
+
   BFT_FREE(vtx_tolerance);
   BFT_FREE(loc_vtx_mvt);
 
@@ -98,6 +98,7 @@ extern "C" {
 #include "cs_mesh.h"
 #include "cs_mesh_builder.h"
 #include "cs_order.h"
+#include "cs_parall.h"
 #include "cs_part_to_block.h"
 #include "cs_timer.h"
 
@@ -1285,36 +1286,54 @@ _metis_cell_cells(size_t       n_cells,
                   idx_t      **cell_idx,
                   idx_t      **cell_neighbors)
 {
-  size_t i, id_0, id_1;
-
-  cs_gnum_t  c_num[2];
+  size_t i;
 
   idx_t  *n_neighbors;
   idx_t  *_cell_idx;
   idx_t  *_cell_neighbors;
 
-  /* Count and allocate arrays */
+#if defined(DEBUG) && !defined(NDEBUG)
+  for (i = 0; i < n_faces; i++) {
+    cs_gnum_t c_num_0 = face_cells[i*2];
+    cs_gnum_t c_num_1 = face_cells[i*2 + 1];
+    if (c_num_0 == 0 || c_num_1 == 0 || c_num_0 == c_num_1)
+      continue;
+    assert(   c_num_0 - start_cell < n_cells
+           || c_num_1 - start_cell < n_cells);
+  }
+#endif
+
+  /* Count and allocate arrays; cells are partitioned over threads, each
+     thread sweeping all faces but handling only its own cells, so edges
+     are built without synchronization and in the same (face) order as
+     with a serial sweep */
 
   BFT_MALLOC(n_neighbors, n_cells, idx_t);
 
-  for (i = 0; i < n_cells; i++)
-    n_neighbors[i] = 0;
+# pragma omp parallel if (n_faces > CS_THR_MIN)
+  {
+    cs_lnum_t t_s_id, t_e_id;
+    cs_parall_thread_range(n_cells, sizeof(idx_t), &t_s_id, &t_e_id);
 
-  for (i = 0; i < n_faces; i++) {
+    const cs_gnum_t c_min = start_cell + t_s_id;
+    const cs_gnum_t c_max = start_cell + t_e_id;
 
-    c_num[0] = face_cells[i*2];
-    c_num[1] = face_cells[i*2 + 1];
+    for (cs_lnum_t j = t_s_id; j < t_e_id; j++)
+      n_neighbors[j] = 0;
 
-    if (c_num[0] == 0 || c_num[1] == 0 || c_num[0] == c_num[1])
-      continue;
+    for (size_t f_id = 0; f_id < n_faces; f_id++) {
+
+      cs_gnum_t c_num_0 = face_cells[f_id*2];
+      cs_gnum_t c_num_1 = face_cells[f_id*2 + 1];
 
-    assert(   c_num[0] - start_cell < n_cells
-           || c_num[1] - start_cell < n_cells);
+      if (c_num_0 == 0 || c_num_1 == 0 || c_num_0 == c_num_1)
+        continue;
 
-    if (c_num[0] >= start_cell && c_num[0] - start_cell < n_cells)
-      n_neighbors[c_num[0] - start_cell] += 1;
-    if (c_num[1] >= start_cell && c_num[1] - start_cell < n_cells)
-      n_neighbors[c_num[1] - start_cell] += 1;
+      if (c_num_0 >= c_min && c_num_0 < c_max)
+        n_neighbors[c_num_0 - start_cell] += 1;
+      if (c_num_1 >= c_min && c_num_1 < c_max)
+        n_neighbors[c_num_1 - start_cell] += 1;
+    }
   }
 
   BFT_MALLOC(_cell_idx, n_cells + 1, idx_t);
@@ -1326,27 +1345,36 @@ _metis_cell_cells(size_t       n_cells,
 
   BFT_MALLOC(_cell_neighbors, _cell_idx[n_cells], idx_t);
 
-  for (i = 0; i < n_cells; i++)
-    n_neighbors[i] = 0;
+# pragma omp parallel if (n_faces > CS_THR_MIN)
+  {
+    cs_lnum_t t_s_id, t_e_id;
+    cs_parall_thread_range(n_cells, sizeof(idx_t), &t_s_id, &t_e_id);
 
-  for (i = 0; i < n_faces; i++) {
+    const cs_gnum_t c_min = start_cell + t_s_id;
+    const cs_gnum_t c_max = start_cell + t_e_id;
 
-    c_num[0] = face_cells[i*2];
-    c_num[1] = face_cells[i*2 + 1];
+    for (cs_lnum_t j = t_s_id; j < t_e_id; j++)
+      n_neighbors[j] = 0;
 
-    if (c_num[0] == 0 || c_num[1] == 0 || c_num[0] == c_num[1])
-      continue;
+    for (size_t f_id = 0; f_id < n_faces; f_id++) {
 
-    if (c_num[0] >= start_cell && c_num[0] - start_cell < n_cells) {
-      id_0 = c_num[0] - start_cell;
-      _cell_neighbors[_cell_idx[id_0] + n_neighbors[id_0]] = c_num[1] - 1;
-      n_neighbors[id_0] += 1;
-    }
+      cs_gnum_t c_num_0 = face_cells[f_id*2];
+      cs_gnum_t c_num_1 = face_cells[f_id*2 + 1];
+
+      if (c_num_0 == 0 || c_num_1 == 0 || c_num_0 == c_num_1)
+        continue;
+
+      if (c_num_0 >= c_min && c_num_0 < c_max) {
+        size_t id_0 = c_num_0 - start_cell;
+        _cell_neighbors[_cell_idx[id_0] + n_neighbors[id_0]] = c_num_1 - 1;
+        n_neighbors[id_0] += 1;
+      }
 
-    if (c_num[1] >= start_cell && c_num[1] - start_cell < n_cells) {
-      id_1 = c_num[1] - start_cell;
-      _cell_neighbors[_cell_idx[id_1] + n_neighbors[id_1]] = c_num[0] - 1;
-      n_neighbors[id_1] += 1;
+      if (c_num_1 >= c_min && c_num_1 < c_max) {
+        size_t id_1 = c_num_1 - start_cell;
+        _cell_neighbors[_cell_idx[id_1] + n_neighbors[id_1]] = c_num_0 - 1;
+        n_neighbors[id_1] += 1;
+      }
     }
   }
 
@@ -1747,35 +1775,54 @@ _scotch_cell_cells(size_t        n_cells,
                    SCOTCH_Num  **cell_neighbors)
 {
   size_t i;
-  cs_gnum_t  id_0, id_1, c_num[2];
-  SCOTCH_Num  start_id, end_id, c_id;
+  SCOTCH_Num  c_id;
 
   SCOTCH_Num  *n_neighbors;
   SCOTCH_Num  *_cell_idx;
   SCOTCH_Num  *_cell_neighbors;
 
-  /* Count and allocate arrays */
+#if defined(DEBUG) && !defined(NDEBUG)
+  for (i = 0; i < n_faces; i++) {
+    cs_gnum_t c_num_0 = face_cells[i*2];
+    cs_gnum_t c_num_1 = face_cells[i*2 + 1];
+    if (c_num_0 == 0 || c_num_1 == 0 || c_num_0 == c_num_1)
+      continue;
+    assert(   c_num_0 - start_cell < n_cells
+           || c_num_1 - start_cell < n_cells);
+  }
+#endif
+
+  /* Count and allocate arrays; cells are partitioned over threads, each
+     thread sweeping all faces but handling only its own cells, so edges
+     are built without synchronization and in the same (face) order as
+     with a serial sweep */
 
   BFT_MALLOC(n_neighbors, n_cells, SCOTCH_Num);
 
-  for (i = 0; i < n_cells; i++)
-    n_neighbors[i] = 0;
+# pragma omp parallel if (n_faces > CS_THR_MIN)
+  {
+    cs_lnum_t t_s_id, t_e_id;
+    cs_parall_thread_range(n_cells, sizeof(SCOTCH_Num), &t_s_id, &t_e_id);
 
-  for (i = 0; i < n_faces; i++) {
+    const cs_gnum_t c_min = start_cell + t_s_id;
+    const cs_gnum_t c_max = start_cell + t_e_id;
 
-    c_num[0] = face_cells[i*2];
-    c_num[1] = face_cells[i*2 + 1];
+    for (cs_lnum_t j = t_s_id; j < t_e_id; j++)
+      n_neighbors[j] = 0;
 
-    if (c_num[0] == 0 || c_num[1] == 0 || c_num[0] == c_num[1])
-      continue;
+    for (size_t f_id = 0; f_id < n_faces; f_id++) {
+
+      cs_gnum_t c_num_0 = face_cells[f_id*2];
+      cs_gnum_t c_num_1 = face_cells[f_id*2 + 1];
 
-    assert(   c_num[0] - start_cell < n_cells
-           || c_num[1] - start_cell < n_cells);
+      if (c_num_0 == 0 || c_num_1 == 0 || c_num_0 == c_num_1)
+        continue;
 
-    if (c_num[0] >= start_cell && c_num[0] - start_cell < n_cells)
-      n_neighbors[c_num[0] - start_cell] += 1;
-    if (c_num[1] >= start_cell && c_num[1] - start_cell < n_cells)
-      n_neighbors[c_num[1] - start_cell] += 1;
+      if (c_num_0 >= c_min && c_num_0 < c_max)
+        n_neighbors[c_num_0 - start_cell] += 1;
+      if (c_num_1 >= c_min && c_num_1 < c_max)
+        n_neighbors[c_num_1 - start_cell] += 1;
+    }
   }
 
   BFT_MALLOC(_cell_idx, n_cells + 1, SCOTCH_Num);
@@ -1787,70 +1834,99 @@ _scotch_cell_cells(size_t        n_cells,
 
   BFT_MALLOC(_cell_neighbors, _cell_idx[n_cells], SCOTCH_Num);
 
-  for (i = 0; i < n_cells; i++)
-    n_neighbors[i] = 0;
+# pragma omp parallel if (n_faces > CS_THR_MIN)
+  {
+    cs_lnum_t t_s_id, t_e_id;
+    cs_parall_thread_range(n_cells, sizeof(SCOTCH_Num), &t_s_id, &t_e_id);
 
-  for (i = 0; i < n_faces; i++) {
+    const cs_gnum_t c_min = start_cell + t_s_id;
+    const cs_gnum_t c_max = start_cell + t_e_id;
 
-    c_num[0] = face_cells[i*2];
-    c_num[1] = face_cells[i*2 + 1];
+    for (cs_lnum_t j = t_s_id; j < t_e_id; j++)
+      n_neighbors[j] = 0;
 
-    if (c_num[0] == 0 || c_num[1] == 0 || c_num[0] == c_num[1])
-      continue;
+    for (size_t f_id = 0; f_id < n_faces; f_id++) {
 
-    if (c_num[0] >= start_cell && c_num[0] - start_cell < n_cells) {
-      id_0 = c_num[0] - start_cell;
-      _cell_neighbors[_cell_idx[id_0] + n_neighbors[id_0]] = c_num[1] - 1;
-      n_neighbors[id_0] += 1;
-    }
+      cs_gnum_t c_num_0 = face_cells[f_id*2];
+      cs_gnum_t c_num_1 = face_cells[f_id*2 + 1];
 
-    if (c_num[1] >= start_cell && c_num[1] - start_cell < n_cells) {
-      id_1 = c_num[1] - start_cell;
-      _cell_neighbors[_cell_idx[id_1] + n_neighbors[id_1]] = c_num[0] - 1;
-      n_neighbors[id_1] += 1;
-    }
-  }
+      if (c_num_0 == 0 || c_num_1 == 0 || c_num_0 == c_num_1)
+        continue;
 
-  BFT_FREE(n_neighbors);
+      if (c_num_0 >= c_min && c_num_0 < c_max) {
+        size_t id_0 = c_num_0 - start_cell;
+        _cell_neighbors[_cell_idx[id_0] + n_neighbors[id_0]] = c_num_1 - 1;
+        n_neighbors[id_0] += 1;
+      }
 
-  /* Clean graph */
+      if (c_num_1 >= c_min && c_num_1 < c_max) {
+        size_t id_1 = c_num_1 - start_cell;
+        _cell_neighbors[_cell_idx[id_1] + n_neighbors[id_1]] = c_num_0 - 1;
+        n_neighbors[id_1] += 1;
+      }
+    }
+  }
 
-  c_id = 0;
-  start_id = _cell_idx[0]; /* also = 0 */
-  end_id = 0;
+  /* Clean graph: sort and remove duplicates from each cell's adjacency
+     in parallel, reusing the neighbor counts, then compact the
+     adjacency serially */
 
   if (_cell_neighbors != NULL) {
 
-    for (i = 0; i < n_cells; i++) {
+#   pragma omp parallel for  if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t j = 0; j < (cs_lnum_t)n_cells; j++) {
 
-      SCOTCH_Num j, n_prev;
+      SCOTCH_Num k, n_prev;
+      SCOTCH_Num s_id = _cell_idx[j];
+      SCOTCH_Num e_id = _cell_idx[j+1];
+      SCOTCH_Num l_id = s_id;
 
-      end_id = _cell_idx[i+1];
+      if (e_id > s_id) {
 
-      _scotch_sort_shell(start_id, end_id, _cell_neighbors);
+        _scotch_sort_shell(s_id, e_id, _cell_neighbors);
 
-      n_prev = _cell_neighbors[start_id];
-      _cell_neighbors[c_id] = n_prev;
-      c_id += 1;
+        n_prev = _cell_neighbors[s_id];
+        l_id += 1;
 
-      for (j = start_id + 1; j < end_id; j++) {
-        if (_cell_neighbors[j] != n_prev) {
-          n_prev = _cell_neighbors[j];
-          _cell_neighbors[c_id] = n_prev;
-          c_id += 1;
+        for (k = s_id + 1; k < e_id; k++) {
+          if (_cell_neighbors[k] != n_prev) {
+            n_prev = _cell_neighbors[k];
+            _cell_neighbors[l_id] = n_prev;
+            l_id += 1;
+          }
         }
+
       }
 
-      start_id = end_id;
-      _cell_idx[i+1] = c_id;
+      n_neighbors[j] = l_id - s_id;
+    }
+
+    SCOTCH_Num tot_size = _cell_idx[n_cells];
+
+    c_id = 0;
+
+    for (i = 0; i < n_cells; i++) {
+
+      SCOTCH_Num s_id = _cell_idx[i];
+      SCOTCH_Num n_cur = n_neighbors[i];
+
+      for (SCOTCH_Num k = 0; k < n_cur; k++)
+        _cell_neighbors[c_id + k] = _cell_neighbors[s_id + k];
+
+      _cell_idx[i] = c_id;
+      c_id += n_cur;
 
     }
 
-    if (c_id < end_id)
+    _cell_idx[n_cells] = c_id;
+
+    if (c_id < tot_size)
       BFT_REALLOC(_cell_neighbors, c_id, SCOTCH_Num);
 
   }
 
+  BFT_FREE(n_neighbors);
+
   /* Set return values */
 
   *cell_idx = _cell_idx;
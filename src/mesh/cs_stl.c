@@ -1821,17 +1821,16 @@ cs_stl_intersection(cs_stl_mesh_t *stl_mesh,
 
   /* Compute extents */
 
-  // For the main mesh
-  cs_real_6_t *bbox = NULL;
-  bbox = cs_mesh_quantities_cell_extents(m, 0.0);
+  // For the main mesh (shared cell extents, owned by mesh quantities)
+  const cs_real_6_t *cell_bbox
+    = cs_mesh_quantities_cell_extents_shared(m, cs_glob_mesh_quantities);
 
   for (cs_lnum_t i = 0; i < n_cells; i++)
     for (int id = 0; id < 6; id ++)
-      extents[6*i + id] = bbox[input_idx[i]][id];
-
-  BFT_FREE(bbox);
+      extents[6*i + id] = cell_bbox[input_idx[i]][id];
 
   // For the STL mesh
+  cs_real_6_t *bbox = NULL;
   BFT_MALLOC(bbox, n_tria_stl, cs_real_6_t);
 
   for (cs_lnum_t i = 0; i < n_tria_stl; i++) {
@@ -2198,9 +2197,9 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
                       &tria_in_cell_lst,
                       &max_size);
 
-  /* Compute the bounding boxes of the main mesh */
-  cs_real_6_t *bbox = NULL;
-  bbox = cs_mesh_quantities_cell_extents(m, 0.0);
+  /* Bounding boxes of the main mesh (shared, owned by mesh quantities) */
+  const cs_real_6_t *bbox
+    = cs_mesh_quantities_cell_extents_shared(m, mq);
 
   /* If a cell is overlaped by more than 1 triangle,
    * replace those triangles by a mean plane
@@ -2231,7 +2230,7 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
 
         cs_real_3_t *coords  = stl_mesh->coords + (3*f_tria_id);
         cs_real_t *n         = stl_normals + (3*f_tria_id);
-        cs_real_t *aabb      = &bbox[cell_id][0];
+        const cs_real_t *aabb = &bbox[cell_id][0];
         const cs_real_t *cog = xyzcen[cell_id];
 
         /* Compute the surface of the triangle in the box */
@@ -2503,7 +2502,6 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
   BFT_FREE(cell_selected_idx);
   BFT_FREE(mean_plane_def);
   BFT_FREE(stl_normals);
-  BFT_FREE(bbox);
   BFT_FREE(input_cells);
   BFT_FREE(selected_cells);
   BFT_FREE(tria_in_cell_lst);
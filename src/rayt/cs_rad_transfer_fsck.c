@@ -49,6 +49,7 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_base.h"
 #include "cs_log.h"
 #include "cs_mesh.h"
 #include "cs_mesh_quantities.h"
@@ -628,15 +629,36 @@ _simple_interpg (int        nxy,
     yi[ni] = yy[nxy];
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the required size of the \ref _interpolation4d work array.
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static cs_lnum_t
+_interpolation4d_wrk_size(void)
+{
+  return ng*(4*4*4*4 + 4*4*4 + 4*4 + 4);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief interpolation4d
  *
+ * The work array is used so that no allocation is required per call,
+ * as this function is called for each cell and boundary face;
+ * its required size is given by \ref _interpolation4d_wrk_size.
+ *
+ * All intermediate arrays place the quadrature point index last
+ * (i.e. contiguous), so the interpolation loops below are unit-stride
+ * and may be vectorized.
+ *
  * \param[in]     trad          Reference temperature
  * \param[in]     t             Local temperature
  * \param[in]     xco2          Reference CO2 volume fraction
  * \param[in]     xh2o          Reference H2O volume fraction
  * \param[in]     interp_method Interpolation method
+ * \param[in]     wrk           work array
  * \param[out]    gdb
  * \param[out]    kdb
  */
@@ -648,24 +670,19 @@ _interpolation4d(cs_real_t trad,
                  cs_real_t xco2,
                  cs_real_t xh2o,
                  int       interp_method,
+                 cs_real_t wrk[],
                  cs_real_t gdb[],
                  cs_real_t kdb[])
 {
   int     itx[4][4];
   int     nix, nit;
 
-  cs_real_t *karray, *kint1, *kint2, *kint3;
-  BFT_MALLOC(karray, ng*4*4*4*4, cs_real_t);
-  BFT_MALLOC(kint1,  ng*4*4*4, cs_real_t);
-  BFT_MALLOC(kint2,  ng*4*4, cs_real_t);
-  BFT_MALLOC(kint3,  ng*4, cs_real_t);
+  cs_real_t *karray = wrk;                        /* [4*4*4*4][ng] */
+  cs_real_t *kint1  = wrk + ng*4*4*4*4;           /* [4*4*4][ng] */
+  cs_real_t *kint2  = wrk + ng*(4*4*4*4 + 4*4*4); /* [4*4][ng] */
+  cs_real_t *kint3  = wrk + ng*(4*4*4*4 + 4*4*4 + 4*4); /* [4][ng] */
 
-  cs_real_t *b, *c, *d, *kg_t2, *kg_x2;
-  BFT_MALLOC(b, 4, cs_real_t);
-  BFT_MALLOC(c, 4, cs_real_t);
-  BFT_MALLOC(d, 4, cs_real_t);
-  BFT_MALLOC(kg_t2, 4, cs_real_t);
-  BFT_MALLOC(kg_x2, 4, cs_real_t);
+  cs_real_t b[4], c[4], d[4], ya[4], kg_t2[4], kg_x2[4];
 
   /* Determine positions in x and T
    * in the NB database for interpolation. */
@@ -713,18 +730,15 @@ _interpolation4d(cs_real_t trad,
     for (int ico2 = 0; ico2 < nix; ico2++) {
       for (int it = 0; it < nit; it++) {
         for (int itrad = 0; itrad < nit; itrad++) {
-          for (int ig = 0; ig < ng; ig++) {
-            karray[  ih2o
-                   + ico2*4
-                   + it*4*4
-                   + itrad*4*4*4
-                   + ig*4*4*4*4] =
-              kmfs[  ih2oa[ih2o]
-                   + ico2a[ico2]*nconc
-                   + ita[it]*nconc*nconc
-                   + itrada[itrad]*nconc*nconc*nt
-                   + ig*nconc*nconc*nt*nt];
-          }
+          const cs_real_t *src
+            = kmfs + ((cs_lnum_t)ih2oa[ih2o]
+                      + ico2a[ico2]*nconc
+                      + ita[it]*nconc*nconc
+                      + itrada[itrad]*nconc*nconc*nt) * ng;
+          cs_real_t *dst
+            = karray + (ih2o + ico2*4 + it*4*4 + itrad*4*4*4)*ng;
+          for (int ig = 0; ig < ng; ig++)
+            dst[ig] = src[ig];
         }
       }
     }
@@ -733,31 +747,22 @@ _interpolation4d(cs_real_t trad,
   /* Interpolation on XH2O; spline over x */
 
   if (interp_method == im2dspline) {
+    kg_x2[0] = x_kg[ih2oa[0]];
+    kg_x2[1] = x_kg[ih2oa[1]];
+    kg_x2[2] = x_kg[ih2oa[2]];
+    kg_x2[3] = x_kg[ih2oa[3]];
     for (int ico2 = 0; ico2 < nix; ico2++) {
       for (int it = 0; it < nit; it++) {
         for (int itrad = 0; itrad < nit; itrad++) {
+          const cs_real_t *ka
+            = karray + (ico2*4 + it*4*4 + itrad*4*4*4)*ng;
+          cs_real_t *ki = kint1 + (ico2 + it*4 + itrad*4*4)*ng;
           for (int ig = 0; ig < ng; ig++) {
-            kg_x2[0] = x_kg[ih2oa[0]];
-            kg_x2[1] = x_kg[ih2oa[1]];
-            kg_x2[2] = x_kg[ih2oa[2]];
-            kg_x2[3] = x_kg[ih2oa[3]];
-            int ih2o = 0;
+            for (int j = 0; j < 4; j++)
+              ya[j] = ka[j*ng + ig];
             int nargs = 4;
-            _splmi(nargs,
-                   kg_x2,
-                   &karray[ih2o + ico2*4 + it*4*4 + itrad*4*4*4 + ig*4*4*4*4],
-                   b,
-                   c,
-                   d);
-
-            kint1[ico2 + it*4 + itrad*4*4 + ig*4*4*4]
-              = _seval(nargs,
-                       xh2o,
-                       kg_x2,
-                       &karray[ih2o + ico2*4 + it*4*4 + itrad*4*4*4 + ig*4*4*4*4],
-                       b,
-                       c,
-                       d);
+            _splmi(nargs, kg_x2, ya, b, c, d);
+            ki[ig] = _seval(nargs, xh2o, kg_x2, ya, b, c, d);
           }
         }
       }
@@ -768,11 +773,11 @@ _interpolation4d(cs_real_t trad,
     for (int ico2 = 0; ico2 < nix; ico2++) {
       for (int it = 0; it < nit; it++) {
         for (int itrad = 0; itrad < nit; itrad++) {
-          for (int ig = 0; ig < ng; ig++) {
-            kint1[ico2 + it*4 + itrad*4*4 + ig*4*4*4]
-              =          wx  * karray[1 + ico2*4 + it*4*4 + itrad*4*4*4 + ig*4*4*4*4]
-                + (1.0 - wx) * karray[0 + ico2*4 + it*4*4 + itrad*4*4*4 + ig*4*4*4*4];
-          }
+          const cs_real_t *ka
+            = karray + (ico2*4 + it*4*4 + itrad*4*4*4)*ng;
+          cs_real_t *ki = kint1 + (ico2 + it*4 + itrad*4*4)*ng;
+          for (int ig = 0; ig < ng; ig++)
+            ki[ig] = wx * ka[ng + ig] + (1.0 - wx) * ka[ig];
         }
       }
     }
@@ -781,30 +786,20 @@ _interpolation4d(cs_real_t trad,
   /* Interpolation on XCO2: spline over x */
 
   if (interp_method == im2dspline) {
+    kg_x2[0] = x_kg[ico2a[0]];
+    kg_x2[1] = x_kg[ico2a[1]];
+    kg_x2[2] = x_kg[ico2a[2]];
+    kg_x2[3] = x_kg[ico2a[3]];
     for (int it = 0; it < nit; it++) {
       for (int itrad = 0; itrad < nit; itrad++) {
+        const cs_real_t *ki1 = kint1 + (it*4 + itrad*4*4)*ng;
+        cs_real_t *ki2 = kint2 + (it + itrad*4)*ng;
         for (int ig = 0; ig < ng; ig++) {
-          kg_x2[0] = x_kg[ico2a[0]];
-          kg_x2[1] = x_kg[ico2a[1]];
-          kg_x2[2] = x_kg[ico2a[2]];
-          kg_x2[3] = x_kg[ico2a[3]];
-
-          int ico2 = 0;
+          for (int j = 0; j < 4; j++)
+            ya[j] = ki1[j*ng + ig];
           int nargs = 4;
-          _splmi(nargs,
-                 kg_x2,
-                 &kint1[ico2 + it*4 + itrad*4*4 + ig*4*4*4],
-                 b,
-                 c,
-                 d);
-          kint2[it + itrad*4 + ig*4*4]
-            = _seval(nargs,
-                     xco2,
-                     kg_x2,
-                     &kint1[ico2 + it*4 + itrad*4*4 + ig*4*4*4],
-                     b,
-                     c,
-                     d);
+          _splmi(nargs, kg_x2, ya, b, c, d);
+          ki2[ig] = _seval(nargs, xco2, kg_x2, ya, b, c, d);
         }
       }
     }
@@ -813,11 +808,10 @@ _interpolation4d(cs_real_t trad,
     cs_real_t wx = (xco2 - x_kg[ico2a[0]]) / (x_kg[ico2a[1]] - x_kg[ico2a[0]]);
     for (int it = 0; it < nit; it++) {
       for (int itrad = 0; itrad < nit; itrad++) {
-        for (int ig = 0; ig < ng; ig++) {
-          kint2[it + itrad*4 + ig*4*4]
-            =          wx  * kint1[1 + it*4 + itrad*4*4 + ig*4*4*4]
-              + (1.0 - wx) * kint1[0 + it*4 + itrad*4*4 + ig*4*4*4];
-        }
+        const cs_real_t *ki1 = kint1 + (it*4 + itrad*4*4)*ng;
+        cs_real_t *ki2 = kint2 + (it + itrad*4)*ng;
+        for (int ig = 0; ig < ng; ig++)
+          ki2[ig] = wx * ki1[ng + ig] + (1.0 - wx) * ki1[ig];
       }
     }
   }
@@ -825,80 +819,52 @@ _interpolation4d(cs_real_t trad,
   /* Interpolation on T: spline on t */
 
   if (interp_method != 0) {
+    kg_t2[0] = tt[ita[0]];
+    kg_t2[1] = tt[ita[1]];
+    kg_t2[2] = tt[ita[2]];
+    kg_t2[3] = tt[ita[3]];
     for (int itrad = 0; itrad < nit; itrad++) {
+      const cs_real_t *ki2 = kint2 + itrad*4*ng;
+      cs_real_t *ki3 = kint3 + itrad*ng;
       for (int ig = 0; ig < ng; ig++) {
-        kg_t2[0] = tt[ita[0]];
-        kg_t2[1] = tt[ita[1]];
-        kg_t2[2] = tt[ita[2]];
-        kg_t2[3] = tt[ita[3]];
+        for (int j = 0; j < 4; j++)
+          ya[j] = ki2[j*ng + ig];
         int nargs = 4;
-        _splmi (nargs,
-                kg_t2,
-                &kint2[0 + itrad*4 + ig*4*4],
-                b,
-                c,
-                d);
-        kint3[itrad + ig*4] = _seval(nargs,
-                                     t,
-                                     kg_t2,
-                                     &kint2[0 + itrad*4 + ig*4*4],
-                                     b,
-                                     c,
-                                     d);
+        _splmi(nargs, kg_t2, ya, b, c, d);
+        ki3[ig] = _seval(nargs, t, kg_t2, ya, b, c, d);
       }
     }
   }
   else {
     cs_real_t wt = (t - tt[ita[0]]) / (tt[ita[1]] - tt[ita[0]]);
     for (int itrad = 0; itrad < nit; itrad++) {
-      for (int ig = 0; ig < ng; ig++) {
-        kint3[itrad + ig*4] =         wt  * kint2[1 + itrad*4 + ig*4*4]
-                             + (1.0 - wt) * kint2[0 + itrad*4 + ig*4*4];
-      }
+      const cs_real_t *ki2 = kint2 + itrad*4*ng;
+      cs_real_t *ki3 = kint3 + itrad*ng;
+      for (int ig = 0; ig < ng; ig++)
+        ki3[ig] = wt * ki2[ng + ig] + (1.0 - wt) * ki2[ig];
     }
   }
 
   /* Interpolation on Trad: spline */
 
   if (interp_method != 0) {
+    kg_t2[0] = tt[itrada[0]];
+    kg_t2[1] = tt[itrada[1]];
+    kg_t2[2] = tt[itrada[2]];
+    kg_t2[3] = tt[itrada[3]];
     for (int ig = 0; ig < ng; ig++) {
-      kg_t2[0] = tt[itrada[0]];
-      kg_t2[1] = tt[itrada[1]];
-      kg_t2[2] = tt[itrada[2]];
-      kg_t2[3] = tt[itrada[3]];
+      for (int j = 0; j < 4; j++)
+        ya[j] = kint3[j*ng + ig];
       int nargs = 4;
-      _splmi(nargs,
-             kg_t2,
-             &kint3[0 + ig*4],
-             b,
-             c,
-             d);
-      kdb[ig] = _seval(nargs,
-                       trad,
-                       kg_t2,
-                       &kint3[0 + ig*4],
-                       b,
-                       c,
-                       d);
+      _splmi(nargs, kg_t2, ya, b, c, d);
+      kdb[ig] = _seval(nargs, trad, kg_t2, ya, b, c, d);
     }
   }
   else {
     cs_real_t wt = (trad - tt[itrada[0]]) / (tt[itrada[1]] - tt[itrada[0]]);
-    for (int ig = 0; ig < ng; ig++) {
-      kdb[ig] = wt * kint3[1 + ig*4] + (1.0 - wt) * kint3[0 + ig*4];
-    }
+    for (int ig = 0; ig < ng; ig++)
+      kdb[ig] = wt * kint3[ng + ig] + (1.0 - wt) * kint3[ig];
   }
-
-  /* Free memory */
-  BFT_FREE(karray);
-  BFT_FREE(kint1);
-  BFT_FREE(kint2);
-  BFT_FREE(kint3);
-  BFT_FREE(b);
-  BFT_FREE(c);
-  BFT_FREE(d);
-  BFT_FREE(kg_t2);
-  BFT_FREE(kg_x2);
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -931,20 +897,14 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
 {
   /* Initialization */
 
-  cs_real_t   *gfskref, *kfskref, *kfsk, *gfsk, *gg1;
-  cs_real_t   *kg1, *as, *ag, *aw, *kloctmp;
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
+  const int nwsgg = cs_glob_rad_transfer_params->nwsgg;
+
+  cs_real_t   *gfskref, *kfskref;
 
   BFT_MALLOC(gfskref, ng, cs_real_t);
   BFT_MALLOC(kfskref, ng, cs_real_t);
-  BFT_MALLOC(gfsk, ng, cs_real_t);
-  BFT_MALLOC(kfsk, ng, cs_real_t);
-  BFT_MALLOC(gg1, ng, cs_real_t);
-  BFT_MALLOC(kg1, ng, cs_real_t);
-  BFT_MALLOC(as, ng, cs_real_t);
-
-  BFT_MALLOC(ag, cs_glob_rad_transfer_params->nwsgg, cs_real_t);
-  BFT_MALLOC(aw, cs_glob_rad_transfer_params->nwsgg, cs_real_t);
-  BFT_MALLOC(kloctmp, cs_glob_rad_transfer_params->nwsgg, cs_real_t);
 
   cs_field_t *f_bound_t = cs_field_by_name_try("boundary_temperature");
   cs_real_t *tpfsck = f_bound_t->val;
@@ -965,10 +925,16 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
     BFT_MALLOC(wv,    nband, cs_real_t);
     BFT_MALLOC(dwv,   nband, cs_real_t);
 
-    BFT_MALLOC(kmfs, nconc * nconc * nt *nt *ng, cs_real_t);
+    /* The k-distribution table is large and read-only once built, so it
+       is stored only once per compute node, in node-shared memory. */
 
-    /* Read k-distributions */
-    {
+    bool is_node_leader = true;
+    kmfs = cs_base_shared_mem_allocate(  sizeof(cs_real_t)
+                                       * ((size_t)nconc*nconc*nt*nt*ng),
+                                       &is_node_leader);
+
+    /* Read k-distributions (on node leaders only) */
+    if (is_node_leader) {
       snprintf(filepath, 256, "%s/data/thch/dp_radiat_MFS", pathdatadir);
       radfile = fopen(filepath, "r");
       char line[256];
@@ -984,11 +950,12 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
                 _line_to_array(radfile, temp, &nvalues);
                 assert(nvalues == 2);
                 gi[ig] = temp[0];
-                kmfs[  ch2o
-                     + cco2*nconc
-                     + it*nconc*nconc
-                     + itrad*nconc*nconc*nt
-                     + ig*nconc*nconc*nt*nt] = temp[1];
+                /* quadrature point index ig is kept contiguous, so that
+                   interpolation loops in _interpolation4d are unit-stride */
+                kmfs[  ((cs_lnum_t)ch2o
+                        + cco2*nconc
+                        + it*nconc*nconc
+                        + itrad*nconc*nconc*nt) * ng + ig] = temp[1];
               }
             }
           }
@@ -997,6 +964,12 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
       fclose(radfile);
     }
 
+    cs_base_shared_mem_sync(kmfs);
+
+    /* Quadrature points are the same for all table entries, so ranks
+       which did not read the file obtain them from rank 0. */
+    cs_parall_bcast(0, ng, CS_REAL_TYPE, gi);
+
     /* Read the Planck coefficients */
     {
       snprintf(filepath, 256, "%s/data/thch/dp_radiat_Planck_CO2", pathdatadir);
@@ -1161,17 +1134,21 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
 
   /* Compute the reference state */
 
+  const cs_real_t *cell_vol = cs_glob_mesh_quantities->cell_vol;
+
   cs_real_t pco2ref = 0.0;
   cs_real_t ph2oref = 0.0;
   cs_real_t tref   = 0.0;
   cs_real_t sum1   = 0.0;
   cs_real_t sum2   = 0.0;
 
-  for (cs_lnum_t iel = 0; iel < cs_glob_mesh->n_cells; iel++) {
+# pragma omp parallel for reduction(+:pco2ref, ph2oref, sum1, sum2) \
+                          if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
 
     /* Calculation of pco2ref and ph2oref */
-    pco2ref += pco2[iel] * cs_glob_mesh_quantities->cell_vol[iel];
-    ph2oref += ph2o[iel] * cs_glob_mesh_quantities->cell_vol[iel];
+    pco2ref += pco2[iel] * cell_vol[iel];
+    ph2oref += ph2o[iel] * cell_vol[iel];
 
     /* Calculation of tref */
     /* Interplolation of Planck coefficient for mix */
@@ -1193,7 +1170,7 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
     }
     cs_real_t kpt4dv =  kp
                       * pow(teloc[iel], 4.0)
-                      * cs_glob_mesh_quantities->cell_vol[iel];
+                      * cell_vol[iel];
     sum1 += kpt4dv * teloc[iel];
     sum2 += kpt4dv;
   }
@@ -1213,111 +1190,168 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
 
   /* Determination of the k-distribution at the reference state */
   int interp_method = imlinear;
-  _interpolation4d(tref,
-                   tref,
-                   pco2ref,
-                   ph2oref,
-                   interp_method,
-                   gfskref,
-                   kfskref);
+  {
+    cs_real_t *wrk;
+    BFT_MALLOC(wrk, _interpolation4d_wrk_size(), cs_real_t);
+    _interpolation4d(tref,
+                     tref,
+                     pco2ref,
+                     ph2oref,
+                     interp_method,
+                     wrk,
+                     gfskref,
+                     kfskref);
+    BFT_FREE(wrk);
+  }
 
   /* [m^-1] */
   for (int i = 0; i < ng; i++)
     kfskref[i] *= 100.0;
 
-  for (cs_lnum_t iel = 0; iel < cs_glob_mesh->n_cells; iel++) {
-
-    /* Determination of the local absorbtion coefficient */
-    for (int i = 0; i < ng; i++) {
-      kfsk[i] = 0.;
-      gfsk[i] = 0.;
-    }
-    _interpolation4d (tref,
-                      teloc[iel],
-                      pco2[iel],
-                      ph2o[iel],
-                      interp_method,
+# pragma omp parallel if (n_cells > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    cs_parall_thread_range(n_cells, sizeof(cs_real_t), &s_id, &e_id);
+
+    /* Thread-local work arrays */
+    cs_real_t *kfsk, *gfsk, *gg1, *kg1, *as, *ag, *kloctmp, *wrk;
+    BFT_MALLOC(gfsk, ng, cs_real_t);
+    BFT_MALLOC(kfsk, ng, cs_real_t);
+    BFT_MALLOC(gg1, ng, cs_real_t);
+    BFT_MALLOC(kg1, ng, cs_real_t);
+    BFT_MALLOC(as, ng, cs_real_t);
+    BFT_MALLOC(ag, nwsgg, cs_real_t);
+    BFT_MALLOC(kloctmp, nwsgg, cs_real_t);
+    BFT_MALLOC(wrk, _interpolation4d_wrk_size(), cs_real_t);
+
+    for (cs_lnum_t iel = s_id; iel < e_id; iel++) {
+
+      /* Determination of the local absorbtion coefficient */
+      for (int i = 0; i < ng; i++) {
+        kfsk[i] = 0.;
+        gfsk[i] = 0.;
+      }
+      _interpolation4d (tref,
+                        teloc[iel],
+                        pco2[iel],
+                        ph2o[iel],
+                        interp_method,
+                        wrk,
+                        gfsk,
+                        kfsk);
+      /* [m^-1] */
+      for (int i = 0; i < ng; i++)
+        kfsk[i] *= 100.0;
+
+      _simple_interpg(ng,
                       gfsk,
-                      kfsk);
-    /* [m^-1] */
-    for (int i = 0; i < ng; i++)
-      kfsk[i] *= 100.0;
-
-    _simple_interpg(ng,
-                    gfsk,
-                    kfsk,
-                    cs_glob_rad_transfer_params->nwsgg,
-                    gq,
-                    kloctmp);
-    for (int i = 0; i < cs_glob_rad_transfer_params->nwsgg; i++)
-      kloc[i * cs_glob_mesh->n_cells + iel] = kloctmp[i];
-
-    /* Determination of the local weights */
-    for (int i = 0; i < ng; i++) {
-      kfsk[i] = 0.;
-      gfsk[i] = 0.;
+                      kfsk,
+                      nwsgg,
+                      gq,
+                      kloctmp);
+      for (int i = 0; i < nwsgg; i++)
+        kloc[i * n_cells + iel] = kloctmp[i];
+
+      /* Determination of the local weights */
+      for (int i = 0; i < ng; i++) {
+        kfsk[i] = 0.;
+        gfsk[i] = 0.;
+      }
+      _interpolation4d(teloc[iel],
+                       tref,
+                       pco2ref,
+                       ph2oref,
+                       interp_method,
+                       wrk,
+                       gg1,
+                       kg1);
+      /* [m^-1] */
+      for (int i = 0; i < ng; i++)
+        kg1[i] *= 100.0;
+
+      _simple_interpg(ng,
+                      kg1,
+                      gg1,
+                      ng,
+                      kfskref,
+                      gfsk);
+      as[0]  = (gfsk[1] - gfsk[0]) / (gfskref[1] - gfskref[0] + 1e-15);
+      as[ng-1] = (gfsk[ng-1] - gfsk[ng - 2]) / (gfskref[ng-1] - gfskref[ng - 2] + 1e-15);
+      for (int k = 1; k < ng - 1; k++)
+        as[k] = (gfsk[k + 1] - gfsk[k - 1]) / (gfskref[k + 1] - gfskref[k - 1] + 1e-15);
+      _simple_interpg(ng,
+                      gfskref,
+                      as,
+                      nwsgg,
+                      gq,
+                      ag);
+      for (int i = 0; i < nwsgg; i++)
+        aloc[i * n_cells + iel] = ag[i];
+
     }
-    _interpolation4d(teloc[iel],
-                     tref,
-                     pco2ref,
-                     ph2oref,
-                     interp_method,
-                     gg1,
-                     kg1);
-    /* [m^-1] */
-    for (int i = 0; i < ng; i++)
-      kg1[i] *= 100.0;
-
-    _simple_interpg(ng,
-                    kg1,
-                    gg1,
-                    ng,
-                    kfskref,
-                    gfsk);
-    as[0]  = (gfsk[1] - gfsk[0]) / (gfskref[1] - gfskref[0] + 1e-15);
-    as[ng-1] = (gfsk[ng-1] - gfsk[ng - 2]) / (gfskref[ng-1] - gfskref[ng - 2] + 1e-15);
-    for (int k = 1; k < ng - 1; k++)
-      as[k] = (gfsk[k + 1] - gfsk[k - 1]) / (gfskref[k + 1] - gfskref[k - 1] + 1e-15);
-    _simple_interpg(ng,
-                    gfskref,
-                    as,
-                    cs_glob_rad_transfer_params->nwsgg,
-                    gq,
-                    ag);
-    for (int i = 0; i < cs_glob_rad_transfer_params->nwsgg; i++)
-      aloc[i * cs_glob_mesh->n_cells + iel] = ag[i];
 
+    BFT_FREE(gfsk);
+    BFT_FREE(kfsk);
+    BFT_FREE(gg1);
+    BFT_FREE(kg1);
+    BFT_FREE(as);
+    BFT_FREE(ag);
+    BFT_FREE(kloctmp);
+    BFT_FREE(wrk);
   }
 
-  for (cs_lnum_t ifac = 0; ifac < cs_glob_mesh->n_b_faces; ifac++) {
-    _interpolation4d(tpfsck[ifac],
-                     tref,
-                     pco2ref,
-                     ph2oref,
-                     interp_method,
-                     gg1,
-                     kg1);
-    for (int i = 0; i < ng; i++)
-      kg1[i] *= 100.0;
-
-    _simple_interpg(ng,
-                    kg1,
-                    gg1,
-                    ng,
-                    kfskref,
-                    gfsk);
-    as[0]  = (gfsk[1] - gfsk[0]) / (gfskref[1] - gfskref[0] + 1e-15);
-    as[ng] = (gfsk[ng] - gfsk[ng - 1]) / (gfskref[ng] - gfskref[ng - 1] + 1e-15);
-    for (int k = 1; k < ng - 1; k++)
-      as[k] = (gfsk[k + 1] - gfsk[k - 1]) / (gfskref[k + 1] - gfskref[k - 1] + 1e-15);
-    _simple_interpg(ng,
-                    gfskref,
-                    as,
-                    cs_glob_rad_transfer_params->nwsgg,
-                    gq,
-                    aw);
-    for (int i = 0; i < cs_glob_rad_transfer_params->nwsgg; i++)
-      alocb[i * cs_glob_mesh->n_b_faces + ifac] = aw[i];
+# pragma omp parallel if (n_b_faces > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    cs_parall_thread_range(n_b_faces, sizeof(cs_real_t), &s_id, &e_id);
+
+    /* Thread-local work arrays */
+    cs_real_t *gfsk, *gg1, *kg1, *as, *aw, *wrk;
+    BFT_MALLOC(gfsk, ng, cs_real_t);
+    BFT_MALLOC(gg1, ng, cs_real_t);
+    BFT_MALLOC(kg1, ng, cs_real_t);
+    BFT_MALLOC(as, ng, cs_real_t);
+    BFT_MALLOC(aw, nwsgg, cs_real_t);
+    BFT_MALLOC(wrk, _interpolation4d_wrk_size(), cs_real_t);
+
+    for (cs_lnum_t ifac = s_id; ifac < e_id; ifac++) {
+      _interpolation4d(tpfsck[ifac],
+                       tref,
+                       pco2ref,
+                       ph2oref,
+                       interp_method,
+                       wrk,
+                       gg1,
+                       kg1);
+      for (int i = 0; i < ng; i++)
+        kg1[i] *= 100.0;
+
+      _simple_interpg(ng,
+                      kg1,
+                      gg1,
+                      ng,
+                      kfskref,
+                      gfsk);
+      as[0]  = (gfsk[1] - gfsk[0]) / (gfskref[1] - gfskref[0] + 1e-15);
+      as[ng-1] = (gfsk[ng-1] - gfsk[ng - 2]) / (gfskref[ng-1] - gfskref[ng - 2] + 1e-15);
+      for (int k = 1; k < ng - 1; k++)
+        as[k] = (gfsk[k + 1] - gfsk[k - 1]) / (gfskref[k + 1] - gfskref[k - 1] + 1e-15);
+      _simple_interpg(ng,
+                      gfskref,
+                      as,
+                      nwsgg,
+                      gq,
+                      aw);
+      for (int i = 0; i < nwsgg; i++)
+        alocb[i * n_b_faces + ifac] = aw[i];
+    }
+
+    BFT_FREE(gfsk);
+    BFT_FREE(gg1);
+    BFT_FREE(kg1);
+    BFT_FREE(as);
+    BFT_FREE(aw);
+    BFT_FREE(wrk);
   }
 
   /* free memory */
@@ -1332,7 +1366,8 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
     BFT_FREE(gq);
   }
 
-  BFT_FREE(kloctmp);
+  BFT_FREE(gfskref);
+  BFT_FREE(kfskref);
 }
 
 /*----------------------------------------------------------------------------*/
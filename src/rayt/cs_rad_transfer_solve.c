@@ -239,10 +239,13 @@ _order_by_direction(void)
   cs_real_t *s;
   BFT_MALLOC(s, n_cells, cs_real_t);
 
-  for (int kk = -1; kk < 2; kk+=2) {
-    for (int ii = -1; ii < 2; ii+=2) {
-      for (int jj = -1; jj < 2; jj+=2) {
-        for (int dir_id = 0; dir_id < cs_glob_rad_transfer_params->ndirs; dir_id++) {
+  /* Loop on directions, with the octant replication innermost, matching
+     the sweep ordering of _cs_rad_transfer_sol */
+
+  for (int dir_id = 0; dir_id < cs_glob_rad_transfer_params->ndirs; dir_id++) {
+    for (int kk = -1; kk < 2; kk+=2) {
+      for (int ii = -1; ii < 2; ii+=2) {
+        for (int jj = -1; jj < 2; jj+=2) {
 
           cs_real_t v[3] = {ii*cs_glob_rad_transfer_params->vect_s[dir_id][0],
                             jj*cs_glob_rad_transfer_params->vect_s[dir_id][1],
@@ -266,6 +269,7 @@ _order_by_direction(void)
                                                    0,      /* poly_degree */
                                                    1000);  /* n_max_iter */
 
+#             pragma omp parallel for if (n_cells > CS_THR_MIN)
               for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
                 s[c_id] =   v[0]*cell_cen[c_id][0]
                           + v[1]*cell_cen[c_id][1]
@@ -416,11 +420,13 @@ _cs_rad_transfer_sol(int                        gg_id,
 
   if (cs_glob_fluid_properties->icp > 0) {
     const cs_field_t *f_cp = CS_F_(cp);
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
       dcp[cell_id] = 1. / f_cp->val[cell_id];
   }
   else {
     const cs_real_t dcp0 = 1.0 / cs_glob_fluid_properties->cp0;
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
       dcp[cell_id] = dcp0;
   }
@@ -520,7 +526,6 @@ _cs_rad_transfer_sol(int                        gg_id,
    *                            /2PI
    */
 
-  cs_real_t aa;
   if (!one_dir) {
     for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
       f_snplus->val[face_id] = 0.0;
@@ -534,8 +539,10 @@ _cs_rad_transfer_sol(int                        gg_id,
             vect_s[1] = jj * rt_params->vect_s[dir_id][1];
             vect_s[2] = kk * rt_params->vect_s[dir_id][2];
             domegat = rt_params->angsol[dir_id];
+#           pragma omp parallel for if (n_b_faces > CS_THR_MIN)
             for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
-              aa = cs_math_3_dot_product(vect_s, b_face_normal[face_id]);
+              cs_real_t aa = cs_math_3_dot_product(vect_s,
+                                                   b_face_normal[face_id]);
               aa /= b_face_surf[face_id];
               f_snplus->val[face_id] += 0.5 * (-aa + CS_ABS(aa)) * domegat;
             }
@@ -578,6 +585,27 @@ _cs_rad_transfer_sol(int                        gg_id,
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
     rovsdt[cell_id] = CS_MAX(rovsdt[cell_id], 0.0);
 
+  /* Direction-independent setup, hoisted out of the sweep:
+     boundary "viscosity" is always zero, as is the interior one
+     in the absence of dispersion. */
+
+  cs_real_t *bpro_eps = NULL;
+  if ( rt_params->atmo_model == CS_RAD_ATMO_3D_NONE
+      ||  gg_id == rt_params->atmo_ir_id)
+    bpro_eps = cs_field_by_name("emissivity")->val;
+
+  cs_field_t *f_albedo = cs_field_by_name_try("boundary_albedo");
+
+# pragma omp parallel for if (n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
+    viscb[face_id] = 0.0;
+
+  if (rt_params->dispersion == false) {
+#   pragma omp parallel for if (n_i_faces > CS_THR_MIN)
+    for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
+      viscf[face_id] = 0.0;
+  }
+
   /* Angular discretization */
 
   int kdir = 0;
@@ -585,13 +613,37 @@ _cs_rad_transfer_sol(int                        gg_id,
   /* When having only one direction, one pass is enough... */
   bool finished = false;
 
+  /* Loop on directions, with the octant replication innermost, so that
+     per-direction quantities (dispersion viscosity) are shared by the
+     8 octants of a given quadrature direction. */
+
+  for (int dir_id = 0;
+       dir_id < rt_params->ndirs && !finished;
+       dir_id++) {
+
+    /* Implicit source term (rovsdt seen above) */
+
+    if (rt_params->dispersion) {
+      const cs_real_t dir_omega
+        = (one_dir) ? domegat : rt_params->angsol[dir_id];
+      const cs_real_t disp_coeff
+        = rt_params->dispersion_coeff;
+      const cs_real_t pi = cs_math_pi;
+      const cs_real_t tan_alpha
+        =    sqrt(dir_omega * (4.*pi - dir_omega))
+           / (2. * pi - dir_omega);
+      const cs_real_t *i_face_surf = cs_glob_mesh_quantities->i_face_surf;
+
+#     pragma omp parallel for if (n_i_faces > CS_THR_MIN)
+      for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
+        viscf[face_id] = disp_coeff * tan_alpha * i_face_surf[face_id];
+    }
+
   for (int kk = -1; kk <= 1 && !finished; kk+=2) {
     for (int ii = -1; ii <= 1 && !finished; ii+=2) {
       for (int jj = -1; jj <= 1 && !finished; jj+=2) {
 
-        for (int dir_id = 0;
-             dir_id < rt_params->ndirs && !finished;
-             dir_id++) {
+        {
 
           char sles_name[80];
 
@@ -614,11 +666,6 @@ _cs_rad_transfer_sol(int                        gg_id,
           /* Update boundary condition coefficients
            * Note: In Atmo, emissivity is usefull only for InfraRed
            * */
-          cs_real_t *bpro_eps = NULL;
-          if ( rt_params->atmo_model == CS_RAD_ATMO_3D_NONE
-              ||  gg_id == rt_params->atmo_ir_id)
-            bpro_eps = cs_field_by_name("emissivity")->val;
-
           if (rt_params->atmo_model != CS_RAD_ATMO_3D_NONE)
             cs_rad_transfer_bc_coeffs(bc_type,
                                       vect_s,
@@ -631,6 +678,7 @@ _cs_rad_transfer_sol(int                        gg_id,
           /* Spatial discretization */
 
           /* Explicit source term */
+#         pragma omp parallel for if (n_cells > CS_THR_MIN)
           for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
             rhs[cell_id] = rhs0[cell_id];
 
@@ -639,6 +687,7 @@ _cs_rad_transfer_sol(int                        gg_id,
 
             const cs_real_t *grav = cs_glob_physical_constants->gravity;
 
+#           pragma omp parallel for if (n_cells > CS_THR_MIN)
             for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
               if (cs_math_3_dot_product(grav, vect_s) < 0.0)
                 ck_u_d[cell_id] = ck_u[gg_id + cell_id * stride];
@@ -680,39 +729,18 @@ _cs_rad_transfer_sol(int                        gg_id,
             }
           }
 
-          /* Implicit source term (rovsdt seen above) */
-
-          if (rt_params->dispersion) {
-            const cs_real_t disp_coeff
-              = rt_params->dispersion_coeff;
-            const cs_real_t pi = cs_math_pi;
-            const cs_real_t tan_alpha
-              =    sqrt(domegat * (4.*pi - domegat))
-                 / (2. * pi - domegat);
-            const cs_real_t *i_face_surf = cs_glob_mesh_quantities->i_face_surf;
-
-            for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
-              viscf[face_id] = disp_coeff * tan_alpha * i_face_surf[face_id];
-          }
-
-          else {
-            for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
-              viscf[face_id] = 0.0;
-          }
-
-          for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
-            viscb[face_id] = 0.0;
-
+#         pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
           for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
             radiance[cell_id] = 0.0;
             radiance_prev[cell_id] = 0.0;
           }
 
+#         pragma omp parallel for if (n_i_faces > CS_THR_MIN)
           for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
             flurds[face_id] = cs_math_3_dot_product(vect_s,
                                                     i_face_normal[face_id]);
 
-
+#         pragma omp parallel for if (n_b_faces > CS_THR_MIN)
           for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
             flurdb[face_id] =  cs_math_3_dot_product(vect_s,
                                                      b_face_normal[face_id]);
@@ -762,8 +790,9 @@ _cs_rad_transfer_sol(int                        gg_id,
 
           if (rt_params->atmo_model != CS_RAD_ATMO_3D_NONE) {
 
+#           pragma omp parallel for if (n_cells > CS_THR_MIN)
             for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-              aa = radiance[cell_id] * domegat;
+              cs_real_t aa = radiance[cell_id] * domegat;
               int_rad_domega[cell_id]  += aa;
               /* Absorption */
               int_abso[cell_id] += ck_u_d[cell_id] * aa;
@@ -788,8 +817,9 @@ _cs_rad_transfer_sol(int                        gg_id,
           }
           else {
 
+#           pragma omp parallel for if (n_cells > CS_THR_MIN)
             for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-              aa = radiance[cell_id] * domegat;
+              cs_real_t aa = radiance[cell_id] * domegat;
               int_rad_domega[cell_id]  += aa;
               q[cell_id][0] += aa * vect_s[0];
               q[cell_id][1] += aa * vect_s[1];
@@ -800,10 +830,10 @@ _cs_rad_transfer_sol(int                        gg_id,
 
           /* Flux incident to boundary */
 
-          cs_field_t *f_albedo = cs_field_by_name_try("boundary_albedo");
+#         pragma omp parallel for if (n_b_faces > CS_THR_MIN)
           for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
             cs_lnum_t cell_id = cs_glob_mesh->b_face_cells[face_id];
-            aa = cs_math_3_dot_product(vect_s, b_face_normal[face_id]);
+            cs_real_t aa = cs_math_3_dot_product(vect_s, b_face_normal[face_id]);
             aa /= b_face_surf[face_id];
             aa = 0.5 * (aa + CS_ABS(aa)) * domegat;
             f_snplus->val[face_id] += aa;
@@ -818,12 +848,14 @@ _cs_rad_transfer_sol(int                        gg_id,
           /* Specific to Atmo (Direct Solar, diFfuse Solar, Infra Red) */
           if (cs_math_3_dot_product(cs_glob_physical_constants->gravity,
                                     vect_s) < 0.0 && f_up != NULL) {
+#           pragma omp parallel for if (n_cells > CS_THR_MIN)
             for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
               f_up->val[gg_id + cell_id * stride]
                 += radiance[cell_id] * domegat * vect_s[2];//FIXME S.g/||g||
           }
           else if (cs_math_3_dot_product(cs_glob_physical_constants->gravity,
                                          vect_s) > 0.0 && f_down != NULL) {
+#           pragma omp parallel for if (n_cells > CS_THR_MIN)
             for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
               f_down->val[gg_id + cell_id * stride]
                 += radiance[cell_id] * domegat * vect_s[2];
@@ -831,6 +863,8 @@ _cs_rad_transfer_sol(int                        gg_id,
         }
       }
     }
+  }
+
   } /* End of loop over directions */
 
   /* Finalize spectral incident flux to boundary */
@@ -841,7 +875,6 @@ _cs_rad_transfer_sol(int                        gg_id,
 
     /* For atmospheric radiation, albedo times the incident
      * direct solar radiation is given to the diffuse solar */
-    cs_field_t *f_albedo = cs_field_by_name_try("boundary_albedo");
     if (gg_id == rt_params->atmo_dr_id
         && rt_params->atmo_model & CS_RAD_ATMO_3D_DIFFUSE_SOLAR) {
       for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
@@ -1279,6 +1312,7 @@ cs_rad_transfer_solve(int  bc_type[])
 
   /* Work arrays */
 
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
 
     /* Radiation coefficient k of the gas phase */
@@ -1316,12 +1350,14 @@ cs_rad_transfer_solve(int  bc_type[])
   /* In case of grey gas radiation properties (kgi != f(lambda))
      * agi must be set to 1. */
   for (int i = 0; i < nwsgg; i++) {
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
       kgi[n_cells*i + cell_id] = 0.0;
       agi[n_cells*i + cell_id] = 1.0;
     }
   }
 
+# pragma omp parallel for if (n_b_faces > CS_THR_MIN)
   for (cs_lnum_t ifac = 0; ifac < n_b_faces; ifac++) {
     iqpato[ifac] = 0.0;
     /* In case of grey gas radiation properties (kgi != f(lambda))
@@ -1343,6 +1379,7 @@ cs_rad_transfer_solve(int  bc_type[])
     cs_real_t *cpro_abso = CS_FI_(rad_abs, class_num)->val;
     cs_real_t *cpro_emi  = CS_FI_(rad_emi, class_num)->val;
     cs_real_t *cpro_stri = CS_FI_(rad_ist, class_num)->val;
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
       cpro_abso[cell_id] = 0.0;
       cpro_emi[cell_id]  = 0.0;
@@ -1373,6 +1410,7 @@ cs_rad_transfer_solve(int  bc_type[])
     else
       cvara_scalt = CS_FI_(t, 0)->val;
 
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
       tempk[cell_id] = cvara_scalt[cell_id] + xptk;
 
@@ -1501,11 +1539,13 @@ cs_rad_transfer_solve(int  bc_type[])
 
   if (cs_glob_fluid_properties->icp > 0) {
     const cs_field_t *f_cp = CS_F_(cp);
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
       dcp[cell_id] = 1. / f_cp->val[cell_id];
   }
   else {
     const cs_real_t dcp0 = 1.0 / cs_glob_fluid_properties->cp0;
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
       dcp[cell_id] = dcp0;
   }
@@ -1534,6 +1574,7 @@ cs_rad_transfer_solve(int  bc_type[])
     if (rt_params->imoadf >= 1 || rt_params->imfsck >= 1) {
 
       /* assert(gg_id == 0);  TODO: merge ckg and kgi ? */
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
       for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
         ckg[cell_id] = kgi[n_cells*gg_id + cell_id];
 
@@ -1609,6 +1650,7 @@ cs_rad_transfer_solve(int  bc_type[])
 
       /* Gas phase: Explicit source term in the transport of theta4 */
 
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
       for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
         rhs[cell_id] =  3.0 * ckg[cell_id]
                             * cs_math_pow4(tempk[cell_id])
@@ -1624,6 +1666,7 @@ cs_rad_transfer_solve(int  bc_type[])
         cs_field_t *f_x2 = cs_field_by_name(fname);
 
         cs_lnum_t class_num = class_id + 1;
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
         for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
           rhs[cell_id] +=  3.0 * f_x2->val[cell_id] * cpro_cak[cell_id]
                                * cs_math_pow4(tempk[n_cells*class_num + cell_id])
@@ -1632,6 +1675,7 @@ cs_rad_transfer_solve(int  bc_type[])
       }
 
       /* -> Gas phase: Implicit source term in the transport eqn. of theta4 */
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
       for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
         rovsdt[cell_id] =  3.0 * ckg[cell_id] * cell_vol[cell_id];
 
@@ -1644,6 +1688,7 @@ cs_rad_transfer_solve(int  bc_type[])
         snprintf(fname, 80, "x_p_%02d", class_id + 1);
         cs_field_t *f_x2 = cs_field_by_name(fname);
 
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
         for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
           rovsdt[cell_id] +=  3.0 * f_x2->val[cell_id] * cpro_cak[cell_id]
                                   * cell_vol[cell_id];
@@ -1651,6 +1696,7 @@ cs_rad_transfer_solve(int  bc_type[])
 
       /* Radiation coefficient of the bulk phase   */
       /* Gas phase: */
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
       for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
         ckmix[cell_id] = ckg[cell_id];
 
@@ -1662,6 +1708,7 @@ cs_rad_transfer_solve(int  bc_type[])
         snprintf(fname, 80, "x_p_%02d", class_id + 1);
         cs_field_t *f_x2 = cs_field_by_name(fname);
 
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
         for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
           ckmix[cell_id] += f_x2->val[cell_id] * cpro_cak[cell_id];
       }
@@ -1705,12 +1752,14 @@ cs_rad_transfer_solve(int  bc_type[])
 
       /* Precomputed absorption and emission */
       /* Absorption */
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
       for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
         int_abso[cell_id] = ckg[cell_id] * int_rad_domega[cell_id];
 
       /* Emission and implicit ST */
       if (   pm_flag[CS_COMBUSTION_3PT] == -1
           && pm_flag[CS_COMBUSTION_EBU] == -1) {
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
         for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
           int_emi[cell_id] =   -4.0 * ckg[cell_id]
                              * c_stefan * cs_math_pow4(tempk[cell_id]);
@@ -1724,6 +1773,7 @@ cs_rad_transfer_solve(int  bc_type[])
         const cs_real_t *cpro_t4m = cs_field_by_name("temperature_4")->val;
         const cs_real_t *cpro_t3m = cs_field_by_name("temperature_3")->val;
 
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
         for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
           int_emi[cell_id] =   -4.0 * ckg[cell_id]
                              * c_stefan* cpro_t4m[cell_id];
@@ -1754,6 +1804,7 @@ cs_rad_transfer_solve(int  bc_type[])
           /* Emission initialized by direct absorption S0
            * Note: radiance is "1/pi * direct flux"
            * */
+#         pragma omp parallel for if (n_cells > CS_THR_MIN)
           for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
             f_emi->val[cell_id] = f_abs_dr->val[cell_id] * onedpi;
         }
@@ -1763,15 +1814,18 @@ cs_rad_transfer_solve(int  bc_type[])
               rt_params->atmo_dr_o3_id + 1);
           cs_field_t *f_abs_dr  = cs_field_by_name_try(f_name);
           /* Emission initialized by direct absorption S0 * dtau/dz */
+#         pragma omp parallel for if (n_cells > CS_THR_MIN)
           for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
             f_emi->val[cell_id] = f_abs_dr->val[cell_id] * onedpi;
         }
 
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
         for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
           rhs[cell_id] = f_emi->val[cell_id] * cell_vol[cell_id];
 
       } else if (   pm_flag[CS_COMBUSTION_3PT] == -1
                  && pm_flag[CS_COMBUSTION_EBU] == -1) {
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
         for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
           rhs[cell_id] =  c_stefan * ckg[cell_id]
                                      * cs_math_pow4(tempk[cell_id])
@@ -1781,6 +1835,7 @@ cs_rad_transfer_solve(int  bc_type[])
       } else {
         cs_real_t *cpro_t4m = cs_field_by_name("temperature_4")->val;
 
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
         for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
           rhs[cell_id] =  c_stefan * ckg[cell_id]
                                    * cpro_t4m[cell_id]
@@ -1799,6 +1854,7 @@ cs_rad_transfer_solve(int  bc_type[])
         cs_field_t *f_x2 = cs_field_by_name(fname);
 
         cs_lnum_t class_num = class_id + 1;
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
         for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
           rhs[cell_id] +=   f_x2->val[cell_id]
                           * agi[n_cells*gg_id + cell_id]
@@ -1810,6 +1866,7 @@ cs_rad_transfer_solve(int  bc_type[])
       }
 
       /* -> Gas phase: Implicit source term of the ETR */
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
       for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
         rovsdt[cell_id] = ckg[cell_id] * cell_vol[cell_id];
 
@@ -1822,6 +1879,7 @@ cs_rad_transfer_solve(int  bc_type[])
         snprintf(fname, 80, "x_p_%02d", class_id + 1);
         cs_field_t *f_x2 = cs_field_by_name(fname);
 
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
         for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
           rovsdt[cell_id] +=   f_x2->val[cell_id]
                              * cpro_cak[cell_id]
@@ -1865,6 +1923,7 @@ cs_rad_transfer_solve(int  bc_type[])
 
     /* (gas phase, precomputed)  */
 
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
       absom[cell_id] += int_abso[cell_id] * wq[gg_id];
 
@@ -1876,6 +1935,7 @@ cs_rad_transfer_solve(int  bc_type[])
       snprintf(fname, 80, "x_p_%02d", class_id + 1);
       cs_field_t *f_x2 = cs_field_by_name(fname);
 
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
       for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
         /* Absorption of particles is added to absom */
         absom[cell_id] +=   f_x2->val[cell_id] * cpro_cak[cell_id]
@@ -1892,6 +1952,7 @@ cs_rad_transfer_solve(int  bc_type[])
     /* (gas phase, precomputed)  */
     if (pm_flag[CS_COMBUSTION_SLFM] == -1) {
 
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
       for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
         emim[cell_id] +=   int_emi[cell_id]
                          * agi[n_cells*gg_id + cell_id]
@@ -1926,6 +1987,7 @@ cs_rad_transfer_solve(int  bc_type[])
       if (pm_flag[CS_COMBUSTION_COAL] >= 0)
         cp2 = coal->cp2ch[coal->ichcor[class_id]-1];
 
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
       for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
 
         cs_real_t sig_ck_t4
@@ -1961,6 +2023,7 @@ cs_rad_transfer_solve(int  bc_type[])
      *    /4.PI
      */
 
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
       /* Emitted intensity    */
       cpro_lumin[cell_id]  += (int_rad_domega[cell_id] * wq[gg_id]);
@@ -1975,6 +2038,7 @@ cs_rad_transfer_solve(int  bc_type[])
        the spectral flux densities */
 
     if (rt_params->imoadf >= 1 || rt_params->imfsck >= 1) {
+#     pragma omp parallel for if (n_b_faces > CS_THR_MIN)
       for (cs_lnum_t ifac = 0; ifac < n_b_faces; ifac++)
         iqpato[ifac] += f_qinsp->val[gg_id + ifac * nwsgg] * wq[gg_id];
     }
@@ -2102,6 +2166,7 @@ cs_rad_transfer_solve(int  bc_type[])
   if (idiver >= 0) {
 
     /* Emission + Absorption of gas and particles --> explicit ST */
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
       rad_estm[cell_id] = absom[cell_id] + emim[cell_id];
 
@@ -2117,6 +2182,7 @@ cs_rad_transfer_solve(int  bc_type[])
       cs_real_t *cpro_abso = CS_FI_(rad_abs, class_num)->val;
       cs_real_t *cpro_emi  = CS_FI_(rad_emi, class_num)->val;
 
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
       for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
         cpro_tsre[cell_id] = cpro_abso[cell_id] + cpro_emi[cell_id];
 
@@ -2125,6 +2191,7 @@ cs_rad_transfer_solve(int  bc_type[])
   }
   else {
 
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
       absom[cell_id]  = 0.0;
       emim[cell_id]   = 0.0;
@@ -2149,6 +2216,7 @@ cs_rad_transfer_solve(int  bc_type[])
     cs_real_3_t  *coefaq = (cs_real_3_t  *)bc_coeffs_loc.a;
     cs_real_33_t *coefbq = (cs_real_33_t *)bc_coeffs_loc.b;
 
+#   pragma omp parallel for if (n_b_faces > CS_THR_MIN)
     for (cs_lnum_t ifac = 0; ifac < n_b_faces; ifac++) {
       for (cs_lnum_t i = 0; i < 3; i++) {
         coefaq[ifac][i]
@@ -2186,6 +2254,7 @@ cs_rad_transfer_solve(int  bc_type[])
                        NULL, /* coupling */
                        grad);
 
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
       rad_estm[cell_id] = - grad[cell_id][0][0]
                           - grad[cell_id][1][1]
@@ -2217,6 +2286,7 @@ cs_rad_transfer_solve(int  bc_type[])
 
     /* Correction of the semi-analytical source term
        by the conservative source term  */
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
       rad_estm[cell_id] = (absom[cell_id] + emim[cell_id]) * s[0];
 
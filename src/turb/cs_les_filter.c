@@ -279,6 +279,93 @@ _les_filter_ext_neighborhood(int        stride,
   BFT_FREE(w1);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute filters for dynamic models using the standard neighborhood.
+ *
+ * This variant accumulates directly in the output array, so it handles
+ * arbitrary strides, allowing several quantities packed in a single
+ * interleaved array to be filtered in one adjacency sweep.
+ *
+ * \param[in]   stride   stride of array to filter
+ * \param[in]   val      array of values to filter
+ * \param[out]  f_val    array of filtered values
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_les_filter_packed(cs_lnum_t  stride,
+                   cs_real_t  val[],
+                   cs_real_t  f_val[])
+{
+  cs_real_t *v_val = NULL, *v_weight = NULL;
+
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_lnum_t  _stride = stride;
+  const cs_lnum_t  n_cells = mesh->n_cells;
+  const cs_real_t  *cell_vol = cs_glob_mesh_quantities->cell_vol;
+
+  /* Allocate and initialize working buffer */
+
+  BFT_MALLOC(v_val, mesh->n_vertices*_stride, cs_real_t);
+  BFT_MALLOC(v_weight, mesh->n_vertices, cs_real_t);
+
+  /* Define filtered variable array */
+
+  cs_cell_to_vertex(CS_CELL_TO_VERTEX_LR,
+                    0,
+                    _stride,
+                    true, /* ignore periodicity of rotation */
+                    cell_vol,
+                    val,
+                    NULL,
+                    v_val);
+
+  cs_cell_to_vertex(CS_CELL_TO_VERTEX_LR,
+                    0,
+                    1,
+                    true, /* ignore periodicity of rotation */
+                    NULL,
+                    cell_vol,
+                    NULL,
+                    v_weight);
+
+  /* Build cell average, accumulating in the output array rather
+     than in a local fixed-size accumulator */
+
+  const cs_adjacency_t  *c2v = cs_mesh_adjacencies_cell_vertices();
+  const cs_lnum_t *c2v_idx = c2v->idx;
+  const cs_lnum_t *c2v_ids = c2v->ids;
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cs_lnum_t s_id = c2v_idx[c_id];
+    cs_lnum_t e_id = c2v_idx[c_id+1];
+    cs_real_t _f_weight = 0;
+    cs_real_t *restrict _f_val = f_val + c_id*_stride;
+    for (cs_lnum_t k = 0; k < _stride; k++)
+      _f_val[k] = 0;
+    for (cs_lnum_t j = s_id; j < e_id; j++) {
+      cs_lnum_t v_id = c2v_ids[j];
+      const cs_real_t w = v_weight[v_id];
+      const cs_real_t *restrict _v_val = v_val + v_id*_stride;
+      for (cs_lnum_t k = 0; k < _stride; k++)
+        _f_val[k] += _v_val[k] * w;
+      _f_weight += w;
+    }
+    for (cs_lnum_t k = 0; k < _stride; k++)
+      _f_val[k] /= _f_weight;
+  }
+
+  BFT_FREE(v_weight);
+  BFT_FREE(v_val);
+
+  /* Synchronize variable */
+
+  if (mesh->halo != NULL)
+    cs_halo_sync_var_strided(mesh->halo, CS_HALO_STANDARD, f_val, _stride);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -396,6 +483,101 @@ cs_les_filter(int        stride,
     cs_halo_sync_var_strided(mesh->halo, CS_HALO_STANDARD, f_val, _stride);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute filters for dynamic models for multiple arrays at once.
+ *
+ * The arrays are packed into a single interleaved array, which is filtered
+ * in one adjacency sweep (with a single evaluation of the vertex weights
+ * and a single halo exchange), then unpacked; this is equivalent to
+ * calling \ref cs_les_filter once per array, but touches the mesh
+ * adjacency and ghost cells only once.
+ *
+ * Arrays to filter must be independent: no input array may be the
+ * output of the same call (inputs are read before outputs are written,
+ * so an output buffer may serve as input).
+ *
+ * This function deals with the standard or extended neighborhood.
+ *
+ * \param[in]   n_arrays  number of arrays to filter
+ * \param[in]   stride    stride of each array to filter
+ * \param[in]   val       arrays of values to filter
+ * \param[out]  f_val     arrays of filtered values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_multi(int          n_arrays,
+                    const int    stride[],
+                    cs_real_t   *val[],
+                    cs_real_t   *f_val[])
+{
+  if (n_arrays == 1) {
+    cs_les_filter(stride[0], val[0], f_val[0]);
+    return;
+  }
+  else if (n_arrays < 1)
+    return;
+
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_lnum_t  n_cells = mesh->n_cells;
+  const cs_lnum_t  n_cells_ext = mesh->n_cells_with_ghosts;
+
+  cs_lnum_t t_stride = 0;
+  for (int f_id = 0; f_id < n_arrays; f_id++)
+    t_stride += stride[f_id];
+
+  /* Pack values in a single interleaved array */
+
+  cs_real_t *pack = NULL, *f_pack = NULL;
+
+  BFT_MALLOC(pack, n_cells_ext*t_stride, cs_real_t);
+  BFT_MALLOC(f_pack, n_cells_ext*t_stride, cs_real_t);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cs_real_t *restrict p = pack + c_id*t_stride;
+    cs_lnum_t shift = 0;
+    for (int f_id = 0; f_id < n_arrays; f_id++) {
+      const cs_lnum_t _stride = stride[f_id];
+      const cs_real_t *restrict v = val[f_id] + c_id*_stride;
+      for (cs_lnum_t k = 0; k < _stride; k++)
+        p[shift + k] = v[k];
+      shift += _stride;
+    }
+  }
+
+# pragma omp parallel for if (mesh->n_ghost_cells > CS_THR_MIN)
+  for (cs_lnum_t i = n_cells*t_stride; i < n_cells_ext*t_stride; i++)
+    f_pack[i] = 0;
+
+  /* Filter packed array in a single sweep */
+
+  if (cs_ext_neighborhood_get_type() == CS_EXT_NEIGHBORHOOD_COMPLETE)
+    _les_filter_ext_neighborhood(t_stride, pack, f_pack);
+  else
+    _les_filter_packed(t_stride, pack, f_pack);
+
+  /* Unpack filtered values (including ghost values, synchronized
+     on the packed array) */
+
+# pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    const cs_real_t *restrict p = f_pack + c_id*t_stride;
+    cs_lnum_t shift = 0;
+    for (int f_id = 0; f_id < n_arrays; f_id++) {
+      const cs_lnum_t _stride = stride[f_id];
+      cs_real_t *restrict v = f_val[f_id] + c_id*_stride;
+      for (cs_lnum_t k = 0; k < _stride; k++)
+        v[k] = p[shift + k];
+      shift += _stride;
+    }
+  }
+
+  BFT_FREE(f_pack);
+  BFT_FREE(pack);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
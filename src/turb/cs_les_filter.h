@@ -65,6 +65,34 @@ cs_les_filter(int        stride,
               cs_real_t  val[],
               cs_real_t  f_val[]);
 
+/*----------------------------------------------------------------------------
+ * Compute filters for dynamic models for multiple arrays at once.
+ *
+ * The arrays are packed into a single interleaved array, which is filtered
+ * in one adjacency sweep (with a single evaluation of the vertex weights
+ * and a single halo exchange), then unpacked; this is equivalent to
+ * calling cs_les_filter once per array, but touches the mesh adjacency
+ * and ghost cells only once.
+ *
+ * Arrays to filter must be independent: no input array may be the
+ * output of the same call (inputs are read before outputs are written,
+ * so an output buffer may serve as input).
+ *
+ * This function deals with the standard or extended neighborhood.
+ *
+ * parameters:
+ *   n_arrays <--  number of arrays to filter
+ *   stride   <--  stride of each array to filter
+ *   val      <->  arrays of values to filter
+ *   f_val    -->  arrays of filtered values
+ *----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_multi(int          n_arrays,
+                    const int    stride[],
+                    cs_real_t   *val[],
+                    cs_real_t   *f_val[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -599,6 +599,7 @@ cs_les_inflow_finalize(void)
 
         BFT_FREE(inflow->position);
         BFT_FREE(inflow->energy);
+        BFT_FREE(inflow->geo_scale_min);
 
         BFT_FREE(inflow);
 
@@ -776,6 +777,9 @@ cs_les_inflow_add_inlet(cs_les_inflow_type_t   type,
       BFT_MALLOC(inflow->position, inflow->n_structures, cs_real_3_t);
       BFT_MALLOC(inflow->energy,   inflow->n_structures, cs_real_3_t);
 
+      inflow->geo_scale_min = NULL;
+      inflow->n_geo_points = 0;
+
       inlet->inflow = inflow;
 
       bft_printf(_("   Number of structures: %d\n\n"),n_entities);
@@ -1680,25 +1684,55 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
   }
   else{
-    for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
 
-      cs_lnum_t b_face_id = elt_ids[point_id];
-      cs_lnum_t cell_id = mesh->b_face_cells[b_face_id];
+    /* The geometric minimum eddy size only depends on the inlet mesh
+       geometry, so it is cached in the inflow structure and recomputed
+       only when the mesh coordinates may have changed. */
 
-      for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+    if (   inflow->n_geo_points != n_points
+        || mesh->time_dep >= CS_MESH_TRANSIENT_COORDS) {
 
-        cs_real_t length_scale_min = -HUGE_VAL;
+      if (inflow->n_geo_points != n_points) {
+        BFT_REALLOC(inflow->geo_scale_min, n_points, cs_real_3_t);
+        inflow->n_geo_points = n_points;
+      }
+
+      cs_real_3_t *geo_scale_min = inflow->geo_scale_min;
+
+#     pragma omp parallel for if (n_points > CS_THR_MIN)
+      for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
+
+        cs_lnum_t b_face_id = elt_ids[point_id];
+        cs_lnum_t cell_id = mesh->b_face_cells[b_face_id];
+
+        for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+
+          cs_real_t length_scale_min = -HUGE_VAL;
+
+          for (cs_lnum_t j = mesh->b_face_vtx_idx[b_face_id];
+               j < mesh->b_face_vtx_idx[b_face_id + 1];
+               j++) {
+            cs_lnum_t vtx_id = mesh->b_face_vtx_lst[j];
+            length_scale_min
+              = CS_MAX(length_scale_min,
+                       2.*CS_ABS(mq->cell_cen[3*cell_id + coo_id]
+                                 - mesh->vtx_coord[3*vtx_id + coo_id]));
+          }
+
+          geo_scale_min[point_id][coo_id] = length_scale_min;
 
-        for (cs_lnum_t j = mesh->b_face_vtx_idx[b_face_id];
-             j < mesh->b_face_vtx_idx[b_face_id + 1];
-             j++) {
-          cs_lnum_t vtx_id = mesh->b_face_vtx_lst[j];
-          length_scale_min
-            = CS_MAX(length_scale_min,
-                     2.*CS_ABS(mq->cell_cen[3*cell_id + coo_id]
-                               - mesh->vtx_coord[3*vtx_id + coo_id]));
         }
 
+      }
+
+    }
+
+    for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
+
+      for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+
+        cs_real_t length_scale_min = inflow->geo_scale_min[point_id][coo_id];
+
         length_scale[point_id][coo_id]
           = pow(1.5*rij_l[point_id ][coo_id], 1.5) / eps_l[point_id];
 
@@ -2030,30 +2064,44 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
   alpha = sqrt(box_volume / (double)inflow->n_structures);
 
+  const int n_structures = inflow->n_structures;
+  const cs_real_3_t *position = (const cs_real_3_t *)inflow->position;
+  const cs_real_3_t *energy = (const cs_real_3_t *)inflow->energy;
+
+# pragma omp parallel for if (n_points > CS_THR_MIN)
   for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
 
     cs_real_t distance[3];
 
-    for (int struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+    /* Factors of the form function depending only on the point are
+       hoisted out of the loop on the structures. */
+
+    cs_real_t ls_r[3];
+    cs_real_t ff_norm = 1.;
+
+    for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+      ls_r[coo_id] = 1./length_scale[point_id][coo_id];
+      ff_norm /= sqrt(2./3.*length_scale[point_id][coo_id]);
+    }
+
+    for (int struct_id = 0; struct_id < n_structures; struct_id++) {
 
       for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
         distance[coo_id] =
           CS_ABS(point_coordinates[point_id][coo_id]
-                 - inflow->position[struct_id][coo_id]);
+                 - position[struct_id][coo_id]);
 
       if (   distance[0] < length_scale[point_id][0]
           && distance[1] < length_scale[point_id][1]
           && distance[2] < length_scale[point_id][2]) {
 
-        cs_real_t form_function = 1.;
+        cs_real_t form_function = ff_norm;
         for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-          form_function *=
-            (1.-distance[coo_id]/length_scale[point_id][coo_id])
-            /sqrt(2./3.*length_scale[point_id][coo_id]);
+          form_function *= 1. - distance[coo_id]*ls_r[coo_id];
 
         for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
           fluctuations[point_id][coo_id]
-            += inflow->energy[struct_id][coo_id]*form_function;
+            += energy[struct_id][coo_id]*form_function;
 
       }
 
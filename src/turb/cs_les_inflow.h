@@ -80,6 +80,10 @@ typedef struct {
   cs_real_3_t  *position;      /*!< Position of the structures */
   cs_real_3_t  *energy;        /*!w Anisotropic energy of the structures */
 
+  cs_real_3_t  *geo_scale_min; /*!< Cached geometric minimum eddy size at
+                                    each inlet point (NULL if not computed) */
+  cs_lnum_t     n_geo_points;  /*!< Associated number of inlet points */
+
 } cs_inflow_sem_t;
 
 /*=============================================================================
@@ -145,9 +145,8 @@ cs_les_mu_t_smago_dyn_prepare(cs_real_t  s_n[],
   else
     cs_array_real_set_scalar(n_cells, 1.0, xro);
 
-  /* In case of constant density, xrof is 1.0 */
-
-  cs_les_filter(1, xro, xrof);
+  /* In case of constant density, xrof is 1.0
+     (filtered along with the other quantities below) */
 
   /* Calculation of velocity gradient and of
    * S11^2+S22^2+S33^2+2*(S12^2+S13^2+S23^2)
@@ -189,25 +188,9 @@ cs_les_mu_t_smago_dyn_prepare(cs_real_t  s_n[],
 
   BFT_FREE(gradv);
 
-  /* w62 temporarily contains rho*S */
-
-  cs_les_filter(6, (cs_real_t*)w62, (cs_real_t*)w61);
-
-  /* w61 <rho*S>/<rho>, sf_n is ||<rho*S>/<rho>|| */
-
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-    for (cs_lnum_t i = 0; i < 6; i++)
-      w61[c_id][i] /= xrof[c_id];
-
-    sf_n[c_id] =
-      sqrt(2. * cs_math_sym_33_sym_33_product_trace(w61[c_id], w61[c_id]));
-  }
-
   /* Here mij contains Sij^d
    *   S_n  contains ||S||
-   *       sqrt(2)*sqrt(S11^2+S22^2+S33^2+2(S12^2+S13^2+S23^2))
-   *   Sf_n contains ||SF||
-   *       sqrt(2)*sqrt(S11F^2+S22F^2+S33F^2+2(S12F^2+S13F^2+S23F^2)) */
+   *       sqrt(2)*sqrt(S11^2+S22^2+S33^2+2(S12^2+S13^2+S23^2)) */
 
   /* Calculation of Mij
    * ================== */
@@ -220,8 +203,26 @@ cs_les_mu_t_smago_dyn_prepare(cs_real_t  s_n[],
       mij[c_id][ij] *= -2.0 * xro[c_id] * cs_math_pow2(delta) * s_n[c_id];
   }
 
-  /* w62 now contains <-2*rho*delta^2*||S||*S> */
-  cs_les_filter(6, (cs_real_t*)mij, (cs_real_t*)w62);
+  /* Filter rho, rho*S (temporarily in w62) and -2*rho*delta^2*||S||*S
+     in a single sweep; w62 then contains <-2*rho*delta^2*||S||*S> */
+
+  {
+    const int f_strides[] = {1, 6, 6};
+    cs_real_t *f_in[] = {xro, (cs_real_t *)w62, (cs_real_t *)mij};
+    cs_real_t *f_out[] = {xrof, (cs_real_t *)w61, (cs_real_t *)w62};
+    cs_les_filter_multi(3, f_strides, f_in, f_out);
+  }
+
+  /* w61 <rho*S>/<rho>, sf_n is ||<rho*S>/<rho>||
+   *       sqrt(2)*sqrt(S11F^2+S22F^2+S33F^2+2(S12F^2+S13F^2+S23F^2)) */
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (cs_lnum_t i = 0; i < 6; i++)
+      w61[c_id][i] /= xrof[c_id];
+
+    sf_n[c_id] =
+      sqrt(2. * cs_math_sym_33_sym_33_product_trace(w61[c_id], w61[c_id]));
+  }
 
   /* Now compute final mij value: M_ij = alpha_ij - beta_ij */
 
@@ -250,19 +251,21 @@ cs_les_mu_t_smago_dyn_prepare(cs_real_t  s_n[],
 
   /* Filtering the velocity and its square */
 
-  /* Second order moment  <rho u_i u_j> */
+  /* Second order moment  <rho u_i u_j> and <rho u_i>/rho,
+     filtered in a single sweep */
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id ++) {
     for (cs_lnum_t ij = 0; ij < 6; ij++)
       w_t[c_id][ij] = xro[c_id]*vel[c_id][_iv2t[ij]]*vel[c_id][_jv2t[ij]];
-  }
-  cs_les_filter(6, (cs_real_t*)w_t, (cs_real_t*)rho_ui_uj);
-
-  /* <rho u_i>/rho */
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id ++) {
     for (cs_lnum_t i = 0; i < 3; i++)
       w_v[c_id][i] = xro[c_id]*vel[c_id][i];
   }
-  cs_les_filter(3, (cs_real_t*)w_v, (cs_real_t*)f_vel);
+
+  {
+    const int f_strides[] = {6, 3};
+    cs_real_t *f_in[] = {(cs_real_t *)w_t, (cs_real_t *)w_v};
+    cs_real_t *f_out[] = {(cs_real_t *)rho_ui_uj, (cs_real_t *)f_vel};
+    cs_les_filter_multi(2, f_strides, f_in, f_out);
+  }
 
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id ++) {
     for (cs_lnum_t i = 0; i < 3; i++)
@@ -389,8 +392,12 @@ cs_les_mu_t_smago_dyn(void)
      denominator, then only compute  the quotient. The user can overwrite
      this in cs_user_physical_properties_turb_viscosity. */
 
-  cs_les_filter(1, w1, w3);
-  cs_les_filter(1, w2, w4);
+  {
+    const int f_strides[] = {1, 1};
+    cs_real_t *f_in[] = {w1, w2};
+    cs_real_t *f_out[] = {w3, w4};
+    cs_les_filter_multi(2, f_strides, f_in, f_out);
+  }
 
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
     if (fabs(w4[c_id]) <= cs_math_epzero)
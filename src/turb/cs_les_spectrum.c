@@ -0,0 +1,379 @@
+/*============================================================================
+ * Spectral monitoring of LES resolution along sampling lines.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_field_pointer.h"
+#include "cs_math.h"
+#include "cs_mesh_location.h"
+#include "cs_parall.h"
+#include "cs_probe.h"
+#include "cs_time_plot.h"
+#include "cs_time_step.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_les_spectrum.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local structure declarations
+ *============================================================================*/
+
+/* Spectrum monitoring line descriptor */
+
+typedef struct {
+
+  char            *name;       /* Monitoring line name */
+  cs_probe_set_t  *pset;       /* Associated probe set (shared) */
+
+  int              n_probes;   /* Number of sampling points */
+  int              n_modes;    /* Number of output modes */
+  int              interval;   /* Averaging and output interval */
+
+  cs_real_t        length;     /* Segment length */
+
+  int              n_samples;  /* Samples in current averaging period */
+  cs_real_t       *e_k;        /* Accumulated modal energies (n_modes) */
+
+  cs_real_t       *loc_s;      /* Curvilinear abscissa of local probes,
+                                  cached after location (NULL before) */
+
+  cs_time_plot_t  *plot;       /* Associated time plot (rank 0 only) */
+
+} _les_spectrum_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static int                _n_spectra = 0;
+static _les_spectrum_t  **_spectra = NULL;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Initialize the time plot associated with a spectrum monitoring line.
+ *
+ * Should only be called on rank 0.
+ *
+ * parameters:
+ *   sp <-> spectrum monitoring line
+ *----------------------------------------------------------------------------*/
+
+static void
+_init_spectrum_plot(_les_spectrum_t  *sp)
+{
+  char **labels;
+  BFT_MALLOC(labels, sp->n_modes, char *);
+
+  for (int k = 0; k < sp->n_modes; k++) {
+    BFT_MALLOC(labels[k], 32, char);
+    snprintf(labels[k], 32, "k=%d", k+1);
+  }
+
+  sp->plot = cs_time_plot_init_probe(sp->name,
+                                     "spectrum_",
+                                     CS_TIME_PLOT_CSV,
+                                     false,
+                                     180.,   /* flush time */
+                                     -1,
+                                     sp->n_modes,
+                                     NULL,
+                                     NULL,
+                                     (const char **)labels);
+
+  for (int k = 0; k < sp->n_modes; k++)
+    BFT_FREE(labels[k]);
+  BFT_FREE(labels);
+}
+
+/*----------------------------------------------------------------------------
+ * Accumulate the instantaneous velocity spectrum of a monitoring line.
+ *
+ * parameters:
+ *   sp  <-> spectrum monitoring line
+ *   vel <-- cell velocity values
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_spectrum(_les_spectrum_t    *sp,
+                 const cs_real_3_t  *vel)
+{
+  const int n_modes = sp->n_modes;
+  const cs_lnum_t n_loc = cs_probe_set_get_n_local(sp->pset);
+
+  if (sp->loc_s == NULL)
+    sp->loc_s = cs_probe_set_get_loc_curvilinear_abscissa(sp->pset);
+
+  const cs_lnum_t *elt_ids
+    = cs_probe_set_get_elt_ids(sp->pset, CS_MESH_LOCATION_CELLS);
+
+  /* Partial Fourier coefficients over local probes; the direct
+     transform distributes as a sum, so no gather is needed */
+
+  cs_real_t *c;
+  BFT_MALLOC(c, 6*n_modes, cs_real_t);
+  for (int i = 0; i < 6*n_modes; i++)
+    c[i] = 0.;
+
+  for (cs_lnum_t j = 0; j < n_loc; j++) {
+
+    const cs_real_t *u = vel[elt_ids[j]];
+    const cs_real_t theta = 2.*cs_math_pi * sp->loc_s[j] / sp->length;
+
+    for (int k = 0; k < n_modes; k++) {
+      const cs_real_t ck = cos((k+1)*theta);
+      const cs_real_t sk = sin((k+1)*theta);
+      for (int i = 0; i < 3; i++) {
+        c[6*k + 2*i]     += u[i]*ck;
+        c[6*k + 2*i + 1] -= u[i]*sk;
+      }
+    }
+
+  }
+
+  cs_parall_sum(6*n_modes, CS_REAL_TYPE, c);
+
+  /* One-sided modal kinetic energies, accumulated for time averaging */
+
+  if (cs_glob_rank_id < 1) {
+    const cs_real_t w = 1. / sp->n_probes;
+    for (int k = 0; k < n_modes; k++) {
+      cs_real_t e = 0.;
+      for (int i = 0; i < 6; i++)
+        e += cs_math_pow2(c[6*k + i] * w);
+      sp->e_k[k] += e;
+    }
+  }
+
+  sp->n_samples += 1;
+
+  BFT_FREE(c);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a velocity spectrum monitoring line.
+ *
+ * A set of sampling probes is distributed evenly along the given segment,
+ * and the one-dimensional kinetic energy spectrum of the sampled velocity
+ * is computed at each time step, averaged over the given interval, and
+ * appended to a time plot file upon each averaging period.
+ *
+ * This function should be called during the setup stage, typically from
+ * \ref cs_user_postprocess_probes.
+ *
+ * \param[in]  name          name of the monitoring line (used for output)
+ * \param[in]  start_coords  coordinates of the starting point
+ * \param[in]  end_coords    coordinates of the ending point
+ * \param[in]  n_probes      number of sampling points along the segment
+ * \param[in]  n_modes       number of output modes (capped at n_probes/2)
+ * \param[in]  interval      averaging and output interval, in time steps
+ *
+ * \return  id of the new monitoring line
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_les_spectrum_define(const char       *name,
+                       const cs_real_t   start_coords[3],
+                       const cs_real_t   end_coords[3],
+                       int               n_probes,
+                       int               n_modes,
+                       int               interval)
+{
+  if (n_probes < 2 || interval < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: monitoring line \"%s\" requires at least 2 probes\n"
+                "and an interval of at least 1 time step."),
+              __func__, name);
+
+  const int id = _n_spectra;
+
+  _n_spectra += 1;
+  BFT_REALLOC(_spectra, _n_spectra, _les_spectrum_t *);
+
+  _les_spectrum_t *sp;
+  BFT_MALLOC(sp, 1, _les_spectrum_t);
+
+  BFT_MALLOC(sp->name, strlen(name) + 1, char);
+  strcpy(sp->name, name);
+
+  sp->pset = cs_probe_set_create_from_segment(name,
+                                              n_probes,
+                                              start_coords,
+                                              end_coords);
+
+  /* Probes are sampled by this subsystem only */
+
+  cs_probe_set_auto_var(sp->pset, false);
+  cs_probe_set_associate_writers(sp->pset, 0, NULL);
+
+  sp->n_probes = n_probes;
+  sp->n_modes = CS_MIN(n_modes, n_probes/2);
+  sp->interval = interval;
+
+  sp->length = cs_math_3_distance(start_coords, end_coords);
+
+  sp->n_samples = 0;
+  BFT_MALLOC(sp->e_k, sp->n_modes, cs_real_t);
+  for (int k = 0; k < sp->n_modes; k++)
+    sp->e_k[k] = 0.;
+
+  sp->loc_s = NULL;
+  sp->plot = NULL;
+
+  _spectra[id] = sp;
+
+  return id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update spectrum monitoring lines for the current time step.
+ *
+ * This function should be called once per time step, typically from
+ * \ref cs_user_extra_operations; it does nothing if no monitoring
+ * line is defined.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_spectrum_compute(void)
+{
+  if (_n_spectra == 0)
+    return;
+
+  const cs_real_3_t *vel = (const cs_real_3_t *)CS_F_(vel)->val;
+  const cs_time_step_t *ts = cs_glob_time_step;
+
+  for (int i = 0; i < _n_spectra; i++) {
+
+    _les_spectrum_t *sp = _spectra[i];
+
+    _update_spectrum(sp, vel);
+
+    if (sp->n_samples < sp->interval)
+      continue;
+
+    if (cs_glob_rank_id < 1) {
+
+      if (sp->plot == NULL)
+        _init_spectrum_plot(sp);
+
+      cs_real_t *vals;
+      BFT_MALLOC(vals, sp->n_modes, cs_real_t);
+      for (int k = 0; k < sp->n_modes; k++)
+        vals[k] = sp->e_k[k] / sp->n_samples;
+
+      cs_time_plot_vals_write(sp->plot,
+                              ts->nt_cur,
+                              ts->t_cur,
+                              sp->n_modes,
+                              vals);
+
+      BFT_FREE(vals);
+
+    }
+
+    /* Reset averaging period */
+
+    sp->n_samples = 0;
+    for (int k = 0; k < sp->n_modes; k++)
+      sp->e_k[k] = 0.;
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free all structures related to spectrum monitoring lines.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_spectrum_finalize(void)
+{
+  for (int i = 0; i < _n_spectra; i++) {
+
+    _les_spectrum_t *sp = _spectra[i];
+
+    if (sp->plot != NULL)
+      cs_time_plot_finalize(&(sp->plot));
+
+    BFT_FREE(sp->loc_s);
+    BFT_FREE(sp->e_k);
+    BFT_FREE(sp->name);
+
+    /* The probe set itself belongs to the postprocessing subsystem */
+
+    BFT_FREE(sp);
+
+  }
+
+  BFT_FREE(_spectra);
+  _n_spectra = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
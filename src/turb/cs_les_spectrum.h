@@ -0,0 +1,101 @@
+#ifndef __CS_LES_SPECTRUM_H__
+#define __CS_LES_SPECTRUM_H__
+
+/*============================================================================
+ * Spectral monitoring of LES resolution along sampling lines.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a velocity spectrum monitoring line.
+ *
+ * A set of sampling probes is distributed evenly along the given segment,
+ * and the one-dimensional kinetic energy spectrum of the sampled velocity
+ * is computed at each time step, averaged over the given interval, and
+ * appended to a time plot file upon each averaging period.
+ *
+ * This function should be called during the setup stage, typically from
+ * \ref cs_user_postprocess_probes.
+ *
+ * \param[in]  name          name of the monitoring line (used for output)
+ * \param[in]  start_coords  coordinates of the starting point
+ * \param[in]  end_coords    coordinates of the ending point
+ * \param[in]  n_probes      number of sampling points along the segment
+ * \param[in]  n_modes       number of output modes (capped at n_probes/2)
+ * \param[in]  interval      averaging and output interval, in time steps
+ *
+ * \return  id of the new monitoring line
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_les_spectrum_define(const char       *name,
+                       const cs_real_t   start_coords[3],
+                       const cs_real_t   end_coords[3],
+                       int               n_probes,
+                       int               n_modes,
+                       int               interval);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update spectrum monitoring lines for the current time step.
+ *
+ * This function should be called once per time step, typically from
+ * \ref cs_user_extra_operations; it does nothing if no monitoring
+ * line is defined.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_spectrum_compute(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free all structures related to spectrum monitoring lines.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_spectrum_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_LES_SPECTRUM_H__ */
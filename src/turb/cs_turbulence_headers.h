@@ -33,6 +33,7 @@
 #include "cs_les_filter.h"
 #include "cs_les_inflow.h"
 #include "cs_les_mu_t.h"
+#include "cs_les_spectrum.h"
 #include "cs_turbulence_bc.h"
 #include "cs_turbulence_inflow.h"
 #include "cs_turbulence_init.h"
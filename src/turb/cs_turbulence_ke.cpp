@@ -51,6 +51,7 @@
 #include "cs_balance.h"
 #include "cs_blas.h"
 #include "cs_convection_diffusion.h"
+#include "cs_dispatch.h"
 #include "cs_equation.h"
 #include "cs_equation_iterative_solve.h"
 #include "cs_face_viscosity.h"
@@ -545,6 +546,8 @@ cs_turbulence_ke(int              phase_id,
   const cs_real_t d1s3 = 1./3.;
   const cs_real_t d1s2 = 1./2.;
 
+  cs_dispatch_context ctx;
+
   /* Advanced reinitialization
      ========================= */
 
@@ -674,8 +677,7 @@ cs_turbulence_ke(int              phase_id,
      divu   = trace of the velocity gradient
      = dudx + dvdy + dwdz */
 
-# pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
 
     strain_sq[c_id] = 2.
       * (  cs_math_pow2(  d2s3*gradv[c_id][0][0]
@@ -692,26 +694,28 @@ cs_turbulence_ke(int              phase_id,
       + cs_math_pow2(gradv[c_id][1][2] + gradv[c_id][2][1]);
 
     divu[c_id] = gradv[c_id][0][0] + gradv[c_id][1][1] + gradv[c_id][2][2];
-  }
+  });
 
   /* Compute the square root of the strain and the turbulent
      kinetic energy for Launder-Sharma k-epsilon source terms */
   if (cs_glob_turb_model->iturb == CS_TURB_K_EPSILON_LS) {
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
       strain[c_id] = sqrt(strain_sq[c_id]);
       sqrt_k[c_id] = sqrt(fabs(cvar_k[c_id]));
-    }
+    });
   }
 
   /* Unsteady terms (stored in tinstk and tinste)
      ============================================ */
 
-# pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+  const int istat_k = eqp_k->istat;
+  const int istat_eps = eqp_eps->istat;
+
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
     cs_real_t romvsd = crom[c_id] * cell_f_vol[c_id] / dt[c_id];
-    tinstk[c_id] = eqp_k->istat*romvsd;
-    tinste[c_id] = eqp_eps->istat*romvsd;
-  }
+    tinstk[c_id] = istat_k*romvsd;
+    tinste[c_id] = istat_eps*romvsd;
+  });
 
   /* Compute the first part of the production term: muT (S^D)**2
    * Going out of the step we keep strain_sq, divu,
@@ -722,29 +726,36 @@ cs_turbulence_ke(int              phase_id,
    * not in mu_TxS**2 */
 
   cs_field_t *f_tke_prod = cs_field_by_name_try("algo:tke_production");
+  cs_real_t *tke_prod = (f_tke_prod != NULL) ? f_tke_prod->val : NULL;
 
   if (cs_glob_turb_model->iturb == CS_TURB_K_EPSILON_LIN_PROD) {
-#   pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_real_t cmu = cs_turb_cmu;
+    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
       cs_real_t rho    = cromo[c_id];
       cs_real_t xs     = sqrt(strain_sq[c_id]);
-      cs_real_t cmueta = fmin(cs_turb_cmu*cvara_k[c_id]/cvara_ep[c_id]*xs,
+      cs_real_t cmueta = fmin(cmu*cvara_k[c_id]/cvara_ep[c_id]*xs,
                               sqrcmu);
       smbrk[c_id] = rho*cmueta*xs*cvara_k[c_id];
       smbre[c_id] = smbrk[c_id];
-    }
+    });
     /* Save production for post processing */
-    if (f_tke_prod != NULL) {
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
-        f_tke_prod->val[c_id] = smbrk[c_id] / cromo[c_id];
+    if (tke_prod != NULL) {
+      ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+        tke_prod[c_id] = smbrk[c_id] / cromo[c_id];
+      });
     }
   }
   else if (cs_glob_turb_model->iturb == CS_TURB_K_EPSILON_QUAD) {
 
     /* Turbulent production for the quadratic Baglietto k-epsilon model  */
 
-#   pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_real_t cnl1 = cs_turb_cnl1;
+    const cs_real_t cnl2 = cs_turb_cnl2;
+    const cs_real_t cnl3 = cs_turb_cnl3;
+    const cs_real_t cnl4 = cs_turb_cnl4;
+    const cs_real_t cnl5 = cs_turb_cnl5;
+
+    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
 
       cs_real_t xstrai[3][3], xrotac[3][3];
 
@@ -799,12 +810,9 @@ cs_turbulence_ke(int              phase_id,
       cs_real_t xcmu = d2s3/(3.9 + xss);
 
       /* Evaluating "constants" */
-      cs_real_t xqc1 = cs_turb_cnl1/((  cs_turb_cnl4
-                                      + cs_turb_cnl5*cs_math_pow3(xss))*xcmu);
-      cs_real_t xqc2 = cs_turb_cnl2/((  cs_turb_cnl4
-                                      + cs_turb_cnl5*cs_math_pow3(xss))*xcmu);
-      cs_real_t xqc3 = cs_turb_cnl3/((  cs_turb_cnl4
-                                      + cs_turb_cnl5*cs_math_pow3(xss))*xcmu);
+      cs_real_t xqc1 = cnl1/((cnl4 + cnl5*cs_math_pow3(xss))*xcmu);
+      cs_real_t xqc2 = cnl2/((cnl4 + cnl5*cs_math_pow3(xss))*xcmu);
+      cs_real_t xqc3 = cnl3/((cnl4 + cnl5*cs_math_pow3(xss))*xcmu);
 
       /* Evaluating the turbulent production */
       smbrk[c_id] =   visct*strain_sq[c_id]
@@ -812,31 +820,33 @@ cs_turbulence_ke(int              phase_id,
                     - 4.*xqc2*visct*xttke* (wkskjsji + skiwjksji)
                     - 4.*xqc3*visct*xttke* (wkwjksji - d1s3*wijwij*divu[c_id]);
       smbre[c_id] = smbrk[c_id];
-    } /* End loop on cells */
+    }); /* End loop on cells */
 
     /* Save production for post processing */
-    if (f_tke_prod != NULL) {
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
-        f_tke_prod->val[c_id] = smbrk[c_id] / crom[c_id];
+    if (tke_prod != NULL) {
+      ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+        tke_prod[c_id] = smbrk[c_id] / crom[c_id];
+      });
     }
 
     /* End test on specific k-epsilon model
        In the general case Pk = mu_t*SijSij */
   }
   else {
-#   pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
       smbrk[c_id] = cpro_pcvto[c_id] * strain_sq[c_id];
       smbre[c_id] = smbrk[c_id];
-    }
+    });
     /* Save production for post processing */
-    if (f_tke_prod != NULL) {
-#     pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
-        f_tke_prod->val[c_id] = smbrk[c_id] / crom[c_id];
+    if (tke_prod != NULL) {
+      ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+        tke_prod[c_id] = smbrk[c_id] / crom[c_id];
+      });
     }
   }
 
+  ctx.wait();
+
   /* Take into account rotation/curvature correction, if necessary
      ============================================================ */
 
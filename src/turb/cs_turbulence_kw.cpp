@@ -50,6 +50,7 @@
 #include "cs_blas.h"
 #include "cs_halo.h"
 #include "cs_base.h"
+#include "cs_dispatch.h"
 #include "cs_equation.h"
 #include "cs_equation_iterative_solve.h"
 #include "cs_face_viscosity.h"
@@ -209,16 +210,16 @@ cs_turbulence_kw(int              phase_id,
   cs_real_t *tinstk, *tinstw, *xf1;
   CS_MALLOC_HD(tinstk, n_cells_ext, cs_real_t, cs_alloc_mode);
   CS_MALLOC_HD(tinstw, n_cells_ext, cs_real_t, cs_alloc_mode);
-  BFT_MALLOC(xf1, n_cells_ext, cs_real_t);
+  CS_MALLOC_HD(xf1, n_cells_ext, cs_real_t, cs_alloc_mode);
 
   /* Allocate work arrays */
 
   cs_real_t *w1, *dpvar, *gdkgdw, *prodk, *prodw;
   CS_MALLOC_HD(dpvar, n_cells_ext, cs_real_t, cs_alloc_mode);
   BFT_MALLOC(w1, n_cells_ext, cs_real_t);
-  BFT_MALLOC(gdkgdw, n_cells_ext, cs_real_t);
-  BFT_MALLOC(prodk, n_cells_ext, cs_real_t);
-  BFT_MALLOC(prodw, n_cells_ext, cs_real_t);
+  CS_MALLOC_HD(gdkgdw, n_cells_ext, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(prodk, n_cells_ext, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(prodw, n_cells_ext, cs_real_t, cs_alloc_mode);
 
   cs_real_t *s2pw2 = NULL;
   cs_real_t *maxgdsv = NULL;
@@ -417,6 +418,8 @@ cs_turbulence_kw(int              phase_id,
   const double d2s3 = 2./3.;
   const cs_real_t epz2 = cs_math_pow2(cs_math_epzero);
 
+  cs_dispatch_context ctx;
+
   /* Compute dk/dxj.dw/dxj stored in gdkgdw
      ====================================== */
 
@@ -574,9 +577,10 @@ cs_turbulence_kw(int              phase_id,
     htles_kwsst_f1 = cs_field_by_name("f1_kwsst")->val;
   }
 
-# pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
     gdkgdw[c_id] = cs_math_3_dot_product(gradk[c_id], grado[c_id]);
+  });
+  ctx.wait();
 
   /* Free memory */
   CS_FREE_HD(gradk);
@@ -592,80 +596,87 @@ cs_turbulence_kw(int              phase_id,
      -> but the effect on "constants" is small
      -> to remember if we really use second-order in time in k-omega */
 
-# pragma omp parallel if(n_cells_ext > CS_THR_MIN)
-  {
-#   pragma omp for nowait
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      cs_real_t ro = cromo[c_id];
-      cs_real_t xnu = cpro_pcvlo[c_id]/ro;
-      cs_real_t xk = cvara_k[c_id];
-      cs_real_t xw  = cvara_omg[c_id];
-      cs_real_t cdkw = 2*ro/cs_turb_ckwsw2/xw*gdkgdw[c_id];
-      cdkw = fmax(cdkw, 1.e-20);
-      cs_real_t distf = fmax(w_dist[c_id], cs_math_epzero);
-      cs_real_t xarg1 = fmax(sqrt(xk)/cs_turb_cmu/xw/distf,
-                             500.*xnu/xw/cs_math_pow2(distf));
-      xarg1 = fmin(xarg1,
-                   4.*ro*xk/cs_turb_ckwsw2/cdkw/cs_math_pow2(distf));
-      xf1[c_id] = tanh(cs_math_pow4(xarg1));
-      if (cs_glob_turb_model->hybrid_turb == 4) {
-        htles_kwsst_f1[c_id] = xf1[c_id];
-      }
+  const int hybrid_turb = cs_glob_turb_model->hybrid_turb;
+  const cs_real_t cmu = cs_turb_cmu;
+  const cs_real_t ckwsw2 = cs_turb_ckwsw2;
+
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    cs_real_t ro = cromo[c_id];
+    cs_real_t xnu = cpro_pcvlo[c_id]/ro;
+    cs_real_t xk = cvara_k[c_id];
+    cs_real_t xw  = cvara_omg[c_id];
+    cs_real_t cdkw = 2*ro/ckwsw2/xw*gdkgdw[c_id];
+    cdkw = fmax(cdkw, 1.e-20);
+    cs_real_t distf = fmax(w_dist[c_id], cs_math_epzero);
+    cs_real_t xarg1 = fmax(sqrt(xk)/cmu/xw/distf,
+                           500.*xnu/xw/cs_math_pow2(distf));
+    xarg1 = fmin(xarg1,
+                 4.*ro*xk/ckwsw2/cdkw/cs_math_pow2(distf));
+    xf1[c_id] = tanh(cs_math_pow4(xarg1));
+    if (hybrid_turb == 4) {
+      htles_kwsst_f1[c_id] = xf1[c_id];
     }
+  });
 
-    /* Unsteady terms (stored in tinstk and tinstw)
-       ============================================ */
-
-#   pragma omp for nowait
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      cs_real_t romvsd = crom[c_id]*cell_f_vol[c_id]/dt[c_id];
-      tinstk[c_id] += eqp_k->istat*romvsd;
-      tinstw[c_id] += eqp_w->istat*romvsd;
-    }
+  /* Unsteady terms (stored in tinstk and tinstw)
+     ============================================ */
 
-    /* Compute production terms
-     * ========================
-     *
-     * stored in: prodk,prodw
-     * At the end of this step, we keep gdkgdw, xf1, prodk, tinstW */
+  const int istat_k = eqp_k->istat;
+  const int istat_w = eqp_w->istat;
 
-#   pragma omp for nowait
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    cs_real_t romvsd = crom[c_id]*cell_f_vol[c_id]/dt[c_id];
+    tinstk[c_id] += istat_k*romvsd;
+    tinstw[c_id] += istat_w*romvsd;
+  });
 
-      cs_real_t xk   = cvara_k[c_id];
-      cs_real_t xw   = cvara_omg[c_id];
-      cs_real_t xeps = cs_turb_cmu*xw*xk;
-      cs_real_t visct = cpro_pcvto[c_id];
-      /* k / (mu_T * omega) , clipped to 1 if mu_t is zero */
-      if (cs_glob_turb_model->hybrid_turb == 4) {
-        xeps = cs_turb_cmu*xw*xk*psi[c_id];
-      }
+  /* Compute production terms
+   * ========================
+   *
+   * stored in: prodk,prodw
+   * At the end of this step, we keep gdkgdw, xf1, prodk, tinstW */
+
+  const cs_real_t ckwgm1 = cs_turb_ckwgm1;
+  const cs_real_t ckwgm2 = cs_turb_ckwgm2;
+  const cs_real_t ckwc1 = cs_turb_ckwc1;
+
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+
+    cs_real_t xk   = cvara_k[c_id];
+    cs_real_t xw   = cvara_omg[c_id];
+    cs_real_t xeps = cmu*xw*xk;
+    cs_real_t visct = cpro_pcvto[c_id];
+    /* k / (mu_T * omega) , clipped to 1 if mu_t is zero */
+    if (hybrid_turb == 4) {
+      xeps = cmu*xw*xk*psi[c_id];
+    }
 
-      cs_real_t k_dmut_dom;
-      if (visct*xw <= cs_math_epzero*xk)
-        k_dmut_dom = 1.;
-      else
-        k_dmut_dom = xk / (visct*xw);
+    cs_real_t k_dmut_dom;
+    if (visct*xw <= cs_math_epzero*xk)
+      k_dmut_dom = 1.;
+    else
+      k_dmut_dom = xk / (visct*xw);
 
-      cs_real_t ro = cromo[c_id];
-      prodw[c_id] = visct*cpro_s2kw[c_id] - d2s3*ro*xk*cpro_divukw[c_id];
+    cs_real_t ro = cromo[c_id];
+    prodw[c_id] = visct*cpro_s2kw[c_id] - d2s3*ro*xk*cpro_divukw[c_id];
 
-      /* The negative part is implicit */
-      cs_real_t xxf1   = xf1[c_id];
-      cs_real_t xgamma = xxf1*cs_turb_ckwgm1 + (1.-xxf1)*cs_turb_ckwgm2;
-      tinstw[c_id] += fmax(  d2s3*ro*cell_f_vol[c_id]
-                           * (ro*xgamma*k_dmut_dom)*cpro_divukw[c_id], 0.);
+    /* The negative part is implicit */
+    cs_real_t xxf1   = xf1[c_id];
+    cs_real_t xgamma = xxf1*ckwgm1 + (1.-xxf1)*ckwgm2;
+    tinstw[c_id] += fmax(  d2s3*ro*cell_f_vol[c_id]
+                         * (ro*xgamma*k_dmut_dom)*cpro_divukw[c_id], 0.);
 
-      /* Take the min between prodw and the low Reynolds one */
-      if (prodw[c_id] > cs_turb_ckwc1*ro*xeps) {
-        prodk[c_id] = cs_turb_ckwc1*ro*xeps;
-      }
-      else {
-        prodk[c_id] = prodw[c_id];
-        tinstk[c_id] += fmax(d2s3*cell_f_vol[c_id]*ro*cpro_divukw[c_id], 0.);
-      }
+    /* Take the min between prodw and the low Reynolds one */
+    if (prodw[c_id] > ckwc1*ro*xeps) {
+      prodk[c_id] = ckwc1*ro*xeps;
     }
-  }
+    else {
+      prodk[c_id] = prodw[c_id];
+      tinstk[c_id] += fmax(d2s3*cell_f_vol[c_id]*ro*cpro_divukw[c_id], 0.);
+    }
+  });
+
+  ctx.wait();
 
   /* Take into account rotation/curvature correction, if necessary
      ============================================================ */
@@ -775,7 +786,7 @@ cs_turbulence_kw(int              phase_id,
                          0,
                          1,             /* w_stride */
                          eqp_k->verbosity,
-                         eqp_k->imligr,
+                         (cs_gradient_limit_t)(eqp_k->imligr),
                          eqp_k->epsrgr,
                          eqp_k->climgr,
                          NULL,
@@ -1038,7 +1049,7 @@ cs_turbulence_kw(int              phase_id,
   } /* End of OpenMP section */
 
   /* Free memory */
-  BFT_FREE(gdkgdw);
+  CS_FREE_HD(gdkgdw);
 
   /* Account for Lagrangian 2-way coupling source terms
      -------------------------------------------------- */
@@ -1694,14 +1705,14 @@ cs_turbulence_kw(int              phase_id,
   CS_FREE_HD(tinstw);
   CS_FREE_HD(dpvar);
 
-  BFT_FREE(xf1);
+  CS_FREE_HD(xf1);
   BFT_FREE(w1);
   BFT_FREE(grad_dot_g);
   BFT_FREE(usimpk);
   BFT_FREE(usimpw);
 
-  BFT_FREE(prodk);
-  BFT_FREE(prodw);
+  CS_FREE_HD(prodk);
+  CS_FREE_HD(prodw);
 
   BFT_FREE(s2pw2);
   BFT_FREE(maxgdsv);
@@ -993,12 +993,15 @@ _pre_solve_lrr(const cs_field_t  *f_rij,
 
   BFT_FREE(c_is_solid_zone_flag);
 
+  /* The following terms are simply added to the extrapolated source
+     terms or to the right-hand side, so accumulate them through a
+     single destination pointer rather than branching in each loop. */
+
+  cs_real_6_t *rhs_st = (st_prv_id > -1) ? c_st_prv : rhs;
+
   /* Coriolis terms in the Phi1 and production
    * ----------------------------------------- */
 
-  cs_real_6_t *w2;
-  BFT_MALLOC(w2, n_cells_ext, cs_real_6_t);
-
   if ((icorio == 1) || (tm_model == 1)) {
 
     const int *irotce = cs_turbomachinery_get_cell_rotor_num();
@@ -1017,35 +1020,29 @@ _pre_solve_lrr(const cs_field_t  *f_rij,
       const cs_rotation_t *r = cs_glob_rotation + rot_id;
       cs_rotation_coriolis_t(r, 1., matrot);
 
+      cs_real_t gij[6];
+
       /* Compute Gij: (i,j) component of the Coriolis production */
       for (cs_lnum_t iii = 0; iii < 6; iii++) {
         cs_lnum_t ii = _iv2t[iii];
         cs_lnum_t jj = _jv2t[iii];
 
-        w2[c_id][iii] = 0.;
+        gij[iii] = 0.;
         for (cs_lnum_t kk = 0; kk < 3; kk++)
-          w2[c_id][iii] -=   ccorio
-                           * (  matrot[kk][ii] * cvara_var[c_id][_t2v[kk][jj]]
-                              + matrot[kk][jj] * cvara_var[c_id][_t2v[kk][ii]]);
+          gij[iii] -=   ccorio
+                      * (  matrot[kk][ii] * cvara_var[c_id][_t2v[kk][jj]]
+                         + matrot[kk][jj] * cvara_var[c_id][_t2v[kk][ii]]);
       }
 
       /* Coriolis contribution in the Phi1 term: (1-C2/2)Gij */
       if (icorio == 1) {
         for (cs_lnum_t ii = 0; ii < 6; ii++)
-          w2[c_id][ii] =   crom[c_id] * cell_f_vol[c_id]
-                         * (1.-0.5*crij2) * w2[c_id][ii];
+          gij[ii] =   crom[c_id] * cell_f_vol[c_id]
+                    * (1.-0.5*crij2) * gij[ii];
       }
 
-      /* If source terms are extrapolated */
-      if (st_prv_id > -1) {
-        for (cs_lnum_t ii = 0; ii < 6; ii++)
-          c_st_prv[c_id][ii] += w2[c_id][ii];
-      }
-      /* Otherwise, directly in rhs */
-      else {
-        for (cs_lnum_t ii = 0; ii < 6; ii++)
-          rhs[c_id][ii] += w2[c_id][ii];
-      }
+      for (cs_lnum_t ii = 0; ii < 6; ii++)
+        rhs_st[c_id][ii] += gij[ii];
 
     } /* End of loop on cells */
 
@@ -1056,22 +1053,19 @@ _pre_solve_lrr(const cs_field_t  *f_rij,
 
   if (cs_glob_turb_rans_model->irijec == 1) { // todo
 
+    cs_real_6_t *w2;
+    BFT_MALLOC(w2, n_cells_ext, cs_real_6_t);
+
     cs_array_real_fill_zero(6*n_cells, (cs_real_t*)w2);
 
     _rij_echo(phase_id, produc, w2);
 
-    /* If we extrapolate the source terms: c_st_prv */
-    if (st_prv_id > -1)
-      cs_axpy(n_cells*6, 1., (cs_real_t *)w2, (cs_real_t *)c_st_prv);
+    cs_axpy(n_cells*6, 1., (cs_real_t *)w2, (cs_real_t *)rhs_st);
 
-    /* Otherwise rhs */
-    else
-      cs_axpy(n_cells*6, 1., (cs_real_t *)w2, (cs_real_t *)rhs);
+    BFT_FREE(w2);
 
   }
 
-  BFT_FREE(w2);
-
   /* Buoyancy source term
    * -------------------- */
 
@@ -1090,21 +1084,10 @@ _pre_solve_lrr(const cs_field_t  *f_rij,
 
     _gravity_st_rij(up_rhop, cpro_buoyancy);
 
-    /* If we extrapolate the source terms: previous ST */
-    if (st_prv_id > -1) {
-#     pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        for (cs_lnum_t ii = 0; ii < 6; ii++)
-          c_st_prv[c_id][ii] += cpro_buoyancy[c_id][ii] * cell_f_vol[c_id];
-      }
-    }
-    /* Otherwise RHS */
-    else {
-#     pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        for (cs_lnum_t ii = 0; ii < 6; ii++)
-          rhs[c_id][ii] += cpro_buoyancy[c_id][ii] * cell_f_vol[c_id];
-      }
+#   pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      for (cs_lnum_t ii = 0; ii < 6; ii++)
+        rhs_st[c_id][ii] += cpro_buoyancy[c_id][ii] * cell_f_vol[c_id];
     }
 
     BFT_FREE(_buoyancy);
@@ -1397,12 +1380,15 @@ _pre_solve_lrr_sg(const cs_field_t  *f_rij,
 
   BFT_FREE(c_is_solid_zone_flag);
 
+  /* The following terms are simply added to the extrapolated source
+     terms or to the right-hand side, so accumulate them through a
+     single destination pointer rather than branching in each loop. */
+
+  cs_real_6_t *rhs_st = (st_prv_id > -1) ? c_st_prv : rhs;
+
   /* Coriolis terms in the Phi1 and production
    * -----------------------------------------*/
 
-  cs_real_6_t *w2;
-  BFT_MALLOC(w2, n_cells_ext, cs_real_6_t);
-
   if (icorio == 1 || tm_model == CS_TURBOMACHINERY_FROZEN) {
     const int *irotce = cs_turbomachinery_get_cell_rotor_num();
 
@@ -1421,34 +1407,28 @@ _pre_solve_lrr_sg(const cs_field_t  *f_rij,
       const cs_rotation_t *r = cs_glob_rotation + rot_id;
       cs_rotation_coriolis_t(r, 1., matrot);
 
+      cs_real_t gij[6];
+
       /* Compute Gij: (i,j) component of the Coriolis production */
       for (cs_lnum_t iii = 0; iii < 6; iii++) {
         cs_lnum_t ii = _iv2t[iii];
         cs_lnum_t jj = _jv2t[iii];
 
-        w2[c_id][iii] = 0.;
+        gij[iii] = 0.;
         for (cs_lnum_t kk = 0; kk < 3; kk++)
-          w2[c_id][iii] -=   ccorio
-                           * (  matrot[kk][ii]*cvara_var[c_id][_t2v[kk][jj]]
-                              + matrot[kk][jj]*cvara_var[c_id][_t2v[kk][ii]]);
+          gij[iii] -=   ccorio
+                      * (  matrot[kk][ii]*cvara_var[c_id][_t2v[kk][jj]]
+                         + matrot[kk][jj]*cvara_var[c_id][_t2v[kk][ii]]);
       }
 
       /* Coriolis contribution in the Phi1 term: (1-C2/2)Gij */
       if (icorio == 1) {
         for (cs_lnum_t ii = 0; ii < 6; ii++)
-          w2[c_id][ii] *= crom[c_id] * cell_f_vol[c_id ]* (1.-0.5*cs_turb_crij2);
+          gij[ii] *= crom[c_id] * cell_f_vol[c_id] * (1.-0.5*cs_turb_crij2);
       }
 
-      /* If source terms are extrapolated */
-      if (st_prv_id > -1) {
-        for (cs_lnum_t ii = 0; ii < 6; ii++)
-          c_st_prv[c_id][ii] += w2[c_id][ii];
-      }
-      /* Otherwise, directly in RHS */
-      else {
-        for (cs_lnum_t ii = 0; ii < 6; ii++)
-          rhs[c_id][ii] += w2[c_id][ii];
-      }
+      for (cs_lnum_t ii = 0; ii < 6; ii++)
+        rhs_st[c_id][ii] += gij[ii];
 
     } /* End of loop on cells */
 
@@ -1459,22 +1439,19 @@ _pre_solve_lrr_sg(const cs_field_t  *f_rij,
 
   if (cs_glob_turb_rans_model->irijec == 1) { // todo
 
+    cs_real_6_t *w2;
+    BFT_MALLOC(w2, n_cells_ext, cs_real_6_t);
+
     cs_array_real_fill_zero(6*n_cells, (cs_real_t*)w2);
 
     _rij_echo(phase_id, produc, w2);
 
-    /* If we extrapolate the source terms: c_st_prv */
-    if (st_prv_id > -1)
-      cs_axpy(n_cells*6, 1., (cs_real_t *)w2, (cs_real_t *)c_st_prv);
+    cs_axpy(n_cells*6, 1., (cs_real_t *)w2, (cs_real_t *)rhs_st);
 
-    /* Otherwise rhs */
-    else
-      cs_axpy(n_cells*6, 1., (cs_real_t *)w2, (cs_real_t *)rhs);
+    BFT_FREE(w2);
 
   }
 
-  BFT_FREE(w2);
-
   /* Buoyancy source term
    * -------------------- */
 
@@ -1493,21 +1470,10 @@ _pre_solve_lrr_sg(const cs_field_t  *f_rij,
 
     _gravity_st_rij(up_rhop, cpro_buoyancy);
 
-    /* If we extrapolate the source terms: previous ST */
-    if (st_prv_id > -1) {
-#     pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        for (cs_lnum_t ii = 0; ii < 6; ii++)
-          c_st_prv[c_id][ii] += cpro_buoyancy[c_id][ii] * cell_f_vol[c_id];
-      }
-    }
-    /* Otherwise RHS */
-    else {
-#     pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        for (cs_lnum_t ii = 0; ii < 6; ii++)
-          rhs[c_id][ii] += cpro_buoyancy[c_id][ii] * cell_f_vol[c_id];
-      }
+#   pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      for (cs_lnum_t ii = 0; ii < 6; ii++)
+        rhs_st[c_id][ii] += cpro_buoyancy[c_id][ii] * cell_f_vol[c_id];
     }
 
     BFT_FREE(_buoyancy);
@@ -1717,10 +1683,6 @@ _pre_solve_ssg(const cs_field_t  *f_rij,
 
   const int *irotce = cs_turbomachinery_get_cell_rotor_num();
 
-  cs_real_t *w1, *w2;
-  BFT_MALLOC(w1, n_cells_ext, cs_real_t);
-  BFT_MALLOC(w2, n_cells_ext, cs_real_t);
-
   cs_lnum_t solid_stride = 1;
   int *c_is_solid_zone_flag = cs_solid_zone_flag(cs_glob_mesh);
   const int c_is_solid_ref[1] = {0};
@@ -1968,14 +1930,16 @@ _pre_solve_ssg(const cs_field_t  *f_rij,
        * We do not implicit the term with Cs1*aij or Cr1*P*aij.
        * Otherwise, we put all in rhs and we can implicit Cs1*aij
        * and Cr1*P*aij. Here we store the right-hand-side and the
-       * implicit term in w1 and w2, to avoid the test (st_prv_id >= 0)
-       * in the loop on cells.
-       * In the term with w1, which is set to be extrapolated, we use cromo.
+       * implicit term in the w_rhs and w_impl local accumulators.
+       * In the term with w_rhs, which is set to be extrapolated, we use
+       * cromo.
        * The implicitation of the two terms can also be done in the case of
        * extrapolation, by isolating those two terms and by putting it in
        * the RHS but not in the prev. ST and by using ipcrom ....
        * to be modified if needed. */
 
+      cs_real_t w_rhs, w_impl = 0;
+
       if (cs_glob_turb_model->iturb == CS_TURB_RIJ_EPSILON_SSG) {
 
         /* Explicit terms */
@@ -1991,13 +1955,13 @@ _pre_solve_ssg(const cs_field_t  *f_rij,
                                  + cssgr5*trrij * aikrjk;
         const cs_real_t epsij = -d2s3 * cvara_ep[c_id] * deltij[ij];
 
-        w1[c_id] =   cromo[c_id] * cell_f_vol[c_id]
-                   * (pij + phiij1 + phiij2 + epsij);
+        w_rhs =   cromo[c_id] * cell_f_vol[c_id]
+                * (pij + phiij1 + phiij2 + epsij);
 
         /* Implicit terms */
-        w2[c_id] =  crom[c_id] * cell_f_vol[c_id] / trrij
-                  * (  cssgs1 * cvara_ep[c_id]
-                     + cssgr1 * cs_math_fmax(trprod, 0));
+        w_impl =  crom[c_id] * cell_f_vol[c_id] / trrij
+                * (  cssgs1 * cvara_ep[c_id]
+                   + cssgr1 * cs_math_fmax(trprod, 0));
 
       }
       else { /* cs_glob_turb_model->iturb == CS_TURB_RIJ_EPSILON_EBRSM */
@@ -2039,10 +2003,10 @@ _pre_solve_ssg(const cs_field_t  *f_rij,
          * - (1-\alpha^3)\e_{ij}^w   - \alpha^3\e_{ij}^h  ]\f$ --> W1 */
         const cs_real_t  alpha3 = cs_math_pow3(cvar_al[c_id]);
 
-        w1[c_id] =    crom[c_id] * cell_f_vol[c_id]
-                   * (  xprod[j][i]
-                      + (1-alpha3) * phiijw + alpha3 * (phiij1+phiij2)
-                      - (1-alpha3) * epsijw - alpha3 * epsij);
+        w_rhs =    crom[c_id] * cell_f_vol[c_id]
+                * (  xprod[j][i]
+                   + (1-alpha3) * phiijw + alpha3 * (phiij1+phiij2)
+                   - (1-alpha3) * epsijw - alpha3 * epsij);
 
         /* Implicit terms */
         cs_real_t  epsijw_imp = 0; // FIXME
@@ -2052,19 +2016,19 @@ _pre_solve_ssg(const cs_field_t  *f_rij,
         /* The term below corresponds to the implicit part of SSG
          * in the context of elliptical weighting, it is multiplied by
          * \f$ \alpha^3 \f$*/
-        w2[c_id] = crom[c_id] * cell_f_vol[c_id]
-                   * (  cebms1 * cvara_ep[c_id] / trrij * alpha3
-                      + cebmr1 * cs_math_fmax(trprod/trrij, 0) * alpha3
-                      + epsijw_imp);
+        w_impl = crom[c_id] * cell_f_vol[c_id]
+                 * (  cebms1 * cvara_ep[c_id] / trrij * alpha3
+                    + cebmr1 * cs_math_fmax(trprod/trrij, 0) * alpha3
+                    + epsijw_imp);
 
       } /* End of test on turbulence model */
 
       if (st_prv_id > -1) {
-        c_st_prv[c_id][ij] += w1[c_id];
+        c_st_prv[c_id][ij] += w_rhs;
       }
       else {
-        rhs[c_id][ij] += w1[c_id];
-        rovsdt[c_id][ij][ij] += w2[c_id];
+        rhs[c_id][ij] += w_rhs;
+        rovsdt[c_id][ij][ij] += w_impl;
 
         if (coupled_components != 0) {
           for (cs_lnum_t jj = 0; jj < 6; jj++)
@@ -2078,8 +2042,6 @@ _pre_solve_ssg(const cs_field_t  *f_rij,
 
   BFT_FREE(grad_al);
 
-  BFT_FREE(w2);
-
   /* Buoyancy source term
    * -------------------- */
 
@@ -2098,21 +2060,14 @@ _pre_solve_ssg(const cs_field_t  *f_rij,
 
     _gravity_st_rij(up_rhop, cpro_buoyancy);
 
-    /* If we extrapolate the source terms: previous ST */
-    if (st_prv_id > -1) {
-#     pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
-        for (cs_lnum_t ii = 0; ii < 6; ii++)
-          c_st_prv[c_id][ii] += cpro_buoyancy[c_id][ii] * cell_f_vol[c_id];
-    }
-    /* Otherwise RHS */
-    else {
-#     pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        for (cs_lnum_t ii = 0; ii < 6; ii++) {
-          rhs[c_id][ii] += cpro_buoyancy[c_id][ii] * cell_f_vol[c_id];
-        }
-      }
+    /* Accumulate in the extrapolated source terms if present,
+       in the right-hand side otherwise. */
+    cs_real_6_t *rhs_st = (st_prv_id > -1) ? c_st_prv : rhs;
+
+#   pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      for (cs_lnum_t ii = 0; ii < 6; ii++)
+        rhs_st[c_id][ii] += cpro_buoyancy[c_id][ii] * cell_f_vol[c_id];
     }
 
     BFT_FREE(_buoyancy);
@@ -2222,6 +2177,9 @@ _pre_solve_ssg(const cs_field_t  *f_rij,
   /* Scalar diffusivity */
  else {
 
+    cs_real_t *w1;
+    BFT_MALLOC(w1, n_cells_ext, cs_real_t);
+
     if (eqp->idifft == 1) {
 #     pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
       for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
@@ -2236,9 +2194,9 @@ _pre_solve_ssg(const cs_field_t  *f_rij,
                       w1,
                       viscf,
                       viscb);
-  }
 
-  BFT_FREE(w1);
+    BFT_FREE(w1);
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3186,9 +3144,11 @@ cs_turbulence_rij(int          phase_id,
   /* Unsteady term
    * ------------- */
   if (eqp->istat == 1) {
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
     for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      const cs_real_t romvsdt = (crom[c_id]/dt[c_id])*cell_f_vol[c_id];
       for (int ii = 0; ii < 6; ii++)
-        rovsdtts[c_id][ii][ii] += (crom[c_id]/dt[c_id])*cell_f_vol[c_id];
+        rovsdtts[c_id][ii][ii] += romvsdt;
     }
   }
 